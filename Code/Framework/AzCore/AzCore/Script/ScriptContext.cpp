@@ -12,6 +12,7 @@
 #include <AzCore/RTTI/BehaviorContextUtilities.h>
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptProperty.h>
+#include <AzCore/Script/ScriptWorkers.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
@@ -372,6 +373,37 @@ namespace AZ
     }
 #endif//defined(LUA_USERDATA_TRACKING)
 
+    // Scripts on a script worker thread run in parallel with the main thread, so they can't dispatch EBus events or
+    // call behavior methods that aren't safe to call from any thread. Reports a script error when the call is refused.
+    static bool IsRefusedOnScriptWorkerThread(lua_State* lua, const char* name)
+    {
+        if (!ScriptWorkers::IsOnWorkerThread())
+        {
+            return false;
+        }
+
+        ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "%s can't be called from a script worker thread, only the math classes and the classes reflected with Script::Attributes::WorkerThreadSafe are available in OnWorkerTick and OnWorkerMessage!", name);
+        return true;
+    }
+
+    // Classes in the "math" module and classes with the WorkerThreadSafe attribute can be used on script worker threads.
+    static bool IsWorkerThreadSafe(const AttributeArray& attributes)
+    {
+        if (FindAttribute(Script::Attributes::WorkerThreadSafe, attributes))
+        {
+            return true;
+        }
+
+        if (Attribute* moduleAttribute = FindAttribute(Script::Attributes::Module, attributes))
+        {
+            const char* moduleName = nullptr;
+            AttributeReader moduleReader(nullptr, moduleAttribute);
+            return moduleReader.Read<const char*>(moduleName) && moduleName && strcmp(moduleName, "math") == 0;
+        }
+
+        return false;
+    }
+
     class LuaCaller
     {
     public:
@@ -382,7 +414,13 @@ namespace AZ
 
         virtual void PushClosure(lua_State* lua, const char* debugDescription) = 0;
 
+        bool IsRefusedOnThread(lua_State* lua) const
+        {
+            return !m_isWorkerThreadSafe && IsRefusedOnScriptWorkerThread(lua, m_method->m_name.c_str());
+        }
+
         BehaviorMethod* m_method;
+        bool m_isWorkerThreadSafe = false; ///< The method belongs to a class that can be used on script worker threads
     };
 
     namespace Internal
@@ -1479,7 +1517,8 @@ static void* LuaMemoryHook(void* userData, void* ptr, size_t osize, size_t nsize
     {
         if (ptr)
         {
-            allocator->DeAllocate(ptr);
+            // with the alignment of the allocation, so allocators that track their memory measure the same block
+            allocator->DeAllocate(ptr, 0, LUA_DEFAULT_ALIGNMENT);
         }
         return nullptr;
     }
@@ -3473,6 +3512,11 @@ LUA_API const Node* lua_getDummyNode()
             {
                 LuaScriptCaller* thisPtr = reinterpret_cast<LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
 
+                if (thisPtr->IsRefusedOnThread(lua))
+                {
+                    return 0;
+                }
+
                 // check number of arguments
                 int numElementsOnStack = lua_gettop(lua);
                 if (numElementsOnStack < static_cast<int>(thisPtr->m_method->GetMinNumberOfArguments()))
@@ -3648,6 +3692,11 @@ LUA_API const Node* lua_getDummyNode()
 
                 LuaGenericCaller* thisPtr = reinterpret_cast<LuaGenericCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
 
+                if (thisPtr->IsRefusedOnThread(lua))
+                {
+                    return 0;
+                }
+
                 int argc = lua_gettop(lua);
                 int luaNumArguments;
                 int luaStackIndex;
@@ -3865,6 +3914,11 @@ LUA_API const Node* lua_getDummyNode()
 
             static int CreateHandler(lua_State* lua)
             {
+                if (IsRefusedOnScriptWorkerThread(lua, "EBus CreateHandler/Connect"))
+                {
+                    return 0;
+                }
+
                 LSV_BEGIN(lua, 1);
 
                 int numArguments = lua_gettop(lua);
@@ -3946,6 +4000,11 @@ LUA_API const Node* lua_getDummyNode()
 
             static int Connect(lua_State* lua)
             {
+                if (IsRefusedOnScriptWorkerThread(lua, "EBus handler Connect"))
+                {
+                    return 0;
+                }
+
                 LSV_BEGIN(lua, 0);
 
                 const int numArguments = lua_gettop(lua);
@@ -4009,6 +4068,11 @@ LUA_API const Node* lua_getDummyNode()
 
             static int Disconnect(lua_State* lua)
             {
+                if (IsRefusedOnScriptWorkerThread(lua, "EBus handler Disconnect"))
+                {
+                    return 0;
+                }
+
                 LSV_BEGIN(lua, 0);
 
                 const int numArguments = lua_gettop(lua);
@@ -4258,6 +4322,11 @@ LUA_API const Node* lua_getDummyNode()
 
             static int FromLua(lua_State* lua)
             {
+                if (IsRefusedOnScriptWorkerThread(lua, "EBus QueueFunction"))
+                {
+                    return 0;
+                }
+
                 int numArguments = lua_gettop(lua);
 
                 // cache the function and all parameter for a later call
@@ -4631,6 +4700,8 @@ LUA_API const Node* lua_getDummyNode()
                     m_methods.insert(caller);
                 }
 
+                binder->m_isWorkerThreadSafe = m_isBindingWorkerThreadSafeClass;
+
                 return binder;
             }
 
@@ -5067,6 +5138,9 @@ LUA_API const Node* lua_getDummyNode()
                     }
                 }
 
+                // methods of the class, including its constructor, can be called on script worker threads
+                m_isBindingWorkerThreadSafeClass = IsWorkerThreadSafe(behaviorClass->m_attributes);
+
                 //////////////////////////////////////////////////////////////////////////
                 // Register class and it's metatables
                 lua_createtable(m_lua, 0, 5);
@@ -5242,6 +5316,8 @@ LUA_API const Node* lua_getDummyNode()
                 Internal::azlua_setglobal(m_lua, ValidateName(behaviorClass->m_name.c_str())); // set the metatable global name so we can call constructors and override __init and __finalize
 
                 lua_pop(m_lua, 1);   // pop instance metatable
+
+                m_isBindingWorkerThreadSafeClass = false;
             }
 
             //////////////////////////////////////////////////////////////////////////
@@ -5440,6 +5516,11 @@ LUA_API const Node* lua_getDummyNode()
                         
             static int ConnectToExposedEvent(lua_State* lua)
             {
+                if (IsRefusedOnScriptWorkerThread(lua, "ConnectToExposedEvent"))
+                {
+                    return 0;
+                }
+
                 if (!(lua_isuserdata(lua, -2) && !lua_islightuserdata(lua, -2)))
                 {
                     ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "1st argument to ConnectToExposedEvent is not userdata");
@@ -5677,6 +5758,29 @@ LUA_API const Node* lua_getDummyNode()
                 return false;
             }
 
+            //////////////////////////////////////////////////////////////////////////
+            bool LoadFromBuffer(const char* buffer, size_t bufferSize, const char* debugName, const char* mode, lua_State* lua)
+            {
+                LSV_BEGIN(m_lua, 1);
+
+                lua_State* thread = lua ? lua : NativeContext();
+
+                if (luaL_loadbufferx(thread, buffer, bufferSize, debugName, mode) == 0)
+                {
+                    return lua_isfunction(thread, -1);
+                }
+
+                if (!lua_isstring(thread, -1))
+                {
+                    lua_pop(thread, 1);
+                    lua_pushfstring(thread, "Failed to load script %s.", debugName);
+                }
+
+                AZ_Warning("LuaContext", false, "Failed to load script: %s", debugName);
+
+                return false;
+            }
+
             //////////////////////////////////////////////////////////////////////////
             inline lua_State* NativeContext()
             {
@@ -5837,6 +5941,7 @@ LUA_API const Node* lua_getDummyNode()
             ScriptTypeFactory                   m_scriptPropertyTableFactory;
             Internal::LuaSystemAllocator m_luaAllocator;
             AZStd::thread::id m_ownerThreadId; // Check if Lua methods (including EBus handlers) are called from background threads.
+            bool m_isBindingWorkerThreadSafeClass = false; ///< Callers created while binding a class inherit its WorkerThreadSafe flag
         };
 
     ScriptContext::ScriptContext(ScriptContextId id, IAllocator* allocator, lua_State* nativeContext)
@@ -5870,6 +5975,12 @@ LUA_API const Node* lua_getDummyNode()
         return m_impl->LoadFromStream(stream, debugName, mode, thread);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::LoadFromBuffer(const char* buffer, size_t bufferSize, const char* debugName, const char* mode, lua_State* thread)
+    {
+        return m_impl->LoadFromBuffer(buffer, bufferSize, debugName, mode, thread);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     void ScriptContext::GarbageCollect()
     {
@@ -775,7 +775,8 @@ namespace AZ
     enum ScriptContextIds : ScriptContextId
     {
         DefaultScriptContextId = 0,
-        CryScriptContextId = 1
+        CryScriptContextId = 1,
+        FirstWorkerScriptContextId = 0x10000 ///< The contexts of the script workers use consecutive ids from here, \ref ScriptWorkers
     };
 
     using StackVariableAllocator = AZStd::static_buffer_allocator<256, 16>;
@@ -856,6 +857,12 @@ namespace AZ
          */
         bool LoadFromStream(IO::GenericStream* stream, const char* debugName, const char* mode, lua_State* thread = nullptr);
 
+        /**
+         * Same as LoadFromStream, for a script that is already in memory. Lua reads the buffer in place instead of
+         * copying it through the stream in chunks, which is the fast path for the compiled chunks of script assets.
+         */
+        bool LoadFromBuffer(const char* buffer, size_t bufferSize, const char* debugName, const char* mode, lua_State* thread = nullptr);
+
         /// Perform a full garbage collect step, this can be slow prefer GargabeCollectStep for runtime garbage collect
         void GarbageCollect();
 
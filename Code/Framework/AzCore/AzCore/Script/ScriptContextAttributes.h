@@ -32,6 +32,7 @@ namespace AZ
             static constexpr AZ::Crc32 DisallowBroadcast = AZ_CRC_CE("DisallowBroadcast"); ///< Marks a reflected EBus as not allowing Broadcasts, only Events.
             static constexpr AZ::Crc32 ClassConstantValue = AZ_CRC_CE("ClassConstantValue"); ///< Indicates the property is backed by a constant value
             static constexpr AZ::Crc32 UseClassIndexAllowNil = AZ_CRC_CE("UseClassIndexAllowNil"); ///< Use the Class__IndexAllowNil method, which will not report an error on accessing undeclared values (allows for nil)
+            static constexpr AZ::Crc32 WorkerThreadSafe = AZ_CRC_CE("ScriptWorkerThreadSafe"); ///< Applied to classes. Their methods can be called from scripts that tick on script worker threads, classes in the "math" module are always allowed
 
             //! Attribute which stores BehaviorAzEventDescription structure which contains
             //! the script name of an AZ::Event and the name of it's parameter arguments
@@ -8,6 +8,7 @@
 #ifndef AZCORE_SCRIPT_SYSTEM_BUS_H
 #define AZCORE_SCRIPT_SYSTEM_BUS_H
 
+#include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Script/ScriptAsset.h>
 #include <AzCore/Script/ScriptContext.h>
@@ -104,6 +105,19 @@ namespace AZ
         virtual void RestoreDefaultRequireHook(ScriptContextId id) = 0;
 
         virtual void UseInMemoryRequireHook(const InMemoryScriptModules& modules, ScriptContextId id) = 0;
+
+        /// Returns the context of the script worker that runs the scripts of an entity, or the default context when
+        /// script workers are disabled. \ref ScriptWorkers
+        virtual ScriptContextId GetWorkerContextIdForEntity(const EntityId& entityId) = 0;
+
+        /**
+         * Adds the script instance table of an entity to the parallel ticks of a script worker. Does nothing when the
+         * context isn't the context of a script worker.
+         *
+         * \param tableReference   reference to the instance table in the Lua registry of the context
+         */
+        virtual void AddWorkerEntity(ScriptContextId id, const EntityId& entityId, int tableReference) = 0;
+        virtual void RemoveWorkerEntity(ScriptContextId id, const EntityId& entityId) = 0;
     };
 
     using ScriptSystemRequestBus = AZ::EBus<ScriptSystemRequests>;
@@ -26,6 +26,7 @@
 #include <AzCore/Script/ScriptDebug.h>
 #include <AzCore/Script/ScriptPropertySerializer.h>
 #include <AzCore/Script/ScriptSystemComponent.h>
+#include <AzCore/Script/ScriptWorkers.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/Serialization/DynamicSerializableField.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -86,6 +87,23 @@ void ScriptSystemComponent::Activate()
     // Create default context
     AddContextWithId(ScriptContextIds::DefaultScriptContextId);
 
+    if (m_workerContextCount > 0)
+    {
+        m_workers = AZStd::make_unique<ScriptWorkers>(m_workerContextCount, m_defaultGarbageCollectorSteps);
+        for (AZ::u32 index = 0; index < m_workerContextCount; ++index)
+        {
+            ScriptContext* workerContext = AddContext(&m_workers->GetWorker(index).GetContext(), m_defaultGarbageCollectorSteps);
+            workerContext->SetRequireHook(
+                [this](lua_State* lua, ScriptContext* context, const char* module) -> int
+                {
+                    return DefaultRequireHook(lua, context, module);
+                });
+            GetContextContainer(workerContext->GetId())->m_isWorker = true;
+        }
+
+        TickBus::Handler::BusConnect();
+    }
+
     ScriptSystemRequestBus::Handler::BusConnect();
 
     SystemTickBus::Handler::BusConnect();
@@ -111,6 +129,7 @@ void ScriptSystemComponent::Deactivate()
 {
     AZ::AssetTypeInfoBus::Handler::BusDisconnect();
     Data::AssetBus::MultiHandler::BusDisconnect();
+    TickBus::Handler::BusDisconnect();
     SystemTickBus::Handler::BusDisconnect();
     ScriptSystemRequestBus::Handler::BusDisconnect();
 
@@ -129,6 +148,9 @@ void ScriptSystemComponent::Deactivate()
 
     m_contexts.clear();
 
+    // The worker contexts aren't owned by the containers, they are deleted with their threads
+    m_workers.reset();
+
     // Need to do this at the end, so that any cached scripts cleared above may be released properly
     if (Data::AssetManager::Instance().IsReady())
     {
@@ -310,7 +332,48 @@ void    ScriptSystemComponent::OnSystemTick()
             contextContainer.m_context->GetDebugContext()->ProcessDebugCommands();
         }
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        if (!contextContainer.m_isWorker)
+        {
+            contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        }
+    }
+}
+
+//=========================================================================
+// OnTick
+//=========================================================================
+void ScriptSystemComponent::OnTick(float deltaTime, ScriptTimePoint time)
+{
+    m_workers->Tick(deltaTime, time);
+}
+
+//=========================================================================
+// GetWorkerContextIdForEntity
+//=========================================================================
+ScriptContextId ScriptSystemComponent::GetWorkerContextIdForEntity(const EntityId& entityId)
+{
+    return m_workers ? m_workers->GetContextIdForEntity(entityId) : ScriptContextIds::DefaultScriptContextId;
+}
+
+//=========================================================================
+// AddWorkerEntity
+//=========================================================================
+void ScriptSystemComponent::AddWorkerEntity(ScriptContextId id, const EntityId& entityId, int tableReference)
+{
+    if (m_workers)
+    {
+        m_workers->AddEntity(id, entityId, tableReference);
+    }
+}
+
+//=========================================================================
+// RemoveWorkerEntity
+//=========================================================================
+void ScriptSystemComponent::RemoveWorkerEntity(ScriptContextId id, const EntityId& entityId)
+{
+    if (m_workers)
+    {
+        m_workers->RemoveEntity(id, entityId);
     }
 }
 
@@ -388,9 +451,9 @@ ScriptLoadResult ScriptSystemComponent::LoadAndGetNativeContext(const Data::Asse
         }
     }
 
-    // Load lua script into the VM
-    IO::MemoryStream stream = asset.Get()->m_data.CreateScriptReadStream();
-    if (!context->LoadFromStream(&stream, asset.Get()->m_data.GetDebugName(), mode, lua))
+    // Load lua script into the VM, the compiled chunk is read in place from the asset
+    const AZStd::vector<char>& scriptBuffer = asset.Get()->m_data.GetScriptBuffer();
+    if (!context->LoadFromBuffer(scriptBuffer.data(), scriptBuffer.size(), asset.Get()->m_data.GetDebugName(), mode, lua))
     {
         context->Error(ScriptContext::ErrorType::Error, "%s", lua_tostring(lua, -1));
         lua_pop(lua, 1);
@@ -862,6 +925,7 @@ void ScriptSystemComponent::Reflect(ReflectContext* reflection)
 {
     ScriptTimePoint::Reflect(reflection);
     LuaScriptData::Reflect(reflection);
+    ScriptWorkers::Reflect(reflection);
 
     if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(reflection))
     {
@@ -870,6 +934,7 @@ void ScriptSystemComponent::Reflect(ReflectContext* reflection)
             ->Version(1)
             // ->Attribute(AZ::Edit::Attributes::SystemComponentTags, AZStd::vector<AZ::Crc32>({ AZ_CRC("AssetBuilder", 0xc739c7d7) }))
             ->Field("garbageCollectorSteps", &ScriptSystemComponent::m_defaultGarbageCollectorSteps)
+            ->Field("workerContextCount", &ScriptSystemComponent::m_workerContextCount)
             ;
 
         if (EditContext* editContext = serializeContext->GetEditContext())
@@ -17,6 +17,7 @@
 namespace AZ
 {
     class ScriptTimePoint;
+    class ScriptWorkers;
 
     /**
      * Script system component. It will manage all script contexts and provide script asset handler.
@@ -28,6 +29,7 @@ namespace AZ
         : public Component
         , public ScriptSystemRequestBus::Handler
         , public SystemTickBus::Handler
+        , public TickBus::Handler
         , public Data::AssetHandler
         , public AssetTypeInfoBus::Handler
         , protected Data::AssetBus::MultiHandler
@@ -68,6 +70,10 @@ namespace AZ
 
         void RestoreDefaultRequireHook(ScriptContextId id = ScriptContextIds::DefaultScriptContextId) override;
         void UseInMemoryRequireHook(const InMemoryScriptModules& modules, ScriptContextId id = ScriptContextIds::DefaultScriptContextId) override;
+
+        ScriptContextId GetWorkerContextIdForEntity(const EntityId& entityId) override;
+        void AddWorkerEntity(ScriptContextId id, const EntityId& entityId, int tableReference) override;
+        void RemoveWorkerEntity(ScriptContextId id, const EntityId& entityId) override;
         //////////////////////////////////////////////////////////////////////////
 
         //////////////////////////////////////////////////////////////////////////
@@ -75,6 +81,11 @@ namespace AZ
         void OnSystemTick() override;
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // TickBus
+        void OnTick(float deltaTime, ScriptTimePoint time) override;
+        //////////////////////////////////////////////////////////////////////////
+
         //////////////////////////////////////////////////////////////////////////
         // AssetHandler
         /// Called by the asset database to create a new asset. No loading should during this call
@@ -124,11 +135,13 @@ namespace AZ
             int                                 m_tableReference = -2; //< The reference to the table returned by the script (default -2 == LUA_NOREF)
         };
         int m_defaultGarbageCollectorSteps;
+        AZ::u32 m_workerContextCount = 0; ///< Number of script contexts that tick in parallel on worker threads, 0 disables them
 
         struct ContextContainer
         {
             ScriptContext* m_context = nullptr;
             bool m_isOwner = true;
+            bool m_isWorker = false; ///< The context is garbage collected by its worker thread
             int m_garbageCollectorSteps = 0;
             AZStd::unordered_map<Uuid, LoadedScriptInfo> m_loadedScripts;
             AZStd::unordered_map<Uuid, Data::Asset<ScriptAsset>> m_trackedScripts;
@@ -146,6 +159,7 @@ namespace AZ
             {
                 m_context = rhs.m_context;
                 m_isOwner = rhs.m_isOwner;
+                m_isWorker = rhs.m_isWorker;
                 m_garbageCollectorSteps = rhs.m_garbageCollectorSteps;
 
                 {
@@ -173,5 +187,7 @@ namespace AZ
         InMemoryScriptModules m_inMemoryModules;
 
         AZStd::vector<ContextContainer> m_contexts;
+
+        AZStd::unique_ptr<ScriptWorkers> m_workers;
     };
 }
@@ -24,6 +24,7 @@ namespace AZ
             behaviorContext->Class<ScriptTimePoint>()->
                 Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)->
                 Attribute(AZ::Script::Attributes::Module, "script")->
+                Attribute(AZ::Script::Attributes::WorkerThreadSafe, true)->
                 Method("ToString", &ScriptTimePoint::ToString)->
                     Attribute(Script::Attributes::Operator,Script::Attributes::OperatorType::ToString)->
                 Method("GetSeconds", &ScriptTimePoint::GetSeconds)->
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if !defined(AZCORE_EXCLUDE_LUA)
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptWorkers.h>
+#include <AzCore/Script/lua/lua.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace LocalTU_ScriptWorkers
+    {
+        // the worker and the entity whose script is running on this thread, they identify the sender of a message
+        static thread_local ScriptWorker* s_currentWorker = nullptr;
+        static thread_local EntityId s_currentEntity;
+    }
+
+    //=========================================================================
+    // ScriptWorkerAllocator
+    //=========================================================================
+    ScriptWorkerAllocator::pointer ScriptWorkerAllocator::allocate(size_type byteSize, align_type alignment)
+    {
+        pointer ptr = AllocatorGlobalWrapper<SystemAllocator>::allocate(byteSize, alignment);
+        if (ptr)
+        {
+            m_allocatedBytes += get_allocated_size(ptr, alignment);
+        }
+        return ptr;
+    }
+
+    void ScriptWorkerAllocator::deallocate(pointer ptr, size_type byteSize, align_type alignment)
+    {
+        if (ptr)
+        {
+            m_allocatedBytes -= get_allocated_size(ptr, alignment);
+        }
+        AllocatorGlobalWrapper<SystemAllocator>::deallocate(ptr, byteSize, alignment);
+    }
+
+    ScriptWorkerAllocator::pointer ScriptWorkerAllocator::reallocate(pointer ptr, size_type newSize, align_type alignment)
+    {
+        const size_type oldSize = ptr ? get_allocated_size(ptr, alignment) : 0;
+        pointer newPtr = AllocatorGlobalWrapper<SystemAllocator>::reallocate(ptr, newSize, alignment);
+        if (newPtr)
+        {
+            m_allocatedBytes += get_allocated_size(newPtr, alignment);
+            m_allocatedBytes -= oldSize;
+        }
+        return newPtr;
+    }
+
+    ScriptWorkerAllocator::size_type ScriptWorkerAllocator::NumAllocatedBytes() const
+    {
+        return m_allocatedBytes;
+    }
+
+    //=========================================================================
+    // ScriptWorker
+    //=========================================================================
+    ScriptWorker::ScriptWorker(ScriptContextId contextId, AZ::u32 index, int garbageCollectorSteps)
+        : m_context(contextId, &m_allocator)
+        , m_index(index)
+        , m_garbageCollectorSteps(garbageCollectorSteps)
+        , m_mainThreadId(AZStd::this_thread::get_id())
+    {
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Script Worker";
+        m_thread = AZStd::thread(
+            threadDesc,
+            [this]()
+            {
+                Run();
+            });
+    }
+
+    ScriptWorker::~ScriptWorker()
+    {
+        AZ_Assert(m_entities.empty(), "Script worker destroyed while %zu entities are still ticking in it", m_entities.size());
+        m_isRunning = false;
+        m_tickStarted.release();
+        m_thread.join();
+    }
+
+    ScriptContext& ScriptWorker::GetContext()
+    {
+        return m_context;
+    }
+
+    AZ::u32 ScriptWorker::GetIndex() const
+    {
+        return m_index;
+    }
+
+    size_t ScriptWorker::GetAllocatedBytes() const
+    {
+        return m_allocator.NumAllocatedBytes();
+    }
+
+    void ScriptWorker::AddEntity(const EntityId& entityId, int tableReference)
+    {
+        auto iter = AZStd::lower_bound(m_entities.begin(), m_entities.end(), entityId,
+            [](const EntityEntry& entry, const EntityId& id)
+            {
+                return entry.m_entityId < id;
+            });
+
+        if (iter != m_entities.end() && iter->m_entityId == entityId)
+        {
+            iter->m_tableReference = tableReference;
+        }
+        else
+        {
+            m_entities.insert(iter, EntityEntry{ entityId, tableReference });
+        }
+    }
+
+    void ScriptWorker::RemoveEntity(const EntityId& entityId)
+    {
+        if (EntityEntry* entry = FindEntity(entityId))
+        {
+            m_entities.erase(m_entities.begin() + (entry - m_entities.data()));
+        }
+    }
+
+    ScriptWorker::EntityEntry* ScriptWorker::FindEntity(const EntityId& entityId)
+    {
+        auto iter = AZStd::lower_bound(m_entities.begin(), m_entities.end(), entityId,
+            [](const EntityEntry& entry, const EntityId& id)
+            {
+                return entry.m_entityId < id;
+            });
+
+        return iter != m_entities.end() && iter->m_entityId == entityId ? &*iter : nullptr;
+    }
+
+    void ScriptWorker::QueueMessage(ScriptWorkerMessage&& message)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_inboxMutex);
+        m_inbox.emplace_back(AZStd::move(message));
+    }
+
+    AZ::u64 ScriptWorker::NextMessageSequence()
+    {
+        return m_messageSequence++;
+    }
+
+    void ScriptWorker::StartTick(float deltaTime, const ScriptTimePoint& time)
+    {
+        m_deltaTime = deltaTime;
+        m_time = time;
+
+        // messages sent during a tick are delivered in the next one, whether or not the receiver already started the tick
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_inboxMutex);
+            m_delivering.swap(m_inbox);
+        }
+
+        m_tickStarted.release();
+    }
+
+    void ScriptWorker::WaitForTick()
+    {
+        m_tickFinished.acquire();
+    }
+
+    void ScriptWorker::Run()
+    {
+        for (;;)
+        {
+            m_tickStarted.acquire();
+            if (!m_isRunning)
+            {
+                return;
+            }
+
+            Tick();
+            m_tickFinished.release();
+        }
+    }
+
+    void ScriptWorker::Tick()
+    {
+        AZ_PROFILE_SCOPE(AzCore, "ScriptWorker::Tick");
+
+        // the main thread waits for the tick, so this thread is the only one running scripts in the context until it returns
+        m_context.DebugSetOwnerThread(AZStd::this_thread::get_id());
+        LocalTU_ScriptWorkers::s_currentWorker = this;
+
+        DeliverMessages();
+        TickEntities();
+        m_context.GarbageCollectStep(m_garbageCollectorSteps);
+
+        LocalTU_ScriptWorkers::s_currentWorker = nullptr;
+        LocalTU_ScriptWorkers::s_currentEntity = EntityId();
+        m_context.DebugSetOwnerThread(m_mainThreadId);
+    }
+
+    void ScriptWorker::DeliverMessages()
+    {
+        if (m_delivering.empty())
+        {
+            return;
+        }
+
+        // the order of the queue depends on the timing of the workers, the order of the messages of each sender doesn't
+        AZStd::sort(m_delivering.begin(), m_delivering.end(),
+            [](const ScriptWorkerMessage& lhs, const ScriptWorkerMessage& rhs)
+            {
+                return lhs.m_senderOrder != rhs.m_senderOrder ? lhs.m_senderOrder < rhs.m_senderOrder : lhs.m_sequence < rhs.m_sequence;
+            });
+
+        lua_State* lua = m_context.NativeContext();
+        for (const ScriptWorkerMessage& message : m_delivering)
+        {
+            const EntityEntry* entry = FindEntity(message.m_target);
+            if (!entry)
+            {
+                AZ_Warning("Script", false, "Script message %s sent to entity %s, which doesn't run in a script worker",
+                    message.m_name.c_str(), message.m_target.ToString().c_str());
+                continue;
+            }
+
+            LocalTU_ScriptWorkers::s_currentEntity = message.m_target;
+
+            lua_rawgeti(lua, LUA_REGISTRYINDEX, entry->m_tableReference);
+            lua_getfield(lua, -1, "OnWorkerMessage");
+            if (lua_isfunction(lua, -1))
+            {
+                lua_pushvalue(lua, -2);
+                ScriptValue<EntityId>::StackPush(lua, message.m_sender);
+                lua_pushlstring(lua, message.m_name.c_str(), message.m_name.size());
+                lua_pushlstring(lua, message.m_payload.c_str(), message.m_payload.size());
+                Internal::LuaSafeCall(lua, 4, 0);
+                lua_pop(lua, 1); // the entity table
+            }
+            else
+            {
+                lua_pop(lua, 2); // the entity table and the missing handler
+            }
+        }
+
+        m_delivering.clear();
+    }
+
+    void ScriptWorker::TickEntities()
+    {
+        lua_State* lua = m_context.NativeContext();
+        for (const EntityEntry& entry : m_entities)
+        {
+            LocalTU_ScriptWorkers::s_currentEntity = entry.m_entityId;
+
+            lua_rawgeti(lua, LUA_REGISTRYINDEX, entry.m_tableReference);
+            lua_getfield(lua, -1, "OnWorkerTick");
+            if (lua_isfunction(lua, -1))
+            {
+                lua_pushvalue(lua, -2);
+                ScriptValue<float>::StackPush(lua, m_deltaTime);
+                ScriptValue<ScriptTimePoint>::StackPush(lua, m_time);
+                Internal::LuaSafeCall(lua, 3, 0);
+                lua_pop(lua, 1); // the entity table
+            }
+            else
+            {
+                lua_pop(lua, 2); // the entity table and the missing handler
+            }
+        }
+    }
+
+    //=========================================================================
+    // ScriptWorkers
+    //=========================================================================
+    ScriptWorkers::ScriptWorkers(AZ::u32 workerCount, int garbageCollectorSteps)
+    {
+        m_workers.reserve(workerCount);
+        for (AZ::u32 index = 0; index < workerCount; ++index)
+        {
+            m_workers.emplace_back(aznew ScriptWorker(ScriptContextIds::FirstWorkerScriptContextId + index, index, garbageCollectorSteps));
+        }
+
+        Interface<ScriptWorkers>::Register(this);
+    }
+
+    ScriptWorkers::~ScriptWorkers()
+    {
+        Interface<ScriptWorkers>::Unregister(this);
+    }
+
+    void ScriptWorkers::Reflect(ReflectContext* context)
+    {
+        if (BehaviorContext* behaviorContext = azrtti_cast<BehaviorContext*>(context))
+        {
+            behaviorContext->Class<ScriptWorkers>("ScriptWorkers")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "components")
+                ->Attribute(AZ::Script::Attributes::WorkerThreadSafe, true)
+                ->Method("Send", &ScriptWorkers::SendScriptMessage)
+                ;
+        }
+    }
+
+    bool ScriptWorkers::IsOnWorkerThread()
+    {
+        return LocalTU_ScriptWorkers::s_currentWorker != nullptr;
+    }
+
+    void ScriptWorkers::SendScriptMessage(const EntityId& target, AZStd::string_view name, AZStd::string_view payload)
+    {
+        ScriptWorkers* workers = Interface<ScriptWorkers>::Get();
+        if (!workers)
+        {
+            AZ_Warning("Script", false, "Script message %.*s can't be sent, script workers are disabled", AZ_STRING_ARG(name));
+            return;
+        }
+
+        ScriptWorker* targetWorker = nullptr;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(workers->m_entityWorkersMutex);
+            auto iter = workers->m_entityWorkers.find(target);
+            if (iter != workers->m_entityWorkers.end())
+            {
+                targetWorker = iter->second;
+            }
+        }
+
+        if (!targetWorker)
+        {
+            AZ_Warning("Script", false, "Script message %.*s sent to entity %s, which doesn't run in a script worker",
+                AZ_STRING_ARG(name), target.ToString().c_str());
+            return;
+        }
+
+        ScriptWorkerMessage message;
+        message.m_sender = LocalTU_ScriptWorkers::s_currentEntity;
+        message.m_target = target;
+        message.m_name = name;
+        message.m_payload = payload;
+
+        if (ScriptWorker* sendingWorker = LocalTU_ScriptWorkers::s_currentWorker)
+        {
+            message.m_senderOrder = sendingWorker->GetIndex() + 1;
+            message.m_sequence = sendingWorker->NextMessageSequence();
+        }
+        else
+        {
+            // scripts in the other contexts run on the main thread, but native code may send from any thread
+            message.m_senderOrder = 0;
+            message.m_sequence = workers->m_mainThreadMessageSequence.fetch_add(1);
+        }
+
+        targetWorker->QueueMessage(AZStd::move(message));
+    }
+
+    AZ::u32 ScriptWorkers::GetWorkerCount() const
+    {
+        return aznumeric_caster(m_workers.size());
+    }
+
+    ScriptWorker& ScriptWorkers::GetWorker(AZ::u32 index)
+    {
+        return *m_workers[index];
+    }
+
+    ScriptWorker* ScriptWorkers::FindWorker(ScriptContextId contextId)
+    {
+        if (contextId >= ScriptContextIds::FirstWorkerScriptContextId && contextId - ScriptContextIds::FirstWorkerScriptContextId < m_workers.size())
+        {
+            return m_workers[contextId - ScriptContextIds::FirstWorkerScriptContextId].get();
+        }
+
+        return nullptr;
+    }
+
+    ScriptContextId ScriptWorkers::GetContextIdForEntity(const EntityId& entityId) const
+    {
+        const size_t index = AZStd::hash<EntityId>()(entityId) % m_workers.size();
+        return ScriptContextIds::FirstWorkerScriptContextId + aznumeric_cast<ScriptContextId>(index);
+    }
+
+    void ScriptWorkers::AddEntity(ScriptContextId contextId, const EntityId& entityId, int tableReference)
+    {
+        if (ScriptWorker* worker = FindWorker(contextId))
+        {
+            worker->AddEntity(entityId, tableReference);
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_entityWorkersMutex);
+            m_entityWorkers[entityId] = worker;
+        }
+    }
+
+    void ScriptWorkers::RemoveEntity(ScriptContextId contextId, const EntityId& entityId)
+    {
+        if (ScriptWorker* worker = FindWorker(contextId))
+        {
+            worker->RemoveEntity(entityId);
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_entityWorkersMutex);
+            m_entityWorkers.erase(entityId);
+        }
+    }
+
+    void ScriptWorkers::Tick(float deltaTime, const ScriptTimePoint& time)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "ScriptWorkers::Tick");
+
+        for (AZStd::unique_ptr<ScriptWorker>& worker : m_workers)
+        {
+            worker->StartTick(deltaTime, time);
+        }
+
+        for (AZStd::unique_ptr<ScriptWorker>& worker : m_workers)
+        {
+            worker->WaitForTick();
+        }
+    }
+}
+
+#endif // #if !defined(AZCORE_EXCLUDE_LUA)
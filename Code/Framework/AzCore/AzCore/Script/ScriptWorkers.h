@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/AllocatorWrappers.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/ScriptTimePoint.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    /**
+     * Allocator of the Lua state of a script worker. It allocates from the SystemAllocator like the default script
+     * allocator, and counts the bytes that its context holds so the memory of every worker can be reported separately.
+     */
+    class ScriptWorkerAllocator
+        : public AllocatorGlobalWrapper<SystemAllocator>
+    {
+    public:
+        AZ_RTTI(ScriptWorkerAllocator, "{3F0C5E21-8B7A-4C9D-A1E6-52D4B7F90C38}", IAllocator);
+
+        pointer allocate(size_type byteSize, align_type alignment = 1) override;
+        void deallocate(pointer ptr, size_type byteSize = 0, align_type alignment = 0) override;
+        pointer reallocate(pointer ptr, size_type newSize, align_type alignment = 1) override;
+        size_type NumAllocatedBytes() const override;
+
+    private:
+        AZStd::atomic<size_type> m_allocatedBytes{ 0 };
+    };
+
+    /**
+     * A message from a script to a script entity that may run in another script context. Values can't be shared between
+     * Lua states, so the name and the payload are strings.
+     */
+    struct ScriptWorkerMessage
+    {
+        EntityId m_sender;
+        EntityId m_target;
+        AZStd::string m_name;
+        AZStd::string m_payload;
+        AZ::u32 m_senderOrder = 0; ///< 0 for the main thread, 1 + the index of the sending worker otherwise
+        AZ::u64 m_sequence = 0; ///< Order of the message among the messages of its sender
+    };
+
+    /**
+     * A script context that is owned by a worker thread. The thread ticks the script instances of the entities that were
+     * added to the worker, which is the only time scripts run in the context outside of the main thread. Ticks start and
+     * finish on the main thread, so entities can be activated and deactivated in the context between ticks.
+     */
+    class ScriptWorker
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ScriptWorker, SystemAllocator, 0);
+
+        ScriptWorker(ScriptContextId contextId, AZ::u32 index, int garbageCollectorSteps);
+        ~ScriptWorker();
+
+        ScriptWorker(const ScriptWorker&) = delete;
+        ScriptWorker& operator=(const ScriptWorker&) = delete;
+
+        ScriptContext& GetContext();
+        AZ::u32 GetIndex() const;
+
+        /// Bytes held by the Lua state of the worker.
+        size_t GetAllocatedBytes() const;
+
+        /// Adds the script instance table of an entity, referenced in the Lua registry, to the ticks of the worker.
+        void AddEntity(const EntityId& entityId, int tableReference);
+        void RemoveEntity(const EntityId& entityId);
+
+        /// Queues a message, it is delivered at the start of the next tick. Can be called from any thread.
+        void QueueMessage(ScriptWorkerMessage&& message);
+
+        /// Assigns a sequence to a message that is sent from this worker's thread.
+        AZ::u64 NextMessageSequence();
+
+        void StartTick(float deltaTime, const ScriptTimePoint& time);
+        void WaitForTick();
+
+    private:
+        struct EntityEntry
+        {
+            EntityId m_entityId;
+            int m_tableReference;
+        };
+
+        void Run();
+        void Tick();
+        void DeliverMessages();
+        void TickEntities();
+        EntityEntry* FindEntity(const EntityId& entityId);
+
+        ScriptWorkerAllocator m_allocator;
+        ScriptContext m_context;
+        AZ::u32 m_index = 0;
+        int m_garbageCollectorSteps = 0;
+
+        AZStd::vector<EntityEntry> m_entities; ///< Sorted by entity id, which is the order of the ticks
+        AZStd::mutex m_inboxMutex;
+        AZStd::vector<ScriptWorkerMessage> m_inbox;
+        AZStd::vector<ScriptWorkerMessage> m_delivering;
+        AZ::u64 m_messageSequence = 0;
+
+        float m_deltaTime = 0.0f;
+        ScriptTimePoint m_time;
+        AZStd::thread::id m_mainThreadId;
+        AZStd::atomic_bool m_isRunning{ true };
+        AZStd::semaphore m_tickStarted;
+        AZStd::semaphore m_tickFinished;
+        AZStd::thread m_thread;
+    };
+
+    /**
+     * Shards script entities across script contexts that tick in parallel on worker threads. Every entity is assigned to
+     * a worker by its id, and each worker ticks its entities in the order of their ids, so the result of a tick doesn't
+     * depend on the scheduling of the threads.
+     *
+     * Scripts receive the parallel tick in OnWorkerTick(self, deltaTime, timePoint). Scripts don't share state across
+     * contexts, they communicate with ScriptWorkers.Send(targetEntityId, name, payload), which is delivered to
+     * OnWorkerMessage(self, senderEntityId, name, payload) at the start of the next tick, ordered by sender.
+     * OnWorkerTick and OnWorkerMessage run on a worker thread, where scripts can only call the methods of the classes in
+     * the "math" module and of the classes reflected with Script::Attributes::WorkerThreadSafe, like EntityId and
+     * ScriptWorkers. Every other behavior method, EBus event and EBus handler connection is refused with a script error.
+     */
+    class ScriptWorkers
+    {
+    public:
+        AZ_RTTI(ScriptWorkers, "{9A4D61B8-2E07-4F53-B8C1-D63E0A7F1B92}");
+        AZ_CLASS_ALLOCATOR(ScriptWorkers, SystemAllocator, 0);
+
+        ScriptWorkers(AZ::u32 workerCount, int garbageCollectorSteps);
+        virtual ~ScriptWorkers();
+
+        static void Reflect(ReflectContext* context);
+
+        /// Sends a message to the script of an entity in a worker context.
+        static void SendScriptMessage(const EntityId& target, AZStd::string_view name, AZStd::string_view payload);
+
+        /// True while a worker thread ticks its scripts.
+        static bool IsOnWorkerThread();
+
+        AZ::u32 GetWorkerCount() const;
+        ScriptWorker& GetWorker(AZ::u32 index);
+        ScriptWorker* FindWorker(ScriptContextId contextId);
+
+        ScriptContextId GetContextIdForEntity(const EntityId& entityId) const;
+
+        void AddEntity(ScriptContextId contextId, const EntityId& entityId, int tableReference);
+        void RemoveEntity(ScriptContextId contextId, const EntityId& entityId);
+
+        /// Ticks all workers in parallel and returns when they have all finished.
+        void Tick(float deltaTime, const ScriptTimePoint& time);
+
+    private:
+        AZStd::vector<AZStd::unique_ptr<ScriptWorker>> m_workers;
+        AZStd::shared_mutex m_entityWorkersMutex;
+        AZStd::unordered_map<EntityId, ScriptWorker*> m_entityWorkers;
+        AZStd::atomic<AZ::u64> m_mainThreadMessageSequence{ 0 }; ///< Sequence of the messages sent from outside of the workers, from any thread
+    };
+}
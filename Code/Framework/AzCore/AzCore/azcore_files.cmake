@@ -502,6 +502,8 @@ set(FILES
     Script/ScriptSystemComponent.h
     Script/ScriptTimePoint.cpp
     Script/ScriptTimePoint.h
+    Script/ScriptWorkers.cpp
+    Script/ScriptWorkers.h
     Script/ScriptProperty.h
     Script/ScriptProperty.cpp
     Script/ScriptPropertySerializer.h
@@ -31,6 +31,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Memory/MemoryComponent.h>
 #include <AzCore/Script/ScriptSystemComponent.h>
+#include <AzCore/Script/ScriptWorkers.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetManagerComponent.h>
 
@@ -4493,6 +4494,162 @@ ramenShop.handler:Connect(4);
         )LUA");
         m_script->SetErrorHook(oldHook);
     }
+
+    class ScriptWorkersTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_workers = aznew ScriptWorkers(2, 2);
+        }
+
+        void TearDown() override
+        {
+            delete m_workers;
+
+            AllocatorsFixture::TearDown();
+        }
+
+        static constexpr const char* s_countingScript = R"(
+                WorkerEntity = { ticks = 0, messages = {} }
+                function WorkerEntity:OnWorkerTick(deltaTime, timePoint)
+                    self.ticks = self.ticks + 1
+                end
+                function WorkerEntity:OnWorkerMessage(sender, name, payload)
+                    table.insert(self.messages, name .. payload)
+                end
+            )";
+
+        int AddWorkerEntity(const EntityId& entityId, const char* code = s_countingScript)
+        {
+            ScriptWorker* worker = m_workers->FindWorker(m_workers->GetContextIdForEntity(entityId));
+            EXPECT_NE(nullptr, worker);
+            lua_State* lua = worker->GetContext().NativeContext();
+
+            EXPECT_TRUE(worker->GetContext().Execute(code));
+
+            lua_getglobal(lua, "WorkerEntity");
+            const int tableReference = luaL_ref(lua, LUA_REGISTRYINDEX);
+            m_workers->AddEntity(worker->GetContext().GetId(), entityId, tableReference);
+            return tableReference;
+        }
+
+        void RemoveWorkerEntity(const EntityId& entityId, int tableReference)
+        {
+            ScriptWorker* worker = m_workers->FindWorker(m_workers->GetContextIdForEntity(entityId));
+            m_workers->RemoveEntity(worker->GetContext().GetId(), entityId);
+            luaL_unref(worker->GetContext().NativeContext(), LUA_REGISTRYINDEX, tableReference);
+        }
+
+        ScriptWorkers* m_workers = nullptr;
+    };
+
+    TEST_F(ScriptWorkersTest, GetContextIdForEntity_ReturnsWorkerContext)
+    {
+        for (AZ::u64 id = 1; id < 16; ++id)
+        {
+            const ScriptContextId contextId = m_workers->GetContextIdForEntity(EntityId(id));
+            EXPECT_EQ(contextId, m_workers->GetContextIdForEntity(EntityId(id)));
+            ASSERT_NE(nullptr, m_workers->FindWorker(contextId));
+            EXPECT_EQ(contextId, m_workers->FindWorker(contextId)->GetContext().GetId());
+        }
+
+        EXPECT_EQ(nullptr, m_workers->FindWorker(ScriptContextIds::DefaultScriptContextId));
+    }
+
+    TEST_F(ScriptWorkersTest, Tick_MessagesQueued_DeliveredInSendOrderBeforeTick)
+    {
+        const EntityId entityId(42);
+        const int tableReference = AddWorkerEntity(entityId);
+        ScriptWorker* worker = m_workers->FindWorker(m_workers->GetContextIdForEntity(entityId));
+        lua_State* lua = worker->GetContext().NativeContext();
+
+        ScriptWorkers::SendScriptMessage(entityId, "first", "1");
+        ScriptWorkers::SendScriptMessage(entityId, "second", "2");
+        m_workers->Tick(0.016f, ScriptTimePoint());
+        m_workers->Tick(0.016f, ScriptTimePoint());
+
+        EXPECT_TRUE(worker->GetContext().Execute("WorkerTicks = WorkerEntity.ticks WorkerMessages = table.concat(WorkerEntity.messages, ',')"));
+        lua_getglobal(lua, "WorkerTicks");
+        EXPECT_EQ(2, lua_tointeger(lua, -1));
+        lua_getglobal(lua, "WorkerMessages");
+        EXPECT_STREQ("first1,second2", lua_tostring(lua, -1));
+        lua_pop(lua, 2);
+
+        EXPECT_GT(worker->GetAllocatedBytes(), 0u);
+
+        RemoveWorkerEntity(entityId, tableReference);
+    }
+
+    struct WorkerThreadSafeTestClass
+    {
+        AZ_TYPE_INFO(WorkerThreadSafeTestClass, "{6C1E0B94-3F2D-4A87-9E51-D80B7C2A4F63}");
+
+        static int Add(int a, int b)
+        {
+            return a + b;
+        }
+    };
+
+    struct WorkerThreadUnsafeTestClass
+    {
+        AZ_TYPE_INFO(WorkerThreadUnsafeTestClass, "{E2A7593D-0C46-4B18-A3F9-61D5E84B0C27}");
+
+        static int Add(int a, int b)
+        {
+            return a + b;
+        }
+    };
+
+    TEST_F(ScriptWorkersTest, Tick_BehaviorMethodsCalled_OnlyWorkerThreadSafeClassesAreCalled)
+    {
+        BehaviorContext behaviorContext;
+        behaviorContext.Class<WorkerThreadSafeTestClass>("WorkerThreadSafeTestClass")
+            ->Attribute(AZ::Script::Attributes::WorkerThreadSafe, true)
+            ->Method("Add", &WorkerThreadSafeTestClass::Add);
+        behaviorContext.Class<WorkerThreadUnsafeTestClass>("WorkerThreadUnsafeTestClass")
+            ->Method("Add", &WorkerThreadUnsafeTestClass::Add);
+
+        const EntityId entityId(42);
+        ScriptWorker* worker = m_workers->FindWorker(m_workers->GetContextIdForEntity(entityId));
+        ScriptContext& context = worker->GetContext();
+        context.BindTo(&behaviorContext);
+
+        AZStd::atomic_int errorCount{ 0 };
+        context.SetErrorHook([&errorCount](ScriptContext*, ScriptContext::ErrorType, const char*) { ++errorCount; });
+
+        const int tableReference = AddWorkerEntity(entityId, R"(
+                WorkerEntity = {}
+                function WorkerEntity:OnWorkerTick(deltaTime, timePoint)
+                    self.safeResult = WorkerThreadSafeTestClass.Add(1, 2)
+                    self.unsafeResult = WorkerThreadUnsafeTestClass.Add(1, 2)
+                end
+            )");
+
+        // both classes are available on the main thread
+        EXPECT_TRUE(context.Execute("MainThreadResult = WorkerThreadUnsafeTestClass.Add(2, 3)"));
+        EXPECT_EQ(0, errorCount);
+
+        m_workers->Tick(0.016f, ScriptTimePoint());
+        EXPECT_EQ(1, errorCount);
+
+        lua_State* lua = context.NativeContext();
+        EXPECT_TRUE(context.Execute("WorkerSafeResult = WorkerEntity.safeResult WorkerUnsafeResult = WorkerEntity.unsafeResult"));
+        lua_getglobal(lua, "MainThreadResult");
+        EXPECT_EQ(5, lua_tointeger(lua, -1));
+        lua_getglobal(lua, "WorkerSafeResult");
+        EXPECT_EQ(3, lua_tointeger(lua, -1));
+        lua_getglobal(lua, "WorkerUnsafeResult");
+        EXPECT_TRUE(lua_isnil(lua, -1));
+        lua_pop(lua, 3);
+
+        RemoveWorkerEntity(entityId, tableReference);
+        context.SetErrorHook(nullptr);
+        context.BindTo(nullptr);
+    }
 }
 
 
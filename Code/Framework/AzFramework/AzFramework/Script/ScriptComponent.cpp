@@ -443,6 +443,7 @@ namespace AzFramework
     ScriptComponent::ScriptComponent()
         : m_context(nullptr)
         , m_contextId(AZ::ScriptContextIds::DefaultScriptContextId)
+        , m_runtimeContextId(AZ::ScriptContextIds::DefaultScriptContextId)
         , m_script(AZ::Data::AssetLoadBehavior::PreLoad)
         , m_table(LUA_NOREF)
     {
@@ -467,6 +468,7 @@ namespace AzFramework
         AZ_Assert(m_entity == nullptr || m_entity->GetState() != AZ::Entity::State::Active, "You can't change the context while the entity is active");
         m_context = context;
         m_contextId = context->GetId();
+        m_runtimeContextId = m_contextId;
     }
 
     //=========================================================================
@@ -488,8 +490,15 @@ namespace AzFramework
 
     void ScriptComponent::Init()
     {
+        // Scripts in the default context are sharded across the worker contexts when the script system has them
+        m_runtimeContextId = m_contextId;
+        if (m_contextId == AZ::ScriptContextIds::DefaultScriptContextId)
+        {
+            AZ::ScriptSystemRequestBus::BroadcastResult(m_runtimeContextId, &AZ::ScriptSystemRequests::GetWorkerContextIdForEntity, GetEntityId());
+        }
+
         // Grab the script context
-        EBUS_EVENT_RESULT(m_context, AZ::ScriptSystemRequestBus, GetContext, m_contextId);
+        EBUS_EVENT_RESULT(m_context, AZ::ScriptSystemRequestBus, GetContext, m_runtimeContextId);
         AZ_Assert(m_context, "We must have a valid script context!");
     }
 
@@ -508,6 +517,11 @@ namespace AzFramework
         {
             // ...create the entity table, find the Activate/Deactivate functions in the script and call them
             CreateEntityTable();
+
+            if (m_table != LUA_NOREF)
+            {
+                AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::AddWorkerEntity, m_runtimeContextId, GetEntityId(), m_table);
+            }
         }
     }
 
@@ -521,6 +535,8 @@ namespace AzFramework
 
         if (m_table != LUA_NOREF)
         {
+            AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::RemoveWorkerEntity, m_runtimeContextId, GetEntityId());
+
             lua_State* lua = m_context->NativeContext();
             LSV_BEGIN(lua, 0);
 
@@ -568,7 +584,7 @@ namespace AzFramework
 
         // Set the metamethods as we will use the script table as a metatable for entity tables
         bool success = false;
-        EBUS_EVENT_RESULT(success, AZ::ScriptSystemRequestBus, Load, m_script, AZ::k_scriptLoadBinary, m_contextId);
+        EBUS_EVENT_RESULT(success, AZ::ScriptSystemRequestBus, Load, m_script, AZ::k_scriptLoadBinary, m_runtimeContextId);
         if (!success)
         {
             return false;
@@ -622,70 +638,198 @@ namespace AzFramework
     }
 
     //=========================================================================
-    // CopyEntityTables
-    // Mirror source entity's subtables (excluding property table, which is handled \ref CreatePropertyGroup)
-    // The goal is to ensure that if we modify any table, modifications are isolated to the instance (not the global/shared entity table)
-    // In addition set to entity tables as a metatable so cloned tables for read-only operations.
+    // IsInstancedSubtable
+    // Whether the value at the top of the stack, with its key below it, is a subtable that every instance mirrors.
+    //=========================================================================
+    static bool IsInstancedSubtable(lua_State* lua, const char* propertyTableName)
+    {
+        if (!lua_istable(lua, -1))
+        {
+            return false;
+        }
+
+        switch (lua_type(lua, -2))
+        {
+            case LUA_TSTRING:
+            {
+                const char* tableName = lua_tolstring(lua, -2, nullptr);
+                return strncmp(tableName, "__", 2) != 0 && // skip metatables
+                    strcmp(tableName, propertyTableName) != 0; // Skip the Properties table
+            }
+
+            case LUA_TNUMBER:
+            {
+                return true;
+            }
+
+            default:
+            {
+                return false;
+            }
+        }
+    }
+
+    //=========================================================================
+    // BuildInstanceTablesLayout
+    // Collects the subtables of a script table (excluding property table, which is handled \ref CreatePropertyGroup) that
+    // every instance mirrors, so modifications of these tables are isolated to the instance (not the global/shared entity table).
+    // The layout is an array of { key, subtable layout } pairs.
+    // Pushes the layout table.
+    //=========================================================================
+    static void BuildInstanceTablesLayout(lua_State* lua, int sourceTable, const char* propertyTableName)
+    {
+        LSV_BEGIN(lua, 1);
+
+        lua_createtable(lua, 0, 0);
+        const int layoutTable = lua_gettop(lua);
+        lua_Integer layoutSize = 0;
+
+        lua_pushnil(lua); // first key
+        while (lua_next(lua, sourceTable))
+        {
+            if (IsInstancedSubtable(lua, propertyTableName))
+            {
+                // stack: source subtable key, source subtable
+                const int sourceSubtable = lua_gettop(lua);
+
+                lua_pushvalue(lua, sourceSubtable - 1);
+                lua_rawseti(lua, layoutTable, ++layoutSize); // layout[n] = subtableKey
+
+                BuildInstanceTablesLayout(lua, sourceSubtable, propertyTableName);
+                lua_rawseti(lua, layoutTable, ++layoutSize); // layout[n + 1] = subtableLayout
+            }
+            else if (lua_istable(lua, -1) && lua_type(lua, -2) != LUA_TSTRING && lua_type(lua, -2) != LUA_TNUMBER)
+            {
+                AZ_Warning("Script", false, "Tables associated with non string/number keys are not copied, thus will be lost in new instances.");
+            }
+
+            lua_pop(lua, 1); // pop the value
+            // leave the key for next iteration
+        }
+    }
+
+    //=========================================================================
+    // IsInstanceTablesLayoutCurrent
+    // Checks that a cached layout still matches the subtables of the source table. The script can add or replace
+    // subtables after the layout was built, for example in OnActivate, and they must not be shared by the instances.
+    // Walking the tables is cheaper than building the layout, which allocates a table for every subtable.
     //=========================================================================
-    void CopyAndHookEntityTables(lua_State* lua, int sourceTable, int targetTable, const char* propertyTableName)
+    static bool IsInstanceTablesLayoutCurrent(lua_State* lua, int sourceTable, int layoutTable, const char* propertyTableName)
     {
         LSV_BEGIN(lua, 0);
 
+        lua_Integer subtableCount = 0;
         lua_pushnil(lua); // first key
         while (lua_next(lua, sourceTable))
         {
-            if (lua_istable(lua, -1))
+            if (IsInstancedSubtable(lua, propertyTableName))
             {
-                int keyType = lua_type(lua, -2);
-                switch (keyType)
-                {
-                    case LUA_TSTRING:
-                    {
-                        const char* tableName = lua_tolstring(lua, -2, nullptr);
-                        if (strncmp(tableName, "__", 2) == 0 || // skip metatables
-                            strcmp(tableName, propertyTableName) == 0) // Skip the Properties table
-                        {
-                            break;
-                        }
-                        // else fall through
-                    }
+                ++subtableCount;
+            }
 
-                    case LUA_TNUMBER:
-                    {
-                        // stack: source subtable, source key
+            lua_pop(lua, 1); // pop the value
+            // leave the key for next iteration
+        }
 
-                        // Create the target subtable.
-                        lua_createtable(lua, 0, 0);
-                        lua_pushvalue(lua, -3);             // push source subtable key
-                        lua_pushvalue(lua, -2);             // push new subtable instance
-                        lua_rawset(lua, targetTable);       // targetTable.subtableKey = newSubTable
+        const lua_Integer layoutSize = aznumeric_cast<lua_Integer>(lua_rawlen(lua, layoutTable));
+        if (subtableCount * 2 != layoutSize)
+        {
+            return false;
+        }
 
-                        // The source subtable will be used as a metatable, so set its __index to itself.
-                        lua_pushliteral(lua, "__index");    // push __index key
-                        lua_pushvalue(lua, -3);             // push the source subtable
-                        lua_rawset(lua, -1);                // sourceSubtable.__index = sourceSubtable;
+        // same number of subtables, so every key of the layout must still hold a subtable with a current layout
+        for (lua_Integer index = 1; index < layoutSize; index += 2)
+        {
+            lua_rawgeti(lua, layoutTable, index); // push the subtable key
+            lua_rawget(lua, sourceTable); // push the source subtable
+            lua_rawgeti(lua, layoutTable, index + 1); // push the subtable layout
+            const int subtableLayout = lua_gettop(lua);
+            const bool isCurrent = lua_istable(lua, subtableLayout - 1) &&
+                IsInstanceTablesLayoutCurrent(lua, subtableLayout - 1, subtableLayout, propertyTableName);
+            lua_pop(lua, 2); // pop the source subtable and its layout
+            if (!isCurrent)
+            {
+                return false;
+            }
+        }
 
-                        // Set the target subtable's metatable to the source subtable.
-                        lua_pushvalue(lua, -2);             // push the source subtable
-                        lua_setmetatable(lua, -2);          // setmetatable(targetSubtable, sourceSubtable)
+        return true;
+    }
 
-                        int newTarget = lua_gettop(lua);
-                        int newSource = newTarget - 1;
-                        CopyAndHookEntityTables(lua, newSource, newTarget, propertyTableName);
+    //=========================================================================
+    // CreateInstanceTables
+    // Mirrors the source subtables listed in the layout into the target table, with the source subtables as metatables.
+    //=========================================================================
+    static void CreateInstanceTables(lua_State* lua, int sourceTable, int targetTable, int layoutTable)
+    {
+        LSV_BEGIN(lua, 0);
 
-                        lua_pop(lua, 1); // pop the new table
-                    } break;
+        const lua_Integer layoutSize = aznumeric_cast<lua_Integer>(lua_rawlen(lua, layoutTable));
+        for (lua_Integer index = 1; index < layoutSize; index += 2)
+        {
+            lua_rawgeti(lua, layoutTable, index); // push the subtable key
+            lua_pushvalue(lua, -1);
+            lua_rawget(lua, sourceTable); // push the source subtable
+            AZ_Assert(lua_istable(lua, -1), "Instance tables layout is out of date");
 
-                    default:
-                    {
-                        AZ_Warning("Script", false, "Tables associated with non string/number keys are not copied, thus will be lost in new instances.");
-                    } break;
-                }
+            // The source subtable is used as a metatable, so its __index is itself. This is set here rather than when the
+            // layout is built, so a subtable that replaced the one of the layout is hooked as well.
+            const int sourceSubtable = lua_gettop(lua);
+            lua_pushliteral(lua, "__index");
+            lua_rawget(lua, sourceSubtable);
+            const bool isIndexSet = lua_rawequal(lua, -1, sourceSubtable);
+            lua_pop(lua, 1);
+            if (!isIndexSet)
+            {
+                lua_pushliteral(lua, "__index");
+                lua_pushvalue(lua, sourceSubtable);
+                lua_rawset(lua, sourceSubtable);
             }
 
-            lua_pop(lua, 1); // pop the value
-            // leave the key for next iteration
+            // Create the target subtable.
+            lua_createtable(lua, 0, 0);
+            lua_pushvalue(lua, -3);             // push source subtable key
+            lua_pushvalue(lua, -2);             // push new subtable instance
+            lua_rawset(lua, targetTable);       // targetTable.subtableKey = newSubTable
+
+            // Set the target subtable's metatable to the source subtable.
+            lua_pushvalue(lua, -2);             // push the source subtable
+            lua_setmetatable(lua, -2);          // setmetatable(targetSubtable, sourceSubtable)
+
+            lua_rawgeti(lua, layoutTable, index + 1); // push the subtable layout
+            const int newLayout = lua_gettop(lua);
+            CreateInstanceTables(lua, newLayout - 2, newLayout - 1, newLayout);
+
+            lua_pop(lua, 4); // pop the key, the source subtable, the new table and its layout
+        }
+    }
+
+    //=========================================================================
+    // CreateScriptInstanceTables
+    //=========================================================================
+    void CreateScriptInstanceTables(lua_State* lua, int scriptTable, int instanceTable, const char* propertyTableName)
+    {
+        LSV_BEGIN(lua, 0);
+
+        scriptTable = lua_absindex(lua, scriptTable);
+        instanceTable = lua_absindex(lua, instanceTable);
+
+        // The layout is cached in the script table, which is shared by the instances in the context until the script is reloaded.
+        // It is rebuilt when the script added, removed or replaced subtables since it was built, so they are mirrored as well.
+        lua_pushliteral(lua, "__instanceTables");
+        lua_rawget(lua, scriptTable);
+        if (!lua_istable(lua, -1) || !IsInstanceTablesLayoutCurrent(lua, scriptTable, lua_gettop(lua), propertyTableName))
+        {
+            lua_pop(lua, 1);
+            BuildInstanceTablesLayout(lua, scriptTable, propertyTableName);
+
+            lua_pushliteral(lua, "__instanceTables");
+            lua_pushvalue(lua, -2);
+            lua_rawset(lua, scriptTable);
         }
+
+        CreateInstanceTables(lua, scriptTable, instanceTable, lua_gettop(lua));
+        lua_pop(lua, 1); // pop the layout
     }
 
     //=========================================================================
@@ -722,7 +866,7 @@ namespace AzFramework
         }
 
         // replicate other tables to make sure we have table per instance.
-        CopyAndHookEntityTables(lua, baseStackIndex, lua_gettop(lua), m_properties.m_name.c_str());
+        CreateScriptInstanceTables(lua, baseStackIndex, lua_gettop(lua), m_properties.m_name.c_str());
 
         // set my entity id
         lua_pushliteral(lua, "entityId"); // Stack: ScriptRootTable PropertiesTable EntityTable{ PropertiesTable{__index __newIndex Meta{CopyOfPropertiesTable}} } "entityId"
@@ -52,6 +52,11 @@ namespace AzFramework
     AZ::Outcome<AZStd::string, AZStd::string> CompileScriptAndSaveAsset(ScriptCompileRequest& request);
     bool SaveLuaAssetData(const AZ::LuaScriptData& data, AZ::IO::GenericStream& stream);
 
+    //! Creates the instance copies of the subtables of a script table in an instance table, each using the script's
+    //! subtable as its metatable. The layout of the subtables is cached in the loaded script table and rebuilt when the script
+    //! changes its subtables, so creating an instance only creates the tables that the instance needs.
+    void CreateScriptInstanceTables(lua_State* lua, int scriptTable, int instanceTable, const char* propertyTableName);
+
     struct ScriptPropertyGroup
     {
         AZ_TYPE_INFO(ScriptPropertyGroup, "{79682522-2f81-4b36-9fc2-a091c7504f7f}");
@@ -120,6 +125,7 @@ namespace AzFramework
 
         AZ::ScriptContext*                  m_context;              ///< Context in which the script will be running
         AZ::ScriptContextId                 m_contextId;            ///< Id of the script context.
+        AZ::ScriptContextId                 m_runtimeContextId;     ///< Id of the context the script runs in, a worker context when the default context is sharded.
         AZ::Data::Asset<AZ::ScriptAsset>    m_script;               ///< Reference to the script asset used for this component.
         int                                 m_table;                ///< Cached table index
         ScriptPropertyGroup                 m_properties;           ///< List with all properties that were tweaked in the editor and should override values in the m_sourceScriptName class inside m_script.
@@ -313,6 +313,19 @@ namespace AzFramework
             //! Given a ray, return the closest intersection with terrain.
             virtual RenderGeometry::RayResult GetClosestIntersection(const RenderGeometry::RayRequest& ray) const = 0;
 
+            //! Given a list of rays, return the closest intersection with terrain for each ray.
+            //! Handlers can override this to process the rays in parallel or share work between them.
+            //! @param rays - The rays to intersect with the terrain.
+            //! @param outResults - The closest intersection for each ray. This needs to be the same size as the list of rays.
+            virtual void GetClosestIntersections(
+                AZStd::span<const RenderGeometry::RayRequest> rays, AZStd::span<RenderGeometry::RayResult> outResults) const
+            {
+                for (size_t rayIndex = 0; rayIndex < rays.size() && rayIndex < outResults.size(); rayIndex++)
+                {
+                    outResults[rayIndex] = GetClosestIntersection(rays[rayIndex]);
+                }
+            }
+
             //! Asynchronous versions of the various 'Query*' API functions declared above.
             //! It's the responsibility of the caller to ensure all callbacks are thread-safe.
             virtual AZStd::shared_ptr<TerrainJobContext> QueryListAsync(
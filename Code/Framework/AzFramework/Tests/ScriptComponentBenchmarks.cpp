@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/lua/lua.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Script/ScriptComponent.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    namespace ScriptComponentBenchmarkInternal
+    {
+        // A script with the layout of a typical component script: functions, state subtables and properties.
+        constexpr const char* k_script = R"(
+            local BenchmarkScript = {
+                Properties = { Speed = 1.0, Target = { Distance = 10.0 } },
+                State = { Current = 0, History = { Count = 0 } },
+                Handlers = {},
+            }
+            function BenchmarkScript:OnActivate() self.State.Current = 1 end
+            function BenchmarkScript:OnDeactivate() self.State.Current = 0 end
+            function BenchmarkScript:OnTick(deltaTime, timePoint) self.State.History.Count = self.State.History.Count + 1 end
+            return BenchmarkScript
+        )";
+
+        int ChunkWriter(lua_State*, const void* data, size_t size, void* userData)
+        {
+            AZStd::vector<char>* chunk = static_cast<AZStd::vector<char>*>(userData);
+            chunk->insert(chunk->end(), static_cast<const char*>(data), static_cast<const char*>(data) + size);
+            return 0;
+        }
+    }
+
+    //! Measures the parts of activating script components that scale with the number of components: loading the compiled
+    //! chunk of a script asset in a context and creating the instance tables of the components.
+    class BM_ScriptComponent
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp()
+        {
+            m_scriptContext = aznew AZ::ScriptContext();
+            lua_State* lua = m_scriptContext->NativeContext();
+
+            // compile the script the way the asset builder does, with stripped debug information
+            luaL_loadbuffer(lua, ScriptComponentBenchmarkInternal::k_script, strlen(ScriptComponentBenchmarkInternal::k_script), "@benchmarkscript.lua");
+            lua_dump(lua, &ScriptComponentBenchmarkInternal::ChunkWriter, &m_compiledScript, 1);
+            lua_pop(lua, 1);
+        }
+
+        void internalTearDown()
+        {
+            delete m_scriptContext;
+            m_compiledScript = {};
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZ::ScriptContext* m_scriptContext = nullptr;
+        AZStd::vector<char> m_compiledScript;
+    };
+
+    BENCHMARK_F(BM_ScriptComponent, LoadCompiledScript_FromStream)(benchmark::State& state)
+    {
+        lua_State* lua = m_scriptContext->NativeContext();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::MemoryStream stream(m_compiledScript.data(), m_compiledScript.size());
+            m_scriptContext->LoadFromStream(&stream, "@benchmarkscript.lua", "b");
+            lua_pop(lua, 1);
+        }
+    }
+
+    BENCHMARK_F(BM_ScriptComponent, LoadCompiledScript_FromBuffer)(benchmark::State& state)
+    {
+        lua_State* lua = m_scriptContext->NativeContext();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_scriptContext->LoadFromBuffer(m_compiledScript.data(), m_compiledScript.size(), "@benchmarkscript.lua", "b");
+            lua_pop(lua, 1);
+        }
+    }
+
+    BENCHMARK_DEFINE_F(BM_ScriptComponent, CreateScriptInstances)(benchmark::State& state)
+    {
+        const int64_t instanceCount = state.range(0);
+        lua_State* lua = m_scriptContext->NativeContext();
+
+        // the script table is loaded once per context, like ScriptSystemComponent does for script assets
+        m_scriptContext->LoadFromBuffer(m_compiledScript.data(), m_compiledScript.size(), "@benchmarkscript.lua", "b");
+        AZ::Internal::LuaSafeCall(lua, 0, 1);
+        const int scriptTable = lua_gettop(lua);
+        lua_pushliteral(lua, "__index");
+        lua_pushvalue(lua, scriptTable);
+        lua_rawset(lua, scriptTable);
+
+        AZStd::vector<int> instances;
+        instances.reserve(instanceCount);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int64_t instance = 0; instance < instanceCount; ++instance)
+            {
+                lua_createtable(lua, 0, 1);
+                AzFramework::CreateScriptInstanceTables(lua, scriptTable, -1, "Properties");
+                lua_pushvalue(lua, scriptTable);
+                lua_setmetatable(lua, -2);
+                instances.push_back(luaL_ref(lua, LUA_REGISTRYINDEX));
+            }
+
+            state.PauseTiming();
+            for (int reference : instances)
+            {
+                luaL_unref(lua, LUA_REGISTRYINDEX, reference);
+            }
+            instances.clear();
+            m_scriptContext->GarbageCollect();
+            state.ResumeTiming();
+        }
+
+        lua_pop(lua, 1);
+        state.SetItemsProcessed(state.iterations() * instanceCount);
+    }
+    BENCHMARK_REGISTER_F(BM_ScriptComponent, CreateScriptInstances)
+        ->Arg(1000)->Arg(10000)->Unit(::benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
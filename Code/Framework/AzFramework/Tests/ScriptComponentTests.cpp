@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/lua/lua.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Script/ScriptComponent.h>
+
+namespace UnitTest
+{
+    class ScriptInstanceTablesTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            m_scriptContext = aznew AZ::ScriptContext();
+            lua_State* lua = m_scriptContext->NativeContext();
+
+            EXPECT_TRUE(m_scriptContext->Execute(R"(
+                InstanceScript = {
+                    Properties = { Speed = 1.0 },
+                    State = { Current = 0 },
+                }
+            )"));
+            lua_getglobal(lua, "InstanceScript");
+            m_scriptTable = lua_gettop(lua);
+        }
+
+        void TearDown() override
+        {
+            delete m_scriptContext;
+            m_scriptContext = nullptr;
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+        // Creates an instance table of the script and stores it in the global with the name.
+        void CreateInstance(const char* name)
+        {
+            lua_State* lua = m_scriptContext->NativeContext();
+            lua_createtable(lua, 0, 1);
+            AzFramework::CreateScriptInstanceTables(lua, m_scriptTable, -1, "Properties");
+            lua_setglobal(lua, name);
+        }
+
+        AZ::ScriptContext* m_scriptContext = nullptr;
+        int m_scriptTable = 0;
+    };
+
+    TEST_F(ScriptInstanceTablesTest, CreateScriptInstanceTables_SubtableModified_IsolatedToInstance)
+    {
+        CreateInstance("First");
+        CreateInstance("Second");
+
+        EXPECT_TRUE(m_scriptContext->Execute("First.State.Current = 1"));
+        EXPECT_TRUE(m_scriptContext->Execute("assert(Second.State.Current == 0 and InstanceScript.State.Current == 0)"));
+        EXPECT_TRUE(m_scriptContext->Execute("assert(First.Properties == nil)"));
+    }
+
+    TEST_F(ScriptInstanceTablesTest, CreateScriptInstanceTables_SubtableAddedAfterFirstInstance_IsolatedToInstance)
+    {
+        CreateInstance("First");
+
+        // scripts can add subtables to their table after the first instance, for example in OnActivate
+        EXPECT_TRUE(m_scriptContext->Execute("InstanceScript.Added = { Count = 0, Nested = { Value = 0 } }"));
+        CreateInstance("Second");
+        CreateInstance("Third");
+
+        EXPECT_TRUE(m_scriptContext->Execute("Second.Added.Count = 1 Second.Added.Nested.Value = 2"));
+        EXPECT_TRUE(m_scriptContext->Execute("assert(Third.Added.Count == 0 and Third.Added.Nested.Value == 0)"));
+        EXPECT_TRUE(m_scriptContext->Execute("assert(rawget(First, 'Added') == nil)"));
+    }
+
+    TEST_F(ScriptInstanceTablesTest, CreateScriptInstanceTables_NestedSubtableAddedAfterFirstInstance_IsolatedToInstance)
+    {
+        CreateInstance("First");
+
+        EXPECT_TRUE(m_scriptContext->Execute("InstanceScript.State.History = { Count = 0 }"));
+        CreateInstance("Second");
+        CreateInstance("Third");
+
+        EXPECT_TRUE(m_scriptContext->Execute("Second.State.History.Count = 1"));
+        EXPECT_TRUE(m_scriptContext->Execute("assert(Third.State.History.Count == 0)"));
+    }
+}
@@ -24,6 +24,8 @@ set(FILES
     FileTagTests.cpp
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
+    ScriptComponentBenchmarks.cpp
+    ScriptComponentTests.cpp
     OctreeTests.cpp
     AssetCatalog.cpp
     AssetRegistry.cpp
@@ -160,6 +160,16 @@ namespace Audio
             TAudioPreloadRequestID m_preloadRequestId{ INVALID_AUDIO_PRELOAD_REQUEST_ID };
         };
 
+        struct PrefetchBank
+            : public AudioRequestBase
+        {
+            AUDIO_REQUEST_TYPE(SystemRequest, PrefetchBank, "{6E0C4B8A-2F3D-4C71-9A5E-8B1D7F2C3A64}");
+
+            TAudioPreloadRequestID m_preloadRequestId{ INVALID_AUDIO_PRELOAD_REQUEST_ID };
+            // Estimate of how soon the preload will be needed, e.g. from the distance to a trigger source.
+            AZ::u32 m_deadlineMs{ 1000 };
+        };
+
         struct UnloadBanksByScope
             : public AudioRequestBase
         {
@@ -385,6 +395,7 @@ namespace Audio
         Audio::SystemRequest::UnloadControls,
         Audio::SystemRequest::LoadBank,
         Audio::SystemRequest::UnloadBank,
+        Audio::SystemRequest::PrefetchBank,
         Audio::SystemRequest::UnloadBanksByScope,
         Audio::SystemRequest::ReloadAll,
         Audio::SystemRequest::LoseFocus,
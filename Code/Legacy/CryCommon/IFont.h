@@ -109,6 +109,15 @@ struct ICryFont
     //! \brief Reload all fonts
     virtual void ReloadAllFonts() = 0;
 
+    //! \brief Starts deferring the upload of font textures that get new glyphs.
+    //!
+    //! The font texture versions still change as glyphs are added, but each font texture is
+    //! uploaded at most once, by the matching EndFontTextureUpdateBatch. Batches can be nested.
+    virtual void BeginFontTextureUpdateBatch() = 0;
+
+    //! \brief Uploads the font textures that changed since the outermost BeginFontTextureUpdateBatch.
+    virtual void EndFontTextureUpdateBatch() = 0;
+
     // </interfuscator:shuffle>
 };
 
@@ -362,6 +371,9 @@ public:
     virtual void OnFontsReloaded() = 0;
 
     virtual void OnFontTextureUpdated(IFFont* /*font*/) {}
+
+    //! Sent before a font is deleted, so that listeners can drop any data keyed by the font
+    virtual void OnFontDestroyed(IFFont* /*font*/) {}
 };
 
 using FontNotificationBus = AZ::EBus<FontNotifications>;
@@ -96,6 +96,7 @@ namespace AZ
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
+            void BuildOccluderMeshes(const TransformServiceFeatureProcessor* transformService);
 
             // MaterialAssignmentNotificationBus overrides
             void OnRebuildMaterialInstance() override;
@@ -122,12 +123,17 @@ namespace AZ
 
             Aabb m_aabb = Aabb::CreateNull();
 
+            //! World space triangles of the lowest detail LOD, rendered into the occlusion buffer when the mesh is an occluder
+            RPI::CullingScene::OccluderMeshVector m_occluderMeshes;
+
             bool m_cullBoundsNeedsUpdate = false;
             bool m_cullableNeedsRebuild = false;
             bool m_objectSrgNeedsUpdate = true;
             bool m_excludeFromReflectionCubeMaps = false;
             bool m_visible = true;
             bool m_hasForwardPassIblSpecularMaterial = false;
+            bool m_isOccluder = false;
+            bool m_occluderMeshesNeedUpdate = false;
         };
 
         //! This feature processor handles static and dynamic non-skinned meshes.
@@ -199,6 +205,8 @@ namespace AZ
             void SetVisible(const MeshHandle& meshHandle, bool visible) override;
             bool GetVisible(const MeshHandle& meshHandle) const override;
             void SetUseForwardPassIblSpecular(const MeshHandle& meshHandle, bool useForwardPassIblSpecular) override;
+            void SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder) override;
+            bool GetIsOccluder(const MeshHandle& meshHandle) const override;
 
             RHI::Ptr <FlagRegistry> GetFlagRegistry();
 
@@ -219,6 +227,9 @@ namespace AZ
 
             void PrintShaderOptionFlags();
 
+            //! Rebuilds the world space triangles of the occluders that changed and hands them to the CullingScene
+            void UpdateOccluderMeshes();
+
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineChanged(AZ::RPI::RenderPipeline* pipeline, RPI::SceneNotification::RenderPipelineChangeType changeType) override;
                         
@@ -229,6 +240,9 @@ namespace AZ
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
             RPI::MeshDrawPacketLods m_emptyDrawPacketLods;
             RHI::Ptr<FlagRegistry> m_flagRegistry = nullptr;
+            RPI::CullingScene::OccluderMeshVector m_rpiOccluderMeshes;
+            size_t m_occluderCount = 0;
+            bool m_occluderListNeedsUpdate = false;
             bool m_forceRebuildDrawPackets = false;
             bool m_reportShaderOptionFlags = false;
             bool m_enablePerMeshShaderOptionFlags = false;
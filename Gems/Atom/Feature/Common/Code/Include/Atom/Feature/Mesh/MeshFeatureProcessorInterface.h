@@ -130,6 +130,12 @@ namespace AZ
             virtual bool GetVisible(const MeshHandle& meshHandle) const = 0;
             //! Sets the mesh to render IBL specular in the forward pass.
             virtual void SetUseForwardPassIblSpecular(const MeshHandle& meshHandle, bool useForwardPassIblSpecular) = 0;
+            //! Sets the mesh as an occluder. Occluders are rendered into the occlusion buffer of the CullingScene, using the
+            //! lowest detail LOD of the model, so that they hide the meshes behind them. That LOD should never be larger than the
+            //! visible geometry.
+            virtual void SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder) = 0;
+            //! Returns whether the mesh is an occluder.
+            virtual bool GetIsOccluder(const MeshHandle& meshHandle) const = 0;
         };
     } // namespace Render
 } // namespace AZ
@@ -44,5 +44,7 @@ namespace UnitTest
         MOCK_METHOD2(SetVisible, void (const MeshHandle&, bool));
         MOCK_CONST_METHOD1(GetVisible, bool(const MeshHandle&));
         MOCK_METHOD2(SetUseForwardPassIblSpecular, void (const MeshHandle&, bool));
+        MOCK_METHOD2(SetIsOccluder, void (const MeshHandle&, bool));
+        MOCK_CONST_METHOD1(GetIsOccluder, bool(const MeshHandle&));
     };
 } // namespace UnitTest
@@ -200,8 +200,9 @@ namespace AZ
                 }
             }
 
-            // Return true if there is nothing to compile, meaning no properties changed, or the compile succeeded
-            return !m_materialInstance->NeedsCompile() || m_materialInstance->Compile();
+            // Return true if there is nothing to compile, meaning no properties changed, or the compile was queued or succeeded.
+            // Queued materials are compiled in batches per material type by the material system.
+            return !m_materialInstance->NeedsCompile() || m_materialInstance->QueueCompile();
         }
 
         AZStd::string MaterialAssignment::ToString() const
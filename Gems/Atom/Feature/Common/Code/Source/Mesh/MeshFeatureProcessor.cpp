@@ -14,6 +14,8 @@
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Material/Material.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/Utils/StableDynamicArray.h>
 #include <ReflectionProbe/ReflectionProbeFeatureProcessor.h>
@@ -33,11 +35,35 @@
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
     namespace Render
     {
+        namespace
+        {
+            // Adds the streaming images of the material's properties, culling reports how large they appear on screen to them
+            void AddStreamingImages(const RPI::Material& material, AZStd::vector<Data::Instance<RPI::StreamingImage>>& streamingImages)
+            {
+                for (const RPI::MaterialPropertyValue& propertyValue : material.GetPropertyValues())
+                {
+                    if (!propertyValue.Is<Data::Instance<RPI::Image>>())
+                    {
+                        continue;
+                    }
+
+                    RPI::StreamingImage* streamingImage = azrtti_cast<RPI::StreamingImage*>(propertyValue.GetValue<Data::Instance<RPI::Image>>().get());
+                    if (streamingImage &&
+                        AZStd::find_if(streamingImages.begin(), streamingImages.end(),
+                            [streamingImage](const Data::Instance<RPI::StreamingImage>& image) { return image.get() == streamingImage; }) == streamingImages.end())
+                    {
+                        streamingImages.emplace_back(streamingImage);
+                    }
+                }
+            }
+        } // namespace
+
         void MeshFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -79,6 +105,14 @@ namespace AZ
 
             m_handleGlobalShaderOptionUpdate.Disconnect();
 
+            if (!m_rpiOccluderMeshes.empty())
+            {
+                m_rpiOccluderMeshes.clear();
+                GetParentScene()->GetCullingScene()->SetOccluderMeshes(m_rpiOccluderMeshes);
+            }
+            m_occluderCount = 0;
+            m_occluderListNeedsUpdate = false;
+
             DisableSceneNotification();
             AZ_Warning("MeshFeatureProcessor", m_modelData.size() == 0,
                 "Deactivating the MeshFeatureProcessor, but there are still outstanding mesh handles.\n"
@@ -176,6 +210,8 @@ namespace AZ
         {
             m_meshDataChecker.soft_lock();
 
+            UpdateOccluderMeshes();
+
             if (!r_enablePerMeshShaderOptionFlags && m_enablePerMeshShaderOptionFlags)
             {
                 // Per mesh shader option flags was on, but now turned off, so reset all the shader options.
@@ -286,6 +322,12 @@ namespace AZ
                 meshHandle->DeInit();
                 m_transformService->ReleaseObjectId(meshHandle->m_objectId);
 
+                if (meshHandle->m_isOccluder)
+                {
+                    --m_occluderCount;
+                    m_occluderListNeedsUpdate = true;
+                }
+
                 AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
                 m_modelData.erase(meshHandle);
 
@@ -387,6 +429,7 @@ namespace AZ
                 ModelDataInstance& modelData = *meshHandle;
                 modelData.m_cullBoundsNeedsUpdate = true;
                 modelData.m_objectSrgNeedsUpdate = true;
+                modelData.m_occluderMeshesNeedUpdate = true;
 
                 m_transformService->SetTransformForId(meshHandle->m_objectId, transform, nonUniformScale);
 
@@ -589,7 +632,69 @@ namespace AZ
                 }
             }
         }
+        void MeshFeatureProcessor::SetIsOccluder(const MeshHandle& meshHandle, bool isOccluder)
+        {
+            if (meshHandle.IsValid() && meshHandle->m_isOccluder != isOccluder)
+            {
+                meshHandle->m_isOccluder = isOccluder;
+                meshHandle->m_occluderMeshesNeedUpdate = true;
+                if (!isOccluder)
+                {
+                    meshHandle->m_occluderMeshes.clear();
+                }
+
+                m_occluderCount = isOccluder ? m_occluderCount + 1 : m_occluderCount - 1;
+                m_occluderListNeedsUpdate = true;
+            }
+        }
+
+        bool MeshFeatureProcessor::GetIsOccluder(const MeshHandle& meshHandle) const
+        {
+            if (meshHandle.IsValid())
+            {
+                return meshHandle->m_isOccluder;
+            }
+            else
+            {
+                AZ_Assert(false, "Invalid mesh handle");
+                return false;
+            }
+        }
+
+        void MeshFeatureProcessor::UpdateOccluderMeshes()
+        {
+            if (m_occluderCount == 0 && !m_occluderListNeedsUpdate)
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: UpdateOccluderMeshes");
 
+            // occluders are only rebuilt when they load, move or are hidden, so static occluders cost nothing per frame
+            for (auto& model : m_modelData)
+            {
+                if (model.m_isOccluder && model.m_occluderMeshesNeedUpdate)
+                {
+                    model.BuildOccluderMeshes(m_transformService);
+                    m_occluderListNeedsUpdate = true;
+                }
+            }
+
+            if (m_occluderListNeedsUpdate)
+            {
+                m_rpiOccluderMeshes.clear();
+                for (const auto& model : m_modelData)
+                {
+                    if (model.m_isOccluder)
+                    {
+                        m_rpiOccluderMeshes.insert(m_rpiOccluderMeshes.end(), model.m_occluderMeshes.begin(), model.m_occluderMeshes.end());
+                    }
+                }
+
+                GetParentScene()->GetCullingScene()->SetOccluderMeshes(m_rpiOccluderMeshes);
+                m_occluderListNeedsUpdate = false;
+            }
+        }
 
         RHI::Ptr<MeshFeatureProcessor::FlagRegistry> MeshFeatureProcessor::GetFlagRegistry()
         {
@@ -820,6 +925,9 @@ namespace AZ
 
             RemoveRayTracingData();
 
+            m_occluderMeshes.clear();
+            m_occluderMeshesNeedUpdate = true;
+
             m_drawPacketListsByLod.clear();
             m_materialAssignments.clear();
             m_objectSrgList = {};
@@ -829,6 +937,7 @@ namespace AZ
         void ModelDataInstance::Init(Data::Instance<RPI::Model> model)
         {
             m_model = model;
+            m_occluderMeshesNeedUpdate = true;
             const size_t modelLodCount = m_model->GetLodCount();
             m_drawPacketListsByLod.resize(modelLodCount);
             for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
@@ -1493,6 +1602,7 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
+                lod.m_streamingImages.clear();
                 for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
                 {
                     const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
@@ -1503,6 +1613,11 @@ namespace AZ
                         cullData.m_drawListMask |= rhiDrawPacket->GetDrawListMask();
 
                         lod.m_drawPackets.push_back(rhiDrawPacket);
+
+                        if (Data::Instance<RPI::Material> material = meshDrawPacket.GetMaterial())
+                        {
+                            AddStreamingImages(*material, lod.m_streamingImages);
+                        }
                     }
                 }
             }
@@ -1651,6 +1766,57 @@ namespace AZ
         {
             m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+            m_occluderMeshesNeedUpdate = true;
+        }
+
+        void ModelDataInstance::BuildOccluderMeshes(const TransformServiceFeatureProcessor* transformService)
+        {
+            m_occluderMeshes.clear();
+            m_occluderMeshesNeedUpdate = false;
+
+            if (!m_model || !m_visible || m_model->GetModelAsset()->GetLodAssets().empty())
+            {
+                return;
+            }
+
+            const Transform localToWorld = transformService->GetTransformForId(m_objectId);
+            const Vector3 nonUniformScale = transformService->GetNonUniformScaleForId(m_objectId);
+
+            // the lowest detail LOD keeps the occlusion buffer cheap to render
+            const RPI::ModelLodAsset* modelLodAsset = m_model->GetModelAsset()->GetLodAssets().back().Get();
+            if (!modelLodAsset)
+            {
+                return;
+            }
+
+            const AZ::Name positionName{ "POSITION" };
+            for (const RPI::ModelLodAsset::Mesh& mesh : modelLodAsset->GetMeshes())
+            {
+                const RPI::BufferAssetView* positionBufferView = mesh.GetSemanticBufferAssetView(positionName);
+                if (!positionBufferView || positionBufferView->GetBufferViewDescriptor().m_elementSize != sizeof(float) * 3 ||
+                    mesh.GetIndexBufferAssetView().GetBufferViewDescriptor().m_elementSize != sizeof(uint32_t))
+                {
+                    continue;
+                }
+
+                const AZStd::span<const float> positions = mesh.GetSemanticBufferTyped<float>(positionName);
+                const AZStd::span<const uint32_t> indices = mesh.GetIndexBufferTyped<uint32_t>();
+                if (positions.size() < 9 || indices.size() < 3)
+                {
+                    continue;
+                }
+
+                RPI::CullingScene::OccluderMesh& occluderMesh = m_occluderMeshes.emplace_back();
+                occluderMesh.m_aabb = Aabb::CreateNull();
+                occluderMesh.m_positions.reserve(positions.size() / 3);
+                for (size_t positionIndex = 0; positionIndex + 2 < positions.size(); positionIndex += 3)
+                {
+                    const Vector3 worldPosition = localToWorld.TransformPoint(Vector3::CreateFromFloat3(&positions[positionIndex]) * nonUniformScale);
+                    occluderMesh.m_positions.push_back(worldPosition);
+                    occluderMesh.m_aabb.AddPoint(worldPosition);
+                }
+                occluderMesh.m_indices.assign(indices.begin(), indices.end());
+            }
         }
 
         void ModelDataInstance::OnRebuildMaterialInstance()
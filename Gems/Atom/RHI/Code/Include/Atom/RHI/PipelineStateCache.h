@@ -11,6 +11,7 @@
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -35,6 +36,7 @@ namespace AZ
         //! Therefore, PipelineStateCache adheres to the following requirements:
         //!      1. A cache miss does not serialize all threads on a pipeline state compilation event.
         //!      2. A cache hit results in zero contention.
+        //!      3. Callers that cannot afford a compilation stall may defer it to a background job (see AcquirePipelineStateAsync).
         //!
         //! Justification: Most pipeline state compilation will occur in the first few frames, but can also occur when new
         //! 'permutations' are hit while exploring. In the 90% case, the cache is warm and each frame results in a 100%
@@ -58,6 +60,14 @@ namespace AZ
         //! thread may return a pipeline state that is still compiling. It is required that all pending AcquirePipelineState
         //! calls complete prior to using the returned pipeline state pointers during command list recording.
         //!
+        //! Asynchronous compilation:
+        //!
+        //!      AcquirePipelineStateAsync never compiles on the calling thread. On a miss the pipeline state is allocated into a
+        //!      separate, locked async cache and compiled by a job on a worker thread (or inline if no job context exists). Until the
+        //!      compiled pipeline state reaches the pending cache, the caller-supplied fallback pipeline state is returned instead.
+        //!      Pending cache entries are returned as soon as they are compiled; entries that a synchronous acquire is still
+        //!      compiling are tracked separately and get the fallback.
+        //!
         //! Example Scenarios:
         //!
         //!  1. Threads request the same un-cached pipeline state:
@@ -92,6 +102,9 @@ namespace AZ
         //!      // In jobs. Lots and lots of requests.
         //!      const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
         //!
+        //!      // In jobs that must not stall. Returns the fallback until the compiled pipeline state is available.
+        //!      const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, fallback);
+        //!
         //!      // Reset contents of library. Releases all pipeline state references. Library remains valid.
         //!      pipelineStateCache->ResetLibrary(libraryHandle);
         //!
@@ -110,8 +123,29 @@ namespace AZ
             //! avoid a pointer indirection on access.
             static const size_t LibraryCountMax = 256;
 
+            //! Cache hit / miss counters, accumulated per thread and summed on request.
+            struct Statistics
+            {
+                //! Acquires served from the global read-only cache.
+                uint64_t m_readOnlyCacheHits = 0;
+                //! Acquires served from the thread-local cache.
+                uint64_t m_threadLocalCacheHits = 0;
+                //! Acquires served from the global pending cache (compiled or compiling on another thread).
+                uint64_t m_pendingCacheHits = 0;
+                //! Acquires that had to compile the pipeline state on the calling thread.
+                uint64_t m_synchronousCompiles = 0;
+                //! Pipeline states queued for background compilation.
+                uint64_t m_asyncCompilesQueued = 0;
+                //! Background compilations that finished and were published to the pending cache.
+                uint64_t m_asyncCompilesCompleted = 0;
+                //! Async acquires that returned the fallback pipeline state.
+                uint64_t m_fallbacksReturned = 0;
+            };
+
             static Ptr<PipelineStateCache> Create(Device& device);
 
+            ~PipelineStateCache();
+
             //! Resets the caches of all pipeline libraries back to empty. All internal references to pipeline states are released.
             void Reset();
 
@@ -138,6 +172,25 @@ namespace AZ
             //! is held externally, the instance will remain valid even after the cache is reset / destroyed.
             const PipelineState* AcquirePipelineState(PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor);
 
+            //! Acquires a pipeline state without compiling it on the calling thread. If the pipeline state has been compiled,
+            //! it is returned. Otherwise a background compilation is queued (if one isn't already pending) and the fallback
+            //! pipeline state is returned. The compiled pipeline state becomes available as soon as its compilation completes.
+            //! Returns null if the library handle is invalid.
+            const PipelineState* AcquirePipelineStateAsync(
+                PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor, const PipelineState* fallbackPipelineState);
+
+            //! Blocks until all queued background compilations have been published.
+            void WaitForAsyncCompiles() const;
+
+            //! Returns the number of background compilations that have been queued but not yet published.
+            uint32_t GetAsyncCompileCount() const;
+
+            //! Returns the statistics summed across all threads and libraries.
+            Statistics GetStatistics() const;
+
+            //! Resets all statistics counters back to zero.
+            void ResetStatistics();
+
             //! This method merges the global pending cache into the global read-only cache and clears all thread-local caches.
             //! This reduces the total memory footprint of the caches and optimizes subsequent fetches. This method should be called
             //! once per frame.
@@ -161,6 +214,9 @@ namespace AZ
 
                 bool operator == (const PipelineStateEntry& rhs) const;
 
+                //! Returns the stored descriptor as its base type.
+                const PipelineStateDescriptor& GetDescriptor() const;
+
                 PipelineStateHash m_hash;
                 ConstPtr<PipelineState> m_pipelineState;
 
@@ -192,6 +248,18 @@ namespace AZ
                 // Tracks the number of pipeline states actively being compiled across all threads.
                 AZStd::atomic_uint32_t m_pendingCompileCount = {0};
 
+                // Pipeline states queued or compiling on background jobs. Entries move to the pending cache
+                // once compiled. Guarded by m_pendingCacheMutex.
+                PipelineStateSet m_asyncCompileCache;
+
+                // Pending cache entries that a synchronous acquire is still compiling. Every other pending cache entry
+                // is fully compiled and can be returned by the async path. Guarded by m_pendingCacheMutex.
+                AZStd::unordered_set<const PipelineState*> m_compilingPipelineStates;
+
+                // Incremented every time the library is reset or released. Background compilations that started
+                // under a previous generation discard their results rather than publishing them.
+                uint32_t m_generation = 0;
+
                 // Contains the initial serialized data (Used to prime the thread libraries)
                 // or the file name that contains the serialized data
                 PipelineLibraryDescriptor m_pipelineLibraryDescriptor;
@@ -209,6 +277,20 @@ namespace AZ
                 //! during GetMergedLibrary. The library is lazily initialized on the thread
                 //! and uses the initial serialized data passed in at creation time.
                 Ptr<PipelineLibrary> m_library;
+
+                //! Per-thread statistics counters. Each counter is only written by the owning thread,
+                //! so increments do not need read-modify-write atomics.
+                struct Counters
+                {
+                    AZStd::atomic<uint64_t> m_readOnlyCacheHits = {0};
+                    AZStd::atomic<uint64_t> m_threadLocalCacheHits = {0};
+                    AZStd::atomic<uint64_t> m_pendingCacheHits = {0};
+                    AZStd::atomic<uint64_t> m_synchronousCompiles = {0};
+                    AZStd::atomic<uint64_t> m_asyncCompilesQueued = {0};
+                    AZStd::atomic<uint64_t> m_asyncCompilesCompleted = {0};
+                    AZStd::atomic<uint64_t> m_fallbacksReturned = {0};
+                };
+                Counters m_counters;
             };
 
             //! Each thread has its own list of pipeline library entries. The index maps 1-to-1 with GlobalLibrarySet.
@@ -229,9 +311,25 @@ namespace AZ
                 const PipelineStateDescriptor& pipelineStateDescriptor,
                 PipelineStateHash pipelineStateHash);
 
+            //! Lazily initializes the thread-local pipeline library on first access.
+            void InitThreadLibrary(GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry);
+
+            //! Initializes the pipeline state using the appropriate descriptor type.
+            ResultCode InitPipelineState(PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, PipelineLibrary* pipelineLibrary);
+
+            //! Compiles a pipeline state queued in the async cache and publishes it to the pending cache. Runs on a job
+            //! worker thread, or inline when no job context is available.
+            void CompilePipelineStateAsync(PipelineLibraryHandle handle, uint32_t generation, Ptr<PipelineState> pipelineState, PipelineStateEntry pipelineStateEntry);
+
             //! Resets the library without validating the handle or taking a lock.
             void ResetLibraryImpl(PipelineLibraryHandle handle);
 
+            //! Increments a per-thread statistics counter.
+            static void IncrementCounter(AZStd::atomic<uint64_t>& counter)
+            {
+                counter.store(counter.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+            }
+
             Ptr<Device> m_device;
 
             /// Each thread owns a set of ThreadLibraryEntry elements. RHI::PipelineLibraryHandle is an
@@ -251,6 +349,9 @@ namespace AZ
             /// to recycle slots in m_globalLibrarySet.
             AZStd::fixed_vector<PipelineLibraryHandle, LibraryCountMax> m_libraryFreeList;
 
+            /// The number of background compilations queued across all libraries which have not yet completed.
+            mutable AZStd::atomic_uint32_t m_asyncCompileCount = {0};
+
             // Friends
             friend class UnitTest::PipelineStateTests;
         };
@@ -10,6 +10,8 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
@@ -26,6 +28,12 @@ namespace AZ
             : m_device{&device}
         {}
 
+        PipelineStateCache::~PipelineStateCache()
+        {
+            // Background compilations reference the cache, so they must drain before it is destroyed.
+            WaitForAsyncCompiles();
+        }
+
         void PipelineStateCache::ValidateCacheIntegrity() const
         {
 #if defined(AZ_ENABLE_TRACING)
@@ -160,6 +168,11 @@ namespace AZ
             libraryEntry.m_readOnlyCache.clear();
             libraryEntry.m_pendingCacheMutex.lock();
             libraryEntry.m_pendingCache.clear();
+
+            // Any background compilations still in flight belong to the previous generation and will be discarded.
+            libraryEntry.m_asyncCompileCache.clear();
+            libraryEntry.m_compilingPipelineStates.clear();
+            ++libraryEntry.m_generation;
             libraryEntry.m_pendingCacheMutex.unlock();
         }
 
@@ -293,40 +306,30 @@ namespace AZ
             GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
             PipelineStateHash pipelineStateHash = descriptor.GetHash();
 
+            ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
+            ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[handle.GetIndex()];
+
             // Search the read-only cache first.
             if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
             {
+                IncrementCounter(threadLibraryEntry.m_counters.m_readOnlyCacheHits);
                 return pipelineState;
             }
 
             // Search the thread-local cache next.
             {
-                ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
-                ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[handle.GetIndex()];
                 PipelineStateSet& threadLocalCache = threadLibraryEntry.m_threadLocalCache;
 
                 if (const PipelineState* pipelineState = FindPipelineState(threadLocalCache, descriptor))
                 {
+                    IncrementCounter(threadLibraryEntry.m_counters.m_threadLocalCacheHits);
                     return pipelineState;
                 }
 
                 // No entry in the thread-local set. Request a pipeline state from the pending cache and add
                 // it to the thread-local cache to reduce contention on the pending cache.
                 {
-                    // Lazy-init the library on first access.
-                    if (!threadLibraryEntry.m_library)
-                    {
-                        Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
-                        RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_pipelineLibraryDescriptor);
-                        if (resultCode != RHI::ResultCode::Success)
-                        {
-                            AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
-                        }
-
-                        // We store a valid pointer even if initialization failed, to avoid attempting
-                        // to re-create it with every access.
-                        threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
-                    }
+                    InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
 
                     ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash);
 
@@ -338,6 +341,222 @@ namespace AZ
             }
         }
 
+        const PipelineState* PipelineStateCache::AcquirePipelineStateAsync(
+            PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor, const PipelineState* fallbackPipelineState)
+        {
+            if (handle.IsNull())
+            {
+                return nullptr;
+            }
+
+            Ptr<PipelineState> queuedPipelineState;
+            uint32_t generation = 0;
+
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+                GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+                ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+
+                if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
+                {
+                    IncrementCounter(threadLibraryEntry.m_counters.m_readOnlyCacheHits);
+                    return pipelineState;
+                }
+
+                AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+
+                // Compiled this cycle, either in the background or by a synchronous acquire that has finished.
+                if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor))
+                {
+                    if (globalLibraryEntry.m_compilingPipelineStates.find(pipelineState) == globalLibraryEntry.m_compilingPipelineStates.end())
+                    {
+                        IncrementCounter(threadLibraryEntry.m_counters.m_pendingCacheHits);
+                        return pipelineState;
+                    }
+                }
+
+                IncrementCounter(threadLibraryEntry.m_counters.m_fallbacksReturned);
+
+                // Still compiling synchronously on another thread, or already queued.
+                if (FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor) ||
+                    FindPipelineState(globalLibraryEntry.m_asyncCompileCache, descriptor))
+                {
+                    return fallbackPipelineState;
+                }
+
+                queuedPipelineState = Factory::Get().CreatePipelineState();
+                generation = globalLibraryEntry.m_generation;
+
+                [[maybe_unused]] bool success = InsertPipelineState(
+                    globalLibraryEntry.m_asyncCompileCache, PipelineStateEntry(descriptor.GetHash(), queuedPipelineState, descriptor));
+                AZ_Assert(success, "PipelineStateEntry already exists in the async compile cache.");
+
+                IncrementCounter(threadLibraryEntry.m_counters.m_asyncCompilesQueued);
+                ++m_asyncCompileCount;
+            }
+
+            // The lock is released before compiling so that Compact and library resets are never blocked on a compilation.
+            PipelineStateEntry pipelineStateEntry(descriptor.GetHash(), queuedPipelineState, descriptor);
+            if (AZ::JobContext::GetGlobalContext())
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [this, handle, generation, pipelineState = AZStd::move(queuedPipelineState), entry = AZStd::move(pipelineStateEntry)]() mutable
+                    {
+                        CompilePipelineStateAsync(handle, generation, AZStd::move(pipelineState), AZStd::move(entry));
+                    },
+                    true, nullptr);
+                job->Start();
+            }
+            else
+            {
+                CompilePipelineStateAsync(handle, generation, AZStd::move(queuedPipelineState), AZStd::move(pipelineStateEntry));
+            }
+
+            return fallbackPipelineState;
+        }
+
+        void PipelineStateCache::CompilePipelineStateAsync(
+            PipelineLibraryHandle handle, uint32_t generation, Ptr<PipelineState> pipelineState, PipelineStateEntry pipelineStateEntry)
+        {
+            AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: CompilePipelineStateAsync");
+
+            const PipelineStateDescriptor& descriptor = pipelineStateEntry.GetDescriptor();
+
+            // Grab a reference to this thread's library under the lock. The compilation itself happens without the lock
+            // held; if the library is reset in the meantime the reference keeps it alive and the result is discarded.
+            Ptr<PipelineLibrary> pipelineLibrary;
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+                GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+                if (globalLibraryEntry.m_generation == generation)
+                {
+                    ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+                    InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
+                    pipelineLibrary = threadLibraryEntry.m_library;
+                }
+            }
+
+            if (pipelineLibrary)
+            {
+                [[maybe_unused]] ResultCode resultCode =
+                    InitPipelineState(*pipelineState, descriptor, pipelineLibrary->IsInitialized() ? pipelineLibrary.get() : nullptr);
+                AZ_Error("PipelineStateCache", resultCode == ResultCode::Success, "Failed to compile pipeline state in the background. It will remain in an uninitialized state.");
+
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+                GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+
+                AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+                if (globalLibraryEntry.m_generation == generation)
+                {
+                    globalLibraryEntry.m_asyncCompileCache.erase(pipelineStateEntry);
+
+                    // A synchronous acquire may have compiled the same pipeline state in the meantime, in which case
+                    // that instance is kept (callers may already hold it) and this one is dropped.
+                    InsertPipelineState(globalLibraryEntry.m_pendingCache, AZStd::move(pipelineStateEntry));
+
+                    IncrementCounter(m_threadLibrarySet.GetStorage()[handle.GetIndex()].m_counters.m_asyncCompilesCompleted);
+                }
+            }
+
+            --m_asyncCompileCount;
+        }
+
+        void PipelineStateCache::WaitForAsyncCompiles() const
+        {
+            AZStd::exponential_backoff backoff;
+            while (m_asyncCompileCount > 0)
+            {
+                backoff.wait();
+            }
+        }
+
+        uint32_t PipelineStateCache::GetAsyncCompileCount() const
+        {
+            return m_asyncCompileCount;
+        }
+
+        PipelineStateCache::Statistics PipelineStateCache::GetStatistics() const
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            Statistics statistics;
+            const size_t libraryCount = m_globalLibrarySet.size();
+            m_threadLibrarySet.ForEach([libraryCount, &statistics](const ThreadLibrarySet& threadLibrarySet)
+            {
+                for (size_t i = 0; i < libraryCount; ++i)
+                {
+                    const ThreadLibraryEntry::Counters& counters = threadLibrarySet[i].m_counters;
+                    statistics.m_readOnlyCacheHits += counters.m_readOnlyCacheHits.load(AZStd::memory_order_relaxed);
+                    statistics.m_threadLocalCacheHits += counters.m_threadLocalCacheHits.load(AZStd::memory_order_relaxed);
+                    statistics.m_pendingCacheHits += counters.m_pendingCacheHits.load(AZStd::memory_order_relaxed);
+                    statistics.m_synchronousCompiles += counters.m_synchronousCompiles.load(AZStd::memory_order_relaxed);
+                    statistics.m_asyncCompilesQueued += counters.m_asyncCompilesQueued.load(AZStd::memory_order_relaxed);
+                    statistics.m_asyncCompilesCompleted += counters.m_asyncCompilesCompleted.load(AZStd::memory_order_relaxed);
+                    statistics.m_fallbacksReturned += counters.m_fallbacksReturned.load(AZStd::memory_order_relaxed);
+                }
+            });
+            return statistics;
+        }
+
+        void PipelineStateCache::ResetStatistics()
+        {
+            // Takes the exclusive lock so no acquire is incrementing a counter while it is cleared.
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            m_threadLibrarySet.ForEach([](ThreadLibrarySet& threadLibrarySet)
+            {
+                for (ThreadLibraryEntry& threadLibraryEntry : threadLibrarySet)
+                {
+                    ThreadLibraryEntry::Counters& counters = threadLibraryEntry.m_counters;
+                    counters.m_readOnlyCacheHits = 0;
+                    counters.m_threadLocalCacheHits = 0;
+                    counters.m_pendingCacheHits = 0;
+                    counters.m_synchronousCompiles = 0;
+                    counters.m_asyncCompilesQueued = 0;
+                    counters.m_asyncCompilesCompleted = 0;
+                    counters.m_fallbacksReturned = 0;
+                }
+            });
+        }
+
+        void PipelineStateCache::InitThreadLibrary(GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry)
+        {
+            // Lazy-init the library on first access.
+            if (!threadLibraryEntry.m_library)
+            {
+                Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
+                RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_pipelineLibraryDescriptor);
+                if (resultCode != RHI::ResultCode::Success)
+                {
+                    AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+                }
+
+                // We store a valid pointer even if initialization failed, to avoid attempting
+                // to re-create it with every access.
+                threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+            }
+        }
+
+        ResultCode PipelineStateCache::InitPipelineState(PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, PipelineLibrary* pipelineLibrary)
+        {
+            switch (descriptor.GetType())
+            {
+            case PipelineStateType::Draw:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
+
+            case PipelineStateType::Dispatch:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
+
+            case PipelineStateType::RayTracing:
+                return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
+
+            default:
+                AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
+                return ResultCode::InvalidArgument;
+            }
+        }
+
         ConstPtr<PipelineState> PipelineStateCache::CompilePipelineState(
             GlobalLibraryEntry& globalLibraryEntry,
             ThreadLibraryEntry& threadLibraryEntry,
@@ -354,6 +573,7 @@ namespace AZ
                 // Another thread may have started compiling this pipeline state. Check the pending cache.
                 if (const PipelineState* pipeline = FindPipelineState(pendingCache, descriptor))
                 {
+                    IncrementCounter(threadLibraryEntry.m_counters.m_pendingCacheHits);
                     return pipeline;
                 }
 
@@ -363,9 +583,12 @@ namespace AZ
 
                 [[maybe_unused]] bool success = InsertPipelineState(pendingCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
                 AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
+
+                // Keeps the async path from returning the pipeline state before it is compiled.
+                globalLibraryEntry.m_compilingPipelineStates.insert(pipelineState.get());
             }
 
-            [[maybe_unused]] ResultCode resultCode = ResultCode::InvalidArgument;
+            IncrementCounter(threadLibraryEntry.m_counters.m_synchronousCompiles);
 
             // Increment the pending compile count on the global entry, which tracks how many pipeline states
             // are currently being compiled across all threads.
@@ -383,22 +606,11 @@ namespace AZ
 
             // We no longer have the lock, but we own compilation of the pipeline state. Use the
             // thread-local library to perform compilation without blocking other threads.
-            switch (descriptor.GetType())
-            {
-            case PipelineStateType::Draw:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
-                break;
+            [[maybe_unused]] ResultCode resultCode = InitPipelineState(*pipelineState, descriptor, pipelineLibrary);
 
-            case PipelineStateType::Dispatch:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
-                break;
-
-            case PipelineStateType::RayTracing:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
-                break;
-
-            default:
-                AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(globalLibraryEntry.m_pendingCacheMutex);
+                globalLibraryEntry.m_compilingPipelineStates.erase(pipelineState.get());
             }
 
             if (Validation::IsEnabled())
@@ -433,6 +645,19 @@ namespace AZ
             }
         }
 
+        const PipelineStateDescriptor& PipelineStateCache::PipelineStateEntry::GetDescriptor() const
+        {
+            if (const auto* dispatchDescriptor = AZStd::get_if<PipelineStateDescriptorForDispatch>(&m_pipelineStateDescriptorVariant))
+            {
+                return *dispatchDescriptor;
+            }
+            else if (const auto* rayTracingDescriptor = AZStd::get_if<PipelineStateDescriptorForRayTracing>(&m_pipelineStateDescriptorVariant))
+            {
+                return *rayTracingDescriptor;
+            }
+            return AZStd::get<PipelineStateDescriptorForDraw>(m_pipelineStateDescriptorVariant);
+        }
+
         bool PipelineStateCache::PipelineStateEntry::operator == (const PipelineStateCache::PipelineStateEntry& rhs) const
         {
             if(AZStd::get_if<AZ::RHI::PipelineStateDescriptorForDispatch>(&rhs.m_pipelineStateDescriptorVariant) &&
@@ -8,9 +8,11 @@
 
 #include <Atom/RHI/Device.h>
 #include <Atom/RHI/Factory.h>
+#include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/RHISystem.h>
 #include <Atom/RHI/RHIUtils.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Interface/Interface.h>
 
@@ -20,6 +22,8 @@
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/string/conversions.h>
 
+#include <cinttypes>
+
 AZ_DEFINE_BUDGET(RHI);
 
 namespace AZ
@@ -31,6 +35,28 @@ namespace AZ
             return Interface<RHISystemInterface>::Get();
         }
 
+        static void r_printPipelineStateCacheStatistics([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            RHISystemInterface* rhiSystem = RHISystemInterface::Get();
+            PipelineStateCache* pipelineStateCache = rhiSystem ? rhiSystem->GetPipelineStateCache() : nullptr;
+            if (!pipelineStateCache)
+            {
+                return;
+            }
+
+            const PipelineStateCache::Statistics statistics = pipelineStateCache->GetStatistics();
+            AZ_TracePrintf("RHISystem", "PipelineStateCache statistics:\n");
+            AZ_TracePrintf("RHISystem", "  Read-only cache hits: %" PRIu64 "\n", statistics.m_readOnlyCacheHits);
+            AZ_TracePrintf("RHISystem", "  Thread-local cache hits: %" PRIu64 "\n", statistics.m_threadLocalCacheHits);
+            AZ_TracePrintf("RHISystem", "  Pending cache hits: %" PRIu64 "\n", statistics.m_pendingCacheHits);
+            AZ_TracePrintf("RHISystem", "  Synchronous compiles: %" PRIu64 "\n", statistics.m_synchronousCompiles);
+            AZ_TracePrintf("RHISystem", "  Async compiles queued: %" PRIu64 "\n", statistics.m_asyncCompilesQueued);
+            AZ_TracePrintf("RHISystem", "  Async compiles completed: %" PRIu64 "\n", statistics.m_asyncCompilesCompleted);
+            AZ_TracePrintf("RHISystem", "  Fallbacks returned: %" PRIu64 "\n", statistics.m_fallbacksReturned);
+        }
+
+        AZ_CONSOLEFREEFUNC(r_printPipelineStateCacheStatistics, AZ::ConsoleFunctorFlags::Null, "Prints the pipeline state cache hit / miss statistics.");
+
         void RHISystem::InitDevice()
         {
             Interface<RHISystemInterface>::Register(this);
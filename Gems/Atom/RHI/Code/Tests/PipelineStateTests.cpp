@@ -362,4 +362,104 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_AcquireAsync_ReturnsFallbackUntilCompiled)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        RHI::Ptr<RHI::PipelineState> fallback = RHI::Factory::Get().CreatePipelineState();
+        RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(0);
+
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync({}, descriptor, fallback.get()), nullptr);
+
+        // No job context exists in this fixture, so the compilation runs inline. The compiled pipeline state
+        // is returned from the pending cache without waiting for compaction.
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, fallback.get()), fallback.get());
+        pipelineStateCache->WaitForAsyncCompiles();
+        EXPECT_EQ(pipelineStateCache->GetAsyncCompileCount(), 0);
+
+        const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, fallback.get());
+        EXPECT_NE(pipelineState, fallback.get());
+        EXPECT_NE(pipelineState, nullptr);
+        EXPECT_TRUE(pipelineState->IsInitialized());
+
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, fallback.get()), pipelineState);
+
+        // The synchronous path returns the same instance.
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor), pipelineState);
+
+        const RHI::PipelineStateCache::Statistics statistics = pipelineStateCache->GetStatistics();
+        EXPECT_EQ(statistics.m_asyncCompilesQueued, 1);
+        EXPECT_EQ(statistics.m_asyncCompilesCompleted, 1);
+        EXPECT_EQ(statistics.m_fallbacksReturned, 1);
+        EXPECT_EQ(statistics.m_pendingCacheHits, 1);
+        EXPECT_EQ(statistics.m_readOnlyCacheHits, 2);
+        EXPECT_EQ(statistics.m_synchronousCompiles, 0);
+
+        pipelineStateCache->ResetStatistics();
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_readOnlyCacheHits, 0);
+    }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_AcquireAsync_ReturnsSynchronouslyCompiledPipelineState)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        RHI::Ptr<RHI::PipelineState> fallback = RHI::Factory::Get().CreatePipelineState();
+        RHI::PipelineStateDescriptorForDraw descriptor = CreatePipelineStateDescriptor(0);
+
+        const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
+        ASSERT_NE(pipelineState, nullptr);
+
+        // The synchronous compile has finished, so the async path doesn't need the fallback or a second compile.
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, fallback.get()), pipelineState);
+
+        const RHI::PipelineStateCache::Statistics statistics = pipelineStateCache->GetStatistics();
+        EXPECT_EQ(statistics.m_asyncCompilesQueued, 0);
+        EXPECT_EQ(statistics.m_fallbacksReturned, 0);
+        EXPECT_EQ(statistics.m_synchronousCompiles, 1);
+
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+    }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_AcquirePipelineStateAsync_DiscardedOnReset)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        static const size_t PipelineStateCountMax = 16;
+        AZStd::vector<RHI::PipelineStateDescriptorForDraw> descriptors;
+        descriptors.reserve(PipelineStateCountMax);
+        for (size_t i = 0; i < PipelineStateCountMax; ++i)
+        {
+            descriptors.push_back(CreatePipelineStateDescriptor(static_cast<uint32_t>(i)));
+            pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptors.back(), nullptr);
+        }
+
+        pipelineStateCache->WaitForAsyncCompiles();
+        pipelineStateCache->Compact();
+
+        for (const RHI::PipelineStateDescriptorForDraw& descriptor : descriptors)
+        {
+            EXPECT_NE(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, nullptr), nullptr);
+        }
+        EXPECT_EQ(pipelineStateCache->GetStatistics().m_synchronousCompiles, 0);
+
+        pipelineStateCache->ResetLibrary(libraryHandle);
+        for (const RHI::PipelineStateDescriptorForDraw& descriptor : descriptors)
+        {
+            EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptor, nullptr), nullptr);
+        }
+        pipelineStateCache->WaitForAsyncCompiles();
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+    }
 }
@@ -26,6 +26,7 @@
 
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/View.h>
 #include <Atom/RHI/DrawList.h>
 
@@ -99,6 +100,9 @@ namespace AZ
                     float m_screenCoverageMin;
                     float m_screenCoverageMax;
                     AZStd::vector<const RHI::DrawPacket*> m_drawPackets;
+                    //! Streaming images sampled by the draw packets. When the lod is drawn in a camera view, culling reports the
+                    //! projected size of the object to them for the streaming image budget solver (r_streamingImageBudgetSolver).
+                    AZStd::vector<Data::Instance<StreamingImage>> m_streamingImages;
                 };
 
                 AZStd::vector<Lod> m_lods;
@@ -254,6 +258,20 @@ namespace AZ
             //! Sets a list of occlusion planes to be used during the culling process.
             void SetOcclusionPlanes(const OcclusionPlaneVector& occlusionPlanes) { m_occlusionPlanes = occlusionPlanes; }
 
+            struct OccluderMesh
+            {
+                // World space triangle list, rendered double sided
+                AZStd::vector<Vector3> m_positions;
+                AZStd::vector<uint32_t> m_indices;
+
+                Aabb m_aabb;
+            };
+            using OccluderMeshVector = AZStd::vector<OccluderMesh>;
+
+            //! Sets a list of designated occluder meshes that are rendered into the occlusion buffer along with the occlusion planes.
+            //! Occluders should be simple, conservative (never larger than the visible geometry) meshes.
+            void SetOccluderMeshes(const OccluderMeshVector& occluderMeshes) { m_occluderMeshes = occluderMeshes; }
+
             //! Notifies the CullingScene that culling will begin for this frame.
             void BeginCulling(const AZStd::vector<ViewPtr>& views);
 
@@ -302,13 +320,19 @@ namespace AZ
         private:
             void BeginCullingTaskGraph(const AZStd::vector<ViewPtr>& views);
             void BeginCullingJobs(const AZStd::vector<ViewPtr>& views);
-            void ProcessCullablesCommon(const Scene& scene, View& view, AZ::Frustum& frustum, void*& maskedOcclusionCulling);
+            void ProcessCullablesCommon(
+                const Scene& scene,
+                View& view,
+                AZ::Frustum& frustum,
+                void*& maskedOcclusionCulling,
+                SoftwareOcclusionCulling*& softwareOcclusionCulling);
 
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+            OccluderMeshVector m_occluderMeshes;
             AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
         };
         
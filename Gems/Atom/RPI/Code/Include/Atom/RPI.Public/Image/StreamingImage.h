@@ -73,6 +73,11 @@ namespace AZ
             //! Requests the image mips be made available.
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Reports how large the image appears on screen, in pixels along its widest axis. The controller's budget solver
+            //! (r_streamingImageBudgetSolver) uses the largest size reported between solves to prioritize the image and pick its
+            //! target mip. Thread safe, so it can be called from culling or draw packet jobs.
+            void ReportScreenSpaceSize(float projectedSizeInPixels);
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Describes one streaming image for the StreamingImageBudgetSolver.
+        struct StreamingImageBudgetRequest
+        {
+            //! The maximum number of mip chains a streaming image can have (mip chain residency is tracked in 16 bit masks).
+            static constexpr size_t MipChainCountMax = 16;
+
+            //! Device memory in bytes used by each mip chain, where index 0 is the most detailed chain.
+            //! The last (tail) mip chain is always resident.
+            AZStd::fixed_vector<size_t, MipChainCountMax> m_mipChainSizes;
+
+            //! The most detailed mip chain that is useful for this image. The solver never assigns a more detailed chain.
+            uint16_t m_requestedMipChain = 0;
+
+            //! Relative importance of the image, typically its projected screen-space coverage in pixels.
+            //! Images with zero priority are kept at their tail mip chain.
+            float m_priority = 0.0f;
+
+            //! Upgrades of requests in a higher tier are always granted before upgrades in a lower tier, whatever their priority.
+            //! Priority only orders upgrades within a tier.
+            uint8_t m_priorityTier = 0;
+        };
+
+        //! Solves a global mip chain allocation for a set of streaming images under a device memory budget.
+        //!
+        //! Every image starts at its tail mip chain. The solver then repeatedly grants the single mip chain upgrade with the
+        //! highest priority per byte, until either every image reached its requested chain or no remaining upgrade fits in the
+        //! budget. This is the greedy solution to the fractional knapsack, which is good enough since mip chain sizes grow
+        //! geometrically and are solved again every few frames.
+        class StreamingImageBudgetSolver
+        {
+        public:
+            //! Computes a target mip chain for each request.
+            //! @param requests The images to solve for.
+            //! @param memoryBudget The device memory available to all requests in bytes. A budget of 0 means unlimited.
+            //! @param targetMipChains Receives the target mip chain of each request. Must be the same size as requests.
+            //! @return The total device memory used by the solution in bytes.
+            static size_t Solve(
+                AZStd::span<const StreamingImageBudgetRequest> requests,
+                size_t memoryBudget,
+                AZStd::span<uint16_t> targetMipChains);
+
+            //! Returns the most detailed mip level worth streaming for an image of the given width when it covers
+            //! projectedSizeInPixels pixels on screen (one texel per pixel).
+            static uint16_t CalculateRequestedMipLevel(uint32_t imageWidth, uint16_t mipLevels, float projectedSizeInPixels);
+        };
+    } // namespace RPI
+} // namespace AZ
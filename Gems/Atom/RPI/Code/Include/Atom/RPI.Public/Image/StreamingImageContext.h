@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/IO/IStreamerTypes.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -47,12 +48,19 @@ namespace AZ
             //! Update tick. So a strong reference is not required anyway.
             StreamingImage* TryGetImage() const;
 
-            //! Returns the target mip level requested for the image.
+            //! Returns the target mip level requested for the image, limited by the mip level assigned by the controller's budget solver.
             uint16_t GetTargetMip() const;
 
             //! Returns the timestamp of last access.
             size_t GetLastAccessTimestamp() const;
 
+            //! Returns the largest projected screen-space size reported for the image since the last budget solve.
+            float GetScreenSpaceSize() const;
+
+            //! Returns the streamer priority and deadline used when fetching mip chain assets for the image.
+            IO::IStreamerTypes::Priority GetLoadPriority() const;
+            IO::IStreamerTypes::Deadline GetLoadDeadline() const;
+
         private:
 
             // Holds a weak (raw) reference to the parent streaming image.
@@ -65,8 +73,18 @@ namespace AZ
             // User may use StreamingImage::SetTargetMip() function to set the target mip level for the image
             AZStd::atomic_uint16_t m_mipLevelTarget = {0};
 
+            // The most detailed mip level the budget solver allows for the image. 0 (no limit) unless the solver is enabled.
+            AZStd::atomic_uint16_t m_budgetMipLevelLimit = {0};
+
             // Tracks the last timestamp the image was requested.
             AZStd::atomic_size_t m_lastAccessTimestamp = {0};
+
+            // The largest projected screen-space size, in pixels, reported since the last budget solve.
+            AZStd::atomic<float> m_screenSpaceSize = {0.0f};
+
+            // Streamer priority and deadline for mip chain asset loads, assigned by the controller's budget solver.
+            IO::IStreamerTypes::Priority m_loadPriority = IO::IStreamerTypes::s_priorityMedium;
+            IO::IStreamerTypes::Deadline m_loadDeadline = IO::IStreamerTypes::s_noDeadline;
         };
 
         using StreamingImageContextPtr = AZStd::intrusive_ptr<StreamingImageContext>;
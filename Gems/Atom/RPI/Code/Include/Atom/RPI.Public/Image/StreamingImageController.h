@@ -16,6 +16,7 @@
 #include <AzCore/std/parallel/mutex.h>
 
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageBudgetSolver.h>
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageControllerAsset.h>
 
@@ -77,6 +78,9 @@ namespace AZ
             //! Return whether the available memory of the streaming image pool is low
             bool IsMemoryLow() const;
 
+            //! Returns the device memory in bytes assigned to all images by the last budget solve.
+            size_t GetBudgetSolvedMemoryUsage() const;
+
         protected:
             using StreamingImageContextList = AZStd::intrusive_list<StreamingImageContext, AZStd::list_base_hook<StreamingImageContext>>;
 
@@ -112,6 +116,13 @@ namespace AZ
             // Reset the cached variables related to last memory value when the controller receives low memory notification
             void ResetLowMemoryState();
 
+            // Re-evaluates an image's position in the streamable list after its target mip changed
+            void UpdateImageTarget(StreamingImage* image);
+
+            // Computes each image's mip level limit from the screen-space sizes reported since the last solve,
+            // such that all images fit in the pool's memory budget (used when r_streamingImageBudgetSolver is enabled)
+            void SolveMemoryBudget();
+
         private:
 
             // Called when an image asset is being attached to the controller. The user is expected to return
@@ -152,6 +163,18 @@ namespace AZ
 
             // a global option to add a bias to all the streaming images' target mip level
             int16_t m_globalMipBias = 0;
+
+            // Scratch storage for the budget solver, kept to avoid reallocating every solve
+            AZStd::vector<StreamingImageBudgetRequest> m_budgetRequests;
+            AZStd::vector<uint16_t> m_budgetTargetMipChains;
+            AZStd::vector<StreamingImage*> m_budgetImages;
+            AZStd::vector<uint32_t> m_budgetRankedImages;
+
+            // The memory assigned by the last budget solve
+            size_t m_budgetSolvedMemoryUsage = 0;
+
+            // Whether the last update ran the budget solver, used to clear the limits when the solver is disabled
+            bool m_budgetSolverActive = false;
         };
     }
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/parallel/atomic.h>
 
 // These classes are not directly referenced in this header only because the Set/GetPropertyValue()
 // functions are templatized. But the API is still specific to these data types so we include them here.
@@ -101,6 +102,15 @@ namespace AZ
             //! Does nothing if NeedsCompile() is false or CanCompile() is false.
             //! @return whether compilation occurred
             bool Compile();
+
+            //! Queues the material to be compiled by the MaterialSystem later this frame, batched with other materials of the
+            //! same material type, instead of compiling immediately. Queuing an already queued material does nothing.
+            //! Falls back to Compile() if the material system is not available.
+            //! @return false only if an immediate compile was attempted and could not occur
+            bool QueueCompile();
+
+            //! Returns whether the material is waiting in the MaterialSystem's compile queue.
+            bool IsQueuedForCompile() const;
             
             //! Returns an ID that can be used to track whether the material has changed since the last time client code read it.
             //! This gets incremented every time a change is made, like by calling SetPropertyValue().
@@ -206,6 +216,9 @@ namespace AZ
             ChangeId m_compiledChangeId = DEFAULT_CHANGE_ID;
 
             bool m_isInitializing = false;
+
+            //! Set while the material is waiting in the MaterialSystem's compile queue, to avoid queuing it twice.
+            AZStd::atomic_bool m_isQueuedForCompile{ false };
                 
             MaterialPropertyPsoHandling m_psoHandling = MaterialPropertyPsoHandling::Warning;
         };
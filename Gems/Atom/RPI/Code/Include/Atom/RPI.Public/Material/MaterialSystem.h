@@ -9,21 +9,59 @@
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
 namespace AZ
 {
     class ReflectContext;
 
     namespace RPI
     {
-        //! Manages system-wide initialization and support for material classes
+        class Material;
+
+        //! Manages system-wide initialization and support for material classes.
+        //!
+        //! Also owns the queue of materials waiting for a batched compile (see Material::QueueCompile). Queued materials are
+        //! grouped by material type and compiled once per frame by CompileQueuedMaterials. Material types are compiled in parallel
+        //! on the job system, while materials of the same type are compiled serially since they share functor instances (and,
+        //! for Lua functors, a script context). Compiling a whole type back-to-back also keeps its SRG compiles adjacent in the
+        //! RHI pool's compile queue.
         class MaterialSystem
         {
         public:
+            AZ_RTTI(MaterialSystem, "{8D0DC3F4-4A6B-4E45-9C5A-2B8F5C6E1D37}");
+
             static void Reflect(AZ::ReflectContext* context);
             static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
+            //! Returns the active material system, or null if it hasn't been initialized.
+            static MaterialSystem* Get();
+
             void Init();
             void Shutdown();
+
+            //! Adds a material to the batched compile queue. Thread safe. Prefer Material::QueueCompile().
+            void QueueMaterialCompile(const Data::Instance<Material>& material);
+
+            //! Compiles queued materials, grouped by material type, up to the r_materialCompileBudget limit.
+            //! Materials over the budget, or that cannot compile this frame, remain queued for the next call.
+            void CompileQueuedMaterials();
+
+            //! Returns the number of materials currently waiting to be compiled.
+            size_t GetQueuedMaterialCount() const;
+
+        private:
+            using MaterialBatch = AZStd::vector<Data::Instance<Material>>;
+
+            mutable AZStd::mutex m_queuedMaterialsMutex;
+
+            //! Materials waiting for a compile, grouped by material type asset id.
+            AZStd::unordered_map<Data::AssetId, MaterialBatch> m_queuedMaterials;
+            size_t m_queuedMaterialCount = 0;
         };
 
     } // namespace RPI
@@ -13,6 +13,7 @@
 #include <Atom/RPI.Public/Model/ModelLod.h>
 #include <Atom/RHI/DrawPacket.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
+#include <Atom/RHI/PipelineStateDescriptor.h>
 
 #include <AzCore/Math/Obb.h>
 #include <AzCore/std/containers/fixed_vector.h>
@@ -66,6 +67,9 @@ namespace AZ
 
         private:
             bool DoUpdate(const Scene& parentScene);
+
+            //! Returns true once every pipeline state in m_pendingPipelineStates has been compiled.
+            bool ArePendingPipelineStatesCompiled() const;
             void ForValidShaderOptionName(const Name& shaderOptionName, const AZStd::function<bool(const ShaderCollection::Item&, ShaderOptionIndex)>& callback);
             bool MaterialOwnsShaderOption(const Name& shaderOptionName);
 
@@ -111,6 +115,17 @@ namespace AZ
             typedef AZStd::pair<Name, RPI::ShaderOptionValue> ShaderOptionPair;
             typedef AZStd::vector<ShaderOptionPair> ShaderOptionVector;
             ShaderOptionVector m_shaderOptions;
+
+            //! A draw item whose pipeline state is being compiled in the background.
+            struct PendingPipelineState
+            {
+                Data::Instance<Shader> m_shader;
+                RHI::PipelineStateDescriptorForDraw m_descriptor;
+            };
+
+            //! Draw items that use the root shader variant's pipeline state until their own is compiled.
+            //! The draw packet is rebuilt once all of them are available.
+            AZStd::vector<PendingPipelineState> m_pendingPipelineStates;
         };
         
         using MeshDrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
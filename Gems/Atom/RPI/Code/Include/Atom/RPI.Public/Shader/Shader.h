@@ -19,6 +19,7 @@
 
 #include <AtomCore/Instance/InstanceData.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
 namespace AZ
@@ -124,6 +125,11 @@ namespace AZ
             //! Acquires a pipeline state directly from a descriptor.
             const RHI::PipelineState* AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
 
+            //! Acquires a pipeline state without compiling it on the calling thread. Returns the fallback pipeline state
+            //! while the requested one is compiled in the background. See RHI::PipelineStateCache::AcquirePipelineStateAsync.
+            const RHI::PipelineState* AcquirePipelineStateAsync(
+                const RHI::PipelineStateDescriptor& descriptor, const RHI::PipelineState* fallbackPipelineState) const;
+
             //! Finds and returns the shader resource group asset with the requested name. Returns an empty handle if no matching group was found.
             const RHI::Ptr<RHI::ShaderResourceGroupLayout>& FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const;
 
@@ -14,8 +14,12 @@
 
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/unordered_map.h>
-#include <AzCore/std/parallel/mutex.h>
-#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ
 {
@@ -26,6 +30,7 @@ namespace AZ
         /**
          * A helper class used by ShaderSystem to manage asynchronous loading of ShaderVariantTreeAssets
          * and ShaderVariantAssets.
+         * Requests are queued without locking. A service thread collects them and resolves them in parallel jobs.
          * The notifications of assets being loaded & ready are dispatched via ShaderVariantFinderNotificationBus.
          */
         class ShaderVariantAsyncLoader final
@@ -88,34 +93,75 @@ namespace AZ
             void OnShaderVariantTreeAssetError(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset);
             void OnShaderVariantAssetError(Data::Asset<ShaderVariantAsset> shaderVariantAsset);
 
+            //! A list of load requests that any thread can push to without locking, and that the service thread
+            //! consumes all at once.
+            template<typename T>
+            class PendingRequestList
+            {
+            public:
+                ~PendingRequestList();
+
+                //! Adds a request. Returns true if the list was empty, in which case the service thread must be woken up.
+                bool Push(const T& value);
+
+                //! Removes all the requests, calling function for each one.
+                template<typename Function>
+                void Consume(Function&& function);
+
+            private:
+                struct Node
+                {
+                    AZ_CLASS_ALLOCATOR(Node, AZ::SystemAllocator, 0);
+
+                    explicit Node(const T& value)
+                        : m_value(value)
+                    {
+                    }
+
+                    T m_value;
+                    Node* m_next = nullptr;
+                };
+
+                AZStd::atomic<Node*> m_head = { nullptr };
+            };
+
             void ThreadServiceLoop();
 
+            //! Calls function for each index in [0, count), in parallel jobs when possible, and waits for all of them.
+            void ForEachInParallel(size_t count, const AZStd::function<void(size_t)>& function);
+
             void QueueShaderVariantTreeForLoading(
                 const TupleShaderAssetAndShaderVariantId& shaderAndVariantTuple,
                 AZStd::unordered_set<Data::AssetId>& shaderVariantTreePendingRequests);
 
-            //! This is a helper method called from the service thread.
+            //! This is a helper method called from the service thread's jobs.
             //! Returns true if a valid AssetId for the corresponding ShaderVariantTreeAsset is registered
             //! in the asset database AND a request to load such asset is properly queued.
-            bool TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId);
+            //! @param assetToConnect Receives the asset the loader must listen to on the AssetBus. Bus connections
+            //!        aren't thread safe for a MultiHandler, so the service thread makes them after the jobs complete.
+            bool TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId, Data::AssetId& assetToConnect);
 
-            bool TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId);
+            bool TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId, Data::AssetId& assetToConnect);
 
 
             //! A thread that runs forever servicing shader variant and trees load requests.
             AZStd::thread m_serviceThread;
             AZStd::atomic_bool m_isServiceShutdown;
-            AZStd::mutex m_mutex;
-            AZStd::condition_variable m_workCondition;
+
+            //! Guards m_shaderVariantData and m_shaderAssetIdToShaderVariantTreeAssetId.
+            AZStd::shared_mutex m_mutex;
+
+            //! Signaled when requests are added to an empty list, or on shutdown.
+            AZStd::binary_semaphore m_workSemaphore;
 
             //! This is a list of AssetId of ShaderVariantAsset.
-            AZStd::vector<TupleShaderAssetAndShaderVariantId> m_newShaderVariantPendingRequests;
+            PendingRequestList<TupleShaderAssetAndShaderVariantId> m_newShaderVariantPendingRequests;
 
             //! This is a list of AssetId of ShaderAsset (Do not confuse with the AssetId ShaderVariantTreeAsset).
-            AZStd::vector<Data::AssetId> m_shaderVariantTreePendingRequests;
+            PendingRequestList<Data::AssetId> m_shaderVariantTreePendingRequests;
 
             //! This is a list of AssetId of ShaderVariantAsset.
-            AZStd::vector<Data::AssetId> m_shaderVariantPendingRequests;
+            PendingRequestList<Data::AssetId> m_shaderVariantPendingRequests;
 
             struct ShaderVariantCollection
             {
@@ -136,22 +182,43 @@ namespace AZ
 
         };
 
+        template<typename T>
+        ShaderVariantAsyncLoader::PendingRequestList<T>::~PendingRequestList()
+        {
+            Consume([](const T&) {});
+        }
+
+        template<typename T>
+        bool ShaderVariantAsyncLoader::PendingRequestList<T>::Push(const T& value)
+        {
+            Node* node = aznew Node(value);
+            node->m_next = m_head.load(AZStd::memory_order_relaxed);
+            while (!m_head.compare_exchange_weak(node->m_next, node, AZStd::memory_order_release, AZStd::memory_order_relaxed))
+            {
+            }
+            return node->m_next == nullptr;
+        }
 
+        template<typename T>
+        template<typename Function>
+        void ShaderVariantAsyncLoader::PendingRequestList<T>::Consume(Function&& function)
+        {
+            // Taking the whole list at once avoids the ABA problem of popping single nodes.
+            Node* node = m_head.exchange(nullptr, AZStd::memory_order_acquire);
+            while (node)
+            {
+                Node* next = node->m_next;
+                function(node->m_value);
+                delete node;
+                node = next;
+            }
+        }
 
     } // namespace RPI
 } // namespace AZ
 
 namespace AZStd
 {
-    template<>
-    struct hash<AZ::RPI::ShaderVariantId>
-    {
-        size_t operator()(const AZ::RPI::ShaderVariantId& variantId) const
-        {
-            return AZStd::hash_range(variantId.m_key.data(), variantId.m_key.data() + variantId.m_key.num_words());
-        }
-    };
-
     template<>
     struct hash<AZ::RPI::ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId>
     {
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Portable software occlusion culling, used on platforms that don't support MaskedOcclusionCulling and by
+        //! code that needs visibility queries without a renderer (e.g. server-side visibility for bots or replication).
+        //!
+        //! Occluder triangles are rasterized with SIMD into a low resolution buffer that stores the inverse clip-space W
+        //! of the nearest occluder per pixel. BuildHierarchicalDepth() then reduces the buffer into a Hi-Z pyramid where
+        //! each texel holds the farthest occluder of the pixels it covers, so that an AABB can be tested against a
+        //! handful of texels regardless of its size on screen.
+        //!
+        //! Usage each frame:
+        //!  1) Clear()
+        //!  2) RenderTriangles() / RenderOccluderMesh() for every occluder, in any order.
+        //!  3) BuildHierarchicalDepth()
+        //!  4) TestRect() / TestAabb() / TestAabbs(), which are const and safe to call from multiple threads.
+        class SoftwareOcclusionCulling
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SoftwareOcclusionCulling, SystemAllocator, 0);
+
+            static constexpr uint32_t DefaultWidth = 256;
+            static constexpr uint32_t DefaultHeight = 144;
+
+            SoftwareOcclusionCulling();
+            SoftwareOcclusionCulling(uint32_t width, uint32_t height);
+
+            //! Sets the resolution of the depth buffer and clears it.
+            void SetResolution(uint32_t width, uint32_t height);
+            uint32_t GetWidth() const { return m_width; }
+            uint32_t GetHeight() const { return m_height; }
+
+            //! Clears the depth buffer so that nothing is occluded.
+            void Clear();
+
+            //! Rasterizes indexed clip-space triangles. Triangles are double sided and clipped against the near plane.
+            void RenderTriangles(AZStd::span<const Vector4> clipSpaceVertices, AZStd::span<const uint32_t> indices);
+
+            //! Transforms world space occluder geometry to clip space and rasterizes it.
+            void RenderOccluderMesh(const Matrix4x4& worldToClip, AZStd::span<const Vector3> positions, AZStd::span<const uint32_t> indices);
+
+            //! Rebuilds the Hi-Z pyramid from the depth buffer. Must be called after the last occluder is rendered and
+            //! before testing; until then tests only use the full resolution buffer.
+            void BuildHierarchicalDepth();
+
+            //! Returns false if the NDC rectangle, whose nearest point has the given clip-space W, is completely hidden
+            //! behind the rendered occluders. Rectangles that leave the screen are clamped to it.
+            bool TestRect(float ndcMinX, float ndcMinY, float ndcMaxX, float ndcMaxY, float minClipW) const;
+
+            //! Returns false if the world space AABB is completely hidden behind the rendered occluders.
+            //! AABBs that cross the near plane are always visible.
+            bool TestAabb(const Aabb& aabb, const Matrix4x4& worldToClip) const;
+
+            //! Tests many AABBs, splitting the work across jobs when the job system is available.
+            //! @param visibleFlags Receives the result of TestAabb() for each AABB; must be the same size as aabbs.
+            void TestAabbs(AZStd::span<const Aabb> aabbs, const Matrix4x4& worldToClip, AZStd::span<bool> visibleFlags) const;
+
+            //! Returns the number of Hi-Z levels currently available for testing, including the full resolution level.
+            uint32_t GetHierarchyLevelCount() const { return m_activeLevelCount; }
+
+        private:
+            struct ScreenVertex
+            {
+                float m_x;
+                float m_y;
+                float m_inverseW;
+            };
+
+            struct DepthLevel
+            {
+                uint32_t m_width = 0;
+                uint32_t m_height = 0;
+                uint32_t m_stride = 0;
+                AZStd::vector<float> m_inverseW;
+            };
+
+            void RenderClippedTriangle(const Vector4& v0, const Vector4& v1, const Vector4& v2);
+            void RasterizeTriangle(ScreenVertex v0, ScreenVertex v1, ScreenVertex v2);
+
+            uint32_t m_width = 0;
+            uint32_t m_height = 0;
+
+            //! Level 0 is the rasterized buffer, padded to a multiple of four pixels per row for SIMD.
+            //! Each following level halves the resolution.
+            AZStd::vector<DepthLevel> m_levels;
+
+            //! Number of levels that reflect the current occluders. Reset to 1 whenever the buffer changes.
+            uint32_t m_activeLevelCount = 1;
+        };
+    } // namespace RPI
+} // namespace AZ
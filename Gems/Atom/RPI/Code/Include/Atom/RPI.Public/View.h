@@ -18,6 +18,7 @@
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Name/Name.h>
 
 class MaskedOcclusionCulling;
@@ -35,6 +36,8 @@ namespace AZ
 
     namespace RPI
     {
+        class SoftwareOcclusionCulling;
+
         //! Represents a view into a scene, and is the primary interface for adding DrawPackets to the draw queues.
         //! It encapsulates the world<->view<->clip transforms and the per-view shader constants.
         //! Use View::CreateView() to make new vew Objects to ensure that you have a shared ViewPtr to pass around the code.
@@ -56,6 +59,16 @@ namespace AZ
                 UsageReflectiveCubeMap = (1u << 2),
                 UsageXR = (1u << 3)
             };
+
+            //! Selects the occlusion culling implementation the CullingScene uses for this view.
+            enum class OcclusionCullingMode : uint8_t
+            {
+                Default,    //!< MaskedOcclusionCulling where the platform supports it, otherwise SoftwareOcclusionCulling.
+                Masked,     //!< MaskedOcclusionCulling only, no occlusion culling where it is unsupported.
+                Software,   //!< The portable SoftwareOcclusionCulling.
+                Disabled    //!< No occlusion culling.
+            };
+
             //! Only use this function to create a new view object. And force using smart pointer to manage view's life time
             static ViewPtr CreateView(const AZ::Name& name, UsageFlags usage);
 
@@ -142,6 +155,16 @@ namespace AZ
             //! Returns the masked occlusion culling interface
             MaskedOcclusionCulling* GetMaskedOcclusionCulling();
 
+            //! Selects the occlusion culling implementation for this view. Must not be called while the view is being culled.
+            void SetOcclusionCullingMode(OcclusionCullingMode mode);
+            OcclusionCullingMode GetOcclusionCullingMode() const { return m_occlusionCullingMode; }
+
+            //! Returns true if the CullingScene should use the MaskedOcclusionCulling interface for this view.
+            bool UsesMaskedOcclusionCulling() const;
+
+            //! Returns the software occlusion culling buffer, or nullptr if this view doesn't use software occlusion culling.
+            SoftwareOcclusionCulling* GetSoftwareOcclusionCulling() { return m_softwareOcclusionCulling.get(); }
+
             //! This is called by RenderPipeline when this view is added to the pipeline.
             void OnAddToRenderPipeline();
 
@@ -213,6 +236,10 @@ namespace AZ
 
             // Masked Occlusion Culling interface
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
+
+            // Software occlusion culling buffer, only allocated when the occlusion culling mode resolves to software
+            AZStd::unique_ptr<SoftwareOcclusionCulling> m_softwareOcclusionCulling;
+            OcclusionCullingMode m_occlusionCullingMode = OcclusionCullingMode::Default;
         };
 
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(View::UsageFlags);
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/EBus/Event.h>
@@ -125,6 +126,7 @@ namespace AZ
             //! This function first loads and caches the ShaderVariantTreeAsset (if not done before).
             //! If the ShaderVariantTreeAsset is not found (either the AssetProcessor has not generated it yet, or it simply doesn't exist), then
             //! it returns a search result that identifies the root variant.
+            //! Results are cached per ShaderVariantId until the ShaderVariantTreeAsset changes.
             //! This function is thread safe.
             ShaderVariantSearchResult FindVariantStableId(const ShaderVariantId& shaderVariantId);
 
@@ -323,6 +325,15 @@ namespace AZ
             mutable AZStd::shared_mutex m_variantTreeMutex;
 
             bool m_shaderVariantTreeLoadWasRequested = false;
+
+            //! The maximum number of search results kept in m_variantLookupCache. The cache is cleared when full.
+            static constexpr size_t VariantLookupCacheCapacity = 1024;
+
+            //! Caches the results of searching m_shaderVariantTree, since the same few option combinations are requested every frame.
+            //! Cleared whenever m_shaderVariantTree changes. Guarded by m_variantLookupCacheMutex, which is always locked after
+            //! m_variantTreeMutex.
+            AZStd::unordered_map<ShaderVariantId, ShaderVariantSearchResult> m_variantLookupCache;
+            mutable AZStd::shared_mutex m_variantLookupCacheMutex;
         };
 
         class ShaderAssetHandler final
@@ -10,6 +10,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/AZStdContainers.inl>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/hash.h>
 
 #include <Atom/RHI.Reflect/Handle.h>
 
@@ -122,3 +123,17 @@ namespace AZ
         };
     } // namespace RPI
 } // namespace AZ
+
+namespace AZStd
+{
+    template<>
+    struct hash<AZ::RPI::ShaderVariantId>
+    {
+        size_t operator()(const AZ::RPI::ShaderVariantId& variantId) const
+        {
+            size_t retVal = AZStd::hash_range(variantId.m_key.data(), variantId.m_key.data() + variantId.m_key.num_words());
+            AZStd::hash_combine(retVal, AZStd::hash_range(variantId.m_mask.data(), variantId.m_mask.data() + variantId.m_mask.num_words()));
+            return retVal;
+        }
+    };
+} // namespace AZStd
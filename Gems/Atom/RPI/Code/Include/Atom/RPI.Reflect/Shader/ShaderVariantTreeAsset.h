@@ -68,15 +68,26 @@ namespace AZ
             size_t GetNodeCount() const;
 
             //! Finds and returns the shader variant index associated with the specified ID.
-            //! The search involves two general steps:
-            //! - Search the tree to find all possible matches for the specified shader variant ID.
-            //! - Search the best match from those results.
+            //! The search walks the tree depth first, keeping the best match found so far, and skips subtrees that
+            //! can't improve on it. It doesn't allocate memory, so it is safe to call per draw.
             ShaderVariantSearchResult FindVariantStableId(const ShaderOptionGroupLayout* shaderOptionGroupLayout, const ShaderVariantId& shaderVariantId) const;
 
         private:
 
             static constexpr uint32_t UnspecifiedIndex = std::numeric_limits<uint32_t>::max();
 
+            //! Compact copy of a ShaderVariantTreeNode used for lookups at runtime.
+            struct LookupNode
+            {
+                //! The index of the variant's ShaderVariantStableId, or UnspecifiedIndex.
+                uint32_t m_stableId = UnspecifiedIndex;
+                //! Absolute index of the unspecified child node, or 0 if the node is a leaf (the root can't be a child).
+                uint32_t m_firstChild = 0;
+            };
+
+            //! Builds m_lookupNodes from m_nodes.
+            void BuildLookupTable();
+
             //! Returns the node associated with the provided index.
             const ShaderVariantTreeNode& GetNode(uint32_t index) const;
 
@@ -95,6 +106,10 @@ namespace AZ
             //! .shadervariantlist file.
             AZ::u64 m_shaderHash = 0;
             AZStd::vector<ShaderVariantTreeNode> m_nodes;
+
+            //! Flattened version of m_nodes, built after loading. The serialized nodes carry RTTI, which doubles their size,
+            //! and store relative offsets, so searches walk this table instead.
+            AZStd::vector<LookupNode> m_lookupNodes;
         };
 
         class ShaderVariantTreeAssetHandler final
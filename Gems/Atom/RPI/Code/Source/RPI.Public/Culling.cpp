@@ -12,6 +12,7 @@
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/SoftwareOcclusionCulling.h>
 #include <Atom/RPI.Public/View.h>
 
 #include <AzCore/Math/MatrixUtils.h>
@@ -54,6 +55,11 @@ namespace AZ
         // Node work lists using node count
         AZ_CVAR(uint32_t, r_numNodesPerCullingJob, 25, nullptr, AZ::ConsoleFunctorFlags::Null, "Controls amount of nodes to collect for jobs when not using the entry count");
 
+        // Screen-space sizes for the streaming image budget solver
+        AZ_CVAR_EXTERNED(bool, r_streamingImageBudgetSolver);
+        AZ_CVAR(uint32_t, r_streamingImageScreenHeight, 1080, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Screen height in pixels used to convert the screen coverage of visible objects to the sizes reported to their streaming images");
+
 #ifdef AZ_CULL_DEBUG_ENABLED
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
         {
@@ -161,6 +167,7 @@ namespace AZ
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 #endif
+            const SoftwareOcclusionCulling* m_softwareOcclusionCulling = nullptr;
 #ifdef AZ_CULL_DEBUG_ENABLED
             AuxGeomDrawPtr GetAuxGeomPtr()
             {
@@ -179,6 +186,7 @@ namespace AZ
             View& view,
             Frustum& frustum,
             [[maybe_unused]] void* maskedOcclusionCulling,
+            const SoftwareOcclusionCulling* softwareOcclusionCulling,
             AZ::Job* parentJob,
             AZ::TaskGraphEvent* taskGraphEvent)
         {
@@ -192,6 +200,7 @@ namespace AZ
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             worklistData->m_maskedOcclusionCulling = static_cast<MaskedOcclusionCulling*>(maskedOcclusionCulling);
 #endif
+            worklistData->m_softwareOcclusionCulling = softwareOcclusionCulling;
             return worklistData;
         }
 
@@ -215,11 +224,9 @@ namespace AZ
             AZStd::vector<AzFramework::VisibilityEntry*> m_entries;
         };
 
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-        static MaskedOcclusionCulling::CullingResult TestOcclusionCulling(
+        static bool TestOcclusionCulling(
                     const AZStd::shared_ptr<WorklistData>& worklistData,
                     AzFramework::VisibilityEntry* visibleEntry);
-#endif
 
         static void ProcessEntrylist(const AZStd::shared_ptr<WorklistData>& worklistData, const AZStd::vector<AzFramework::VisibilityEntry*>& entries, bool parentNodeContainedInFrustum = false, s32 startIdx = 0, s32 endIdx = -1)
         {
@@ -255,9 +262,7 @@ namespace AZ
                         }
                     }
 
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                    if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
+                    if (TestOcclusionCulling(worklistData, visibleEntry))
                     {
                         // There are ways to write this without [[maybe_unused]], but they are brittle.
                         // For example, using #else could cause a bug where the function's parameter
@@ -405,19 +410,10 @@ namespace AZ
         }
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-        static MaskedOcclusionCulling::CullingResult TestOcclusionCulling(
+        static MaskedOcclusionCulling::CullingResult TestMaskedOcclusionCulling(
             const AZStd::shared_ptr<WorklistData>& worklistData,
             AzFramework::VisibilityEntry* visibleEntry)
         {
-            if (!worklistData->m_maskedOcclusionCulling)
-            {
-                return MaskedOcclusionCulling::CullingResult::VISIBLE;
-            }
-
-#ifdef AZ_CULL_PROFILE_VERBOSE
-            AZ_PROFILE_SCOPE(RPI, "TestOcclusionCulling");
-#endif
-
             if (visibleEntry->m_boundingVolume.Contains(worklistData->m_view->GetCameraTransform().GetTranslation()))
             {
                 // camera is inside bounding volume
@@ -467,11 +463,37 @@ namespace AZ
         }
 #endif
 
+        static bool TestOcclusionCulling(
+            const AZStd::shared_ptr<WorklistData>& worklistData,
+            AzFramework::VisibilityEntry* visibleEntry)
+        {
+#ifdef AZ_CULL_PROFILE_VERBOSE
+            AZ_PROFILE_SCOPE(RPI, "TestOcclusionCulling");
+#endif
+
+            if (worklistData->m_softwareOcclusionCulling)
+            {
+                // AABBs that contain the camera cross the near plane and are reported as visible
+                return worklistData->m_softwareOcclusionCulling->TestAabb(
+                    visibleEntry->m_boundingVolume, worklistData->m_view->GetWorldToClipMatrix());
+            }
+
+#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
+            if (worklistData->m_maskedOcclusionCulling)
+            {
+                return TestMaskedOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE;
+            }
+#endif
+
+            return true;
+        }
+
         void CullingScene::ProcessCullablesCommon(
             const Scene& scene [[maybe_unused]],
             View& view,
             AZ::Frustum& frustum [[maybe_unused]],
-            void*& maskedOcclusionCulling [[maybe_unused]])
+            void*& maskedOcclusionCulling [[maybe_unused]],
+            SoftwareOcclusionCulling*& softwareOcclusionCulling)
         {
             AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCullablesCommon() - %s", view.GetName().GetCStr());
 
@@ -501,9 +523,11 @@ namespace AZ
                 cullStats.m_cameraViewToWorld = view.GetViewToWorldMatrix();
             }
 #endif //AZ_CULL_DEBUG_ENABLED
+            const bool hasOccluders = !m_occlusionPlanes.empty() || !m_occluderMeshes.empty();
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             // setup occlusion culling, if necessary
-            maskedOcclusionCulling = m_occlusionPlanes.empty() ? nullptr : view.GetMaskedOcclusionCulling();
+            maskedOcclusionCulling = (hasOccluders && view.UsesMaskedOcclusionCulling()) ? view.GetMaskedOcclusionCulling() : nullptr;
             if (maskedOcclusionCulling)
             {
                 // frustum cull occlusion planes
@@ -547,8 +571,61 @@ namespace AZ
                     // render into the occlusion buffer, specifying BACKFACE_NONE so it functions as a double-sided occluder
                     static_cast<MaskedOcclusionCulling*>(maskedOcclusionCulling)->RenderTriangles(verts, indices, 2, nullptr, MaskedOcclusionCulling::BACKFACE_NONE);
                 }
+
+                AZStd::vector<float> meshVerts;
+                for (const OccluderMesh& occluderMesh : m_occluderMeshes)
+                {
+                    if (occluderMesh.m_indices.size() < 3 || !ShapeIntersection::Overlaps(frustum, occluderMesh.m_aabb))
+                    {
+                        continue;
+                    }
+
+                    meshVerts.resize(occluderMesh.m_positions.size() * 4);
+                    for (size_t vertexIndex = 0; vertexIndex < occluderMesh.m_positions.size(); ++vertexIndex)
+                    {
+                        Vector4 projected = view.GetWorldToClipMatrix() * Vector4::CreateFromVector3AndFloat(occluderMesh.m_positions[vertexIndex], 1.0f);
+                        projected.StoreToFloat4(&meshVerts[vertexIndex * 4]);
+                    }
+
+                    static_cast<MaskedOcclusionCulling*>(maskedOcclusionCulling)->RenderTriangles(
+                        meshVerts.data(), occluderMesh.m_indices.data(), aznumeric_cast<int>(occluderMesh.m_indices.size() / 3), nullptr,
+                        MaskedOcclusionCulling::BACKFACE_NONE);
+                }
             }
 #endif
+
+            // the software occlusion buffer doesn't depend on draw order, and its Hi-Z pyramid is built once here so that
+            // the culling jobs only read from it
+            softwareOcclusionCulling = hasOccluders ? view.GetSoftwareOcclusionCulling() : nullptr;
+            if (softwareOcclusionCulling)
+            {
+                AZ_PROFILE_SCOPE(RPI, "CullingScene: RenderSoftwareOcclusionBuffer");
+
+                static constexpr uint32_t planeIndices[6] = { 0, 1, 2, 2, 3, 0 };
+                for (const OcclusionPlane& occlusionPlane : m_occlusionPlanes)
+                {
+                    if (ShapeIntersection::Overlaps(frustum, occlusionPlane.m_aabb))
+                    {
+                        const Vector4 projectedCorners[4] = {
+                            view.GetWorldToClipMatrix() * Vector4::CreateFromVector3AndFloat(occlusionPlane.m_cornerBL, 1.0f),
+                            view.GetWorldToClipMatrix() * Vector4::CreateFromVector3AndFloat(occlusionPlane.m_cornerTL, 1.0f),
+                            view.GetWorldToClipMatrix() * Vector4::CreateFromVector3AndFloat(occlusionPlane.m_cornerTR, 1.0f),
+                            view.GetWorldToClipMatrix() * Vector4::CreateFromVector3AndFloat(occlusionPlane.m_cornerBR, 1.0f)
+                        };
+                        softwareOcclusionCulling->RenderTriangles(projectedCorners, planeIndices);
+                    }
+                }
+
+                for (const OccluderMesh& occluderMesh : m_occluderMeshes)
+                {
+                    if (ShapeIntersection::Overlaps(frustum, occluderMesh.m_aabb))
+                    {
+                        softwareOcclusionCulling->RenderOccluderMesh(view.GetWorldToClipMatrix(), occluderMesh.m_positions, occluderMesh.m_indices);
+                    }
+                }
+
+                softwareOcclusionCulling->BuildHierarchicalDepth();
+            }
         }
 
         void CullingScene::ProcessCullables(const Scene& scene, View& view, AZ::Job* parentJob, AZ::TaskGraph* taskGraph, AZ::TaskGraphEvent* taskGraphEvent)
@@ -561,11 +638,12 @@ namespace AZ
             AZ::Frustum frustum = Frustum::CreateFromMatrixColumnMajor(worldToClip);
 
             void* maskedOcclusionCulling = nullptr;
-            ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
+            SoftwareOcclusionCulling* softwareOcclusionCulling = nullptr;
+            ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling, softwareOcclusionCulling);
 
             AZStd::shared_ptr<WorkListType> worklist = AZStd::make_shared<WorkListType>();
             worklist->Init();
-            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling, parentJob, taskGraphEvent);
+            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling, softwareOcclusionCulling, parentJob, taskGraphEvent);
             static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
 
             auto nodeVisitorLambda = [worklistData, taskGraph, parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
@@ -650,7 +728,8 @@ namespace AZ
             AZ::Frustum frustum = Frustum::CreateFromMatrixColumnMajor(worldToClip);
 
             void* maskedOcclusionCulling = nullptr;
-            ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling);
+            SoftwareOcclusionCulling* softwareOcclusionCulling = nullptr;
+            ProcessCullablesCommon(scene, view, frustum, maskedOcclusionCulling, softwareOcclusionCulling);
 
             // Note 1: Cannot do unique_ptr here because compilation error (auto-deletes function from lambda which the job code complains about) 
             // Note 2: Having this be a pointer (even a shared pointer) is faster than just having this live on the stack like:
@@ -659,7 +738,7 @@ namespace AZ
             // increases the runtime for this function, which runs on a single thread and spawns other jobs).
             AZStd::shared_ptr<EntryListType> entryList = AZStd::make_shared<EntryListType>();
             entryList->m_entries.reserve(r_numEntriesPerCullingJob);
-            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling, parentJob, nullptr);
+            AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, maskedOcclusionCulling, softwareOcclusionCulling, parentJob, nullptr);
 
             auto nodeVisitorLambda = [worklistData, parentJob, &entryList](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
@@ -751,6 +830,10 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            // only camera views sample the textures at the resolution the object covers on screen
+            const bool reportScreenSpaceSize = r_streamingImageBudgetSolver && (view.GetUsageFlags() & View::UsageCamera);
+            const float screenSpaceSize = approxScreenPercentage * static_cast<float>(static_cast<uint32_t>(r_streamingImageScreenHeight));
+
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
@@ -763,6 +846,14 @@ namespace AZ
                 {
                     view.AddDrawPacket(drawPacket, pos);
                 }
+
+                if (reportScreenSpaceSize)
+                {
+                    for (const Data::Instance<StreamingImage>& streamingImage : lod.m_streamingImages)
+                    {
+                        streamingImage->ReportScreenSpaceSize(screenSpaceSize);
+                    }
+                }
             };
 
             switch (lodData.m_lodConfiguration.m_lodType)
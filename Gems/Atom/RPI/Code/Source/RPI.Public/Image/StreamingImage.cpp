@@ -258,6 +258,18 @@ namespace AZ
             }
         }
         
+        void StreamingImage::ReportScreenSpaceSize(float projectedSizeInPixels)
+        {
+            if (StreamingImageContext* context = m_streamingContext.get())
+            {
+                float currentSize = context->m_screenSpaceSize.load(AZStd::memory_order_relaxed);
+                while (projectedSizeInPixels > currentSize &&
+                    !context->m_screenSpaceSize.compare_exchange_weak(currentSize, projectedSizeInPixels, AZStd::memory_order_relaxed))
+                {
+                }
+            }
+        }
+
         uint16_t StreamingImage::GetResidentMipLevel()
         {
             return static_cast<uint16_t>(m_image->GetResidentMipLevel());
@@ -437,8 +449,18 @@ namespace AZ
                 Data::Asset<ImageMipChainAsset>& mipChainAsset = m_mipChains[mipChainIndex];
                 AZ_Assert(mipChainAsset.Get() == nullptr, "Asset marked as inactive, but has a valid reference.");
 
-                // And we request that the asset be loaded in case it isn't already.
-                mipChainAsset.QueueLoad();
+                // And we request that the asset be loaded in case it isn't already. Streamable images use the priority and
+                // deadline assigned by the streaming controller.
+                Data::AssetLoadParameters loadParameters;
+                if (m_streamingContext)
+                {
+                    loadParameters.m_priority = m_streamingContext->GetLoadPriority();
+                    if (m_streamingContext->GetLoadDeadline() != IO::IStreamerTypes::s_noDeadline)
+                    {
+                        loadParameters.m_deadline = m_streamingContext->GetLoadDeadline();
+                    }
+                }
+                mipChainAsset.QueueLoad(loadParameters);
 
                 // Connect to the AssetBus so we are ready to receive OnAssetReady(), which will call OnMipChainAssetReady().
                 // If the asset happens to already be loaded, OnAssetReady() will be called immediately.
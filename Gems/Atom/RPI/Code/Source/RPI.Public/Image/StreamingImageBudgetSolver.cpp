@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/StreamingImageBudgetSolver.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+
+AZ_DECLARE_BUDGET(RPI);
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            struct MipChainUpgrade
+            {
+                // Priority per byte of the upgrade.
+                float m_score = 0.0f;
+                uint32_t m_requestIndex = 0;
+                uint8_t m_priorityTier = 0;
+
+                bool operator<(const MipChainUpgrade& rhs) const
+                {
+                    if (m_priorityTier != rhs.m_priorityTier)
+                    {
+                        return m_priorityTier < rhs.m_priorityTier;
+                    }
+                    return m_score < rhs.m_score;
+                }
+            };
+        }
+
+        size_t StreamingImageBudgetSolver::Solve(
+            AZStd::span<const StreamingImageBudgetRequest> requests,
+            size_t memoryBudget,
+            AZStd::span<uint16_t> targetMipChains)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+            AZ_Assert(requests.size() == targetMipChains.size(), "Each request requires a target mip chain.");
+
+            const size_t budget = memoryBudget > 0 ? memoryBudget : AZStd::numeric_limits<size_t>::max();
+
+            // Start every image at its tail mip chain, which is always resident.
+            size_t memoryUsed = 0;
+            AZStd::priority_queue<MipChainUpgrade> upgrades;
+
+            const auto queueNextUpgrade = [&requests, &targetMipChains, &upgrades](uint32_t requestIndex)
+            {
+                const StreamingImageBudgetRequest& request = requests[requestIndex];
+                const uint16_t currentMipChain = targetMipChains[requestIndex];
+                if (request.m_priority > 0.0f && currentMipChain > request.m_requestedMipChain)
+                {
+                    const size_t cost = AZStd::max<size_t>(request.m_mipChainSizes[currentMipChain - 1], 1);
+                    upgrades.push({ request.m_priority / static_cast<float>(cost), requestIndex, request.m_priorityTier });
+                }
+            };
+
+            for (uint32_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex)
+            {
+                const StreamingImageBudgetRequest& request = requests[requestIndex];
+                AZ_Assert(!request.m_mipChainSizes.empty(), "Streaming image budget request has no mip chains.");
+
+                const uint16_t tailMipChain = static_cast<uint16_t>(request.m_mipChainSizes.size() - 1);
+                targetMipChains[requestIndex] = tailMipChain;
+                memoryUsed += request.m_mipChainSizes[tailMipChain];
+                queueNextUpgrade(requestIndex);
+            }
+
+            // Grant the upgrade with the best priority per byte. Upgrades that don't fit are dropped, which stops that image
+            // from expanding further, but cheaper upgrades of other images may still fit.
+            while (!upgrades.empty())
+            {
+                const MipChainUpgrade upgrade = upgrades.top();
+                upgrades.pop();
+
+                const StreamingImageBudgetRequest& request = requests[upgrade.m_requestIndex];
+                const uint16_t nextMipChain = targetMipChains[upgrade.m_requestIndex] - 1;
+                const size_t cost = request.m_mipChainSizes[nextMipChain];
+                if (memoryUsed + cost <= budget)
+                {
+                    memoryUsed += cost;
+                    targetMipChains[upgrade.m_requestIndex] = nextMipChain;
+                    queueNextUpgrade(upgrade.m_requestIndex);
+                }
+            }
+
+            return memoryUsed;
+        }
+
+        uint16_t StreamingImageBudgetSolver::CalculateRequestedMipLevel(uint32_t imageWidth, uint16_t mipLevels, float projectedSizeInPixels)
+        {
+            if (mipLevels == 0)
+            {
+                return 0;
+            }
+
+            const uint16_t lowestMip = mipLevels - 1;
+            if (projectedSizeInPixels <= 1.0f)
+            {
+                return lowestMip;
+            }
+
+            // Each mip halves the resolution, so the mip that maps one texel to one pixel is log2(width / pixels).
+            const float mip = AZStd::floor(log2f(static_cast<float>(imageWidth) / projectedSizeInPixels));
+            if (mip <= 0.0f)
+            {
+                return 0;
+            }
+            return AZStd::min(lowestMip, static_cast<uint16_t>(mip));
+        }
+    } // namespace RPI
+} // namespace AZ
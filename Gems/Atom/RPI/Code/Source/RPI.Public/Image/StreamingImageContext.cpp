@@ -8,6 +8,8 @@
 
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 
+#include <AzCore/std/algorithm.h>
+
 namespace AZ
 {
     namespace RPI
@@ -19,12 +21,27 @@ namespace AZ
 
         uint16_t StreamingImageContext::GetTargetMip() const
         {
-            return m_mipLevelTarget;
+            return AZStd::max<uint16_t>(m_mipLevelTarget, m_budgetMipLevelLimit);
         }
 
         size_t StreamingImageContext::GetLastAccessTimestamp() const
         {
             return m_lastAccessTimestamp;
         }
+
+        float StreamingImageContext::GetScreenSpaceSize() const
+        {
+            return m_screenSpaceSize;
+        }
+
+        IO::IStreamerTypes::Priority StreamingImageContext::GetLoadPriority() const
+        {
+            return m_loadPriority;
+        }
+
+        IO::IStreamerTypes::Deadline StreamingImageContext::GetLoadDeadline() const
+        {
+            return m_loadDeadline;
+        }
     }
 }
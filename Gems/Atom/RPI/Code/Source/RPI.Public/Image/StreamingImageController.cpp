@@ -10,7 +10,12 @@
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Time/ITime.h>
 
 AZ_DECLARE_BUDGET(RPI);
@@ -27,6 +32,47 @@ namespace AZ
         #define StreamingDebugOutput(window, ...)
 #endif
 
+        AZ_CVAR(bool, r_streamingImageBudgetSolver, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Assign streaming image mip levels by solving the pool memory budget from the screen-space sizes reported by StreamingImage::ReportScreenSpaceSize. Culling reports them for the images of visible meshes.");
+        AZ_CVAR(uint32_t, r_streamingImageBudgetSolveInterval, 10, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of streaming controller updates between budget solves.");
+
+        namespace
+        {
+            // Images that haven't reported a screen-space size keep their requested mip, but only get memory after visible images.
+            // They all share the same priority, so the solver grants their upgrades cheapest first.
+            constexpr uint8_t ReportedImagePriorityTier = 1;
+            constexpr uint8_t UnreportedImagePriorityTier = 0;
+            constexpr float UnreportedImagePriority = 1.0f;
+
+            // Mip chain loads for the most important images are given short deadlines so IStreamer schedules them first.
+            constexpr float HighPriorityFraction = 0.25f;
+            constexpr float MediumPriorityFraction = 0.75f;
+            constexpr IO::IStreamerTypes::Deadline HighPriorityDeadline = AZStd::chrono::milliseconds(100);
+            constexpr IO::IStreamerTypes::Deadline MediumPriorityDeadline = AZStd::chrono::milliseconds(500);
+
+            void GetMipChainSizes(const StreamingImageAsset& imageAsset, AZStd::fixed_vector<size_t, StreamingImageBudgetRequest::MipChainCountMax>& mipChainSizes)
+            {
+                const RHI::ImageDescriptor& imageDescriptor = imageAsset.GetImageDescriptor();
+                const size_t mipChainCount = AZStd::min(imageAsset.GetMipChainCount(), StreamingImageBudgetRequest::MipChainCountMax);
+
+                mipChainSizes.clear();
+                for (size_t mipChainIndex = 0; mipChainIndex < mipChainCount; ++mipChainIndex)
+                {
+                    size_t mipChainSize = 0;
+                    const size_t mipBegin = imageAsset.GetMipLevel(mipChainIndex);
+                    const size_t mipEnd = mipBegin + imageAsset.GetMipCount(mipChainIndex);
+                    for (size_t mipLevel = mipBegin; mipLevel < mipEnd; ++mipLevel)
+                    {
+                        const RHI::ImageSubresourceLayout layout =
+                            RHI::GetImageSubresourceLayout(imageDescriptor, RHI::ImageSubresource(static_cast<uint16_t>(mipLevel), 0));
+                        mipChainSize += static_cast<size_t>(layout.m_bytesPerImage) * layout.m_size.m_depth * imageDescriptor.m_arraySize;
+                    }
+                    mipChainSizes.push_back(mipChainSize);
+                }
+            }
+        }
+
         AZStd::unique_ptr<StreamingImageController> StreamingImageController::Create(RHI::StreamingImagePool& pool)
         {
             AZStd::unique_ptr<StreamingImageController> controller = AZStd::make_unique<StreamingImageController>();
@@ -136,6 +182,33 @@ namespace AZ
                 }
             }
             
+            // Periodically re-solve the mip levels of all images against the memory budget
+            if (r_streamingImageBudgetSolver)
+            {
+                const uint32_t solveInterval = AZStd::max(static_cast<uint32_t>(r_streamingImageBudgetSolveInterval), 1u);
+                if (!m_budgetSolverActive || m_timestamp % solveInterval == 0)
+                {
+                    SolveMemoryBudget();
+                }
+            }
+            else if (m_budgetSolverActive)
+            {
+                // The solver was disabled; remove its limits so images return to their requested mips.
+                AZStd::lock_guard<AZStd::mutex> lock(m_contextAccessMutex);
+                for (StreamingImageContext& context : m_contexts)
+                {
+                    context.m_budgetMipLevelLimit = 0;
+                    context.m_loadPriority = IO::IStreamerTypes::s_priorityMedium;
+                    context.m_loadDeadline = IO::IStreamerTypes::s_noDeadline;
+                    if (StreamingImage* image = context.TryGetImage())
+                    {
+                        UpdateImageTarget(image);
+                    }
+                }
+                m_budgetSolverActive = false;
+                m_budgetSolvedMemoryUsage = 0;
+            }
+
             // Try to expand if the memory usage is dropping or there are enough free memory
             jobCount = 0;
             if (m_lastLowMemory == 0 || m_lastLowMemory > GetPoolMemoryUsage())
@@ -170,8 +243,13 @@ namespace AZ
             context->m_mipLevelTarget = mipLevelTarget;
             context->m_lastAccessTimestamp = m_timestamp;
 
+            UpdateImageTarget(image);
+        }
+
+        void StreamingImageController::UpdateImageTarget(StreamingImage* image)
+        {
             // update image priority and re-insert the image
-            if (!context->m_queuedForMipExpand)
+            if (!image->m_streamingContext->m_queuedForMipExpand)
             {
                 AZStd::lock_guard<AZStd::mutex> lock(m_imageListAccessMutex);
                 EvictUnusedMips(image);
@@ -402,6 +480,119 @@ namespace AZ
             return evicted;
         }
 
+        size_t StreamingImageController::GetBudgetSolvedMemoryUsage() const
+        {
+            return m_budgetSolvedMemoryUsage;
+        }
+
+        void StreamingImageController::SolveMemoryBudget()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_contextAccessMutex);
+
+            m_budgetImages.clear();
+
+            // The requests of the last solve are overwritten in place rather than cleared and constructed again.
+            size_t requestCount = 0;
+            for (StreamingImageContext& context : m_contexts)
+            {
+                StreamingImage* image = context.TryGetImage();
+                if (!image || !image->IsStreamable())
+                {
+                    continue;
+                }
+
+                if (requestCount == m_budgetRequests.size())
+                {
+                    m_budgetRequests.emplace_back();
+                }
+
+                const StreamingImageAsset& imageAsset = *image->m_imageAsset;
+                StreamingImageBudgetRequest& request = m_budgetRequests[requestCount++];
+                GetMipChainSizes(imageAsset, request.m_mipChainSizes);
+
+                // Start the next interval from zero, so images that go out of view lose their priority.
+                const float screenSpaceSize = context.m_screenSpaceSize.exchange(0.0f);
+                const uint16_t requestedMip = context.m_mipLevelTarget;
+                if (screenSpaceSize > 0.0f)
+                {
+                    const RHI::ImageDescriptor& imageDescriptor = imageAsset.GetImageDescriptor();
+                    const uint16_t screenSpaceMip = StreamingImageBudgetSolver::CalculateRequestedMipLevel(
+                        AZStd::max(imageDescriptor.m_size.m_width, imageDescriptor.m_size.m_height), imageDescriptor.m_mipLevels, screenSpaceSize);
+                    request.m_requestedMipChain = static_cast<uint16_t>(imageAsset.GetMipChainIndex(AZStd::max(requestedMip, screenSpaceMip)));
+                    request.m_priority = screenSpaceSize * screenSpaceSize;
+                    request.m_priorityTier = ReportedImagePriorityTier;
+                }
+                else
+                {
+                    request.m_requestedMipChain = static_cast<uint16_t>(imageAsset.GetMipChainIndex(requestedMip));
+                    request.m_priority = UnreportedImagePriority;
+                    request.m_priorityTier = UnreportedImagePriorityTier;
+                }
+                request.m_requestedMipChain = AZStd::min(request.m_requestedMipChain, static_cast<uint16_t>(request.m_mipChainSizes.size() - 1));
+
+                m_budgetImages.push_back(image);
+            }
+            m_budgetRequests.resize(requestCount);
+
+            m_budgetTargetMipChains.resize(m_budgetRequests.size());
+            const size_t budget = m_pool->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device).m_budgetInBytes;
+            m_budgetSolvedMemoryUsage = StreamingImageBudgetSolver::Solve(m_budgetRequests, budget, m_budgetTargetMipChains);
+
+            // Rank the images by priority to assign streamer priorities and deadlines to their mip chain loads.
+            AZStd::vector<uint32_t>& rankedImages = m_budgetRankedImages;
+            rankedImages.resize(m_budgetImages.size());
+            for (uint32_t i = 0; i < rankedImages.size(); ++i)
+            {
+                rankedImages[i] = i;
+            }
+            AZStd::sort(rankedImages.begin(), rankedImages.end(), [this](uint32_t lhs, uint32_t rhs)
+            {
+                const StreamingImageBudgetRequest& lhsRequest = m_budgetRequests[lhs];
+                const StreamingImageBudgetRequest& rhsRequest = m_budgetRequests[rhs];
+                if (lhsRequest.m_priorityTier != rhsRequest.m_priorityTier)
+                {
+                    return lhsRequest.m_priorityTier > rhsRequest.m_priorityTier;
+                }
+                return lhsRequest.m_priority > rhsRequest.m_priority;
+            });
+
+            for (size_t rank = 0; rank < rankedImages.size(); ++rank)
+            {
+                const uint32_t imageIndex = rankedImages[rank];
+                StreamingImage* image = m_budgetImages[imageIndex];
+                StreamingImageContext* context = image->m_streamingContext.get();
+
+                const float rankFraction = static_cast<float>(rank) / static_cast<float>(rankedImages.size());
+                if (rankFraction < HighPriorityFraction)
+                {
+                    context->m_loadPriority = IO::IStreamerTypes::s_priorityHigh;
+                    context->m_loadDeadline = HighPriorityDeadline;
+                }
+                else if (rankFraction < MediumPriorityFraction)
+                {
+                    context->m_loadPriority = IO::IStreamerTypes::s_priorityMedium;
+                    context->m_loadDeadline = MediumPriorityDeadline;
+                }
+                else
+                {
+                    context->m_loadPriority = IO::IStreamerTypes::s_priorityLow;
+                    context->m_loadDeadline = IO::IStreamerTypes::s_noDeadline;
+                }
+
+                const uint16_t mipLevelLimit = static_cast<uint16_t>(image->m_imageAsset->GetMipLevel(m_budgetTargetMipChains[imageIndex]));
+                if (context->m_budgetMipLevelLimit.exchange(mipLevelLimit) != mipLevelLimit)
+                {
+                    UpdateImageTarget(image);
+                }
+            }
+
+            m_budgetSolverActive = true;
+
+            StreamingDebugOutput("StreamingImageController", "Budget solve assigned %zu bytes to %zu images\n", m_budgetSolvedMemoryUsage, m_budgetImages.size());
+        }
+
         size_t StreamingImageController::GetPoolMemoryUsage()
         {
             size_t totalResident = m_pool->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device).m_totalResidentInBytes.load();
@@ -8,6 +8,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Reflect/Image/AttachmentImageAsset.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -399,6 +400,32 @@ namespace AZ
             return false;
         }
 
+        bool Material::QueueCompile()
+        {
+            if (!NeedsCompile())
+            {
+                return true;
+            }
+
+            MaterialSystem* materialSystem = MaterialSystem::Get();
+            if (!materialSystem)
+            {
+                return Compile();
+            }
+
+            if (!m_isQueuedForCompile.exchange(true))
+            {
+                materialSystem->QueueMaterialCompile(this);
+            }
+
+            return true;
+        }
+
+        bool Material::IsQueuedForCompile() const
+        {
+            return m_isQueuedForCompile;
+        }
+
         Material::ChangeId Material::GetCurrentChangeId() const
         {
             return m_currentChangeId;
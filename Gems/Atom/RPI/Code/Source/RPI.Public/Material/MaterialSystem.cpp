@@ -16,10 +16,27 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(uint32_t, r_materialCompileBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of queued materials compiled per frame. 0 means no limit.");
+        AZ_CVAR(bool, r_materialCompileInParallel, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Compile queued materials of different material types in parallel on the job system.");
+
+        MaterialSystem* MaterialSystem::Get()
+        {
+            return Interface<MaterialSystem>::Get();
+        }
+
         void MaterialSystem::Reflect(AZ::ReflectContext* context)
         {
             MaterialPropertyValue::Reflect(context);
@@ -46,12 +63,115 @@ namespace AZ
                 return Material::CreateInternal(*(azrtti_cast<MaterialAsset*>(materialAsset)));
             };
             Data::InstanceDatabase<Material>::Create(azrtti_typeid<MaterialAsset>(), handler);
+
+            Interface<MaterialSystem>::Register(this);
         }
 
         void MaterialSystem::Shutdown()
         {
+            Interface<MaterialSystem>::Unregister(this);
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queuedMaterialsMutex);
+                m_queuedMaterials.clear();
+                m_queuedMaterialCount = 0;
+            }
+
             Data::InstanceDatabase<Material>::Destroy();
         }
 
+        void MaterialSystem::QueueMaterialCompile(const Data::Instance<Material>& material)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_queuedMaterialsMutex);
+            m_queuedMaterials[material->GetAsset()->GetMaterialTypeAsset().GetId()].push_back(material);
+            ++m_queuedMaterialCount;
+        }
+
+        size_t MaterialSystem::GetQueuedMaterialCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_queuedMaterialsMutex);
+            return m_queuedMaterialCount;
+        }
+
+        void MaterialSystem::CompileQueuedMaterials()
+        {
+            AZ_PROFILE_SCOPE(RPI, "MaterialSystem: CompileQueuedMaterials");
+
+            // Take the batches that fit within the budget. Anything over budget stays queued for the next frame.
+            AZStd::vector<MaterialBatch> batches;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queuedMaterialsMutex);
+                if (m_queuedMaterialCount == 0)
+                {
+                    return;
+                }
+
+                size_t budget = r_materialCompileBudget > 0 ? static_cast<uint32_t>(r_materialCompileBudget) : m_queuedMaterialCount;
+                batches.reserve(m_queuedMaterials.size());
+
+                for (auto it = m_queuedMaterials.begin(); it != m_queuedMaterials.end() && budget > 0;)
+                {
+                    MaterialBatch& queuedBatch = it->second;
+                    if (queuedBatch.size() <= budget)
+                    {
+                        budget -= queuedBatch.size();
+                        m_queuedMaterialCount -= queuedBatch.size();
+                        batches.emplace_back(AZStd::move(queuedBatch));
+                        it = m_queuedMaterials.erase(it);
+                    }
+                    else
+                    {
+                        batches.emplace_back(queuedBatch.begin(), queuedBatch.begin() + budget);
+                        queuedBatch.erase(queuedBatch.begin(), queuedBatch.begin() + budget);
+                        m_queuedMaterialCount -= budget;
+                        budget = 0;
+                    }
+                }
+            }
+
+            // Materials that could not compile this frame (their SRG is already queued) are collected per batch and re-queued afterwards.
+            AZStd::vector<MaterialBatch> deferredBatches(batches.size());
+
+            const auto compileBatch = [&batches, &deferredBatches](size_t batchIndex)
+            {
+                AZ_PROFILE_SCOPE(RPI, "MaterialSystem: CompileMaterialBatch");
+                for (Data::Instance<Material>& material : batches[batchIndex])
+                {
+                    material->m_isQueuedForCompile = false;
+                    if (!material->Compile())
+                    {
+                        deferredBatches[batchIndex].push_back(AZStd::move(material));
+                    }
+                }
+            };
+
+            if (r_materialCompileInParallel && batches.size() > 1 && AZ::JobContext::GetGlobalContext())
+            {
+                AZ::JobCompletion jobCompletion;
+                for (size_t batchIndex = 0; batchIndex < batches.size(); ++batchIndex)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([&compileBatch, batchIndex]() { compileBatch(batchIndex); }, true, nullptr);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (size_t batchIndex = 0; batchIndex < batches.size(); ++batchIndex)
+                {
+                    compileBatch(batchIndex);
+                }
+            }
+
+            for (MaterialBatch& deferredBatch : deferredBatches)
+            {
+                for (Data::Instance<Material>& material : deferredBatch)
+                {
+                    material->QueueCompile();
+                }
+            }
+        }
+
     } // namespace RPI
 } // namespace AZ
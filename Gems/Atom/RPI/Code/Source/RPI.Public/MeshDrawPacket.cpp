@@ -29,6 +29,14 @@ namespace AZ
             "(For Testing) Forces usage of root shader variant in the mesh draw packet level, ignoring any other shader variants that may exist."
         );
 
+        AZ_CVAR(bool,
+            r_compileMeshPipelineStatesAsync,
+            true,
+            [](const bool&) { AZ::Interface<AZ::IConsole>::Get()->PerformCommand("MeshFeatureProcessor.ForceRebuildDrawPackets"); },
+            ConsoleFunctorFlags::Null,
+            "If enabled, mesh draw items compile the pipeline state of their shader variant in the background and draw with the root shader variant until it is ready."
+        );
+
         MeshDrawPacket::MeshDrawPacket(
             ModelLod& modelLod,
             size_t modelLodMeshIndex,
@@ -164,9 +172,28 @@ namespace AZ
                 return true;
             }
 
+            // Swap the fallback pipeline states for the compiled ones.
+            if (!m_pendingPipelineStates.empty() && ArePendingPipelineStatesCompiled())
+            {
+                DoUpdate(parentScene);
+                return true;
+            }
+
             return false;
         }
 
+        bool MeshDrawPacket::ArePendingPipelineStatesCompiled() const
+        {
+            for (const PendingPipelineState& pending : m_pendingPipelineStates)
+            {
+                if (!pending.m_shader->AcquirePipelineStateAsync(pending.m_descriptor, nullptr))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         bool MeshDrawPacket::DoUpdate(const Scene& parentScene)
         {
             const ModelLod::Mesh& mesh = m_modelLod->GetMeshes()[m_modelLodMeshIndex];
@@ -191,6 +218,7 @@ namespace AZ
             // if DoUpdate() fails it won't modify any member data.
             MeshDrawPacket::ShaderList shaderList;
             shaderList.reserve(m_activeShaders.size());
+            AZStd::vector<PendingPipelineState> pendingPipelineStates;
 
             // We have to keep a list of these outside the loops that collect all the shaders because the DrawPacketBuilder
             // keeps pointers to StreamBufferViews until DrawPacketBuilder::End() is called. And we use a fixed_vector to guarantee
@@ -315,7 +343,35 @@ namespace AZ
 
                 parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
 
-                const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                // Compiling a shader variant's pipeline state can take long enough to cause a hitch. When the draw srg holds the
+                // shader variant fallback key, the root variant renders the same result until the compile finishes. Shaders
+                // without the fallback key can only render with the variant itself, so those are compiled synchronously.
+                const bool canFallBackToRootVariant = drawSrg && drawSrg->HasShaderVariantKeyFallbackEntry();
+
+                const RHI::PipelineState* pipelineState = nullptr;
+                if (r_compileMeshPipelineStatesAsync && !variant.IsRootVariant() && canFallBackToRootVariant)
+                {
+                    pipelineState = shader->AcquirePipelineStateAsync(pipelineStateDescriptor, nullptr);
+                    if (!pipelineState)
+                    {
+                        pendingPipelineStates.push_back({ shader, pipelineStateDescriptor });
+
+                        RHI::PipelineStateDescriptorForDraw rootVariantDescriptor;
+                        shader->GetRootVariant().ConfigurePipelineState(rootVariantDescriptor);
+
+                        RHI::PipelineStateDescriptorForDraw fallbackDescriptor = pipelineStateDescriptor;
+                        fallbackDescriptor.m_pipelineLayoutDescriptor = rootVariantDescriptor.m_pipelineLayoutDescriptor;
+                        fallbackDescriptor.m_vertexFunction = rootVariantDescriptor.m_vertexFunction;
+                        fallbackDescriptor.m_tessellationFunction = rootVariantDescriptor.m_tessellationFunction;
+                        fallbackDescriptor.m_fragmentFunction = rootVariantDescriptor.m_fragmentFunction;
+                        pipelineState = shader->AcquirePipelineState(fallbackDescriptor);
+                    }
+                }
+                else
+                {
+                    pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                }
+
                 if (!pipelineState)
                 {
                     AZ_Error("MeshDrawPacket", false, "Shader '%s'. Failed to acquire default pipeline state", shaderItem.GetShaderAsset()->GetName().GetCStr());
@@ -367,6 +423,7 @@ namespace AZ
             if (m_drawPacket)
             {
                 m_activeShaders = shaderList;
+                m_pendingPipelineStates = AZStd::move(pendingPipelineStates);
                 m_materialSrg = m_material->GetRHIShaderResourceGroup();
                 return true;
             }
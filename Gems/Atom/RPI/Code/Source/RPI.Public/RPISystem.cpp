@@ -294,6 +294,10 @@ namespace AZ
 
         void RPISystem::RenderTick()
         {
+            // Compile materials whose properties changed this frame before their draw packets are collected.
+            // This also runs with the null renderer so the queue doesn't grow unbounded.
+            m_materialSystem.CompileQueuedMaterials();
+
             if (!m_systemAssetsInitialized || IsNullRenderer())
             {
                 m_dynamicDraw.FrameEnd();
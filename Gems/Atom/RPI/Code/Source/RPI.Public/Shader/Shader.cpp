@@ -512,6 +512,12 @@ namespace AZ
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor);
         }
 
+        const RHI::PipelineState* Shader::AcquirePipelineStateAsync(
+            const RHI::PipelineStateDescriptor& descriptor, const RHI::PipelineState* fallbackPipelineState) const
+        {
+            return m_pipelineStateCache->AcquirePipelineStateAsync(m_pipelineLibraryHandle, descriptor, fallbackPipelineState);
+        }
+
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupLayout(shaderResourceGroupName, m_supervariantIndex);
@@ -6,9 +6,13 @@
  *
  */
 #include <Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h>
+#include <Atom/RPI.Public/Base.h>
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 
 #include <Atom/RHI/Factory.h>
 
@@ -18,6 +22,8 @@ namespace AZ
     {
         AZ_CVAR(uint32_t, r_ShaderVariantAsyncLoader_ServiceLoopDelayOverride_ms, 0, nullptr, ConsoleFunctorFlags::Null,
             "Override the delay between iterations of checking for shader variant assets. 0 means use the default value (1000ms).");
+        AZ_CVAR(uint32_t, r_ShaderVariantAsyncLoader_JobBatchSize, 8, nullptr, ConsoleFunctorFlags::Null,
+            "Number of pending shader variant requests processed by each job of the ShaderVariantAsyncLoader.");
 
         void ShaderVariantAsyncLoader::Init()
         {
@@ -39,22 +45,60 @@ namespace AZ
             AZStd::unordered_set<ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId> newShaderVariantPendingRequests;
             AZStd::unordered_set<Data::AssetId> shaderVariantTreePendingRequests;
             AZStd::unordered_set<Data::AssetId> shaderVariantPendingRequests;
+
+            // Scratch storage for processing the pending requests in parallel.
+            struct ResolvedVariant
+            {
+                bool m_isTreeReady = false;
+                Data::AssetId m_shaderVariantAssetId;
+            };
+            struct LoadResult
+            {
+                bool m_isQueued = false;
+                Data::AssetId m_assetToConnect;
+            };
+            AZStd::vector<TupleShaderAssetAndShaderVariantId> tuples;
+            AZStd::vector<ResolvedVariant> resolvedVariants;
+            AZStd::vector<Data::AssetId> assetIds;
+            AZStd::vector<LoadResult> loadResults;
+
+            // Connects to the AssetBus for the assets that were queued for loading and removes them from the pending requests.
+            const auto applyLoadResults = [this, &assetIds, &loadResults](AZStd::unordered_set<Data::AssetId>& pendingRequests)
+            {
+                for (size_t i = 0; i < assetIds.size(); ++i)
+                {
+                    const LoadResult& loadResult = loadResults[i];
+                    if (loadResult.m_assetToConnect.IsValid())
+                    {
+                        Data::AssetBus::MultiHandler::BusDisconnect(loadResult.m_assetToConnect);
+                        Data::AssetBus::MultiHandler::BusConnect(loadResult.m_assetToConnect);
+                    }
+                    if (loadResult.m_isQueued)
+                    {
+                        pendingRequests.erase(assetIds[i]);
+                    }
+                }
+            };
+
             while (true)
             {
-                //We'll wait here until there's work to do or this service has been shutdown.
+                // We'll wait here until there's work to do or this service has been shutdown. Requests that couldn't be
+                // serviced yet are retried periodically.
+                const bool hasPendingRequests = !newShaderVariantPendingRequests.empty() ||
+                    !shaderVariantTreePendingRequests.empty() ||
+                    !shaderVariantPendingRequests.empty();
+                if (hasPendingRequests)
                 {
-                    AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                    m_workCondition.wait(lock, [&]
-                        {
-                            return m_isServiceShutdown.load() ||
-                                !m_newShaderVariantPendingRequests.empty() ||
-                                !m_shaderVariantTreePendingRequests.empty() ||
-                                !m_shaderVariantPendingRequests.empty() ||
-                                !newShaderVariantPendingRequests.empty() ||
-                                !shaderVariantTreePendingRequests.empty() ||
-                                !shaderVariantPendingRequests.empty();
-                        }
-                    );
+                    AZStd::chrono::milliseconds delay{1000};
+                    if (r_ShaderVariantAsyncLoader_ServiceLoopDelayOverride_ms)
+                    {
+                        delay = AZStd::chrono::milliseconds{r_ShaderVariantAsyncLoader_ServiceLoopDelayOverride_ms};
+                    }
+                    m_workSemaphore.try_acquire_for(delay);
+                }
+                else
+                {
+                    m_workSemaphore.acquire();
                 }
 
                 if (m_isServiceShutdown.load())
@@ -62,95 +106,116 @@ namespace AZ
                     break;
                 }
 
-                {
-                    //Move pending requests to the local lists.
-                    AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-
-                    AZStd::for_each(
-                        m_newShaderVariantPendingRequests.begin(), m_newShaderVariantPendingRequests.end(),
-                        [&](const ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId& tuple) {
-                            newShaderVariantPendingRequests.insert(tuple);
-                        });
-                    m_newShaderVariantPendingRequests.clear();
-
-                    AZStd::for_each(m_shaderVariantTreePendingRequests.begin(), m_shaderVariantTreePendingRequests.end(),
-                        [&](const Data::AssetId& assetId)
-                        {
-                            shaderVariantTreePendingRequests.insert(assetId);
-                        });
-                    m_shaderVariantTreePendingRequests.clear();
-
-                    AZStd::for_each(m_shaderVariantPendingRequests.begin(), m_shaderVariantPendingRequests.end(),
-                        [&](const Data::AssetId& assetId)
-                        {
-                            shaderVariantPendingRequests.insert(assetId);
-                        });
-                    m_shaderVariantPendingRequests.clear();
-                }
+                //Move pending requests to the local lists.
+                m_newShaderVariantPendingRequests.Consume([&](const TupleShaderAssetAndShaderVariantId& tuple)
+                    {
+                        newShaderVariantPendingRequests.insert(tuple);
+                    });
+                m_shaderVariantTreePendingRequests.Consume([&](const Data::AssetId& assetId)
+                    {
+                        shaderVariantTreePendingRequests.insert(assetId);
+                    });
+                m_shaderVariantPendingRequests.Consume([&](const Data::AssetId& assetId)
+                    {
+                        shaderVariantPendingRequests.insert(assetId);
+                    });
 
                 // Time to work hard.
-                auto tupleItor = newShaderVariantPendingRequests.begin();
-                while (tupleItor != newShaderVariantPendingRequests.end())
-                {
-                    auto shaderVariantTreeAsset = GetShaderVariantTreeAsset(tupleItor->m_shaderAsset.GetId());
-                    if (shaderVariantTreeAsset)
+                // Find the stable id of each requested variant in its shader variant tree.
+                tuples.assign(newShaderVariantPendingRequests.begin(), newShaderVariantPendingRequests.end());
+                resolvedVariants.clear();
+                resolvedVariants.resize(tuples.size());
+                ForEachInParallel(tuples.size(), [this, &tuples, &resolvedVariants](size_t index)
                     {
+                        const TupleShaderAssetAndShaderVariantId& tuple = tuples[index];
+                        auto shaderVariantTreeAsset = GetShaderVariantTreeAsset(tuple.m_shaderAsset.GetId());
+                        if (!shaderVariantTreeAsset)
+                        {
+                            return;
+                        }
+
                         AZ_Assert(shaderVariantTreeAsset.IsReady(), "shaderVariantTreeAsset is not ready!");
+                        resolvedVariants[index].m_isTreeReady = true;
+
                         // Get the stableId from the variant tree.
                         auto searchResult = shaderVariantTreeAsset->FindVariantStableId(
-                            tupleItor->m_shaderAsset->GetShaderOptionGroupLayout(), tupleItor->m_shaderVariantId);
-                        if (searchResult.IsRoot())
+                            tuple.m_shaderAsset->GetShaderOptionGroupLayout(), tuple.m_shaderVariantId);
+                        if (!searchResult.IsRoot())
                         {
-                            tupleItor = newShaderVariantPendingRequests.erase(tupleItor);
-                            continue;
+                            uint32_t shaderVariantProductSubId = ShaderVariantAsset::MakeAssetProductSubId(
+                                RHI::Factory::Get().GetAPIUniqueIndex(), tuple.m_supervariantIndex.GetIndex(), searchResult.GetStableId());
+                            resolvedVariants[index].m_shaderVariantAssetId = Data::AssetId(shaderVariantTreeAsset.GetId().m_guid, shaderVariantProductSubId);
                         }
+                    });
 
-                        uint32_t shaderVariantProductSubId = ShaderVariantAsset::MakeAssetProductSubId(
-                            RHI::Factory::Get().GetAPIUniqueIndex(), tupleItor->m_supervariantIndex.GetIndex(), searchResult.GetStableId());
-                        Data::AssetId shaderVariantAssetId(shaderVariantTreeAsset.GetId().m_guid, shaderVariantProductSubId);
-                        shaderVariantPendingRequests.insert(shaderVariantAssetId);
-                        tupleItor = newShaderVariantPendingRequests.erase(tupleItor);
-                        continue;
-                    }
-                    // If we are here the shaderVariantTreeAsset is not ready, but maybe it is already queued for loading,
-                    // but we try to queue it anyways.
-                    QueueShaderVariantTreeForLoading(*tupleItor, shaderVariantTreePendingRequests);
-                    tupleItor++;
-                }
-
-
-                auto variantTreeItor = shaderVariantTreePendingRequests.begin();
-                while (variantTreeItor != shaderVariantTreePendingRequests.end())
+                for (size_t i = 0; i < tuples.size(); ++i)
                 {
-                    if (TryToLoadShaderVariantTreeAsset(*variantTreeItor))
+                    const ResolvedVariant& resolvedVariant = resolvedVariants[i];
+                    if (resolvedVariant.m_isTreeReady)
                     {
-                        variantTreeItor = shaderVariantTreePendingRequests.erase(variantTreeItor);
+                        if (resolvedVariant.m_shaderVariantAssetId.IsValid())
+                        {
+                            shaderVariantPendingRequests.insert(resolvedVariant.m_shaderVariantAssetId);
+                        }
+                        newShaderVariantPendingRequests.erase(tuples[i]);
                     }
                     else
                     {
-                        variantTreeItor++;
+                        // If we are here the shaderVariantTreeAsset is not ready, but maybe it is already queued for loading,
+                        // but we try to queue it anyways.
+                        QueueShaderVariantTreeForLoading(tuples[i], shaderVariantTreePendingRequests);
                     }
                 }
 
-                auto variantItor = shaderVariantPendingRequests.begin();
-                while (variantItor != shaderVariantPendingRequests.end())
-                {
-                    if (TryToLoadShaderVariantAsset(*variantItor))
+                assetIds.assign(shaderVariantTreePendingRequests.begin(), shaderVariantTreePendingRequests.end());
+                loadResults.clear();
+                loadResults.resize(assetIds.size());
+                ForEachInParallel(assetIds.size(), [this, &assetIds, &loadResults](size_t index)
                     {
-                        variantItor = shaderVariantPendingRequests.erase(variantItor);
-                    }
-                    else
+                        loadResults[index].m_isQueued = TryToLoadShaderVariantTreeAsset(assetIds[index], loadResults[index].m_assetToConnect);
+                    });
+                applyLoadResults(shaderVariantTreePendingRequests);
+
+                assetIds.assign(shaderVariantPendingRequests.begin(), shaderVariantPendingRequests.end());
+                loadResults.clear();
+                loadResults.resize(assetIds.size());
+                ForEachInParallel(assetIds.size(), [this, &assetIds, &loadResults](size_t index)
                     {
-                        variantItor++;
-                    }
-                }
+                        loadResults[index].m_isQueued = TryToLoadShaderVariantAsset(assetIds[index], loadResults[index].m_assetToConnect);
+                    });
+                applyLoadResults(shaderVariantPendingRequests);
+            }
+        }
+
+        void ShaderVariantAsyncLoader::ForEachInParallel(size_t count, const AZStd::function<void(size_t)>& function)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
 
-                AZStd::chrono::milliseconds delay{1000};
-                if (r_ShaderVariantAsyncLoader_ServiceLoopDelayOverride_ms)
+            const size_t batchSize = AZStd::max<size_t>(r_ShaderVariantAsyncLoader_JobBatchSize, 1);
+            if (count > batchSize && AZ::JobContext::GetGlobalContext())
+            {
+                AZ::JobCompletion jobCompletion;
+                for (size_t batchBegin = 0; batchBegin < count; batchBegin += batchSize)
+                {
+                    const size_t batchEnd = AZStd::min(batchBegin + batchSize, count);
+                    AZ::Job* job = AZ::CreateJobFunction([&function, batchBegin, batchEnd]()
+                        {
+                            for (size_t index = batchBegin; index < batchEnd; ++index)
+                            {
+                                function(index);
+                            }
+                        }, true, nullptr);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (size_t index = 0; index < count; ++index)
                 {
-                    delay = AZStd::chrono::milliseconds{r_ShaderVariantAsyncLoader_ServiceLoopDelayOverride_ms};
+                    function(index);
                 }
-                AZStd::this_thread::sleep_for(delay);
             }
         }
 
@@ -161,18 +226,16 @@ namespace AZ
                 return;
             }
 
-            {
-                AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                m_isServiceShutdown.store(true);
-            }
-
-            m_workCondition.notify_one();
+            m_isServiceShutdown.store(true);
+            m_workSemaphore.release();
             m_serviceThread.join();
             Data::AssetBus::MultiHandler::BusDisconnect();
 
-            m_newShaderVariantPendingRequests.clear();
-            m_shaderVariantTreePendingRequests.clear();
-            m_shaderVariantPendingRequests.clear();
+            m_newShaderVariantPendingRequests.Consume([](const TupleShaderAssetAndShaderVariantId&) {});
+            m_shaderVariantTreePendingRequests.Consume([](const Data::AssetId&) {});
+            m_shaderVariantPendingRequests.Consume([](const Data::AssetId&) {});
+
+            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
             m_shaderVariantData.clear();
             m_shaderAssetIdToShaderVariantTreeAssetId.clear();
         }
@@ -188,12 +251,11 @@ namespace AZ
                 return false;
             }
 
+            TupleShaderAssetAndShaderVariantId tuple = {shaderAsset, shaderVariantId, supervariantIndex};
+            if (m_newShaderVariantPendingRequests.Push(tuple))
             {
-                AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                TupleShaderAssetAndShaderVariantId tuple = {shaderAsset, shaderVariantId, supervariantIndex};
-                m_newShaderVariantPendingRequests.push_back(tuple);
+                m_workSemaphore.release();
             }
-            m_workCondition.notify_one();
             return true;
         }
 
@@ -210,11 +272,10 @@ namespace AZ
             uint32_t shaderVariantProductSubId =
                 ShaderVariantAsset::MakeAssetProductSubId(RHI::Factory::Get().GetAPIUniqueIndex(), supervariantIndex.GetIndex(), variantStableId);
             Data::AssetId shaderVariantAssetId(shaderVariantTreeAssetId.m_guid, shaderVariantProductSubId);
+            if (m_shaderVariantPendingRequests.Push(shaderVariantAssetId))
             {
-                AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                m_shaderVariantPendingRequests.push_back(shaderVariantAssetId);
+                m_workSemaphore.release();
             }
-            m_workCondition.notify_one();
             return true;
         }
 
@@ -225,11 +286,10 @@ namespace AZ
                 return false;
             }
 
+            if (m_shaderVariantTreePendingRequests.Push(shaderAssetId))
             {
-                AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                m_shaderVariantTreePendingRequests.push_back(shaderAssetId);
+                m_workSemaphore.release();
             }
-            m_workCondition.notify_one();
             return true;
         }
 
@@ -269,7 +329,7 @@ namespace AZ
 
         Data::Asset<ShaderVariantTreeAsset> ShaderVariantAsyncLoader::GetShaderVariantTreeAsset(const Data::AssetId& shaderAssetId)
         {
-            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+            AZStd::shared_lock<decltype(m_mutex)> lock(m_mutex);
             auto assetIdFindIt = m_shaderAssetIdToShaderVariantTreeAssetId.find(shaderAssetId);
             if (assetIdFindIt == m_shaderAssetIdToShaderVariantTreeAssetId.end())
             {
@@ -298,20 +358,23 @@ namespace AZ
                 ShaderVariantAsset::MakeAssetProductSubId(RHI::Factory::Get().GetAPIUniqueIndex(), supervariantIndex.GetIndex(), variantStableId);
             Data::AssetId shaderVariantAssetId(shaderVariantTreeAssetId.m_guid, shaderVariantProductSubId);
 
-            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-            auto findIt = m_shaderVariantData.find(shaderVariantTreeAssetId);
-            if (findIt == m_shaderVariantData.end())
-            {
-                return {};
-            }
-            ShaderVariantCollection& shaderVariantCollection = findIt->second;
-            auto& shaderVariantsMap = shaderVariantCollection.m_shaderVariantsMap;
-            auto variantFindIt = shaderVariantsMap.find(shaderVariantAssetId);
-            if (variantFindIt == shaderVariantsMap.end())
+            Data::Asset<ShaderVariantAsset> shaderVariantAsset;
             {
-                return {};
+                AZStd::shared_lock<decltype(m_mutex)> lock(m_mutex);
+                auto findIt = m_shaderVariantData.find(shaderVariantTreeAssetId);
+                if (findIt == m_shaderVariantData.end())
+                {
+                    return {};
+                }
+                const auto& shaderVariantsMap = findIt->second.m_shaderVariantsMap;
+                auto variantFindIt = shaderVariantsMap.find(shaderVariantAssetId);
+                if (variantFindIt == shaderVariantsMap.end())
+                {
+                    return {};
+                }
+                shaderVariantAsset = variantFindIt->second;
             }
-            Data::Asset<ShaderVariantAsset> shaderVariantAsset = variantFindIt->second;
+
             if (shaderVariantAsset.IsReady())
             {
                 Data::Asset<ShaderVariantAsset> registeredShaderVariantAsset =
@@ -322,7 +385,12 @@ namespace AZ
                     // is changed to remove a particular variant. Since it should no longer be available for use, remove it from the local map.
                     // Note that if we don't handle this special case, the AssetManager will fail to report OnAssetReady if/when this asset appears
                     // again, which might be a bug in the asset system.
-                    shaderVariantsMap.erase(variantFindIt);
+                    AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                    auto findIt = m_shaderVariantData.find(shaderVariantTreeAssetId);
+                    if (findIt != m_shaderVariantData.end())
+                    {
+                        findIt->second.m_shaderVariantsMap.erase(shaderVariantAssetId);
+                    }
                     return {};
                 }
 
@@ -541,7 +609,7 @@ namespace AZ
             shaderVariantTreePendingRequests.insert(shaderAssetId);
         }
 
-        bool ShaderVariantAsyncLoader::TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId)
+        bool ShaderVariantAsyncLoader::TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId, Data::AssetId& assetToConnect)
         {
             Data::AssetId shaderVariantTreeAssetId = ShaderVariantTreeAsset::GetShaderVariantTreeAssetIdFromShaderAssetId(shaderAssetId);
             if (!shaderVariantTreeAssetId.IsValid())
@@ -572,8 +640,6 @@ namespace AZ
                 return true;
             }
 
-            Data::AssetBus::MultiHandler::BusDisconnect(shaderVariantTreeAssetId);
-
             //Let's queue the asset for loading.
             shaderVariantTreeAsset = Data::AssetManager::Instance().GetAsset<AZ::RPI::ShaderVariantTreeAsset>(shaderVariantTreeAssetId, AZ::Data::AssetLoadBehavior::QueueLoad);
             if (shaderVariantTreeAsset.IsError())
@@ -602,11 +668,11 @@ namespace AZ
                 }
             }
 
-            Data::AssetBus::MultiHandler::BusConnect(shaderVariantTreeAssetId);
+            assetToConnect = shaderVariantTreeAssetId;
             return true;
         }
 
-        bool ShaderVariantAsyncLoader::TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId)
+        bool ShaderVariantAsyncLoader::TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId, Data::AssetId& assetToConnect)
         {
             // Will be used to address the notification bus.
             Data::AssetId shaderAssetId;
@@ -645,8 +711,6 @@ namespace AZ
                 return true;
             }
 
-            Data::AssetBus::MultiHandler::BusDisconnect(shaderVariantAssetId);
-
             // Make sure the asset actually exists
             Data::AssetInfo assetInfo;
             Data::AssetCatalogRequestBus::BroadcastResult(assetInfo, &Data::AssetCatalogRequestBus::Events::GetAssetInfoById, shaderVariantAssetId);
@@ -681,7 +745,7 @@ namespace AZ
                 }
             }
 
-            Data::AssetBus::MultiHandler::BusConnect(shaderVariantAssetId);
+            assetToConnect = shaderVariantAssetId;
             return true;
         }
 
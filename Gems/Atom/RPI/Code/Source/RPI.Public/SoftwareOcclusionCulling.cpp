@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Base.h>
+#include <Atom/RPI.Public/SoftwareOcclusionCulling.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/math.h>
+
+#include <float.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            // Geometry closer than this clip-space W (view depth for perspective projections) is clipped away before
+            // projection, and AABBs that reach it are always visible. Clipping well before W reaches zero keeps the
+            // projected coordinates and 1/W small enough for the float edge and depth equations to stay precise.
+            constexpr float NearClipW = 1.0e-2f;
+
+            // Number of AABBs tested by each job in TestAabbs().
+            constexpr size_t AabbsPerJob = 512;
+
+            // Largest number of texels per axis sampled from the Hi-Z pyramid by a rectangle test.
+            constexpr int32_t MaxTestTexelsPerAxis = 2;
+
+            uint32_t AlignUpToSimdWidth(uint32_t value)
+            {
+                return (value + 3u) & ~3u;
+            }
+        }
+
+        SoftwareOcclusionCulling::SoftwareOcclusionCulling()
+            : SoftwareOcclusionCulling(DefaultWidth, DefaultHeight)
+        {
+        }
+
+        SoftwareOcclusionCulling::SoftwareOcclusionCulling(uint32_t width, uint32_t height)
+        {
+            SetResolution(width, height);
+        }
+
+        void SoftwareOcclusionCulling::SetResolution(uint32_t width, uint32_t height)
+        {
+            AZ_Assert(width > 0 && height > 0, "SoftwareOcclusionCulling resolution must not be zero");
+
+            m_width = AZStd::max(width, 1u);
+            m_height = AZStd::max(height, 1u);
+
+            m_levels.clear();
+            uint32_t levelWidth = m_width;
+            uint32_t levelHeight = m_height;
+            while (true)
+            {
+                DepthLevel& level = m_levels.emplace_back();
+                level.m_width = levelWidth;
+                level.m_height = levelHeight;
+                level.m_stride = AlignUpToSimdWidth(levelWidth);
+                level.m_inverseW.resize(level.m_stride * levelHeight, 0.0f);
+
+                if (levelWidth == 1 && levelHeight == 1)
+                {
+                    break;
+                }
+                levelWidth = (levelWidth + 1) / 2;
+                levelHeight = (levelHeight + 1) / 2;
+            }
+
+            m_activeLevelCount = 1;
+        }
+
+        void SoftwareOcclusionCulling::Clear()
+        {
+            // An inverse W of zero is infinitely far away, so nothing is occluded.
+            AZStd::fill(m_levels[0].m_inverseW.begin(), m_levels[0].m_inverseW.end(), 0.0f);
+            m_activeLevelCount = 1;
+        }
+
+        void SoftwareOcclusionCulling::RenderTriangles(AZStd::span<const Vector4> clipSpaceVertices, AZStd::span<const uint32_t> indices)
+        {
+            AZ_Assert(indices.size() % 3 == 0, "SoftwareOcclusionCulling::RenderTriangles expects a triangle list");
+
+            for (size_t i = 0; i + 2 < indices.size(); i += 3)
+            {
+                AZ_Assert(
+                    indices[i] < clipSpaceVertices.size() && indices[i + 1] < clipSpaceVertices.size() &&
+                        indices[i + 2] < clipSpaceVertices.size(),
+                    "SoftwareOcclusionCulling::RenderTriangles index out of range");
+
+                RenderClippedTriangle(clipSpaceVertices[indices[i]], clipSpaceVertices[indices[i + 1]], clipSpaceVertices[indices[i + 2]]);
+            }
+            m_activeLevelCount = 1;
+        }
+
+        void SoftwareOcclusionCulling::RenderOccluderMesh(
+            const Matrix4x4& worldToClip, AZStd::span<const Vector3> positions, AZStd::span<const uint32_t> indices)
+        {
+            AZStd::vector<Vector4> clipSpaceVertices;
+            clipSpaceVertices.reserve(positions.size());
+            for (const Vector3& position : positions)
+            {
+                clipSpaceVertices.push_back(worldToClip * Vector4::CreateFromVector3AndFloat(position, 1.0f));
+            }
+            RenderTriangles(clipSpaceVertices, indices);
+        }
+
+        void SoftwareOcclusionCulling::RenderClippedTriangle(const Vector4& v0, const Vector4& v1, const Vector4& v2)
+        {
+            // Clip the triangle against the W near plane, which produces at most one extra vertex.
+            AZStd::fixed_vector<Vector4, 4> clipped;
+            const Vector4 input[3] = { v0, v1, v2 };
+            for (size_t i = 0; i < 3; ++i)
+            {
+                const Vector4& current = input[i];
+                const Vector4& next = input[(i + 1) % 3];
+                const float currentDistance = current.GetW() - NearClipW;
+                const float nextDistance = next.GetW() - NearClipW;
+
+                if (currentDistance >= 0.0f)
+                {
+                    clipped.push_back(current);
+                }
+                if ((currentDistance >= 0.0f) != (nextDistance >= 0.0f))
+                {
+                    const float t = currentDistance / (currentDistance - nextDistance);
+                    clipped.push_back(current.Lerp(next, t));
+                }
+            }
+
+            if (clipped.size() < 3)
+            {
+                return;
+            }
+
+            // Project to pixel coordinates, keeping 1/W which is linear in screen space.
+            const float halfWidth = 0.5f * static_cast<float>(m_width);
+            const float halfHeight = 0.5f * static_cast<float>(m_height);
+            AZStd::fixed_vector<ScreenVertex, 4> screenVertices;
+            for (const Vector4& vertex : clipped)
+            {
+                const float inverseW = 1.0f / vertex.GetW();
+                screenVertices.push_back(ScreenVertex{
+                    (vertex.GetX() * inverseW + 1.0f) * halfWidth, (vertex.GetY() * inverseW + 1.0f) * halfHeight, inverseW });
+            }
+
+            for (size_t i = 2; i < screenVertices.size(); ++i)
+            {
+                RasterizeTriangle(screenVertices[0], screenVertices[i - 1], screenVertices[i]);
+            }
+        }
+
+        void SoftwareOcclusionCulling::RasterizeTriangle(ScreenVertex v0, ScreenVertex v1, ScreenVertex v2)
+        {
+            float area = (v1.m_x - v0.m_x) * (v2.m_y - v0.m_y) - (v2.m_x - v0.m_x) * (v1.m_y - v0.m_y);
+            if (!(AZStd::abs(area) > 0.0f))
+            {
+                // Degenerate, or not a number after projecting extreme coordinates.
+                return;
+            }
+
+            // Occluders are double sided, so wind every triangle the same way.
+            if (area < 0.0f)
+            {
+                AZStd::swap(v1, v2);
+                area = -area;
+            }
+
+            // Pixel centers are at +0.5, clamp the covered range to the buffer.
+            const float minX = AZStd::min(AZStd::min(v0.m_x, v1.m_x), v2.m_x);
+            const float maxX = AZStd::max(AZStd::max(v0.m_x, v1.m_x), v2.m_x);
+            const float minY = AZStd::min(AZStd::min(v0.m_y, v1.m_y), v2.m_y);
+            const float maxY = AZStd::max(AZStd::max(v0.m_y, v1.m_y), v2.m_y);
+
+            const float lastX = static_cast<float>(m_width - 1);
+            const float lastY = static_cast<float>(m_height - 1);
+            const int32_t pixelMinX = static_cast<int32_t>(AZStd::clamp(AZStd::ceil(minX - 0.5f), 0.0f, lastX + 1.0f));
+            const int32_t pixelMaxX = static_cast<int32_t>(AZStd::clamp(AZStd::floor(maxX - 0.5f), -1.0f, lastX));
+            const int32_t pixelMinY = static_cast<int32_t>(AZStd::clamp(AZStd::ceil(minY - 0.5f), 0.0f, lastY + 1.0f));
+            const int32_t pixelMaxY = static_cast<int32_t>(AZStd::clamp(AZStd::floor(maxY - 0.5f), -1.0f, lastY));
+            if (pixelMinX > pixelMaxX || pixelMinY > pixelMaxY)
+            {
+                return;
+            }
+
+            // Edge functions E(x, y) = A*x + B*y + C, positive inside. Each edge's value is the barycentric weight of the
+            // opposite vertex scaled by the area.
+            const auto edgeA = [](const ScreenVertex& a, const ScreenVertex& b) { return a.m_y - b.m_y; };
+            const auto edgeB = [](const ScreenVertex& a, const ScreenVertex& b) { return b.m_x - a.m_x; };
+            const auto edgeC = [](const ScreenVertex& a, const ScreenVertex& b) { return a.m_x * b.m_y - a.m_y * b.m_x; };
+
+            const float a0 = edgeA(v1, v2), b0 = edgeB(v1, v2), c0 = edgeC(v1, v2);
+            const float a1 = edgeA(v2, v0), b1 = edgeB(v2, v0), c1 = edgeC(v2, v0);
+            const float a2 = edgeA(v0, v1), b2 = edgeB(v0, v1), c2 = edgeC(v0, v1);
+
+            // Plane equation of 1/W in screen space.
+            const float inverseArea = 1.0f / area;
+            const float depthA = (a0 * v0.m_inverseW + a1 * v1.m_inverseW + a2 * v2.m_inverseW) * inverseArea;
+            const float depthB = (b0 * v0.m_inverseW + b1 * v1.m_inverseW + b2 * v2.m_inverseW) * inverseArea;
+            const float depthC = (c0 * v0.m_inverseW + c1 * v1.m_inverseW + c2 * v2.m_inverseW) * inverseArea;
+
+            using Simd::Vec4;
+            const Vec4::FloatType laneOffsets = Vec4::LoadImmediate(0.5f, 1.5f, 2.5f, 3.5f);
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType edgeA0 = Vec4::Splat(a0);
+            const Vec4::FloatType edgeA1 = Vec4::Splat(a1);
+            const Vec4::FloatType edgeA2 = Vec4::Splat(a2);
+            const Vec4::FloatType planeA = Vec4::Splat(depthA);
+
+            DepthLevel& level = m_levels[0];
+            const int32_t startX = pixelMinX & ~3;
+
+            for (int32_t y = pixelMinY; y <= pixelMaxY; ++y)
+            {
+                const float centerY = static_cast<float>(y) + 0.5f;
+                const Vec4::FloatType rowE0 = Vec4::Splat(b0 * centerY + c0);
+                const Vec4::FloatType rowE1 = Vec4::Splat(b1 * centerY + c1);
+                const Vec4::FloatType rowE2 = Vec4::Splat(b2 * centerY + c2);
+                const Vec4::FloatType rowDepth = Vec4::Splat(depthB * centerY + depthC);
+                float* row = level.m_inverseW.data() + static_cast<size_t>(y) * level.m_stride;
+
+                // The stride is padded to four pixels, so a block never runs past the end of the row. Pixels outside
+                // the triangle's bounds are also outside the triangle, except in the padding which is never read.
+                for (int32_t x = startX; x <= pixelMaxX; x += 4)
+                {
+                    const Vec4::FloatType centerX = Vec4::Add(Vec4::Splat(static_cast<float>(x)), laneOffsets);
+                    const Vec4::FloatType e0 = Vec4::Madd(edgeA0, centerX, rowE0);
+                    const Vec4::FloatType e1 = Vec4::Madd(edgeA1, centerX, rowE1);
+                    const Vec4::FloatType e2 = Vec4::Madd(edgeA2, centerX, rowE2);
+                    const Vec4::FloatType inside =
+                        Vec4::And(Vec4::And(Vec4::CmpGtEq(e0, zero), Vec4::CmpGtEq(e1, zero)), Vec4::CmpGtEq(e2, zero));
+                    // All four pixels are outside the triangle
+                    if (Vec4::CmpAllEq(inside, zero))
+                    {
+                        continue;
+                    }
+
+                    const Vec4::FloatType depth = Vec4::Madd(planeA, centerX, rowDepth);
+                    const Vec4::FloatType current = Vec4::LoadUnaligned(row + x);
+                    Vec4::StoreUnaligned(row + x, Vec4::Select(Vec4::Max(current, depth), current, inside));
+                }
+            }
+        }
+
+        void SoftwareOcclusionCulling::BuildHierarchicalDepth()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            // Each texel keeps the farthest occluder (smallest 1/W) of the texels it covers. Odd sizes clamp to the last
+            // row/column, which makes edge texels cover fewer pixels and keeps the result conservative.
+            for (size_t levelIndex = 1; levelIndex < m_levels.size(); ++levelIndex)
+            {
+                const DepthLevel& source = m_levels[levelIndex - 1];
+                DepthLevel& destination = m_levels[levelIndex];
+
+                for (uint32_t y = 0; y < destination.m_height; ++y)
+                {
+                    const float* sourceRow0 = source.m_inverseW.data() + (2 * y) * source.m_stride;
+                    const float* sourceRow1 = source.m_inverseW.data() + AZStd::min(2 * y + 1, source.m_height - 1) * source.m_stride;
+                    float* destinationRow = destination.m_inverseW.data() + y * destination.m_stride;
+
+                    for (uint32_t x = 0; x < destination.m_width; ++x)
+                    {
+                        const uint32_t x0 = 2 * x;
+                        const uint32_t x1 = AZStd::min(2 * x + 1, source.m_width - 1);
+                        destinationRow[x] = AZStd::min(
+                            AZStd::min(sourceRow0[x0], sourceRow0[x1]), AZStd::min(sourceRow1[x0], sourceRow1[x1]));
+                    }
+                }
+            }
+
+            m_activeLevelCount = static_cast<uint32_t>(m_levels.size());
+        }
+
+        bool SoftwareOcclusionCulling::TestRect(float ndcMinX, float ndcMinY, float ndcMaxX, float ndcMaxY, float minClipW) const
+        {
+            if (!(minClipW > NearClipW))
+            {
+                return true;
+            }
+
+            const float pixelMinX = (ndcMinX + 1.0f) * 0.5f * static_cast<float>(m_width);
+            const float pixelMaxX = (ndcMaxX + 1.0f) * 0.5f * static_cast<float>(m_width);
+            const float pixelMinY = (ndcMinY + 1.0f) * 0.5f * static_cast<float>(m_height);
+            const float pixelMaxY = (ndcMaxY + 1.0f) * 0.5f * static_cast<float>(m_height);
+
+            // The occlusion buffer says nothing about what is outside the screen.
+            if (pixelMaxX < 0.0f || pixelMaxY < 0.0f || pixelMinX >= static_cast<float>(m_width) ||
+                pixelMinY >= static_cast<float>(m_height))
+            {
+                return true;
+            }
+
+            const int32_t lastX = static_cast<int32_t>(m_width) - 1;
+            const int32_t lastY = static_cast<int32_t>(m_height) - 1;
+            const int32_t minX = AZStd::clamp(static_cast<int32_t>(AZStd::floor(pixelMinX)), 0, lastX);
+            const int32_t maxX = AZStd::clamp(static_cast<int32_t>(AZStd::floor(pixelMaxX)), 0, lastX);
+            const int32_t minY = AZStd::clamp(static_cast<int32_t>(AZStd::floor(pixelMinY)), 0, lastY);
+            const int32_t maxY = AZStd::clamp(static_cast<int32_t>(AZStd::floor(pixelMaxY)), 0, lastY);
+
+            // Pick the finest level where the rectangle covers at most a few texels per axis.
+            uint32_t levelIndex = 0;
+            while (levelIndex + 1 < m_activeLevelCount &&
+                   (((maxX >> levelIndex) - (minX >> levelIndex)) >= MaxTestTexelsPerAxis ||
+                    ((maxY >> levelIndex) - (minY >> levelIndex)) >= MaxTestTexelsPerAxis))
+            {
+                ++levelIndex;
+            }
+
+            const DepthLevel& level = m_levels[levelIndex];
+            const float objectInverseW = 1.0f / minClipW;
+            for (int32_t y = minY >> levelIndex; y <= (maxY >> levelIndex); ++y)
+            {
+                const float* row = level.m_inverseW.data() + static_cast<size_t>(y) * level.m_stride;
+                for (int32_t x = minX >> levelIndex; x <= (maxX >> levelIndex); ++x)
+                {
+                    // Visible if any covered occluder is not strictly in front of the object's nearest point.
+                    if (row[x] <= objectInverseW)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        bool SoftwareOcclusionCulling::TestAabb(const Aabb& aabb, const Matrix4x4& worldToClip) const
+        {
+            const Vector3& minBound = aabb.GetMin();
+            const Vector3& maxBound = aabb.GetMax();
+
+            float minW = FLT_MAX;
+            float ndcMinX = FLT_MAX;
+            float ndcMinY = FLT_MAX;
+            float ndcMaxX = -FLT_MAX;
+            float ndcMaxY = -FLT_MAX;
+            for (uint32_t corner = 0; corner < 8; ++corner)
+            {
+                const Vector4 clipSpaceCorner = worldToClip *
+                    Vector4((corner & 1) ? maxBound.GetX() : minBound.GetX(), (corner & 2) ? maxBound.GetY() : minBound.GetY(),
+                            (corner & 4) ? maxBound.GetZ() : minBound.GetZ(), 1.0f);
+
+                const float w = clipSpaceCorner.GetW();
+                if (!(w > NearClipW))
+                {
+                    // Crosses the near plane, e.g. the camera is inside the box.
+                    return true;
+                }
+
+                const float inverseW = 1.0f / w;
+                const float ndcX = clipSpaceCorner.GetX() * inverseW;
+                const float ndcY = clipSpaceCorner.GetY() * inverseW;
+                minW = AZStd::min(minW, w);
+                ndcMinX = AZStd::min(ndcMinX, ndcX);
+                ndcMinY = AZStd::min(ndcMinY, ndcY);
+                ndcMaxX = AZStd::max(ndcMaxX, ndcX);
+                ndcMaxY = AZStd::max(ndcMaxY, ndcY);
+            }
+
+            return TestRect(ndcMinX, ndcMinY, ndcMaxX, ndcMaxY, minW);
+        }
+
+        void SoftwareOcclusionCulling::TestAabbs(AZStd::span<const Aabb> aabbs, const Matrix4x4& worldToClip, AZStd::span<bool> visibleFlags) const
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+            AZ_Assert(aabbs.size() == visibleFlags.size(), "SoftwareOcclusionCulling::TestAabbs requires one visible flag per AABB");
+
+            const size_t count = AZStd::min(aabbs.size(), visibleFlags.size());
+            const auto testRange = [this, &aabbs, &worldToClip, &visibleFlags](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    visibleFlags[i] = TestAabb(aabbs[i], worldToClip);
+                }
+            };
+
+            if (count > AabbsPerJob && AZ::JobContext::GetGlobalContext())
+            {
+                AZ::JobCompletion jobCompletion;
+                for (size_t begin = 0; begin < count; begin += AabbsPerJob)
+                {
+                    const size_t end = AZStd::min(begin + AabbsPerJob, count);
+                    AZ::Job* job = AZ::CreateJobFunction([&testRange, begin, end]() { testRange(begin, end); }, true, nullptr);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                testRange(0, count);
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
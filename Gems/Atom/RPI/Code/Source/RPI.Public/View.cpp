@@ -13,6 +13,7 @@
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Pass/Specific/SwapChainPass.h>
+#include <Atom/RPI.Public/SoftwareOcclusionCulling.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
 
 #include <AzCore/Casting/lossy_cast.h>
@@ -67,6 +68,7 @@ namespace AZ
             m_maskedOcclusionCulling = MaskedOcclusionCulling::Create();
             m_maskedOcclusionCulling->SetResolution(MaskedSoftwareOcclusionCullingWidth, MaskedSoftwareOcclusionCullingHeight);
 #endif
+            SetOcclusionCullingMode(OcclusionCullingMode::Default);
         }
 
         View::~View()
@@ -560,6 +562,11 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "View: ClearMaskedOcclusionBuffer");
             m_maskedOcclusionCulling->ClearBuffer();
 #endif
+            if (m_softwareOcclusionCulling)
+            {
+                AZ_PROFILE_SCOPE(RPI, "View: ClearSoftwareOcclusionBuffer");
+                m_softwareOcclusionCulling->Clear();
+            }
         }
 
         MaskedOcclusionCulling* View::GetMaskedOcclusionCulling()
@@ -567,6 +574,28 @@ namespace AZ
             return m_maskedOcclusionCulling;
         }
 
+        void View::SetOcclusionCullingMode(OcclusionCullingMode mode)
+        {
+            m_occlusionCullingMode = mode;
+
+            const bool usesSoftwareOcclusionCulling = mode == OcclusionCullingMode::Software ||
+                (mode == OcclusionCullingMode::Default && !AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED);
+            if (!usesSoftwareOcclusionCulling)
+            {
+                m_softwareOcclusionCulling.reset();
+            }
+            else if (!m_softwareOcclusionCulling)
+            {
+                m_softwareOcclusionCulling = AZStd::make_unique<SoftwareOcclusionCulling>();
+            }
+        }
+
+        bool View::UsesMaskedOcclusionCulling() const
+        {
+            return m_maskedOcclusionCulling &&
+                (m_occlusionCullingMode == OcclusionCullingMode::Default || m_occlusionCullingMode == OcclusionCullingMode::Masked);
+        }
+
         void View::TryCreateShaderResourceGroup()
         {
             if (!m_shaderResourceGroup)
@@ -212,7 +212,24 @@ namespace AZ
                 AZStd::shared_lock<decltype(m_variantTreeMutex)> lock(m_variantTreeMutex);
                 if (m_shaderVariantTree)
                 {
-                    return m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
+                    {
+                        AZStd::shared_lock<decltype(m_variantLookupCacheMutex)> cacheLock(m_variantLookupCacheMutex);
+                        auto findIt = m_variantLookupCache.find(shaderVariantId);
+                        if (findIt != m_variantLookupCache.end())
+                        {
+                            return findIt->second;
+                        }
+                    }
+
+                    variantSearchResult = m_shaderVariantTree->FindVariantStableId(GetShaderOptionGroupLayout(), shaderVariantId);
+
+                    AZStd::unique_lock<decltype(m_variantLookupCacheMutex)> cacheLock(m_variantLookupCacheMutex);
+                    if (m_variantLookupCache.size() >= VariantLookupCacheCapacity)
+                    {
+                        m_variantLookupCache.clear();
+                    }
+                    m_variantLookupCache.emplace(shaderVariantId, variantSearchResult);
+                    return variantSearchResult;
                 }
             }
 
@@ -605,6 +622,11 @@ namespace AZ
             {
                 m_shaderVariantTree = shaderVariantTreeAsset;
             }
+
+            {
+                AZStd::unique_lock<decltype(m_variantLookupCacheMutex)> cacheLock(m_variantLookupCacheMutex);
+                m_variantLookupCache.clear();
+            }
             lock.unlock();
         }
 
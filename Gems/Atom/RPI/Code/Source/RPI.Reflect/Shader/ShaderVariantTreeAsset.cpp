@@ -11,6 +11,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
 
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroupLayout.h>
@@ -74,101 +75,128 @@ namespace AZ
         {
             struct NodeToVisit
             {
-                uint32_t m_branchCount; // Number of static branches
                 uint32_t m_nodeIndex;   // Index of the node to visit
+                uint16_t m_depth;       // Index of the option value that selects this node's children
+                uint16_t m_branchCount; // Number of static branches
             };
 
-            struct SearchResult
-            {
-                uint32_t m_branchCount;            // Number of static branches
-                ShaderVariantStableId m_variantStableId;
-            };
+            const auto& options = shaderOptionGroupLayout->GetShaderOptions();
+            const uint32_t optionCount = aznumeric_cast<uint32_t>(options.size());
 
             // The list of specified options, in order of priority, built from the variant key mask.
-            auto optionValues = ConvertToValueChain(shaderOptionGroupLayout, shaderVariantId);
+            // remainingSpecified[i] is the number of specified values at or after index i, which bounds how many static
+            // branches a subtree can still add.
+            AZStd::fixed_vector<uint32_t, ShaderVariantKeyBitCount> optionValues;
+            AZStd::fixed_vector<uint16_t, ShaderVariantKeyBitCount + 1> remainingSpecified;
+            for (const ShaderOptionDescriptor& option : options)
+            {
+                if (optionValues.size() == optionValues.capacity())
+                {
+                    break;
+                }
+                optionValues.push_back((shaderVariantId.m_mask & option.GetBitMask()).any() ? option.DecodeBits(shaderVariantId.m_key) : UnspecifiedIndex);
+            }
 
-            // Always add the root to the results.
-            AZStd::vector<SearchResult> searchResults;
-            searchResults.push_back({ 0, ShaderAsset::RootShaderVariantStableId });
+            // Remove trailing unspecified option values as they do not contribute anything to the search.
+            while (!optionValues.empty() && optionValues.back() == UnspecifiedIndex)
+            {
+                optionValues.pop_back();
+            }
 
-            // All the indices are guaranteed to be unique, so we use queues.
-            AZStd::queue<NodeToVisit> nodesToVisit;
-            AZStd::queue<NodeToVisit> nodesToVisitNext;
+            remainingSpecified.resize(optionValues.size() + 1);
+            remainingSpecified.back() = 0;
+            for (size_t i = optionValues.size(); i > 0; --i)
+            {
+                remainingSpecified[i - 1] = static_cast<uint16_t>(remainingSpecified[i] + (optionValues[i - 1] != UnspecifiedIndex ? 1 : 0));
+            }
 
-            // Always visit the root node.
-            nodesToVisit.push({ 0, 0 });
+            // The root is always a match. More static branches is a better fit; on ties the shallowest match wins, and
+            // among matches at the same depth the first one in visiting order (specified before unspecified) wins.
+            ShaderVariantStableId bestFitStableId = ShaderAsset::RootShaderVariantStableId;
+            uint32_t bestBranchCount = 0;
+            uint32_t bestDepth = 0;
 
-            for (uint32_t optionValue : optionValues)
+            const auto considerMatch = [&](uint32_t nodeIndex, uint32_t depth, uint32_t branchCount)
             {
-                while (!nodesToVisit.empty())
+                const uint32_t stableId = m_lookupNodes[nodeIndex].m_stableId;
+                if (stableId != UnspecifiedIndex &&
+                    (branchCount > bestBranchCount || (branchCount == bestBranchCount && depth < bestDepth)))
                 {
-                    const NodeToVisit nextNode = nodesToVisit.front();
-                    nodesToVisit.pop();
+                    bestFitStableId = ShaderVariantStableId{ stableId };
+                    bestBranchCount = branchCount;
+                    bestDepth = depth;
+                }
+            };
 
-                    // Leaf node
-                    if (!GetNode(nextNode.m_nodeIndex).HasChildren())
-                    {
-                        continue;
-                    }
+            if (m_lookupNodes.empty())
+            {
+                return ShaderVariantSearchResult{ bestFitStableId, optionCount };
+            }
 
-                    // Two branches need to be searched:
-                    // - The node that is an exact match for the shader option value (specified).
-                    // - The node that can match any shader option value (unspecified).
+            // Each visited node pushes at most two children, and only one of them stays on the stack while the other's
+            // subtree is visited, so the depth of the stack is bounded by the number of options.
+            AZStd::fixed_vector<NodeToVisit, ShaderVariantKeyBitCount + 2> nodesToVisit;
+            nodesToVisit.push_back({ 0, 0, 0 });
 
-                    // The unspecified value node is always the first child.
-                    const uint32_t unspecifiedIndex = nextNode.m_nodeIndex + GetNode(nextNode.m_nodeIndex).GetOffset();
+            while (!nodesToVisit.empty())
+            {
+                const NodeToVisit node = nodesToVisit.back();
+                nodesToVisit.pop_back();
 
-                    // All the specified value nodes follow the unspecified node.
-                    // The index of the requested node is calculated using the order of the option value.
-                    const uint32_t requestedIndex = unspecifiedIndex + (optionValue + 1);
+                if (node.m_depth >= optionValues.size())
+                {
+                    continue;
+                }
 
-                    // If no option value was requested, this index is the same as the unspecified index.
-                    if (requestedIndex > unspecifiedIndex)
-                    {
-                        // Visit this specified node, and increase the weight of visiting the node by 1.
-                        // [GFX TODO] [ATOM-3883] Improve the evaluation of visiting the variant search tree.
-                        nodesToVisitNext.push({ nextNode.m_branchCount + 1, requestedIndex });
-
-                        // If the specified node has valid data, add it to the matches.
-                        if (GetNode(requestedIndex).GetStableId().IsValid())
-                        {
-                            // Specified nodes have one more static branch than their parent.
-                            searchResults.push_back({ nextNode.m_branchCount + 1, GetNode(requestedIndex).GetStableId() });
-                        }
-                    }
-
-                    // Always visit the unspecified node.
-                    nodesToVisitNext.push({ nextNode.m_branchCount, unspecifiedIndex });
-
-                    // If the unspecified node has valid data, add it to the matches.
-                    if (GetNode(unspecifiedIndex).GetStableId().IsValid())
-                    {
-                        // Unspecified nodes have the same number of static branches as their parent.
-                        searchResults.push_back({ nextNode.m_branchCount, GetNode(unspecifiedIndex).GetStableId() });
-                    }
+                // Skip subtrees that can't beat the best match. Deeper matches lose ties, so equality is enough.
+                const uint32_t reachableBranchCount = node.m_branchCount + remainingSpecified[node.m_depth];
+                if (reachableBranchCount < bestBranchCount ||
+                    (reachableBranchCount == bestBranchCount && bestDepth <= node.m_depth + 1u))
+                {
+                    continue;
                 }
 
-                // Visit the next nodes.
-                AZStd::swap(nodesToVisit, nodesToVisitNext);
-            }
+                // Leaf node
+                const uint32_t unspecifiedIndex = m_lookupNodes[node.m_nodeIndex].m_firstChild;
+                if (unspecifiedIndex == 0)
+                {
+                    continue;
+                }
 
-            // Count the number of static branches.
-            uint32_t totalBranchCount = 0;
-            ShaderVariantStableId bestFitStableId = ShaderAsset::RootShaderVariantStableId;
+                const uint16_t childDepth = static_cast<uint16_t>(node.m_depth + 1);
+                const uint32_t optionValue = optionValues[node.m_depth];
 
-            AZStd::for_each(searchResults.begin(), searchResults.end(), [&](const SearchResult& searchResult)
+                // Two branches need to be searched:
+                // - The node that is an exact match for the shader option value (specified), which has one more static branch.
+                // - The node that can match any shader option value (unspecified), which is always the first child.
+                // The unspecified node is pushed first so the specified one is visited first.
+                nodesToVisit.push_back({ unspecifiedIndex, childDepth, node.m_branchCount });
+                if (optionValue != UnspecifiedIndex)
                 {
-                    // More static branches is a better fit.
-                    if (searchResult.m_branchCount > totalBranchCount)
-                    {
-                        totalBranchCount = searchResult.m_branchCount;
-                        bestFitStableId = searchResult.m_variantStableId;
-                    }
-                });
-
-            // Calculate the number of dynamic branches. 
-            const uint32_t optionCount = aznumeric_cast<uint32_t>(shaderOptionGroupLayout->GetShaderOptions().size());
-            return ShaderVariantSearchResult{ bestFitStableId, optionCount - totalBranchCount };
+                    const uint32_t requestedIndex = unspecifiedIndex + (optionValue + 1);
+                    AZ_Assert(requestedIndex < m_lookupNodes.size(), "Invalid Node Index");
+
+                    considerMatch(requestedIndex, childDepth, node.m_branchCount + 1u);
+                    nodesToVisit.push_back({ requestedIndex, childDepth, static_cast<uint16_t>(node.m_branchCount + 1) });
+                }
+                considerMatch(unspecifiedIndex, childDepth, node.m_branchCount);
+            }
+
+            // Calculate the number of dynamic branches.
+            return ShaderVariantSearchResult{ bestFitStableId, optionCount - bestBranchCount };
+        }
+
+        void ShaderVariantTreeAsset::BuildLookupTable()
+        {
+            m_lookupNodes.clear();
+            m_lookupNodes.reserve(m_nodes.size());
+            for (uint32_t nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex)
+            {
+                const ShaderVariantTreeNode& node = m_nodes[nodeIndex];
+                LookupNode& lookupNode = m_lookupNodes.emplace_back();
+                lookupNode.m_stableId = node.GetStableId().GetIndex();
+                lookupNode.m_firstChild = node.HasChildren() ? nodeIndex + node.GetOffset() : 0;
+            }
         }
 
         const ShaderVariantTreeNode& ShaderVariantTreeAsset::GetNode(uint32_t index) const
@@ -220,6 +248,7 @@ namespace AZ
 
         bool ShaderVariantTreeAsset::FinalizeAfterLoad()
         {
+            BuildLookupTable();
             return true;
         }
          
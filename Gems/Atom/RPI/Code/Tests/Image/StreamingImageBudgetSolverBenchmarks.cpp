@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/math.h>
+
+#include <Atom/RPI.Public/Image/StreamingImageBudgetSolver.h>
+
+namespace UnitTest
+{
+    // Replays a camera path over a field of textured objects without a renderer, to measure the cost of solving the
+    // streaming image budget as the visible set changes.
+    class StreamingImageBudgetSolverBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t ImageWidth = 2048;
+        static constexpr float ObjectSize = 2.0f;
+        static constexpr float ObjectSpacing = 4.0f;
+        static constexpr float ScreenHeight = 1080.0f;
+        static constexpr float TanHalfFieldOfView = 0.577f; // 60 degrees vertical
+        static constexpr uint32_t FrameCount = 600;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            Initialize(aznumeric_cast<uint32_t>(state.range(0)));
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            Initialize(aznumeric_cast<uint32_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        // Moves the camera along a circle through the object field and updates each image's priority and requested mip
+        // from its projected size, the same way the streaming controller does with reported screen-space sizes.
+        void UpdateFrame(uint32_t frame)
+        {
+            const float angle = AZ::Constants::TwoPi * static_cast<float>(frame) / static_cast<float>(FrameCount);
+            const float radius = m_fieldHalfExtent * 0.5f;
+            const AZ::Vector3 cameraPosition(radius * AZStd::cos(angle), radius * AZStd::sin(angle), 2.0f);
+
+            for (size_t i = 0; i < m_requests.size(); ++i)
+            {
+                const float distance = AZStd::max(cameraPosition.GetDistance(m_objectPositions[i]), 0.1f);
+                const float projectedSize = ObjectSize * ScreenHeight / (2.0f * distance * TanHalfFieldOfView);
+
+                AZ::RPI::StreamingImageBudgetRequest& request = m_requests[i];
+                request.m_requestedMipChain = AZ::RPI::StreamingImageBudgetSolver::CalculateRequestedMipLevel(
+                    ImageWidth, static_cast<uint16_t>(request.m_mipChainSizes.size()), projectedSize);
+                request.m_priority = projectedSize * projectedSize;
+            }
+        }
+
+        AZStd::vector<AZ::RPI::StreamingImageBudgetRequest> m_requests;
+        AZStd::vector<AZ::Vector3> m_objectPositions;
+        AZStd::vector<uint16_t> m_targetMipChains;
+        float m_fieldHalfExtent = 0.0f;
+        size_t m_memoryBudget = 0;
+
+    private:
+        void Initialize(uint32_t imageCount)
+        {
+            // One mip per chain, BC1-like 0.5 bytes per texel with a 4x4 block minimum.
+            AZ::RPI::StreamingImageBudgetRequest request;
+            size_t fullChainSize = 0;
+            for (uint32_t mipWidth = ImageWidth; mipWidth > 0; mipWidth >>= 1)
+            {
+                const size_t blocks = AZStd::max<size_t>(mipWidth / 4, 1);
+                request.m_mipChainSizes.push_back(blocks * blocks * 8);
+                fullChainSize += request.m_mipChainSizes.back();
+            }
+
+            // Lay the objects out on a square grid centered at the origin.
+            const uint32_t gridWidth = static_cast<uint32_t>(AZStd::ceil(AZStd::sqrt(static_cast<float>(imageCount))));
+            m_fieldHalfExtent = gridWidth * ObjectSpacing * 0.5f;
+            m_objectPositions.reserve(imageCount);
+            for (uint32_t i = 0; i < imageCount; ++i)
+            {
+                m_objectPositions.emplace_back(
+                    (i % gridWidth) * ObjectSpacing - m_fieldHalfExtent, (i / gridWidth) * ObjectSpacing - m_fieldHalfExtent, 0.0f);
+            }
+
+            m_requests.resize(imageCount, request);
+            m_targetMipChains.resize(imageCount);
+
+            // Only a tenth of the images can be fully resident at once.
+            m_memoryBudget = fullChainSize * AZStd::max<size_t>(imageCount / 10, 1);
+        }
+
+        void Destroy()
+        {
+            m_requests = {};
+            m_objectPositions = {};
+            m_targetMipChains = {};
+        }
+    };
+
+    BENCHMARK_DEFINE_F(StreamingImageBudgetSolverBenchmarkFixture, BM_CameraPathReplay)(benchmark::State& state)
+    {
+        const uint32_t solveInterval = aznumeric_cast<uint32_t>(state.range(1));
+        size_t memoryUsed = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (uint32_t frame = 0; frame < FrameCount; ++frame)
+            {
+                UpdateFrame(frame);
+                if (frame % solveInterval == 0)
+                {
+                    memoryUsed = AZ::RPI::StreamingImageBudgetSolver::Solve(m_requests, m_memoryBudget, m_targetMipChains);
+                    benchmark::DoNotOptimize(memoryUsed);
+                }
+            }
+        }
+
+        state.counters["BudgetUsage"] = static_cast<double>(memoryUsed) / static_cast<double>(m_memoryBudget);
+        state.SetItemsProcessed(state.iterations() * FrameCount);
+    }
+
+    BENCHMARK_REGISTER_F(StreamingImageBudgetSolverBenchmarkFixture, BM_CameraPathReplay)
+        ->Args({ 1024, 1 })
+        ->Args({ 1024, 10 })
+        ->Args({ 8192, 1 })
+        ->Args({ 8192, 10 })
+        ->Unit(::benchmark::kMillisecond);
+
+} // namespace UnitTest
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageBudgetSolver.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 
@@ -723,4 +724,109 @@ namespace UnitTest
             EXPECT_NEAR(pixelDataValue, pixelExpectedValue, Constants::Tolerance);
         }
     }
+
+    namespace
+    {
+        // Builds a request for a square image with one mip per chain, 4 bytes per texel.
+        AZ::RPI::StreamingImageBudgetRequest CreateBudgetRequest(uint32_t width, float priority)
+        {
+            AZ::RPI::StreamingImageBudgetRequest request;
+            for (uint32_t mipWidth = width; mipWidth > 0; mipWidth >>= 1)
+            {
+                request.m_mipChainSizes.push_back(mipWidth * mipWidth * 4);
+            }
+            request.m_priority = priority;
+            return request;
+        }
+    }
+
+    TEST_F(StreamingImageTests, BudgetSolverUnlimitedBudget_AllImagesReachRequestedMip)
+    {
+        using namespace AZ::RPI;
+
+        AZStd::vector<StreamingImageBudgetRequest> requests;
+        requests.push_back(CreateBudgetRequest(256, 1.0f));
+        requests.push_back(CreateBudgetRequest(256, 1.0f));
+        requests.back().m_requestedMipChain = 3;
+        requests.push_back(CreateBudgetRequest(256, 0.0f));
+
+        AZStd::vector<uint16_t> targets(requests.size());
+        const size_t memoryUsed = StreamingImageBudgetSolver::Solve(requests, 0, targets);
+
+        EXPECT_EQ(targets[0], 0);
+        EXPECT_EQ(targets[1], 3);
+        // Images with no priority stay at their tail mip chain.
+        EXPECT_EQ(targets[2], requests[2].m_mipChainSizes.size() - 1);
+
+        size_t expectedMemory = 0;
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            for (size_t chain = targets[i]; chain < requests[i].m_mipChainSizes.size(); ++chain)
+            {
+                expectedMemory += requests[i].m_mipChainSizes[chain];
+            }
+        }
+        EXPECT_EQ(memoryUsed, expectedMemory);
+    }
+
+    TEST_F(StreamingImageTests, BudgetSolverLimitedBudget_HigherPriorityImageGetsMoreDetail)
+    {
+        using namespace AZ::RPI;
+
+        AZStd::vector<StreamingImageBudgetRequest> requests;
+        requests.push_back(CreateBudgetRequest(256, 100.0f));
+        requests.push_back(CreateBudgetRequest(256, 1.0f));
+
+        // Enough for one full 256x256 image and some lower mips of the other one.
+        const size_t budget = 256 * 256 * 4 * 2;
+        AZStd::vector<uint16_t> targets(requests.size());
+        const size_t memoryUsed = StreamingImageBudgetSolver::Solve(requests, budget, targets);
+
+        EXPECT_LE(memoryUsed, budget);
+        EXPECT_EQ(targets[0], 0);
+        EXPECT_GT(targets[1], targets[0]);
+    }
+
+    TEST_F(StreamingImageTests, BudgetSolverLimitedBudget_HigherTierImageGetsMemoryFirst)
+    {
+        using namespace AZ::RPI;
+
+        AZStd::vector<StreamingImageBudgetRequest> requests;
+        requests.push_back(CreateBudgetRequest(256, 1.0f));
+        requests.push_back(CreateBudgetRequest(256, 0.001f));
+        requests.back().m_priorityTier = 1;
+
+        // Enough for one full 256x256 image, which goes to the higher tier despite its lower priority.
+        const size_t budget = 256 * 256 * 4 * 2;
+        AZStd::vector<uint16_t> targets(requests.size());
+        StreamingImageBudgetSolver::Solve(requests, budget, targets);
+
+        EXPECT_EQ(targets[1], 0);
+        EXPECT_GT(targets[0], targets[1]);
+    }
+
+    TEST_F(StreamingImageTests, BudgetSolverBudgetBelowTailMips_ImagesStayAtTail)
+    {
+        using namespace AZ::RPI;
+
+        AZStd::vector<StreamingImageBudgetRequest> requests;
+        requests.push_back(CreateBudgetRequest(64, 1.0f));
+
+        AZStd::vector<uint16_t> targets(requests.size());
+        StreamingImageBudgetSolver::Solve(requests, 1, targets);
+
+        EXPECT_EQ(targets[0], requests[0].m_mipChainSizes.size() - 1);
+    }
+
+    TEST_F(StreamingImageTests, BudgetSolverCalculateRequestedMipLevel)
+    {
+        using namespace AZ::RPI;
+
+        EXPECT_EQ(StreamingImageBudgetSolver::CalculateRequestedMipLevel(1024, 11, 2048.0f), 0);
+        EXPECT_EQ(StreamingImageBudgetSolver::CalculateRequestedMipLevel(1024, 11, 1024.0f), 0);
+        EXPECT_EQ(StreamingImageBudgetSolver::CalculateRequestedMipLevel(1024, 11, 256.0f), 2);
+        EXPECT_EQ(StreamingImageBudgetSolver::CalculateRequestedMipLevel(1024, 11, 200.0f), 2);
+        EXPECT_EQ(StreamingImageBudgetSolver::CalculateRequestedMipLevel(1024, 11, 0.5f), 10);
+        EXPECT_EQ(StreamingImageBudgetSolver::CalculateRequestedMipLevel(1024, 4, 1.0f), 3);
+    }
 }
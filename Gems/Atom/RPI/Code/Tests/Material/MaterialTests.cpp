@@ -14,6 +14,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Material/MaterialAssetCreator.h>
@@ -298,6 +299,46 @@ namespace UnitTest
         EXPECT_EQ(srgData.GetConstant<uint32_t>(srgData.FindShaderInputConstantIndex(Name{ "m_enum" })), 3u);
     }
 
+    TEST_F(MaterialTests, TestQueueCompile)
+    {
+        MaterialSystem* materialSystem = MaterialSystem::Get();
+        ASSERT_NE(materialSystem, nullptr);
+
+        Data::Instance<Material> material = Material::Create(m_testMaterialAsset);
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+        EXPECT_TRUE(material->NeedsCompile());
+
+        // Queuing twice only adds the material once.
+        EXPECT_TRUE(material->QueueCompile());
+        EXPECT_TRUE(material->QueueCompile());
+        EXPECT_TRUE(material->IsQueuedForCompile());
+        EXPECT_TRUE(material->NeedsCompile());
+        EXPECT_EQ(materialSystem->GetQueuedMaterialCount(), 1);
+
+        materialSystem->CompileQueuedMaterials();
+
+        EXPECT_FALSE(material->IsQueuedForCompile());
+        EXPECT_FALSE(material->NeedsCompile());
+        EXPECT_EQ(materialSystem->GetQueuedMaterialCount(), 0);
+
+        const RHI::ShaderResourceGroupData& srgData = material->GetRHIShaderResourceGroup()->GetData();
+        EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 2.5f);
+
+        // The material's SRG is now queued for compile, so a second change has to wait for the next batch.
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 3.5f));
+        EXPECT_TRUE(material->QueueCompile());
+        materialSystem->CompileQueuedMaterials();
+        EXPECT_TRUE(material->NeedsCompile());
+        EXPECT_TRUE(material->IsQueuedForCompile());
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        materialSystem->CompileQueuedMaterials();
+        EXPECT_FALSE(material->NeedsCompile());
+        EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 3.5f);
+    }
+
     TEST_F(MaterialTests, TestSetPropertyValueToMultipleShaderSettings)
     {
         Data::Asset<MaterialTypeAsset> materialTypeAsset;
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Atom/RPI.Edit/Shader/ShaderVariantTreeAssetCreator.h>
+#include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
+#include <Atom/RPI.Reflect/Shader/ShaderOptionGroupLayout.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
+
+namespace UnitTest
+{
+    // Measures shader variant lookups in trees built from shaders with many options, as materials do for every draw item.
+    class ShaderVariantTreeBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t QueryCount = 1024;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            Initialize(aznumeric_cast<uint32_t>(state.range(0)), aznumeric_cast<uint32_t>(state.range(1)));
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            Initialize(aznumeric_cast<uint32_t>(state.range(0)), aznumeric_cast<uint32_t>(state.range(1)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZ::RPI::Ptr<AZ::RPI::ShaderOptionGroupLayout> m_layout;
+        AZ::Data::Asset<AZ::RPI::ShaderVariantTreeAsset> m_tree;
+        AZStd::vector<AZ::RPI::ShaderVariantId> m_queries;
+
+    private:
+        void Initialize(uint32_t optionCount, uint32_t variantCount)
+        {
+            if (!AZ::AllocatorInstance<AZ::PoolAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+                m_ownsPoolAllocator = true;
+            }
+            if (!AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+                m_ownsThreadPoolAllocator = true;
+            }
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+                m_ownsNameDictionary = true;
+            }
+            if (!AZ::Data::AssetManager::IsReady())
+            {
+                AZ::Data::AssetManager::Descriptor desc;
+                AZ::Data::AssetManager::Create(desc);
+                m_ownsAssetManager = true;
+            }
+
+            // One boolean option per bit, in priority order.
+            m_layout = AZ::RPI::ShaderOptionGroupLayout::Create();
+            const AZ::RPI::ShaderOptionValues boolValues = AZ::RPI::CreateBoolShaderOptionValues();
+            for (uint32_t optionIndex = 0; optionIndex < optionCount; ++optionIndex)
+            {
+                m_layout->AddShaderOption(AZ::RPI::ShaderOptionDescriptor{
+                    AZ::Name{ AZStd::string::format("o_option%u", optionIndex) }, AZ::RPI::ShaderOptionType::Boolean,
+                    optionIndex, optionIndex, boolValues, AZ::Name{ "False" } });
+            }
+            m_layout->Finalize();
+
+            // Variants specify a random number of the highest priority options, like a baked .shadervariantlist.
+            AZ::SimpleLcgRandom random(1234);
+            const AZ::Name trueName{ "True" };
+            const AZ::Name falseName{ "False" };
+            AZStd::vector<AZ::RPI::ShaderVariantListSourceData::VariantInfo> variantInfos;
+            variantInfos.reserve(variantCount);
+            for (uint32_t variantIndex = 0; variantIndex < variantCount; ++variantIndex)
+            {
+                AZ::RPI::ShaderVariantListSourceData::VariantInfo& variantInfo = variantInfos.emplace_back();
+                variantInfo.m_stableId = variantIndex + 1;
+                const uint32_t specifiedCount = 1 + random.GetRandom() % optionCount;
+                for (uint32_t optionIndex = 0; optionIndex < specifiedCount; ++optionIndex)
+                {
+                    variantInfo.m_options[m_layout->GetShaderOptions()[optionIndex].GetName()] = (random.GetRandom() & 1) ? trueName : falseName;
+                }
+            }
+
+            AZ::RPI::ShaderVariantTreeAssetCreator creator;
+            creator.Begin(AZ::Uuid::CreateRandom());
+            creator.SetShaderOptionGroupLayout(*m_layout);
+            creator.SetVariantInfos(variantInfos);
+            creator.End(m_tree);
+
+            // Queries set every option, as a material with all of its options assigned does.
+            AZ::RPI::ShaderOptionGroup optionGroup(m_layout);
+            m_queries.reserve(QueryCount);
+            for (size_t queryIndex = 0; queryIndex < QueryCount; ++queryIndex)
+            {
+                for (uint32_t optionIndex = 0; optionIndex < optionCount; ++optionIndex)
+                {
+                    optionGroup.SetValue(AZ::RPI::ShaderOptionIndex{ optionIndex }, AZ::RPI::ShaderOptionValue{ random.GetRandom() & 1 });
+                }
+                m_queries.push_back(optionGroup.GetShaderVariantId());
+            }
+        }
+
+        void Destroy()
+        {
+            m_queries = {};
+            m_tree.Reset();
+            m_layout = nullptr;
+
+            if (m_ownsAssetManager)
+            {
+                AZ::Data::AssetManager::Destroy();
+                m_ownsAssetManager = false;
+            }
+            if (m_ownsNameDictionary)
+            {
+                AZ::NameDictionary::Destroy();
+                m_ownsNameDictionary = false;
+            }
+            if (m_ownsThreadPoolAllocator)
+            {
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+                m_ownsThreadPoolAllocator = false;
+            }
+            if (m_ownsPoolAllocator)
+            {
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+                m_ownsPoolAllocator = false;
+            }
+        }
+
+        bool m_ownsPoolAllocator = false;
+        bool m_ownsThreadPoolAllocator = false;
+        bool m_ownsNameDictionary = false;
+        bool m_ownsAssetManager = false;
+    };
+
+    BENCHMARK_DEFINE_F(ShaderVariantTreeBenchmarkFixture, BM_FindVariantStableId)(benchmark::State& state)
+    {
+        if (!m_tree)
+        {
+            state.SkipWithError("Failed to create the shader variant tree.");
+            return;
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::RPI::ShaderVariantId& query : m_queries)
+            {
+                AZ::RPI::ShaderVariantSearchResult result = m_tree->FindVariantStableId(m_layout.get(), query);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.counters["TreeNodes"] = static_cast<double>(m_tree->GetNodeCount());
+        state.SetItemsProcessed(state.iterations() * m_queries.size());
+    }
+
+    BENCHMARK_REGISTER_F(ShaderVariantTreeBenchmarkFixture, BM_FindVariantStableId)
+        ->Args({ 16, 256 })
+        ->Args({ 32, 1024 })
+        ->Args({ 64, 4096 })
+        ->Args({ 128, 4096 })
+        ->Unit(::benchmark::kMicrosecond);
+
+} // namespace UnitTest
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <Atom/RPI.Public/SoftwareOcclusionCulling.h>
+
+namespace UnitTest
+{
+    // A street level view into a grid of city blocks: each block is a box shaped occluder mesh, and the cullables are
+    // small objects scattered between and behind them, as a server doing visibility for bots would see it.
+    class SoftwareOcclusionCullingBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int32_t BlockGridSize = 16;
+        static constexpr float BlockSpacing = 40.0f;
+        static constexpr float BlockHalfSize = 15.0f;
+        static constexpr float BlockHeight = 30.0f;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            Initialize(aznumeric_cast<uint32_t>(state.range(0)));
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            Initialize(aznumeric_cast<uint32_t>(state.range(0)));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            Destroy();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RenderOccluders()
+        {
+            m_occlusion->Clear();
+            m_occlusion->RenderOccluderMesh(m_worldToClip, m_occluderPositions, m_occluderIndices);
+            m_occlusion->BuildHierarchicalDepth();
+        }
+
+        AZStd::unique_ptr<AZ::RPI::SoftwareOcclusionCulling> m_occlusion;
+        AZ::Matrix4x4 m_worldToClip;
+        AZStd::vector<AZ::Vector3> m_occluderPositions;
+        AZStd::vector<uint32_t> m_occluderIndices;
+        AZStd::vector<AZ::Aabb> m_aabbs;
+        AZStd::vector<bool> m_visibleFlags;
+
+    private:
+        void Initialize(uint32_t aabbCount)
+        {
+            m_occlusion = AZStd::make_unique<AZ::RPI::SoftwareOcclusionCulling>();
+
+            // Camera at the corner of the grid, looking down the diagonal (-Z is forward in view space).
+            const AZ::Matrix4x4 viewToClip = AZ::Matrix4x4::CreateProjection(AZ::Constants::HalfPi, 16.0f / 9.0f, 0.1f, 2000.0f);
+            const AZ::Matrix4x4 viewToWorld = AZ::Matrix4x4::CreateTranslation(AZ::Vector3(-BlockSpacing, 2.0f, -BlockSpacing)) *
+                AZ::Matrix4x4::CreateRotationY(AZ::Constants::Pi * 1.25f);
+            m_worldToClip = viewToClip * viewToWorld.GetInverseFull();
+
+            // Y is up, so each block is a box from the ground to BlockHeight.
+            static constexpr uint32_t boxIndices[] = {
+                0, 1, 2, 2, 3, 0, // bottom
+                4, 5, 6, 6, 7, 4, // top
+                0, 1, 5, 5, 4, 0,
+                1, 2, 6, 6, 5, 1,
+                2, 3, 7, 7, 6, 2,
+                3, 0, 4, 4, 7, 3
+            };
+            for (int32_t x = 0; x < BlockGridSize; ++x)
+            {
+                for (int32_t z = 0; z < BlockGridSize; ++z)
+                {
+                    const uint32_t firstVertex = aznumeric_cast<uint32_t>(m_occluderPositions.size());
+                    const float centerX = x * BlockSpacing;
+                    const float centerZ = z * BlockSpacing;
+                    for (float height : { 0.0f, BlockHeight })
+                    {
+                        m_occluderPositions.emplace_back(centerX - BlockHalfSize, height, centerZ - BlockHalfSize);
+                        m_occluderPositions.emplace_back(centerX + BlockHalfSize, height, centerZ - BlockHalfSize);
+                        m_occluderPositions.emplace_back(centerX + BlockHalfSize, height, centerZ + BlockHalfSize);
+                        m_occluderPositions.emplace_back(centerX - BlockHalfSize, height, centerZ + BlockHalfSize);
+                    }
+                    for (uint32_t index : boxIndices)
+                    {
+                        m_occluderIndices.push_back(firstVertex + index);
+                    }
+                }
+            }
+
+            AZ::SimpleLcgRandom random(1234);
+            const float gridExtent = BlockGridSize * BlockSpacing;
+            m_aabbs.reserve(aabbCount);
+            for (uint32_t i = 0; i < aabbCount; ++i)
+            {
+                const AZ::Vector3 position(random.GetRandomFloat() * gridExtent, random.GetRandomFloat() * 5.0f, random.GetRandomFloat() * gridExtent);
+                m_aabbs.push_back(AZ::Aabb::CreateCenterHalfExtents(position, AZ::Vector3(1.0f)));
+            }
+            m_visibleFlags.resize(aabbCount);
+        }
+
+        void Destroy()
+        {
+            m_occlusion.reset();
+            m_occluderPositions = {};
+            m_occluderIndices = {};
+            m_aabbs = {};
+            m_visibleFlags = {};
+        }
+    };
+
+    BENCHMARK_DEFINE_F(SoftwareOcclusionCullingBenchmarkFixture, BM_RenderOccluders)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            RenderOccluders();
+        }
+
+        state.SetItemsProcessed(state.iterations() * (m_occluderIndices.size() / 3));
+    }
+
+    BENCHMARK_DEFINE_F(SoftwareOcclusionCullingBenchmarkFixture, BM_TestAabbs)(benchmark::State& state)
+    {
+        RenderOccluders();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_occlusion->TestAabbs(m_aabbs, m_worldToClip, m_visibleFlags);
+            benchmark::DoNotOptimize(m_visibleFlags.data());
+        }
+
+        size_t visibleCount = 0;
+        for (bool visible : m_visibleFlags)
+        {
+            visibleCount += visible ? 1 : 0;
+        }
+        state.counters["VisibleRatio"] = static_cast<double>(visibleCount) / static_cast<double>(m_aabbs.size());
+        state.SetItemsProcessed(state.iterations() * m_aabbs.size());
+    }
+
+    BENCHMARK_REGISTER_F(SoftwareOcclusionCullingBenchmarkFixture, BM_RenderOccluders)
+        ->Arg(1)
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(SoftwareOcclusionCullingBenchmarkFixture, BM_TestAabbs)
+        ->Arg(1024)
+        ->Arg(16384)
+        ->Arg(131072)
+        ->Unit(::benchmark::kMicrosecond);
+
+} // namespace UnitTest
+
+#endif
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/SoftwareOcclusionCulling.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    // The camera sits at the origin looking down -Z, with a 90 degree field of view, so the screen spans [-d, d] at distance d.
+    class SoftwareOcclusionCullingTests
+        : public RPITestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+            m_worldToClip = Matrix4x4::CreateProjection(Constants::HalfPi, 1.0f, 0.1f, 1000.0f);
+        }
+
+        // Renders a square occluder facing the camera at the given distance.
+        void RenderSquare(SoftwareOcclusionCulling& occlusion, float halfSize, float distance)
+        {
+            const Vector3 positions[4] = {
+                Vector3(-halfSize, -halfSize, -distance),
+                Vector3(-halfSize, halfSize, -distance),
+                Vector3(halfSize, halfSize, -distance),
+                Vector3(halfSize, -halfSize, -distance)
+            };
+            const uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+            occlusion.RenderOccluderMesh(m_worldToClip, positions, indices);
+        }
+
+        Matrix4x4 m_worldToClip;
+    };
+
+    TEST_F(SoftwareOcclusionCullingTests, EmptyBuffer_EverythingVisible)
+    {
+        SoftwareOcclusionCulling occlusion;
+        occlusion.BuildHierarchicalDepth();
+
+        EXPECT_TRUE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -21.0f), Vector3(1.0f, 1.0f, -20.0f)), m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, BoxBehindOccluder_Occluded)
+    {
+        SoftwareOcclusionCulling occlusion;
+        RenderSquare(occlusion, 5.0f, 10.0f);
+        occlusion.BuildHierarchicalDepth();
+
+        EXPECT_FALSE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -21.0f), Vector3(1.0f, 1.0f, -20.0f)), m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, BoxInFrontOfOccluder_Visible)
+    {
+        SoftwareOcclusionCulling occlusion;
+        RenderSquare(occlusion, 5.0f, 10.0f);
+        occlusion.BuildHierarchicalDepth();
+
+        EXPECT_TRUE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -5.0f), Vector3(1.0f, 1.0f, -4.0f)), m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, BoxIntersectingOccluder_Visible)
+    {
+        SoftwareOcclusionCulling occlusion;
+        RenderSquare(occlusion, 5.0f, 10.0f);
+        occlusion.BuildHierarchicalDepth();
+
+        EXPECT_TRUE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -11.0f), Vector3(1.0f, 1.0f, -9.0f)), m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, BoxPartiallyBehindOccluder_Visible)
+    {
+        SoftwareOcclusionCulling occlusion;
+        RenderSquare(occlusion, 5.0f, 10.0f);
+        occlusion.BuildHierarchicalDepth();
+
+        // The occluder covers [-0.5, 0.5] in NDC, this box spans [0.4, 0.6].
+        EXPECT_TRUE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(8.0f, -1.0f, -21.0f), Vector3(12.0f, 1.0f, -20.0f)), m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, BoxBesideOccluder_Visible)
+    {
+        SoftwareOcclusionCulling occlusion;
+        RenderSquare(occlusion, 5.0f, 10.0f);
+        occlusion.BuildHierarchicalDepth();
+
+        EXPECT_TRUE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(14.0f, -1.0f, -21.0f), Vector3(16.0f, 1.0f, -20.0f)), m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, BoxContainingCamera_Visible)
+    {
+        SoftwareOcclusionCulling occlusion;
+        RenderSquare(occlusion, 5.0f, 1.0f);
+        occlusion.BuildHierarchicalDepth();
+
+        EXPECT_TRUE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -50.0f), Vector3(1.0f, 1.0f, 1.0f)), m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, OccluderCrossingNearPlane_ClippedAndOccludes)
+    {
+        SoftwareOcclusionCulling occlusion;
+
+        // A wall to the left of the camera that extends behind it, covering the left half of the screen.
+        const Vector3 positions[4] = {
+            Vector3(-30.0f, -30.0f, 10.0f),
+            Vector3(-30.0f, 30.0f, 10.0f),
+            Vector3(0.0f, 30.0f, -30.0f),
+            Vector3(0.0f, -30.0f, -30.0f)
+        };
+        const uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+        occlusion.RenderOccluderMesh(m_worldToClip, positions, indices);
+        occlusion.BuildHierarchicalDepth();
+
+        EXPECT_FALSE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(-20.0f, -1.0f, -42.0f), Vector3(-18.0f, 1.0f, -40.0f)), m_worldToClip));
+        EXPECT_TRUE(occlusion.TestAabb(Aabb::CreateFromMinMax(Vector3(18.0f, -1.0f, -42.0f), Vector3(20.0f, 1.0f, -40.0f)), m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, Clear_RemovesOccluders)
+    {
+        SoftwareOcclusionCulling occlusion;
+        RenderSquare(occlusion, 5.0f, 10.0f);
+        occlusion.BuildHierarchicalDepth();
+
+        const Aabb hidden = Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -21.0f), Vector3(1.0f, 1.0f, -20.0f));
+        EXPECT_FALSE(occlusion.TestAabb(hidden, m_worldToClip));
+
+        occlusion.Clear();
+        EXPECT_EQ(1u, occlusion.GetHierarchyLevelCount());
+        EXPECT_TRUE(occlusion.TestAabb(hidden, m_worldToClip));
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, HierarchicalDepth_MatchesFullResolutionResults)
+    {
+        SoftwareOcclusionCulling occlusion(200, 120);
+        RenderSquare(occlusion, 5.0f, 10.0f);
+
+        AZStd::vector<Aabb> aabbs;
+        for (int32_t x = -20; x <= 20; x += 2)
+        {
+            for (int32_t y = -20; y <= 20; y += 2)
+            {
+                aabbs.push_back(Aabb::CreateFromMinMax(
+                    Vector3(static_cast<float>(x), static_cast<float>(y), -31.0f), Vector3(x + 1.0f, y + 1.0f, -30.0f)));
+            }
+        }
+
+        AZStd::vector<bool> fullResolutionResults(aabbs.size());
+        occlusion.TestAabbs(aabbs, m_worldToClip, fullResolutionResults);
+
+        occlusion.BuildHierarchicalDepth();
+        EXPECT_GT(occlusion.GetHierarchyLevelCount(), 1u);
+
+        AZStd::vector<bool> hierarchicalResults(aabbs.size());
+        occlusion.TestAabbs(aabbs, m_worldToClip, hierarchicalResults);
+
+        // The Hi-Z pyramid is conservative, so it may only report more objects as visible.
+        size_t occludedCount = 0;
+        for (size_t i = 0; i < aabbs.size(); ++i)
+        {
+            EXPECT_TRUE(hierarchicalResults[i] || !fullResolutionResults[i]);
+            EXPECT_EQ(hierarchicalResults[i], occlusion.TestAabb(aabbs[i], m_worldToClip));
+            occludedCount += hierarchicalResults[i] ? 0 : 1;
+        }
+        EXPECT_GT(occludedCount, 0u);
+    }
+
+    TEST_F(SoftwareOcclusionCullingTests, ViewOcclusionCullingMode_SoftwareAllocatesBuffer)
+    {
+        ViewPtr view = View::CreateView(Name("TestView"), View::UsageCamera);
+
+        view->SetOcclusionCullingMode(View::OcclusionCullingMode::Software);
+        EXPECT_EQ(View::OcclusionCullingMode::Software, view->GetOcclusionCullingMode());
+        EXPECT_NE(nullptr, view->GetSoftwareOcclusionCulling());
+        EXPECT_FALSE(view->UsesMaskedOcclusionCulling());
+
+        view->SetOcclusionCullingMode(View::OcclusionCullingMode::Disabled);
+        EXPECT_EQ(nullptr, view->GetSoftwareOcclusionCulling());
+        EXPECT_FALSE(view->UsesMaskedOcclusionCulling());
+    }
+} // namespace UnitTest
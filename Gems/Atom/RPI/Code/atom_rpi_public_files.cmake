@@ -22,6 +22,7 @@ set(FILES
     Include/Atom/RPI.Public/RPIUtils.h
     Include/Atom/RPI.Public/Scene.h
     Include/Atom/RPI.Public/SceneBus.h
+    Include/Atom/RPI.Public/SoftwareOcclusionCulling.h
     Include/Atom/RPI.Public/View.h
     Include/Atom/RPI.Public/ViewGroup.h
     Include/Atom/RPI.Public/ViewportContext.h
@@ -48,6 +49,7 @@ set(FILES
     Include/Atom/RPI.Public/Image/ImageSystemInterface.h
     Include/Atom/RPI.Public/Image/StreamingImage.h
     Include/Atom/RPI.Public/Image/StreamingImageContext.h
+    Include/Atom/RPI.Public/Image/StreamingImageBudgetSolver.h
     Include/Atom/RPI.Public/Image/StreamingImageController.h
     Include/Atom/RPI.Public/Image/StreamingImagePool.h
     Include/Atom/RPI.Public/Material/Material.h
@@ -111,6 +113,7 @@ set(FILES
     Source/RPI.Public/RPISystem.cpp
     Source/RPI.Public/RPIUtils.cpp
     Source/RPI.Public/Scene.cpp
+    Source/RPI.Public/SoftwareOcclusionCulling.cpp
     Source/RPI.Public/View.cpp
     Source/RPI.Public/ViewGroup.cpp
     Source/RPI.Public/ViewportContext.cpp
@@ -129,6 +132,7 @@ set(FILES
     Source/RPI.Public/Image/ImageSystem.cpp
     Source/RPI.Public/Image/StreamingImage.cpp
     Source/RPI.Public/Image/StreamingImageContext.cpp
+    Source/RPI.Public/Image/StreamingImageBudgetSolver.cpp
     Source/RPI.Public/Image/StreamingImageController.cpp
     Source/RPI.Public/Image/StreamingImagePool.cpp
     Source/RPI.Public/Material/Material.cpp
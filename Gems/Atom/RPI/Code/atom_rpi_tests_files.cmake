@@ -22,6 +22,7 @@ set(FILES
     Tests/Common/ShaderAssetTestUtils.h
     Tests/Common/TestUtils.h
     Tests/Common/TestFeatureProcessors.h
+    Tests/Image/StreamingImageBudgetSolverBenchmarks.cpp
     Tests/Image/StreamingImageTests.cpp
     Tests/Material/LuaMaterialFunctorTests.cpp
     Tests/Material/MaterialVersionUpdateTests.cpp
@@ -41,6 +42,7 @@ set(FILES
     Tests/Model/SkinJointIdPaddingTests.cpp
     Tests/Pass/PassTests.cpp
     Tests/Shader/ShaderTests.cpp
+    Tests/Shader/ShaderVariantTreeBenchmarks.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupBufferTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupConstantBufferTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupImageTests.cpp
@@ -49,6 +51,8 @@ set(FILES
     Tests/System/GpuQueryTests.cpp
     Tests/System/RenderPipelineTests.cpp
     Tests/System/SceneTests.cpp
+    Tests/System/SoftwareOcclusionCullingBenchmarks.cpp
+    Tests/System/SoftwareOcclusionCullingTests.cpp
     Tests/System/ViewTests.cpp
     Tests/Utils/AssetUtilsTests.cpp
 )
@@ -85,6 +85,8 @@ namespace AZ
         AZStd::string GetLoadedFontNames() const override;
         void OnLanguageChanged() override;
         void ReloadAllFonts() override;
+        void BeginFontTextureUpdateBatch() override;
+        void EndFontTextureUpdateBatch() override;
         //////////////////////////////////////////////////////////////////////////////////
 
         //////////////////////////////////////////////////////////////////////////////////
@@ -95,6 +97,9 @@ namespace AZ
     public:
         void UnregisterFont(const char* fontName);
 
+        //! True between BeginFontTextureUpdateBatch and EndFontTextureUpdateBatch, fonts defer their texture uploads
+        bool IsBatchingFontTextureUpdates() const { return m_fontTextureUpdateBatchDepth > 0; }
+
     private:
         using FontMap = AZStd::unordered_map<AzFramework::FontId, FFont*>;
         using FontMapItor = FontMap::iterator;
@@ -138,6 +143,8 @@ namespace AZ
 
         AzFramework::FontDrawInterface* m_defaultFontDrawInterface = nullptr;
 
+        int m_fontTextureUpdateBatchDepth = 0; //!< Nesting depth of BeginFontTextureUpdateBatch calls
+
         int r_persistFontFamilies = 1; //!< Persist fonts for application lifetime to prevent unnecessary work; enabled by default.
         AZStd::vector<FontFamilyPtr> m_persistedFontFamilies; //!< Stores persisted fonts (if "persist font families" is enabled)
     };
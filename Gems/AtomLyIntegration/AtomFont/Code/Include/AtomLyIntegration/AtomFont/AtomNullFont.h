@@ -76,6 +76,8 @@ namespace AZ
         virtual AZStd::string GetLoadedFontNames() const override { return ""; }
         virtual void OnLanguageChanged() override { }
         virtual void ReloadAllFonts() override { } 
+        virtual void BeginFontTextureUpdateBatch() override { }
+        virtual void EndFontTextureUpdateBatch() override { }
 
     private:
         static AtomNullFFont NullFFont;
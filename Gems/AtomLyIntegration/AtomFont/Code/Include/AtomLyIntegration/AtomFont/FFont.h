@@ -194,6 +194,9 @@ namespace AZ
 
         AZ::Data::Instance<AZ::RPI::Image> GetFontImage() { return m_fontStreamingImage; }
 
+        //! Upload the font texture if glyphs were added to it while AtomFont was batching texture updates
+        void UpdatePendingTexture();
+
     private:
         virtual ~FFont();
         bool InitTexture();
@@ -280,6 +283,7 @@ namespace AZ
         AtomFont* m_atomFont = nullptr;
 
         bool m_fontTexDirty = false;
+        bool m_fontTexUpdatePending = false; //!< The font texture changed during a texture update batch and has not been uploaded yet
 
         FontEffects m_effects;
 
@@ -317,6 +321,7 @@ namespace AZ
             font->m_atomFont = nullptr;
         }
 
+        EBUS_EVENT(FontNotificationBus, OnFontDestroyed, font);
         delete font;
     }
 }
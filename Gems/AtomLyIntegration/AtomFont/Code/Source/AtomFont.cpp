@@ -676,6 +676,28 @@ void AZ::AtomFont::ReloadAllFonts()
     EBUS_EVENT(FontNotificationBus, OnFontsReloaded);
 }
 
+void AZ::AtomFont::BeginFontTextureUpdateBatch()
+{
+    ++m_fontTextureUpdateBatchDepth;
+}
+
+void AZ::AtomFont::EndFontTextureUpdateBatch()
+{
+    AZ_Assert(m_fontTextureUpdateBatchDepth > 0, "EndFontTextureUpdateBatch called without a matching BeginFontTextureUpdateBatch");
+    if (--m_fontTextureUpdateBatchDepth > 0)
+    {
+        return;
+    }
+
+    for (auto& fontEntry : m_fonts)
+    {
+        if (fontEntry.second)
+        {
+            fontEntry.second->UpdatePendingTexture();
+        }
+    }
+}
+
 void AZ::AtomFont::UnregisterFont(const char* fontName)
 {
     AZStd::string name(fontName);
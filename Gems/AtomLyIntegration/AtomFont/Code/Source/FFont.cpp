@@ -201,6 +201,7 @@ void AZ::FFont::Free()
 {
     m_fontImage = nullptr;
     m_fontImageVersion = 0;
+    m_fontTexUpdatePending = false;
 
     delete m_fontTexture;
     m_fontTexture = nullptr;
@@ -1454,6 +1455,7 @@ bool AZ::FFont::InitTexture()
     m_fontImage->SetName(Name(m_name.c_str()));
 
     m_fontImageVersion = 0;
+    m_fontTexUpdatePending = false;
     return true;
 }
 
@@ -1491,6 +1493,15 @@ bool AZ::FFont::UpdateTexture()
     return true;
 }
 
+void AZ::FFont::UpdatePendingTexture()
+{
+    if (m_fontTexUpdatePending)
+    {
+        UpdateTexture();
+        m_fontTexUpdatePending = false;
+    }
+}
+
 bool AZ::FFont::InitCache()
 {
     m_fontTexture->CreateGradientSlot();
@@ -1531,7 +1542,16 @@ void AZ::FFont::Prepare(const char* str, bool updateTexture, const AtomFont::Gly
     bool texUpdateNeeded = m_fontTexture->PreCacheString(str, nullptr, m_sizeRatio, usedGlyphSize, m_fontHintParams) == 1 || m_fontTexDirty;
     if (updateTexture && texUpdateNeeded && m_fontImage)
     {
-        UpdateTexture();
+        // While AtomFont is batching texture updates, the upload is done once at the end of the batch.
+        // The quads are generated from the CPU side copy of the texture so they are valid straight away.
+        if (m_atomFont && m_atomFont->IsBatchingFontTextureUpdates())
+        {
+            m_fontTexUpdatePending = true;
+        }
+        else
+        {
+            UpdateTexture();
+        }
         m_fontTexDirty = false;
         ++m_fontImageVersion;
 
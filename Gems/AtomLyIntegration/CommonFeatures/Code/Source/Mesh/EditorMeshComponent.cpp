@@ -82,6 +82,10 @@ namespace AZ
                             ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MeshComponentConfig::m_isRayTracingEnabled, "Use ray tracing",
                                 "Includes this mesh in ray tracing calculations.")
                                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, Edit::PropertyRefreshLevels::ValuesOnly)
+                            ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MeshComponentConfig::m_isOccluder, "Use as occluder",
+                                "Renders the lowest detail LOD of this model into the occlusion buffer, so that it hides the meshes behind it. "
+                                "Only use it for large, static models whose lowest detail LOD is never larger than the visible geometry.")
+                                ->Attribute(AZ::Edit::Attributes::ChangeNotify, Edit::PropertyRefreshLevels::ValuesOnly)
                             ->DataElement(AZ::Edit::UIHandlers::ComboBox, &MeshComponentConfig::m_lodType, "Lod Type", "Determines how level of detail (LOD) will be selected during rendering.")
                                 ->Attribute(AZ::Edit::Attributes::NameLabelOverride, "LOD Type")
                                 ->EnumAttribute(RPI::Cullable::LodType::Default, "Default")
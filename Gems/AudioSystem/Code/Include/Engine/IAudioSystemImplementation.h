@@ -233,6 +233,27 @@ namespace Audio
             IATLAudioObjectData* objectData,
             const MultiPositionParams& multiPositions) = 0;
 
+        ///////////////////////////////////////////////////////////////////////////////////////////////
+        //! Set the world positions of several audio objects at once.
+        //! The arrays are parallel, the same index in each refers to the same audio object.
+        //! The default sets the positions one at a time with SetPosition, override it if the
+        //! middleware can update many audio objects more cheaply in a single call.
+        //! @param objectData Implementation-specific audio object data, one per audio object.
+        //! @param worldPositions The transforms to set the audio objects to.
+        //! @param results Receives Success for each audio object whose position was set, Failure otherwise.
+        //! @param count The number of audio objects.
+        virtual void SetPositions(
+            IATLAudioObjectData* const* objectData,
+            const SATLWorldPosition* worldPositions,
+            EAudioRequestStatus* results,
+            size_t count)
+        {
+            for (size_t index = 0; index < count; ++index)
+            {
+                results[index] = SetPosition(objectData[index], worldPositions[index]);
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////////////////////////////
         //! Set an audio rtpc to the specified value on a given audio object.
         //! @param objectData Implementation-specific audio object data.
@@ -15,6 +15,7 @@
 
 #include <SoundCVars.h>
 #include <AudioProxy.h>
+#include <AudioRequestQueue.h>
 #include <ATLAudioObject.h>
 #include <IAudioSystemImplementation.h>
 
@@ -172,6 +173,12 @@ namespace Audio
                     result = m_oFileCacheMgr.TryUnloadRequest(request.m_preloadRequestId);
                 }
 
+                else if constexpr (AZStd::is_same_v<T, Audio::SystemRequest::PrefetchBank>)
+                {
+                    result = m_oFileCacheMgr.TryPrefetchRequest(
+                        request.m_preloadRequestId, AZStd::chrono::milliseconds(request.m_deadlineMs));
+                }
+
                 else if constexpr (AZStd::is_same_v<T, Audio::SystemRequest::UnloadBanksByScope>)
                 {
                     result = m_oFileCacheMgr.UnloadDataByScope(request.m_scope);
@@ -581,6 +588,40 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioTranslationLayer::ProcessRequests(AudioRequestsQueue& requests)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        CoalesceObjectUpdates(requests);
+
+        for (AudioRequestVariant& requestVariant : requests)
+        {
+            if (auto setPosition = AZStd::get_if<Audio::ObjectRequest::SetPosition>(&requestVariant);
+                setPosition && AddToPositionBatch(*setPosition))
+            {
+                continue;
+            }
+
+            // The batched positions have to be applied before anything that could depend on them
+            const TAudioObjectID objectId = AZStd::visit(
+                [](const auto& request)
+                {
+                    return request.m_audioObjectId;
+                },
+                requestVariant);
+            if (objectId == INVALID_AUDIO_OBJECT_ID
+                || m_positionBatch.m_objectIds.find(objectId) != m_positionBatch.m_objectIds.end())
+            {
+                FlushPositionBatch();
+            }
+
+            ProcessRequest(AZStd::move(requestVariant));
+        }
+
+        FlushPositionBatch();
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     TAudioControlID CAudioTranslationLayer::GetAudioTriggerID(const char* const audioTriggerName) const
     {
@@ -1648,6 +1689,67 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioTranslationLayer::AddToPositionBatch(const Audio::ObjectRequest::SetPosition& request)
+    {
+        // Requests with a callback, or that will fail, go through ProcessRequest to report their status
+        if (request.m_callback || request.m_audioObjectId == INVALID_AUDIO_OBJECT_ID)
+        {
+            return false;
+        }
+
+        auto audioObject = GetRequestObject(request.m_audioObjectId);
+        if (!audioObject || !audioObject->HasPosition())
+        {
+            return false;
+        }
+
+        if (!m_positionBatch.m_objectIds.insert(request.m_audioObjectId).second)
+        {
+            FlushPositionBatch();
+            m_positionBatch.m_objectIds.insert(request.m_audioObjectId);
+        }
+
+        auto const positionalObject = static_cast<CATLAudioObject*>(audioObject);
+        m_positionBatch.m_objects.push_back(positionalObject);
+        m_positionBatch.m_objectData.push_back(positionalObject->GetImplDataPtr());
+        m_positionBatch.m_positions.push_back(request.m_position);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioTranslationLayer::FlushPositionBatch()
+    {
+        const size_t count = m_positionBatch.m_objects.size();
+        if (count == 0)
+        {
+            return;
+        }
+
+        m_positionBatch.m_results.assign(count, EAudioRequestStatus::None);
+        AudioSystemImplementationRequestBus::Broadcast(
+            &AudioSystemImplementationRequestBus::Events::SetPositions, m_positionBatch.m_objectData.data(),
+            m_positionBatch.m_positions.data(), m_positionBatch.m_results.data(), count);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            if (m_positionBatch.m_results[index] == EAudioRequestStatus::Success)
+            {
+                m_positionBatch.m_objects[index]->SetPosition(m_positionBatch.m_positions[index]);
+            }
+            else
+            {
+                AZLOG_DEBUG("Audio Request did not succeed!");
+            }
+        }
+
+        m_positionBatch.m_objects.clear();
+        m_positionBatch.m_objectData.clear();
+        m_positionBatch.m_positions.clear();
+        m_positionBatch.m_results.clear();
+        m_positionBatch.m_objectIds.clear();
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioTranslationLayer::OnSystemEvent(ESystemEvent event, UINT_PTR wparam, [[maybe_unused]] UINT_PTR lparam)
     {
@@ -15,6 +15,9 @@
 
 #include <ISystem.h>
 
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+
 #if !defined(AUDIO_RELEASE)
 namespace AzFramework
 {
@@ -45,6 +48,10 @@ namespace Audio
 
         void ProcessRequest(AudioRequestVariant&& request);
 
+        //! Process a frame's worth of requests in order. Superseded position and parameter updates are
+        //! dropped and the positions of many audio objects are sent to the implementation in batches.
+        void ProcessRequests(AudioRequestsQueue& requests);
+
         TAudioControlID GetAudioTriggerID(const char* const sAudioTriggerName) const;
         TAudioControlID GetAudioRtpcID(const char* const sAudioRtpcName) const;
         TAudioControlID GetAudioSwitchID(const char* const sAudioSwitchName) const;
@@ -132,6 +139,9 @@ namespace Audio
 
         CATLAudioObjectBase* GetRequestObject(TAudioObjectID objectId);
 
+        bool AddToPositionBatch(const Audio::ObjectRequest::SetPosition& request);
+        void FlushPositionBatch();
+
         enum EATLInternalStates : TATLEnumFlagsType
         {
             eAIS_NONE                           = 0,
@@ -162,6 +172,18 @@ namespace Audio
         CFileCacheManager m_oFileCacheMgr;
         CATLXmlProcessor m_oXmlProcessor;
 
+        // SetPosition requests gathered by ProcessRequests, stored as parallel arrays so that they can be
+        // handed to the implementation in a single call.
+        struct PositionBatch
+        {
+            AZStd::vector<CATLAudioObject*> m_objects;
+            AZStd::vector<IATLAudioObjectData*> m_objectData;
+            AZStd::vector<SATLWorldPosition> m_positions;
+            AZStd::vector<EAudioRequestStatus> m_results;
+            AZStd::unordered_set<TAudioObjectID> m_objectIds;
+        };
+        PositionBatch m_positionBatch;
+
         // Utility members
         TATLEnumFlagsType m_nFlags;
 
@@ -225,6 +225,7 @@ namespace Audio
         , m_memoryBlockAlignment(AUDIO_MEMORY_ALIGNMENT)
         , m_flags(0)
         , m_dataScope(eADS_ALL)
+        , m_lastUseStamp(0)
         , m_memoryBlock(nullptr)
         , m_implData(implData)
     {
@@ -10,14 +10,11 @@
 #pragma once
 
 #include <AzCore/IO/IStreamer.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
-#if !defined(AUDIO_RELEASE)
-    #include <AzCore/std/chrono/chrono.h>
-#endif // !AUDIO_RELEASE
-
 #include <IAudioSystem.h>
 #include <ATLCommon.h>
 #include <ATLEntityData.h>
@@ -369,6 +366,9 @@ namespace Audio
         Flags<TATLEnumFlagsType> m_flags;
         EATLDataScope m_dataScope;
 
+        AZ::u64 m_lastUseStamp;     // when the file was last requested or hinted, for least-recently-used eviction
+        AZStd::chrono::steady_clock::time_point m_timeRequested;    // when the file started streaming in
+
 #if !defined(AUDIO_RELEASE)
         AZStd::chrono::steady_clock::time_point m_timeCached;
 #endif // !AUDIO_RELEASE
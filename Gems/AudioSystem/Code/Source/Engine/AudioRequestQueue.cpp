@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AudioRequestQueue.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Audio
+{
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    AudioRequestQueue::~AudioRequestQueue()
+    {
+        AudioRequestsQueue discardedRequests;
+        PopAll(discardedRequests);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioRequestQueue::Push(AudioRequestVariant&& request)
+    {
+        Node* node = aznew Node(AZStd::move(request));
+        PushNodes(node, node);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioRequestQueue::Push(AudioRequestsQueue& requests)
+    {
+        if (requests.empty())
+        {
+            return;
+        }
+
+        // Build the chain privately, newest first, so it can be published with a single compare-exchange.
+        Node* first = nullptr;
+        Node* last = nullptr;
+        for (auto& request : requests)
+        {
+            Node* node = aznew Node(AZStd::move(request));
+            node->m_next = first;
+            first = node;
+            if (!last)
+            {
+                last = node;
+            }
+        }
+
+        PushNodes(first, last);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioRequestQueue::PopAll(AudioRequestsQueue& requests)
+    {
+        Node* node = m_head.exchange(nullptr, AZStd::memory_order_acquire);
+
+        // The list is newest first, reverse it to process the requests in the order they were pushed.
+        Node* oldest = nullptr;
+        while (node)
+        {
+            Node* next = node->m_next;
+            node->m_next = oldest;
+            oldest = node;
+            node = next;
+        }
+
+        while (oldest)
+        {
+            Node* next = oldest->m_next;
+            requests.push_back(AZStd::move(oldest->m_request));
+            delete oldest;
+            oldest = next;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioRequestQueue::PushNodes(Node* first, Node* last)
+    {
+        Node* head = m_head.load(AZStd::memory_order_relaxed);
+        do
+        {
+            last->m_next = head;
+        } while (!m_head.compare_exchange_weak(head, first, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t CoalesceObjectUpdates(AudioRequestsQueue& requests)
+    {
+        // The updates seen so far while walking the requests backwards, per audio object.
+        struct LaterUpdates
+        {
+            bool m_position = false;
+            AZStd::vector<TAudioControlID> m_parameterIds;
+        };
+        AZStd::unordered_map<TAudioObjectID, LaterUpdates> laterUpdates;
+
+        AZStd::vector<bool> superseded(requests.size(), false);
+        size_t numSuperseded = 0;
+
+        for (size_t index = requests.size(); index-- > 0;)
+        {
+            AZStd::visit(
+                [&laterUpdates, &superseded, &numSuperseded, index](auto&& request)
+                {
+                    using T = AZStd::decay_t<decltype(request)>;
+
+                    if constexpr (AZStd::is_same_v<T, Audio::ObjectRequest::SetPosition>)
+                    {
+                        LaterUpdates& updates = laterUpdates[request.m_audioObjectId];
+                        if (updates.m_position && !request.m_callback)
+                        {
+                            superseded[index] = true;
+                            ++numSuperseded;
+                        }
+                        updates.m_position = true;
+                    }
+                    else if constexpr (AZStd::is_same_v<T, Audio::ObjectRequest::SetParameterValue>)
+                    {
+                        LaterUpdates& updates = laterUpdates[request.m_audioObjectId];
+                        if (AZStd::find(updates.m_parameterIds.begin(), updates.m_parameterIds.end(), request.m_parameterId)
+                            == updates.m_parameterIds.end())
+                        {
+                            updates.m_parameterIds.push_back(request.m_parameterId);
+                        }
+                        else if (!request.m_callback)
+                        {
+                            superseded[index] = true;
+                            ++numSuperseded;
+                        }
+                    }
+                    else if (request.m_audioObjectId == INVALID_AUDIO_OBJECT_ID)
+                    {
+                        // System requests and requests on the global audio object can affect every audio object.
+                        laterUpdates.clear();
+                    }
+                    else
+                    {
+                        laterUpdates.erase(request.m_audioObjectId);
+                    }
+                },
+                requests[index]);
+        }
+
+        if (numSuperseded > 0)
+        {
+            size_t keptCount = 0;
+            for (size_t index = 0; index < requests.size(); ++index)
+            {
+                if (!superseded[index])
+                {
+                    if (keptCount != index)
+                    {
+                        requests[keptCount] = AZStd::move(requests[index]);
+                    }
+                    ++keptCount;
+                }
+            }
+            while (requests.size() > keptCount)
+            {
+                requests.pop_back();
+            }
+        }
+
+        return numSuperseded;
+    }
+
+} // namespace Audio
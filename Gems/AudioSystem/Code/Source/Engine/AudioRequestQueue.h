@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#pragma once
+
+#include <IAudioSystem.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace Audio
+{
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! A lock-free queue of audio requests that any number of threads push to and a single thread drains.
+    //! Producers link their requests onto the head of a list with a compare-exchange. The consumer takes
+    //! the whole list with a single exchange and reverses it, so requests come out in the order they were
+    //! pushed. Because nodes are never popped one at a time, pushing is not exposed to the ABA problem.
+    class AudioRequestQueue
+    {
+    public:
+        AudioRequestQueue() = default;
+        ~AudioRequestQueue();
+
+        AudioRequestQueue(const AudioRequestQueue&) = delete;
+        AudioRequestQueue& operator=(const AudioRequestQueue&) = delete;
+
+        //! Push a request, can be called from any thread.
+        void Push(AudioRequestVariant&& request);
+
+        //! Push a set of requests, can be called from any thread.
+        //! The requests are linked in with one atomic operation so they stay together and in order.
+        //! They are moved out of the container but the container is not cleared.
+        void Push(AudioRequestsQueue& requests);
+
+        //! Move all queued requests, oldest first, to the back of 'requests'.
+        //! Must only be called from the consuming thread.
+        void PopAll(AudioRequestsQueue& requests);
+
+        bool IsEmpty() const
+        {
+            return m_head.load(AZStd::memory_order_relaxed) == nullptr;
+        }
+
+    private:
+        struct Node
+        {
+            AZ_CLASS_ALLOCATOR(Node, AZ::SystemAllocator, 0);
+
+            explicit Node(AudioRequestVariant&& request)
+                : m_request(AZStd::move(request))
+            {}
+
+            AudioRequestVariant m_request;
+            Node* m_next = nullptr;
+        };
+
+        //! Link a chain of nodes, from the newest 'first' to the oldest 'last', onto the head of the list.
+        void PushNodes(Node* first, Node* last);
+
+        AZStd::atomic<Node*> m_head{ nullptr };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Remove position and parameter value updates that are superseded within a set of requests.
+    //! A SetPosition, or a SetParameterValue of a parameter, is dropped when a later request of the same
+    //! kind targets the same audio object and no other request on that object comes between them, so the
+    //! audio object only receives its final value for the frame. Requests with a callback are always kept.
+    //! Requests without a specific audio object act as a barrier for every audio object.
+    //! @param requests The requests, in the order they will be processed.
+    //! @return The number of requests that were removed.
+    size_t CoalesceObjectUpdates(AudioRequestsQueue& requests);
+
+} // namespace Audio
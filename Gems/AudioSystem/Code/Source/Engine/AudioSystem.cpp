@@ -103,18 +103,13 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushRequest(AudioRequestVariant&& request)
     {
-        AZStd::scoped_lock lock(m_pendingRequestsMutex);
-        m_pendingRequestsQueue.push_back(AZStd::move(request));
+        m_pendingRequestsQueue.Push(AZStd::move(request));
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushRequests(AudioRequestsQueue& requests)
     {
-        AZStd::scoped_lock lock(m_pendingRequestsMutex);
-        for (auto& request : requests)
-        {
-            m_pendingRequestsQueue.push_back(AZStd::move(request));
-        }
+        m_pendingRequestsQueue.Push(requests);
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,8 +133,7 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushCallback(AudioRequestVariant&& callback)
     {
-        AZStd::scoped_lock lock(m_pendingCallbacksMutex);
-        m_pendingCallbacksQueue.push_back(AZStd::move(callback));
+        m_pendingCallbacksQueue.Push(AZStd::move(callback));
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -150,10 +144,7 @@ namespace Audio
 
         {
             AudioRequestsQueue callbacksToProcess{};
-            {
-                AZStd::scoped_lock lock(m_pendingCallbacksMutex);
-                callbacksToProcess = AZStd::move(m_pendingCallbacksQueue);
-            }
+            m_pendingCallbacksQueue.PopAll(callbacksToProcess);
 
             while (!callbacksToProcess.empty())
             {
@@ -217,22 +208,11 @@ namespace Audio
 
         if (!handleBlockingRequest)
         {
-            // Normal request processing: lock and swap the pending requests queue
-            // so that the queue can be opened for new requests while the current set
-            // of requests can be processed.
+            // Normal request processing: take everything that has been pushed to the pending requests
+            // queue so that it stays open for new requests while the current set is processed.
             AudioRequestsQueue requestsToProcess{};
-            {
-                AZStd::scoped_lock lock(m_pendingRequestsMutex);
-                requestsToProcess = AZStd::move(m_pendingRequestsQueue);
-            }
-
-            while (!requestsToProcess.empty())
-            {
-                // Normal request...
-                AudioRequestVariant& request(requestsToProcess.front());
-                m_oATL.ProcessRequest(AZStd::move(request));
-                requestsToProcess.pop_front();
-            }
+            m_pendingRequestsQueue.PopAll(requestsToProcess);
+            m_oATL.ProcessRequests(requestsToProcess);
         }
 
         m_oATL.Update();
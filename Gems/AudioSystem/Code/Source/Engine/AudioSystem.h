@@ -11,6 +11,7 @@
 
 #include <ATL.h>
 #include <AudioAllocators.h>
+#include <AudioRequestQueue.h>
 
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/std/containers/deque.h>
@@ -113,12 +114,12 @@ namespace Audio
         CAudioTranslationLayer m_oATL;
         CAudioThread m_audioSystemThread;
 
+        // Blocking requests stall the main thread until they are processed, so they stay rare and
+        // a mutex is fine. Pending requests and callbacks are pushed from many threads every frame.
         AudioRequestsQueue m_blockingRequestsQueue;
-        AudioRequestsQueue m_pendingRequestsQueue;
-        AudioRequestsQueue m_pendingCallbacksQueue;
         AZStd::mutex m_blockingRequestsMutex;
-        AZStd::mutex m_pendingRequestsMutex;
-        AZStd::mutex m_pendingCallbacksMutex;
+        AudioRequestQueue m_pendingRequestsQueue;
+        AudioRequestQueue m_pendingCallbacksQueue;
 
         // Synchronization objects
         AZStd::binary_semaphore m_mainEvent;
@@ -42,6 +42,7 @@ namespace Audio
         eAFF_USE_COUNTED                    = AUDIO_BIT(5),
         eAFF_NEEDS_RESET_TO_MANUAL_LOADING  = AUDIO_BIT(6),
         eAFF_LOCALIZED                      = AUDIO_BIT(7),
+        eAFF_PREFETCHED                     = AUDIO_BIT(8),
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,6 +50,7 @@ namespace Audio
         : m_preloadRequests(preloadRequests)
         , m_currentByteTotal(0)
         , m_maxByteTotal(0)
+        , m_useStamp(0)
     {
     }
 
@@ -292,6 +294,59 @@ namespace Audio
                         : (fullFailure ? EAudioRequestStatus::Failure : EAudioRequestStatus::PartialSuccess));
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    EAudioRequestStatus CFileCacheManager::TryPrefetchRequest(
+        const TAudioPreloadRequestID preloadRequestID, const AZ::IO::IStreamerTypes::Deadline deadline)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        bool anyResident = false;
+
+        auto itPreload = m_preloadRequests.find(preloadRequestID);
+        if (itPreload != m_preloadRequests.end())
+        {
+            for (auto fileId : itPreload->second->m_cFileEntryIDs)
+            {
+                auto itFileEntry = m_audioFileEntries.find(fileId);
+                if (itFileEntry == m_audioFileEntries.end())
+                {
+                    continue;
+                }
+
+                CATLAudioFileEntry* const audioFileEntry = itFileEntry->second;
+
+                // Auto-loaded files are resident anyway, only manually loaded files benefit from a hint.
+                if (!audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_USE_COUNTED) || audioFileEntry->m_filePath.empty()
+                    || audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_NOTFOUND))
+                {
+                    continue;
+                }
+
+                audioFileEntry->m_lastUseStamp = ++m_useStamp;
+
+                if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_CACHED | eAFF_LOADING))
+                {
+                    anyResident = true;
+                    continue;
+                }
+
+                // A hint must never push out anything but older prefetched files, it is skipped when the cache is full.
+                if (DoesRequestFitInternal(audioFileEntry->m_fileSize, EvictionClass::Prefetched)
+                    && AllocateMemoryBlockInternal(audioFileEntry, EvictionClass::Prefetched))
+                {
+                    audioFileEntry->m_flags.AddFlags(eAFF_LOADING | eAFF_PREFETCHED | eAFF_REMOVABLE);
+                    QueueAsyncReadInternal(audioFileEntry, deadline, AZ::IO::IStreamerTypes::s_priorityLow);
+
+                    m_currentByteTotal += audioFileEntry->m_fileSize;
+                    ++m_stats.m_prefetches;
+                    anyResident = true;
+                }
+            }
+        }
+
+        return anyResident ? EAudioRequestStatus::Success : EAudioRequestStatus::Failure;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     EAudioRequestStatus CFileCacheManager::UnloadDataByScope(const EATLDataScope dataScope)
     {
@@ -382,6 +437,7 @@ namespace Audio
             AZ::Color blue{ 0.1f, 0.2f, 0.8f, originalAlpha };      // file is loading
             AZ::Color yellow{ 1.0f, 1.0f, 0.0f, originalAlpha };    // file is level scope
             AZ::Color darkish{ 0.3f, 0.3f, 0.3f, originalAlpha };   // file is not loaded
+            AZ::Color magenta{ 1.0f, 0.0f, 1.0f, originalAlpha };   // file was prefetched and not requested yet
 
             const bool displayAll = CVars::s_fcmDrawOptions.GetRawFlags() == 0;
             const bool displayGlobals = CVars::s_fcmDrawOptions.AreAllFlagsActive(static_cast<AZ::u32>(FileCacheManagerDebugDraw::Options::Global));
@@ -398,6 +454,22 @@ namespace Audio
             debugDisplay.Draw2dTextLabel(posX, positionY, entryDrawSize, str.c_str());
             positionY += entryStepSize;
 
+            const AZ::u64 numRequests = m_stats.m_hits + m_stats.m_misses;
+            str = AZStd::string::format(
+                "Hits: %llu (%.1f%%, %llu prefetched)  Misses: %llu  Prefetches: %llu  Evictions: %llu (%llu KiB)  "
+                "Load Latency: avg %llu ms, max %llu ms",
+                static_cast<unsigned long long>(m_stats.m_hits),
+                numRequests > 0 ? 100.0f * static_cast<float>(m_stats.m_hits) / static_cast<float>(numRequests) : 0.0f,
+                static_cast<unsigned long long>(m_stats.m_prefetchHits),
+                static_cast<unsigned long long>(m_stats.m_misses),
+                static_cast<unsigned long long>(m_stats.m_prefetches),
+                static_cast<unsigned long long>(m_stats.m_evictions),
+                static_cast<unsigned long long>(m_stats.m_evictedBytes >> 10),
+                static_cast<unsigned long long>(m_stats.m_loadsCompleted > 0 ? m_stats.m_totalLoadLatencyMs / m_stats.m_loadsCompleted : 0),
+                static_cast<unsigned long long>(m_stats.m_maxLoadLatencyMs));
+            debugDisplay.Draw2dTextLabel(posX, positionY, entryDrawSize, str.c_str());
+            positionY += entryStepSize;
+
             for (auto& audioFileEntryPair : m_audioFileEntries)
             {
                 AZ::Color& color = white;
@@ -419,6 +491,10 @@ namespace Audio
                     {
                         color = red;
                     }
+                    else if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_PREFETCHED))
+                    {
+                        color = magenta;
+                    }
                     else if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_REMOVABLE))
                     {
                         color = green;
@@ -472,7 +548,7 @@ namespace Audio
 #endif // !AUDIO_RELEASE
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    bool CFileCacheManager::DoesRequestFitInternal(const size_t requestSize)
+    bool CFileCacheManager::DoesRequestFitInternal(const size_t requestSize, const EvictionClass maxEvictionClass)
     {
         // Make sure these unsigned values don't flip around.
         AZ_Assert(m_currentByteTotal <= m_maxByteTotal, "FileCacheManager DoesRequestFitInternal - Unsigned wraparound detected!");
@@ -485,7 +561,7 @@ namespace Audio
         }
         else
         {
-            // Determine how much memory would get freed if all eAFF_REMOVABLE files get thrown out.
+            // Determine how much memory would get freed if all eAFF_REMOVABLE files that may be evicted get thrown out.
             // We however skip files that are already queued for unload. The request will get queued up in that case.
             size_t possibleMemoryGain = 0;
 
@@ -494,7 +570,8 @@ namespace Audio
             {
                 CATLAudioFileEntry* const audioFileEntry = audioFileEntryPair.second;
 
-                if (audioFileEntry && audioFileEntry->m_flags.AreAllFlagsActive(eAFF_CACHED | eAFF_REMOVABLE))
+                if (audioFileEntry && audioFileEntry->m_flags.AreAllFlagsActive(eAFF_CACHED | eAFF_REMOVABLE)
+                    && (maxEvictionClass == EvictionClass::Released || audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_PREFETCHED)))
                 {
                     possibleMemoryGain += audioFileEntry->m_fileSize;
                 }
@@ -505,7 +582,10 @@ namespace Audio
             if (requestSize <= maxAvailableSize)
             {
                 // Here we need to cleanup first before allowing the new request to be allocated.
-                TryToUncacheFiles();
+                // Only evict until the request fits, the other removable files stay cached for later requests.
+                while ((m_maxByteTotal - m_currentByteTotal) < requestSize && EvictLeastRecentlyUsed(maxEvictionClass))
+                {
+                }
 
                 // We should only indicate success if there's actually really enough room for the new entry!
                 success = (m_maxByteTotal - m_currentByteTotal) >= requestSize;
@@ -567,8 +647,15 @@ namespace Audio
                     audioFileEntry->m_flags.AddFlags(eAFF_CACHED);
                     audioFileEntry->m_flags.ClearFlags(eAFF_LOADING);
 
+                    const auto timeCached = AZStd::chrono::steady_clock::now();
+                    const AZ::u64 latencyMs = static_cast<AZ::u64>(
+                        AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(timeCached - audioFileEntry->m_timeRequested).count());
+                    ++m_stats.m_loadsCompleted;
+                    m_stats.m_totalLoadLatencyMs += latencyMs;
+                    m_stats.m_maxLoadLatencyMs = AZStd::max(m_stats.m_maxLoadLatencyMs, latencyMs);
+
 #if !defined(AUDIO_RELEASE)
-                    audioFileEntry->m_timeCached = AZStd::chrono::steady_clock::now();
+                    audioFileEntry->m_timeCached = timeCached;
 #endif // !AUDIO_RELEASE
 
                     SATLAudioFileEntryInfo fileEntryInfo;
@@ -626,7 +713,9 @@ namespace Audio
                 auto iter = m_audioFileEntries.find(fileId);
                 if (iter != m_audioFileEntries.end())
                 {
-                    cached = iter->second->m_flags.AreAnyFlagsActive(eAFF_CACHED);
+                    // Prefetched files are not loaded as far as the preload is concerned until they are requested.
+                    cached = iter->second->m_flags.AreAnyFlagsActive(eAFF_CACHED)
+                        && !iter->second->m_flags.AreAnyFlagsActive(eAFF_PREFETCHED);
                 }
                 allLoaded = (allLoaded && cached);
                 anyLoaded = (anyLoaded || cached);
@@ -649,7 +738,7 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    bool CFileCacheManager::AllocateMemoryBlockInternal(CATLAudioFileEntry* const audioFileEntry)
+    bool CFileCacheManager::AllocateMemoryBlockInternal(CATLAudioFileEntry* const audioFileEntry, const EvictionClass maxEvictionClass)
     {
         AZ_PROFILE_FUNCTION(Audio);
 
@@ -663,12 +752,10 @@ namespace Audio
             audioFileEntry->m_filePath.c_str(),
             __FILE__, __LINE__);
 
-        if (!audioFileEntry->m_memoryBlock)
+        // Memory block is either full or too fragmented, throw out the least recently used removable files one at a time
+        // and try again until the allocation succeeds or there is nothing left that may be evicted.
+        while (!audioFileEntry->m_memoryBlock && EvictLeastRecentlyUsed(maxEvictionClass))
         {
-            // Memory block is either full or too fragmented, let's try to throw everything out that can be removed and allocate again.
-            TryToUncacheFiles();
-
-            // And try again
             audioFileEntry->m_memoryBlock = AZ::AllocatorInstance<AudioBankAllocator>::Get().Allocate(
                 audioFileEntry->m_fileSize,
                 audioFileEntry->m_memoryBlockAlignment,
@@ -730,7 +817,7 @@ namespace Audio
             audioFileEntry->m_fileSize,
             audioFileEntry->m_memoryBlockAlignment
         );
-        audioFileEntry->m_flags.ClearFlags(eAFF_CACHED | eAFF_REMOVABLE);
+        audioFileEntry->m_flags.ClearFlags(eAFF_CACHED | eAFF_REMOVABLE | eAFF_PREFETCHED);
         m_currentByteTotal -= audioFileEntry->m_fileSize;
         AZ_Warning("FileCacheManager", audioFileEntry->m_useCount == 0, "Use-count of file '%s' is non-zero while uncaching it! Use Count: %d", audioFileEntry->m_filePath.c_str(), audioFileEntry->m_useCount);
         audioFileEntry->m_useCount = 0;
@@ -741,17 +828,91 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    void CFileCacheManager::TryToUncacheFiles()
+    bool CFileCacheManager::EvictLeastRecentlyUsed(const EvictionClass maxEvictionClass)
     {
+        // Prefetched files that were never requested go first, then the least recently used of the released files.
+        CATLAudioFileEntry* evictEntry = nullptr;
+        EvictionClass evictClass = maxEvictionClass;
+
         for (auto& audioFileEntryPair : m_audioFileEntries)
         {
             CATLAudioFileEntry* const audioFileEntry = audioFileEntryPair.second;
 
             if (audioFileEntry && audioFileEntry->m_flags.AreAllFlagsActive(eAFF_CACHED | eAFF_REMOVABLE))
             {
-                UncacheFileCacheEntryInternal(audioFileEntry, true);
+                const EvictionClass entryClass = audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_PREFETCHED)
+                    ? EvictionClass::Prefetched
+                    : EvictionClass::Released;
+
+                if (entryClass > maxEvictionClass)
+                {
+                    continue;
+                }
+
+                if (!evictEntry || entryClass < evictClass
+                    || (entryClass == evictClass && audioFileEntry->m_lastUseStamp < evictEntry->m_lastUseStamp))
+                {
+                    evictEntry = audioFileEntry;
+                    evictClass = entryClass;
+                }
             }
         }
+
+        if (!evictEntry)
+        {
+            return false;
+        }
+
+        const size_t fileSize = evictEntry->m_fileSize;
+        UncacheFileCacheEntryInternal(evictEntry, true);
+
+        // The implementation can refuse to unregister a file, stop evicting rather than picking the same file again.
+        if (evictEntry->m_flags.AreAnyFlagsActive(eAFF_CACHED))
+        {
+            return false;
+        }
+
+        ++m_stats.m_evictions;
+        m_stats.m_evictedBytes += fileSize;
+        AZLOG_DEBUG("FileCacheManager - Evicted '%s' to make room", evictEntry->m_filePath.c_str());
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void CFileCacheManager::QueueAsyncReadInternal(
+        CATLAudioFileEntry* const audioFileEntry,
+        const AZ::IO::IStreamerTypes::Deadline deadline,
+        const AZ::IO::IStreamerTypes::Priority priority)
+    {
+        auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        AZ_Assert(streamer, "FileCacheManager - Streamer should be ready!");
+
+        if (!audioFileEntry->m_asyncStreamRequest)
+        {
+            audioFileEntry->m_asyncStreamRequest = streamer->CreateRequest();
+        }
+
+        streamer->Read(
+            audioFileEntry->m_asyncStreamRequest,
+            audioFileEntry->m_filePath.c_str(),
+            audioFileEntry->m_memoryBlock,
+            audioFileEntry->m_fileSize,
+            audioFileEntry->m_fileSize,
+            deadline,
+            priority);
+
+        streamer->SetRequestCompleteCallback(
+            audioFileEntry->m_asyncStreamRequest,
+            [](AZ::IO::FileRequestHandle request)
+            {
+                AZ_PROFILE_FUNCTION(Audio);
+                AudioFileCacheManagerNotficationBus::QueueBroadcast(
+                    &AudioFileCacheManagerNotficationBus::Events::FinishAsyncStreamRequest,
+                    request);
+            });
+
+        audioFileEntry->m_timeRequested = AZStd::chrono::steady_clock::now();
+        streamer->QueueRequest(audioFileEntry->m_asyncStreamRequest);
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -801,9 +962,14 @@ namespace Audio
 
         bool success = false;
 
+        audioFileEntry->m_lastUseStamp = ++m_useStamp;
+
         if (!audioFileEntry->m_filePath.empty() && !audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_CACHED | eAFF_LOADING))
         {
-            if (DoesRequestFitInternal(audioFileEntry->m_fileSize) && AllocateMemoryBlockInternal(audioFileEntry))
+            ++m_stats.m_misses;
+
+            if (DoesRequestFitInternal(audioFileEntry->m_fileSize, EvictionClass::Released)
+                && AllocateMemoryBlockInternal(audioFileEntry, EvictionClass::Released))
             {
                 auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
                 AZ_Assert(streamer, "FileCacheManager - Streamer should be ready!");
@@ -812,6 +978,8 @@ namespace Audio
 
                 if (loadSynchronously)
                 {
+                    audioFileEntry->m_timeRequested = AZStd::chrono::steady_clock::now();
+
                     AZ::IO::FileRequestPtr request = streamer->Read(
                         audioFileEntry->m_filePath.c_str(),
                         audioFileEntry->m_memoryBlock,
@@ -840,32 +1008,13 @@ namespace Audio
                 }
                 else
                 {
-                    if (!audioFileEntry->m_asyncStreamRequest)
-                    {
-                        audioFileEntry->m_asyncStreamRequest = streamer->CreateRequest();
-                    }
-
-                    streamer->Read(
-                        audioFileEntry->m_asyncStreamRequest,
-                        audioFileEntry->m_filePath.c_str(),
-                        audioFileEntry->m_memoryBlock,
-                        audioFileEntry->m_fileSize,
-                        audioFileEntry->m_fileSize,
-                        AZ::IO::IStreamerTypes::s_noDeadline,
+                    const AZ::u32 deadlineMs = Audio::CVars::s_FileCacheManagerStreamDeadlineMs;
+                    QueueAsyncReadInternal(
+                        audioFileEntry,
+                        deadlineMs > 0 ? AZ::IO::IStreamerTypes::Deadline(AZStd::chrono::milliseconds(deadlineMs))
+                                       : AZ::IO::IStreamerTypes::s_noDeadline,
                         AZ::IO::IStreamerTypes::s_priorityHigh);
 
-                    streamer->SetRequestCompleteCallback(
-                        audioFileEntry->m_asyncStreamRequest,
-                        [](AZ::IO::FileRequestHandle request)
-                        {
-                            AZ_PROFILE_FUNCTION(Audio);
-                            AudioFileCacheManagerNotficationBus::QueueBroadcast(
-                                &AudioFileCacheManagerNotficationBus::Events::FinishAsyncStreamRequest,
-                                request);
-                        });
-
-                    streamer->QueueRequest(audioFileEntry->m_asyncStreamRequest);
-
                     // Increase total size even though async request is processing...
                     m_currentByteTotal += audioFileEntry->m_fileSize;
                     success = true;
@@ -887,6 +1036,22 @@ namespace Audio
         }
         else if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_CACHED | eAFF_LOADING))
         {
+            ++m_stats.m_hits;
+
+            if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_PREFETCHED))
+            {
+                ++m_stats.m_prefetchHits;
+                audioFileEntry->m_flags.ClearFlags(eAFF_PREFETCHED);
+
+                // The hint may have been generous, a file that is still loading is needed now.
+                if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_LOADING) && audioFileEntry->m_asyncStreamRequest)
+                {
+                    auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                    streamer->QueueRequest(streamer->RescheduleRequest(
+                        audioFileEntry->m_asyncStreamRequest, AZ::IO::IStreamerTypes::s_deadlineNow, AZ::IO::IStreamerTypes::s_priorityHigh));
+                }
+            }
+
             AZLOG_DEBUG(
                 "FileCacheManager - Skipping '%s' - it's either already loaded or currently loading!", audioFileEntry->m_filePath.c_str());
             success = true;
@@ -67,8 +67,27 @@ namespace Audio
 
         EAudioRequestStatus TryLoadRequest(const TAudioPreloadRequestID preloadRequestID, const bool loadSynchronously, const bool autoLoadOnly);
         EAudioRequestStatus TryUnloadRequest(const TAudioPreloadRequestID preloadRequestID);
+        EAudioRequestStatus TryPrefetchRequest(const TAudioPreloadRequestID preloadRequestID, const AZ::IO::IStreamerTypes::Deadline deadline);
         EAudioRequestStatus UnloadDataByScope(const EATLDataScope dataScope);
 
+        struct Stats
+        {
+            AZ::u64 m_hits = 0;                 // load requests for files that were already cached or loading
+            AZ::u64 m_misses = 0;               // load requests that had to start streaming the file
+            AZ::u64 m_prefetchHits = 0;         // hits on files that were brought in by a prefetch hint
+            AZ::u64 m_prefetches = 0;
+            AZ::u64 m_evictions = 0;
+            AZ::u64 m_evictedBytes = 0;
+            AZ::u64 m_loadsCompleted = 0;
+            AZ::u64 m_totalLoadLatencyMs = 0;
+            AZ::u64 m_maxLoadLatencyMs = 0;
+        };
+
+        const Stats& GetStats() const
+        {
+            return m_stats;
+        }
+
     #if !defined(AUDIO_RELEASE)
         void DrawDebugInfo(AzFramework::DebugDisplayRequests& debugDisplay, const float posX, const float posY);
     #endif // !AUDIO_RELEASE
@@ -77,10 +96,17 @@ namespace Audio
         // Internal type definitions.
         using TAudioFileEntries = ATLMapLookupType<TAudioFileEntryID, CATLAudioFileEntry*>;
 
+        // Which removable files may be evicted to make room, files of the lower classes are evicted first.
+        enum class EvictionClass : AZ::u8
+        {
+            Prefetched,     // streamed in on a hint but not requested yet
+            Released,       // use-counted files that are no longer in use
+        };
+
         // Internal methods
         void AllocateHeap(const size_t size, const char* const usage);
         bool UncacheFileCacheEntryInternal(CATLAudioFileEntry* const audioFileEntry, const bool now, const bool ignoreUsedCount = false);
-        bool DoesRequestFitInternal(const size_t requestSize);
+        bool DoesRequestFitInternal(const size_t requestSize, const EvictionClass maxEvictionClass);
         void UpdatePreloadRequestsStatus();
         bool FinishCachingFileInternal(CATLAudioFileEntry* const audioFileEntry, AZ::IO::SizeType sizeBytes,
             AZ::IO::IStreamerTypes::RequestStatus requestState);
@@ -90,9 +116,13 @@ namespace Audio
         void FinishAsyncStreamRequest(AZ::IO::FileRequestHandle request) override;
         ///////////////////////////////////////////////////////////////////////////////////////////
 
-        bool AllocateMemoryBlockInternal(CATLAudioFileEntry* const audioFileEntry);
+        bool AllocateMemoryBlockInternal(CATLAudioFileEntry* const audioFileEntry, const EvictionClass maxEvictionClass);
         void UncacheFile(CATLAudioFileEntry* const audioFileEntry);
-        void TryToUncacheFiles();
+        bool EvictLeastRecentlyUsed(const EvictionClass maxEvictionClass);
+        void QueueAsyncReadInternal(
+            CATLAudioFileEntry* const audioFileEntry,
+            const AZ::IO::IStreamerTypes::Deadline deadline,
+            const AZ::IO::IStreamerTypes::Priority priority);
         void UpdateLocalizedFileEntryData(CATLAudioFileEntry* const audioFileEntry);
         bool TryCacheFileCacheEntryInternal(
             CATLAudioFileEntry* const audioFileEntry,
@@ -107,5 +137,8 @@ namespace Audio
 
         size_t m_currentByteTotal;
         size_t m_maxByteTotal;
+
+        AZ::u64 m_useStamp;
+        Stats m_stats;
     };
 } // namespace Audio
@@ -121,6 +121,12 @@ namespace Audio::CVars
         "The size in KiB the File Cache Manager will use for banks.\n"
         "Usage: s_FileCacheManagerMemorySize=" AZ_TRAIT_AUDIOSYSTEM_FILE_CACHE_MANAGER_SIZE_DEFAULT_TEXT "\n");
 
+    AZ_CVAR(AZ::u32, s_FileCacheManagerStreamDeadlineMs, 250,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The deadline in milliseconds the File Cache Manager gives the streamer for asynchronous bank loads.\n"
+        "Prefetched banks use the deadline of the prefetch hint instead. 0 means no deadline.\n"
+        "Usage: s_FileCacheManagerStreamDeadlineMs=100\n");
+
     AZ_CVAR(AZ::u64, s_AudioEventPoolSize, AZ_TRAIT_AUDIOSYSTEM_AUDIO_EVENT_POOL_SIZE,
         nullptr, AZ::ConsoleFunctorFlags::Null,
         "The number of audio events to preallocate in a pool.\n"
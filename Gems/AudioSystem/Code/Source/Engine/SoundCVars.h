@@ -18,6 +18,7 @@ namespace Audio::CVars
 
     AZ_CVAR_EXTERNED(AZ::u64, s_ATLMemorySize);
     AZ_CVAR_EXTERNED(AZ::u64, s_FileCacheManagerMemorySize);
+    AZ_CVAR_EXTERNED(AZ::u32, s_FileCacheManagerStreamDeadlineMs);
     AZ_CVAR_EXTERNED(AZ::u64, s_AudioObjectPoolSize);
     AZ_CVAR_EXTERNED(AZ::u64, s_AudioEventPoolSize);
 
@@ -10,7 +10,11 @@
 #include <AzTest/Utils.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzFramework/IO/LocalFileIO.h>
@@ -20,6 +24,9 @@
 #include <ATLUtils.h>
 #include <ATL.h>
 #include <AudioProxy.h>
+#include <AudioRequestQueue.h>
+#include <FileCacheManager.h>
+#include <SoundCVars.h>
 
 #include <Mocks/ATLEntitiesMock.h>
 #include <Mocks/AudioSystemImplementationMock.h>
@@ -1234,3 +1241,409 @@ TEST_F(ATLTestFixture, AudioProxy_SimulateQueuedCommands_NumCommandsExecutedMatc
     EXPECT_CALL(m_sys, PushRequest).WillOnce(::testing::Return());
     m_proxy.Release();
 }
+
+TEST_F(ATLTestFixture, SetPositions_DefaultImplementation_SetsEachPosition)
+{
+    using ::testing::Return;
+    using ::testing::_;
+
+    EXPECT_CALL(m_impl, SetPosition(_, _))
+        .WillOnce(Return(EAudioRequestStatus::Success))
+        .WillOnce(Return(EAudioRequestStatus::Failure));
+
+    IATLAudioObjectData* objectData[2] = { nullptr, nullptr };
+    SATLWorldPosition positions[2] = { SATLWorldPosition(AZ::Vector3::CreateOne()), SATLWorldPosition(AZ::Vector3::CreateZero()) };
+    EAudioRequestStatus results[2] = { EAudioRequestStatus::None, EAudioRequestStatus::None };
+    AudioSystemImplementationRequestBus::Broadcast(
+        &AudioSystemImplementationRequestBus::Events::SetPositions, objectData, positions, results, 2);
+
+    EXPECT_EQ(results[0], EAudioRequestStatus::Success);
+    EXPECT_EQ(results[1], EAudioRequestStatus::Failure);
+}
+
+
+
+//---------------------------------------//
+// Test AudioRequestQueue and coalescing //
+//---------------------------------------//
+
+class AudioRequestQueueTestFixture
+    : public ::testing::Test
+{
+protected:
+    static Audio::ObjectRequest::SetPosition MakeSetPosition(TAudioObjectID objectId, float x)
+    {
+        Audio::ObjectRequest::SetPosition setPosition;
+        setPosition.m_audioObjectId = objectId;
+        setPosition.m_position = SATLWorldPosition(AZ::Vector3(x, 0.f, 0.f));
+        return setPosition;
+    }
+
+    static Audio::ObjectRequest::SetParameterValue MakeSetParameter(TAudioObjectID objectId, TAudioControlID parameterId, float value)
+    {
+        Audio::ObjectRequest::SetParameterValue setParameter;
+        setParameter.m_audioObjectId = objectId;
+        setParameter.m_parameterId = parameterId;
+        setParameter.m_value = value;
+        return setParameter;
+    }
+};
+
+TEST_F(AudioRequestQueueTestFixture, AudioRequestQueue_PushFromManyThreads_PopsAllInPushOrderPerThread)
+{
+    constexpr AZ::u32 numThreads = 4;
+    constexpr AZ::u32 numRequestsPerThread = 1000;
+
+    AudioRequestQueue queue;
+
+    AZStd::vector<AZStd::thread> threads;
+    for (AZ::u32 threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+    {
+        threads.emplace_back(
+            [&queue, threadIndex]()
+            {
+                for (AZ::u32 requestIndex = 0; requestIndex < numRequestsPerThread; ++requestIndex)
+                {
+                    // The object id identifies the thread and the value the order it was pushed in
+                    queue.Push(MakeSetParameter(threadIndex + 1, 1, static_cast<float>(requestIndex)));
+                }
+            });
+    }
+    for (AZStd::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    AudioRequestsQueue requests;
+    queue.PopAll(requests);
+    EXPECT_TRUE(queue.IsEmpty());
+    ASSERT_EQ(requests.size(), numThreads * numRequestsPerThread);
+
+    float lastValues[numThreads] = { -1.f, -1.f, -1.f, -1.f };
+    for (auto& requestVariant : requests)
+    {
+        auto setParameter = AZStd::get_if<Audio::ObjectRequest::SetParameterValue>(&requestVariant);
+        ASSERT_NE(setParameter, nullptr);
+        float& lastValue = lastValues[setParameter->m_audioObjectId - 1];
+        EXPECT_GT(setParameter->m_value, lastValue);
+        lastValue = setParameter->m_value;
+    }
+}
+
+TEST_F(AudioRequestQueueTestFixture, AudioRequestQueue_PushRequests_KeepsOrder)
+{
+    AudioRequestQueue queue;
+    queue.Push(MakeSetPosition(1, 0.f));
+
+    AudioRequestsQueue batch;
+    batch.push_back(MakeSetPosition(1, 1.f));
+    batch.push_back(MakeSetPosition(1, 2.f));
+    queue.Push(batch);
+    queue.Push(MakeSetPosition(1, 3.f));
+
+    AudioRequestsQueue requests;
+    queue.PopAll(requests);
+    ASSERT_EQ(requests.size(), 4);
+    for (size_t index = 0; index < requests.size(); ++index)
+    {
+        EXPECT_FLOAT_EQ(AZStd::get<Audio::ObjectRequest::SetPosition>(requests[index]).m_position.GetPositionVec().GetX(), static_cast<float>(index));
+    }
+}
+
+TEST_F(AudioRequestQueueTestFixture, CoalesceObjectUpdates_RepeatedUpdates_KeepsLastPerObjectAndParameter)
+{
+    AudioRequestsQueue requests;
+    requests.push_back(MakeSetPosition(1, 1.f));
+    requests.push_back(MakeSetParameter(1, 10, 0.1f));
+    requests.push_back(MakeSetPosition(2, 5.f));
+    requests.push_back(MakeSetPosition(1, 2.f));
+    requests.push_back(MakeSetParameter(1, 20, 0.5f));
+    requests.push_back(MakeSetParameter(1, 10, 0.2f));
+
+    EXPECT_EQ(CoalesceObjectUpdates(requests), 2);
+    ASSERT_EQ(requests.size(), 4);
+
+    EXPECT_EQ(AZStd::get<Audio::ObjectRequest::SetPosition>(requests[0]).m_audioObjectId, 2);
+    EXPECT_FLOAT_EQ(AZStd::get<Audio::ObjectRequest::SetPosition>(requests[1]).m_position.GetPositionVec().GetX(), 2.f);
+    EXPECT_EQ(AZStd::get<Audio::ObjectRequest::SetParameterValue>(requests[2]).m_parameterId, 20);
+    EXPECT_FLOAT_EQ(AZStd::get<Audio::ObjectRequest::SetParameterValue>(requests[3]).m_value, 0.2f);
+}
+
+TEST_F(AudioRequestQueueTestFixture, CoalesceObjectUpdates_OtherRequestOnObjectInBetween_KeepsBothUpdates)
+{
+    AudioRequestsQueue requests;
+    requests.push_back(MakeSetPosition(1, 1.f));
+    Audio::ObjectRequest::ExecuteTrigger executeTrigger;
+    executeTrigger.m_audioObjectId = 1;
+    requests.push_back(AZStd::move(executeTrigger));
+    requests.push_back(MakeSetPosition(1, 2.f));
+
+    // A system request is a barrier for every object
+    requests.push_back(MakeSetPosition(2, 1.f));
+    requests.push_back(Audio::SystemRequest::StopAllAudio());
+    requests.push_back(MakeSetPosition(2, 2.f));
+
+    // Updates with a callback are always kept
+    auto withCallback = MakeSetPosition(3, 1.f);
+    withCallback.m_callback = [](const Audio::ObjectRequest::SetPosition&) {};
+    requests.push_back(AZStd::move(withCallback));
+    requests.push_back(MakeSetPosition(3, 2.f));
+
+    EXPECT_EQ(CoalesceObjectUpdates(requests), 0);
+    EXPECT_EQ(requests.size(), 8);
+}
+
+
+
+//------------------------//
+// Test CFileCacheManager //
+//------------------------//
+
+class FileCacheManagerTestFixture
+    : public ::testing::Test
+{
+public:
+    AZ_TEST_CLASS_ALLOCATOR(FileCacheManagerTestFixture)
+
+    FileCacheManagerTestFixture()
+        : m_fileCacheManager(m_preloads)
+    {
+    }
+
+    void SetUp() override
+    {
+        using ::testing::_;
+        using ::testing::Invoke;
+        using ::testing::Return;
+
+        m_createdAllocators = !AZ::AllocatorInstance<AZ::PoolAllocator>::IsReady();
+        if (m_createdAllocators)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+            AZ::AllocatorInstance<Audio::AudioBankAllocator>::Create();
+        }
+
+        m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::FileIOBase::SetInstance(nullptr);
+        m_fileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+        AZ::IO::FileIOBase::SetInstance(m_fileIO.get());
+        m_fileIO->SetAlias(m_fileCacheTestAlias, m_tempDirectory.GetDirectory());
+
+        m_streamer = AZStd::make_unique<AZ::IO::Streamer>(AZStd::thread_desc{}, AZ::StreamerComponent::CreateStreamerStack());
+        AZ::Interface<AZ::IO::IStreamer>::Register(m_streamer.get());
+
+        ON_CALL(m_impl, ParseAudioFileEntry(_, _))
+            .WillByDefault(Invoke(
+                [this](const AZ::rapidxml::xml_node<char>*, SATLAudioFileEntryInfo* fileEntryInfo)
+                {
+                    fileEntryInfo->sFileName = m_nextFileName.c_str();
+                    fileEntryInfo->nMemoryBlockAlignment = 16;
+                    return EAudioRequestStatus::Success;
+                }));
+        ON_CALL(m_impl, GetAudioFileLocation(_)).WillByDefault(Return(m_fileCacheTestAlias));
+        ON_CALL(m_impl, RegisterInMemoryFile(_)).WillByDefault(Return(EAudioRequestStatus::Success));
+        ON_CALL(m_impl, UnregisterInMemoryFile(_)).WillByDefault(Return(EAudioRequestStatus::Success));
+        m_impl.BusConnect();
+
+        // Room for three files.
+        m_prevMemorySize = CVars::s_FileCacheManagerMemorySize;
+        CVars::s_FileCacheManagerMemorySize = 3 * FileSizeKiB;
+        m_fileCacheManager.Initialize();
+    }
+
+    void TearDown() override
+    {
+        for (TAudioFileEntryID fileId : m_fileIds)
+        {
+            m_fileCacheManager.TryRemoveFileCacheEntry(fileId, eADS_GLOBAL);
+        }
+        m_fileCacheManager.Release();
+        CVars::s_FileCacheManagerMemorySize = m_prevMemorySize;
+
+        for (auto& preloadPair : m_preloads)
+        {
+            azdestroy(preloadPair.second, Audio::AudioSystemAllocator);
+        }
+        m_preloads.clear();
+
+        m_impl.BusDisconnect();
+
+        AZ::Interface<AZ::IO::IStreamer>::Unregister(m_streamer.get());
+        m_streamer.reset();
+
+        m_fileIO->ClearAlias(m_fileCacheTestAlias);
+        AZ::IO::FileIOBase::SetInstance(nullptr);
+        m_fileIO.reset();
+        if (m_prevFileIO)
+        {
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+            m_prevFileIO = nullptr;
+        }
+
+        if (m_createdAllocators)
+        {
+            AZ::AllocatorInstance<Audio::AudioBankAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+    }
+
+    // Writes a file to disk, adds it to the file cache as a manually loaded file and creates a preload that only contains it.
+    TAudioPreloadRequestID AddPreloadWithFile(const char* fileName, bool autoLoad = false)
+    {
+        AZStd::string filePath = AZStd::string::format("%s/%s", m_fileCacheTestAlias, fileName);
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        EXPECT_TRUE(m_fileIO->Open(filePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle));
+        const AZStd::vector<AZ::u8> contents(FileSizeKiB << 10, AZ::u8{ 0xA5 });
+        m_fileIO->Write(fileHandle, contents.data(), contents.size());
+        m_fileIO->Close(fileHandle);
+
+        m_nextFileName = fileName;
+        const TAudioFileEntryID fileId = m_fileCacheManager.TryAddFileCacheEntry(nullptr, eADS_GLOBAL, autoLoad);
+        EXPECT_NE(fileId, INVALID_AUDIO_FILE_ENTRY_ID);
+        m_fileIds.push_back(fileId);
+
+        const TAudioPreloadRequestID preloadId = static_cast<TAudioPreloadRequestID>(m_preloads.size() + 1);
+        CATLPreloadRequest::TFileEntryIDs fileEntryIds;
+        fileEntryIds.push_back(fileId);
+        m_preloads[preloadId] =
+            azcreate(CATLPreloadRequest, (preloadId, eADS_GLOBAL, autoLoad, fileEntryIds), Audio::AudioSystemAllocator, "ATLPreloadRequest");
+        return preloadId;
+    }
+
+    EAudioRequestStatus Prefetch(TAudioPreloadRequestID preloadId)
+    {
+        return m_fileCacheManager.TryPrefetchRequest(preloadId, AZ::IO::IStreamerTypes::s_noDeadline);
+    }
+
+    // Pumps the file cache manager until the requested number of loads has finished streaming.
+    void WaitForLoadsCompleted(AZ::u64 loadsCompleted)
+    {
+        const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(10);
+        while (m_fileCacheManager.GetStats().m_loadsCompleted < loadsCompleted && AZStd::chrono::steady_clock::now() < timeout)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            m_fileCacheManager.Update();
+        }
+        ASSERT_EQ(m_fileCacheManager.GetStats().m_loadsCompleted, loadsCompleted);
+    }
+
+protected:
+    static constexpr AZ::u64 FileSizeKiB = 1;
+
+    TATLPreloadRequestLookup m_preloads;
+    CFileCacheManager m_fileCacheManager;
+    NiceMock<AudioSystemImplMock> m_impl;
+
+private:
+    const char* m_fileCacheTestAlias{ "@audiofilecachetest@" };
+    AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    AZ::IO::FileIOBase* m_prevFileIO{ nullptr };
+    AZStd::unique_ptr<AZ::IO::LocalFileIO> m_fileIO;
+    AZStd::unique_ptr<AZ::IO::Streamer> m_streamer;
+    AZStd::vector<TAudioFileEntryID> m_fileIds;
+    AZStd::string m_nextFileName;
+    AZ::u64 m_prevMemorySize = 0;
+    bool m_createdAllocators = false;
+};
+
+TEST_F(FileCacheManagerTestFixture, TryPrefetchRequest_CacheFull_EvictsLeastRecentlyUsedPrefetchedFile)
+{
+    const TAudioPreloadRequestID preloadA = AddPreloadWithFile("a.bnk");
+    const TAudioPreloadRequestID preloadB = AddPreloadWithFile("b.bnk");
+    const TAudioPreloadRequestID preloadC = AddPreloadWithFile("c.bnk");
+    const TAudioPreloadRequestID preloadD = AddPreloadWithFile("d.bnk");
+
+    EXPECT_EQ(Prefetch(preloadA), EAudioRequestStatus::Success);
+    EXPECT_EQ(Prefetch(preloadB), EAudioRequestStatus::Success);
+    EXPECT_EQ(Prefetch(preloadC), EAudioRequestStatus::Success);
+    WaitForLoadsCompleted(3);
+
+    // Hinting at A again makes B the least recently used file, so it's the one that makes room for D.
+    EXPECT_EQ(Prefetch(preloadA), EAudioRequestStatus::Success);
+    EXPECT_EQ(Prefetch(preloadD), EAudioRequestStatus::Success);
+    WaitForLoadsCompleted(4);
+
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_prefetches, 4);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_evictions, 1);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_evictedBytes, FileSizeKiB << 10);
+
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadA, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_prefetchHits, 1);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_misses, 0);
+
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadB, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_misses, 1);
+}
+
+TEST_F(FileCacheManagerTestFixture, TryPrefetchRequest_CacheFullOfFilesInUse_EvictsNothing)
+{
+    const TAudioPreloadRequestID preloadA = AddPreloadWithFile("a.bnk");
+    const TAudioPreloadRequestID preloadB = AddPreloadWithFile("b.bnk");
+    const TAudioPreloadRequestID preloadAuto = AddPreloadWithFile("auto.bnk", true);
+    const TAudioPreloadRequestID preloadC = AddPreloadWithFile("c.bnk");
+
+    // A and B are in use, the auto-loaded file can never be removed.
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadA, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadB, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadAuto, true, false), EAudioRequestStatus::Success);
+
+    EXPECT_EQ(Prefetch(preloadC), EAudioRequestStatus::Failure);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_prefetches, 0);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_evictions, 0);
+
+    // The files in use are still cached.
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadA, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadB, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadAuto, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_misses, 3);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_hits, 3);
+}
+
+TEST_F(FileCacheManagerTestFixture, TryLoadRequest_FilePrefetched_ServedFromCache)
+{
+    using ::testing::_;
+
+    const TAudioPreloadRequestID preloadA = AddPreloadWithFile("a.bnk");
+
+    // The file is only streamed and registered with the implementation once, by the prefetch.
+    EXPECT_CALL(m_impl, RegisterInMemoryFile(_)).Times(1);
+
+    EXPECT_EQ(Prefetch(preloadA), EAudioRequestStatus::Success);
+    WaitForLoadsCompleted(1);
+
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadA, false, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadA, false, false), EAudioRequestStatus::Success);
+
+    const CFileCacheManager::Stats& stats = m_fileCacheManager.GetStats();
+    EXPECT_EQ(stats.m_prefetches, 1);
+    EXPECT_EQ(stats.m_hits, 2);
+    EXPECT_EQ(stats.m_prefetchHits, 1);
+    EXPECT_EQ(stats.m_misses, 0);
+    EXPECT_EQ(stats.m_loadsCompleted, 1);
+}
+
+TEST_F(FileCacheManagerTestFixture, TryLoadRequest_LoadUnloadAndReload_CountsHitsMissesAndLoads)
+{
+    const TAudioPreloadRequestID preloadA = AddPreloadWithFile("a.bnk");
+
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadA, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadA, true, false), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_misses, 1);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_hits, 1);
+    EXPECT_EQ(m_fileCacheManager.GetStats().m_loadsCompleted, 1);
+
+    // Unloading drops the file once nothing uses it, so the next load streams it again.
+    EXPECT_EQ(m_fileCacheManager.TryUnloadRequest(preloadA), EAudioRequestStatus::Failure);
+    EXPECT_EQ(m_fileCacheManager.TryUnloadRequest(preloadA), EAudioRequestStatus::Success);
+    EXPECT_EQ(m_fileCacheManager.TryLoadRequest(preloadA, false, false), EAudioRequestStatus::Success);
+    WaitForLoadsCompleted(2);
+
+    const CFileCacheManager::Stats& stats = m_fileCacheManager.GetStats();
+    EXPECT_EQ(stats.m_misses, 2);
+    EXPECT_EQ(stats.m_hits, 1);
+    EXPECT_EQ(stats.m_prefetchHits, 0);
+    EXPECT_EQ(stats.m_evictions, 0);
+    EXPECT_GE(stats.m_totalLoadLatencyMs, stats.m_maxLoadLatencyMs);
+}
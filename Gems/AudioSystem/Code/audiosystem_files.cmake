@@ -19,6 +19,7 @@ set(FILES
     Source/Engine/ATLEntities.h
     Source/Engine/ATLUtils.h
     Source/Engine/AudioProxy.h
+    Source/Engine/AudioRequestQueue.h
     Source/Engine/AudioSystem.h
     Source/Engine/FileCacheManager.h
     Source/Engine/SoundCVars.h
@@ -28,6 +29,7 @@ set(FILES
     Source/Engine/ATLEntities.cpp
     Source/Engine/ATLUtils.cpp
     Source/Engine/AudioProxy.cpp
+    Source/Engine/AudioRequestQueue.cpp
     Source/Engine/AudioSystem.cpp
     Source/Engine/FileCacheManager.cpp
     Source/Engine/SoundCVars.cpp
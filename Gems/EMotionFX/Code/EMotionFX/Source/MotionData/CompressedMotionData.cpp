@@ -0,0 +1,1417 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        constexpr AZ::s32 s_maxQuantizedValue = 32767;
+
+        // Calculate the center and the quantization step size of the range of values of a single component.
+        void CalcQuantizationRange(const AZStd::vector<float>& values, size_t component, size_t numComponents, float& outOffset, float& outScale)
+        {
+            float minValue = AZStd::numeric_limits<float>::max();
+            float maxValue = -AZStd::numeric_limits<float>::max();
+            for (size_t i = component; i < values.size(); i += numComponents)
+            {
+                minValue = AZ::GetMin(minValue, values[i]);
+                maxValue = AZ::GetMax(maxValue, values[i]);
+            }
+
+            outOffset = (minValue + maxValue) * 0.5f;
+            outScale = (maxValue - minValue) * 0.5f / static_cast<float>(s_maxQuantizedValue);
+        }
+
+        AZ::s32 Quantize(float value, float offset, float scale)
+        {
+            if (scale <= 0.0f)
+            {
+                return 0;
+            }
+
+            const AZ::s32 quantized = static_cast<AZ::s32>(AZStd::lround((value - offset) / scale));
+            return AZ::GetClamp(quantized, -s_maxQuantizedValue, s_maxQuantizedValue);
+        }
+
+        // Pack two quantized values into a single integer. The low value is stored with an offset, so that it can be extracted
+        // with a mask, and the high value is stored in the upper 16 bits, so subtracting the low bits leaves the high value times 65536.
+        AZ::s32 Pack(AZ::s32 low, AZ::s32 high)
+        {
+            return high * 65536 + (low + 32768);
+        }
+
+        void Unpack(AZ::s32 packed, AZ::s32& outLow, AZ::s32& outHigh)
+        {
+            const AZ::s32 lowBits = packed & 0xFFFF;
+            outLow = lowBits - 32768;
+            outHigh = (packed - lowBits) / 65536;
+        }
+
+        // Decode the 8 quantized values of a record. The low halves hold the first 4 components, the high halves the last 4.
+        AZ_FORCE_INLINE void DecodeRecord(const AZ::s32* record, AZ::Simd::Vec4::FloatType& outLow, AZ::Simd::Vec4::FloatType& outHigh)
+        {
+            using AZ::Simd::Vec4;
+            const Vec4::Int32Type packed = Vec4::LoadUnaligned(record);
+            const Vec4::Int32Type lowBits = Vec4::And(packed, Vec4::Splat(static_cast<int32_t>(0xFFFF)));
+            outLow = Vec4::ConvertToFloat(Vec4::Sub(lowBits, Vec4::Splat(static_cast<int32_t>(32768))));
+            outHigh = Vec4::Mul(Vec4::ConvertToFloat(Vec4::Sub(packed, lowBits)), Vec4::Splat(1.0f / 65536.0f));
+        }
+
+        // Decode the records of two samples and interpolate between them, in the quantized domain.
+        AZ_FORCE_INLINE void DecodeAndInterpolateRecords(const AZ::s32* recordA, const AZ::s32* recordB, AZ::Simd::Vec4::FloatArgType weight,
+            AZ::Simd::Vec4::FloatType& outLow, AZ::Simd::Vec4::FloatType& outHigh)
+        {
+            using AZ::Simd::Vec4;
+            Vec4::FloatType lowA, highA, lowB, highB;
+            DecodeRecord(recordA, lowA, highA);
+            DecodeRecord(recordB, lowB, highB);
+            outLow = Vec4::Madd(Vec4::Sub(lowB, lowA), weight, lowA);
+            outHigh = Vec4::Madd(Vec4::Sub(highB, highA), weight, highA);
+        }
+
+        template <class T>
+        bool IsTrackWithinError(const AZStd::vector<T>& values, const T& staticValue, float maxError)
+        {
+            return AZStd::all_of(values.begin(), values.end(),
+                [&staticValue, maxError](const T& value)
+                {
+                    return value.IsClose(staticValue, maxError);
+                });
+        }
+
+        template <>
+        bool IsTrackWithinError(const AZStd::vector<AZ::Quaternion>& values, const AZ::Quaternion& staticValue, float maxError)
+        {
+            return AZStd::all_of(values.begin(), values.end(),
+                [&staticValue, maxError](const AZ::Quaternion& value)
+                {
+                    return value.IsClose(staticValue, maxError) || (-value).IsClose(staticValue, maxError);
+                });
+        }
+
+        bool IsTrackWithinError(const AZStd::vector<float>& values, float staticValue, float maxError)
+        {
+            return AZStd::all_of(values.begin(), values.end(),
+                [staticValue, maxError](float value)
+                {
+                    return AZ::IsClose(value, staticValue, maxError);
+                });
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Evenly Spaced Keyframes (fast, smaller)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        Clear();
+        CopyBaseMotionData(motionData);
+        SetSampleRate(sampleRate);
+        m_numSamples = numSamples;
+        if (updateDuration)
+        {
+            UpdateDuration();
+        }
+
+        // Joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            SourceJointData source;
+            if (motionData->IsJointAnimated(i))
+            {
+                const bool posAnimated = motionData->IsJointPositionAnimated(i);
+                const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+                if (posAnimated) { source.m_positions.resize(m_numSamples); }
+                if (rotAnimated) { source.m_rotations.resize(m_numSamples); }
+                EMFX_SCALECODE
+                (
+                    const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+                    if (scaleAnimated) { source.m_scales.resize(m_numSamples); }
+                )
+
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    const float keyTime = s * sampleSpacing;
+                    const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                    if (posAnimated) source.m_positions[s] = transform.m_position;
+                    if (rotAnimated) source.m_rotations[s] = transform.m_rotation.GetNormalized();
+                    EMFX_SCALECODE
+                    (
+                        if (scaleAnimated) source.m_scales[s] = transform.m_scale;
+                    )
+                }
+            }
+
+            EncodeJoint(i, source);
+        }
+
+        // Morphs.
+        AZStd::vector<float> values;
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!motionData->IsMorphAnimated(i))
+            {
+                continue;
+            }
+
+            values.resize(m_numSamples);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                values[s] = motionData->SampleMorph(s * sampleSpacing, i);
+            }
+            EncodeFloat(m_morphData[i], values);
+        }
+
+        // Floats.
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!motionData->IsFloatAnimated(i))
+            {
+                continue;
+            }
+
+            values.resize(m_numSamples);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                values[s] = motionData->SampleFloat(s * sampleSpacing, i);
+            }
+            EncodeFloat(m_floatData[i], values);
+        }
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        // Remove the tracks that stay within the error budget of their static value. The remaining tracks are quantized again,
+        // which also shrinks the ranges of the joints that only lost some of their tracks.
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            if (!IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            float maxPosError = settings.m_maxPosError;
+            float maxRotError = settings.m_maxRotError;
+            float maxScaleError = settings.m_maxScaleError;
+            if (AZStd::find(settings.m_jointIgnoreList.begin(), settings.m_jointIgnoreList.end(), i) != settings.m_jointIgnoreList.end())
+            {
+                maxPosError = 0.00001f;
+                maxRotError = 0.00001f;
+                maxScaleError = 0.00001f;
+            }
+
+            const Transform& staticTransform = m_staticJointData[i].m_staticTransform;
+            SourceJointData source = DecodeJoint(i);
+            bool modified = false;
+            if (!source.m_positions.empty() && IsTrackWithinError(source.m_positions, staticTransform.m_position, maxPosError))
+            {
+                source.m_positions.clear();
+                modified = true;
+            }
+            if (!source.m_rotations.empty() && IsTrackWithinError(source.m_rotations, staticTransform.m_rotation, maxRotError))
+            {
+                source.m_rotations.clear();
+                modified = true;
+            }
+            EMFX_SCALECODE
+            (
+                if (!source.m_scales.empty() && IsTrackWithinError(source.m_scales, staticTransform.m_scale, maxScaleError))
+                {
+                    source.m_scales.clear();
+                    modified = true;
+                }
+            )
+
+            if (modified)
+            {
+                EncodeJoint(i, source);
+            }
+
+            const JointData& jointData = m_jointData[i];
+            AZ_Warning("EMotionFX", CalcMaxQuantizationError(jointData, 0, 3) <= maxPosError && CalcMaxQuantizationError(jointData, 4, 4) <= maxRotError,
+                "The quantization error of joint '%s' (%f) exceeds the error budget. The range of its animation is too large for 16 bit values.",
+                GetJointName(i).c_str(), CalcMaxJointQuantizationError(i));
+        }
+
+        // Morphs.
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            FloatData& morphData = m_morphData[i];
+            if (morphData.m_samples.empty() ||
+                AZStd::find(settings.m_morphIgnoreList.begin(), settings.m_morphIgnoreList.end(), i) != settings.m_morphIgnoreList.end())
+            {
+                continue;
+            }
+
+            if (IsTrackWithinError(DecodeFloat(morphData), m_staticMorphData[i].m_staticValue, settings.m_maxMorphError))
+            {
+                morphData = {};
+            }
+        }
+
+        // Floats.
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            FloatData& floatData = m_floatData[i];
+            if (floatData.m_samples.empty() ||
+                AZStd::find(settings.m_floatIgnoreList.begin(), settings.m_floatIgnoreList.end(), i) != settings.m_floatIgnoreList.end())
+            {
+                continue;
+            }
+
+            if (IsTrackWithinError(DecodeFloat(floatData), m_staticFloatData[i].m_staticValue, settings.m_maxFloatError))
+            {
+                floatData = {};
+            }
+        }
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    void CompressedMotionData::EncodeJoint(size_t jointDataIndex, const SourceJointData& source)
+    {
+        JointData& jointData = m_jointData[jointDataIndex];
+        jointData = {};
+
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+        AZ::u8 flags = 0;
+        if (!source.m_positions.empty()) { flags |= PositionAnimated; }
+        if (!source.m_rotations.empty()) { flags |= RotationAnimated; }
+        EMFX_SCALECODE
+        (
+            if (!source.m_scales.empty()) { flags |= ScaleAnimated; }
+        )
+        jointData.m_flags = flags;
+
+        // Gather all components of all samples, using the static values for the tracks that are not animated.
+        // The rotations are kept in the same hemisphere as their previous sample, so that a linear interpolation is valid.
+        const size_t numSamples = (flags != 0) ? m_numSamples : 1;
+        AZStd::vector<float> values(numSamples * s_numComponents, 0.0f);
+        AZ::Quaternion previousRotation = staticTransform.m_rotation;
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            float* sampleValues = values.data() + s * s_numComponents;
+
+            const AZ::Vector3& position = (flags & PositionAnimated) ? source.m_positions[s] : staticTransform.m_position;
+            position.StoreToFloat3(sampleValues);
+
+            AZ::Quaternion rotation = (flags & RotationAnimated) ? source.m_rotations[s].GetNormalized() : staticTransform.m_rotation;
+            if (s > 0 && rotation.Dot(previousRotation) < 0.0f)
+            {
+                rotation = -rotation;
+            }
+            rotation.StoreToFloat4(sampleValues + 4);
+            previousRotation = rotation;
+
+#ifndef EMFX_SCALE_DISABLED
+            const AZ::Vector3& scale = (flags & ScaleAnimated) ? source.m_scales[s] : staticTransform.m_scale;
+            scale.StoreToFloat3(sampleValues + 8);
+#else
+            AZ::Vector3::CreateOne().StoreToFloat3(sampleValues + 8);
+#endif
+        }
+
+        // Range reduce all components. The components of the tracks that are not animated get a zero step size,
+        // so they decode to their static value.
+        const size_t componentFlags[s_numComponents] = {
+            PositionAnimated, PositionAnimated, PositionAnimated, 0,
+            RotationAnimated, RotationAnimated, RotationAnimated, RotationAnimated,
+            ScaleAnimated, ScaleAnimated, ScaleAnimated, 0 };
+        for (size_t c = 0; c < s_numComponents; ++c)
+        {
+            if (flags & componentFlags[c])
+            {
+                CalcQuantizationRange(values, c, s_numComponents, jointData.m_offsets[c], jointData.m_scales[c]);
+            }
+            else
+            {
+                jointData.m_offsets[c] = values[c];
+                jointData.m_scales[c] = 0.0f;
+            }
+        }
+
+        if (flags == 0)
+        {
+            return;
+        }
+
+        // Pack the samples into records. Lane i of the first record holds the position component i in the low half and the
+        // rotation component i in the high half. The second record holds the scale in its low halves.
+        const size_t sampleStride = (flags & ScaleAnimated) ? s_recordSize * 2 : s_recordSize;
+        jointData.m_sampleStride = static_cast<AZ::u8>(sampleStride);
+        jointData.m_samples.resize(m_numSamples * sampleStride);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            const float* sampleValues = values.data() + s * s_numComponents;
+            for (size_t i = 0; i < sampleStride; ++i)
+            {
+                const size_t record = i / s_recordSize;
+                const size_t lane = i % s_recordSize;
+                const size_t lowComponent = record * 8 + lane;
+                const size_t highComponent = lowComponent + 4;
+                const AZ::s32 low = Quantize(sampleValues[lowComponent], jointData.m_offsets[lowComponent], jointData.m_scales[lowComponent]);
+                const AZ::s32 high = (highComponent < s_numComponents) ? Quantize(sampleValues[highComponent], jointData.m_offsets[highComponent], jointData.m_scales[highComponent]) : 0;
+                jointData.m_samples[s * sampleStride + i] = Pack(low, high);
+            }
+        }
+    }
+
+    CompressedMotionData::SourceJointData CompressedMotionData::DecodeJoint(size_t jointDataIndex) const
+    {
+        SourceJointData result;
+        const JointData& jointData = m_jointData[jointDataIndex];
+        if (jointData.m_flags == 0)
+        {
+            return result;
+        }
+
+        AZStd::vector<float> values(m_numSamples * s_numComponents);
+        const size_t sampleStride = jointData.m_sampleStride;
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            float* sampleValues = values.data() + s * s_numComponents;
+            for (size_t c = 0; c < s_numComponents; ++c)
+            {
+                sampleValues[c] = jointData.m_offsets[c];
+            }
+
+            for (size_t i = 0; i < sampleStride; ++i)
+            {
+                const size_t lowComponent = (i / s_recordSize) * 8 + (i % s_recordSize);
+                const size_t highComponent = lowComponent + 4;
+                AZ::s32 low;
+                AZ::s32 high;
+                Unpack(jointData.m_samples[s * sampleStride + i], low, high);
+                sampleValues[lowComponent] += low * jointData.m_scales[lowComponent];
+                if (highComponent < s_numComponents)
+                {
+                    sampleValues[highComponent] += high * jointData.m_scales[highComponent];
+                }
+            }
+        }
+
+        if (jointData.m_flags & PositionAnimated)
+        {
+            result.m_positions.resize(m_numSamples);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                result.m_positions[s] = AZ::Vector3::CreateFromFloat3(values.data() + s * s_numComponents);
+            }
+        }
+
+        if (jointData.m_flags & RotationAnimated)
+        {
+            result.m_rotations.resize(m_numSamples);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                result.m_rotations[s] = AZ::Quaternion::CreateFromFloat4(values.data() + s * s_numComponents + 4).GetNormalized();
+            }
+        }
+
+        if (jointData.m_flags & ScaleAnimated)
+        {
+            result.m_scales.resize(m_numSamples);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                result.m_scales[s] = AZ::Vector3::CreateFromFloat3(values.data() + s * s_numComponents + 8);
+            }
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::EncodeFloat(FloatData& floatData, const AZStd::vector<float>& values)
+    {
+        CalcQuantizationRange(values, 0, 1, floatData.m_offset, floatData.m_scale);
+        floatData.m_samples.resize(values.size());
+        for (size_t s = 0; s < values.size(); ++s)
+        {
+            floatData.m_samples[s] = static_cast<AZ::s16>(Quantize(values[s], floatData.m_offset, floatData.m_scale));
+        }
+    }
+
+    AZStd::vector<float> CompressedMotionData::DecodeFloat(const FloatData& floatData)
+    {
+        AZStd::vector<float> values(floatData.m_samples.size());
+        for (size_t s = 0; s < values.size(); ++s)
+        {
+            values[s] = floatData.m_offset + floatData.m_samples[s] * floatData.m_scale;
+        }
+        return values;
+    }
+
+    float CompressedMotionData::CalcMaxQuantizationError(const JointData& jointData, size_t firstComponent, size_t numComponents)
+    {
+        // Rounding to the nearest step introduces at most half a step of error.
+        float maxScale = 0.0f;
+        for (size_t c = firstComponent; c < firstComponent + numComponents; ++c)
+        {
+            maxScale = AZ::GetMax(maxScale, jointData.m_scales[c]);
+        }
+        return maxScale * 0.5f;
+    }
+
+    float CompressedMotionData::CalcMaxJointQuantizationError(size_t jointDataIndex) const
+    {
+        return CalcMaxQuantizationError(m_jointData[jointDataIndex], 0, s_numComponents);
+    }
+
+    size_t CompressedMotionData::CalcSampleDataSizeInBytes() const
+    {
+        size_t numBytes = 0;
+        for (const JointData& jointData : m_jointData)
+        {
+            if (jointData.m_flags != 0)
+            {
+                numBytes += jointData.m_samples.size() * sizeof(AZ::s32);
+                numBytes += sizeof(jointData.m_offsets) + sizeof(jointData.m_scales);
+            }
+        }
+
+        for (const AZStd::vector<FloatData>* floatDatas : { &m_morphData, &m_floatData })
+        {
+            for (const FloatData& floatData : *floatDatas)
+            {
+                if (!floatData.m_samples.empty())
+                {
+                    numBytes += floatData.m_samples.size() * sizeof(AZ::s16) + sizeof(float) * 2;
+                }
+            }
+        }
+
+        return numBytes;
+    }
+
+    Transform CompressedMotionData::SampleJointData(size_t jointDataIndex, size_t indexA, size_t indexB, float t) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const size_t sampleStride = jointData.m_sampleStride;
+        if (sampleStride == 0)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform;
+        }
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType weight = Vec4::Splat(t);
+        const AZ::s32* recordA = jointData.m_samples.data() + indexA * sampleStride;
+        const AZ::s32* recordB = jointData.m_samples.data() + indexB * sampleStride;
+
+        Vec4::FloatType low;
+        Vec4::FloatType high;
+        DecodeAndInterpolateRecords(recordA, recordB, weight, low, high);
+
+        Transform result;
+        const Vec4::FloatType position = Vec4::Madd(low, Vec4::LoadUnaligned(&jointData.m_scales[0]), Vec4::LoadUnaligned(&jointData.m_offsets[0]));
+        const Vec4::FloatType rotation = Vec4::Madd(high, Vec4::LoadUnaligned(&jointData.m_scales[4]), Vec4::LoadUnaligned(&jointData.m_offsets[4]));
+        result.m_position = AZ::Vector3(Vec4::ToVec3(position));
+        result.m_rotation = AZ::Quaternion(rotation).GetNormalized();
+
+#ifndef EMFX_SCALE_DISABLED
+        if (sampleStride > s_recordSize)
+        {
+            DecodeAndInterpolateRecords(recordA + s_recordSize, recordB + s_recordSize, weight, low, high);
+            const Vec4::FloatType scale = Vec4::Madd(low, Vec4::LoadUnaligned(&jointData.m_scales[8]), Vec4::LoadUnaligned(&jointData.m_offsets[8]));
+            result.m_scale = AZ::Vector3(Vec4::ToVec3(scale));
+        }
+        else
+        {
+            result.m_scale = m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        }
+#endif
+
+        return result;
+    }
+
+    float CompressedMotionData::SampleFloatData(const FloatData& floatData, float staticValue, size_t indexA, size_t indexB, float t)
+    {
+        if (floatData.m_samples.empty())
+        {
+            return staticValue;
+        }
+
+        const float quantized = AZ::Lerp(static_cast<float>(floatData.m_samples[indexA]), static_cast<float>(floatData.m_samples[indexB]), t);
+        return floatData.m_offset + quantized * floatData.m_scale;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex && !inPlace)
+        {
+            result = SampleJointData(jointDataIndex, indexA, indexB, t);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = SampleJointData(jointDataIndex, indexA, indexB, t);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                outputPose->SetMorphWeight(i, SampleFloatData(m_morphData[realIndex], m_staticMorphData[realIndex].m_staticValue, indexA, indexB, t));
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleFloatData(m_morphData[morphDataIndex], m_staticMorphData[morphDataIndex].m_staticValue, indexA, indexB, t);
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleFloatData(m_floatData[floatDataIndex], m_staticFloatData[floatDataIndex].m_staticValue, indexA, indexB, t);
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleJointData(jointDataIndex, indexA, indexB, t);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleJointTransform(sampleTime, jointDataIndex).m_position;
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleJointTransform(sampleTime, jointDataIndex).m_rotation;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        return SampleJointTransform(sampleTime, jointDataIndex).m_scale;
+    }
+#endif
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointData.resize(numJoints);
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        m_jointData.erase(m_jointData.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the range of the positions scales all of its samples.
+        for (JointData& jointData : m_jointData)
+        {
+            for (size_t c = 0; c < 3; ++c)
+            {
+                jointData.m_offsets[c] *= scaleFactor;
+                jointData.m_scales[c] *= scaleFactor;
+            }
+        }
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return (m_jointData[jointDataIndex].m_flags & PositionAnimated) != 0;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return (m_jointData[jointDataIndex].m_flags & RotationAnimated) != 0;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return (m_jointData[jointDataIndex].m_flags & ScaleAnimated) != 0;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_flags != 0;
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return !m_morphData[morphDataIndex].m_samples.empty();
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return !m_floatData[floatDataIndex].m_samples.empty();
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            EncodeJoint(i, {});
+        }
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (FloatData& data : m_morphData)
+        {
+            data = {};
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (FloatData& data : m_floatData)
+        {
+            data = {};
+        }
+    }
+
+    // Clearing a single track re-quantizes the joint, as the record layout depends on which tracks are animated.
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        SourceJointData source = DecodeJoint(jointDataIndex);
+        source.m_positions.clear();
+        EncodeJoint(jointDataIndex, source);
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        SourceJointData source = DecodeJoint(jointDataIndex);
+        source.m_rotations.clear();
+        EncodeJoint(jointDataIndex, source);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        SourceJointData source = DecodeJoint(jointDataIndex);
+        source.m_scales.clear();
+        EncodeJoint(jointDataIndex, source);
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        EncodeJoint(jointDataIndex, {});
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphData[morphDataIndex] = {};
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatData[floatDataIndex] = {};
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        AZ::u8                          m_flags = 0; // The animated tracks (see CompressedMotionData::TrackFlags).
+        AZ::u8                          m_sampleStride = 0; // The number of packed integers per sample.
+
+        // Followed by:
+        // string : The name of the joint.
+        // float[12] : The range offsets (only when m_flags is not zero).
+        // float[12] : The range scales (only when m_flags is not zero).
+        // AZ::s32[ File_CompressedMotionData_Info.m_numSamples * m_sampleStride ] : The packed samples.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+        float m_offset = 0.0f;      // The center of the range of the samples.
+        float m_scale = 0.0f;       // The quantization step size.
+        AZ::u8 m_isAnimated = 0;    // Set when the samples follow.
+
+        // Followed by:
+        // String: The name of the channel.
+        // AZ::s16[ File_CompressedMotionData_Info.m_numSamples ] (only when m_isAnimated is set).
+    };
+    //---------------------------------------------------------------------------------------
+
+    bool CompressedMotionData::SaveJoint(MCore::Stream* stream, size_t jointDataIndex, const SaveSettings& saveSettings) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+        const Transform& bindTransform = m_staticJointData[jointDataIndex].m_bindTransform;
+
+        File_CompressedMotionData_Joint jointChunk;
+        ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(staticTransform.m_position));
+        ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, staticTransform.m_rotation);
+        ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(bindTransform.m_position));
+        ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, bindTransform.m_rotation);
+        EMFX_SCALECODE
+        (
+            ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(staticTransform.m_scale));
+            ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(bindTransform.m_scale));
+        )
+        jointChunk.m_flags = jointData.m_flags;
+        jointChunk.m_sampleStride = jointData.m_sampleStride;
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(jointDataIndex).c_str());
+            MCore::LogDetailedInfo("   + Position Animated:     %s", (jointData.m_flags & PositionAnimated) ? "Yes" : "No");
+            MCore::LogDetailedInfo("   + Rotation Animated:     %s", (jointData.m_flags & RotationAnimated) ? "Yes" : "No");
+            MCore::LogDetailedInfo("   + Scale Animated:        %s", (jointData.m_flags & ScaleAnimated) ? "Yes" : "No");
+            MCore::LogDetailedInfo("   + Quantization Error:    %f", CalcMaxJointQuantizationError(jointDataIndex));
+        }
+
+        // Convert endian.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+        ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+        ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+        if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+        {
+            return false;
+        }
+
+        ExporterLib::SaveString(GetJointName(jointDataIndex), stream, targetEndianType);
+        if (jointData.m_flags == 0)
+        {
+            return true;
+        }
+
+        // Write the ranges.
+        AZStd::array<float, s_numComponents * 2> ranges;
+        AZStd::copy(jointData.m_offsets.begin(), jointData.m_offsets.end(), ranges.begin());
+        AZStd::copy(jointData.m_scales.begin(), jointData.m_scales.end(), ranges.begin() + s_numComponents);
+        for (float& value : ranges)
+        {
+            ExporterLib::ConvertFloat(&value, targetEndianType);
+        }
+        if (stream->Write(ranges.data(), sizeof(float) * ranges.size()) == 0)
+        {
+            return false;
+        }
+
+        // Write the packed samples.
+        AZStd::vector<AZ::s32> samples = jointData.m_samples;
+        for (AZ::s32& value : samples)
+        {
+            ExporterLib::ConvertInt(&value, targetEndianType);
+        }
+        return stream->Write(samples.data(), sizeof(AZ::s32) * samples.size()) != 0;
+    }
+
+    bool CompressedMotionData::SaveFloat(MCore::Stream* stream, const FloatData& floatData, const AZStd::string& name, float staticValue, const SaveSettings& saveSettings) const
+    {
+        if (name.empty())
+        {
+            MCore::LogError("Cannot save float channel with empty name.");
+            return false;
+        }
+
+        File_CompressedMotionData_Float floatChunk;
+        floatChunk.m_staticValue = staticValue;
+        floatChunk.m_offset = floatData.m_offset;
+        floatChunk.m_scale = floatData.m_scale;
+        floatChunk.m_isAnimated = floatData.m_samples.empty() ? 0 : 1;
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("    - Float Channel: '%s'", name.c_str());
+            MCore::LogDetailedInfo("       + Static Weight = %f", floatChunk.m_staticValue);
+            MCore::LogDetailedInfo("       + IsAnimated    = %s", floatChunk.m_isAnimated ? "Yes" : "No");
+        }
+
+        // Convert endian.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+        ExporterLib::ConvertFloat(&floatChunk.m_offset, targetEndianType);
+        ExporterLib::ConvertFloat(&floatChunk.m_scale, targetEndianType);
+        if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+        {
+            return false;
+        }
+        ExporterLib::SaveString(name, stream, targetEndianType);
+
+        if (floatData.m_samples.empty())
+        {
+            return true;
+        }
+
+        AZStd::vector<AZ::s16> samples = floatData.m_samples;
+        for (AZ::s16& value : samples)
+        {
+            ExporterLib::ConvertUnsignedShort(reinterpret_cast<AZ::u16*>(&value), targetEndianType);
+        }
+        return stream->Write(samples.data(), sizeof(AZ::s16) * samples.size()) != 0;
+    }
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            const JointData& jointData = m_jointData[i];
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+            if (jointData.m_flags != 0)
+            {
+                numBytes += sizeof(float) * s_numComponents * 2;
+                numBytes += sizeof(AZ::s32) * jointData.m_samples.size();
+            }
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+            numBytes += sizeof(AZ::s16) * m_morphData[i].m_samples.size();
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+            numBytes += sizeof(AZ::s16) * m_floatData[i].m_samples.size();
+        }
+
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_sampleRate = GetSampleRate();
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < GetNumJoints(); i++)
+        {
+            if (!SaveJoint(stream, i, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); i++)
+        {
+            if (!SaveFloat(stream, m_morphData[i], GetMorphName(i), GetMorphStaticValue(i), saveSettings))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); i++)
+        {
+            if (!SaveFloat(stream, m_floatData[i], GetFloatName(i), GetFloatStaticValue(i), saveSettings))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadFloat(MCore::Stream* stream, FloatData& outFloatData, AZStd::string& outName, float& outStaticValue, const ReadSettings& readSettings) const
+    {
+        File_CompressedMotionData_Float floatInfo;
+        if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+        {
+            return false;
+        }
+
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+        MCore::Endian::ConvertFloat(&floatInfo.m_offset, sourceEndianType);
+        MCore::Endian::ConvertFloat(&floatInfo.m_scale, sourceEndianType);
+        outName = MotionData::ReadStringFromStream(stream, sourceEndianType);
+        outStaticValue = floatInfo.m_staticValue;
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("  + Float: '%s'", outName.c_str());
+            MCore::LogDetailedInfo("       + IsAnimated   = %s", floatInfo.m_isAnimated ? "Yes" : "No");
+            MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+        }
+
+        outFloatData = {};
+        if (floatInfo.m_isAnimated && m_numSamples > 0)
+        {
+            outFloatData.m_offset = floatInfo.m_offset;
+            outFloatData.m_scale = floatInfo.m_scale;
+            outFloatData.m_samples.resize(m_numSamples);
+            if (stream->Read(outFloatData.m_samples.data(), sizeof(AZ::s16) * m_numSamples) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertSignedInt16(outFloatData.m_samples.data(), sourceEndianType, static_cast<AZ::u32>(m_numSamples));
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        // Initialize the motion data.
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        m_numSamples = info.m_numSamples;
+        SetSampleRate(info.m_sampleRate);
+        UpdateDuration();
+
+        // Read all joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            const AZStd::string name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - IsPosAnimated   = %s", (jointInfo.m_flags & PositionAnimated) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsRotAnimated   = %s", (jointInfo.m_flags & RotationAnimated) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsScaleAnimated = %s", (jointInfo.m_flags & ScaleAnimated) ? "Yes" : "No");
+            }
+
+            JointData& jointData = m_jointData[i];
+            if (jointInfo.m_flags == 0)
+            {
+                // Make the joint decode to its static transform.
+                EncodeJoint(i, {});
+                continue;
+            }
+
+            if (jointInfo.m_sampleStride != s_recordSize && jointInfo.m_sampleStride != s_recordSize * 2)
+            {
+                AZ_Error("EMotionFX", false, "Invalid sample stride (%d) for joint '%s'.", jointInfo.m_sampleStride, name.c_str());
+                return false;
+            }
+
+            // Read the ranges.
+            AZStd::array<float, s_numComponents * 2> ranges;
+            if (stream->Read(ranges.data(), sizeof(float) * ranges.size()) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(ranges.data(), sourceEndianType, static_cast<AZ::u32>(ranges.size()));
+            AZStd::copy(ranges.begin(), ranges.begin() + s_numComponents, jointData.m_offsets.begin());
+            AZStd::copy(ranges.begin() + s_numComponents, ranges.end(), jointData.m_scales.begin());
+
+            // Read all packed samples at once.
+            jointData.m_flags = jointInfo.m_flags;
+            jointData.m_sampleStride = jointInfo.m_sampleStride;
+            jointData.m_samples.resize(m_numSamples * jointData.m_sampleStride);
+            if (!jointData.m_samples.empty())
+            {
+                if (stream->Read(jointData.m_samples.data(), sizeof(AZ::s32) * jointData.m_samples.size()) == 0)
+                {
+                    return false;
+                }
+                MCore::Endian::ConvertSignedInt32(jointData.m_samples.data(), sourceEndianType, static_cast<AZ::u32>(jointData.m_samples.size()));
+            }
+        }
+
+        // Read the morphs and floats.
+        AZStd::string name;
+        float staticValue = 0.0f;
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!ReadFloat(stream, m_morphData[i], name, staticValue, readSettings))
+            {
+                return false;
+            }
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, staticValue);
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!ReadFloat(stream, m_floatData[i], name, staticValue, readSettings))
+            {
+                return false;
+            }
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, staticValue);
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    //! Evenly spaced keyframes that are quantized to 16 bits per value.
+    //! Every track is range reduced before quantization, so the 16 bits are spent on the range the track actually uses.
+    //! The position, rotation and scale samples of a joint are interleaved into 16 byte records, so that the two samples we
+    //! interpolate between are next to each other in memory, and decoding a record takes a handful of SIMD instructions.
+    //! This makes the data smaller than UniformMotionData while sampling at about the same speed.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{AB8C66BD-E8F6-4ACB-BD14-CBFFC34B7AA6}", MotionData)
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+        //! The number of bytes used by the quantized samples and the range reduction data of all tracks.
+        size_t CalcSampleDataSizeInBytes() const;
+
+        //! The largest error the quantization introduces in any of the position, rotation or scale values of a joint.
+        float CalcMaxJointQuantizationError(size_t jointDataIndex) const;
+
+    private:
+        enum TrackFlags : AZ::u8
+        {
+            PositionAnimated = 1 << 0,
+            RotationAnimated = 1 << 1,
+            ScaleAnimated = 1 << 2
+        };
+
+        static constexpr size_t s_recordSize = 4; //!< The number of packed integers in a record, each holding two quantized values.
+        static constexpr size_t s_numComponents = 12; //!< Position (3 + padding), rotation (4) and scale (3 + padding).
+
+        struct EMFX_API JointData
+        {
+            //! The packed samples. Every sample holds a record with the position and rotation, followed by a record with the
+            //! scale when the scale is animated. Components that are not animated decode to their static value.
+            AZStd::vector<AZ::s32> m_samples;
+            AZStd::array<float, s_numComponents> m_offsets = {}; //!< The center of the range of each component.
+            AZStd::array<float, s_numComponents> m_scales = {};  //!< The size of a quantization step of each component.
+            AZ::u8 m_flags = 0;
+            AZ::u8 m_sampleStride = 0; //!< The number of packed integers per sample (0, 4 or 8).
+        };
+
+        struct EMFX_API FloatData
+        {
+            AZStd::vector<AZ::s16> m_samples;
+            float m_offset = 0.0f;
+            float m_scale = 0.0f;
+        };
+
+        //! Uncompressed samples of a joint, used while building or optimizing the compressed data.
+        struct EMFX_API SourceJointData
+        {
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+            AZStd::vector<AZ::Vector3> m_scales;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+        void EncodeJoint(size_t jointDataIndex, const SourceJointData& source);
+        SourceJointData DecodeJoint(size_t jointDataIndex) const;
+        static void EncodeFloat(FloatData& floatData, const AZStd::vector<float>& values);
+        static AZStd::vector<float> DecodeFloat(const FloatData& floatData);
+        static float CalcMaxQuantizationError(const JointData& jointData, size_t firstComponent, size_t numComponents);
+        Transform SampleJointData(size_t jointDataIndex, size_t indexA, size_t indexB, float t) const;
+        static float SampleFloatData(const FloatData& floatData, float staticValue, size_t indexA, size_t indexB, float t);
+
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+        bool ReadFloat(MCore::Stream* stream, FloatData& outFloatData, AZStd::string& outName, float& outStaticValue, const ReadSettings& readSettings) const;
+        bool SaveJoint(MCore::Stream* stream, size_t jointDataIndex, const SaveSettings& saveSettings) const;
+        bool SaveFloat(MCore::Stream* stream, const FloatData& floatData, const AZStd::string& name, float staticValue, const SaveSettings& saveSettings) const;
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<FloatData> m_morphData;
+        AZStd::vector<FloatData> m_floatData;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
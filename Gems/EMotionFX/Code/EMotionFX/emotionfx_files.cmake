@@ -348,6 +348,8 @@ set(FILES
     Source/MotionData/MotionDataFactory.cpp
     Source/MotionData/MotionDataFactory.h
     Source/MotionData/MotionDataSampleSettings.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/NonUniformMotionData.cpp
     Source/MotionData/NonUniformMotionData.h
     Source/MotionData/UniformMotionData.cpp
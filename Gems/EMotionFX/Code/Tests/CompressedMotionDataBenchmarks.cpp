@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <MCore/Source/MCoreSystem.h>
+
+namespace EMotionFX
+{
+    //! Compares the memory footprint and the sampling speed of the compressed and the uniform motion data, on a motion
+    //! with the size of a typical character animation. The "SampleDataKB" counter is the size of the saved motion data.
+    class CompressedMotionDataBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t s_numJoints = 80;
+        static constexpr size_t s_numKeys = 301;
+        static constexpr float s_duration = 10.0f;
+        static constexpr size_t s_numSampleTimes = 16;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void InternalSetUp()
+        {
+            MCore::Initializer::Init();
+            Allocators::Create();
+
+            m_sourceData = aznew NonUniformMotionData();
+            for (size_t joint = 0; joint < s_numJoints; ++joint)
+            {
+                const Transform bindTransform(AZ::Vector3(0.0f, 0.1f, 0.0f), AZ::Quaternion::CreateIdentity());
+                m_sourceData->AddJoint(AZStd::string::format("Joint%zu", joint), bindTransform, bindTransform);
+
+                // Every joint rotates, and one in four joints also moves.
+                const bool hasPosition = (joint % 4) == 0;
+                if (hasPosition)
+                {
+                    m_sourceData->AllocateJointPositionSamples(joint, s_numKeys);
+                }
+                m_sourceData->AllocateJointRotationSamples(joint, s_numKeys);
+
+                const float phase = static_cast<float>(joint) * 0.37f;
+                for (size_t i = 0; i < s_numKeys; ++i)
+                {
+                    const float time = s_duration * static_cast<float>(i) / static_cast<float>(s_numKeys - 1);
+                    if (hasPosition)
+                    {
+                        m_sourceData->SetJointPositionSample(joint, i, { time, AZ::Vector3(AZStd::sin(time + phase), 0.1f, AZStd::cos(time * 2.0f + phase)) });
+                    }
+                    const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationX(AZStd::sin(time * 3.0f + phase)) * AZ::Quaternion::CreateRotationY(AZStd::cos(time + phase));
+                    m_sourceData->SetJointRotationSample(joint, i, { time, rotation });
+                }
+            }
+            m_sourceData->UpdateDuration();
+
+            for (size_t i = 0; i < s_numSampleTimes; ++i)
+            {
+                m_sampleTimes[i] = s_duration * (static_cast<float>(i) + 0.31f) / static_cast<float>(s_numSampleTimes);
+            }
+        }
+
+        void InternalTearDown()
+        {
+            delete m_sourceData;
+            m_sourceData = nullptr;
+
+            Allocators::Destroy();
+            MCore::Initializer::Shutdown();
+        }
+
+        void RunSampling(const MotionData& motionData, benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (const float sampleTime : m_sampleTimes)
+                {
+                    for (size_t joint = 0; joint < s_numJoints; ++joint)
+                    {
+                        Transform transform = motionData.SampleJointTransform(sampleTime, joint);
+                        benchmark::DoNotOptimize(transform);
+                    }
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * s_numSampleTimes * s_numJoints);
+            state.counters["SampleDataKB"] = static_cast<double>(motionData.CalcStreamSaveSizeInBytes({})) / 1024.0;
+        }
+
+        NonUniformMotionData* m_sourceData = nullptr;
+        float m_sampleTimes[s_numSampleTimes] = {};
+    };
+
+    BENCHMARK_DEFINE_F(CompressedMotionDataBenchmarkFixture, BM_UniformMotionDataSampleJoints)(benchmark::State& state)
+    {
+        UniformMotionData motionData;
+        motionData.InitFromNonUniformData(m_sourceData, true, 30.0f, true);
+        RunSampling(motionData, state);
+    }
+    BENCHMARK_REGISTER_F(CompressedMotionDataBenchmarkFixture, BM_UniformMotionDataSampleJoints)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(CompressedMotionDataBenchmarkFixture, BM_CompressedMotionDataSampleJoints)(benchmark::State& state)
+    {
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(m_sourceData, true, 30.0f, true);
+        RunSampling(motionData, state);
+    }
+    BENCHMARK_REGISTER_F(CompressedMotionDataBenchmarkFixture, BM_CompressedMotionDataSampleJoints)->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX
+
+#endif
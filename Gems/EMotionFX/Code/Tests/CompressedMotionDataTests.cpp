@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+
+#include <Tests/SystemComponentFixture.h>
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr size_t s_numKeys = 61;
+        static constexpr float s_duration = 2.0f;
+
+        //! Create source data with a joint that moves and rotates, a joint that only rotates, a static joint,
+        //! an animated morph and a float that never changes.
+        void CreateSourceData(NonUniformMotionData& motionData)
+        {
+            const Transform bindTransform(AZ::Vector3(0.0f, 1.0f, 0.0f), AZ::Quaternion::CreateIdentity());
+            motionData.AddJoint("Moving", bindTransform, bindTransform);
+            motionData.AddJoint("Rotating", bindTransform, bindTransform);
+            motionData.AddJoint("Static", bindTransform, bindTransform);
+            motionData.AddMorph("Smile", 0.0f);
+            motionData.AddFloat("Constant", 0.25f);
+
+            motionData.AllocateJointPositionSamples(0, s_numKeys);
+            motionData.AllocateJointRotationSamples(0, s_numKeys);
+            motionData.AllocateJointRotationSamples(1, s_numKeys);
+            motionData.AllocateMorphSamples(0, s_numKeys);
+            motionData.AllocateFloatSamples(0, s_numKeys);
+            for (size_t i = 0; i < s_numKeys; ++i)
+            {
+                const float time = s_duration * static_cast<float>(i) / static_cast<float>(s_numKeys - 1);
+                motionData.SetJointPositionSample(0, i, { time, AZ::Vector3(AZStd::sin(time * 3.0f) * 2.0f, 1.0f + time, -time * 5.0f) });
+                motionData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(time * 2.0f) });
+                motionData.SetJointRotationSample(1, i, { time, AZ::Quaternion::CreateRotationX(AZStd::sin(time) * AZ::Constants::HalfPi) });
+                motionData.SetMorphSample(0, i, { time, time / s_duration });
+                motionData.SetFloatSample(0, i, { time, 0.25f });
+            }
+            motionData.UpdateDuration();
+        }
+
+        static void CompareJoints(const MotionData& expected, const MotionData& actual, float tolerance)
+        {
+            ASSERT_EQ(expected.GetNumJoints(), actual.GetNumJoints());
+            for (size_t joint = 0; joint < expected.GetNumJoints(); ++joint)
+            {
+                for (float time = 0.0f; time <= s_duration; time += 0.0173f)
+                {
+                    const Transform expectedTransform = expected.SampleJointTransform(time, joint);
+                    const Transform actualTransform = actual.SampleJointTransform(time, joint);
+                    EXPECT_TRUE(expectedTransform.m_position.IsClose(actualTransform.m_position, tolerance))
+                        << "Joint " << joint << " at time " << time;
+                    EXPECT_GT(AZStd::abs(expectedTransform.m_rotation.Dot(actualTransform.m_rotation)), 1.0f - tolerance)
+                        << "Joint " << joint << " at time " << time;
+                }
+            }
+        }
+    };
+
+    TEST_F(CompressedMotionDataFixture, InitFromNonUniformData)
+    {
+        NonUniformMotionData source;
+        CreateSourceData(source);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, false, 60.0f, true);
+        EXPECT_EQ(motionData.GetNumSamples(), 121);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), s_duration);
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(1));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(1));
+        EXPECT_FALSE(motionData.IsJointAnimated(2));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+
+        // The sample rate is higher than the source keys, so any difference is caused by the quantization.
+        CompareJoints(source, motionData, 0.001f);
+        EXPECT_LT(motionData.CalcMaxJointQuantizationError(0), 0.0005f);
+        EXPECT_EQ(motionData.SampleJointTransform(1.0f, 2).m_position, AZ::Vector3(0.0f, 1.0f, 0.0f));
+        EXPECT_EQ(motionData.SampleJointTransform(1.0f, 1).m_position, AZ::Vector3(0.0f, 1.0f, 0.0f));
+
+        for (float time = 0.0f; time <= s_duration; time += 0.1f)
+        {
+            EXPECT_NEAR(motionData.SampleMorph(time, 0), source.SampleMorph(time, 0), 0.001f);
+            EXPECT_NEAR(motionData.SampleFloat(time, 0), 0.25f, 0.001f);
+        }
+    }
+
+    TEST_F(CompressedMotionDataFixture, OptimizeRemovesStaticTracks)
+    {
+        NonUniformMotionData source;
+        CreateSourceData(source);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, true, 30.0f, true);
+        ASSERT_TRUE(motionData.IsFloatAnimated(0));
+
+        const size_t sizeBeforeOptimize = motionData.CalcSampleDataSizeInBytes();
+        MotionData::OptimizeSettings settings;
+        motionData.Optimize(settings);
+        EXPECT_FALSE(motionData.IsFloatAnimated(0));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(1));
+        EXPECT_LT(motionData.CalcSampleDataSizeInBytes(), sizeBeforeOptimize);
+        CompareJoints(source, motionData, 0.001f);
+    }
+
+    TEST_F(CompressedMotionDataFixture, ClearTrackKeepsOtherTracks)
+    {
+        NonUniformMotionData source;
+        CreateSourceData(source);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, true, 30.0f, true);
+        motionData.ClearJointPositionSamples(0);
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_EQ(motionData.SampleJointTransform(0.5f, 0).m_position, AZ::Vector3(0.0f, 1.0f, 0.0f));
+        EXPECT_GT(AZStd::abs(motionData.SampleJointTransform(0.5f, 0).m_rotation.Dot(AZ::Quaternion::CreateRotationZ(1.0f))), 0.999f);
+    }
+
+    TEST_F(CompressedMotionDataFixture, SaveAndRead)
+    {
+        NonUniformMotionData source;
+        CreateSourceData(source);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source, true, 30.0f, true);
+
+        MCore::MemoryFile file;
+        file.Open();
+        MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        file.Seek(0);
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedData.GetJointName(1), "Rotating");
+        EXPECT_EQ(loadedData.IsJointAnimated(2), motionData.IsJointAnimated(2));
+        EXPECT_EQ(loadedData.CalcSampleDataSizeInBytes(), motionData.CalcSampleDataSizeInBytes());
+        CompareJoints(motionData, loadedData, 0.00001f);
+        EXPECT_FLOAT_EQ(loadedData.SampleMorph(0.5f, 0), motionData.SampleMorph(0.5f, 0));
+    }
+
+    TEST_F(CompressedMotionDataFixture, SmallerThanUniformMotionData)
+    {
+        NonUniformMotionData source;
+        CreateSourceData(source);
+
+        UniformMotionData uniformData;
+        uniformData.InitFromNonUniformData(&source, true, 30.0f, true);
+        CompressedMotionData compressedData;
+        compressedData.InitFromNonUniformData(&source, true, 30.0f, true);
+
+        const MotionData::SaveSettings saveSettings;
+        EXPECT_LT(compressedData.CalcStreamSaveSizeInBytes(saveSettings), uniformData.CalcStreamSaveSizeInBytes(saveSettings));
+    }
+} // namespace EMotionFX
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <GradientSignal/GradientProgram.h>
+#include <LmbrCentral/Dependency/DependencyMonitor.h>
+
+namespace GradientSignal
+{
+    struct GradientSampleParams;
+
+    /**
+    * Evaluates a gradient entity graph through a GradientProgram instead of the GradientRequestBus.
+    * The program is compiled on the first query and a DependencyMonitor watches every entity that was compiled into it, so any
+    * change in the gradient hierarchy (configuration, transform, shape, activation) causes the next query to recompile it.
+    * Queries are thread-safe and can run in parallel.
+    */
+    class CompiledGradient final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompiledGradient, AZ::SystemAllocator, 0);
+
+        CompiledGradient() = default;
+        explicit CompiledGradient(const AZ::EntityId& gradientId);
+        ~CompiledGradient();
+
+        //! Sets the root gradient entity to evaluate. This needs to be called from the main thread.
+        void SetGradientId(const AZ::EntityId& gradientId);
+        const AZ::EntityId& GetGradientId() const;
+
+        float GetValue(const GradientSampleParams& sampleParams) const;
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        //! Discards the program so that the next query recompiles it.
+        void Invalidate();
+
+        //! Compiles the program now if it's out of date, instead of on the next query.
+        void Compile() const;
+
+        //! Returns true if the program is up to date with the gradient hierarchy.
+        bool IsCompiled() const;
+
+        //! Returns the number of kernels in the current program, mostly for tests and profiling.
+        size_t GetInstructionCount() const;
+
+    private:
+        CompiledGradient(const CompiledGradient&) = delete;
+        CompiledGradient& operator=(const CompiledGradient&) = delete;
+
+        void CompileIfNeeded() const;
+
+        AZ::EntityId m_gradientId;
+        mutable GradientProgram m_program;
+        mutable LmbrCentral::DependencyMonitor m_dependencyMonitor;
+        //! Entities the monitor is connected to, from the last compile.
+        mutable AZStd::vector<AZ::EntityId> m_dependencies;
+        mutable AZStd::shared_mutex m_programMutex;
+        mutable AZStd::atomic_bool m_isDirty{ true };
+        mutable AZStd::atomic_bool m_isConnecting{ false };
+        mutable bool m_isMonitoring = false;
+    };
+} // namespace GradientSignal
@@ -72,6 +72,7 @@ namespace GradientSignal
         // GradientRequestBus overrides...
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
+        bool CompileGradient(GradientCompiler& compiler) const override;
 
     protected:
         PerlinGradientConfig m_configuration;
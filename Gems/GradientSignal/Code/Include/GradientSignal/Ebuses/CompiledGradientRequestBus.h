@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+
+namespace GradientSignal
+{
+    /**
+     * Evaluates gradient entities through compiled gradient programs (see CompiledGradient) that are shared by every caller.
+     * The GradientSignal system component registers the implementation with AZ::Interface, so span queries can use it from any
+     * module without linking to GradientSignal.
+     */
+    class CompiledGradientRequests
+    {
+    public:
+        AZ_RTTI(CompiledGradientRequests, "{73AC78AE-A981-40D2-BC6D-7362A170805E}");
+
+        virtual ~CompiledGradientRequests() = default;
+
+        //! Evaluates the gradient on an entity through its compiled program. This is thread-safe.
+        //! \return False if the gradient can't be evaluated through a compiled program, e.g. when compiled gradients are disabled
+        //! with gs_compiledGradients, in which case outValues is left untouched.
+        virtual bool GetValues(const AZ::EntityId& gradientId, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) = 0;
+    };
+
+    //! Fills outValues with the values of the gradient on an entity, through its compiled program when compiled gradients are
+    //! available, and through GradientRequestBus::GetValues() otherwise.
+    inline void GetGradientValues(const AZ::EntityId& gradientId, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues)
+    {
+        CompiledGradientRequests* compiledGradients = AZ::Interface<CompiledGradientRequests>::Get();
+        if (!compiledGradients || !compiledGradients->GetValues(gradientId, positions, outValues))
+        {
+            GradientRequestBus::Event(gradientId, &GradientRequestBus::Events::GetValues, positions, outValues);
+        }
+    }
+} // namespace GradientSignal
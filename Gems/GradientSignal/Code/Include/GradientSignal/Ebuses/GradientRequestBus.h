@@ -15,6 +15,8 @@
 
 namespace GradientSignal
 {
+    class GradientCompiler;
+
     struct GradientSampleParams final
     {
         AZ_CLASS_ALLOCATOR(GradientSampleParams, AZ::SystemAllocator, 0);
@@ -75,6 +77,19 @@ namespace GradientSignal
             }
         }
 
+        /**
+         * Emits this gradient into a compiled gradient program (see GradientCompiler). Implementations read their input positions
+         * from compiler.GetPositions(), compile their inputs with GradientSampler::Compile(), and report the register holding their
+         * values with compiler.SetResult(). The program snapshots the configuration, so implementations need to send
+         * OnCompositionChanged() whenever it changes, as they already do for other listeners.
+         * \param compiler The compiler to emit kernels into.
+         * \return False if this gradient can't be compiled, in which case the program calls GetValues() through the bus instead.
+         */
+        virtual bool CompileGradient([[maybe_unused]] GradientCompiler& compiler) const
+        {
+            return false;
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
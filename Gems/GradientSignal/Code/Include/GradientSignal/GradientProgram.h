@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <GradientSignal/GradientTransform.h>
+#include <GradientSignal/PerlinImprovedNoise.h>
+
+namespace GradientSignal
+{
+    /**
+    * A gradient entity graph flattened into a linear list of span kernels.
+    * Every kernel reads and writes scratch registers that hold one chunk of values (or positions), so evaluating a deep gradient
+    * stack walks the instruction list once per chunk instead of making an EBus call and a temporary allocation per level.
+    * Gradients that can't be compiled are evaluated through GradientRequestBus::GetValues() by a GetValues instruction.
+    * Programs are built by GradientCompiler and hold a snapshot of the gradient configurations, so they need to be rebuilt
+    * whenever the gradients change (see CompiledGradient).
+    */
+    class GradientProgram final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientProgram, AZ::SystemAllocator, 0);
+
+        //! Number of values in each scratch register. Positions are evaluated in chunks of this size.
+        static constexpr size_t ChunkSize = 256;
+
+        using Register = AZ::u16;
+        static constexpr Register InvalidRegister = AZStd::numeric_limits<Register>::max();
+
+        //! The position register that holds the positions passed to Execute().
+        static constexpr Register InputPositions = 0;
+
+        //! Blend operations used to combine two value registers, matching the MixedGradientComponent mixing operations.
+        enum class BlendOperation : AZ::u8
+        {
+            Replace,
+            Multiply,
+            Add,
+            Subtract,
+            Min,
+            Max,
+            Average,
+            Overlay,
+            Screen
+        };
+
+        enum class OpCode : AZ::u8
+        {
+            Fill,               //!< destination = parameter 0
+            GetValues,          //!< destination = GradientRequestBus::GetValues(entity, positions)
+            TransformPositions, //!< destination positions = matrix * source positions
+            PerlinNoise,        //!< destination = octave noise at the gradient transform UVW of positions
+            Invert,             //!< destination = 1 - destination
+            Scale,              //!< destination = destination * parameter 0
+            Clamp,              //!< destination = clamp(destination, 0, 1)
+            Levels,             //!< destination = GetLevels(destination, parameters 0-4)
+            Posterize,          //!< destination = min((min(floor(clamp(destination) * bands), bands - 1) + offset) / divisor, 1)
+            SmoothStep,         //!< destination = SmoothStep(midpoint, range, strength) of destination
+            Threshold,          //!< destination = destination <= parameter 0 ? 0 : 1
+            Blend,              //!< destination = destination * parameter 1 + operation(destination, source) * parameter 0
+        };
+
+        struct Instruction
+        {
+            OpCode m_opCode = OpCode::Fill;
+            BlendOperation m_blendOperation = BlendOperation::Replace;
+            Register m_destination = InvalidRegister;
+            Register m_source = InvalidRegister;
+            Register m_positions = InvalidRegister;
+            //! Index into the entity, matrix or noise tables for the instructions that need one.
+            AZ::u32 m_dataIndex = 0;
+            float m_parameters[5] = {};
+        };
+
+        //! Removes all instructions, leaving an empty program that can't be executed.
+        void Clear();
+
+        //! Returns true once a compiler has finished building this program.
+        bool IsValid() const;
+
+        AZStd::span<const Instruction> GetInstructions() const;
+        size_t GetValueRegisterCount() const;
+        size_t GetPositionRegisterCount() const;
+
+        //! Evaluates the program for a list of positions. This is thread-safe, each call allocates its own scratch registers.
+        //! \param positions The input list of positions to query.
+        //! \param outValues The output list of values. This list is expected to be the same size as the positions list.
+        void Execute(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+    private:
+        friend class GradientCompiler;
+
+        struct PerlinNoiseData
+        {
+            GradientTransform m_gradientTransform;
+            AZStd::shared_ptr<PerlinImprovedNoise> m_noise;
+            int m_octaves = 1;
+            float m_amplitude = 1.0f;
+            float m_frequency = 1.0f;
+        };
+
+        void ExecuteInstruction(
+            const Instruction& instruction, size_t count, AZStd::span<float> valueRegisters, AZStd::span<const AZ::Vector3> inputPositions,
+            AZStd::span<AZ::Vector3> positionRegisters) const;
+
+        AZStd::vector<Instruction> m_instructions;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Matrix3x4> m_matrices;
+        AZStd::vector<PerlinNoiseData> m_perlinNoises;
+        size_t m_valueRegisterCount = 0;
+        //! Includes the InputPositions register, which reads directly from the positions passed to Execute().
+        size_t m_positionRegisterCount = 1;
+        Register m_result = InvalidRegister;
+    };
+
+    /**
+    * Flattens a gradient entity graph into a GradientProgram.
+    * Compilation starts at the root gradient and recurses through GradientRequestBus::CompileGradient(), where each gradient emits
+    * the kernels for its own operation and compiles its inputs with GradientSampler::Compile(). Registers are allocated from
+    * shared pools and released as soon as their values have been consumed, so a stack of any depth only needs a few registers.
+    */
+    class GradientCompiler final
+    {
+    public:
+        using Register = GradientProgram::Register;
+        using BlendOperation = GradientProgram::BlendOperation;
+
+        explicit GradientCompiler(GradientProgram& program);
+
+        //! Clears the program and compiles the gradient on the given entity into it.
+        void Compile(const AZ::EntityId& gradientId);
+
+        //! Compiles the gradient on the given entity, reading from the given position register.
+        //! \return The value register holding the gradient's values, owned by the caller.
+        Register CompileGradient(const AZ::EntityId& gradientId, Register positions);
+
+        //! The position register that the gradient currently being compiled should read from.
+        Register GetPositions() const;
+
+        //! Sets the value register that holds the result of the gradient currently being compiled.
+        void SetResult(Register values);
+
+        //! Entities that were compiled into the program, so that the caller can monitor them for changes.
+        const AZStd::vector<AZ::EntityId>& GetDependencies() const;
+
+        Register AllocateValues();
+        void ReleaseValues(Register values);
+        Register AllocatePositions();
+        void ReleasePositions(Register positions);
+
+        void EmitFill(Register destination, float value);
+        void EmitGetValues(Register destination, Register positions, const AZ::EntityId& gradientId);
+        void EmitTransformPositions(Register destination, Register source, const AZ::Matrix3x4& transform);
+        void EmitPerlinNoise(
+            Register destination, Register positions, const GradientTransform& gradientTransform, const PerlinImprovedNoise& noise,
+            int octaves, float amplitude, float frequency);
+        void EmitInvert(Register values);
+        void EmitScale(Register values, float scale);
+        void EmitClamp(Register values);
+        void EmitLevels(Register values, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax);
+        void EmitPosterize(Register values, float bands, float bandOffset, float bandDivisor);
+        void EmitSmoothStep(Register values, float falloffMidpoint, float falloffRange, float falloffStrength);
+        void EmitThreshold(Register values, float threshold);
+        void EmitBlend(Register destination, Register source, BlendOperation operation, float sourceWeight, float destinationWeight);
+
+    private:
+        struct Frame
+        {
+            AZ::EntityId m_gradientId;
+            Register m_positions = GradientProgram::InvalidRegister;
+            Register m_result = GradientProgram::InvalidRegister;
+        };
+
+        GradientProgram::Instruction& Emit(GradientProgram::OpCode opCode, Register destination);
+
+        GradientProgram& m_program;
+        AZStd::vector<Frame> m_frames;
+        AZStd::vector<Register> m_freeValueRegisters;
+        AZStd::vector<Register> m_freePositionRegisters;
+        AZStd::vector<AZ::EntityId> m_dependencies;
+    };
+} // namespace GradientSignal
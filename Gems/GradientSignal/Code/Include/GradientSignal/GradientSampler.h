@@ -16,8 +16,10 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
+#include <GradientSignal/Ebuses/CompiledGradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 
@@ -37,6 +39,12 @@ namespace GradientSignal
 
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
+        //! Emits this sampler into a compiled gradient program: the input gradient followed by the sampler's transform, invert,
+        //! levels and opacity settings. See GradientCompiler.
+        //! @param applyOpacity False to leave the opacity for the caller to apply, as layer blending does.
+        //! @return The value register holding the sampled values, owned by the caller.
+        GradientProgram::Register Compile(GradientCompiler& compiler, GradientProgram::Register positions, bool applyOpacity = true) const;
+
         //! Given a dirty region for a gradient, transform the dirty region in world space based on the gradient transform settings.
         AZ::Aabb TransformDirtyRegion(const AZ::Aabb& dirtyRegion) const;
 
@@ -193,9 +201,8 @@ namespace GradientSignal
             }
             else
             {
-                GradientRequestBus::Event(
-                    m_gradientId, &GradientRequestBus::Events::GetValues, useTransformedPositions ? transformedPositions : positions,
-                    outValues);
+                // Span queries go through the gradient's compiled program when compiled gradients are enabled.
+                GetGradientValues(m_gradientId, useTransformedPositions ? transformedPositions : positions, outValues);
             }
         }
 
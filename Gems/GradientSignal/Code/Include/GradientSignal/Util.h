@@ -93,6 +93,7 @@ namespace GradientSignal
             {
                 inOutValue = (AZ::GetClamp(inOutValue, 0.0f, 1.0f) <= inputMin) ? outputMin : outputMax;
             }
+            return;
         }
 
         const float inputMidReciprocal = 1.0f / inputMid;
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/CompiledGradient.h>
+#include <AzCore/Debug/Profiler.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+
+namespace GradientSignal
+{
+    CompiledGradient::CompiledGradient(const AZ::EntityId& gradientId)
+    {
+        SetGradientId(gradientId);
+    }
+
+    CompiledGradient::~CompiledGradient() = default;
+
+    void CompiledGradient::SetGradientId(const AZ::EntityId& gradientId)
+    {
+        AZStd::unique_lock lock(m_programMutex);
+
+        m_gradientId = gradientId;
+        m_program.Clear();
+        m_dependencies.clear();
+        m_dependencyMonitor.Reset();
+        m_isMonitoring = false;
+        m_isDirty = true;
+    }
+
+    const AZ::EntityId& CompiledGradient::GetGradientId() const
+    {
+        return m_gradientId;
+    }
+
+    float CompiledGradient::GetValue(const GradientSampleParams& sampleParams) const
+    {
+        float value = 0.0f;
+        GetValues(AZStd::span<const AZ::Vector3>(&sampleParams.m_position, 1), AZStd::span<float>(&value, 1));
+        return value;
+    }
+
+    void CompiledGradient::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        CompileIfNeeded();
+
+        AZStd::shared_lock lock(m_programMutex);
+        m_program.Execute(positions, outValues);
+    }
+
+    void CompiledGradient::Invalidate()
+    {
+        m_isDirty = true;
+    }
+
+    void CompiledGradient::Compile() const
+    {
+        CompileIfNeeded();
+    }
+
+    bool CompiledGradient::IsCompiled() const
+    {
+        return !m_isDirty;
+    }
+
+    size_t CompiledGradient::GetInstructionCount() const
+    {
+        AZStd::shared_lock lock(m_programMutex);
+        return m_program.GetInstructions().size();
+    }
+
+    void CompiledGradient::CompileIfNeeded() const
+    {
+        if (!m_isDirty)
+        {
+            return;
+        }
+
+        AZStd::unique_lock lock(m_programMutex);
+
+        // Clear the flag before compiling so that a change made while compiling causes another compile on the next query.
+        if (!m_isDirty.exchange(false))
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        GradientCompiler compiler(m_program);
+        compiler.Compile(m_gradientId);
+
+        // Only reconnect the monitor when the hierarchy itself changed, since most changes are to gradient settings.
+        if (m_isMonitoring && compiler.GetDependencies() == m_dependencies)
+        {
+            return;
+        }
+
+        m_dependencies = compiler.GetDependencies();
+
+        m_dependencyMonitor.Reset();
+        m_dependencyMonitor.SetEntityNotificationFunction(
+            [this](
+                [[maybe_unused]] const AZ::EntityId& ownerId, [[maybe_unused]] const AZ::EntityId& dependentId,
+                [[maybe_unused]] const AZ::Aabb& dirtyRegion)
+            {
+                if (!m_isConnecting)
+                {
+                    m_isDirty = true;
+                }
+            });
+        m_dependencyMonitor.SetAssetNotificationFunction(
+            [this]([[maybe_unused]] const AZ::EntityId& ownerId, [[maybe_unused]] const AZ::Data::AssetId& assetId)
+            {
+                if (!m_isConnecting)
+                {
+                    m_isDirty = true;
+                }
+            });
+
+        // Connecting to an active entity immediately sends OnEntityActivated(), which isn't a change to the compiled hierarchy.
+        m_isConnecting = true;
+        m_dependencyMonitor.ConnectOwner(m_gradientId);
+        m_dependencyMonitor.ConnectDependency(m_gradientId);
+        m_dependencyMonitor.ConnectDependencies(m_dependencies);
+        m_isConnecting = false;
+        m_isMonitoring = true;
+    }
+} // namespace GradientSignal
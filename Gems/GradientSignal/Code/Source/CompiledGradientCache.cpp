@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompiledGradientCache.h"
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace GradientSignal
+{
+    AZ_CVAR(bool, gs_compiledGradients, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Evaluate gradient span queries through compiled gradient programs instead of one GradientRequestBus call per gradient.");
+
+    namespace
+    {
+        // Gradients whose programs are executing on this thread. A program evaluates the gradients that can't be compiled through
+        // the bus, and one of those can sample a gradient that is already executing when the hierarchy has a cycle. That gradient
+        // is left to the bus, which reports the cycle.
+        constexpr size_t MaxExecutingDepth = 16;
+        thread_local AZStd::fixed_vector<AZ::EntityId, MaxExecutingDepth> s_executingGradients;
+    }
+
+    CompiledGradientCache::CompiledGradientCache()
+    {
+        AZ::Interface<CompiledGradientRequests>::Register(this);
+        AZ::EntitySystemBus::Handler::BusConnect();
+    }
+
+    CompiledGradientCache::~CompiledGradientCache()
+    {
+        AZ::EntitySystemBus::Handler::BusDisconnect();
+        AZ::Interface<CompiledGradientRequests>::Unregister(this);
+    }
+
+    bool CompiledGradientCache::GetValues(
+        const AZ::EntityId& gradientId, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues)
+    {
+        if (!gs_compiledGradients || !gradientId.IsValid() || s_executingGradients.size() == s_executingGradients.capacity() ||
+            AZStd::find(s_executingGradients.begin(), s_executingGradients.end(), gradientId) != s_executingGradients.end())
+        {
+            return false;
+        }
+
+        // Holding a reference keeps the program alive if the entity is deactivated while it's executing.
+        AZStd::shared_ptr<CompiledGradient> compiledGradient = FindOrCreate(gradientId);
+
+        s_executingGradients.push_back(gradientId);
+        compiledGradient->GetValues(positions, outValues);
+        s_executingGradients.pop_back();
+        return true;
+    }
+
+    size_t CompiledGradientCache::GetCompiledGradientCount() const
+    {
+        AZStd::shared_lock lock(m_gradientsMutex);
+        return m_gradients.size();
+    }
+
+    void CompiledGradientCache::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        AZStd::shared_ptr<CompiledGradient> released;
+        {
+            AZStd::unique_lock lock(m_gradientsMutex);
+            auto gradientIt = m_gradients.find(entityId);
+            if (gradientIt == m_gradients.end())
+            {
+                return;
+            }
+
+            released = AZStd::move(gradientIt->second);
+            m_gradients.erase(gradientIt);
+        }
+
+        // The program is destroyed outside of the lock, since that disconnects its dependency monitor from the entity buses.
+    }
+
+    AZStd::shared_ptr<CompiledGradient> CompiledGradientCache::FindOrCreate(const AZ::EntityId& gradientId)
+    {
+        {
+            AZStd::shared_lock lock(m_gradientsMutex);
+            auto gradientIt = m_gradients.find(gradientId);
+            if (gradientIt != m_gradients.end())
+            {
+                return gradientIt->second;
+            }
+        }
+
+        AZStd::unique_lock lock(m_gradientsMutex);
+        AZStd::shared_ptr<CompiledGradient>& compiledGradient = m_gradients[gradientId];
+        if (!compiledGradient)
+        {
+            // The program is compiled by its first query, outside of the lock.
+            compiledGradient = AZStd::make_shared<CompiledGradient>(gradientId);
+        }
+        return compiledGradient;
+    }
+} // namespace GradientSignal
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <GradientSignal/CompiledGradient.h>
+#include <GradientSignal/Ebuses/CompiledGradientRequestBus.h>
+
+namespace GradientSignal
+{
+    /**
+    * Owns one CompiledGradient per queried gradient entity, so every GradientSampler and span query of a gradient shares its
+    * program. Programs are created on the first query and released when their gradient entity is deactivated.
+    */
+    class CompiledGradientCache final
+        : public CompiledGradientRequests
+        , private AZ::EntitySystemBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompiledGradientCache, AZ::SystemAllocator, 0);
+
+        CompiledGradientCache();
+        ~CompiledGradientCache() override;
+
+        // CompiledGradientRequests
+        bool GetValues(const AZ::EntityId& gradientId, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) override;
+
+        size_t GetCompiledGradientCount() const;
+
+    private:
+        // EntitySystemBus
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+
+        AZStd::shared_ptr<CompiledGradient> FindOrCreate(const AZ::EntityId& gradientId);
+
+        mutable AZStd::shared_mutex m_gradientsMutex;
+        AZStd::unordered_map<AZ::EntityId, AZStd::shared_ptr<CompiledGradient>> m_gradients;
+    };
+} // namespace GradientSignal
@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 
 namespace GradientSignal
@@ -154,6 +155,16 @@ namespace GradientSignal
         AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_value);
     }
 
+    bool ConstantGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        const GradientProgram::Register values = compiler.AllocateValues();
+        compiler.EmitFill(values, m_configuration.m_value);
+        compiler.SetResult(values);
+        return true;
+    }
+
     float ConstantGradientComponent::GetConstantValue() const
     {
         return m_configuration.m_value;
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -156,6 +157,15 @@ namespace GradientSignal
         }
     }
 
+    bool InvertGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        const GradientProgram::Register values = m_configuration.m_gradientSampler.Compile(compiler, compiler.GetPositions());
+        compiler.EmitClamp(values);
+        compiler.EmitInvert(values);
+        compiler.SetResult(values);
+        return true;
+    }
+
     bool InvertGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -12,6 +12,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 
 namespace GradientSignal
@@ -208,6 +209,18 @@ namespace GradientSignal
                 m_configuration.m_outputMin, m_configuration.m_outputMax);
     }
 
+    bool LevelsGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        const GradientProgram::Register values = m_configuration.m_gradientSampler.Compile(compiler, compiler.GetPositions());
+        compiler.EmitLevels(values,
+            m_configuration.m_inputMid, m_configuration.m_inputMin, m_configuration.m_inputMax,
+            m_configuration.m_outputMin, m_configuration.m_outputMax);
+        compiler.SetResult(values);
+        return true;
+    }
+
     bool LevelsGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
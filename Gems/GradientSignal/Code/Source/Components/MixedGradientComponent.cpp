@@ -11,9 +11,40 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
+    namespace
+    {
+        GradientProgram::BlendOperation GetBlendOperation(MixedGradientLayer::MixingOperation operation)
+        {
+            switch (operation)
+            {
+            case MixedGradientLayer::MixingOperation::Multiply:
+                return GradientProgram::BlendOperation::Multiply;
+            case MixedGradientLayer::MixingOperation::Screen:
+                return GradientProgram::BlendOperation::Screen;
+            case MixedGradientLayer::MixingOperation::Add:
+                return GradientProgram::BlendOperation::Add;
+            case MixedGradientLayer::MixingOperation::Subtract:
+                return GradientProgram::BlendOperation::Subtract;
+            case MixedGradientLayer::MixingOperation::Min:
+                return GradientProgram::BlendOperation::Min;
+            case MixedGradientLayer::MixingOperation::Max:
+                return GradientProgram::BlendOperation::Max;
+            case MixedGradientLayer::MixingOperation::Average:
+                return GradientProgram::BlendOperation::Average;
+            case MixedGradientLayer::MixingOperation::Overlay:
+                return GradientProgram::BlendOperation::Overlay;
+            case MixedGradientLayer::MixingOperation::Initialize:
+            case MixedGradientLayer::MixingOperation::Normal:
+            default:
+                return GradientProgram::BlendOperation::Replace;
+            }
+        }
+    } // namespace
+
     void MixedGradientLayer::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -364,6 +395,35 @@ namespace GradientSignal
         }
     }
 
+    bool MixedGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        // Initialize the accumulated values to 0.0f, the same as GetValues().
+        const GradientProgram::Register result = compiler.AllocateValues();
+        compiler.EmitFill(result, 0.0f);
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                // The layer values are compiled without opacity, which avoids having to unpremultiply them before blending.
+                const float opacity = layer.m_gradientSampler.m_opacity;
+                const float inverseOpacity = (layer.m_operation == MixedGradientLayer::MixingOperation::Initialize) ? 0.0f : (1.0f - opacity);
+
+                const GradientProgram::Register layerValues =
+                    layer.m_gradientSampler.Compile(compiler, compiler.GetPositions(), false);
+                compiler.EmitBlend(result, layerValues, GetBlendOperation(layer.m_operation), opacity, inverseOpacity);
+                compiler.ReleaseValues(layerValues);
+            }
+        }
+
+        compiler.EmitClamp(result);
+        compiler.SetResult(result);
+        return true;
+    }
+
 
 
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
@@ -15,6 +15,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 
@@ -237,6 +238,23 @@ namespace GradientSignal
         }
     }
 
+    bool PerlinGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        if (!m_perlinImprovedNoise)
+        {
+            return false;
+        }
+
+        const GradientProgram::Register values = compiler.AllocateValues();
+        compiler.EmitPerlinNoise(
+            values, compiler.GetPositions(), m_gradientTransform, *m_perlinImprovedNoise, m_configuration.m_octave,
+            m_configuration.m_amplitude, m_configuration.m_frequency);
+        compiler.SetResult(values);
+        return true;
+    }
+
     int PerlinGradientComponent::GetRandomSeed() const
     {
         return m_configuration.m_randomSeed;
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -183,6 +184,37 @@ namespace GradientSignal
         }
     }
 
+    bool PosterizeGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
+
+        // Each mode is an offset within the band and a divisor that maps the bands to the output range, see PosterizeValue().
+        float bandOffset = 0.0f;
+        float bandDivisor = bands;
+        switch (m_configuration.m_mode)
+        {
+        default:
+        case PosterizeGradientConfig::ModeType::Floor:
+            break;
+        case PosterizeGradientConfig::ModeType::Round:
+            bandOffset = 0.5f;
+            break;
+        case PosterizeGradientConfig::ModeType::Ceiling:
+            bandOffset = 1.0f;
+            break;
+        case PosterizeGradientConfig::ModeType::Ps:
+            bandDivisor = bands - 1.0f;
+            break;
+        }
+
+        const GradientProgram::Register values = m_configuration.m_gradientSampler.Compile(compiler, compiler.GetPositions());
+        compiler.EmitPosterize(values, bands, bandOffset, bandDivisor);
+        compiler.SetResult(values);
+        return true;
+    }
+
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
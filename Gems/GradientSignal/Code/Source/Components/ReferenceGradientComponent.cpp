@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -149,6 +150,12 @@ namespace GradientSignal
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
     }
 
+    bool ReferenceGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        compiler.SetResult(m_configuration.m_gradientSampler.Compile(compiler, compiler.GetPositions()));
+        return true;
+    }
+
     bool ReferenceGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Util.h>
 
@@ -192,6 +193,18 @@ namespace GradientSignal
         m_configuration.m_smoothStep.GetSmoothedValues(outValues);
     }
 
+    bool SmoothStepGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        const GradientProgram::Register values = m_configuration.m_gradientSampler.Compile(compiler, compiler.GetPositions());
+        compiler.EmitSmoothStep(values,
+            m_configuration.m_smoothStep.m_falloffMidpoint, m_configuration.m_smoothStep.m_falloffRange,
+            m_configuration.m_smoothStep.m_falloffStrength);
+        compiler.SetResult(values);
+        return true;
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -164,6 +165,16 @@ namespace GradientSignal
         }
     }
 
+    bool ThresholdGradientComponent::CompileGradient(GradientCompiler& compiler) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        const GradientProgram::Register values = m_configuration.m_gradientSampler.Compile(compiler, compiler.GetPositions());
+        compiler.EmitThreshold(values, m_configuration.m_threshold);
+        compiler.SetResult(values);
+        return true;
+    }
+
     bool ThresholdGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -0,0 +1,583 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientProgram.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+#include <GradientSignal/SmoothStep.h>
+#include <GradientSignal/Util.h>
+
+namespace GradientSignal
+{
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        // Registers are ChunkSize values long, which is a multiple of four, so the SIMD kernels can round the count up
+        // and process the unused tail of a register instead of handling it separately.
+        static_assert(GradientProgram::ChunkSize % 4 == 0, "ChunkSize must be a multiple of the SIMD width.");
+
+        size_t GetSimdCount(size_t count)
+        {
+            return (count + 3) & ~size_t(3);
+        }
+
+        template<typename Kernel>
+        void TransformValues(float* values, size_t count, Kernel kernel)
+        {
+            const size_t simdCount = GetSimdCount(count);
+            for (size_t index = 0; index < simdCount; index += 4)
+            {
+                Vec4::StoreUnaligned(values + index, kernel(Vec4::LoadUnaligned(values + index)));
+            }
+        }
+
+        template<typename Operation>
+        void BlendValues(
+            float* destination, const float* source, size_t count, float sourceWeight, float destinationWeight, Operation operation)
+        {
+            const Vec4::FloatType sourceWeights = Vec4::Splat(sourceWeight);
+            const Vec4::FloatType destinationWeights = Vec4::Splat(destinationWeight);
+
+            const size_t simdCount = GetSimdCount(count);
+            for (size_t index = 0; index < simdCount; index += 4)
+            {
+                const Vec4::FloatType previous = Vec4::LoadUnaligned(destination + index);
+                const Vec4::FloatType current = Vec4::LoadUnaligned(source + index);
+                const Vec4::FloatType result =
+                    Vec4::Add(Vec4::Mul(previous, destinationWeights), Vec4::Mul(operation(previous, current), sourceWeights));
+                Vec4::StoreUnaligned(destination + index, result);
+            }
+        }
+
+        void BlendValues(
+            GradientProgram::BlendOperation blendOperation, float* destination, const float* source, size_t count, float sourceWeight,
+            float destinationWeight)
+        {
+            const Vec4::FloatType half = Vec4::Splat(0.5f);
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+
+            switch (blendOperation)
+            {
+            case GradientProgram::BlendOperation::Multiply:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    [](Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        return Vec4::Mul(previous, current);
+                    });
+                break;
+            case GradientProgram::BlendOperation::Add:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    [](Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        return Vec4::Add(previous, current);
+                    });
+                break;
+            case GradientProgram::BlendOperation::Subtract:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    [](Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        return Vec4::Sub(previous, current);
+                    });
+                break;
+            case GradientProgram::BlendOperation::Min:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    [](Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        return Vec4::Min(previous, current);
+                    });
+                break;
+            case GradientProgram::BlendOperation::Max:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    [](Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        return Vec4::Max(previous, current);
+                    });
+                break;
+            case GradientProgram::BlendOperation::Average:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    [half](Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        return Vec4::Mul(Vec4::Add(previous, current), half);
+                    });
+                break;
+            case GradientProgram::BlendOperation::Overlay:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    [half, one, two](Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        const Vec4::FloatType light =
+                            Vec4::Sub(one, Vec4::Mul(Vec4::Mul(two, Vec4::Sub(one, previous)), Vec4::Sub(one, current)));
+                        const Vec4::FloatType dark = Vec4::Mul(Vec4::Mul(two, previous), current);
+                        return Vec4::Select(light, dark, Vec4::CmpGtEq(previous, half));
+                    });
+                break;
+            case GradientProgram::BlendOperation::Screen:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    [one](Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        return Vec4::Sub(one, Vec4::Mul(Vec4::Sub(one, previous), Vec4::Sub(one, current)));
+                    });
+                break;
+            case GradientProgram::BlendOperation::Replace:
+            default:
+                BlendValues(destination, source, count, sourceWeight, destinationWeight,
+                    []([[maybe_unused]] Vec4::FloatArgType previous, Vec4::FloatArgType current)
+                    {
+                        return current;
+                    });
+                break;
+            }
+        }
+    } // namespace
+
+    void GradientProgram::Clear()
+    {
+        m_instructions.clear();
+        m_entityIds.clear();
+        m_matrices.clear();
+        m_perlinNoises.clear();
+        m_valueRegisterCount = 0;
+        m_positionRegisterCount = 1;
+        m_result = InvalidRegister;
+    }
+
+    bool GradientProgram::IsValid() const
+    {
+        return m_result != InvalidRegister;
+    }
+
+    AZStd::span<const GradientProgram::Instruction> GradientProgram::GetInstructions() const
+    {
+        return m_instructions;
+    }
+
+    size_t GradientProgram::GetValueRegisterCount() const
+    {
+        return m_valueRegisterCount;
+    }
+
+    size_t GradientProgram::GetPositionRegisterCount() const
+    {
+        return m_positionRegisterCount;
+    }
+
+    void GradientProgram::Execute(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        if (!IsValid())
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // All of the kernels share these scratch registers, so this is the only allocation regardless of the program size.
+        AZStd::vector<float> valueRegisters(m_valueRegisterCount * ChunkSize);
+        AZStd::vector<AZ::Vector3> positionRegisters((m_positionRegisterCount - 1) * ChunkSize, AZ::Vector3::CreateZero());
+        const float* result = valueRegisters.data() + (m_result * ChunkSize);
+
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += ChunkSize)
+        {
+            const size_t count = AZStd::min(ChunkSize, positions.size() - chunkStart);
+            const AZStd::span<const AZ::Vector3> chunkPositions = positions.subspan(chunkStart, count);
+
+            for (const Instruction& instruction : m_instructions)
+            {
+                ExecuteInstruction(instruction, count, valueRegisters, chunkPositions, positionRegisters);
+            }
+
+            AZStd::copy(result, result + count, outValues.begin() + chunkStart);
+        }
+    }
+
+    void GradientProgram::ExecuteInstruction(
+        const Instruction& instruction, size_t count, AZStd::span<float> valueRegisters, AZStd::span<const AZ::Vector3> inputPositions,
+        AZStd::span<AZ::Vector3> positionRegisters) const
+    {
+        auto GetPositions = [&](Register positions) -> const AZ::Vector3*
+        {
+            return (positions == InputPositions) ? inputPositions.data() : positionRegisters.data() + ((positions - 1) * ChunkSize);
+        };
+
+        float* destination = valueRegisters.data() + (instruction.m_destination * ChunkSize);
+        const float* parameters = instruction.m_parameters;
+
+        switch (instruction.m_opCode)
+        {
+        case OpCode::Fill:
+            AZStd::fill(destination, destination + count, parameters[0]);
+            break;
+
+        case OpCode::GetValues:
+        {
+            // Clear the values first so that a gradient that has been deactivated since compiling produces zeros, the same as an
+            // invalid gradient sampler would.
+            AZStd::fill(destination, destination + count, 0.0f);
+            GradientRequestBus::Event(
+                m_entityIds[instruction.m_dataIndex], &GradientRequestBus::Events::GetValues,
+                AZStd::span<const AZ::Vector3>(GetPositions(instruction.m_positions), count), AZStd::span<float>(destination, count));
+            break;
+        }
+
+        case OpCode::TransformPositions:
+        {
+            const AZ::Matrix3x4& transform = m_matrices[instruction.m_dataIndex];
+            const AZ::Vector3* source = GetPositions(instruction.m_source);
+            AZ::Vector3* transformed = positionRegisters.data() + ((instruction.m_destination - 1) * ChunkSize);
+            for (size_t index = 0; index < count; ++index)
+            {
+                transformed[index] = transform * source[index];
+            }
+            break;
+        }
+
+        case OpCode::PerlinNoise:
+        {
+            const PerlinNoiseData& perlin = m_perlinNoises[instruction.m_dataIndex];
+            const AZ::Vector3* positions = GetPositions(instruction.m_positions);
+            AZ::Vector3 uvw;
+            bool wasPointRejected = false;
+            for (size_t index = 0; index < count; ++index)
+            {
+                perlin.m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+                destination[index] = wasPointRejected
+                    ? 0.0f
+                    : perlin.m_noise->GenerateOctaveNoise(
+                          uvw.GetX(), uvw.GetY(), uvw.GetZ(), perlin.m_octaves, perlin.m_amplitude, perlin.m_frequency);
+            }
+            break;
+        }
+
+        case OpCode::Invert:
+        {
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            TransformValues(destination, count,
+                [one](Vec4::FloatArgType value)
+                {
+                    return Vec4::Sub(one, value);
+                });
+            break;
+        }
+
+        case OpCode::Scale:
+        {
+            const Vec4::FloatType scale = Vec4::Splat(parameters[0]);
+            TransformValues(destination, count,
+                [scale](Vec4::FloatArgType value)
+                {
+                    return Vec4::Mul(value, scale);
+                });
+            break;
+        }
+
+        case OpCode::Clamp:
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            TransformValues(destination, count,
+                [zero, one](Vec4::FloatArgType value)
+                {
+                    return Vec4::Clamp(value, zero, one);
+                });
+            break;
+        }
+
+        case OpCode::Levels:
+            GetLevels(AZStd::span<float>(destination, count), parameters[0], parameters[1], parameters[2], parameters[3], parameters[4]);
+            break;
+
+        case OpCode::Posterize:
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType bands = Vec4::Splat(parameters[0]);
+            const Vec4::FloatType lastBand = Vec4::Splat(parameters[0] - 1.0f);
+            const Vec4::FloatType bandOffset = Vec4::Splat(parameters[1]);
+            const Vec4::FloatType bandDivisor = Vec4::Splat(parameters[2]);
+            TransformValues(destination, count,
+                [=](Vec4::FloatArgType value)
+                {
+                    const Vec4::FloatType band = Vec4::Min(Vec4::Floor(Vec4::Mul(Vec4::Clamp(value, zero, one), bands)), lastBand);
+                    return Vec4::Min(Vec4::Div(Vec4::Add(band, bandOffset), bandDivisor), one);
+                });
+            break;
+        }
+
+        case OpCode::SmoothStep:
+        {
+            SmoothStep smoothStep;
+            smoothStep.m_falloffMidpoint = parameters[0];
+            smoothStep.m_falloffRange = parameters[1];
+            smoothStep.m_falloffStrength = parameters[2];
+            smoothStep.GetSmoothedValues(AZStd::span<float>(destination, count));
+            break;
+        }
+
+        case OpCode::Threshold:
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType threshold = Vec4::Splat(parameters[0]);
+            TransformValues(destination, count,
+                [zero, one, threshold](Vec4::FloatArgType value)
+                {
+                    return Vec4::Select(one, zero, Vec4::CmpGt(value, threshold));
+                });
+            break;
+        }
+
+        case OpCode::Blend:
+            BlendValues(
+                instruction.m_blendOperation, destination, valueRegisters.data() + (instruction.m_source * ChunkSize), count,
+                parameters[0], parameters[1]);
+            break;
+
+        default:
+            AZ_Assert(false, "Unknown gradient program op code %u.", static_cast<AZ::u32>(instruction.m_opCode));
+            break;
+        }
+    }
+
+    GradientCompiler::GradientCompiler(GradientProgram& program)
+        : m_program(program)
+    {
+    }
+
+    void GradientCompiler::Compile(const AZ::EntityId& gradientId)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        m_program.Clear();
+        m_frames.clear();
+        m_freeValueRegisters.clear();
+        m_freePositionRegisters.clear();
+        m_dependencies.clear();
+
+        m_program.m_result = CompileGradient(gradientId, GradientProgram::InputPositions);
+    }
+
+    GradientCompiler::Register GradientCompiler::CompileGradient(const AZ::EntityId& gradientId, Register positions)
+    {
+        auto CompileZeros = [this]()
+        {
+            const Register values = AllocateValues();
+            EmitFill(values, 0.0f);
+            return values;
+        };
+
+        if (!gradientId.IsValid())
+        {
+            return CompileZeros();
+        }
+
+        for (const Frame& frame : m_frames)
+        {
+            if (frame.m_gradientId == gradientId)
+            {
+                AZ_ErrorOnce(
+                    "GradientSignal", false, "Detected cyclic dependencies with gradient entity references on entity id %s",
+                    gradientId.ToString().c_str());
+                return CompileZeros();
+            }
+        }
+
+        if (AZStd::find(m_dependencies.begin(), m_dependencies.end(), gradientId) == m_dependencies.end())
+        {
+            m_dependencies.push_back(gradientId);
+        }
+
+        // A gradient that isn't active doesn't produce any values. Its activation is reported through the dependency monitor, which
+        // causes the program to be recompiled.
+        if (!GradientRequestBus::HasHandlers(gradientId))
+        {
+            return CompileZeros();
+        }
+
+        m_frames.push_back({ gradientId, positions, GradientProgram::InvalidRegister });
+
+        bool compiled = false;
+        GradientRequestBus::EventResult(compiled, gradientId, &GradientRequestBus::Events::CompileGradient, *this);
+
+        const Register result = m_frames.back().m_result;
+        m_frames.pop_back();
+
+        if (compiled)
+        {
+            AZ_Assert(result != GradientProgram::InvalidRegister, "Gradient on entity %s compiled without setting a result.",
+                gradientId.ToString().c_str());
+            return result;
+        }
+
+        // Fall back to evaluating the gradient through the bus.
+        const Register values = AllocateValues();
+        EmitGetValues(values, positions, gradientId);
+        return values;
+    }
+
+    GradientCompiler::Register GradientCompiler::GetPositions() const
+    {
+        AZ_Assert(!m_frames.empty(), "GetPositions() can only be called while compiling a gradient.");
+        return m_frames.back().m_positions;
+    }
+
+    void GradientCompiler::SetResult(Register values)
+    {
+        AZ_Assert(!m_frames.empty(), "SetResult() can only be called while compiling a gradient.");
+        m_frames.back().m_result = values;
+    }
+
+    const AZStd::vector<AZ::EntityId>& GradientCompiler::GetDependencies() const
+    {
+        return m_dependencies;
+    }
+
+    GradientCompiler::Register GradientCompiler::AllocateValues()
+    {
+        if (!m_freeValueRegisters.empty())
+        {
+            const Register values = m_freeValueRegisters.back();
+            m_freeValueRegisters.pop_back();
+            return values;
+        }
+
+        return aznumeric_cast<Register>(m_program.m_valueRegisterCount++);
+    }
+
+    void GradientCompiler::ReleaseValues(Register values)
+    {
+        m_freeValueRegisters.push_back(values);
+    }
+
+    GradientCompiler::Register GradientCompiler::AllocatePositions()
+    {
+        if (!m_freePositionRegisters.empty())
+        {
+            const Register positions = m_freePositionRegisters.back();
+            m_freePositionRegisters.pop_back();
+            return positions;
+        }
+
+        return aznumeric_cast<Register>(m_program.m_positionRegisterCount++);
+    }
+
+    void GradientCompiler::ReleasePositions(Register positions)
+    {
+        AZ_Assert(positions != GradientProgram::InputPositions, "The input positions can't be released.");
+        m_freePositionRegisters.push_back(positions);
+    }
+
+    GradientProgram::Instruction& GradientCompiler::Emit(GradientProgram::OpCode opCode, Register destination)
+    {
+        GradientProgram::Instruction& instruction = m_program.m_instructions.emplace_back();
+        instruction.m_opCode = opCode;
+        instruction.m_destination = destination;
+        return instruction;
+    }
+
+    void GradientCompiler::EmitFill(Register destination, float value)
+    {
+        Emit(GradientProgram::OpCode::Fill, destination).m_parameters[0] = value;
+    }
+
+    void GradientCompiler::EmitGetValues(Register destination, Register positions, const AZ::EntityId& gradientId)
+    {
+        GradientProgram::Instruction& instruction = Emit(GradientProgram::OpCode::GetValues, destination);
+        instruction.m_positions = positions;
+        instruction.m_dataIndex = aznumeric_cast<AZ::u32>(m_program.m_entityIds.size());
+        m_program.m_entityIds.push_back(gradientId);
+    }
+
+    void GradientCompiler::EmitTransformPositions(Register destination, Register source, const AZ::Matrix3x4& transform)
+    {
+        AZ_Assert(destination != GradientProgram::InputPositions, "The input positions can't be overwritten.");
+        GradientProgram::Instruction& instruction = Emit(GradientProgram::OpCode::TransformPositions, destination);
+        instruction.m_source = source;
+        instruction.m_dataIndex = aznumeric_cast<AZ::u32>(m_program.m_matrices.size());
+        m_program.m_matrices.push_back(transform);
+    }
+
+    void GradientCompiler::EmitPerlinNoise(
+        Register destination, Register positions, const GradientTransform& gradientTransform, const PerlinImprovedNoise& noise,
+        int octaves, float amplitude, float frequency)
+    {
+        GradientProgram::Instruction& instruction = Emit(GradientProgram::OpCode::PerlinNoise, destination);
+        instruction.m_positions = positions;
+        instruction.m_dataIndex = aznumeric_cast<AZ::u32>(m_program.m_perlinNoises.size());
+
+        GradientProgram::PerlinNoiseData& perlin = m_program.m_perlinNoises.emplace_back();
+        perlin.m_gradientTransform = gradientTransform;
+        perlin.m_noise = AZStd::make_shared<PerlinImprovedNoise>(noise);
+        perlin.m_octaves = octaves;
+        perlin.m_amplitude = amplitude;
+        perlin.m_frequency = frequency;
+    }
+
+    void GradientCompiler::EmitInvert(Register values)
+    {
+        Emit(GradientProgram::OpCode::Invert, values);
+    }
+
+    void GradientCompiler::EmitScale(Register values, float scale)
+    {
+        Emit(GradientProgram::OpCode::Scale, values).m_parameters[0] = scale;
+    }
+
+    void GradientCompiler::EmitClamp(Register values)
+    {
+        Emit(GradientProgram::OpCode::Clamp, values);
+    }
+
+    void GradientCompiler::EmitLevels(Register values, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        GradientProgram::Instruction& instruction = Emit(GradientProgram::OpCode::Levels, values);
+        instruction.m_parameters[0] = inputMid;
+        instruction.m_parameters[1] = inputMin;
+        instruction.m_parameters[2] = inputMax;
+        instruction.m_parameters[3] = outputMin;
+        instruction.m_parameters[4] = outputMax;
+    }
+
+    void GradientCompiler::EmitPosterize(Register values, float bands, float bandOffset, float bandDivisor)
+    {
+        GradientProgram::Instruction& instruction = Emit(GradientProgram::OpCode::Posterize, values);
+        instruction.m_parameters[0] = bands;
+        instruction.m_parameters[1] = bandOffset;
+        instruction.m_parameters[2] = bandDivisor;
+    }
+
+    void GradientCompiler::EmitSmoothStep(Register values, float falloffMidpoint, float falloffRange, float falloffStrength)
+    {
+        GradientProgram::Instruction& instruction = Emit(GradientProgram::OpCode::SmoothStep, values);
+        instruction.m_parameters[0] = falloffMidpoint;
+        instruction.m_parameters[1] = falloffRange;
+        instruction.m_parameters[2] = falloffStrength;
+    }
+
+    void GradientCompiler::EmitThreshold(Register values, float threshold)
+    {
+        Emit(GradientProgram::OpCode::Threshold, values).m_parameters[0] = threshold;
+    }
+
+    void GradientCompiler::EmitBlend(
+        Register destination, Register source, BlendOperation operation, float sourceWeight, float destinationWeight)
+    {
+        GradientProgram::Instruction& instruction = Emit(GradientProgram::OpCode::Blend, destination);
+        instruction.m_source = source;
+        instruction.m_blendOperation = operation;
+        instruction.m_parameters[0] = sourceWeight;
+        instruction.m_parameters[1] = destinationWeight;
+    }
+} // namespace GradientSignal
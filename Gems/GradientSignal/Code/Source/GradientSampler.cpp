@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 
 namespace GradientSignal
@@ -201,6 +202,49 @@ namespace GradientSignal
         return inHierarchy;
     }
 
+    GradientProgram::Register GradientSampler::Compile(
+        GradientCompiler& compiler, GradientProgram::Register positions, bool applyOpacity) const
+    {
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            const GradientProgram::Register values = compiler.AllocateValues();
+            compiler.EmitFill(values, 0.0f);
+            return values;
+        }
+
+        GradientProgram::Register samplePositions = positions;
+        if (m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this))
+        {
+            // We use the inverse here because we're going from world space to gradient space.
+            samplePositions = compiler.AllocatePositions();
+            compiler.EmitTransformPositions(samplePositions, positions, GetTransformMatrix().GetInverseFull());
+        }
+
+        const GradientProgram::Register values = compiler.CompileGradient(m_gradientId, samplePositions);
+
+        if (samplePositions != positions)
+        {
+            compiler.ReleasePositions(samplePositions);
+        }
+
+        if (m_invertInput)
+        {
+            compiler.EmitInvert(values);
+        }
+
+        if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        {
+            compiler.EmitLevels(values, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+        }
+
+        if (applyOpacity && m_opacity != 1.0f)
+        {
+            compiler.EmitScale(values, m_opacity);
+        }
+
+        return values;
+    }
+
     AZ::Aabb GradientSampler::TransformDirtyRegion(const AZ::Aabb& dirtyRegion) const
     {
         if ((!m_enableTransform) || (!dirtyRegion.IsValid()))
@@ -78,9 +78,11 @@ namespace GradientSignal
 
     void GradientSignalSystemComponent::Activate()
     {
+        m_compiledGradientCache = AZStd::make_unique<CompiledGradientCache>();
     }
 
     void GradientSignalSystemComponent::Deactivate()
     {
+        m_compiledGradientCache.reset();
     }
 }
@@ -8,6 +8,9 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include "CompiledGradientCache.h"
 
 namespace GradientSignal
 {
@@ -31,5 +34,8 @@ namespace GradientSignal
         void Activate() override;
         void Deactivate() override;
         ////////////////////////////////////////////////////////////////////////
+
+    private:
+        AZStd::unique_ptr<CompiledGradientCache> m_compiledGradientCache;
     };
 }
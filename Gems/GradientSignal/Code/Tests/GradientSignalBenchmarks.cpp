@@ -18,8 +18,10 @@
 #include <AzFramework/Asset/AssetCatalogBus.h>
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <GradientSignal/CompiledGradient.h>
 #include <GradientSignal/Components/ConstantGradientComponent.h>
 #include <GradientSignal/Components/GradientSurfaceDataComponent.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
@@ -143,6 +145,108 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SmoothStepGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ThresholdGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Compiled Gradients
+
+    class GradientCompiledStack : public GradientSignalBenchmarkFixture
+    {
+    public:
+        // Create an arbitrary size shape for creating our gradients for benchmark runs.
+        const float TestShapeHalfBounds = 128.0f;
+
+        // Build a 10-deep stack of gradients: a Perlin gradient followed by alternating Levels, Invert, and Mixed gradients.
+        // This is a typical shape for vegetation and terrain masks, and it's the case where the per-level EBus overhead dominates.
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> BuildTestGradientStack()
+        {
+            AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+            entities.push_back(BuildTestPerlinGradient(TestShapeHalfBounds));
+            for (int level = 0; level < 9; level++)
+            {
+                const AZ::EntityId inputId = entities.back()->GetId();
+                switch (level % 3)
+                {
+                case 0:
+                    entities.push_back(BuildTestLevelsGradient(TestShapeHalfBounds, inputId));
+                    break;
+                case 1:
+                    entities.push_back(BuildTestInvertGradient(TestShapeHalfBounds, inputId));
+                    break;
+                default:
+                    entities.push_back(BuildTestMixedGradient(TestShapeHalfBounds, inputId, entities.front()->GetId()));
+                    break;
+                }
+            }
+            return entities;
+        }
+    };
+
+    BENCHMARK_DEFINE_F(GradientCompiledStack, BM_EBusGetValues)(benchmark::State& state)
+    {
+        auto entities = BuildTestGradientStack();
+        const AZ::EntityId gradientId = entities.back()->GetId();
+
+        const float queryRange = aznumeric_cast<float>(state.range(0));
+        AZStd::vector<AZ::Vector3> positions(state.range(0) * state.range(0));
+        GradientSignalTestHelpers::FillQueryPositions(positions, queryRange, queryRange);
+        AZStd::vector<float> results(positions.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GradientSignal::GradientRequestBus::Event(gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, positions, results);
+            benchmark::DoNotOptimize(results.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(GradientCompiledStack, BM_CompiledGetValues)(benchmark::State& state)
+    {
+        auto entities = BuildTestGradientStack();
+        GradientSignal::CompiledGradient compiledGradient(entities.back()->GetId());
+        compiledGradient.Compile();
+
+        const float queryRange = aznumeric_cast<float>(state.range(0));
+        AZStd::vector<AZ::Vector3> positions(state.range(0) * state.range(0));
+        GradientSignalTestHelpers::FillQueryPositions(positions, queryRange, queryRange);
+        AZStd::vector<float> results(positions.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            compiledGradient.GetValues(positions, results);
+            benchmark::DoNotOptimize(results.data());
+        }
+
+        state.counters["Instructions"] = aznumeric_cast<double>(compiledGradient.GetInstructionCount());
+        state.SetItemsProcessed(state.iterations() * positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(GradientCompiledStack, BM_Compile)(benchmark::State& state)
+    {
+        auto entities = BuildTestGradientStack();
+        GradientSignal::CompiledGradient compiledGradient(entities.back()->GetId());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            compiledGradient.Invalidate();
+            compiledGradient.Compile();
+        }
+    }
+
+    BENCHMARK_REGISTER_F(GradientCompiledStack, BM_EBusGetValues)
+        ->Arg(256)
+        ->Arg(1024)
+        ->Arg(2048)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(GradientCompiledStack, BM_CompiledGetValues)
+        ->Arg(256)
+        ->Arg(1024)
+        ->Arg(2048)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(GradientCompiledStack, BM_Compile)
+        ->Unit(::benchmark::kMicrosecond);
+
     // --------------------------------------------------------------------------------------
     // Surface Gradients
 
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Tests/GradientSignalTestFixtures.h>
+#include <Tests/GradientSignalTestHelpers.h>
+#include <AzTest/AzTest.h>
+
+#include <CompiledGradientCache.h>
+#include <GradientSignal/CompiledGradient.h>
+#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/Ebuses/ConstantGradientRequestBus.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+#include <GradientSignal/Ebuses/ReferenceGradientRequestBus.h>
+#include <LmbrCentral/Dependency/DependencyNotificationBus.h>
+
+namespace UnitTest
+{
+    struct GradientSignalCompiledTestsFixture
+        : public GradientSignalTest
+    {
+        // Create an arbitrary size shape for comparing values within. It should be large enough that we detect any value anomalies
+        // but small enough that the tests run quickly.
+        const float TestShapeHalfBounds = 128.0f;
+
+        // The compiled kernels don't always perform their math in the same order as the components, so allow for float error.
+        const float CompiledTolerance = 1.0e-5f;
+
+        void CompareCompiledAndEBusValues(const AZ::EntityId& gradientId)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            for (float y = 0.0f; y < TestShapeHalfBounds * 2.0f; y += 1.0f)
+            {
+                for (float x = 0.0f; x < TestShapeHalfBounds * 2.0f; x += 1.0f)
+                {
+                    positions.emplace_back(x, y, 0.0f);
+                }
+            }
+
+            AZStd::vector<float> expectedValues(positions.size());
+            GradientSignal::GradientRequestBus::Event(
+                gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, positions, expectedValues);
+
+            GradientSignal::CompiledGradient compiledGradient(gradientId);
+            AZStd::vector<float> compiledValues(positions.size());
+            compiledGradient.GetValues(positions, compiledValues);
+
+            EXPECT_TRUE(compiledGradient.IsCompiled());
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                EXPECT_NEAR(compiledValues[index], expectedValues[index], CompiledTolerance);
+            }
+        }
+    };
+
+    TEST_F(GradientSignalCompiledTestsFixture, ConstantGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto entity = BuildTestConstantGradient(TestShapeHalfBounds);
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, PerlinGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto entity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, RandomGradientComponent_VerifyUncompiledGradientFallsBackToEBus)
+    {
+        // The random gradient doesn't support compilation, so it should be evaluated through a single GetValues instruction.
+        auto entity = BuildTestRandomGradient(TestShapeHalfBounds);
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, InvertGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto entity = BuildTestInvertGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, LevelsGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto entity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, MixedGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestConstantGradient(TestShapeHalfBounds);
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, baseEntity->GetId(), mixedEntity->GetId());
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    // Posterize and Threshold have discontinuities, so they use an uncompiled input to make sure that both paths see identical inputs.
+
+    TEST_F(GradientSignalCompiledTestsFixture, PosterizeGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestPosterizeGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, ThresholdGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, ReferenceGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto entity = BuildTestReferenceGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, SmoothStepGradientComponent_VerifyCompiledAndEBusValuesMatch)
+    {
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto entity = BuildTestSmoothStepGradient(TestShapeHalfBounds, baseEntity->GetId());
+        CompareCompiledAndEBusValues(entity->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, DeepGradientStack_VerifyCompiledAndEBusValuesMatch)
+    {
+        // Build a stack of alternating modifiers on top of a Perlin gradient to verify that register reuse across levels is correct.
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        entities.push_back(BuildTestPerlinGradient(TestShapeHalfBounds));
+        for (int level = 0; level < 9; level++)
+        {
+            const AZ::EntityId inputId = entities.back()->GetId();
+            switch (level % 3)
+            {
+            case 0:
+                entities.push_back(BuildTestLevelsGradient(TestShapeHalfBounds, inputId));
+                break;
+            case 1:
+                entities.push_back(BuildTestInvertGradient(TestShapeHalfBounds, inputId));
+                break;
+            default:
+                entities.push_back(BuildTestMixedGradient(TestShapeHalfBounds, inputId, entities.front()->GetId()));
+                break;
+            }
+        }
+
+        CompareCompiledAndEBusValues(entities.back()->GetId());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, CompiledGradient_ConfigurationChangeRecompiles)
+    {
+        auto baseEntity = BuildTestConstantGradient(TestShapeHalfBounds, 0.25f);
+        auto entity = BuildTestInvertGradient(TestShapeHalfBounds, baseEntity->GetId());
+
+        GradientSignal::CompiledGradient compiledGradient(entity->GetId());
+        GradientSignal::GradientSampleParams params(AZ::Vector3(10.0f, 10.0f, 0.0f));
+        EXPECT_NEAR(compiledGradient.GetValue(params), 0.75f, CompiledTolerance);
+
+        // Changing an input gradient deeper in the hierarchy should be detected by the dependency monitor.
+        GradientSignal::ConstantGradientRequestBus::Event(
+            baseEntity->GetId(), &GradientSignal::ConstantGradientRequestBus::Events::SetConstantValue, 0.6f);
+        EXPECT_FALSE(compiledGradient.IsCompiled());
+        EXPECT_NEAR(compiledGradient.GetValue(params), 0.4f, CompiledTolerance);
+        EXPECT_TRUE(compiledGradient.IsCompiled());
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, CompiledGradient_HierarchyChangeRecompiles)
+    {
+        auto firstEntity = BuildTestConstantGradient(TestShapeHalfBounds, 0.25f);
+        auto secondEntity = BuildTestConstantGradient(TestShapeHalfBounds, 0.5f);
+        auto entity = BuildTestReferenceGradient(TestShapeHalfBounds, firstEntity->GetId());
+
+        GradientSignal::CompiledGradient compiledGradient(entity->GetId());
+        GradientSignal::GradientSampleParams params(AZ::Vector3(10.0f, 10.0f, 0.0f));
+        EXPECT_NEAR(compiledGradient.GetValue(params), 0.25f, CompiledTolerance);
+
+        // Point the reference at a different input and notify listeners the same way the editor does after changing a sampler.
+        GradientSignal::ReferenceGradientRequests* reference = GradientSignal::ReferenceGradientRequestBus::FindFirstHandler(entity->GetId());
+        ASSERT_NE(reference, nullptr);
+        reference->GetGradientSampler().m_gradientId = secondEntity->GetId();
+        LmbrCentral::DependencyNotificationBus::Event(
+            entity->GetId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionChanged);
+        EXPECT_NEAR(compiledGradient.GetValue(params), 0.5f, CompiledTolerance);
+
+        // The old input is no longer part of the program, but the new one should be monitored now.
+        GradientSignal::ConstantGradientRequestBus::Event(
+            secondEntity->GetId(), &GradientSignal::ConstantGradientRequestBus::Events::SetConstantValue, 0.9f);
+        EXPECT_NEAR(compiledGradient.GetValue(params), 0.9f, CompiledTolerance);
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, CompiledGradient_InvalidGradientReturnsZero)
+    {
+        GradientSignal::CompiledGradient compiledGradient(AZ::EntityId(12345));
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(0.0f), AZ::Vector3(1.0f), AZ::Vector3(2.0f) };
+        AZStd::vector<float> values(positions.size(), 1.0f);
+        compiledGradient.GetValues(positions, values);
+
+        for (float value : values)
+        {
+            EXPECT_EQ(value, 0.0f);
+        }
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, CompiledGradient_LargeQueryUsesMultipleChunks)
+    {
+        // Query a count that isn't a multiple of the chunk size or the SIMD width to verify the tail handling.
+        auto entity = BuildTestPerlinGradient(TestShapeHalfBounds);
+
+        AZStd::vector<AZ::Vector3> positions;
+        const size_t count = GradientSignal::GradientProgram::ChunkSize * 3 + 7;
+        for (size_t index = 0; index < count; index++)
+        {
+            positions.emplace_back(aznumeric_cast<float>(index) * 0.37f, aznumeric_cast<float>(index % 17), 0.0f);
+        }
+
+        AZStd::vector<float> expectedValues(count);
+        GradientSignal::GradientRequestBus::Event(
+            entity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValues, positions, expectedValues);
+
+        GradientSignal::CompiledGradient compiledGradient(entity->GetId());
+        AZStd::vector<float> compiledValues(count);
+        compiledGradient.GetValues(positions, compiledValues);
+
+        for (size_t index = 0; index < count; index++)
+        {
+            EXPECT_NEAR(compiledValues[index], expectedValues[index], CompiledTolerance);
+        }
+    }
+
+    TEST_F(GradientSignalCompiledTestsFixture, CompiledGradientCache_SamplerSpanQueriesUseSharedProgram)
+    {
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto entity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (float x = 0.0f; x < TestShapeHalfBounds * 2.0f; x += 1.0f)
+        {
+            positions.emplace_back(x, x * 0.5f, 0.0f);
+        }
+
+        GradientSignal::GradientSampler sampler;
+        sampler.m_gradientId = entity->GetId();
+        sampler.m_invertInput = true;
+
+        // Without a registered cache, samplers query the gradients through the bus.
+        AZStd::vector<float> expectedValues(positions.size());
+        sampler.GetValues(positions, expectedValues);
+
+        GradientSignal::CompiledGradientCache cache;
+        AZStd::vector<float> compiledValues(positions.size());
+        sampler.GetValues(positions, compiledValues);
+        sampler.GetValues(positions, compiledValues);
+        EXPECT_EQ(cache.GetCompiledGradientCount(), 1);
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            EXPECT_NEAR(compiledValues[index], expectedValues[index], CompiledTolerance);
+        }
+
+        // Deactivating the gradient releases its program.
+        entity->Deactivate();
+        EXPECT_EQ(cache.GetCompiledGradientCount(), 0);
+    }
+}
@@ -7,6 +7,8 @@
 #
 
 set(FILES
+    Include/GradientSignal/CompiledGradient.h
+    Include/GradientSignal/GradientProgram.h
     Include/GradientSignal/GradientSampler.h
     Include/GradientSignal/GradientTransform.h
     Include/GradientSignal/SmoothStep.h
@@ -32,6 +34,7 @@ set(FILES
     Include/GradientSignal/Components/ThresholdGradientComponent.h
     Include/GradientSignal/Ebuses/GradientTransformRequestBus.h
     Include/GradientSignal/Ebuses/GradientRequestBus.h
+    Include/GradientSignal/Ebuses/CompiledGradientRequestBus.h
     Include/GradientSignal/Ebuses/GradientPreviewRequestBus.h
     Include/GradientSignal/Ebuses/GradientPreviewContextRequestBus.h
     Include/GradientSignal/Ebuses/SectorDataRequestBus.h
@@ -73,6 +76,10 @@ set(FILES
     Source/Components/SurfaceMaskGradientComponent.cpp
     Source/Components/SurfaceSlopeGradientComponent.cpp
     Source/Components/ThresholdGradientComponent.cpp
+    Source/CompiledGradient.cpp
+    Source/CompiledGradientCache.cpp
+    Source/CompiledGradientCache.h
+    Source/GradientProgram.cpp
     Source/GradientSampler.cpp
     Source/GradientSignalSystemComponent.cpp
     Source/GradientSignalSystemComponent.h
@@ -8,6 +8,7 @@
 
 set(FILES
     Tests/GradientSignalBenchmarks.cpp
+    Tests/GradientSignalCompiledTests.cpp
     Tests/GradientSignalGetValuesTests.cpp
     Tests/GradientSignalImageTests.cpp
     Tests/GradientSignalReferencesTests.cpp
@@ -42,6 +42,7 @@ namespace LmbrCentral
                 ->Event("Unload", &AudioPreloadComponentRequestBus::Events::Unload)
                 ->Event("LoadPreload", &AudioPreloadComponentRequestBus::Events::LoadPreload)
                 ->Event("UnloadPreload", &AudioPreloadComponentRequestBus::Events::UnloadPreload)
+                ->Event("PrefetchPreload", &AudioPreloadComponentRequestBus::Events::PrefetchPreload)
                 ->Event("IsLoaded", &AudioPreloadComponentRequestBus::Events::IsLoaded)
                 ;
         }
@@ -151,6 +152,27 @@ namespace LmbrCentral
         }
     }
 
+    //=========================================================================
+    void AudioPreloadComponent::PrefetchPreload(const char* preloadName, float timeUntilNeeded)
+    {
+        if (IsLoaded(preloadName))
+        {
+            return;
+        }
+
+        if (auto audioSystem = AZ::Interface<Audio::IAudioSystem>::Get(); audioSystem != nullptr)
+        {
+            const Audio::TAudioPreloadRequestID preloadRequestId = audioSystem->GetAudioPreloadRequestID(preloadName);
+            if (preloadRequestId != INVALID_AUDIO_PRELOAD_REQUEST_ID)
+            {
+                Audio::SystemRequest::PrefetchBank prefetchBank;
+                prefetchBank.m_preloadRequestId = preloadRequestId;
+                prefetchBank.m_deadlineMs = static_cast<AZ::u32>(AZ::GetMax(timeUntilNeeded, 0.0f) * 1000.0f);
+                audioSystem->PushRequest(AZStd::move(prefetchBank));
+            }
+        }
+    }
+
     //=========================================================================
     bool AudioPreloadComponent::IsLoaded(const char* preloadName)
     {
@@ -51,6 +51,7 @@ namespace LmbrCentral
         void Unload() override;
         void LoadPreload(const char* preloadName) override;
         void UnloadPreload(const char* preloadName) override;
+        void PrefetchPreload(const char* preloadName, float timeUntilNeeded) override;
         bool IsLoaded(const char* preloadName) override;
 
         /*!
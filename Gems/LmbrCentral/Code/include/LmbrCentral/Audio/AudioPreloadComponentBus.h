@@ -33,6 +33,11 @@ namespace LmbrCentral
 
         //! Unloads the specified preload.
         virtual void UnloadPreload(const char* preloadName) = 0;
+
+        //! Hints that the specified preload will be loaded soon, e.g. because a trigger source is getting close.
+        //! Its files are streamed in at low priority if the file cache has room, so a later LoadPreload is a cache hit.
+        //! @param timeUntilNeeded Estimate in seconds of how soon the preload will be loaded.
+        virtual void PrefetchPreload(const char* preloadName, float timeUntilNeeded) = 0;
         
         //! Checks if a preload is loaded.
         virtual bool IsLoaded(const char* preloadName) = 0;
@@ -340,6 +340,11 @@ public: // member functions
     //! cleared and rebuilt on the next render.
     virtual void MarkRenderGraphDirty() = 0;
 
+    //! Mark the part of the render graph for the canvas that was added by the given element and its children as
+    //! dirty. On the next render only that element is rendered again, unless it no longer adds the same primitives
+    //! with the same render state. The whole render graph is then cleared and rebuilt.
+    virtual void MarkElementRenderGraphDirty(AZ::EntityId elementId) = 0;
+
 public: // static member data
 
     //! Only one component on an entity can implement the events
@@ -24,7 +24,8 @@ namespace LyShine
     // UI visual components use this interface to add primitives to the render graph, which is how the
     // UI gets rendered.
     // There is one render graph per UI canvas. The render graph (like a display list) is rebuilt when
-    // any visual change occurs on the canvas.
+    // any visual change occurs on the canvas, unless only the primitives of some elements changed. Those
+    // elements are rendered again into the existing render graph.
     class IRenderGraph
     {
     public:
@@ -92,5 +93,13 @@ namespace LyShine
 
         //! Get the current alpha fade value
         virtual float GetAlphaFade() const = 0;
+
+        //---- Functions for tracking which element added primitives (used during creation of the graph, not rendering ) ----
+
+        //! Begin adding the primitives of an element and its children, so they can be updated when only that element changes
+        virtual void BeginElement(AZ::EntityId elementId) = 0;
+
+        //! End adding the primitives of the element passed to the matching BeginElement
+        virtual void EndElement() = 0;
     };
 }
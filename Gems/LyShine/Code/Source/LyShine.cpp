@@ -43,6 +43,7 @@
 #include "Sprite.h"
 #include "UiSerialize.h"
 #include "UiRenderer.h"
+#include "UiTextRunCache.h"
 #include "Draw2d.h"
 
 #include <LyShine/Bus/UiCursorBus.h>
@@ -129,6 +130,7 @@ CLyShine::CLyShine()
     , AzFramework::InputTextEventListener(AzFramework::InputTextEventListener::GetPriorityUI())
     , m_draw2d(new CDraw2d)
     , m_uiRenderer(new UiRenderer)
+    , m_uiTextRunCache(new UiTextRunCache)
     , m_uiCanvasManager(new UiCanvasManager)
     , m_uiCursorVisibleCounter(0)
 {
@@ -431,10 +433,22 @@ void CLyShine::Render()
 #endif
    
     GetUiRenderer()->BeginUiFrameRender();
-        
+
+    // Text components that need new glyphs add them to the font textures while the render graphs are
+    // rebuilt. Upload each changed font texture once after all the canvases have been processed.
+    if (gEnv->pCryFont)
+    {
+        gEnv->pCryFont->BeginFontTextureUpdateBatch();
+    }
+
     // Render all the canvases loaded in game
     m_uiCanvasManager->RenderLoadedCanvases();
 
+    if (gEnv->pCryFont)
+    {
+        gEnv->pCryFont->EndFontTextureUpdateBatch();
+    }
+
     // Set sort key for draw2d layer to ensure it renders in front of the canvases
     static const int64_t topLayerKey = 0x1000000;
     m_draw2d->SetSortKey(topLayerKey);
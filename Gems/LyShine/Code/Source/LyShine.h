@@ -31,6 +31,7 @@
 class CDraw2d;
 class UiRenderer;
 class UiCanvasManager;
+class UiTextRunCache;
 struct IConsoleCmdArgs;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -151,6 +152,7 @@ private: // data
     std::unique_ptr<UiRenderer> m_uiRenderer;  // using a pointer rather than an instance to avoid including UiRenderer.h
     AZStd::shared_ptr<UiRenderer> m_uiRendererForEditor;
 
+    std::unique_ptr<UiTextRunCache> m_uiTextRunCache;  // declared before the canvas manager so that it outlives the text components
     std::unique_ptr<UiCanvasManager> m_uiCanvasManager;
 
     AZStd::string m_cursorImagePathToLoad;
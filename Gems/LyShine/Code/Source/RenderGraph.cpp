@@ -149,19 +149,78 @@ namespace LyShine
 
         drawSrg->Compile();
 
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] Combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        // Add the merged primitives to the dynamic draw context with a single draw call. The vertex cache is normally
+        // updated when the graph is finalized, and is reused every frame until the graph is rebuilt
+        UpdateVertexCache();
+
+        if (!m_cachedIndices.empty())
         {
-            dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
+            dynamicDraw->DrawIndexed(m_cachedVertices.data(), aznumeric_cast<uint32_t>(m_cachedVertices.size()),
+                m_cachedIndices.data(), aznumeric_cast<uint32_t>(m_cachedIndices.size()), AZ::RHI::IndexFormat::Uint16, drawSrg);
         }
 
         uiRenderer->SetBaseState(prevBaseState);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::Reset(const AZ::Data::Instance<AZ::RPI::Image>& texture,
+        const AZ::Data::Instance<AZ::RPI::Image>& maskTexture, bool isClampTextureMode, bool isTextureSRGB,
+        bool preMultiplyAlpha, AlphaMaskType alphaMaskType, const AZ::RHI::TargetBlendState& blendModeState)
+    {
+        Clear();
+
+        m_isTextureSRGB = isTextureSRGB;
+        m_preMultiplyAlpha = preMultiplyAlpha;
+        m_alphaMaskType = alphaMaskType;
+        m_blendModeState = blendModeState;
+
+        m_textures[0].m_texture = texture;
+        m_textures[0].m_isClampTextureMode = isClampTextureMode;
+        m_numTextures = 1;
+        if (alphaMaskType != AlphaMaskType::None)
+        {
+            m_textures[1].m_texture = maskTexture;
+            m_textures[1].m_isClampTextureMode = isClampTextureMode;
+            m_numTextures = 2;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::Clear()
+    {
+        m_primitives.clear();
+        m_totalNumVertices = 0;
+        m_totalNumIndices = 0;
+
+        for (int i = 0; i < m_numTextures; ++i)
+        {
+            m_textures[i].m_texture.reset();
+        }
+        m_numTextures = 0;
+
+        m_cachedVertices.clear();
+        m_cachedIndices.clear();
+        m_isVertexCacheDirty = true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::UpdateCachedPrimitive(const LyShine::UiPrimitive* primitive, int firstVertex, int firstIndex)
+    {
+        if (m_isVertexCacheDirty)
+        {
+            // the whole cache is merged again before it is drawn
+            return;
+        }
+
+        memcpy(&m_cachedVertices[firstVertex], primitive->m_vertices, sizeof(LyShine::UiPrimitiveVertex) * primitive->m_numVertices);
+
+        uint16* indices = &m_cachedIndices[firstIndex];
+        for (int i = 0; i < primitive->m_numIndices; ++i)
+        {
+            indices[i] = static_cast<uint16>(primitive->m_indices[i] + firstVertex);
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void PrimitiveListRenderNode::AddPrimitive(LyShine::UiPrimitive* primitive)
     {
@@ -171,6 +230,40 @@ namespace LyShine
 
         m_totalNumVertices += primitive->m_numVertices;
         m_totalNumIndices += primitive->m_numIndices;
+
+        m_isVertexCacheDirty = true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::UpdateVertexCache()
+    {
+        if (!m_isVertexCacheDirty)
+        {
+            return;
+        }
+
+        // HasSpaceToAddPrimitive keeps the total number of vertices in range of 16 bit indices
+        m_cachedVertices.resize_no_construct(m_totalNumVertices);
+        m_cachedIndices.resize_no_construct(m_totalNumIndices);
+
+        LyShine::UiPrimitiveVertex* vertices = m_cachedVertices.data();
+        uint16* indices = m_cachedIndices.data();
+        uint16 firstVertex = 0;
+        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        {
+            memcpy(vertices, primitive.m_vertices, sizeof(LyShine::UiPrimitiveVertex) * primitive.m_numVertices);
+            vertices += primitive.m_numVertices;
+
+            for (int i = 0; i < primitive.m_numIndices; ++i)
+            {
+                indices[i] = static_cast<uint16>(primitive.m_indices[i] + firstVertex);
+            }
+            indices += primitive.m_numIndices;
+
+            firstVertex = static_cast<uint16>(firstVertex + primitive.m_numVertices);
+        }
+
+        m_isVertexCacheDirty = false;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -581,24 +674,27 @@ namespace LyShine
     RenderGraph::~RenderGraph()
     {
         ResetGraph();
+
+        for (PrimitiveListRenderNode* renderNode : m_freePrimitiveListRenderNodes)
+        {
+            delete renderNode;
+        }
+        m_freePrimitiveListRenderNodes.clear();
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::ResetGraph()
     {
-        // clear and delete the list of render target nodes
-        for (RenderNode* renderNode : m_renderTargetRenderNodes)
+        // clear and delete the list of render target nodes, keeping their primitive list nodes for the next build
+        for (RenderTargetRenderNode* renderNode : m_renderTargetRenderNodes)
         {
+            ReleaseRenderNodes(renderNode->GetChildRenderNodeList());
             delete renderNode;
         }
         m_renderTargetRenderNodes.clear();
 
-        // clear and delete the list of render nodes
-        for (RenderNode* renderNode : m_renderNodes)
-        {
-            delete renderNode;
-        }
-        m_renderNodes.clear();
+        // clear and delete the list of render nodes, keeping the primitive list nodes for the next build
+        ReleaseRenderNodes(m_renderNodes);
 
         // clear and delete the dynamic quads
         for (DynamicQuad* quad : m_dynamicQuads)
@@ -617,6 +713,12 @@ namespace LyShine
         }
         m_renderNodeListStack.push(&m_renderNodes);
 
+        // the records point at the primitives and render nodes of this build
+        m_primitiveRecords.clear();
+        m_elementRecords.clear();
+        m_elementStack.clear();
+        m_maskFirstPrimitiveRecords.clear();
+
         m_isDirty = true;
         m_renderToRenderTargetCount = 0;
 
@@ -629,16 +731,27 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::BeginMask(bool isMaskingEnabled, bool useAlphaTest, bool drawBehind, bool drawInFront)
     {
+        if (FailElementUpdate())
+        {
+            return;
+        }
+
         // this uses pool allocator
         MaskRenderNode* maskRenderNode = new MaskRenderNode(m_currentMask, isMaskingEnabled, useAlphaTest, drawBehind, drawInFront);
 
         m_currentMask = maskRenderNode;
         m_renderNodeListStack.push(&maskRenderNode->GetMaskRenderNodeList());
+        m_maskFirstPrimitiveRecords.push_back(m_primitiveRecords.size());
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::StartChildrenForMask()
     {
+        if (FailElementUpdate())
+        {
+            return;
+        }
+
         AZ_Assert(m_currentMask, "Calling StartChildrenForMask while not defining a mask");
         m_renderNodeListStack.pop();
         m_renderNodeListStack.push(&m_currentMask->GetContentRenderNodeList());
@@ -647,6 +760,11 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::EndMask()
     {
+        if (FailElementUpdate())
+        {
+            return;
+        }
+
         AZ_Assert(m_currentMask, "Calling EndMask while not defining a mask");
         if (m_currentMask)
         {
@@ -660,12 +778,20 @@ namespace LyShine
             {
                 // We don't know the mask is redundant until we have created this node and found that it hasn't got
                 // child nodes. This is not common but does happen sometimes when all the children are currently disabled.
+                // Deleting it also deletes the render nodes that the primitives of the mask were added to.
+                for (size_t i = m_maskFirstPrimitiveRecords.back(); i < m_primitiveRecords.size(); ++i)
+                {
+                    m_primitiveRecords[i].m_renderNode = nullptr;
+                }
+
                 delete newMaskRenderNode;
             }
             else
             {
                 m_renderNodeListStack.top()->push_back(newMaskRenderNode);
             }
+
+            m_maskFirstPrimitiveRecords.pop_back();
         }
     }
 
@@ -673,6 +799,11 @@ namespace LyShine
     void RenderGraph::BeginRenderToTexture(AZ::Data::Instance<AZ::RPI::AttachmentImage> attachmentImage,
         const AZ::Vector2& viewportTopLeft, const AZ::Vector2& viewportSize, const AZ::Color& clearColor)
     {
+        if (FailElementUpdate())
+        {
+            return;
+        }
+
         // this uses pool allocator
         RenderTargetRenderNode* renderTargetRenderNode = new RenderTargetRenderNode(
             m_currentRenderTarget, attachmentImage,
@@ -686,6 +817,11 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::EndRenderToTexture()
     {
+        if (FailElementUpdate())
+        {
+            return;
+        }
+
         AZ_Assert(m_currentRenderTarget, "Calling EndRenderToTexture while not defining a render target node");
         if (m_currentRenderTarget)
         {
@@ -719,6 +855,12 @@ namespace LyShine
             bool isShaderOutputPremultAlpha = isPreMultiplyAlpha || isTexturePremultipliedAlpha;
             AZ::RHI::TargetBlendState blendModeState = GetBlendModeState(blendMode, isShaderOutputPremultAlpha);
 
+            if (m_isUpdatingElement)
+            {
+                UpdatePrimitive(primitive, texture, isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, blendModeState);
+                return;
+            }
+
             PrimitiveListRenderNode* renderNodeToAddTo = nullptr;
             if (!renderNodeList->empty())
             {
@@ -750,8 +892,9 @@ namespace LyShine
             if (!renderNodeToAddTo)
             {
                 // We can't add this primitive to the existing render node, we need to create a new render node
-                // this uses a pool allocator for fast allocation
-                renderNodeToAddTo = new PrimitiveListRenderNode(texture, isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, blendModeState);
+                // or reuse one from the previous build of the graph
+                renderNodeToAddTo = CreatePrimitiveListRenderNode(texture, nullptr, isClampTextureMode, isTextureSRGB,
+                    isPreMultiplyAlpha, AlphaMaskType::None, blendModeState);
 
                 renderNodeList->push_back(renderNodeToAddTo);
                 texUnit = 0;
@@ -769,6 +912,10 @@ namespace LyShine
                 }
             }
 
+            // record where the primitive is merged so it can be updated without rebuilding the graph
+            m_primitiveRecords.push_back({ primitive, renderNodeToAddTo, texUnit, primitive->m_numVertices, primitive->m_numIndices,
+                renderNodeToAddTo->GetTotalNumVertices(), renderNodeToAddTo->GetTotalNumIndices() });
+
             // add this primitive to the render node
             renderNodeToAddTo->AddPrimitive(primitive);
         }
@@ -783,6 +930,12 @@ namespace LyShine
         bool isTexturePremultipliedAlpha,
         BlendMode blendMode)
     {
+        // alpha mask primitives are not recorded, they are only added along with render targets
+        if (FailElementUpdate())
+        {
+            return;
+        }
+
         AZStd::vector<RenderNode*>* renderNodeList = m_renderNodeListStack.top();
 
         int texUnit0 = -1;
@@ -831,8 +984,8 @@ namespace LyShine
             if (!renderNodeToAddTo)
             {
                 // We can't add this primitive to the existing render node, we need to create a new render node
-                // this uses a pool allocator for fast allocation
-                renderNodeToAddTo = new PrimitiveListRenderNode(contentAttachmentImage, maskAttachmentImage,
+                // or reuse one from the previous build of the graph
+                renderNodeToAddTo = CreatePrimitiveListRenderNode(contentAttachmentImage, maskAttachmentImage,
                     isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, alphaMaskType, blendModeState);
 
                 renderNodeList->push_back(renderNodeToAddTo);
@@ -937,6 +1090,53 @@ namespace LyShine
         return alphaFade;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::BeginElement(AZ::EntityId elementId)
+    {
+        if (m_isUpdatingElement)
+        {
+            // The primitive ranges of the updated element and its children stay as they were when the graph was built.
+            // A fader that is updated changes the alpha fade of its children, which they need if they are updated later.
+            auto elementIter = m_elementRecords.find(elementId);
+            if (elementIter != m_elementRecords.end())
+            {
+                elementIter->second.m_alphaFade = GetAlphaFade();
+            }
+            return;
+        }
+
+        ElementRecord elementRecord;
+        elementRecord.m_firstPrimitive = m_primitiveRecords.size();
+        elementRecord.m_alphaFade = GetAlphaFade();
+        elementRecord.m_isRenderingToMask = m_isRenderingToMask;
+        elementRecord.m_renderTargetNestLevel = m_renderTargetNestLevel;
+
+        auto insertResult = m_elementRecords.emplace(elementId, elementRecord);
+        if (!insertResult.second)
+        {
+            // A mask can render a child element both as the mask and as its content, there is no single range to update
+            insertResult.first->second.m_canUpdate = false;
+        }
+
+        m_elementStack.push_back(elementId);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::EndElement()
+    {
+        if (m_isUpdatingElement)
+        {
+            return;
+        }
+
+        AZ_Assert(!m_elementStack.empty(), "Calling EndElement without a matching BeginElement");
+        if (!m_elementStack.empty())
+        {
+            m_elementRecords[m_elementStack.back()].m_endPrimitive = m_primitiveRecords.size();
+            m_elementStack.pop_back();
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::Render(UiRenderer* uiRenderer, [[maybe_unused]] const AZ::Vector2& viewportSize)
     {
@@ -991,6 +1191,7 @@ namespace LyShine
                 // when graph first becomes dirty it must be reset since an element may have been deleted
                 // and the graph contains pointers to DynUiPrimitives owned by components on elements.
                 ResetGraph();
+                m_dirtyElements.clear();
             }
             m_isDirty = isDirty;
         }
@@ -1008,6 +1209,239 @@ namespace LyShine
         // sort the render targets so that more deeply nested ones are rendered first
         std::sort(m_renderTargetRenderNodes.begin(), m_renderTargetRenderNodes.end(),
             RenderTargetRenderNode::CompareNestLevelForSort);
+
+        // merge the primitives of each render node now, the merged vertices are drawn every frame until the graph is rebuilt
+        for (RenderTargetRenderNode* renderNode : m_renderTargetRenderNodes)
+        {
+            UpdateVertexCaches(renderNode->GetChildRenderNodeList());
+        }
+        UpdateVertexCaches(m_renderNodes);
+
+        // nodes that weren't needed by this build aren't likely to be needed by the next one either
+        for (PrimitiveListRenderNode* renderNode : m_freePrimitiveListRenderNodes)
+        {
+            delete renderNode;
+        }
+        m_freePrimitiveListRenderNodes.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::MarkElementDirty(AZ::EntityId elementId)
+    {
+        if (m_isDirty)
+        {
+            return;
+        }
+
+        if (m_elementRecords.find(elementId) == m_elementRecords.end())
+        {
+            // the element wasn't rendered when the graph was built, so it may need to be added to it
+            SetDirtyFlag(true);
+            return;
+        }
+
+        m_dirtyElements.insert(elementId);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::ClearDirtyElements()
+    {
+        m_dirtyElements.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::BeginElementUpdate(AZ::EntityId elementId)
+    {
+        AZ_Assert(!m_isUpdatingElement, "Calling BeginElementUpdate while already updating an element");
+
+        auto elementIter = m_elementRecords.find(elementId);
+        if (m_isDirty || elementIter == m_elementRecords.end() || !elementIter->second.m_canUpdate)
+        {
+            return false;
+        }
+
+        const ElementRecord& elementRecord = elementIter->second;
+        m_isUpdatingElement = true;
+        m_isUpdateFailed = false;
+        m_nextUpdatePrimitive = elementRecord.m_firstPrimitive;
+        m_updateEndPrimitive = elementRecord.m_endPrimitive;
+        m_updateRenderTargetNestLevel = elementRecord.m_renderTargetNestLevel;
+
+        // restore the state that the element was rendered with when the graph was built
+        PushOverrideAlphaFade(elementRecord.m_alphaFade);
+        m_isRenderingToMask = elementRecord.m_isRenderingToMask;
+        m_renderTargetNestLevel = elementRecord.m_renderTargetNestLevel;
+
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::EndElementUpdate()
+    {
+        AZ_Assert(m_isUpdatingElement, "Calling EndElementUpdate without a matching BeginElementUpdate");
+        if (!m_isUpdatingElement)
+        {
+            return false;
+        }
+
+        PopAlphaFade();
+        m_isRenderingToMask = false;
+        m_renderTargetNestLevel = 0;
+
+        const bool isUpdated = !m_isUpdateFailed && m_nextUpdatePrimitive == m_updateEndPrimitive;
+        if (isUpdated && m_updateRenderTargetNestLevel > 0)
+        {
+            // the render targets are only rendered to after the graph is built, and the element changed what is in one
+            m_renderToRenderTargetCount = 0;
+        }
+
+        m_isUpdatingElement = false;
+        return isUpdated;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::IsUpdatingElement() const
+    {
+        return m_isUpdatingElement;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::CancelElementUpdate()
+    {
+        AZ_Assert(m_isUpdatingElement, "Calling CancelElementUpdate while not updating an element");
+
+        // Clear the graph now, the component may be about to free primitives that are in it. The rest of the primitives
+        // that the element adds are ignored, and EndElementUpdate fails.
+        ResetGraph();
+        m_isUpdateFailed = true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::UpdatePrimitive(LyShine::UiPrimitive* primitive, const AZ::Data::Instance<AZ::RPI::Image>& texture,
+        bool isClampTextureMode, bool isTextureSRGB, bool isPreMultiplyAlpha, const AZ::RHI::TargetBlendState& blendModeState)
+    {
+        if (m_isUpdateFailed)
+        {
+            return;
+        }
+
+        if (m_nextUpdatePrimitive >= m_updateEndPrimitive)
+        {
+            // the element added more primitives than when the graph was built
+            m_isUpdateFailed = true;
+            return;
+        }
+
+        const PrimitiveRecord& primitiveRecord = m_primitiveRecords[m_nextUpdatePrimitive++];
+        PrimitiveListRenderNode* renderNode = primitiveRecord.m_renderNode;
+
+        // the primitive must have been rewritten in place with the same render state, or it belongs in another render node
+        if (!renderNode ||
+            primitiveRecord.m_primitive != primitive ||
+            primitiveRecord.m_numVertices != primitive->m_numVertices ||
+            primitiveRecord.m_numIndices != primitive->m_numIndices ||
+            renderNode->GetTexture(primitiveRecord.m_texUnit) != texture ||
+            renderNode->GetTextureIsClampMode(primitiveRecord.m_texUnit) != isClampTextureMode ||
+            renderNode->GetIsTextureSRGB() != isTextureSRGB ||
+            renderNode->GetIsPremultiplyAlpha() != isPreMultiplyAlpha ||
+            !(renderNode->GetBlendModeState() == blendModeState) ||
+            renderNode->GetAlphaMaskType() != AlphaMaskType::None)
+        {
+            m_isUpdateFailed = true;
+            return;
+        }
+
+        // components may have rewritten the texture units along with the rest of the vertices
+        if (primitive->m_vertices[0].texIndex != primitiveRecord.m_texUnit)
+        {
+            for (int i = 0; i < primitive->m_numVertices; ++i)
+            {
+                primitive->m_vertices[i].texIndex = static_cast<uint8>(primitiveRecord.m_texUnit);
+            }
+        }
+
+        renderNode->UpdateCachedPrimitive(primitive, primitiveRecord.m_firstVertex, primitiveRecord.m_firstIndex);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::FailElementUpdate()
+    {
+        if (m_isUpdatingElement)
+        {
+            m_isUpdateFailed = true;
+            return true;
+        }
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    PrimitiveListRenderNode* RenderGraph::CreatePrimitiveListRenderNode(const AZ::Data::Instance<AZ::RPI::Image>& texture,
+        const AZ::Data::Instance<AZ::RPI::Image>& maskTexture, bool isClampTextureMode, bool isTextureSRGB,
+        bool preMultiplyAlpha, AlphaMaskType alphaMaskType, const AZ::RHI::TargetBlendState& blendModeState)
+    {
+        if (m_freePrimitiveListRenderNodes.empty())
+        {
+            // this uses a pool allocator for fast allocation
+            if (alphaMaskType == AlphaMaskType::None)
+            {
+                return new PrimitiveListRenderNode(texture, isClampTextureMode, isTextureSRGB, preMultiplyAlpha, blendModeState);
+            }
+            return new PrimitiveListRenderNode(texture, maskTexture, isClampTextureMode, isTextureSRGB, preMultiplyAlpha, alphaMaskType, blendModeState);
+        }
+
+        PrimitiveListRenderNode* renderNode = m_freePrimitiveListRenderNodes.back();
+        m_freePrimitiveListRenderNodes.pop_back();
+        renderNode->Reset(texture, maskTexture, isClampTextureMode, isTextureSRGB, preMultiplyAlpha, alphaMaskType, blendModeState);
+        return renderNode;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::ReleaseRenderNodes(AZStd::vector<RenderNode*>& renderNodeList)
+    {
+        for (RenderNode* renderNode : renderNodeList)
+        {
+            switch (renderNode->GetType())
+            {
+            case RenderNodeType::PrimitiveList:
+            {
+                // the primitives are owned by components that may be deleted before the next build, so they are removed now
+                PrimitiveListRenderNode* primListRenderNode = static_cast<PrimitiveListRenderNode*>(renderNode);
+                primListRenderNode->Clear();
+                m_freePrimitiveListRenderNodes.push_back(primListRenderNode);
+                break;
+            }
+            case RenderNodeType::Mask:
+            {
+                MaskRenderNode* maskRenderNode = static_cast<MaskRenderNode*>(renderNode);
+                ReleaseRenderNodes(maskRenderNode->GetMaskRenderNodeList());
+                ReleaseRenderNodes(maskRenderNode->GetContentRenderNodeList());
+                delete maskRenderNode;
+                break;
+            }
+            default:
+                delete renderNode;
+                break;
+            }
+        }
+        renderNodeList.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::UpdateVertexCaches(const AZStd::vector<RenderNode*>& renderNodeList)
+    {
+        for (RenderNode* renderNode : renderNodeList)
+        {
+            if (renderNode->GetType() == RenderNodeType::PrimitiveList)
+            {
+                static_cast<PrimitiveListRenderNode*>(renderNode)->UpdateVertexCache();
+            }
+            else if (renderNode->GetType() == RenderNodeType::Mask)
+            {
+                const MaskRenderNode* maskRenderNode = static_cast<const MaskRenderNode*>(renderNode);
+                UpdateVertexCaches(maskRenderNode->GetMaskRenderNodeList());
+                UpdateVertexCaches(maskRenderNode->GetContentRenderNodeList());
+            }
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
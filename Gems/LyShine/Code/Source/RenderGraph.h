@@ -13,6 +13,8 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -79,9 +81,27 @@ namespace LyShine
             , const AZ::Matrix4x4& modelViewProjMat
             , AZ::RHI::Ptr<AZ::RPI::DynamicDrawContext> dynamicDraw) override;
 
+        //! Reinitialize a node that is reused from a previous build of the render graph
+        void Reset(const AZ::Data::Instance<AZ::RPI::Image>& texture, const AZ::Data::Instance<AZ::RPI::Image>& maskTexture,
+            bool isClampTextureMode, bool isTextureSRGB, bool preMultiplyAlpha, AlphaMaskType alphaMaskType, const AZ::RHI::TargetBlendState& blendModeState);
+
+        //! Remove the primitives and textures, the vertex cache keeps its memory so the node can be reused
+        void Clear();
+
         void AddPrimitive(LyShine::UiPrimitive* primitive);
         LyShine::UiPrimitiveList& GetPrimitives() const;
 
+        //! Merge the primitives into the vertex and index buffers that the node draws with a single draw call.
+        //! The merged buffers are kept until primitives are added again, so this only copies the vertices once per build of the graph.
+        void UpdateVertexCache();
+
+        //! Copy the vertices and indices of a primitive that has already been merged back into the merged buffers,
+        //! for a primitive that was rewritten in place without changing its number of vertices and indices
+        void UpdateCachedPrimitive(const LyShine::UiPrimitive* primitive, int firstVertex, int firstIndex);
+
+        int GetNumCachedVertices() const { return static_cast<int>(m_cachedVertices.size()); }
+        int GetNumCachedIndices() const { return static_cast<int>(m_cachedIndices.size()); }
+
         int GetOrAddTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode);
         int GetNumTextures() const { return m_numTextures; }
         const AZ::Data::Instance<AZ::RPI::Image> GetTexture(int texIndex) const { return m_textures[texIndex].m_texture; }
@@ -94,6 +114,9 @@ namespace LyShine
 
         bool HasSpaceToAddPrimitive(LyShine::UiPrimitive* primitive) const;
 
+        int GetTotalNumVertices() const { return m_totalNumVertices; }
+        int GetTotalNumIndices() const { return m_totalNumIndices; }
+
         // Search to see if this texture is already used by this texture unit, returns -1 if not used
         int FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const;
 
@@ -123,6 +146,10 @@ namespace LyShine
         int             m_totalNumIndices;
 
         LyShine::UiPrimitiveList   m_primitives;
+
+        AZStd::vector<LyShine::UiPrimitiveVertex> m_cachedVertices;    //!< The vertices of all the primitives
+        AZStd::vector<uint16>                     m_cachedIndices;     //!< The indices of all the primitives, offset into m_cachedVertices
+        bool                                      m_isVertexCacheDirty = true;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
@@ -246,7 +273,12 @@ namespace LyShine
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    // The RenderGraph is owned by the canvas component
+    // The RenderGraph is owned by the canvas component. It is rebuilt from the whole element tree whenever the canvas
+    // is marked dirty, and between rebuilds each primitive list render node draws its merged primitives with one draw call.
+    // The graph records which primitives each element and its children added. When an element is marked dirty on its
+    // own, the canvas renders that element again between BeginElementUpdate and EndElementUpdate. If it adds the same
+    // primitives with the same render state, only their ranges of the merged buffers are copied again. Otherwise the
+    // whole graph is rebuilt.
     class RenderGraph : public IRenderGraph
     {
     public:
@@ -254,7 +286,7 @@ namespace LyShine
         RenderGraph();
         ~RenderGraph() override;
 
-        //! Free up all the memory and clear the lists
+        //! Clear the lists for a rebuild of the whole graph, the primitive list render nodes are kept to reuse their memory
         void ResetGraph();
         
         // IRenderGraph
@@ -278,6 +310,9 @@ namespace LyShine
         void PopAlphaFade() override;
         float GetAlphaFade() const override;
 
+        void BeginElement(AZ::EntityId elementId) override;
+        void EndElement() override;
+
         void AddPrimitive(LyShine::UiPrimitive* primitive, const AZ::Data::Instance<AZ::RPI::Image>& texture,
             bool isClampTextureMode, bool isTextureSRGB, bool isTexturePremultipliedAlpha, BlendMode blendMode) override;
         // ~IRenderGraph
@@ -303,6 +338,30 @@ namespace LyShine
         //! End the building of the graph
         void FinalizeGraph();
 
+        //! Mark the primitives added by an element and its children as dirty. If the element did not add primitives
+        //! to the graph as it is built, the whole graph is marked dirty.
+        void MarkElementDirty(AZ::EntityId elementId);
+
+        //! Get the elements marked dirty since the graph was built or last updated
+        const AZStd::unordered_set<AZ::EntityId>& GetDirtyElements() const { return m_dirtyElements; }
+
+        //! Clear the list of dirty elements once they have been updated
+        void ClearDirtyElements();
+
+        //! Begin rendering a dirty element again, the primitives it adds update the ones it added when the graph was built.
+        //! Returns false if the element can't be updated this way, the whole graph then needs to be rebuilt.
+        bool BeginElementUpdate(AZ::EntityId elementId);
+
+        //! End rendering a dirty element again. Returns false if the element didn't add the same primitives with the same
+        //! render state as when the graph was built, the whole graph then needs to be rebuilt.
+        bool EndElementUpdate();
+
+        //! Test whether an element is being updated, between BeginElementUpdate and EndElementUpdate
+        bool IsUpdatingElement() const;
+
+        //! Clear the graph while an element is updated, for a change to the element that needs the graph to be rebuilt
+        void CancelElementUpdate();
+
         //! Test whether the render graph contains any render nodes
         bool IsEmpty();
 
@@ -331,6 +390,29 @@ namespace LyShine
             LyShine::UiPrimitive   m_primitive;
         };
 
+        // Where a primitive was added in the graph, and the state it was added with
+        struct PrimitiveRecord
+        {
+            LyShine::UiPrimitive*       m_primitive;
+            PrimitiveListRenderNode*    m_renderNode;   // null if the node was removed before the graph was finalized
+            int                         m_texUnit;
+            int                         m_numVertices;
+            int                         m_numIndices;
+            int                         m_firstVertex;  // offset of the vertices in the merged vertices of m_renderNode
+            int                         m_firstIndex;   // offset of the indices in the merged indices of m_renderNode
+        };
+
+        // The range of primitive records added by an element and its children, and the graph state when it began
+        struct ElementRecord
+        {
+            size_t      m_firstPrimitive = 0;
+            size_t      m_endPrimitive = 0;
+            float       m_alphaFade = 1.0f;
+            bool        m_isRenderingToMask = false;
+            int         m_renderTargetNestLevel = 0;
+            bool        m_canUpdate = true;             // false if the element was rendered more than once
+        };
+
     protected: // member functions
 
         //! Given a blend mode and whether the shader will be outputing premultiplied alpha, return state flags
@@ -338,6 +420,26 @@ namespace LyShine
 
         void SetRttPassesEnabled(UiRenderer* uiRenderer, bool enabled);
 
+        //! Get a primitive list render node kept from a previous build of the graph, or create one if there are none left
+        PrimitiveListRenderNode* CreatePrimitiveListRenderNode(const AZ::Data::Instance<AZ::RPI::Image>& texture,
+            const AZ::Data::Instance<AZ::RPI::Image>& maskTexture, bool isClampTextureMode, bool isTextureSRGB,
+            bool preMultiplyAlpha, AlphaMaskType alphaMaskType, const AZ::RHI::TargetBlendState& blendModeState);
+
+        //! Delete the render nodes in the list, the primitive list render nodes are kept for reuse by the next build of the graph
+        void ReleaseRenderNodes(AZStd::vector<RenderNode*>& renderNodeList);
+
+        //! Merge the vertices of the primitive list render nodes in the list, including the ones nested in masks
+        static void UpdateVertexCaches(const AZStd::vector<RenderNode*>& renderNodeList);
+
+        //! Compare a primitive added by an element that is being updated with the one it added when the graph was built
+        //! and copy its vertices into the merged vertices of its render node
+        void UpdatePrimitive(LyShine::UiPrimitive* primitive, const AZ::Data::Instance<AZ::RPI::Image>& texture,
+            bool isClampTextureMode, bool isTextureSRGB, bool isPreMultiplyAlpha, const AZ::RHI::TargetBlendState& blendModeState);
+
+        //! Called by the functions that change the structure of the graph, which can't happen while an element is updated.
+        //! Returns true if an element is being updated, its update then fails.
+        bool FailElementUpdate();
+
     protected:  // data
 
         AZStd::vector<RenderNode*>  m_renderNodes;
@@ -357,6 +459,22 @@ namespace LyShine
         AZStd::vector<RenderTargetRenderNode*>  m_renderTargetRenderNodes;
         int                         m_renderTargetNestLevel = 0;
 
+        //! Primitive list render nodes of the previous build of the graph. The next build reuses their vertex cache memory,
+        //! but merges the vertices of all primitives again
+        AZStd::vector<PrimitiveListRenderNode*> m_freePrimitiveListRenderNodes;
+
+        AZStd::vector<PrimitiveRecord>                      m_primitiveRecords;        // in the order they were added
+        AZStd::unordered_map<AZ::EntityId, ElementRecord>   m_elementRecords;
+        AZStd::vector<AZ::EntityId>                         m_elementStack;            // the elements being added
+        AZStd::vector<size_t>                               m_maskFirstPrimitiveRecords;   // for the masks being added
+        AZStd::unordered_set<AZ::EntityId>                  m_dirtyElements;
+
+        bool                        m_isUpdatingElement = false;   // set between BeginElementUpdate and EndElementUpdate
+        bool                        m_isUpdateFailed = false;
+        size_t                      m_nextUpdatePrimitive = 0;
+        size_t                      m_updateEndPrimitive = 0;
+        int                         m_updateRenderTargetNestLevel = 0;
+
 #ifndef _RELEASE
         // A debug-only variable used to track whether the rendergraph was rebuilt this frame
         mutable bool                m_wasBuiltThisFrame = false;
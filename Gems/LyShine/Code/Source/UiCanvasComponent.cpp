@@ -499,6 +499,20 @@ AZ::Entity* UiCanvasComponent::CreateChildElement(const LyShine::NameType& name)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 AZ::Entity* UiCanvasComponent::FindElementById(LyShine::ElementId id)
 {
+    if (const UiElementHierarchy* elementHierarchy = GetRefreshedElementHierarchy())
+    {
+        const int numElements = elementHierarchy->GetNumElements();
+        for (int index = 0; index < numElements; ++index)
+        {
+            UiElementComponent* elementComponent = elementHierarchy->GetElementComponent(index);
+            if (elementComponent->GetElementId() == id)
+            {
+                return elementComponent->GetEntity();
+            }
+        }
+        return nullptr;
+    }
+
     AZ::Entity* element = nullptr;
     EBUS_EVENT_ID_RESULT(element, m_rootElement, UiElementBus, FindDescendantById, id);
     return element;
@@ -524,9 +538,7 @@ AZ::EntityId UiCanvasComponent::FindElementEntityIdByName(const LyShine::NameTyp
 void UiCanvasComponent::FindElementsByName(const LyShine::NameType& name, LyShine::EntityArray& result)
 {
     // find all elements with the given name
-    EBUS_EVENT_ID(m_rootElement, UiElementBus, FindDescendantElements,
-        [&name](const AZ::Entity* entity) { return name == entity->GetName(); },
-        result);
+    FindElements([&name](const AZ::Entity* entity) { return name == entity->GetName(); }, result);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,7 +588,21 @@ AZ::Entity* UiCanvasComponent::FindElementByHierarchicalName(const LyShine::Name
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiCanvasComponent::FindElements(AZStd::function<bool(const AZ::Entity*)> predicate, LyShine::EntityArray& result)
 {
-    // find all matching elements
+    // find all matching elements, the root element is not included
+    if (const UiElementHierarchy* elementHierarchy = GetRefreshedElementHierarchy())
+    {
+        const int numElements = elementHierarchy->GetNumElements();
+        for (int index = 1; index < numElements; ++index)
+        {
+            AZ::Entity* entity = elementHierarchy->GetElementComponent(index)->GetEntity();
+            if (predicate(entity))
+            {
+                result.push_back(entity);
+            }
+        }
+        return;
+    }
+
     EBUS_EVENT_ID(m_rootElement, UiElementBus, FindDescendantElements, predicate, result);
 }
 
@@ -1862,6 +1888,22 @@ void UiCanvasComponent::MarkRenderGraphDirty()
     {
         m_renderGraph.SetDirtyFlag(true);
     }
+    else if (m_renderGraph.IsUpdatingElement())
+    {
+        // The element that is rendered again to update its part of the render graph changed in a way that needs the
+        // whole graph to be rebuilt. It may be about to free primitives that are in the graph, so it is cleared now.
+        m_renderGraph.CancelElementUpdate();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::MarkElementRenderGraphDirty(AZ::EntityId elementId)
+{
+    // As for MarkRenderGraphDirty, never change what is dirty while rendering
+    if (!m_isRendering)
+    {
+        m_renderGraph.MarkElementDirty(elementId);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1943,6 +1985,19 @@ AZ::Data::Instance<AZ::RPI::AttachmentImage> UiCanvasComponent::GetRenderTarget(
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiCanvasComponent::UpdateCanvas(float deltaTime, bool isInGame)
+{
+    UpdateElements(deltaTime, isInGame);
+
+    if (PrepareRectsAndTransformsRecompute())
+    {
+        RecomputeRectsAndTransforms();
+    }
+
+    UpdateRectsAndLayouts();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::UpdateElements(float deltaTime, bool isInGame)
 {
     // Ignore update if we're not enabled
     if (!m_enabled)
@@ -1964,6 +2019,36 @@ void UiCanvasComponent::UpdateCanvas(float deltaTime, bool isInGame)
     }
 
     DestroyScheduledElements();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiCanvasComponent::PrepareRectsAndTransformsRecompute()
+{
+    if (!m_enabled || m_elementsNeedingTransformRecompute.empty())
+    {
+        return false;
+    }
+
+    return GetRefreshedElementHierarchy() != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::RecomputeRectsAndTransforms() const
+{
+    // Computing the rects and transforms parents first means that the rect change notifications
+    // only have to compare the rects rather than recursively computing the rects of the ancestors
+    m_elementHierarchy->RecomputeRectsAndTransforms();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::UpdateRectsAndLayouts()
+{
+    // Ignore update if we're not enabled
+    if (!m_enabled)
+    {
+        return;
+    }
+
     SendRectChangeNotificationsAndRecomputeLayouts();
 }
 
@@ -1997,6 +2082,35 @@ void UiCanvasComponent::RenderCanvas(bool isInGame, AZ::Vector2 viewportSize, Ui
 
     m_isRendering = true;
 
+    if (!m_renderGraph.GetDirtyFlag() && !m_renderGraph.GetDirtyElements().empty())
+    {
+        // Only some elements changed since the graph was built. Render them again into the render nodes that they were
+        // added to, and rebuild the whole graph if any of them no longer adds the same primitives with the same render state.
+        bool isGraphUpdated = true;
+        for (const AZ::EntityId& elementId : m_renderGraph.GetDirtyElements())
+        {
+            if (!m_renderGraph.BeginElementUpdate(elementId))
+            {
+                isGraphUpdated = false;
+                break;
+            }
+
+            EBUS_EVENT_ID(elementId, UiElementBus, RenderElement, &m_renderGraph, isInGame);
+
+            if (!m_renderGraph.EndElementUpdate())
+            {
+                isGraphUpdated = false;
+                break;
+            }
+        }
+
+        m_renderGraph.ClearDirtyElements();
+        if (!isGraphUpdated)
+        {
+            m_renderGraph.SetDirtyFlag(true);
+        }
+    }
+
     if (m_renderGraph.GetDirtyFlag())
     {
         m_renderGraph.ResetGraph();
@@ -2097,6 +2211,27 @@ void UiCanvasComponent::UnscheduleElementForTransformRecompute(UiElementComponen
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::MarkElementHierarchyDirty()
+{
+    if (m_elementHierarchy)
+    {
+        m_elementHierarchy->MarkDirty();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+const UiElementHierarchy* UiCanvasComponent::GetRefreshedElementHierarchy()
+{
+    if (!m_elementHierarchy)
+    {
+        return nullptr;
+    }
+
+    m_elementHierarchy->Refresh();
+    return m_elementHierarchy->IsValid() ? m_elementHierarchy : nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiCanvasComponent::ScheduleElementDestroy(AZ::EntityId entityId)
 {
@@ -2540,7 +2675,8 @@ void UiCanvasComponent::Activate()
 
     LoadAtlases();
 
-    m_layoutManager = new UiLayoutManager(GetEntityId());
+    m_elementHierarchy = new UiElementHierarchy(m_rootElement);
+    m_layoutManager = new UiLayoutManager(GetEntityId(), m_elementHierarchy);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2578,6 +2714,9 @@ void UiCanvasComponent::Deactivate()
     delete m_layoutManager;
     m_layoutManager = nullptr;
 
+    delete m_elementHierarchy;
+    m_elementHierarchy = nullptr;
+
     m_renderGraph.ResetGraph();
 }
 
@@ -22,6 +22,7 @@
 #include "UiSerialize.h"
 #include "Animation/UiAnimationSystem.h"
 #include "UiLayoutManager.h"
+#include "UiElementHierarchy.h"
 #include "UiNavigationHelpers.h"
 #include "RenderGraph.h"
 
@@ -228,6 +229,7 @@ public: // member functions
 
     // UiCanvasComponentImplementationInterface
     void MarkRenderGraphDirty() override;
+    void MarkElementRenderGraphDirty(AZ::EntityId elementId) override;
     // ~UiCanvasComponentImplementationInterface
 
     // LyShine::RenderToTextureRequestBus overrides ...
@@ -237,6 +239,13 @@ public: // member functions
     AZ::Data::Instance<AZ::RPI::AttachmentImage> GetRenderTarget(const AZ::RHI::AttachmentId& attachmentId) override;
 
     void UpdateCanvas(float deltaTime, bool isInGame);
+
+    //! The phases of UpdateCanvas. They are called separately by the canvas manager so that the
+    //! rects and transforms of all canvases can be recomputed in parallel
+    void UpdateElements(float deltaTime, bool isInGame);
+    bool PrepareRectsAndTransformsRecompute();
+    void RecomputeRectsAndTransforms() const;
+    void UpdateRectsAndLayouts();
     void RenderCanvas(bool isInGame, AZ::Vector2 viewportSize, UiRenderer* uiRenderer = nullptr);
 
     AZ::Entity* GetRootElement() const;
@@ -258,6 +267,9 @@ public: // member functions
     void ScheduleElementForTransformRecompute(UiElementComponent* elementComponent);
     void UnscheduleElementForTransformRecompute(UiElementComponent* elementComponent);
 
+    //! Called by elements when they are added, removed or reordered
+    void MarkElementHierarchyDirty();
+
     //! Queue an element to be destroyed at end of frame
     void ScheduleElementDestroy(AZ::EntityId entityId);
 
@@ -434,6 +446,9 @@ private: // member functions
 
     void DestroyScheduledElements();
 
+    //! Get the flattened element hierarchy, rebuilt if needed, or null if it can't be used yet
+    const UiElementHierarchy* GetRefreshedElementHierarchy();
+
     //! Notify LyShine pass that it needs to rebuild its Rtt child passes
     void QueueRttPassRebuild();
 
@@ -568,6 +583,9 @@ private: // data
     //! Each canvas has a layout manager to track and recompute layouts
     UiLayoutManager* m_layoutManager = nullptr;
 
+    //! Flattened copy of the element hierarchy used by the transform and layout passes
+    UiElementHierarchy* m_elementHierarchy = nullptr;
+
     bool m_isSnapEnabled;
     float m_snapDistance;
     float m_snapRotationDegrees;
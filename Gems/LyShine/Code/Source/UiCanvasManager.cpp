@@ -18,6 +18,10 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Input/Channels/InputChannel.h>
@@ -43,6 +47,9 @@
 
 #include "LyShine.h"
 
+AZ_CVAR(bool, ui_parallelCanvasUpdate, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "If true the rects and transforms of the loaded canvases are recomputed in parallel during the update.");
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Anonymous namespace
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,7 +599,42 @@ void UiCanvasManager::UpdateLoadedCanvases(float deltaTime)
     }
     for (auto canvas : loadedCanvases)
     {
-        canvas->UpdateCanvas(deltaTime, true);
+        canvas->UpdateElements(deltaTime, true);
+    }
+
+    // Recompute the rects and transforms of the canvases in parallel, no notifications are sent so the canvases don't
+    // affect each other. The notifications and the layouts are then processed canvas by canvas on the main thread
+    AZStd::vector<UiCanvasComponent*> canvasesToRecompute;
+    for (auto canvas : loadedCanvases)
+    {
+        if (canvas->PrepareRectsAndTransformsRecompute())
+        {
+            canvasesToRecompute.push_back(canvas);
+        }
+    }
+
+    if (ui_parallelCanvasUpdate && canvasesToRecompute.size() > 1 && AZ::JobContext::GetGlobalContext())
+    {
+        AZ::JobCompletion jobCompletion;
+        for (auto canvas : canvasesToRecompute)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([canvas]() { canvas->RecomputeRectsAndTransforms(); }, true, nullptr);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+    else
+    {
+        for (auto canvas : canvasesToRecompute)
+        {
+            canvas->RecomputeRectsAndTransforms();
+        }
+    }
+
+    for (auto canvas : loadedCanvases)
+    {
+        canvas->UpdateRectsAndLayouts();
     }
     m_recursionGuardCount--;
 
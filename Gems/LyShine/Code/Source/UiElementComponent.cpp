@@ -139,6 +139,9 @@ void UiElementComponent::RenderElement(LyShine::IRenderGraph* renderGraph, bool
         }
     }
 
+    // record the primitives of this element and its children, so that they can be updated if only this element changes
+    renderGraph->BeginElement(GetEntityId());
+
     // If a component is connected to the UiRenderControl bus then we give control of rendering this element
     // and its children to that component, otherwise follow the standard render path
     if (m_renderControlInterface)
@@ -161,6 +164,8 @@ void UiElementComponent::RenderElement(LyShine::IRenderGraph* renderGraph, bool
             GetChildElementComponent(i)->RenderElement(renderGraph, isInGame);
         }
     }
+
+    renderGraph->EndElement();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -335,6 +340,8 @@ AZ::Entity* UiElementComponent::CreateChildElement(const LyShine::NameType& name
     }
     m_childEntityIdOrder.push_back({child->GetId(), m_childEntityIdOrder.size()});
 
+    m_canvas->MarkElementHierarchyDirty();
+
     return child;
 }
 
@@ -1100,6 +1107,11 @@ void UiElementComponent::AddChild(AZ::Entity* child, AZ::Entity* insertBefore)
         m_childEntityIdOrder.push_back({child->GetId(), m_childEntityIdOrder.size()});
     }
 
+    if (m_canvas)
+    {
+        m_canvas->MarkElementHierarchyDirty();
+    }
+
     // Adding or removing child elements may require recomputing the
     // transforms of all children
     EBUS_EVENT_ID(GetCanvasEntityId(), UiLayoutManagerBus, MarkToRecomputeLayout, GetEntityId());
@@ -1143,6 +1155,11 @@ void UiElementComponent::RemoveChild(AZ::Entity* child)
         // Clear child's parent
         elementComponent->SetParentReferences(nullptr, nullptr);
 
+        if (m_canvas)
+        {
+            m_canvas->MarkElementHierarchyDirty();
+        }
+
         // Adding or removing child elements may require recomputing the
         // transforms of all children
         EBUS_EVENT_ID(GetCanvasEntityId(), UiLayoutManagerBus, MarkToRecomputeLayout, GetEntityId());
@@ -1187,6 +1204,11 @@ void UiElementComponent::RemoveChild(AZ::EntityId child)
         // update the sort indicies to be contiguous
         ResetChildEntityIdSortOrders();
 
+        if (m_canvas)
+        {
+            m_canvas->MarkElementHierarchyDirty();
+        }
+
         // Adding or removing child elements may require recomputing the
         // transforms of all children
         EBUS_EVENT_ID(GetCanvasEntityId(), UiLayoutManagerBus, MarkToRecomputeLayout, GetEntityId());
@@ -1295,6 +1317,8 @@ bool UiElementComponent::FixupPostLoad(AZ::Entity* entity, UiCanvasComponent* ca
         m_childElementComponents.push_back(childElementComponent);
     }
 
+    canvas->MarkElementHierarchyDirty();
+
     // Tell any listeners that the canvas entity ID for the element is now set, this allows other components to
     // listen for messages from the canvas
     AZ::EntityId parentEntityId = (parent) ? parent->GetId() : AZ::EntityId();
@@ -1522,6 +1546,12 @@ void UiElementComponent::Activate()
     if (!m_transformComponent)
     {
         m_transformComponent = GetEntity()->FindComponent<UiTransform2dComponent>();
+
+        // The element could not be added to the canvas's hierarchy until it had a transform component
+        if (m_canvas)
+        {
+            m_canvas->MarkElementHierarchyDirty();
+        }
     }
 
     // tell the canvas to invalidate the render graph
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UiElementHierarchy.h"
+
+#include "UiElementComponent.h"
+#include "UiTransform2dComponent.h"
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC MEMBER FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiElementHierarchy::UiElementHierarchy(AZ::EntityId rootEntityId)
+    : m_rootEntityId(rootEntityId)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiElementHierarchy::Refresh()
+{
+    if (!m_isDirty)
+    {
+        return;
+    }
+
+    Clear();
+    m_isDirty = false;
+    m_isValid = false;
+
+    AZ::Entity* rootEntity = nullptr;
+    EBUS_EVENT_RESULT(rootEntity, AZ::ComponentApplicationBus, FindEntity, m_rootEntityId);
+    UiElementComponent* rootElementComponent = rootEntity ? rootEntity->FindComponent<UiElementComponent>() : nullptr;
+    if (!rootElementComponent || !rootElementComponent->IsFullyInitialized())
+    {
+        // The canvas is still loading, the fixup of the root element will mark the hierarchy dirty again
+        return;
+    }
+
+    if (!AddElementAndDescendants(rootElementComponent, InvalidIndex, 0))
+    {
+        // An element is still being loaded, its fixup will mark the hierarchy dirty again
+        Clear();
+        return;
+    }
+
+    // Group the elements by depth with a counting sort, this keeps the depth first order within a level
+    const int numElements = GetNumElements();
+    for (int index = 0; index < numElements; ++index)
+    {
+        const int depth = m_depths[index];
+        if (depth + 2 > static_cast<int>(m_levelStarts.size()))
+        {
+            m_levelStarts.resize(depth + 2, 0);
+        }
+        ++m_levelStarts[depth + 1];
+    }
+    for (size_t level = 1; level < m_levelStarts.size(); ++level)
+    {
+        m_levelStarts[level] += m_levelStarts[level - 1];
+    }
+
+    AZStd::vector<int> levelInsertPositions(m_levelStarts.begin(), m_levelStarts.end());
+    m_levelOrder.resize(numElements);
+    for (int index = 0; index < numElements; ++index)
+    {
+        m_levelOrder[levelInsertPositions[m_depths[index]]++] = index;
+    }
+
+    m_isValid = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int UiElementHierarchy::FindIndex(AZ::EntityId entityId) const
+{
+    auto iter = m_entityIdToIndex.find(entityId);
+    return iter != m_entityIdToIndex.end() ? iter->second : InvalidIndex;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiElementHierarchy::RecomputeRectsAndTransforms() const
+{
+    AZ_Assert(m_isValid && !m_isDirty, "UiElementHierarchy used without being refreshed");
+
+    // Each element only reads the rect and transform of its parent, which is on the previous level
+    for (int levelOrderIndex : m_levelOrder)
+    {
+        m_transformComponents[levelOrderIndex]->RecomputeRectAndTransformToCanvasSpaceIfNeeded();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE MEMBER FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiElementHierarchy::Clear()
+{
+    m_entityIds.clear();
+    m_elementComponents.clear();
+    m_transformComponents.clear();
+    m_parentIndices.clear();
+    m_depths.clear();
+    m_descendantsEnds.clear();
+    m_levelOrder.clear();
+    m_levelStarts.clear();
+    m_entityIdToIndex.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiElementHierarchy::AddElementAndDescendants(UiElementComponent* elementComponent, int parentIndex, int depth)
+{
+    const int index = GetNumElements();
+
+    m_entityIds.push_back(elementComponent->GetEntityId());
+    m_elementComponents.push_back(elementComponent);
+    m_transformComponents.push_back(elementComponent->GetTransform2dComponent());
+    m_parentIndices.push_back(parentIndex);
+    m_depths.push_back(depth);
+    m_descendantsEnds.push_back(index + 1);
+    m_entityIdToIndex[elementComponent->GetEntityId()] = index;
+
+    int numChildren = elementComponent->GetNumChildElements();
+    for (int i = 0; i < numChildren; ++i)
+    {
+        UiElementComponent* childElementComponent = elementComponent->GetChildElementComponent(i);
+        if (!childElementComponent->IsFullyInitialized() || !AddElementAndDescendants(childElementComponent, index, depth + 1))
+        {
+            return false;
+        }
+    }
+
+    m_descendantsEnds[index] = GetNumElements();
+    return true;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+class UiElementComponent;
+class UiTransform2dComponent;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//! A flattened copy of the element hierarchy of a canvas, stored as parallel arrays.
+//! Elements are stored in depth first order, so the descendants of an element are the contiguous
+//! range of elements that follows it. A second index groups the elements by depth so that passes
+//! over the hierarchy can process it a level at a time, parents before children.
+//! The canvas marks the hierarchy dirty when elements are added, removed or reordered and it is
+//! rebuilt by the next call to Refresh.
+class UiElementHierarchy
+{
+public: // constants
+
+    static constexpr int InvalidIndex = -1;
+
+public: // member functions
+
+    AZ_CLASS_ALLOCATOR(UiElementHierarchy, AZ::SystemAllocator, 0);
+
+    UiElementHierarchy(AZ::EntityId rootEntityId);
+
+    void MarkDirty() { m_isDirty = true; }
+
+    //! Rebuild the arrays if the hierarchy is dirty. Must be called on the main thread before any queries.
+    void Refresh();
+
+    //! False if an element was not fully initialized when the hierarchy was last refreshed, in which case it is empty
+    bool IsValid() const { return m_isValid; }
+
+    int GetNumElements() const { return static_cast<int>(m_entityIds.size()); }
+
+    //! Get the index of an element, or InvalidIndex if the element is not in the hierarchy
+    int FindIndex(AZ::EntityId entityId) const;
+
+    AZ::EntityId GetEntityId(int index) const { return m_entityIds[index]; }
+    UiElementComponent* GetElementComponent(int index) const { return m_elementComponents[index]; }
+    UiTransform2dComponent* GetTransformComponent(int index) const { return m_transformComponents[index]; }
+    int GetParentIndex(int index) const { return m_parentIndices[index]; }
+    int GetDepth(int index) const { return m_depths[index]; }
+
+    //! Get the index one past the last descendant of an element
+    int GetDescendantsEnd(int index) const { return m_descendantsEnds[index]; }
+
+    bool IsAncestorOf(int ancestorIndex, int descendantIndex) const
+    {
+        return descendantIndex > ancestorIndex && descendantIndex < m_descendantsEnds[ancestorIndex];
+    }
+
+    //! Compute the canvas space rects and transforms of all elements that need a recompute, level by level.
+    //! No notifications are sent so, for elements of different canvases, this is safe to call from a job.
+    //! The hierarchy must have been refreshed and be valid.
+    void RecomputeRectsAndTransforms() const;
+
+private: // member functions
+
+    AZ_DISABLE_COPY_MOVE(UiElementHierarchy);
+
+    void Clear();
+    //! Returns false if an element in the subtree has not been fully initialized
+    bool AddElementAndDescendants(UiElementComponent* elementComponent, int parentIndex, int depth);
+
+private: // data
+
+    AZ::EntityId m_rootEntityId;
+    bool m_isDirty = true;
+    bool m_isValid = false;
+
+    // Per element data, in depth first order
+    AZStd::vector<AZ::EntityId> m_entityIds;
+    AZStd::vector<UiElementComponent*> m_elementComponents;
+    AZStd::vector<UiTransform2dComponent*> m_transformComponents;
+    AZStd::vector<int> m_parentIndices;
+    AZStd::vector<int> m_depths;
+    AZStd::vector<int> m_descendantsEnds;
+
+    //! Element indices sorted by depth, level N is the range [m_levelStarts[N], m_levelStarts[N + 1])
+    AZStd::vector<int> m_levelOrder;
+    AZStd::vector<int> m_levelStarts;
+
+    AZStd::unordered_map<AZ::EntityId, int> m_entityIdToIndex;
+};
@@ -391,14 +391,14 @@ void UiFaderComponent::SetFadeValueInternal(float fade)
     if (m_fade != fade)
     {
         m_fade = fade;
-        MarkRenderGraphDirty();
+        MarkElementRenderGraphDirty();
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiFaderComponent::OnFadeValueChanged()
 {
-    MarkRenderGraphDirty();
+    MarkElementRenderGraphDirty();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -439,6 +439,15 @@ void UiFaderComponent::MarkRenderGraphDirty()
     EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiFaderComponent::MarkElementRenderGraphDirty()
+{
+    // tell the canvas to invalidate the part of the render graph for this element and its children
+    AZ::EntityId canvasEntityId;
+    EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkElementRenderGraphDirty, GetEntityId());
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiFaderComponent::CreateOrResizeRenderTarget(const AZ::Vector2& pixelAlignedTopLeft, const AZ::Vector2& pixelAlignedBottomRight)
 {
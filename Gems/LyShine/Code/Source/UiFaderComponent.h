@@ -113,6 +113,9 @@ protected: // member functions
     //! Mark the render graph as dirty, this should be done when any change is made affects the structure of the graph
     void MarkRenderGraphDirty();
 
+    //! Mark the part of the render graph for this element and its children as dirty, this should be done when the fade changes
+    void MarkElementRenderGraphDirty();
+
     //! When m_useRenderToTexture is true this is used to create the render target and depth surface or resize them if they exist
     void CreateOrResizeRenderTarget(const AZ::Vector2& pixelAlignedTopLeft, const AZ::Vector2& pixelAlignedBottomRight);
 
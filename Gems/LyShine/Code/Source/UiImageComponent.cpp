@@ -2319,10 +2319,12 @@ void UiImageComponent::MarkRenderCacheDirty()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiImageComponent::MarkRenderGraphDirty()
 {
-    // tell the canvas to invalidate the render graph (never want to do this while rendering)
+    // tell the canvas to invalidate the part of the render graph for this element (never want to do this while rendering).
+    // The cached primitive lives as long as the component, and the canvas rebuilds the whole graph if it is no longer
+    // added with the same number of vertices and render state.
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkElementRenderGraphDirty, GetEntityId());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -599,10 +599,10 @@ void UiImageSequenceComponent::MarkRenderCacheDirty()
 {
     m_isRenderCacheDirty = true;
 
-    // tell the canvas to invalidate the render graph (never want to do this while rendering)
+    // tell the canvas to invalidate the part of the render graph for this element (never want to do this while rendering)
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkElementRenderGraphDirty, GetEntityId());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
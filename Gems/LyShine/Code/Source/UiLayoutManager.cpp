@@ -6,6 +6,7 @@
  *
  */
 #include "UiLayoutManager.h"
+#include "UiElementHierarchy.h"
 
 #include <LyShine/Bus/UiLayoutBus.h>
 #include <LyShine/Bus/UiElementBus.h>
@@ -16,7 +17,8 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-UiLayoutManager::UiLayoutManager(AZ::EntityId canvasEntityId)
+UiLayoutManager::UiLayoutManager(AZ::EntityId canvasEntityId, UiElementHierarchy* elementHierarchy)
+    : m_elementHierarchy(elementHierarchy)
 {
     UiLayoutManagerBus::Handler::BusConnect(canvasEntityId);
 }
@@ -40,8 +42,7 @@ void UiLayoutManager::MarkToRecomputeLayout(AZ::EntityId entityId)
 void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::EntityId entityId, bool isDefaultLayoutCell)
 {
     AZ::EntityId topParent;
-    AZ::EntityId parent;
-    EBUS_EVENT_ID_RESULT(parent, entityId, UiElementBus, GetParentEntityId);
+    AZ::EntityId parent = GetParentEntityId(entityId);
     while (parent.IsValid())
     {
         bool usesLayoutCells = false;
@@ -56,8 +57,7 @@ void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::Entit
         if (usesLayoutCells)
         {
             topParent = parent;
-            parent.SetInvalid();
-            EBUS_EVENT_ID_RESULT(parent, topParent, UiElementBus, GetParentEntityId);
+            parent = GetParentEntityId(topParent);
         }
         else
         {
@@ -91,25 +91,49 @@ void UiLayoutManager::RecomputeMarkedLayouts()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::ComputeLayoutForElementAndDescendants(AZ::EntityId entityId)
 {
-    // Get a list of layout children
-    auto FindLayoutChildren = [](const AZ::Entity* entity)
+    // Get a list of layout children. The descendants are in depth first order so parents are laid out before their children
+    AZStd::vector<AZ::EntityId> layoutChildren;
+
+    m_elementHierarchy->Refresh();
+    const int index = m_elementHierarchy->FindIndex(entityId);
+    if (index != UiElementHierarchy::InvalidIndex)
+    {
+        const int descendantsEnd = m_elementHierarchy->GetDescendantsEnd(index);
+        for (int descendantIndex = index + 1; descendantIndex < descendantsEnd; ++descendantIndex)
         {
-            return (UiLayoutControllerBus::FindFirstHandler(entity->GetId())) ? true : false;
-        };
+            AZ::EntityId descendant = m_elementHierarchy->GetEntityId(descendantIndex);
+            if (UiLayoutControllerBus::FindFirstHandler(descendant))
+            {
+                layoutChildren.push_back(descendant);
+            }
+        }
+    }
+    else
+    {
+        // The element is not in the hierarchy yet, fall back to searching the element's descendants
+        auto FindLayoutChildren = [](const AZ::Entity* entity)
+            {
+                return (UiLayoutControllerBus::FindFirstHandler(entity->GetId())) ? true : false;
+            };
 
-    LyShine::EntityArray layoutChildren;
-    EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements, FindLayoutChildren, layoutChildren);
+        LyShine::EntityArray layoutChildEntities;
+        EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements, FindLayoutChildren, layoutChildEntities);
+        for (auto layoutChildEntity : layoutChildEntities)
+        {
+            layoutChildren.push_back(layoutChildEntity->GetId());
+        }
+    }
 
     EBUS_EVENT_ID(entityId, UiLayoutControllerBus, ApplyLayoutWidth);
     for (auto layoutChild : layoutChildren)
     {
-        EBUS_EVENT_ID(layoutChild->GetId(), UiLayoutControllerBus, ApplyLayoutWidth);
+        EBUS_EVENT_ID(layoutChild, UiLayoutControllerBus, ApplyLayoutWidth);
     }
 
     EBUS_EVENT_ID(entityId, UiLayoutControllerBus, ApplyLayoutHeight);
     for (auto layoutChild : layoutChildren)
     {
-        EBUS_EVENT_ID(layoutChild->GetId(), UiLayoutControllerBus, ApplyLayoutHeight);
+        EBUS_EVENT_ID(layoutChild, UiLayoutControllerBus, ApplyLayoutHeight);
     }
 }
 
@@ -135,24 +159,38 @@ void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
         }
 
         // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity) { return true; },
-            descendants);
+        m_elementHierarchy->Refresh();
+        const int index = m_elementHierarchy->FindIndex(entityId);
+        if (index != UiElementHierarchy::InvalidIndex)
+        {
+            m_elementsToRecomputeLayout.remove_if(
+                [this, index](const AZ::EntityId& e)
+                {
+                    return m_elementHierarchy->IsAncestorOf(index, m_elementHierarchy->FindIndex(e));
+                }
+                );
+        }
+        else
+        {
+            LyShine::EntityArray descendants;
+            EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements,
+                []([[maybe_unused]] const AZ::Entity* entity) { return true; },
+                descendants);
 
-        m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
-            {
-                for (auto descendant : descendants)
+            m_elementsToRecomputeLayout.remove_if(
+                [descendants](const AZ::EntityId& e)
                 {
-                    if (descendant->GetId() == e)
+                    for (auto descendant : descendants)
                     {
-                        return true;
+                        if (descendant->GetId() == e)
+                        {
+                            return true;
+                        }
                     }
+                    return false;
                 }
-                return false;
-            }
-            );
+                );
+        }
 
         // Add element to list
         m_elementsToRecomputeLayout.push_back(entityId);
@@ -162,6 +200,14 @@ void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity)
 {
+    m_elementHierarchy->Refresh();
+    const int parentIndex = m_elementHierarchy->FindIndex(checkParentEntity);
+    const int childIndex = m_elementHierarchy->FindIndex(checkChildEntity);
+    if (parentIndex != UiElementHierarchy::InvalidIndex && childIndex != UiElementHierarchy::InvalidIndex)
+    {
+        return m_elementHierarchy->IsAncestorOf(parentIndex, childIndex);
+    }
+
     AZ::EntityId parent;
     EBUS_EVENT_ID_RESULT(parent, checkChildEntity, UiElementBus, GetParentEntityId);
     while (parent.IsValid())
@@ -179,3 +225,18 @@ bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::Enti
     return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+AZ::EntityId UiLayoutManager::GetParentEntityId(AZ::EntityId entityId)
+{
+    m_elementHierarchy->Refresh();
+    const int index = m_elementHierarchy->FindIndex(entityId);
+    if (index != UiElementHierarchy::InvalidIndex)
+    {
+        const int parentIndex = m_elementHierarchy->GetParentIndex(index);
+        return parentIndex != UiElementHierarchy::InvalidIndex ? m_elementHierarchy->GetEntityId(parentIndex) : AZ::EntityId();
+    }
+
+    AZ::EntityId parent;
+    EBUS_EVENT_ID_RESULT(parent, entityId, UiElementBus, GetParentEntityId);
+    return parent;
+}
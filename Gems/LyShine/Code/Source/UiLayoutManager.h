@@ -9,13 +9,16 @@
 
 #include <LyShine/Bus/UiLayoutManagerBus.h>
 
+class UiElementHierarchy;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class UiLayoutManager
     : public UiLayoutManagerBus::Handler
 {
 public: // member functions
 
-    UiLayoutManager(AZ::EntityId canvasEntityId);
+    //! Queries about the element hierarchy are answered from the canvas's flattened hierarchy, when it contains the elements
+    UiLayoutManager(AZ::EntityId canvasEntityId, UiElementHierarchy* elementHierarchy);
     ~UiLayoutManager();
 
     // UiLayoutManagerBus interface implementation
@@ -34,9 +37,12 @@ private: // member functions
 
     void AddToRecomputeLayoutList(AZ::EntityId entityId);
     bool IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity);
+    AZ::EntityId GetParentEntityId(AZ::EntityId entityId);
 
 private: // data
 
+    UiElementHierarchy* m_elementHierarchy = nullptr;
+
     //! Elements that need to recompute their layouts. Parents should be ahead of their children
     AZStd::list<AZ::EntityId> m_elementsToRecomputeLayout;
 };
@@ -33,6 +33,7 @@
 #include "StringUtfUtils.h"
 #include "UiLayoutHelpers.h"
 #include "RenderGraph.h"
+#include "UiTextRunCache.h"
 
 #include <AtomLyIntegration/AtomFont/FFont.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
@@ -631,7 +632,7 @@ namespace
                 char* codepointPtr = codepoint;
                 Utf8::Unchecked::octet_iterator<AZStd::string::iterator>::to_utf8_sequence(ch, codepointPtr, maxSize);
 
-                float curCharWidth = drawBatch.font->GetTextSize(codepoint, true, ctx).x;
+                float curCharWidth = UiTextRunCache::GetCachedTextSize(drawBatch.font, codepoint, ctx).x;
 
                 if (prevCh && ctx.m_kerningEnabled)
                 {
@@ -1070,6 +1071,33 @@ namespace
         }
     }
 
+    //! Returns true if the font generates the same quads for a string with either draw context.
+    //! The color override is not compared since the render cache batches store their own color.
+    bool DoDrawContextsGenerateSameQuads(const STextDrawContext& lhs, const STextDrawContext& rhs)
+    {
+        return lhs.m_fxIdx == rhs.m_fxIdx
+            && lhs.m_size == rhs.m_size
+            && lhs.m_requestSize == rhs.m_requestSize
+            && lhs.m_widthScale == rhs.m_widthScale
+            && lhs.m_lineSpacing == rhs.m_lineSpacing
+            && lhs.m_clipX == rhs.m_clipX
+            && lhs.m_clipY == rhs.m_clipY
+            && lhs.m_clipWidth == rhs.m_clipWidth
+            && lhs.m_clipHeight == rhs.m_clipHeight
+            && lhs.m_drawTextFlags == rhs.m_drawTextFlags
+            && lhs.m_proportional == rhs.m_proportional
+            && lhs.m_sizeIn800x600 == rhs.m_sizeIn800x600
+            && lhs.m_clippingEnabled == rhs.m_clippingEnabled
+            && lhs.m_framed == rhs.m_framed
+            && lhs.m_baseState == rhs.m_baseState
+            && lhs.m_overrideViewProjMatrices == rhs.m_overrideViewProjMatrices
+            && lhs.m_kerningEnabled == rhs.m_kerningEnabled
+            && lhs.m_processSpecialChars == rhs.m_processSpecialChars
+            && lhs.m_pixelAligned == rhs.m_pixelAligned
+            && lhs.m_tracking == rhs.m_tracking
+            && Matrix34::IsEquivalent(lhs.m_transform, rhs.m_transform, 0.0f);
+    }
+
 }   // anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1211,7 +1239,7 @@ void UiTextComponent::DrawBatch::CalculateSize(const STextDrawContext& ctx, bool
             }
         }
 
-        Vec2 textSize = font->GetTextSize(displayString.c_str(), true, ctx);
+        Vec2 textSize = UiTextRunCache::GetCachedTextSize(font, displayString.c_str(), ctx);
         size = AZ::Vector2(textSize.x, textSize.y);
     }
     else if (GetType() == UiTextComponent::DrawBatch::Type::Image)
@@ -1319,7 +1347,7 @@ bool UiTextComponent::DrawBatch::GetOverflowInfo(const STextDrawContext& ctx,
             char* codepointPtr = codepoint;
             Utf8::Unchecked::octet_iterator<AZStd::string::iterator>::to_utf8_sequence(ch, codepointPtr, maxSize);
 
-            float curCharWidth = font->GetTextSize(codepoint, true, ctx).x;
+            float curCharWidth = UiTextRunCache::GetCachedTextSize(font, codepoint, ctx).x;
             if (prevCh)
             {
                 curCharWidth -= maxEffectOffsetX;
@@ -1720,8 +1748,8 @@ void UiTextComponent::ResetOverrides()
         }
         else
         {
-            // alpha changed but there is no transparency in font effect so we need RenderGraph to be rebuilt but not render cache
-            MarkRenderGraphDirty();
+            // alpha changed but there is no transparency in font effect so we need RenderGraph to be updated but not render cache
+            MarkElementRenderGraphDirty();
         }
     }
 }
@@ -1750,8 +1778,8 @@ void UiTextComponent::SetOverrideAlpha(float alpha)
         }
         else
         {
-            // alpha changed but there is no transparency in font effect so we need RenderGraph to be rebuilt but not render cache
-            MarkRenderGraphDirty();
+            // alpha changed but there is no transparency in font effect so we need RenderGraph to be updated but not render cache
+            MarkElementRenderGraphDirty();
         }
     }
 }
@@ -2034,8 +2062,8 @@ void UiTextComponent::SetColor(const AZ::Color& color)
         }
         else
         {
-            // alpha changed so we need RenderGraph to be rebuilt but not render cache
-            MarkRenderGraphDirty();
+            // alpha changed so we need RenderGraph to be updated but not render cache
+            MarkElementRenderGraphDirty();
         }
     }
 }
@@ -3891,20 +3919,27 @@ void UiTextComponent::CalculateDrawBatchLines(
     }
 
     // Go through the drawBatchLines and apply the text transform
+    AZStd::string batchedChars;
     for (DrawBatch& drawBatch : drawBatches)
     {
         if (drawBatch.GetType() == UiTextComponent::DrawBatch::Type::Text)
         {
             drawBatch.text = m_displayedTextFunction(drawBatch.text);
-
-            // If the font changed recently, then the font texture is empty, and won't be
-            // populated until the frame renders. If the glyphs aren't mapped to the
-            // font texture, then their sizes will be reported as zero/missing, which
-            // causes issues with alignment.
-            gEnv->pCryFont->AddCharsToFontTextures(m_fontFamily, drawBatch.text.c_str(), requestFontSize, requestFontSize);
+            batchedChars += drawBatch.text;
         }
     }
 
+    // If the font changed recently, then the font texture is empty, and won't be
+    // populated until the frame renders. If the glyphs aren't mapped to the
+    // font texture, then their sizes will be reported as zero/missing, which
+    // causes issues with alignment.
+    // The characters of all the batches are added in one call so that each font in the
+    // family only has to look up the glyphs of the text once.
+    if (!batchedChars.empty())
+    {
+        gEnv->pCryFont->AddCharsToFontTextures(m_fontFamily, batchedChars.c_str(), requestFontSize, requestFontSize);
+    }
+
     if (wrapText)
     {
         if (drawBatchLinesOut.inlineImages.empty())
@@ -4013,9 +4048,18 @@ void UiTextComponent::RenderToCache(float alpha)
             elemSize.GetY());
     }
 
+    // The text batches from before the cache was marked dirty can only be reused if their quads
+    // were generated with the same settings
+    if (!DoDrawContextsGenerateSameQuads(m_renderCache.m_fontContext, fontContext))
+    {
+        FreePreviousRenderCacheBatches();
+    }
+
     m_renderCache.m_fontContext = fontContext;
     AZ::Vector2 pos = CalculateAlignedPositionWithYOffset(points);
     RenderDrawBatchLines(drawBatchLines, pos, points, transform, fontContext);
+
+    FreePreviousRenderCacheBatches();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -4073,12 +4117,29 @@ void UiTextComponent::RenderDrawBatchLines(
 
                 fontContext.m_colorOverride = batchColor;
 
+                const AZ::Vector2 batchPosition(alignedPosition.GetX(), alignedPosition.GetY() + drawBatch.yOffset);
+
+                // When part of the text changes, for example when text is appended, the batches before the change
+                // have the same text and position as before so their quads are reused rather than regenerated
+                const size_t batchIndex = m_renderCache.m_batches.size();
+                RenderCacheBatch* previousBatch = batchIndex < m_renderCache.m_previousBatches.size() ? m_renderCache.m_previousBatches[batchIndex] : nullptr;
+                if (previousBatch
+                    && previousBatch->m_position == batchPosition
+                    && previousBatch->m_font == drawBatch.font
+                    && previousBatch->m_color == batchColor
+                    && previousBatch->m_fontTextureVersion == drawBatch.font->GetFontTextureVersion()
+                    && previousBatch->m_text == drawBatch.text)
+                {
+                    m_renderCache.m_previousBatches[batchIndex] = nullptr;
+                    m_renderCache.m_batches.push_back(previousBatch);
+                    continue;
+                }
+
                 uint32 numQuads = drawBatch.font->GetNumQuadsForText(drawBatch.text.c_str(), true, fontContext);
                 if (numQuads > 0)
                 {
                     RenderCacheBatch* cacheBatch = new RenderCacheBatch;
-                    cacheBatch->m_position = alignedPosition;
-                    cacheBatch->m_position.SetY(cacheBatch->m_position.GetY() + drawBatch.yOffset);
+                    cacheBatch->m_position = batchPosition;
                     cacheBatch->m_text = drawBatch.text;
                     cacheBatch->m_font = drawBatch.font;
                     cacheBatch->m_color = batchColor;
@@ -4781,7 +4842,7 @@ UiTextComponent::DrawBatch* UiTextComponent::GetDrawBatchToEllipseAndPositions(c
         const bool moreDrawBatchesAvailable = moreBatchesPriorToImage || moreTextBatches;
 
         // The size of the ellipsis text can change based on the font being used in the draw batch
-        ellipsisSize = drawBatchToEllipse->font->GetTextSize(ellipseText, true, ctx).x;
+        ellipsisSize = UiTextRunCache::GetCachedTextSize(drawBatchToEllipse->font, ellipseText, ctx).x;
 
         // Calculate where the ellipsis must start in order to be contained within the
         // element bounds. Also, guard against narrow elements that aren't wide enough
@@ -4847,7 +4908,7 @@ int UiTextComponent::GetStartEllipseIndexInDrawBatch(const DrawBatch* drawBatchT
         char* codepointPtr = codepoint;
         Utf8::Unchecked::octet_iterator<AZStd::string::iterator>::to_utf8_sequence(ch, codepointPtr, maxSize);
 
-        overflowStringSize += drawBatchToEllipse->font->GetTextSize(codepoint, true, ctx).x;
+        overflowStringSize += UiTextRunCache::GetCachedTextSize(drawBatchToEllipse->font, codepoint, ctx).x;
 
         if (prevCh && ctx.m_kerningEnabled)
         {
@@ -5164,7 +5225,13 @@ void UiTextComponent::MarkRenderCacheDirty()
 {
     if (!m_renderCache.m_isDirty)
     {
+        // Keep the text batches so that RenderToCache can reuse the ones that do not change
+        AZStd::vector<RenderCacheBatch*> textBatches;
+        textBatches.swap(m_renderCache.m_batches);
+
         ClearRenderCache();
+
+        m_renderCache.m_previousBatches.swap(textBatches);
     }
 }
 
@@ -5177,6 +5244,15 @@ void UiTextComponent::MarkRenderGraphDirty()
     EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextComponent::MarkElementRenderGraphDirty()
+{
+    // tell the canvas to invalidate the part of the render graph for this element
+    AZ::EntityId canvasEntityId;
+    EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkElementRenderGraphDirty, GetEntityId());
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiTextComponent::ClearRenderCache()
 {
@@ -5208,6 +5284,25 @@ void UiTextComponent::FreeRenderCacheMemory()
 
     m_renderCache.m_batches.clear();
     m_renderCache.m_imageBatches.clear();
+
+    FreePreviousRenderCacheBatches();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextComponent::FreePreviousRenderCacheBatches()
+{
+    for (RenderCacheBatch* textBatch : m_renderCache.m_previousBatches)
+    {
+        // batches that have been reused are set to null
+        if (textBatch)
+        {
+            delete [] textBatch->m_cachedPrimitive.m_vertices;
+            delete [] textBatch->m_cachedPrimitive.m_indices;
+            delete textBatch;
+        }
+    }
+
+    m_renderCache.m_previousBatches.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
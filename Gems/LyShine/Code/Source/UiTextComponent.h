@@ -466,6 +466,9 @@ protected: // member functions
     //! Update the text render batches in the case of a font texture change
     void UpdateTextRenderBatchesForFontTextureChange();
 
+    //! Free the text batches that were kept for reuse when the render cache was marked dirty
+    void FreePreviousRenderCacheBatches();
+
     //! Returns a prototypical STextDrawContext to be used when interacting with IFont routines..
     STextDrawContext GetTextDrawContextPrototype(int requestFontSize, const AZ::Vector2& fontSizeScale) const;
 
@@ -584,6 +587,10 @@ private: // member functions
     //! Mark the render graph as dirty, this should be done when any change is made affects the structure of the graph
     void MarkRenderGraphDirty();
 
+    //! Mark the part of the render graph for this element as dirty, this should be done when the cached batches are
+    //! kept but their vertices change
+    void MarkElementRenderGraphDirty();
+
     //! Clear the render cache
     void ClearRenderCache();
 
@@ -623,6 +630,7 @@ private: // types
         STextDrawContext                        m_fontContext;
         AZStd::vector<RenderCacheBatch*>        m_batches;
         AZStd::vector<RenderCacheImageBatch*>   m_imageBatches;
+        AZStd::vector<RenderCacheBatch*>        m_previousBatches;  //!< Text batches from before the cache was marked dirty, reused by RenderToCache if unchanged
     };
 
 private: // data
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UiTextRunCache.h"
+
+#include <AzCore/std/hash.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// PUBLIC MEMBER FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextRunCache::UiTextRunCache()
+{
+    AZ::Interface<UiTextRunCache>::Register(this);
+    FontNotificationBus::Handler::BusConnect();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextRunCache::~UiTextRunCache()
+{
+    FontNotificationBus::Handler::BusDisconnect();
+    AZ::Interface<UiTextRunCache>::Unregister(this);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Vec2 UiTextRunCache::GetTextSize(IFFont* font, const char* text, const STextDrawContext& ctx)
+{
+    // Sizes in 800x600 space depend on the viewport so they are not cached
+    if (ctx.m_sizeIn800x600)
+    {
+        return font->GetTextSize(text, true, ctx);
+    }
+
+    Key key;
+    key.m_font = font;
+    key.m_text = text;
+    key.m_size = ctx.m_size;
+    key.m_requestSize = ctx.m_requestSize;
+    key.m_widthScale = ctx.m_widthScale;
+    key.m_lineSpacing = ctx.m_lineSpacing;
+    key.m_tracking = ctx.m_tracking;
+    key.m_fxIdx = ctx.m_fxIdx;
+    key.m_proportional = ctx.m_proportional;
+    key.m_kerningEnabled = ctx.m_kerningEnabled;
+    key.m_processSpecialChars = ctx.m_processSpecialChars;
+
+    auto iter = m_entries.find(key);
+    if (iter != m_entries.end())
+    {
+        return iter->second;
+    }
+
+    if (m_entries.size() >= MaxEntries)
+    {
+        m_entries.clear();
+    }
+
+    Vec2 size = font->GetTextSize(text, true, ctx);
+    m_entries.emplace(AZStd::move(key), size);
+    return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextRunCache::Clear()
+{
+    m_entries.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+Vec2 UiTextRunCache::GetCachedTextSize(IFFont* font, const char* text, const STextDrawContext& ctx)
+{
+    UiTextRunCache* textRunCache = AZ::Interface<UiTextRunCache>::Get();
+    return textRunCache ? textRunCache->GetTextSize(font, text, ctx) : font->GetTextSize(text, true, ctx);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// PROTECTED MEMBER FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextRunCache::OnFontsReloaded()
+{
+    Clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextRunCache::OnFontDestroyed(IFFont* font)
+{
+    // A new font could be created at the same address so drop the entries for this one
+    for (auto iter = m_entries.begin(); iter != m_entries.end();)
+    {
+        iter = iter->first.m_font == font ? m_entries.erase(iter) : AZStd::next(iter);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// PRIVATE MEMBER FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiTextRunCache::Key::operator==(const Key& rhs) const
+{
+    return m_font == rhs.m_font
+        && m_size == rhs.m_size
+        && m_requestSize == rhs.m_requestSize
+        && m_widthScale == rhs.m_widthScale
+        && m_lineSpacing == rhs.m_lineSpacing
+        && m_tracking == rhs.m_tracking
+        && m_fxIdx == rhs.m_fxIdx
+        && m_proportional == rhs.m_proportional
+        && m_kerningEnabled == rhs.m_kerningEnabled
+        && m_processSpecialChars == rhs.m_processSpecialChars
+        && m_text == rhs.m_text;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t UiTextRunCache::KeyHasher::operator()(const Key& key) const
+{
+    size_t hash = AZStd::hash<AZStd::string>()(key.m_text);
+    AZStd::hash_combine(hash, key.m_font, key.m_size.x, key.m_size.y, key.m_requestSize.x, key.m_requestSize.y,
+        key.m_widthScale, key.m_lineSpacing, key.m_tracking, key.m_fxIdx);
+    return hash;
+}
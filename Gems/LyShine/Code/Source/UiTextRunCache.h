@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+#include <IFont.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//! Caches the measured sizes of runs of text, keyed by the string, the font and the font size and
+//! spacing settings. Text components re-measure the same runs and characters each time they lay out
+//! their text (for example when wrapping or when the text changes back and forth on a scoreboard),
+//! and measuring through the font system is expensive.
+//! The cache is owned by CLyShine and registered with AZ::Interface. It must only be used on the main thread.
+class UiTextRunCache
+    : protected FontNotificationBus::Handler
+{
+public: // constants
+
+    //! When the cache grows to this many entries it is cleared
+    static constexpr size_t MaxEntries = 8192;
+
+public: // member functions
+
+    AZ_RTTI(UiTextRunCache, "{5D1E7A2C-3B84-4F0E-9C61-2A8F04B7D913}");
+    AZ_CLASS_ALLOCATOR(UiTextRunCache, AZ::SystemAllocator, 0);
+
+    UiTextRunCache();
+    ~UiTextRunCache() override;
+
+    //! Get the size of a run of text, measuring it with the font if it is not in the cache
+    Vec2 GetTextSize(IFFont* font, const char* text, const STextDrawContext& ctx);
+
+    void Clear();
+
+    size_t GetNumEntries() const { return m_entries.size(); }
+
+    //! Get the size of a run of text through the cache if one is registered, otherwise directly from the font
+    static Vec2 GetCachedTextSize(IFFont* font, const char* text, const STextDrawContext& ctx);
+
+protected: // member functions
+
+    // FontNotifications
+    void OnFontsReloaded() override;
+    void OnFontDestroyed(IFFont* font) override;
+    // ~FontNotifications
+
+private: // types
+
+    //! The text and the fields of the draw context that affect the measured size
+    struct Key
+    {
+        bool operator==(const Key& rhs) const;
+
+        IFFont* m_font = nullptr;
+        AZStd::string m_text;
+        Vec2 m_size;
+        Vec2i m_requestSize;
+        float m_widthScale = 1.0f;
+        float m_lineSpacing = 0.0f;
+        float m_tracking = 0.0f;
+        unsigned int m_fxIdx = 0;
+        bool m_proportional = true;
+        bool m_kerningEnabled = true;
+        bool m_processSpecialChars = true;
+    };
+
+    struct KeyHasher
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+private: // member functions
+
+    AZ_DISABLE_COPY_MOVE(UiTextRunCache);
+
+private: // data
+
+    AZStd::unordered_map<Key, Vec2, KeyHasher> m_entries;
+};
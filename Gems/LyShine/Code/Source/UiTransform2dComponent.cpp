@@ -1177,6 +1177,13 @@ void UiTransform2dComponent::RecomputeTransformsAndSendNotifications()
     RecomputeTransformToViewportIfNeeded();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTransform2dComponent::RecomputeRectAndTransformToCanvasSpaceIfNeeded()
+{
+    CalculateCanvasSpaceRect();
+    RecomputeTransformToCanvasSpaceIfNeeded();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // PUBLIC STATIC MEMBER FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////////////////////////
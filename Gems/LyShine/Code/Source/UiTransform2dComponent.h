@@ -118,6 +118,10 @@ public: // member functions
     //! This is called from the canvas component during the update if the element was scheduled for a transform recompute
     void RecomputeTransformsAndSendNotifications();
 
+    //! Recompute the canvas space rect and transform if they are dirty, without sending any notifications.
+    //! The parent's rect and transform must be up to date. Used by the canvas to compute the hierarchy a level at a time
+    void RecomputeRectAndTransformToCanvasSpaceIfNeeded();
+
 #if defined(LYSHINE_INTERNAL_UNIT_TEST)
     static void UnitTest(CLyShine* lyshine, IConsoleCmdArgs* cmdArgs);
 #endif
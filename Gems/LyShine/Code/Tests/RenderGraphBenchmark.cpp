@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+#include <RenderGraph.h>
+
+namespace Benchmark
+{
+    //! Builds the render graph of a canvas the way UiCanvasComponent does when the graph is dirty, without a renderer.
+    //! Every primitive is a quad like the ones of image components, added by an element of its own, and every run of
+    //! siblings with the same render state shares a render node. Updating compares it with rendering a few of those
+    //! elements again into the built graph, as UiCanvasComponent does when only they are marked dirty.
+    class BM_RenderGraph
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            const int64_t primitiveCount = state.range(0);
+
+            m_vertices.resize(primitiveCount * NumVerticesPerQuad);
+            m_primitives.resize(primitiveCount);
+            for (int64_t i = 0; i < primitiveCount; ++i)
+            {
+                LyShine::UiPrimitiveVertex* vertices = &m_vertices[i * NumVerticesPerQuad];
+                for (int vertex = 0; vertex < NumVerticesPerQuad; ++vertex)
+                {
+                    vertices[vertex] = {};
+                    vertices[vertex].xy = Vec2(static_cast<float>(i), static_cast<float>(vertex));
+                    vertices[vertex].color.dcolor = 0xffffffff;
+                }
+
+                m_primitives[i].m_vertices = vertices;
+                m_primitives[i].m_numVertices = NumVerticesPerQuad;
+                m_primitives[i].m_indices = m_quadIndices;
+                m_primitives[i].m_numIndices = NumIndicesPerQuad;
+            }
+
+            m_renderGraph = AZStd::make_unique<LyShine::RenderGraph>();
+        }
+
+        void internalTearDown()
+        {
+            m_renderGraph.reset();
+            m_primitives = {};
+            m_vertices = {};
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void BuildGraph()
+        {
+            m_renderGraph->ResetGraph();
+            for (size_t i = 0; i < m_primitives.size(); ++i)
+            {
+                m_renderGraph->BeginElement(GetElementId(i));
+                AddPrimitive(i);
+                m_renderGraph->EndElement();
+            }
+            m_renderGraph->SetDirtyFlag(false);
+            m_renderGraph->FinalizeGraph();
+        }
+
+        bool UpdateElements(size_t elementStride)
+        {
+            bool isUpdated = true;
+            for (size_t i = 0; i < m_primitives.size(); i += elementStride)
+            {
+                isUpdated &= m_renderGraph->BeginElementUpdate(GetElementId(i));
+                AddPrimitive(i);
+                isUpdated &= m_renderGraph->EndElementUpdate();
+            }
+            return isUpdated;
+        }
+
+        void AddPrimitive(size_t i)
+        {
+            const AZ::Data::Instance<AZ::RPI::Image> texture;
+
+            // change the render state every run of siblings so the graph has a render node per run
+            const bool isTextureSRGB = (i / NumSiblingsPerRenderState) % 2 != 0;
+            m_renderGraph->AddPrimitive(&m_primitives[i], texture, true, isTextureSRGB, false, LyShine::BlendMode::Normal);
+        }
+
+        static AZ::EntityId GetElementId(size_t i)
+        {
+            return AZ::EntityId(i + 1);
+        }
+
+        static constexpr int NumVerticesPerQuad = 4;
+        static constexpr int NumIndicesPerQuad = 6;
+        static constexpr size_t NumSiblingsPerRenderState = 64;
+
+        uint16 m_quadIndices[NumIndicesPerQuad] = { 0, 1, 2, 2, 3, 0 };
+        AZStd::vector<LyShine::UiPrimitiveVertex> m_vertices;
+        AZStd::vector<LyShine::UiPrimitive> m_primitives;
+        AZStd::unique_ptr<LyShine::RenderGraph> m_renderGraph;
+    };
+
+    BENCHMARK_DEFINE_F(BM_RenderGraph, RebuildGraph)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            BuildGraph();
+            benchmark::DoNotOptimize(m_renderGraph->IsEmpty());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_RenderGraph, RebuildGraph)
+        ->Arg(1000)->Arg(10000)->Unit(::benchmark::kMicrosecond);
+
+    //! Updates one element in every hundred, without rebuilding the graph
+    BENCHMARK_DEFINE_F(BM_RenderGraph, UpdateDirtyElements)(benchmark::State& state)
+    {
+        constexpr size_t elementStride = 100;
+
+        BuildGraph();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (!UpdateElements(elementStride))
+            {
+                state.SkipWithError("The elements were not updated in place");
+                break;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * (state.range(0) / elementStride));
+    }
+    BENCHMARK_REGISTER_F(BM_RenderGraph, UpdateDirtyElements)
+        ->Arg(1000)->Arg(10000)->Unit(::benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LyShineTest.h"
+
+#include "UiGameEntityContext.h"
+#include "UiElementComponent.h"
+#include "UiElementHierarchy.h"
+#include "UiTransform2dComponent.h"
+#include "UiCanvasComponent.h"
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Entity/GameEntityContextComponent.h>
+#include <AzFramework/Asset/AssetSystemComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Memory/MemoryComponent.h>
+#include <AzCore/Asset/AssetManagerComponent.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/Jobs/JobManagerComponent.h>
+#include <AzCore/Slice/SliceSystemComponent.h>
+
+namespace UnitTest
+{
+    // Simplified version of AzFramework::Application
+    class UiElementHierarchyTestApplication
+        : public AzFramework::Application
+    {
+        void Reflect(AZ::ReflectContext* context) override
+        {
+            AzFramework::Application::Reflect(context);
+            UiSerialize::ReflectUiTypes(context); //< needed to serialize ui Anchor and Offset
+        }
+
+        // override and only include system components required for tests.
+        AZ::ComponentTypeList GetRequiredSystemComponents() const override
+        {
+            return AZ::ComponentTypeList{
+                azrtti_typeid<AZ::MemoryComponent>(),
+                azrtti_typeid<AZ::AssetManagerComponent>(),
+                azrtti_typeid<AZ::JobManagerComponent>(),
+                azrtti_typeid<AZ::StreamerComponent>(),
+                azrtti_typeid<AZ::SliceSystemComponent>(),
+                azrtti_typeid<AzFramework::GameEntityContextComponent>(),
+                azrtti_typeid<AzFramework::AssetSystem::AssetSystemComponent>(),
+            };
+        }
+
+        void RegisterCoreComponents() override
+        {
+            AzFramework::Application::RegisterCoreComponents();
+            RegisterComponentDescriptor(UiTransform2dComponent::CreateDescriptor());
+            RegisterComponentDescriptor(UiElementComponent::CreateDescriptor());
+            RegisterComponentDescriptor(UiCanvasComponent::CreateDescriptor());
+        }
+    };
+
+    class UiElementHierarchyTest
+        : public UnitTest::AllocatorsTestFixture
+    {
+    protected:
+
+        void SetUp() override
+        {
+            // start application
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+            AZ::ComponentApplication::Descriptor appDescriptor;
+            appDescriptor.m_useExistingAllocator = true;
+
+            m_application = aznew UiElementHierarchyTestApplication();
+            m_application->Start(appDescriptor, AZ::ComponentApplication::StartupParameters());
+
+            // create a canvas
+            UiGameEntityContext* entityContext = new UiGameEntityContext(); //< UiCanvasComponent takes ownership of this pointer and will free this when exiting
+            m_canvas = UiCanvasComponent::CreateCanvasInternal(entityContext, false);
+        }
+
+        void TearDown() override
+        {
+            // clean up the canvas
+            delete m_canvas->GetEntity();
+            m_canvas = nullptr;
+
+            m_application->Stop();
+            delete m_application;
+            m_application = nullptr;
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+        }
+
+        static UiTransform2dComponent* AddTransform(AZ::Entity* element)
+        {
+            element->Deactivate(); //< deactivate so that we can add components
+            UiTransform2dComponent* transform = element->CreateComponent<UiTransform2dComponent>();
+            element->Activate();
+            return transform;
+        }
+
+        AZ::Entity* CreateElement(const char* name)
+        {
+            AZ::Entity* element = m_canvas->CreateChildElement(name);
+            AddTransform(element);
+            return element;
+        }
+
+        static AZ::Entity* CreateElement(AZ::Entity* parent, const char* name)
+        {
+            AZ::Entity* element = parent->FindComponent<UiElementComponent>()->CreateChildElement(name);
+            AddTransform(element);
+            return element;
+        }
+
+        UiCanvasComponent* m_canvas = nullptr;
+
+    private:
+        UiElementHierarchyTestApplication* m_application = nullptr;
+    };
+
+    TEST_F(UiElementHierarchyTest, UiElementHierarchy_Refresh_ElementsInDepthFirstOrder)
+    {
+        AZ::Entity* a = CreateElement("A");
+        AZ::Entity* a1 = CreateElement(a, "A1");
+        AZ::Entity* a2 = CreateElement(a, "A2");
+        AZ::Entity* b = CreateElement("B");
+        AZ::Entity* a1x = CreateElement(a1, "A1x");
+
+        UiElementHierarchy hierarchy(m_canvas->GetRootElement()->GetId());
+        hierarchy.Refresh();
+        ASSERT_TRUE(hierarchy.IsValid());
+        ASSERT_EQ(hierarchy.GetNumElements(), 6);
+
+        // the root is first, then each element is followed by its descendants
+        const AZ::EntityId expectedOrder[] = { m_canvas->GetRootElement()->GetId(), a->GetId(), a1->GetId(), a1x->GetId(), a2->GetId(), b->GetId() };
+        for (int index = 0; index < 6; ++index)
+        {
+            EXPECT_EQ(hierarchy.GetEntityId(index), expectedOrder[index]);
+        }
+
+        const int aIndex = hierarchy.FindIndex(a->GetId());
+        const int a1xIndex = hierarchy.FindIndex(a1x->GetId());
+        const int bIndex = hierarchy.FindIndex(b->GetId());
+        EXPECT_EQ(hierarchy.GetParentIndex(0), UiElementHierarchy::InvalidIndex);
+        EXPECT_EQ(hierarchy.GetParentIndex(a1xIndex), hierarchy.FindIndex(a1->GetId()));
+        EXPECT_EQ(hierarchy.GetDepth(a1xIndex), 3);
+        EXPECT_EQ(hierarchy.GetDescendantsEnd(aIndex), bIndex);
+        EXPECT_TRUE(hierarchy.IsAncestorOf(aIndex, a1xIndex));
+        EXPECT_FALSE(hierarchy.IsAncestorOf(bIndex, a1xIndex));
+        EXPECT_FALSE(hierarchy.IsAncestorOf(a1xIndex, aIndex));
+    }
+
+    TEST_F(UiElementHierarchyTest, UiElementHierarchy_ElementReparented_CanvasQueriesUseNewHierarchy)
+    {
+        AZ::Entity* a = CreateElement("A");
+        AZ::Entity* b = CreateElement("B");
+        AZ::Entity* child = CreateElement(a, "Child");
+
+        LyShine::EntityArray elements;
+        m_canvas->FindElementsByName("Child", elements);
+        ASSERT_EQ(elements.size(), 1);
+        EXPECT_EQ(elements[0], child);
+
+        child->FindComponent<UiElementComponent>()->Reparent(b);
+
+        // elements are returned in depth first order, so the child now follows B
+        elements.clear();
+        m_canvas->FindElements([]([[maybe_unused]] const AZ::Entity* entity) { return true; }, elements);
+        ASSERT_EQ(elements.size(), 3);
+        EXPECT_EQ(elements[0], a);
+        EXPECT_EQ(elements[1], b);
+        EXPECT_EQ(elements[2], child);
+
+        const LyShine::ElementId childId = child->FindComponent<UiElementComponent>()->GetElementId();
+        EXPECT_EQ(m_canvas->FindElementById(childId), child);
+    }
+
+    TEST_F(UiElementHierarchyTest, UiElementHierarchy_UpdateCanvas_RectsComputedParentsFirst)
+    {
+        AZ::Entity* parent = CreateElement("Parent");
+        AZ::Entity* child = CreateElement(parent, "Child");
+
+        UiTransform2dComponent* parentTransform = parent->FindComponent<UiTransform2dComponent>();
+        parentTransform->SetAnchors(UiTransform2dInterface::Anchors(0.0f, 0.0f, 0.0f, 0.0f), false, false);
+        parentTransform->SetOffsets(UiTransform2dInterface::Offsets(100.0f, 50.0f, 300.0f, 250.0f));
+
+        UiTransform2dComponent* childTransform = child->FindComponent<UiTransform2dComponent>();
+        childTransform->SetAnchors(UiTransform2dInterface::Anchors(0.5f, 0.5f, 1.0f, 1.0f), false, false);
+        childTransform->SetOffsets(UiTransform2dInterface::Offsets(0.0f, 0.0f, 0.0f, 0.0f));
+
+        m_canvas->UpdateCanvas(0.0f, true);
+
+        UiTransformInterface::Rect rect;
+        childTransform->GetCanvasSpaceRectNoScaleRotate(rect);
+        EXPECT_FLOAT_EQ(rect.left, 200.0f);
+        EXPECT_FLOAT_EQ(rect.top, 150.0f);
+        EXPECT_FLOAT_EQ(rect.right, 300.0f);
+        EXPECT_FLOAT_EQ(rect.bottom, 250.0f);
+    }
+} //namespace UnitTest
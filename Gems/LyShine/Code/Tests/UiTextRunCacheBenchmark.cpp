@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/string/conversions.h>
+#include <benchmark/benchmark.h>
+
+#include <UiTextRunCache.h>
+
+namespace Benchmark
+{
+    namespace UiTextRunCacheBenchmarkInternal
+    {
+        //! A font that measures text the way FFont does, by converting the string to a wide string and
+        //! looking up the advance of each character in its glyph cache. It does not render anything.
+        class BenchmarkFont
+            : public IFFont
+        {
+        public:
+            BenchmarkFont()
+            {
+                for (uint32_t ch = ' '; ch <= '~'; ++ch)
+                {
+                    m_glyphAdvances[ch] = static_cast<float>(8 + ch % 5);
+                }
+            }
+
+            int32 AddRef() override { return 1; }
+            int32 Release() override { return 1; }
+            bool Load(const char*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, float) override { return true; }
+            bool Load(const char*) override { return true; }
+            void Free() override {}
+            void DrawString(float, float, const char*, const bool, const STextDrawContext&) override {}
+            void DrawString(float, float, float, const char*, const bool, const STextDrawContext&) override {}
+
+            Vec2 GetTextSize(const char* str, [[maybe_unused]] const bool asciiMultiLine, const STextDrawContext& ctx) override
+            {
+                AZStd::wstring strW;
+                AZStd::to_wstring(strW, str);
+
+                float width = 0.0f;
+                for (wchar_t ch : strW)
+                {
+                    auto glyph = m_glyphAdvances.find(static_cast<uint32_t>(ch));
+                    width += (glyph != m_glyphAdvances.end() ? glyph->second : 0.0f) * ctx.m_size.x / 16.0f + ctx.m_tracking;
+                }
+                return Vec2(width, ctx.m_size.y);
+            }
+
+            size_t GetTextLength(const char* str, const bool) const override { return strlen(str); }
+            void WrapText(AZStd::string& result, float, const char* str, const STextDrawContext&) override { result = str; }
+            void GetGradientTextureCoord(float&, float&, float&, float&) const override {}
+            unsigned int GetEffectId(const char*) const override { return 0; }
+            unsigned int GetNumEffects() const override { return 1; }
+            const char* GetEffectName(unsigned int) const override { return "default"; }
+            Vec2 GetMaxEffectOffset(unsigned int) const override { return Vec2(0.0f, 0.0f); }
+            bool DoesEffectHaveTransparency(unsigned int) const override { return false; }
+            void AddCharsToFontTexture(const char*, int, int) override {}
+            Vec2 GetKerning(uint32_t, uint32_t, const STextDrawContext&) const override { return Vec2(0.0f, 0.0f); }
+            float GetAscender(const STextDrawContext& ctx) const override { return ctx.m_size.y; }
+            float GetBaseline(const STextDrawContext& ctx) const override { return ctx.m_size.y; }
+            float GetSizeRatio() const override { return IFFontConstants::defaultSizeRatio; }
+            uint32 GetNumQuadsForText(const char*, const bool, const STextDrawContext&) override { return 0; }
+            uint32 WriteTextQuadsToBuffers(SVF_P2F_C4B_T2F_F4B*, uint16*, uint32, float, float, float, const char*, const bool, const STextDrawContext&) override { return 0; }
+            int GetFontTextureId() override { return -1; }
+            uint32 GetFontTextureVersion() override { return 0; }
+
+        private:
+            AZStd::unordered_map<uint32_t, float> m_glyphAdvances;
+        };
+    }
+
+    //! Measures the text of a canvas with a scoreboard of text elements the way the text components do when they
+    //! lay out their text: each run of text is measured and, to find where to wrap, each character of it.
+    class BM_UiTextRunCache
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            const int64_t rowCount = state.range(0);
+
+            m_font = AZStd::make_unique<UiTextRunCacheBenchmarkInternal::BenchmarkFont>();
+            m_rows.reserve(rowCount);
+            for (int64_t row = 0; row < rowCount; ++row)
+            {
+                m_rows.push_back(AZStd::string::format("Player %lld  Kills %lld  Score %lld",
+                    static_cast<long long>(row), static_cast<long long>(row % 30), static_cast<long long>((row * 37) % 1000)));
+            }
+
+            m_ctx.SetSizeIn800x600(false);
+            m_ctx.SetSize(Vec2(24.0f, 24.0f));
+            m_ctx.m_requestSize = Vec2i(24, 24);
+            m_ctx.m_processSpecialChars = false;
+        }
+
+        void internalTearDown()
+        {
+            m_rows = {};
+            m_font.reset();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        template<typename MeasureFunction>
+        float LayOutRows(MeasureFunction measure)
+        {
+            float totalWidth = 0.0f;
+            for (const AZStd::string& row : m_rows)
+            {
+                totalWidth += measure(row.c_str()).x;
+
+                char codepoint[2] = { 0, 0 };
+                for (char ch : row)
+                {
+                    codepoint[0] = ch;
+                    totalWidth += measure(codepoint).x;
+                }
+            }
+            return totalWidth;
+        }
+
+        AZStd::unique_ptr<UiTextRunCacheBenchmarkInternal::BenchmarkFont> m_font;
+        AZStd::vector<AZStd::string> m_rows;
+        STextDrawContext m_ctx;
+    };
+
+    BENCHMARK_DEFINE_F(BM_UiTextRunCache, LayOutText_Font)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(LayOutRows([this](const char* text) { return m_font->GetTextSize(text, true, m_ctx); }));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_UiTextRunCache, LayOutText_Font)
+        ->Arg(100)->Arg(1000)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_UiTextRunCache, LayOutText_TextRunCache)(benchmark::State& state)
+    {
+        // the canvas is laid out every iteration, after the first one the runs are in the cache
+        UiTextRunCache textRunCache;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(LayOutRows([this, &textRunCache](const char* text) { return textRunCache.GetTextSize(m_font.get(), text, m_ctx); }));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_UiTextRunCache, LayOutText_TextRunCache)
+        ->Arg(100)->Arg(1000)->Unit(::benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -140,6 +140,8 @@ set(FILES
     Source/UiDynamicScrollBoxComponent.h
     Source/UiElementComponent.cpp
     Source/UiElementComponent.h
+    Source/UiElementHierarchy.cpp
+    Source/UiElementHierarchy.h
     Source/UiFaderComponent.cpp
     Source/UiFaderComponent.h
     Source/UiFlipbookAnimationComponent.cpp
@@ -196,6 +198,8 @@ set(FILES
     Source/UiTextComponentOffsetsSelector.h
     Source/UiTextInputComponent.cpp
     Source/UiTextInputComponent.h
+    Source/UiTextRunCache.cpp
+    Source/UiTextRunCache.h
     Source/UiTooltipComponent.cpp
     Source/UiTooltipComponent.h
     Source/UiTooltipDisplayComponent.cpp
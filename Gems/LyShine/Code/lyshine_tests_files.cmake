@@ -9,11 +9,14 @@
 set(FILES
     Tests/LyShineTest.h
     Tests/AnimationTest.cpp
+    Tests/RenderGraphBenchmark.cpp
     Tests/SpriteTest.cpp
     Tests/SerializationTest.cpp
     Tests/TextInputComponentTest.cpp
     Tests/UiDynamicScrollBoxComponentTest.cpp
+    Tests/UiElementHierarchyTest.cpp
     Tests/UiScrollBarComponentTest.cpp
+    Tests/UiTextRunCacheBenchmark.cpp
     Tests/UiTooltipComponentTest.cpp
     Tests/Mocks/UiDynamicScrollBoxDataBusHandlerMock.h
 )
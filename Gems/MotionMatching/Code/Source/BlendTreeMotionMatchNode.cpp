@@ -133,6 +133,9 @@ namespace EMotionFX::MotionMatching
         settings.m_importMirrored = animGraphNode->m_mirror;
         settings.m_maxKdTreeDepth = animGraphNode->m_maxKdTreeDepth;
         settings.m_minFramesPerKdTreeNode = animGraphNode->m_minFramesPerKdTreeNode;
+        settings.m_broadPhaseSearchType = animGraphNode->m_broadPhaseSearchType;
+        settings.m_maxBroadPhaseCandidates = animGraphNode->m_maxBroadPhaseCandidates;
+        settings.m_numPcaComponents = animGraphNode->m_numPcaComponents;
         settings.m_motionList.reserve(animGraphNode->m_motionIds.size());
         settings.m_normalizeData = animGraphNode->m_normalizeData;
         settings.m_featureScalerType = animGraphNode->m_featureScalerType;
@@ -345,6 +348,37 @@ namespace EMotionFX::MotionMatching
         return AZ::Edit::PropertyVisibility::Hide;
     }
 
+    AZ::Crc32 BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility() const
+    {
+        if (m_broadPhaseSearchType == MotionMatchingData::KdTreeSearchType)
+        {
+            return AZ::Edit::PropertyVisibility::Show;
+        }
+
+        return AZ::Edit::PropertyVisibility::Hide;
+    }
+
+    AZ::Crc32 BlendTreeMotionMatchNode::GetBroadPhaseCandidateSettingsVisibility() const
+    {
+        if (m_broadPhaseSearchType == MotionMatchingData::BruteForceSearchType ||
+            m_broadPhaseSearchType == MotionMatchingData::PcaSearchType)
+        {
+            return AZ::Edit::PropertyVisibility::Show;
+        }
+
+        return AZ::Edit::PropertyVisibility::Hide;
+    }
+
+    AZ::Crc32 BlendTreeMotionMatchNode::GetPcaSettingsVisibility() const
+    {
+        if (m_broadPhaseSearchType == MotionMatchingData::PcaSearchType)
+        {
+            return AZ::Edit::PropertyVisibility::Show;
+        }
+
+        return AZ::Edit::PropertyVisibility::Hide;
+    }
+
     AZ::Crc32 BlendTreeMotionMatchNode::OnVisualizeSchemaButtonClicked()
     {
         FeatureSchema* usedSchema = nullptr;
@@ -382,7 +416,7 @@ namespace EMotionFX::MotionMatching
         }
 
         serializeContext->Class<BlendTreeMotionMatchNode, AnimGraphNode>()
-            ->Version(11)
+            ->Version(12)
             ->Field("lowestCostSearchFrequency", &BlendTreeMotionMatchNode::m_lowestCostSearchFrequency)
             ->Field("sampleRate", &BlendTreeMotionMatchNode::m_sampleRate)
             ->Field("controlSplineMode", &BlendTreeMotionMatchNode::m_trajectoryQueryMode)
@@ -394,6 +428,9 @@ namespace EMotionFX::MotionMatching
             ->Field("clipFeatures", &BlendTreeMotionMatchNode::m_clipFeatures)
             ->Field("maxKdTreeDepth", &BlendTreeMotionMatchNode::m_maxKdTreeDepth)
             ->Field("minFramesPerKdTreeNode", &BlendTreeMotionMatchNode::m_minFramesPerKdTreeNode)
+            ->Field("broadPhaseSearchType", &BlendTreeMotionMatchNode::m_broadPhaseSearchType)
+            ->Field("maxBroadPhaseCandidates", &BlendTreeMotionMatchNode::m_maxBroadPhaseCandidates)
+            ->Field("numPcaComponents", &BlendTreeMotionMatchNode::m_numPcaComponents)
             ->Field("mirror", &BlendTreeMotionMatchNode::m_mirror)
             ->Field("featureSchema", &BlendTreeMotionMatchNode::m_featureSchema)
             ->Field("motionIds", &BlendTreeMotionMatchNode::m_motionIds)
@@ -454,14 +491,32 @@ namespace EMotionFX::MotionMatching
                 ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetMinMaxSettingsVisibility)
             ->ClassElement(AZ::Edit::ClassElements::Group, "Acceleration Structure")
                 ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+            ->DataElement(AZ::Edit::UIHandlers::ComboBox, &BlendTreeMotionMatchNode::m_broadPhaseSearchType, "Broad-phase search", "The acceleration structure used to find the candidate frames that are then compared using the full cost function.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                ->EnumAttribute(MotionMatchingData::KdTreeSearchType, "Kd-tree")
+                ->EnumAttribute(MotionMatchingData::BruteForceSearchType, "Brute-force (SIMD)")
+                ->EnumAttribute(MotionMatchingData::PcaSearchType, "PCA-reduced brute-force")
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxKdTreeDepth, "Max kd-tree depth", "The maximum number of hierarchy levels in the kdTree.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 20)
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility)
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_minFramesPerKdTreeNode, "Min kd-tree node size", "The minimum number of frames to store per kdTree node.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 100000)
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxBroadPhaseCandidates, "Candidate frames", "The number of closest frames the broad-phase search returns for the narrow-phase to evaluate.")
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ->Attribute(AZ::Edit::Attributes::Max, 10000)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetBroadPhaseCandidateSettingsVisibility)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_numPcaComponents, "PCA components", "The number of principal components the features are reduced to. Fewer components search faster but less accurately.")
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ->Attribute(AZ::Edit::Attributes::Max, 64)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetPcaSettingsVisibility)
             ->EndGroup()
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_featureSchema, "FeatureSchema", "")
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
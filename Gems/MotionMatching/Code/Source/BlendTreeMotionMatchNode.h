@@ -94,6 +94,9 @@ namespace EMotionFX::MotionMatching
         AZ::Crc32 GetTrajectoryPathSettingsVisibility() const;
         AZ::Crc32 GetFeatureScalerTypeSettingsVisibility() const;
         AZ::Crc32 GetMinMaxSettingsVisibility() const;
+        AZ::Crc32 GetKdTreeSettingsVisibility() const;
+        AZ::Crc32 GetBroadPhaseCandidateSettingsVisibility() const;
+        AZ::Crc32 GetPcaSettingsVisibility() const;
         AZ::Crc32 OnVisualizeSchemaButtonClicked();
         AZStd::string OnVisualizeSchemaButtonText() const;
 
@@ -106,6 +109,9 @@ namespace EMotionFX::MotionMatching
         AZ::u32 m_sampleRate = 30;
         AZ::u32 m_maxKdTreeDepth = 15;
         AZ::u32 m_minFramesPerKdTreeNode = 1000;
+        MotionMatchingData::BroadPhaseSearchType m_broadPhaseSearchType = MotionMatchingData::KdTreeSearchType;
+        AZ::u32 m_maxBroadPhaseCandidates = 256;
+        AZ::u32 m_numPcaComponents = 8;
         TrajectoryQuery::EMode m_trajectoryQueryMode = TrajectoryQuery::MODE_TARGETDRIVEN;
         bool m_mirror = false;
 
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <BroadPhaseSearch.h>
+#include <Feature.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZStd::vector<size_t> BroadPhaseSearch::CalcFeatureColumns(const AZStd::vector<Feature*>& features)
+    {
+        AZStd::vector<size_t> columns;
+        for (const Feature* feature : features)
+        {
+            if (feature->GetId().IsNull())
+            {
+                continue;
+            }
+
+            const size_t numDimensions = feature->GetNumDimensions();
+            const size_t featureColumnOffset = feature->GetColumnOffset();
+            for (size_t i = 0; i < numDimensions; ++i)
+            {
+                columns.push_back(featureColumnOffset + i);
+            }
+        }
+        return columns;
+    }
+
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class Feature;
+
+    //! The broad-phase search narrows the frames of the motion database down to a small set of candidate frames that are close
+    //! to the query, which the motion matching instance then evaluates with the full cost function (narrow-phase).
+    //! Each row of the feature matrix represents a frame, and the search only looks at a subset of the feature matrix columns.
+    //! Searches don't modify the search structure, so any number of motion matching instances can search at the same time.
+    class BroadPhaseSearch
+    {
+    public:
+        AZ_RTTI(BroadPhaseSearch, "{6F0E59A6-2B1F-4C0D-9A0E-3D3C5B0B7E21}");
+
+        virtual ~BroadPhaseSearch() = default;
+
+        struct InitSettings
+        {
+            size_t m_maxKdTreeDepth = 20; //< The maximum number of hierarchy levels of a kd-tree.
+            size_t m_minFramesPerKdTreeNode = 1000; //< The minimum number of frames to store per kd-tree leaf node.
+            size_t m_maxCandidates = 256; //< The number of candidate frames returned by the brute-force and PCA searches.
+            size_t m_numPcaComponents = 8; //< The number of principal components the PCA search reduces the features to.
+        };
+
+        //! Build the search structure.
+        //! @param featureMatrix The feature matrix with a row for every frame in the motion database.
+        //! @param columns The feature matrix columns to search, in the order the query values are passed to FindNearestNeighbors().
+        //! @param settings Settings for the search structure. Each type of search only uses the settings that apply to it.
+        //! @result True in case the search structure was built successfully.
+        virtual bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, const InitSettings& settings) = 0;
+        virtual void Clear() = 0;
+
+        virtual bool IsInitialized() const = 0;
+        virtual size_t GetNumDimensions() const = 0;
+        virtual size_t CalcMemoryUsageInBytes() const = 0;
+
+        //! Find the candidate frames for the given query values.
+        //! @param frameFloats The query values, one for each of the columns the search was initialized with.
+        //! @param resultFrameIndices The indices of the candidate frames. The vector will be cleared internally.
+        virtual void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const = 0;
+
+        //! Get the feature matrix columns of the given features, in the order of the features.
+        //! Each feature might store one or multiple values inside the feature matrix, so this is the concatenation of the column
+        //! ranges of the features.
+        static AZStd::vector<size_t> CalcFeatureColumns(const AZStd::vector<Feature*>& features);
+    };
+} // namespace EMotionFX::MotionMatching
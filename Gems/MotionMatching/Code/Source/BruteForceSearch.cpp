@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/utils.h>
+
+#include <Allocators.h>
+#include <BruteForceSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(BruteForceSearch, MotionMatchAllocator, 0);
+
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        constexpr float s_quantizationRange = 32767.0f;
+    } // namespace
+
+    bool BruteForceSearch::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, const InitSettings& settings)
+    {
+        AZ_PROFILE_SCOPE(Animation, "BruteForceSearch::Init");
+
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        if (columns.empty())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize brute-force search. There are no features to search.");
+            return false;
+        }
+
+        if (settings.m_maxCandidates == 0)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize brute-force search. The number of candidates cannot be zero.");
+            return false;
+        }
+
+        const size_t numFrames = static_cast<size_t>(featureMatrix.rows());
+        if (numFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Skipping to initialize brute-force search. No frames in the feature matrix.");
+            return true;
+        }
+
+        // Gather the searched columns into a tightly packed row-major buffer.
+        const size_t numColumns = columns.size();
+        AZStd::vector<float> values(numFrames * numColumns);
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            for (size_t i = 0; i < numColumns; ++i)
+            {
+                values[frameIndex * numColumns + i] = featureMatrix(frameIndex, columns[i]);
+            }
+        }
+
+        m_numDimensions = numColumns;
+        BuildBlocks(values, numFrames, numColumns, settings.m_maxCandidates);
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "Brute-force search initialized in %.2f ms (numFrames = %zu  numDims = %zu  Memory used = %.2f MB).",
+            initTime * 1000.0f,
+            m_numFrames,
+            m_numDimensions,
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+#endif
+        return true;
+    }
+
+    void BruteForceSearch::BuildBlocks(const AZStd::vector<float>& values, size_t numFrames, size_t numValues, size_t maxCandidates)
+    {
+        AZ_Assert(values.size() == numFrames * numValues, "Expected numValues values for each frame.");
+
+        m_numFrames = numFrames;
+        m_numValues = numValues;
+        m_numValuePairs = (numValues + 1) / 2;
+        m_maxCandidates = maxCandidates;
+
+        // Quantize each value relative to the center of its range, so that the whole range maps to [-32767, 32767].
+        // An odd number of values gets a padding value with zero weight, so every int32 holds a full pair.
+        const size_t numPaddedValues = m_numValuePairs * 2;
+        m_centers.assign(numPaddedValues, 0.0f);
+        m_invScales.assign(numPaddedValues, 0.0f);
+        m_weights.assign(numPaddedValues, 0.0f);
+        for (size_t valueIndex = 0; valueIndex < numValues; ++valueIndex)
+        {
+            float minValue = AZStd::numeric_limits<float>::max();
+            float maxValue = AZStd::numeric_limits<float>::lowest();
+            for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+            {
+                const float value = values[frameIndex * numValues + valueIndex];
+                minValue = AZ::GetMin(minValue, value);
+                maxValue = AZ::GetMax(maxValue, value);
+            }
+
+            float halfRange = (maxValue - minValue) * 0.5f;
+            if (halfRange < AZ::Constants::FloatEpsilon)
+            {
+                halfRange = 1.0f;
+            }
+
+            // The squared distance of two quantized values, multiplied by the weight, is the squared distance of the original values.
+            const float step = halfRange / s_quantizationRange;
+            m_centers[valueIndex] = (minValue + maxValue) * 0.5f;
+            m_invScales[valueIndex] = 1.0f / step;
+            m_weights[valueIndex] = step * step;
+        }
+
+        const size_t numBlocks = (numFrames + s_framesPerBlock - 1) / s_framesPerBlock;
+        m_blocks.assign(numBlocks * m_numValuePairs * s_framesPerBlock, 0);
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            const size_t blockIndex = frameIndex / s_framesPerBlock;
+            const size_t lane = frameIndex % s_framesPerBlock;
+            for (size_t pairIndex = 0; pairIndex < m_numValuePairs; ++pairIndex)
+            {
+                AZ::s32 quantized[2] = { 0, 0 };
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    const size_t valueIndex = pairIndex * 2 + i;
+                    if (valueIndex < numValues)
+                    {
+                        const float normalized = (values[frameIndex * numValues + valueIndex] - m_centers[valueIndex]) * m_invScales[valueIndex];
+                        quantized[i] = static_cast<AZ::s32>(AZStd::round(AZ::GetClamp(normalized, -s_quantizationRange, s_quantizationRange)));
+                    }
+                }
+
+                // (second << 16) | (first + 32768), written as a multiplication to stay well-defined for negative values.
+                m_blocks[(blockIndex * m_numValuePairs + pairIndex) * s_framesPerBlock + lane] = quantized[1] * 65536 + (quantized[0] + 32768);
+            }
+        }
+    }
+
+    void BruteForceSearch::Clear()
+    {
+        m_blocks.clear();
+        m_blocks.shrink_to_fit();
+        m_centers.clear();
+        m_invScales.clear();
+        m_weights.clear();
+        m_numDimensions = 0;
+        m_numValues = 0;
+        m_numValuePairs = 0;
+        m_numFrames = 0;
+        m_maxCandidates = 0;
+    }
+
+    bool BruteForceSearch::IsInitialized() const
+    {
+        return (m_numFrames != 0);
+    }
+
+    size_t BruteForceSearch::GetNumDimensions() const
+    {
+        return m_numDimensions;
+    }
+
+    size_t BruteForceSearch::CalcBlockMemoryUsageInBytes() const
+    {
+        size_t totalBytes = 0;
+        totalBytes += m_blocks.capacity() * sizeof(AZ::s32);
+        totalBytes += m_centers.capacity() * sizeof(float);
+        totalBytes += m_invScales.capacity() * sizeof(float);
+        totalBytes += m_weights.capacity() * sizeof(float);
+        return totalBytes;
+    }
+
+    size_t BruteForceSearch::CalcMemoryUsageInBytes() const
+    {
+        return sizeof(BruteForceSearch) + CalcBlockMemoryUsageInBytes();
+    }
+
+    void BruteForceSearch::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        AZ_Assert(IsInitialized(), "Expecting an initialized brute-force search. Did you forget to call BruteForceSearch::Init()?");
+        AZ_Assert(frameFloats.size() == m_numDimensions, "Expected a query value for each of the searched dimensions.");
+        SearchBlocks(frameFloats.data(), resultFrameIndices);
+    }
+
+    void BruteForceSearch::SearchBlocks(const float* queryValues, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        resultFrameIndices.clear();
+        if (m_numFrames == 0)
+        {
+            return;
+        }
+
+        // Bring the query into the quantized space. The query itself is not rounded, to not lose any precision on that side.
+        const size_t numPaddedValues = m_numValuePairs * 2;
+        AZStd::vector<float> quantizedQuery(numPaddedValues, 0.0f);
+        for (size_t valueIndex = 0; valueIndex < m_numValues; ++valueIndex)
+        {
+            quantizedQuery[valueIndex] = (queryValues[valueIndex] - m_centers[valueIndex]) * m_invScales[valueIndex];
+        }
+
+        // Max-heap on the distance, so the worst of the current candidates is at the front and can be replaced quickly.
+        using Candidate = AZStd::pair<float, size_t>;
+        AZStd::vector<Candidate> candidates;
+        candidates.reserve(m_maxCandidates + 1);
+
+        const Vec4::Int32Type lowMask = Vec4::Splat(static_cast<int32_t>(0xFFFF));
+        const Vec4::FloatType lowOffset = Vec4::Splat(32768.0f);
+        const Vec4::FloatType highScale = Vec4::Splat(1.0f / 65536.0f);
+
+        const size_t blockStride = m_numValuePairs * s_framesPerBlock;
+        const size_t numBlocks = m_blocks.size() / blockStride;
+        alignas(16) float distances[s_framesPerBlock];
+        for (size_t blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+        {
+            const int32_t* block = m_blocks.data() + blockIndex * blockStride;
+
+            Vec4::FloatType distanceSq = Vec4::ZeroFloat();
+            for (size_t pairIndex = 0; pairIndex < m_numValuePairs; ++pairIndex)
+            {
+                const Vec4::Int32Type packed = Vec4::LoadUnaligned(block + pairIndex * s_framesPerBlock);
+
+                // Unpack the two quantized values of the four frames. Subtracting the lower half leaves the second value times 65536,
+                // which converts to float exactly.
+                const Vec4::Int32Type lowBits = Vec4::And(packed, lowMask);
+                const Vec4::FloatType first = Vec4::Sub(Vec4::ConvertToFloat(lowBits), lowOffset);
+                const Vec4::FloatType second = Vec4::Mul(Vec4::ConvertToFloat(Vec4::Sub(packed, lowBits)), highScale);
+
+                const size_t valueIndex = pairIndex * 2;
+                const Vec4::FloatType firstDelta = Vec4::Sub(first, Vec4::Splat(quantizedQuery[valueIndex]));
+                const Vec4::FloatType secondDelta = Vec4::Sub(second, Vec4::Splat(quantizedQuery[valueIndex + 1]));
+                distanceSq = Vec4::Madd(Vec4::Mul(firstDelta, Vec4::Splat(m_weights[valueIndex])), firstDelta, distanceSq);
+                distanceSq = Vec4::Madd(Vec4::Mul(secondDelta, Vec4::Splat(m_weights[valueIndex + 1])), secondDelta, distanceSq);
+            }
+            Vec4::StoreAligned(distances, distanceSq);
+
+            const size_t firstFrame = blockIndex * s_framesPerBlock;
+            const size_t numLanes = AZ::GetMin(s_framesPerBlock, m_numFrames - firstFrame);
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                if (candidates.size() < m_maxCandidates)
+                {
+                    candidates.emplace_back(distances[lane], firstFrame + lane);
+                    AZStd::push_heap(candidates.begin(), candidates.end());
+                }
+                else if (distances[lane] < candidates.front().first)
+                {
+                    AZStd::pop_heap(candidates.begin(), candidates.end());
+                    candidates.back() = Candidate(distances[lane], firstFrame + lane);
+                    AZStd::push_heap(candidates.begin(), candidates.end());
+                }
+            }
+        }
+
+        // Return the candidates from closest to farthest.
+        AZStd::sort_heap(candidates.begin(), candidates.end());
+        resultFrameIndices.reserve(candidates.size());
+        for (const Candidate& candidate : candidates)
+        {
+            resultFrameIndices.push_back(candidate.second);
+        }
+    }
+} // namespace EMotionFX::MotionMatching
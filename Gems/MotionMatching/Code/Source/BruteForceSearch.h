@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <BroadPhaseSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Broad-phase search that compares the query against every frame of the motion database and returns the closest frames.
+    //! Instead of walking a tree, the frames are stored quantized to 16 bits per value, in blocks of four frames that are laid
+    //! out structure-of-arrays, so that the distances of four frames are calculated at once with SIMD instructions while streaming
+    //! through memory linearly. This keeps the search cost predictable, and the candidates returned are the actual closest frames
+    //! rather than the contents of a single leaf node.
+    class BruteForceSearch
+        : public BroadPhaseSearch
+    {
+    public:
+        AZ_RTTI(BruteForceSearch, "{2D6A7A3C-6F5B-4E86-9B7B-0E3E7E1F4C52}", BroadPhaseSearch);
+        AZ_CLASS_ALLOCATOR_DECL;
+
+        BruteForceSearch() = default;
+        ~BruteForceSearch() override = default;
+
+        // BroadPhaseSearch overrides
+        bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, const InitSettings& settings) override;
+        void Clear() override;
+        bool IsInitialized() const override;
+        size_t GetNumDimensions() const override;
+        size_t CalcMemoryUsageInBytes() const override;
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const override;
+
+        size_t GetNumFrames() const { return m_numFrames; }
+        size_t GetMaxCandidates() const { return m_maxCandidates; }
+
+    protected:
+        //! Quantize the given values and store them in the SIMD blocks that are searched by SearchBlocks().
+        //! @param values Row-major values with numValues values for each of the numFrames frames.
+        void BuildBlocks(const AZStd::vector<float>& values, size_t numFrames, size_t numValues, size_t maxCandidates);
+
+        //! Find the closest frames to the query values, which need to be in the same space as the values passed to BuildBlocks().
+        void SearchBlocks(const float* queryValues, AZStd::vector<size_t>& resultFrameIndices) const;
+
+        size_t CalcBlockMemoryUsageInBytes() const;
+
+        size_t m_numDimensions = 0; //< The number of query values.
+
+    private:
+        static constexpr size_t s_framesPerBlock = 4;
+
+        //! Each int32 stores two quantized values: the lower 16 bits hold the first value offset by 32768, and the upper 16 bits
+        //! the signed second value. The blocks are laid out as [block][value pair][frame within block].
+        AZStd::vector<AZ::s32> m_blocks;
+        AZStd::vector<float> m_centers; //< The center of the value range for each stored value.
+        AZStd::vector<float> m_invScales; //< Converts a value relative to its center into the quantized range.
+        AZStd::vector<float> m_weights; //< Squared quantization step for each stored value, zero for the padding value.
+        size_t m_numValues = 0; //< The number of stored values per frame.
+        size_t m_numValuePairs = 0;
+        size_t m_numFrames = 0;
+        size_t m_maxCandidates = 0;
+    };
+} // namespace EMotionFX::MotionMatching
@@ -43,6 +43,24 @@ namespace EMotionFX::MotionMatching
         const AZStd::vector<Feature*>& features,
         size_t maxDepth,
         size_t minFramesPerLeaf)
+    {
+        if (frameDatabase.GetNumFrames() == 0)
+        {
+            Clear();
+            AZ_Error("Motion Matching", false, "Skipping to initialize KD-tree. No frames in the motion database.");
+            return true;
+        }
+
+        InitSettings settings;
+        settings.m_maxKdTreeDepth = maxDepth;
+        settings.m_minFramesPerKdTreeNode = minFramesPerLeaf;
+
+        // Not all features are present in the KD-tree, thus we need to remap KD-tree local feature columns to the
+        // feature schema global feature columns.
+        return Init(featureMatrix, CalcFeatureColumns(features), settings);
+    }
+
+    bool KdTree::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, const InitSettings& settings)
     {
         AZ_PROFILE_SCOPE(Animation, "MotionMatchingData::InitKdTree");
 
@@ -54,43 +72,45 @@ namespace EMotionFX::MotionMatching
         Clear();
 
         // Verify the dimensions.
-        m_numDimensions = CalcNumDimensions(features);
+        m_numDimensions = columns.size();
 
         // Going above a 48 dimensional tree would start eating up too much memory.
         const size_t maxNumDimensions = 48;
         if (m_numDimensions == 0 || m_numDimensions > maxNumDimensions)
         {
             AZ_Error("Motion Matching", false, "Cannot initialize KD-tree. KD-tree dimension (%d) has to be between 1 and %zu. Please use Feature::SetIncludeInKdTree(false) on some features.", m_numDimensions, maxNumDimensions);
+            m_numDimensions = 0;
             return false;
         }
 
+        const size_t minFramesPerLeaf = settings.m_minFramesPerKdTreeNode;
         if (minFramesPerLeaf > 100000)
         {
             AZ_Error("Motion Matching", false, "KdTree minFramesPerLeaf (%d) cannot be bigger than 100000.", minFramesPerLeaf);
+            m_numDimensions = 0;
             return false;
         }
 
+        const size_t maxDepth = settings.m_maxKdTreeDepth;
         if (maxDepth == 0)
         {
             AZ_Error("Motion Matching", false, "KdTree max depth (%d) cannot be zero", maxDepth);
+            m_numDimensions = 0;
             return false;
         }
 
-        if (frameDatabase.GetNumFrames() == 0)
+        if (featureMatrix.rows() == 0)
         {
-            AZ_Error("Motion Matching", false, "Skipping to initialize KD-tree. No frames in the motion database.");
+            AZ_Error("Motion Matching", false, "Skipping to initialize KD-tree. No frames in the feature matrix.");
+            m_numDimensions = 0;
             return true;
         }
 
         m_maxDepth = maxDepth;
         m_minFramesPerLeaf = minFramesPerLeaf;
 
-        // Not all features are present in the KD-tree, thus we need to remap KD-tree local feature columns to the
-        // feature schema global feature columns.
-        const AZStd::vector<size_t> localToSchemaFeatureColumns = CalcLocalToSchemaFeatureColumns(features);
-
         // Build the tree.
-        BuildTreeNodes(frameDatabase, featureMatrix, localToSchemaFeatureColumns, aznew Node(), nullptr, 0);
+        BuildTreeNodes(featureMatrix, columns, aznew Node(), nullptr, 0);
         MergeSmallLeafNodesToParents();
         ClearFramesForNonEssentialNodes();
         RemoveZeroFrameLeafNodes();
@@ -108,27 +128,6 @@ namespace EMotionFX::MotionMatching
         return true;
     }
 
-    AZStd::vector<size_t> KdTree::CalcLocalToSchemaFeatureColumns(const AZStd::vector<Feature*>& features) const
-    {
-        AZStd::vector<size_t> localToSchemaFeatureColumns;
-        localToSchemaFeatureColumns.resize(m_numDimensions);
-
-        size_t currentColumn = 0;
-        for (const Feature* feature : features)
-        {
-            const size_t numDimensions = feature->GetNumDimensions();
-            const size_t featureColumnOffset = feature->GetColumnOffset();
-            for (size_t i = 0; i < numDimensions; ++i)
-            {
-                localToSchemaFeatureColumns[currentColumn] = featureColumnOffset + i;
-                currentColumn++;
-            }
-        }
-
-        AZ_Assert(m_numDimensions == currentColumn, "There should be a column index mapping for each of the available dimensions.");
-        return localToSchemaFeatureColumns;
-    }
-
     void KdTree::Clear()
     {
         // delete all nodes
@@ -170,8 +169,7 @@ namespace EMotionFX::MotionMatching
         return m_numDimensions;
     }
 
-    void KdTree::BuildTreeNodes(const FrameDatabase& frameDatabase,
-        const FeatureMatrix& featureMatrix,
+    void KdTree::BuildTreeNodes(const FeatureMatrix& featureMatrix,
         const AZStd::vector<size_t>& localToSchemaFeatureColumns,
         Node* node,
         Node* parent,
@@ -184,7 +182,7 @@ namespace EMotionFX::MotionMatching
 
         // Fill the frames array and calculate the median.
         AZStd::vector<float> frameFeatureValues;
-        FillFramesForNode(node, frameDatabase, featureMatrix, localToSchemaFeatureColumns, frameFeatureValues, parent, leftSide);
+        FillFramesForNode(node, featureMatrix, localToSchemaFeatureColumns, frameFeatureValues, parent, leftSide);
 
         // Prevent splitting further when we don't want to.
         const size_t maxDimensions = AZ::GetMin(m_numDimensions, m_maxDepth);
@@ -198,13 +196,13 @@ namespace EMotionFX::MotionMatching
         Node* leftNode = aznew Node();
         AZ_Assert(!node->m_leftNode, "Expected the parent left node to be a nullptr");
         node->m_leftNode = leftNode;
-        BuildTreeNodes(frameDatabase, featureMatrix, localToSchemaFeatureColumns, leftNode, node, dimension + 1, true);
+        BuildTreeNodes(featureMatrix, localToSchemaFeatureColumns, leftNode, node, dimension + 1, true);
 
         // Create the right node.
         Node* rightNode = aznew Node();
         AZ_Assert(!node->m_rightNode, "Expected the parent right node to be a nullptr");
         node->m_rightNode = rightNode;
-        BuildTreeNodes(frameDatabase, featureMatrix, localToSchemaFeatureColumns, rightNode, node, dimension + 1, false);
+        BuildTreeNodes(featureMatrix, localToSchemaFeatureColumns, rightNode, node, dimension + 1, false);
     }
 
     void KdTree::ClearFramesForNonEssentialNodes()
@@ -290,7 +288,6 @@ namespace EMotionFX::MotionMatching
     }
 
     void KdTree::FillFramesForNode(Node* node,
-        const FrameDatabase& frameDatabase,
         const FeatureMatrix& featureMatrix,
         const AZStd::vector<size_t>& localToSchemaFeatureColumns,
         AZStd::vector<float>& frameFeatureValues,
@@ -331,10 +328,12 @@ namespace EMotionFX::MotionMatching
         }
         else // We're the root node.
         {
-            node->m_frames.reserve(frameDatabase.GetNumFrames());
-            for (const Frame& frame : frameDatabase.GetFrames())
+            // Each row of the feature matrix represents the frame with the same index in the frame database.
+            const size_t numFrames = static_cast<size_t>(featureMatrix.rows());
+            node->m_frames.reserve(numFrames);
+            frameFeatureValues.reserve(numFrames);
+            for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
             {
-                const size_t frameIndex = frame.GetFrameIndex();
                 node->m_frames.emplace_back(frameIndex);
 
                 // Remap local to the KD-tree feature column to the feature schema global column and read the value directly from the feature matrix.
@@ -13,6 +13,7 @@
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 
+#include <BroadPhaseSearch.h>
 #include <Feature.h>
 #include <FeatureMatrix.h>
 #include <FrameDatabase.h>
@@ -20,9 +21,10 @@
 namespace EMotionFX::MotionMatching
 {
     class KdTree
+        : public BroadPhaseSearch
     {
     public:
-        AZ_RTTI(KdTree, "{CDA707EC-4150-463B-8157-90D98351ACED}");
+        AZ_RTTI(KdTree, "{CDA707EC-4150-463B-8157-90D98351ACED}", BroadPhaseSearch);
         AZ_CLASS_ALLOCATOR_DECL;
 
         KdTree() = default;
@@ -34,21 +36,24 @@ namespace EMotionFX::MotionMatching
             size_t maxDepth=10,
             size_t minFramesPerLeaf=1000);
 
+        // BroadPhaseSearch overrides
+        bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, const InitSettings& settings) override;
+
         //! Calculate the number of dimensions or values for the given feature set.
         //! Each feature might store one or multiple values inside the feature matrix and the number of
         //! values each feature holds varies with the feature type. This calculates the sum of the number of
         //! values of the given feature set.
         static size_t CalcNumDimensions(const AZStd::vector<Feature*>& features);
 
-        void Clear();
+        void Clear() override;
         void PrintStats();
 
         size_t GetNumNodes() const;
-        size_t GetNumDimensions() const;
-        size_t CalcMemoryUsageInBytes() const;
-        bool IsInitialized() const;
+        size_t GetNumDimensions() const override;
+        size_t CalcMemoryUsageInBytes() const override;
+        bool IsInitialized() const override;
 
-        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const override;
 
     private:
         struct Node
@@ -65,15 +70,13 @@ namespace EMotionFX::MotionMatching
             AZStd::vector<size_t> m_frames;
         };
 
-        void BuildTreeNodes(const FrameDatabase& frameDatabase,
-            const FeatureMatrix& featureMatrix,
+        void BuildTreeNodes(const FeatureMatrix& featureMatrix,
             const AZStd::vector<size_t>& localToSchemaFeatureColumns,
             Node* node,
             Node* parent,
             size_t dimension = 0,
             bool leftSide = true);
         void FillFramesForNode(Node* node,
-            const FrameDatabase& frameDatabase,
             const FeatureMatrix& featureMatrix,
             const AZStd::vector<size_t>& localToSchemaFeatureColumns,
             AZStd::vector<float>& frameFeatureValues,
@@ -85,7 +88,6 @@ namespace EMotionFX::MotionMatching
         void RemoveZeroFrameLeafNodes();
         void RemoveLeafNode(Node* node);
         void FindNearestNeighbors(Node* node, const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
-        AZStd::vector<size_t> CalcLocalToSchemaFeatureColumns(const AZStd::vector<Feature*>& features) const;
 
     private:
         AZStd::vector<Node*> m_nodes;
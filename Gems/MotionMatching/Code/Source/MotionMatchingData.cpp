@@ -20,6 +20,7 @@
 #include <EMotionFX/Source/Motion.h>
 
 #include <Allocators.h>
+#include <BruteForceSearch.h>
 #include <Feature.h>
 #include <FeatureMatrixMinMaxScaler.h>
 #include <FeatureMatrixStandardScaler.h>
@@ -28,6 +29,7 @@
 #include <FrameDatabase.h>
 #include <KdTree.h>
 #include <MotionMatchingData.h>
+#include <PcaSearch.h>
 
 namespace EMotionFX::MotionMatching
 {
@@ -38,7 +40,6 @@ namespace EMotionFX::MotionMatching
     MotionMatchingData::MotionMatchingData(const FeatureSchema& featureSchema)
         : m_featureSchema(featureSchema)
     {
-        m_kdTree = AZStd::make_unique<KdTree>();
     }
 
     MotionMatchingData::~MotionMatchingData()
@@ -260,9 +261,9 @@ namespace EMotionFX::MotionMatching
         }
 
         ///////////////////////////////////////////////////////////////////////
-        // 4. Initialize the kd-tree used to accelerate the searches
+        // 4. Initialize the broad-phase search structure used to accelerate the searches
         {
-            // Use all features other than the trajectory for the broad-phase search using the KD-Tree.
+            // Use all features other than the trajectory for the broad-phase search.
             for (Feature* feature : m_featureSchema.GetFeatures())
             {
                 if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
@@ -271,9 +272,37 @@ namespace EMotionFX::MotionMatching
                 }
             }
 
-            if (!m_kdTree->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
+            switch (settings.m_broadPhaseSearchType)
             {
-                AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
+            case BroadPhaseSearchType::BruteForceSearchType:
+                {
+                    m_broadPhaseSearch.reset(aznew BruteForceSearch());
+                    break;
+                }
+            case BroadPhaseSearchType::PcaSearchType:
+                {
+                    m_broadPhaseSearch.reset(aznew PcaSearch());
+                    break;
+                }
+            default:
+                {
+                    AZ_Error("Motion Matching", settings.m_broadPhaseSearchType == BroadPhaseSearchType::KdTreeSearchType,
+                        "Unknown broad-phase search type. Falling back to the kd-tree.");
+                    m_broadPhaseSearch.reset(aznew KdTree());
+                    break;
+                }
+            }
+
+            BroadPhaseSearch::InitSettings searchSettings;
+            searchSettings.m_maxKdTreeDepth = settings.m_maxKdTreeDepth;
+            searchSettings.m_minFramesPerKdTreeNode = settings.m_minFramesPerKdTreeNode;
+            searchSettings.m_maxCandidates = settings.m_maxBroadPhaseCandidates;
+            searchSettings.m_numPcaComponents = settings.m_numPcaComponents;
+
+            // Internally automatically clears any existing contents.
+            if (!m_broadPhaseSearch->Init(m_featureMatrix, BroadPhaseSearch::CalcFeatureColumns(m_featuresInKdTree), searchSettings))
+            {
+                AZ_Error("EMotionFX", false, "Failed to initialize the broad-phase search acceleration structure.");
                 return false;
             }
         }
@@ -292,7 +321,7 @@ namespace EMotionFX::MotionMatching
     {
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
-        m_kdTree->Clear();
+        m_broadPhaseSearch.reset();
         m_featuresInKdTree.clear();
     }
 } // namespace EMotionFX::MotionMatching
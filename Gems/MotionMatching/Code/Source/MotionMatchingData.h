@@ -14,11 +14,11 @@
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 
+#include <BroadPhaseSearch.h>
 #include <Feature.h>
 #include <FeatureSchema.h>
 #include <FrameDatabase.h>
 #include <FeatureMatrixTransformer.h>
-#include <KdTree.h>
 
 namespace AZ
 {
@@ -47,6 +47,13 @@ namespace EMotionFX::MotionMatching
             MinMaxScalerType = 1
         };
 
+        enum BroadPhaseSearchType
+        {
+            KdTreeSearchType = 0,
+            BruteForceSearchType = 1,
+            PcaSearchType = 2
+        };
+
         struct EMFX_API InitSettings
         {
             ActorInstance* m_actorInstance = nullptr;
@@ -54,6 +61,9 @@ namespace EMotionFX::MotionMatching
             FrameDatabase::FrameImportSettings m_frameImportSettings;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            BroadPhaseSearchType m_broadPhaseSearchType = KdTreeSearchType;
+            size_t m_maxBroadPhaseCandidates = 256;
+            size_t m_numPcaComponents = 8;
             bool m_importMirrored = false;
 
             bool m_normalizeData = false;
@@ -69,7 +79,7 @@ namespace EMotionFX::MotionMatching
         const FeatureSchema& GetFeatureSchema() const { return m_featureSchema; }
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         FeatureMatrixTransformer* GetFeatureTransformer() { return m_featureTransformer.get(); }
-        const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        const BroadPhaseSearch* GetBroadPhaseSearch() const { return m_broadPhaseSearch.get(); }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
 
     protected:
@@ -87,7 +97,7 @@ namespace EMotionFX::MotionMatching
         FeatureMatrix m_featureMatrix;
         AZStd::unique_ptr<FeatureMatrixTransformer> m_featureTransformer;
 
-        AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
+        AZStd::unique_ptr<BroadPhaseSearch> m_broadPhaseSearch; //< The acceleration structure to speed up the search for lowest cost frames.
         AZStd::vector<Feature*> m_featuresInKdTree;
     };
 } // namespace EMotionFX::MotionMatching
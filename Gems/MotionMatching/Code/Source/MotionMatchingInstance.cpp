@@ -107,8 +107,9 @@ namespace EMotionFX::MotionMatching
         m_queryPose.LinkToActorInstance(m_actorInstance);
         m_queryPose.InitFromBindPose(m_actorInstance);
 
-        // Make sure we have enough space inside the frame floats array, which is used to search the kdTree.
-        const size_t numValuesInKdTree = m_data->GetKdTree().GetNumDimensions();
+        // Make sure we have enough space inside the frame floats array, which is used for the broad-phase search.
+        const BroadPhaseSearch* broadPhaseSearch = m_data->GetBroadPhaseSearch();
+        const size_t numValuesInKdTree = broadPhaseSearch ? broadPhaseSearch->GetNumDimensions() : 0;
         m_kdTreeQueryVector.Resize(numValuesInKdTree);
         m_queryVector.Resize(m_data->GetFeatureMatrix().cols());
 
@@ -467,9 +468,12 @@ namespace EMotionFX::MotionMatching
             ImGuiMonitorRequests::FrameDatabaseInfo frameDatabaseInfo{frameDatabase.CalcMemoryUsageInBytes(), frameDatabase.GetNumFrames(), frameDatabase.GetNumUsedMotions(), frameDatabase.GetNumFrames() / (float)frameDatabase.GetSampleRate()};
             ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::SetFrameDatabaseInfo, frameDatabaseInfo);
 
-            const KdTree& kdTree = m_data->GetKdTree();
-            ImGuiMonitorRequests::KdTreeInfo kdTreeInfo{kdTree.CalcMemoryUsageInBytes(), kdTree.GetNumNodes(), kdTree.GetNumDimensions()};
-            ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::SetKdTreeInfo, kdTreeInfo);
+            if (const BroadPhaseSearch* broadPhaseSearch = m_data->GetBroadPhaseSearch())
+            {
+                const KdTree* kdTree = azrtti_cast<const KdTree*>(broadPhaseSearch);
+                ImGuiMonitorRequests::KdTreeInfo kdTreeInfo{broadPhaseSearch->CalcMemoryUsageInBytes(), kdTree ? kdTree->GetNumNodes() : 0, broadPhaseSearch->GetNumDimensions()};
+                ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::SetKdTreeInfo, kdTreeInfo);
+            }
             
             const FeatureMatrix& featureMatrix = m_data->GetFeatureMatrix();
             ImGuiMonitorRequests::FeatureMatrixInfo featureMatrixInfo{featureMatrix.CalcMemoryUsageInBytes(), static_cast<size_t>(featureMatrix.rows()), static_cast<size_t>(featureMatrix.cols())};
@@ -507,15 +511,17 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        // 2. Broad-phase search using KD-tree
-        if (mm_useKdTree)
+        // 2. Broad-phase search using the acceleration structure (kd-tree, brute-force or PCA search)
+        const BroadPhaseSearch* broadPhaseSearch = m_data->GetBroadPhaseSearch();
+        const bool useBroadPhase = mm_useKdTree && broadPhaseSearch && broadPhaseSearch->IsInitialized();
+        if (useBroadPhase)
         {
-            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseKDTree");
+            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhase");
 
             AZStd::vector<float>& kdTreeQueryVector = m_kdTreeQueryVector.GetData();
             const AZStd::vector<float>& queryVectorData = m_queryVector.GetData();
 
-            // For the kd-tree
+            // Gather the values of the features used by the broad-phase search.
             size_t startOffset = 0;
             for (Feature* feature : m_data->GetFeaturesInKdTree())
             {
@@ -525,7 +531,7 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == kdTreeQueryVector.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            broadPhaseSearch->FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
@@ -537,10 +543,10 @@ namespace EMotionFX::MotionMatching
         float minTrajectoryFutureCost = 0.0f;
 
         // Iterate through the frames filtered by the broad-phase search.
-        const size_t numFrames = mm_useKdTree ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
+        const size_t numFrames = useBroadPhase ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
         for (size_t i = 0; i < numFrames; ++i)
         {
-            const size_t frameIndex = mm_useKdTree ? m_nearestFrames[i] : i;
+            const size_t frameIndex = useBroadPhase ? m_nearestFrames[i] : i;
             const Frame& frame = frameDatabase.GetFrame(frameIndex);
 
             // TODO: This shouldn't be there, we should be discarding the frames when extracting the features and not at runtime when checking the cost.
@@ -42,7 +42,7 @@ namespace EMotionFX::MotionMatching
         "Draw the query joint velocities used as input for the motion matching search.");
 
     AZ_CVAR(bool, mm_useKdTree, true, nullptr, AZ::ConsoleFunctorFlags::Null,
-        "Use Kd-Tree to accelerate the motion matching search for the best next matching frame. "
+        "Use the broad-phase acceleration structure (kd-tree, brute-force or PCA search, as set on the motion matching node) to accelerate the motion matching search for the best next matching frame. "
         "Disabling it will heavily slow down performance and should only be done for debugging purposes");
 
     AZ_CVAR(bool, mm_multiThreadedInitialization, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+
+#include <Allocators.h>
+#include <PcaSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(PcaSearch, MotionMatchAllocator, 0);
+
+    bool PcaSearch::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, const InitSettings& settings)
+    {
+        AZ_PROFILE_SCOPE(Animation, "PcaSearch::Init");
+
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        if (columns.empty())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize PCA search. There are no features to search.");
+            return false;
+        }
+
+        if (settings.m_numPcaComponents == 0 || settings.m_numPcaComponents > s_maxNumComponents)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize PCA search. The number of components (%zu) has to be between 1 and %zu.",
+                settings.m_numPcaComponents, s_maxNumComponents);
+            return false;
+        }
+
+        if (settings.m_maxCandidates == 0)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize PCA search. The number of candidates cannot be zero.");
+            return false;
+        }
+
+        const size_t numFrames = static_cast<size_t>(featureMatrix.rows());
+        if (numFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Skipping to initialize PCA search. No frames in the feature matrix.");
+            return true;
+        }
+
+        const size_t numDimensions = columns.size();
+
+        // Calculate the mean and the covariance matrix in double precision, as the sums run over the whole motion database.
+        AZStd::vector<double> mean(numDimensions, 0.0);
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            for (size_t i = 0; i < numDimensions; ++i)
+            {
+                mean[i] += featureMatrix(frameIndex, columns[i]);
+            }
+        }
+        for (double& value : mean)
+        {
+            value /= static_cast<double>(numFrames);
+        }
+
+        AZStd::vector<double> covariance(numDimensions * numDimensions, 0.0);
+        AZStd::vector<double> centered(numDimensions);
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            for (size_t i = 0; i < numDimensions; ++i)
+            {
+                centered[i] = featureMatrix(frameIndex, columns[i]) - mean[i];
+            }
+
+            for (size_t row = 0; row < numDimensions; ++row)
+            {
+                for (size_t column = row; column < numDimensions; ++column)
+                {
+                    covariance[row * numDimensions + column] += centered[row] * centered[column];
+                }
+            }
+        }
+        for (size_t row = 0; row < numDimensions; ++row)
+        {
+            for (size_t column = row; column < numDimensions; ++column)
+            {
+                const double value = covariance[row * numDimensions + column] / static_cast<double>(numFrames);
+                covariance[row * numDimensions + column] = value;
+                covariance[column * numDimensions + row] = value;
+            }
+        }
+
+        AZStd::vector<double> eigenValues;
+        AZStd::vector<double> eigenVectors;
+        CalcEigenDecomposition(covariance, numDimensions, eigenValues, eigenVectors);
+
+        // Keep the components with the largest variance.
+        AZStd::vector<size_t> order(numDimensions);
+        for (size_t i = 0; i < numDimensions; ++i)
+        {
+            order[i] = i;
+        }
+        AZStd::sort(order.begin(), order.end(),
+            [&eigenValues](size_t a, size_t b)
+            {
+                return eigenValues[a] > eigenValues[b];
+            });
+
+        m_numDimensions = numDimensions;
+        m_numComponents = AZ::GetMin(settings.m_numPcaComponents, numDimensions);
+        m_mean.resize(numDimensions);
+        for (size_t i = 0; i < numDimensions; ++i)
+        {
+            m_mean[i] = static_cast<float>(mean[i]);
+        }
+
+        double totalVariance = 0.0;
+        double keptVariance = 0.0;
+        m_components.resize(m_numComponents * numDimensions);
+        for (size_t i = 0; i < numDimensions; ++i)
+        {
+            const double variance = AZ::GetMax(eigenValues[order[i]], 0.0);
+            totalVariance += variance;
+            if (i < m_numComponents)
+            {
+                keptVariance += variance;
+                for (size_t d = 0; d < numDimensions; ++d)
+                {
+                    m_components[i * numDimensions + d] = static_cast<float>(eigenVectors[d * numDimensions + order[i]]);
+                }
+            }
+        }
+        m_explainedVariance = (totalVariance > 0.0) ? static_cast<float>(keptVariance / totalVariance) : 1.0f;
+
+        // Project all frames and store them for the brute-force search.
+        AZStd::vector<float> frameValues(numDimensions);
+        AZStd::vector<float> projectedValues(numFrames * m_numComponents);
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            for (size_t i = 0; i < numDimensions; ++i)
+            {
+                frameValues[i] = featureMatrix(frameIndex, columns[i]);
+            }
+            Project(frameValues.data(), projectedValues.data() + frameIndex * m_numComponents);
+        }
+        BuildBlocks(projectedValues, numFrames, m_numComponents, settings.m_maxCandidates);
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "PCA search initialized in %.2f ms (numFrames = %zu  numDims = %zu  numComponents = %zu  explainedVariance = %.1f%%  Memory used = %.2f MB).",
+            initTime * 1000.0f,
+            numFrames,
+            m_numDimensions,
+            m_numComponents,
+            m_explainedVariance * 100.0f,
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+#endif
+        return true;
+    }
+
+    void PcaSearch::CalcEigenDecomposition(AZStd::vector<double>& matrix, size_t size,
+        AZStd::vector<double>& outEigenValues, AZStd::vector<double>& outEigenVectors)
+    {
+        outEigenVectors.assign(size * size, 0.0);
+        for (size_t i = 0; i < size; ++i)
+        {
+            outEigenVectors[i * size + i] = 1.0;
+        }
+
+        auto at = [&matrix, size](size_t row, size_t column) -> double&
+        {
+            return matrix[row * size + column];
+        };
+
+        // Cyclic Jacobi: rotate away the off-diagonal elements one by one until the matrix is diagonal.
+        const size_t maxSweeps = 50;
+        for (size_t sweep = 0; sweep < maxSweeps; ++sweep)
+        {
+            double offDiagonal = 0.0;
+            double diagonal = 0.0;
+            for (size_t p = 0; p < size; ++p)
+            {
+                diagonal += at(p, p) * at(p, p);
+                for (size_t q = p + 1; q < size; ++q)
+                {
+                    offDiagonal += at(p, q) * at(p, q);
+                }
+            }
+
+            if (offDiagonal <= diagonal * 1e-24 || offDiagonal == 0.0)
+            {
+                break;
+            }
+
+            for (size_t p = 0; p < size; ++p)
+            {
+                for (size_t q = p + 1; q < size; ++q)
+                {
+                    const double apq = at(p, q);
+                    if (AZStd::abs(apq) < AZStd::numeric_limits<double>::min())
+                    {
+                        continue;
+                    }
+
+                    // Choose the rotation angle that zeroes the element at (p, q).
+                    const double theta = (at(q, q) - at(p, p)) / (2.0 * apq);
+                    const double t = (theta >= 0.0 ? 1.0 : -1.0) / (AZStd::abs(theta) + AZStd::sqrt(theta * theta + 1.0));
+                    const double c = 1.0 / AZStd::sqrt(t * t + 1.0);
+                    const double s = t * c;
+
+                    for (size_t k = 0; k < size; ++k)
+                    {
+                        const double akp = at(k, p);
+                        const double akq = at(k, q);
+                        at(k, p) = c * akp - s * akq;
+                        at(k, q) = s * akp + c * akq;
+                    }
+
+                    for (size_t k = 0; k < size; ++k)
+                    {
+                        const double apk = at(p, k);
+                        const double aqk = at(q, k);
+                        at(p, k) = c * apk - s * aqk;
+                        at(q, k) = s * apk + c * aqk;
+                    }
+
+                    for (size_t k = 0; k < size; ++k)
+                    {
+                        const double vkp = outEigenVectors[k * size + p];
+                        const double vkq = outEigenVectors[k * size + q];
+                        outEigenVectors[k * size + p] = c * vkp - s * vkq;
+                        outEigenVectors[k * size + q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        outEigenValues.resize(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            outEigenValues[i] = at(i, i);
+        }
+    }
+
+    void PcaSearch::Project(const float* values, float* outComponents) const
+    {
+        const size_t numDimensions = m_numDimensions;
+        for (size_t component = 0; component < m_numComponents; ++component)
+        {
+            const float* axis = m_components.data() + component * numDimensions;
+            float result = 0.0f;
+            for (size_t d = 0; d < numDimensions; ++d)
+            {
+                result += (values[d] - m_mean[d]) * axis[d];
+            }
+            outComponents[component] = result;
+        }
+    }
+
+    void PcaSearch::Clear()
+    {
+        BruteForceSearch::Clear();
+        m_mean.clear();
+        m_components.clear();
+        m_numComponents = 0;
+        m_explainedVariance = 0.0f;
+    }
+
+    size_t PcaSearch::CalcMemoryUsageInBytes() const
+    {
+        size_t totalBytes = sizeof(PcaSearch) + CalcBlockMemoryUsageInBytes();
+        totalBytes += m_mean.capacity() * sizeof(float);
+        totalBytes += m_components.capacity() * sizeof(float);
+        return totalBytes;
+    }
+
+    void PcaSearch::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        AZ_Assert(IsInitialized(), "Expecting an initialized PCA search. Did you forget to call PcaSearch::Init()?");
+        AZ_Assert(frameFloats.size() == m_numDimensions, "Expected a query value for each of the searched dimensions.");
+
+        AZStd::fixed_vector<float, s_maxNumComponents> projectedQuery(m_numComponents);
+        Project(frameFloats.data(), projectedQuery.data());
+        SearchBlocks(projectedQuery.data(), resultFrameIndices);
+    }
+} // namespace EMotionFX::MotionMatching
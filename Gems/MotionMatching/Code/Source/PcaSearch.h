@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <BruteForceSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Brute-force search in a reduced number of dimensions.
+    //! The features are projected onto their principal components (the directions with the most variance across the motion
+    //! database), and only the strongest components are kept. As the feature values are highly correlated, a handful of
+    //! components keeps most of the information while reducing the memory bandwidth and the work per frame.
+    //! The candidates are approximate, so the search should return enough candidates for the narrow-phase to correct for that.
+    class PcaSearch
+        : public BruteForceSearch
+    {
+    public:
+        AZ_RTTI(PcaSearch, "{A1C8B3E4-5D0F-4F2A-8E6B-7C9D1E2F3A45}", BruteForceSearch);
+        AZ_CLASS_ALLOCATOR_DECL;
+
+        //! The most principal components the search can be reduced to.
+        static constexpr size_t s_maxNumComponents = 64;
+
+        PcaSearch() = default;
+        ~PcaSearch() override = default;
+
+        // BroadPhaseSearch overrides
+        bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, const InitSettings& settings) override;
+        void Clear() override;
+        size_t CalcMemoryUsageInBytes() const override;
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const override;
+
+        size_t GetNumComponents() const { return m_numComponents; }
+
+        //! The fraction of the variance of the features that is kept by the principal components used, in range [0, 1].
+        float GetExplainedVariance() const { return m_explainedVariance; }
+
+        //! Project the given values onto the principal components.
+        //! @param values The values to project, one for each dimension.
+        //! @param outComponents The resulting component values, with space for GetNumComponents() values.
+        void Project(const float* values, float* outComponents) const;
+
+    private:
+        //! Calculate the eigenvalues and eigenvectors of a symmetric matrix using Jacobi rotations.
+        //! @param matrix The row-major symmetric size x size matrix. Its contents are destroyed.
+        //! @param outEigenValues The eigenvalues, unsorted.
+        //! @param outEigenVectors Row-major matrix with the eigenvectors as columns, in the order of the eigenvalues.
+        static void CalcEigenDecomposition(AZStd::vector<double>& matrix, size_t size,
+            AZStd::vector<double>& outEigenValues, AZStd::vector<double>& outEigenVectors);
+
+        AZStd::vector<float> m_mean; //< The mean of each dimension.
+        AZStd::vector<float> m_components; //< Row-major with a row for each principal component, strongest first.
+        size_t m_numComponents = 0;
+        float m_explainedVariance = 0.0f;
+    };
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+#include <BroadPhaseSearchTestHelpers.h>
+#include <BruteForceSearch.h>
+#include <KdTree.h>
+#include <PcaSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Compares the search time and the search quality of the broad-phase searches on a feature matrix that resembles a
+    //! large motion database. The "Recall" counter is the fraction of queries where the candidates contain the actual
+    //! nearest frame, and "Candidates" the average number of frames the narrow-phase has to evaluate afterwards.
+    class BroadPhaseSearchBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t s_numFrames = 50000;
+        static constexpr size_t s_numDimensions = 24;
+        static constexpr size_t s_numQueries = 64;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void InternalSetUp()
+        {
+            m_featureMatrix = CreateRandomFeatureMatrix(s_numFrames, s_numDimensions, 6, 0.05f);
+
+            m_columns.resize(s_numDimensions);
+            for (size_t i = 0; i < s_numDimensions; ++i)
+            {
+                m_columns[i] = i;
+            }
+
+            AZ::SimpleLcgRandom random(42);
+            m_queries.clear();
+            m_nearestRows.clear();
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                m_queries.push_back(CreateQuery(m_featureMatrix, random.GetRandom() % s_numFrames, m_columns, 0.1f, random));
+                m_nearestRows.push_back(FindNearestRow(m_featureMatrix, m_columns, m_queries.back()));
+            }
+        }
+
+        void InternalTearDown()
+        {
+            m_featureMatrix.Clear();
+            m_columns = {};
+            m_queries = {};
+            m_nearestRows = {};
+        }
+
+        void InitSearch(BroadPhaseSearch& search, benchmark::State& state)
+        {
+            BroadPhaseSearch::InitSettings settings;
+            settings.m_maxKdTreeDepth = 15;
+            settings.m_minFramesPerKdTreeNode = 1000;
+            settings.m_maxCandidates = 256;
+            settings.m_numPcaComponents = 8;
+            if (!search.Init(m_featureMatrix, m_columns, settings))
+            {
+                state.SkipWithError("Failed to initialize the broad-phase search.");
+            }
+        }
+
+        void RunSearch(const BroadPhaseSearch& search, benchmark::State& state)
+        {
+            AZStd::vector<size_t> candidates;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (const AZStd::vector<float>& query : m_queries)
+                {
+                    search.FindNearestNeighbors(query, candidates);
+                    benchmark::DoNotOptimize(candidates.data());
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * s_numQueries);
+            SetQualityCounters(search, state);
+        }
+
+        void SetQualityCounters(const BroadPhaseSearch& search, benchmark::State& state)
+        {
+            size_t numFound = 0;
+            size_t numCandidates = 0;
+            AZStd::vector<size_t> candidates;
+            for (size_t i = 0; i < s_numQueries; ++i)
+            {
+                search.FindNearestNeighbors(m_queries[i], candidates);
+                numCandidates += candidates.size();
+                if (AZStd::find(candidates.begin(), candidates.end(), m_nearestRows[i]) != candidates.end())
+                {
+                    numFound++;
+                }
+            }
+
+            state.counters["Recall"] = static_cast<double>(numFound) / static_cast<double>(s_numQueries);
+            state.counters["Candidates"] = static_cast<double>(numCandidates) / static_cast<double>(s_numQueries);
+            state.counters["MemoryMB"] = static_cast<double>(search.CalcMemoryUsageInBytes()) / 1024.0 / 1024.0;
+        }
+
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<size_t> m_columns;
+        AZStd::vector<AZStd::vector<float>> m_queries;
+        AZStd::vector<size_t> m_nearestRows;
+    };
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BM_KdTreeSearch)(benchmark::State& state)
+    {
+        KdTree search;
+        InitSearch(search, state);
+        RunSearch(search, state);
+    }
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BM_KdTreeSearch)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BM_BruteForceSearch)(benchmark::State& state)
+    {
+        BruteForceSearch search;
+        InitSearch(search, state);
+        RunSearch(search, state);
+    }
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BM_BruteForceSearch)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BroadPhaseSearchBenchmarkFixture, BM_PcaSearch)(benchmark::State& state)
+    {
+        PcaSearch search;
+        InitSearch(search, state);
+        RunSearch(search, state);
+    }
+    BENCHMARK_REGISTER_F(BroadPhaseSearchBenchmarkFixture, BM_PcaSearch)->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX::MotionMatching
+
+#endif
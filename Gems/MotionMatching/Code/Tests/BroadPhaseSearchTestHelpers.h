@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Create a feature matrix that resembles motion data: the values are a random mix of a few underlying signals, plus some noise.
+    //! @param rank The number of underlying signals. The closer this is to numColumns, the less correlated the columns are.
+    inline FeatureMatrix CreateRandomFeatureMatrix(size_t numRows, size_t numColumns, size_t rank, float noise, AZ::u64 seed = 1234)
+    {
+        AZ::SimpleLcgRandom random(seed);
+
+        AZStd::vector<float> mixing(rank * numColumns);
+        for (float& value : mixing)
+        {
+            value = random.GetRandomFloat() * 2.0f - 1.0f;
+        }
+
+        FeatureMatrix featureMatrix;
+        featureMatrix.resize(numRows, numColumns);
+        AZStd::vector<float> signals(rank);
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            for (float& signal : signals)
+            {
+                signal = random.GetRandomFloat() * 2.0f - 1.0f;
+            }
+
+            for (size_t column = 0; column < numColumns; ++column)
+            {
+                float value = (random.GetRandomFloat() * 2.0f - 1.0f) * noise;
+                for (size_t i = 0; i < rank; ++i)
+                {
+                    value += signals[i] * mixing[i * numColumns + column];
+                }
+                featureMatrix(row, column) = value;
+            }
+        }
+
+        return featureMatrix;
+    }
+
+    //! Get the query values for the given columns of a row, with some noise added so the query doesn't match the row exactly.
+    inline AZStd::vector<float> CreateQuery(const FeatureMatrix& featureMatrix, size_t row, const AZStd::vector<size_t>& columns, float noise, AZ::SimpleLcgRandom& random)
+    {
+        AZStd::vector<float> query(columns.size());
+        for (size_t i = 0; i < columns.size(); ++i)
+        {
+            query[i] = featureMatrix(row, columns[i]) + (random.GetRandomFloat() * 2.0f - 1.0f) * noise;
+        }
+        return query;
+    }
+
+    //! Exhaustive search for the row with the lowest squared euclidean distance to the query.
+    inline size_t FindNearestRow(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, const AZStd::vector<float>& query)
+    {
+        size_t nearestRow = 0;
+        float nearestDistanceSq = AZStd::numeric_limits<float>::max();
+        const size_t numRows = static_cast<size_t>(featureMatrix.rows());
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            float distanceSq = 0.0f;
+            for (size_t i = 0; i < columns.size(); ++i)
+            {
+                const float delta = featureMatrix(row, columns[i]) - query[i];
+                distanceSq += delta * delta;
+            }
+
+            if (distanceSq < nearestDistanceSq)
+            {
+                nearestDistanceSq = distanceSq;
+                nearestRow = row;
+            }
+        }
+        return nearestRow;
+    }
+} // namespace EMotionFX::MotionMatching
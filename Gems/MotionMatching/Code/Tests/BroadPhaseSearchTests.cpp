@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/algorithm.h>
+
+#include <BroadPhaseSearchTestHelpers.h>
+#include <BruteForceSearch.h>
+#include <Fixture.h>
+#include <KdTree.h>
+#include <PcaSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class BroadPhaseSearchFixture : public Fixture
+    {
+    public:
+        static AZStd::vector<size_t> CreateColumns(size_t numColumns)
+        {
+            AZStd::vector<size_t> columns(numColumns);
+            for (size_t i = 0; i < numColumns; ++i)
+            {
+                columns[i] = i;
+            }
+            return columns;
+        }
+
+        static bool Contains(const AZStd::vector<size_t>& frames, size_t frame)
+        {
+            return AZStd::find(frames.begin(), frames.end(), frame) != frames.end();
+        }
+
+        //! The fraction of queries where the candidates contain the actual nearest frame.
+        static float CalcRecall(const BroadPhaseSearch& search, const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns, size_t numQueries)
+        {
+            AZ::SimpleLcgRandom random(42);
+            size_t numFound = 0;
+            AZStd::vector<size_t> candidates;
+            for (size_t i = 0; i < numQueries; ++i)
+            {
+                const size_t row = random.GetRandom() % featureMatrix.rows();
+                const AZStd::vector<float> query = CreateQuery(featureMatrix, row, columns, 0.05f, random);
+                search.FindNearestNeighbors(query, candidates);
+                if (Contains(candidates, FindNearestRow(featureMatrix, columns, query)))
+                {
+                    numFound++;
+                }
+            }
+            return static_cast<float>(numFound) / static_cast<float>(numQueries);
+        }
+    };
+
+    TEST_F(BroadPhaseSearchFixture, BruteForceSearchFindsNearestFrame)
+    {
+        const FeatureMatrix featureMatrix = CreateRandomFeatureMatrix(1001, 12, 12, 0.1f);
+        const AZStd::vector<size_t> columns = CreateColumns(12);
+
+        BroadPhaseSearch::InitSettings settings;
+        settings.m_maxCandidates = 16;
+
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(featureMatrix, columns, settings));
+        EXPECT_TRUE(search.IsInitialized());
+        EXPECT_EQ(search.GetNumDimensions(), 12);
+        EXPECT_EQ(search.GetNumFrames(), 1001);
+
+        AZ::SimpleLcgRandom random(7);
+        AZStd::vector<size_t> candidates;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            const size_t row = random.GetRandom() % featureMatrix.rows();
+            const AZStd::vector<float> query = CreateQuery(featureMatrix, row, columns, 0.05f, random);
+            search.FindNearestNeighbors(query, candidates);
+
+            EXPECT_EQ(candidates.size(), 16);
+            EXPECT_TRUE(Contains(candidates, FindNearestRow(featureMatrix, columns, query)));
+        }
+    }
+
+    TEST_F(BroadPhaseSearchFixture, BruteForceSearchOddDimensionsAndColumnSubset)
+    {
+        // Search 7 of the 10 columns, which leaves a padding value in the last value pair.
+        const FeatureMatrix featureMatrix = CreateRandomFeatureMatrix(500, 10, 10, 0.1f);
+        const AZStd::vector<size_t> columns = { 9, 0, 2, 3, 5, 6, 8 };
+
+        BroadPhaseSearch::InitSettings settings;
+        settings.m_maxCandidates = 8;
+
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(featureMatrix, columns, settings));
+        EXPECT_FLOAT_EQ(CalcRecall(search, featureMatrix, columns, 50), 1.0f);
+    }
+
+    TEST_F(BroadPhaseSearchFixture, BruteForceSearchFewerFramesThanCandidates)
+    {
+        // Less frames than a single SIMD block, so the padding frames must not show up in the results.
+        const FeatureMatrix featureMatrix = CreateRandomFeatureMatrix(3, 4, 4, 0.0f);
+        const AZStd::vector<size_t> columns = CreateColumns(4);
+
+        BruteForceSearch search;
+        ASSERT_TRUE(search.Init(featureMatrix, columns, {}));
+
+        AZStd::vector<size_t> candidates;
+        AZ::SimpleLcgRandom random(3);
+        search.FindNearestNeighbors(CreateQuery(featureMatrix, 1, columns, 0.0f, random), candidates);
+        ASSERT_EQ(candidates.size(), 3);
+        EXPECT_EQ(candidates[0], 1);
+        EXPECT_TRUE(Contains(candidates, 0));
+        EXPECT_TRUE(Contains(candidates, 2));
+    }
+
+    TEST_F(BroadPhaseSearchFixture, PcaSearchWithAllComponentsFindsNearestFrame)
+    {
+        const FeatureMatrix featureMatrix = CreateRandomFeatureMatrix(1000, 8, 8, 0.1f);
+        const AZStd::vector<size_t> columns = CreateColumns(8);
+
+        BroadPhaseSearch::InitSettings settings;
+        settings.m_maxCandidates = 16;
+        settings.m_numPcaComponents = 8;
+
+        PcaSearch search;
+        ASSERT_TRUE(search.Init(featureMatrix, columns, settings));
+        EXPECT_EQ(search.GetNumDimensions(), 8);
+        EXPECT_EQ(search.GetNumComponents(), 8);
+        EXPECT_NEAR(search.GetExplainedVariance(), 1.0f, 1e-4f);
+        EXPECT_FLOAT_EQ(CalcRecall(search, featureMatrix, columns, 50), 1.0f);
+    }
+
+    TEST_F(BroadPhaseSearchFixture, PcaSearchReducesCorrelatedFeatures)
+    {
+        // 24 columns that are a mix of only 4 signals, so 4 components keep nearly all of the information.
+        const FeatureMatrix featureMatrix = CreateRandomFeatureMatrix(2000, 24, 4, 0.01f);
+        const AZStd::vector<size_t> columns = CreateColumns(24);
+
+        BroadPhaseSearch::InitSettings settings;
+        settings.m_maxCandidates = 32;
+        settings.m_numPcaComponents = 4;
+
+        PcaSearch search;
+        ASSERT_TRUE(search.Init(featureMatrix, columns, settings));
+        EXPECT_EQ(search.GetNumComponents(), 4);
+        EXPECT_GT(search.GetExplainedVariance(), 0.99f);
+        EXPECT_GE(CalcRecall(search, featureMatrix, columns, 100), 0.95f);
+
+        BruteForceSearch bruteForceSearch;
+        ASSERT_TRUE(bruteForceSearch.Init(featureMatrix, columns, settings));
+        EXPECT_LT(search.CalcMemoryUsageInBytes(), bruteForceSearch.CalcMemoryUsageInBytes());
+    }
+
+    TEST_F(BroadPhaseSearchFixture, PcaSearchInvalidComponents)
+    {
+        const FeatureMatrix featureMatrix = CreateRandomFeatureMatrix(100, 4, 4, 0.1f);
+
+        BroadPhaseSearch::InitSettings settings;
+        settings.m_numPcaComponents = 0;
+
+        PcaSearch search;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(search.Init(featureMatrix, CreateColumns(4), settings));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(search.IsInitialized());
+    }
+
+    TEST_F(BroadPhaseSearchFixture, KdTreeInitFromColumns)
+    {
+        const FeatureMatrix featureMatrix = CreateRandomFeatureMatrix(4000, 6, 6, 0.1f);
+        const AZStd::vector<size_t> columns = { 1, 3, 5 };
+
+        BroadPhaseSearch::InitSettings settings;
+        settings.m_maxKdTreeDepth = 10;
+        settings.m_minFramesPerKdTreeNode = 100;
+
+        KdTree kdTree;
+        ASSERT_TRUE(kdTree.Init(featureMatrix, columns, settings));
+        EXPECT_TRUE(kdTree.IsInitialized());
+        EXPECT_EQ(kdTree.GetNumDimensions(), 3);
+        EXPECT_GT(kdTree.GetNumNodes(), 1);
+
+        AZ::SimpleLcgRandom random(5);
+        AZStd::vector<size_t> candidates;
+        kdTree.FindNearestNeighbors(CreateQuery(featureMatrix, 10, columns, 0.0f, random), candidates);
+        EXPECT_FALSE(candidates.empty());
+        EXPECT_TRUE(Contains(candidates, 10));
+    }
+} // namespace EMotionFX::MotionMatching
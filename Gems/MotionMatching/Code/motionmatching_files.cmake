@@ -14,6 +14,10 @@ set(FILES
     Source/Allocators.h
     Source/BlendTreeMotionMatchNode.cpp
     Source/BlendTreeMotionMatchNode.h
+    Source/BroadPhaseSearch.cpp
+    Source/BroadPhaseSearch.h
+    Source/BruteForceSearch.cpp
+    Source/BruteForceSearch.h
     Source/CsvSerializers.cpp
     Source/CsvSerializers.h
     Source/EventData.cpp
@@ -60,4 +64,6 @@ set(FILES
     Source/MotionMatchingData.h
     Source/MotionMatchingInstance.cpp
     Source/MotionMatchingInstance.h
+    Source/PcaSearch.cpp
+    Source/PcaSearch.h
 )
@@ -8,6 +8,9 @@
 
 set(FILES
     Tests/Fixture.h
+    Tests/BroadPhaseSearchBenchmarks.cpp
+    Tests/BroadPhaseSearchTestHelpers.h
+    Tests/BroadPhaseSearchTests.cpp
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
     Tests/MinMaxScalerTests.cpp
@@ -57,7 +57,7 @@ namespace NvCloth
 
         //! Start simulation of all the cloths that are part of this solver. This will setup and start cloth simulation jobs.
         //! If the solver is in user-simulated mode the user is responsible for calling this function.
-        //! Note: This is a non-blocking call.
+        //! Note: This call waits for the cloths' pre-simulation events, the simulation itself runs in the background.
         virtual void StartSimulation(float deltaTime) = 0;
 
         //! Complete the simulation process.
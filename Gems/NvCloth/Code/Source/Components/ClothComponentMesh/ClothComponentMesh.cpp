@@ -115,6 +115,11 @@ namespace NvCloth
             {
                 this->OnPostSimulation(clothId, deltaTime, updatedParticles);
             })
+        , m_solverPostSimulationEventHandler(
+            [this](const AZStd::string& solverName, float deltaTime)
+            {
+                this->OnSolverPostSimulation(solverName, deltaTime);
+            })
     {
         Setup(entityId, config);
     }
@@ -134,6 +139,9 @@ namespace NvCloth
         }
         else if (m_cloth)
         {
+            // The configuration is read by the simulation jobs and applied to the cloth directly.
+            WaitForSimulation();
+
             m_config = config;
             ApplyConfigurationToCloth();
 
@@ -177,7 +185,7 @@ namespace NvCloth
             renderData.m_bitangents = m_meshClothInfo.m_bitangents;
             renderData.m_normals = m_meshClothInfo.m_normals;
         }
-        UpdateRenderData(m_cloth->GetParticles());
+        UpdateRenderData(m_cloth->GetParticles(), GetRenderData());
         // Copy the first initialized element to the rest of the buffer
         for (AZ::u32 i = 1; i < RenderDataBufferSize; ++i)
         {
@@ -220,6 +228,7 @@ namespace NvCloth
         AZ::TickBus::Handler::BusConnect();
         m_cloth->ConnectPreSimulationEventHandler(m_preSimulationEventHandler);
         m_cloth->ConnectPostSimulationEventHandler(m_postSimulationEventHandler);
+        ConnectSolverPostSimulationEventHandler();
 
         if (m_config.IsUsingWindBus())
         {
@@ -231,11 +240,16 @@ namespace NvCloth
     {
         if (m_cloth)
         {
+            // Make sure the simulation jobs are not using the cloth and this component.
+            WaitForSimulation();
+
             Physics::WindNotificationsBus::Handler::BusDisconnect();
             AZ::TickBus::Handler::BusDisconnect();
             AZ::TransformNotificationBus::Handler::BusDisconnect();
             m_preSimulationEventHandler.Disconnect();
             m_postSimulationEventHandler.Disconnect();
+            m_solverPostSimulationEventHandler.Disconnect();
+            m_connectedSolver = nullptr;
 
             AZ::Interface<IClothSystem>::Get()->RemoveCloth(m_cloth);
             AZ::Interface<IClothSystem>::Get()->DestroyCloth(m_cloth);
@@ -245,6 +259,11 @@ namespace NvCloth
         }
         m_entityId.SetInvalid();
         m_renderDataBuffer = {};
+        m_renderDataUpdated = false;
+        m_simulationNormals.clear();
+        m_pendingTransform.reset();
+        m_pendingTeleport = false;
+        m_pendingWindVelocity.reset();
         m_meshRemappedVertices.clear();
         m_meshNodeInfo = {};
         m_meshClothInfo = {};
@@ -262,6 +281,8 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
+        ApplyPendingChangesToCloth();
+
         UpdateSimulationCollisions();
 
         if (m_actorClothSkinning)
@@ -279,10 +300,23 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
-        // Next buffer index of the render data
-        m_renderDataBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
+        // Write the next buffer of render data, it becomes current when the solver finishes the simulation.
+        const AZ::u32 nextBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
+
+        UpdateRenderData(updatedParticles, m_renderDataBuffer[nextBufferIndex]);
+        m_renderDataUpdated = true;
+    }
 
-        UpdateRenderData(updatedParticles);
+    void ClothComponentMesh::OnSolverPostSimulation(
+        [[maybe_unused]] const AZStd::string& solverName,
+        [[maybe_unused]] float deltaTime)
+    {
+        // Signaled from FinishSimulation once all simulation jobs are done, so the render data is no longer being written.
+        if (m_renderDataUpdated)
+        {
+            m_renderDataBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
+            m_renderDataUpdated = false;
+        }
     }
 
     void ClothComponentMesh::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
@@ -291,18 +325,22 @@ namespace NvCloth
         // As a workaround we will consider a teleport if the position has changed considerably.
         bool teleport = (m_worldPosition.GetDistance(world.GetTranslation()) >= cloth_DistanceToTeleport);
 
-        if (teleport)
-        {
-            TeleportCloth(world);
-        }
-        else
+        m_worldPosition = world.GetTranslation();
+        m_pendingTransform = world;
+        m_pendingTeleport = m_pendingTeleport || teleport;
+
+        if (m_config.IsUsingWindBus())
         {
-            MoveCloth(world);
+            // Wind velocity is affected by world position
+            m_pendingWindVelocity = GetWindBusVelocity();
         }
     }
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        // The cloth can be moved to another solver through IClothSystem::AddCloth at any time.
+        ConnectSolverPostSimulationEventHandler();
+
         CopyRenderDataToModel();
     }
 
@@ -313,7 +351,7 @@ namespace NvCloth
 
     void ClothComponentMesh::OnGlobalWindChanged()
     {
-        m_cloth->GetClothConfigurator()->SetWindVelocity(GetWindBusVelocity());
+        m_pendingWindVelocity = GetWindBusVelocity();
     }
 
     void ClothComponentMesh::OnWindChanged([[maybe_unused]] const AZ::Aabb& aabb)
@@ -404,7 +442,7 @@ namespace NvCloth
         }
     }
 
-    void ClothComponentMesh::UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles)
+    void ClothComponentMesh::UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles, RenderData& renderData)
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
@@ -413,8 +451,6 @@ namespace NvCloth
             return;
         }
 
-        auto& renderData = GetRenderData();
-
         if (m_actorClothSkinning)
         {
             // Apply skinning to the non-simulated part of the mesh.
@@ -422,7 +458,7 @@ namespace NvCloth
         }
 
         // Calculate normals of the cloth particles (simplified mesh).
-        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<AZ::Vector3>& normals = m_simulationNormals;
         [[maybe_unused]] bool normalsCalculated =
             AZ::Interface<ITangentSpaceHelper>::Get()->CalculateNormals(particles, m_cloth->GetInitialIndices(), normals);
         AZ_Assert(normalsCalculated, "Cloth component mesh failed to calculate normals.");
@@ -764,12 +800,6 @@ namespace NvCloth
         m_worldPosition = worldTransform.GetTranslation();
 
         m_cloth->GetClothConfigurator()->SetTransform(worldTransform);
-
-        if (m_config.IsUsingWindBus())
-        {
-            // Wind velocity is affected by world position
-            m_cloth->GetClothConfigurator()->SetWindVelocity(GetWindBusVelocity());
-        }
     }
 
     void ClothComponentMesh::TeleportCloth(const AZ::Transform& worldTransform)
@@ -780,6 +810,52 @@ namespace NvCloth
         m_cloth->GetClothConfigurator()->ClearInertia();
     }
 
+    void ClothComponentMesh::ApplyPendingChangesToCloth()
+    {
+        // Called from the pre-simulation, while the solver waits for it, so nothing else is changing the pending data.
+        if (m_pendingTransform.has_value())
+        {
+            if (m_pendingTeleport)
+            {
+                TeleportCloth(m_pendingTransform.value());
+            }
+            else
+            {
+                MoveCloth(m_pendingTransform.value());
+            }
+            m_pendingTransform.reset();
+            m_pendingTeleport = false;
+        }
+
+        if (m_pendingWindVelocity.has_value())
+        {
+            m_cloth->GetClothConfigurator()->SetWindVelocity(m_pendingWindVelocity.value());
+            m_pendingWindVelocity.reset();
+        }
+    }
+
+    void ClothComponentMesh::WaitForSimulation()
+    {
+        if (ISolver* solver = m_cloth->GetSolver())
+        {
+            solver->FinishSimulation();
+        }
+    }
+
+    void ClothComponentMesh::ConnectSolverPostSimulationEventHandler()
+    {
+        ISolver* solver = m_cloth->GetSolver();
+        if (solver != m_connectedSolver)
+        {
+            m_solverPostSimulationEventHandler.Disconnect();
+            if (solver)
+            {
+                solver->ConnectPostSimulationEventHandler(m_solverPostSimulationEventHandler);
+            }
+            m_connectedSolver = solver;
+        }
+    }
+
     AZ::Vector3 ClothComponentMesh::GetWindBusVelocity()
     {
         const Physics::WindRequests* windRequests = AZ::Interface<Physics::WindRequests>::Get();
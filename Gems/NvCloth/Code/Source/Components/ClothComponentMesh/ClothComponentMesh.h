@@ -11,10 +11,12 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/optional.h>
 
 #include <AzFramework/Physics/WindBus.h>
 
 #include <NvCloth/ICloth.h>
+#include <NvCloth/ISolver.h>
 
 #include <Components/ClothConfiguration.h>
 
@@ -68,6 +70,9 @@ namespace NvCloth
         void OnPreSimulation(ClothId clothId, float deltaTime);
         void OnPostSimulation(ClothId clothId, float deltaTime, const AZStd::vector<SimParticleFormat>& updatedParticles);
 
+        // ISolver notifications
+        void OnSolverPostSimulation(const AZStd::string& solverName, float deltaTime);
+
         // AZ::TransformNotificationBus::Handler overrides ...
         void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
 
@@ -83,7 +88,10 @@ namespace NvCloth
         void UpdateSimulationCollisions();
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
-        void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles);
+        void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles, RenderData& renderData);
+        void ApplyPendingChangesToCloth();
+        void WaitForSimulation();
+        void ConnectSolverPostSimulationEventHandler();
 
         bool CreateCloth();
         void ApplyConfigurationToCloth();
@@ -110,12 +118,30 @@ namespace NvCloth
         // Cloth event handlers
         ICloth::PreSimulationEvent::Handler m_preSimulationEventHandler;
         ICloth::PostSimulationEvent::Handler m_postSimulationEventHandler;
+        ISolver::PostSimulationEvent::Handler m_solverPostSimulationEventHandler;
+
+        // Solver the post-simulation handler is connected to, which is the solver the cloth is added to
+        const ISolver* m_connectedSolver = nullptr;
 
-        // Use a double buffer of render data to always have access to the previous frame's data.
+        // Use a triple buffer of render data to always have access to the previous frame's data
+        // while the simulation writes the next frame's data.
         // The previous frame's data is used to workaround that debug draw is one frame delayed.
-        static const AZ::u32 RenderDataBufferSize = 2;
+        // The next frame's data is written by the post-simulation job, which can still be running while
+        // the current data is copied to the model (see cloth_AsyncSimulation). It becomes current when
+        // the solver finishes the simulation.
+        static const AZ::u32 RenderDataBufferSize = 3;
         AZ::u32 m_renderDataBufferIndex = 0;
         AZStd::array<RenderData, RenderDataBufferSize> m_renderDataBuffer;
+        bool m_renderDataUpdated = false;
+
+        // Normals of the simulation particles, kept to avoid allocating them every simulation.
+        AZStd::vector<AZ::Vector3> m_simulationNormals;
+
+        // Transform and wind changes are kept until the next pre-simulation, as the
+        // cloth can still be simulating in the background when they are received.
+        AZStd::optional<AZ::Transform> m_pendingTransform;
+        bool m_pendingTeleport = false;
+        AZStd::optional<AZ::Vector3> m_pendingWindVelocity;
 
         // Vertex mapping between full mesh and simplified mesh used in cloth simulation.
         // Negative elements means the vertex has been removed.
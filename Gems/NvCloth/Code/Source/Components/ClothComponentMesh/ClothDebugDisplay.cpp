@@ -77,6 +77,9 @@ namespace NvCloth
             return;
         }
 
+        // The cloth particles are drawn, they cannot be changing in the background.
+        m_clothComponentMesh->WaitForSimulation();
+
         AZ::Transform entityTransform = AZ::Transform::CreateIdentity();
         AZ::TransformBus::EventResult(entityTransform, m_clothComponentMesh->m_entityId, &AZ::TransformInterface::GetWorldTM);
         debugDisplay.PushMatrix(entityTransform);
@@ -243,6 +243,11 @@ namespace NvCloth
         return this;
     }
 
+    Solver* Cloth::GetSolver()
+    {
+        return m_solver;
+    }
+
     void Cloth::SetTransform(const AZ::Transform& transformWorld)
     {
         m_nvCloth->setTranslation(Internal::AsPxVec3(transformWorld.GetTranslation()));
@@ -120,6 +120,15 @@ namespace NvCloth
         // Set isSimulating flag after the pre-simulation event is sent in case if there are handlers adding/removing cloth from the solver.
         m_isSimulating = true;
 
+        // Pre-simulation jobs gather the simulation input (colliders, skinning, transforms...) from the game state.
+        // Wait for them here so the rest of the simulation pass only touches cloth data and can run alongside the frame
+        // until FinishSimulation is called.
+        AZ::JobCompletion preSimulationCompletion;
+        ClothsPreSimulationJob* clothsPreSimulationJob = aznew ClothsPreSimulationJob(&m_cloths, m_deltaTime, &preSimulationCompletion);
+        clothsPreSimulationJob->SetDependent(&preSimulationCompletion);
+        clothsPreSimulationJob->Start();
+        preSimulationCompletion.StartAndWaitForCompletion();
+
         // Setup the chain of jobs for the simulation pass
 
         // Post simulation jobs will unlock the entire simulation pass completion.
@@ -130,12 +139,7 @@ namespace NvCloth
         ClothsSimulationJob* clothsSimulationJob = aznew ClothsSimulationJob(m_nvSolver.get(), m_deltaTime, clothsPostSimulationJob);
         clothsSimulationJob->SetDependent(clothsPostSimulationJob);
 
-        // Pre-simulation jobs will unlock the simulation job.
-        ClothsPreSimulationJob* clothsPreSimulationJob = aznew ClothsPreSimulationJob(&m_cloths, m_deltaTime, clothsSimulationJob);
-        clothsPreSimulationJob->SetDependent(clothsSimulationJob);
-
         // Start the jobs.
-        clothsPreSimulationJob->Start();
         clothsSimulationJob->Start();
         clothsPostSimulationJob->Start();
     }
@@ -22,6 +22,10 @@
 
 namespace NvCloth
 {
+    AZ_CVAR(bool, cloth_AsyncSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled the cloth simulation started on the physics tick is finished on the next frame's physics tick, "
+        "so it runs in the background alongside the rest of the frame. Cloth is rendered one frame behind the simulation input.");
+
     namespace
     {
         // Implementation of the memory allocation callback interface using nvcloth allocator.
@@ -253,6 +257,8 @@ namespace NvCloth
 
             if (solverIt != m_solvers.end())
             {
+                FinishSolverSimulation(solverIt->get());
+
                 // The solver will remove all its remaining cloths from it when destroyed
                 m_solvers.erase(solverIt);
                 solver = nullptr;
@@ -338,6 +344,11 @@ namespace NvCloth
         {
             FabricId fabricId = cloth->GetFabricCookedData().m_id;
 
+            if (Cloth* clothInstance = azdynamic_cast<Cloth*>(cloth))
+            {
+                FinishSolverSimulation(clothInstance->GetSolver());
+            }
+
             // Cloth will decrement its fabric's counter on destruction.
             // In addition, if the cloth still remains added into a solver, it will remove itself from it.
             m_cloths.erase(cloth->GetId());
@@ -376,6 +387,9 @@ namespace NvCloth
             Solver* solverInstance = azdynamic_cast<Solver*>(solver);
             AZ_Assert(solverInstance, "Dynamic casting from ISolver to Solver failed.");
 
+            FinishSolverSimulation(clothInstance->GetSolver());
+            FinishSolverSimulation(solverInstance);
+
             solverInstance->AddCloth(clothInstance);
 
             return true;
@@ -394,6 +408,7 @@ namespace NvCloth
             Solver* solverInstance = clothInstance->GetSolver();
             if (solverInstance)
             {
+                FinishSolverSimulation(solverInstance);
                 solverInstance->RemoveCloth(clothInstance);
             }
         }
@@ -405,14 +420,34 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
+        // Finish the simulation left running by the previous tick when simulating asynchronously.
         for (auto& solverIt : m_solvers)
         {
             if (!solverIt->IsUserSimulated())
             {
-                solverIt->StartSimulation(deltaTime);
                 solverIt->FinishSimulation();
             }
         }
+
+        // Start all solvers before waiting for any of them so their simulation jobs run in parallel.
+        for (auto& solverIt : m_solvers)
+        {
+            if (!solverIt->IsUserSimulated())
+            {
+                solverIt->StartSimulation(deltaTime);
+            }
+        }
+
+        if (!cloth_AsyncSimulation)
+        {
+            for (auto& solverIt : m_solvers)
+            {
+                if (!solverIt->IsUserSimulated())
+                {
+                    solverIt->FinishSimulation();
+                }
+            }
+        }
     }
 
     int SystemComponent::GetTickOrder()
@@ -439,6 +474,11 @@ namespace NvCloth
         AZ::TickBus::Handler::BusDisconnect();
         AZ::Interface<IClothSystem>::Unregister(this);
 
+        for (auto& solverIt : m_solvers)
+        {
+            FinishSolverSimulation(solverIt.get());
+        }
+
         // Destroy Cloths
         m_cloths.clear();
 
@@ -453,4 +493,12 @@ namespace NvCloth
         m_factory.reset();
     }
 
+    void SystemComponent::FinishSolverSimulation(Solver* solver)
+    {
+        if (solver)
+        {
+            solver->FinishSimulation();
+        }
+    }
+
 } // namespace NvCloth
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 
 #include <NvCloth/IClothSystem.h>
 #include <NvCloth/ICloth.h>
@@ -22,11 +23,15 @@
 
 namespace NvCloth
 {
+    AZ_CVAR_EXTERNED(bool, cloth_AsyncSimulation);
+
     //! Implementation of the IClothSystem interface.
     //!
     //! This class has the responsibility to initialize and tear down NvCloth library.
     //! It owns all Solvers, Cloths and Fabrics, and it manages their creation and destruction.
     //! It's also the responsible for updating (on Physics Tick) all the solvers that are not flagged as "user simulated".
+    //! All those solvers are started before waiting for any of them, so they simulate in parallel. With cloth_AsyncSimulation
+    //! enabled they are finished on the next tick instead, letting the simulation overlap the rest of the frame.
     class SystemComponent
         : public AZ::Component
         , protected IClothSystem
@@ -75,6 +80,10 @@ namespace NvCloth
         void InitializeSystem();
         void DestroySystem();
 
+        // Waits for the simulation of a solver that can still be running from the last tick
+        // before cloths are added to it or removed from it.
+        static void FinishSolverSimulation(Solver* solver);
+
         FabricId FindOrCreateFabric(const FabricCookedData& fabricCookedData);
         void DestroyFabric(FabricId fabricId);
 
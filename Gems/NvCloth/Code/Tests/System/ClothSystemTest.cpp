@@ -21,6 +21,7 @@
 
 #include <System/Cloth.h>
 #include <System/Solver.h>
+#include <System/SystemComponent.h>
 
 namespace UnitTest
 {
@@ -458,4 +459,63 @@ namespace UnitTest
         AZ::Interface<NvCloth::IClothSystem>::Get()->DestroyCloth(cloth);
         AZ::Interface<NvCloth::IClothSystem>::Get()->DestroySolver(solver);
     }
+
+    TEST(NvClothSystem, ClothSystem_TickWithAsyncSimulation_SolverIsFinishedOnNextTick)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+
+        NvCloth::cloth_AsyncSimulation = true;
+
+        NvCloth::ISolver* solver = AZ::Interface<NvCloth::IClothSystem>::Get()->FindOrCreateSolver("Solver_TickAsync");
+
+        const NvCloth::FabricCookedData fabricCookedData = CreateTestFabricCookedData();
+        NvCloth::ICloth* cloth = AZ::Interface<NvCloth::IClothSystem>::Get()->CreateCloth(fabricCookedData.m_particles, fabricCookedData);
+
+        int solverPreSimulationEventCount = 0;
+        NvCloth::ISolver::PreSimulationEvent::Handler solverPreSimulationEventHandler(
+            [&solverPreSimulationEventCount](const AZStd::string&, float)
+            {
+                ++solverPreSimulationEventCount;
+            });
+
+        int solverPostSimulationEventCount = 0;
+        NvCloth::ISolver::PostSimulationEvent::Handler solverPostSimulationEventHandler(
+            [&solverPostSimulationEventCount](const AZStd::string&, float)
+            {
+                ++solverPostSimulationEventCount;
+            });
+
+        solver->ConnectPreSimulationEventHandler(solverPreSimulationEventHandler);
+        solver->ConnectPostSimulationEventHandler(solverPostSimulationEventHandler);
+
+        AZ::Interface<NvCloth::IClothSystem>::Get()->AddCloth(cloth, solver->GetName());
+
+        // The simulation started on this tick is left running
+        AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick,
+            deltaTimeSim,
+            AZ::ScriptTimePoint(AZStd::chrono::steady_clock::now()));
+
+        EXPECT_EQ(solverPreSimulationEventCount, 1);
+        EXPECT_EQ(solverPostSimulationEventCount, 0);
+
+        // The next tick finishes it before starting a new one
+        AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick,
+            deltaTimeSim,
+            AZ::ScriptTimePoint(AZStd::chrono::steady_clock::now()));
+
+        EXPECT_EQ(solverPreSimulationEventCount, 2);
+        EXPECT_EQ(solverPostSimulationEventCount, 1);
+
+        // Removing the cloth waits for the simulation in progress
+        AZ::Interface<NvCloth::IClothSystem>::Get()->RemoveCloth(cloth);
+
+        EXPECT_EQ(solverPostSimulationEventCount, 2);
+
+        NvCloth::cloth_AsyncSimulation = false;
+
+        // NOTE: IClothSystem is persistent as it's part of the test environment.
+        //       Destroying cloth and solver to avoid leaving it in the environment.
+        AZ::Interface<NvCloth::IClothSystem>::Get()->DestroyCloth(cloth);
+        AZ::Interface<NvCloth::IClothSystem>::Get()->DestroySolver(solver);
+    }
 } // namespace UnitTest
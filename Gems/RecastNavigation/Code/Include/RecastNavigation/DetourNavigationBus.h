@@ -11,9 +11,47 @@
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/function/function_fwd.h>
 
 namespace RecastNavigation
 {
+    //! Identifies a path request made with @DetourNavigationRequests::FindPathBetweenPositionsAsync or @RecastNavigationMeshRequests::FindPathAsync.
+    using PathRequestId = AZ::u64;
+    inline constexpr PathRequestId InvalidPathRequestId = 0;
+
+    //! Asynchronous path requests with a higher priority are searched before requests with a lower priority.
+    enum class PathRequestPriority : AZ::u8
+    {
+        Low,
+        Normal,
+        High
+    };
+
+    //! Called on the main thread once an asynchronous path request is done.
+    //! @param requestId the id that was returned when the request was made.
+    //! @param waypoints the waypoints of the path. The vector is empty if a path was not found.
+    using PathRequestCallback = AZStd::function<void(PathRequestId requestId, const AZStd::vector<AZ::Vector3>& waypoints)>;
+
+    //! Counters for the asynchronous path requests of a navigation mesh, since it was activated.
+    struct PathfindingStatistics
+    {
+        //! Number of asynchronous path requests that were made.
+        AZ::u64 m_requestsMade = 0;
+        //! Number of requests whose callback was called.
+        AZ::u64 m_requestsCompleted = 0;
+        //! Number of requests that were cancelled before their callback was called.
+        AZ::u64 m_requestsCancelled = 0;
+        //! Number of requests that shared the search of an identical request instead of searching on their own.
+        AZ::u64 m_requestsMerged = 0;
+        //! Number of path searches that were run on the navigation mesh.
+        AZ::u64 m_pathSearches = 0;
+        //! Number of requests waiting for their callback.
+        AZ::u64 m_pendingRequests = 0;
+        //! Time between making a request and its callback being called, in milliseconds.
+        float m_averageLatencyMs = 0.f;
+        float m_maxLatencyMs = 0.f;
+    };
+
     //! Interface for path finding API.
     class DetourNavigationRequests
         : public AZ::ComponentBus
@@ -38,6 +76,37 @@ namespace RecastNavigation
         //! @param toWorldPosition The end point of the path to find.
         //! @return If a path is found, returns a vector of waypoints. An empty vector is returned if a path was not found.
         virtual AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! Non-blocking call that finds a walkable path between two entities.
+        //! The positions of the entities are taken when the request is made.
+        //! The request is submitted to the navigation mesh entity, see @RecastNavigationMeshRequests::FindPathAsync.
+        //! @param fromEntity The starting point of the path from the position of this entity.
+        //! @param toEntity The end point of the path is at the position of this entity.
+        //! @param priority Requests with a higher priority are searched first.
+        //! @param callback Called on the main thread with the waypoints once the path search is done.
+        //! @return The id of the request, or @InvalidPathRequestId if the entities are not valid or there is no navigation mesh.
+        virtual PathRequestId FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity,
+            PathRequestPriority priority, PathRequestCallback callback) = 0;
+
+        //! Non-blocking call that finds a walkable path between two world positions.
+        //! The request is submitted to the navigation mesh entity, which searches the requests of every path finding component
+        //! that uses it in batches on worker threads, over several frames if there are many requests.
+        //! Requests with the same start and end positions as a request that is still pending share a single path search.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @param priority Requests with a higher priority are searched first.
+        //! @param callback Called on the main thread with the waypoints once the path search is done.
+        //! @return The id of the request, which can be used to cancel it, or @InvalidPathRequestId if there is no navigation mesh.
+        virtual PathRequestId FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition,
+            PathRequestPriority priority, PathRequestCallback callback) = 0;
+
+        //! Cancels an asynchronous path request. Its callback will not be called.
+        //! @param requestId The id returned when the request was made.
+        virtual void CancelPathRequest(PathRequestId requestId) = 0;
+
+        //! @return Counters for the asynchronous path requests made to the navigation mesh entity, including the requests
+        //!         of other path finding components that use the same navigation mesh.
+        virtual PathfindingStatistics GetPathfindingStatistics() const = 0;
     };
 
     //! Request EBus for a path finding component.
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <DetourNavMesh.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <RecastNavigation/RecastSmartPointer.h>
 
 namespace RecastNavigation
@@ -16,10 +18,13 @@ namespace RecastNavigation
     //! Holds pointers to Recast navigation mesh objects and the associated mutex.
     //! This structure should be used when performing operations on a navigation mesh.
     //! In order to access NavMesh or NavMeshQuery objects, use the object LockGuard(NavMeshQuery&).
+    //! Path finding with separate query objects can use ReadLockGuard(NavMeshQuery&) instead, so that several threads can
+    //! read the navigation mesh at the same time.
     class NavMeshQuery
     {
     public:
         class LockGuard;
+        class ReadLockGuard;
 
         NavMeshQuery(dtNavMesh* navMesh, dtNavMeshQuery* navQuery)
         {
@@ -37,9 +42,23 @@ namespace RecastNavigation
             //! @param navMesh navigation mesh to hold on to
             explicit LockGuard(NavMeshQuery& navMesh)
                 : m_lock(navMesh.m_mutex)
+                , m_navMeshQuery(navMesh)
                 , m_mesh(navMesh.m_mesh.get())
                 , m_query(navMesh.m_query.get())
             {
+                // The lock is recursive, so only the outermost lock on this thread waits for readers to finish.
+                if (m_navMeshQuery.m_lockDepth++ == 0)
+                {
+                    m_navMeshQuery.m_readWriteMutex.lock();
+                }
+            }
+
+            ~LockGuard()
+            {
+                if (--m_navMeshQuery.m_lockDepth == 0)
+                {
+                    m_navMeshQuery.m_readWriteMutex.unlock();
+                }
             }
 
             //! Navigation mesh accessor.
@@ -56,12 +75,41 @@ namespace RecastNavigation
 
         private:
             AZStd::lock_guard<AZStd::recursive_mutex> m_lock;
+            NavMeshQuery& m_navMeshQuery;
             dtNavMesh* m_mesh = nullptr;
             dtNavMeshQuery* m_query = nullptr;
 
             AZ_DISABLE_COPY_MOVE(LockGuard);
         };
 
+        //! A lock guard class that gives read-only access to the navigation mesh.
+        //! Any number of these can be held at the same time, but the navigation mesh can't be modified until all of them are released.
+        //! The shared query object isn't available through this lock, so each thread needs its own dtNavMeshQuery.
+        //! Don't grab a LockGuard on the same thread while holding this lock.
+        class ReadLockGuard
+        {
+        public:
+            //! Grabs a shared lock on a mutex in @NavMeshQuery
+            //! @param navMesh navigation mesh to hold on to
+            explicit ReadLockGuard(NavMeshQuery& navMesh)
+                : m_lock(navMesh.m_readWriteMutex)
+                , m_mesh(navMesh.m_mesh.get())
+            {
+            }
+
+            //! Navigation mesh accessor.
+            const dtNavMesh* GetNavMesh() const
+            {
+                return m_mesh;
+            }
+
+        private:
+            AZStd::shared_lock<AZStd::shared_mutex> m_lock;
+            const dtNavMesh* m_mesh = nullptr;
+
+            AZ_DISABLE_COPY_MOVE(ReadLockGuard);
+        };
+
     private:
         //! Recast navigation mesh object.
         RecastPointer<dtNavMesh> m_mesh;
@@ -71,5 +119,11 @@ namespace RecastNavigation
 
         //! A mutex for accessing and modifying the navigation mesh.
         AZStd::recursive_mutex m_mutex;
+
+        //! Held exclusively by the outermost LockGuard and shared by every ReadLockGuard.
+        AZStd::shared_mutex m_readWriteMutex;
+
+        //! The number of nested LockGuard objects on the thread that holds @m_mutex. Only that thread touches it.
+        int m_lockDepth = 0;
     };
 } // namespace RecastNavigation
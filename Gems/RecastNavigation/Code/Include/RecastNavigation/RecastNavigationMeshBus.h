@@ -11,6 +11,7 @@
 #include <DetourNavMesh.h>
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <RecastNavigation/DetourNavigationBus.h>
 #include <RecastNavigation/NavMeshQuery.h>
 #include <RecastNavigation/RecastSmartPointer.h>
 
@@ -29,8 +30,39 @@ namespace RecastNavigation
         //! @returns false if another update operation is already in progress
         virtual bool UpdateNavigationMeshAsync() = 0;
 
+        //! Re-calculates the navigation mesh tiles that overlap a world space region. Blocking call.
+        //! Tiles whose geometry hasn't changed since they were last built are kept as they are.
+        //! @param region the world space region to update.
+        //! @returns false if another update operation is already in progress
+        virtual bool UpdateNavigationMeshRegionBlockUntilCompleted(const AZ::Aabb& region) = 0;
+
+        //! Re-calculates the navigation mesh tiles that overlap a world space region.
+        //! Notifies when completed using @RecastNavigationMeshNotificationBus.
+        //! @param region the world space region to update.
+        //! @returns false if another update operation is already in progress
+        virtual bool UpdateNavigationMeshRegionAsync(const AZ::Aabb& region) = 0;
+
         //! @returns the underlying navigation objects with the associated synchronization object.
         virtual AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() = 0;
+
+        //! Non-blocking call that finds a walkable path over this navigation mesh.
+        //! Requests from every path finding component that uses this navigation mesh are searched together in batches on worker threads,
+        //! and requests with the same start and end positions as a request that is still pending share a single path search.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @param nearestDistance Distance to use when finding the nearest point on the navigation mesh.
+        //! @param priority Requests with a higher priority are searched first.
+        //! @param callback Called on the main thread with the waypoints once the path search is done.
+        //! Requests that are still pending when the navigation mesh is deactivated are dropped without calling their callback.
+        //! @return The id of the request, which can be used to cancel it.
+        virtual PathRequestId FindPathAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, float nearestDistance,
+            PathRequestPriority priority, PathRequestCallback callback) = 0;
+
+        //! Cancels an asynchronous path request made with @FindPathAsync. Its callback will not be called.
+        virtual void CancelPathRequest(PathRequestId requestId) = 0;
+
+        //! @return Counters for the asynchronous path requests made to this navigation mesh.
+        virtual PathfindingStatistics GetPathfindingStatistics() const = 0;
     };
 
     //! Request EBus for a navigation mesh component.
@@ -34,6 +34,28 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Collects the geometry (triangles) for the tiles that overlap a region of the configured area. Blocking call.
+        //! Providers may return cached geometry for tiles that haven't changed since they were last collected. The default
+        //! implementation collects the entire configured area.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile.
+        //! @param region Only the tiles whose geometry (including the border) overlaps this world space region are collected.
+        //! @returns a container with triangle data for each tile that overlaps the region.
+        virtual AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryWithinRegion(
+            float tileSize, float borderSize, [[maybe_unused]] const AZ::Aabb& region)
+        {
+            return CollectGeometry(tileSize, borderSize);
+        }
+
+        //! Async variant of @CollectGeometryWithinRegion. Results are returned via the callback @tileCallback,
+        //! following the same rules as @CollectGeometryAsync. The default implementation collects the entire configured area.
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectGeometryWithinRegionAsync(float tileSize, float borderSize, [[maybe_unused]] const AZ::Aabb& region,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+        {
+            return CollectGeometryAsync(tileSize, borderSize, AZStd::move(tileCallback));
+        }
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
@@ -46,4 +68,17 @@ namespace RecastNavigation
 
     //! Request EBus for a navigation provider component that collects geometry data.
     using RecastNavigationProviderRequestBus = AZ::EBus<RecastNavigationProviderRequests>;
+
+    //! The interface for @RecastNavigationProviderNotificationBus.
+    class RecastNavigationProviderNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        //! Notifies that the geometry within a region has changed, so navigation mesh tiles that overlap it are out of date.
+        //! @param dirtyRegion the world space region that changed.
+        virtual void OnNavigationGeometryChanged(const AZ::Aabb& dirtyRegion) = 0;
+    };
+
+    //! Notification EBus for a navigation provider component.
+    using RecastNavigationProviderNotificationBus = AZ::EBus<RecastNavigationProviderNotifications>;
 } // namespace RecastNavigation
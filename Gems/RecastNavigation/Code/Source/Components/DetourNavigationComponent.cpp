@@ -10,6 +10,7 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Components/DetourNavigationComponent.h>
+#include <Misc/DetourPathfindingQueue.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
 
@@ -79,67 +80,63 @@ namespace RecastNavigation
             return {};
         }
 
-        RecastVector3 startRecast = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
-        RecastVector3 endRecast = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
-        const float halfExtents[3] = { m_nearestDistance, m_nearestDistance, m_nearestDistance };
-
-        dtPolyRef startPoly = 0, endPoly = 0;
-
-        RecastVector3 nearestStartPoint, nearestEndPoint;
-
-        const dtQueryFilter filter;
+        return DetourPathfindingQueue::FindPath(*lock.GetNavQuery(), fromWorldPosition, toWorldPosition, m_nearestDistance);
+    }
 
-        // Find nearest points on the navigation mesh given the positions provided.
-        // We are allowing some flexibility where looking for a point just a bit outside of the navigation mesh would still work.
-        dtStatus result = lock.GetNavQuery()->findNearestPoly(startRecast.GetData(), halfExtents, &filter, &startPoly, nearestStartPoint.GetData());
-        if (dtStatusFailed(result) || startPoly == 0)
+    PathRequestId DetourNavigationComponent::FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity,
+        PathRequestPriority priority, PathRequestCallback callback)
+    {
+        if (fromEntity.IsValid() && toEntity.IsValid())
         {
-            return {};
-        }
+            AZ::Vector3 start = AZ::Vector3::CreateZero(), end = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(start, fromEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+            AZ::TransformBus::EventResult(end, toEntity, &AZ::TransformBus::Events::GetWorldTranslation);
 
-        result = lock.GetNavQuery()->findNearestPoly(endRecast.GetData(), halfExtents, &filter, &endPoly, nearestEndPoint.GetData());
-        if (dtStatusFailed(result) || endPoly == 0)
-        {
-            return {};
+            return FindPathBetweenPositionsAsync(start, end, priority, AZStd::move(callback));
         }
 
-        // Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
-        constexpr int MaxPathLength = 100;
-
-        AZStd::array<dtPolyRef, MaxPathLength> path;
-        int pathLength = 0;
+        return InvalidPathRequestId;
+    }
 
-        // Find an approximate path first. In Recast, an approximate path is a collection of polygons, where a polygon covers an area.
-        result = lock.GetNavQuery()->findPath(startPoly, endPoly, nearestStartPoint.GetData(), nearestEndPoint.GetData(),
-            &filter, path.data(), &pathLength, MaxPathLength);
-        if (dtStatusFailed(result))
+    PathRequestId DetourNavigationComponent::FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition,
+        const AZ::Vector3& toWorldPosition, PathRequestPriority priority, PathRequestCallback callback)
+    {
+        // The navigation mesh entity searches the requests of all of its agents together.
+        // Callbacks are never called after deactivation, since the pending requests are cancelled then.
+        auto onPathFound = [this, callback = AZStd::move(callback)](PathRequestId requestId, const AZStd::vector<AZ::Vector3>& waypoints)
         {
-            return {};
-        }
-
-        AZStd::array<RecastVector3, MaxPathLength> detailedPath;
-        AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
-        AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
-        int detailedPathCount = 0;
-
-        // Then the detailed path. This gives us actual specific waypoints along the path over the polygons found earlier.
-        result = lock.GetNavQuery()->findStraightPath(startRecast.GetData(), endRecast.GetData(), path.data(), pathLength,
-            detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
-            &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
-        if (dtStatusFailed(result))
+            m_pendingPathRequests.erase(requestId);
+            if (callback)
+            {
+                callback(requestId, waypoints);
+            }
+        };
+
+        PathRequestId requestId = InvalidPathRequestId;
+        RecastNavigationMeshRequestBus::EventResult(requestId, m_navQueryEntityId, &RecastNavigationMeshRequests::FindPathAsync,
+            fromWorldPosition, toWorldPosition, m_nearestDistance, priority, AZStd::move(onPathFound));
+        if (requestId != InvalidPathRequestId)
         {
-            return {};
+            m_pendingPathRequests.emplace(requestId, m_navQueryEntityId);
         }
+        return requestId;
+    }
 
-        AZStd::vector<AZ::Vector3> pathPoints;
-        pathPoints.reserve(detailedPathCount);
-        // Note: Recast uses +Y, O3DE used +Z as up vectors.
-        for (int i = 0; i < detailedPathCount; ++i)
+    void DetourNavigationComponent::CancelPathRequest(PathRequestId requestId)
+    {
+        if (auto request = m_pendingPathRequests.find(requestId); request != m_pendingPathRequests.end())
         {
-            pathPoints.push_back(detailedPath[i].AsVector3WithZup());
+            // The request may have been submitted to a navigation mesh entity other than the current one.
+            RecastNavigationMeshRequestBus::Event(request->second, &RecastNavigationMeshRequests::CancelPathRequest, requestId);
+            m_pendingPathRequests.erase(request);
         }
+    }
 
-        return pathPoints;
+    PathfindingStatistics DetourNavigationComponent::GetPathfindingStatistics() const
+    {
+        PathfindingStatistics statistics;
+        RecastNavigationMeshRequestBus::EventResult(statistics, m_navQueryEntityId, &RecastNavigationMeshRequests::GetPathfindingStatistics);
+        return statistics;
     }
 
     void DetourNavigationComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
@@ -166,5 +163,11 @@ namespace RecastNavigation
     void DetourNavigationComponent::Deactivate()
     {
         DetourNavigationRequestBus::Handler::BusDisconnect();
+
+        for (const auto& [requestId, navMeshEntityId] : m_pendingPathRequests)
+        {
+            RecastNavigationMeshRequestBus::Event(navMeshEntityId, &RecastNavigationMeshRequests::CancelPathRequest, requestId);
+        }
+        m_pendingPathRequests.clear();
     }
 } // namespace RecastNavigation
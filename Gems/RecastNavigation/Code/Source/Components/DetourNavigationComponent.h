@@ -9,12 +9,15 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <RecastNavigation/DetourNavigationBus.h>
 
 namespace RecastNavigation
 {
     //! Calculates paths over the associated navigation mesh.
     //! Provides APIs to find a path between two entities or two world positions.
+    //! Paths can be found right away, or requested asynchronously from the navigation mesh entity,
+    //! which finds the paths of every agent that uses it in batches on worker threads.
     class DetourNavigationComponent final
         : public AZ::Component
         , public DetourNavigationRequestBus::Handler
@@ -36,6 +39,12 @@ namespace RecastNavigation
         AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
         void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
         AZ::EntityId GetNavigationMeshEntity() const override;
+        PathRequestId FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity,
+            PathRequestPriority priority, PathRequestCallback callback) override;
+        PathRequestId FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition,
+            PathRequestPriority priority, PathRequestCallback callback) override;
+        void CancelPathRequest(PathRequestId requestId) override;
+        PathfindingStatistics GetPathfindingStatistics() const override;
         //! @}
 
         //! AZ::Component overrides ...
@@ -49,5 +58,9 @@ namespace RecastNavigation
         AZ::EntityId m_navQueryEntityId;
         //! Distance to use when finding nearest point on the navigation mesh when points provided to FindPath are outside of the navigation mesh.
         float m_nearestDistance = 3.f;
+
+        //! Asynchronous path requests made through this component that haven't been answered yet,
+        //! and the navigation mesh entity that each of them was submitted to. They are cancelled on deactivation.
+        AZStd::unordered_map<PathRequestId, AZ::EntityId> m_pendingPathRequests;
     };
 } // namespace RecastNavigation
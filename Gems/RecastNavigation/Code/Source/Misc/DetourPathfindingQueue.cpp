@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Misc/DetourPathfindingQueue.h>
+#include <RecastNavigation/RecastHelpers.h>
+
+AZ_DECLARE_BUDGET(Navigation);
+
+namespace RecastNavigation
+{
+    namespace
+    {
+        //! Shared by every queue, so that an agent can tell its requests apart even after switching navigation meshes.
+        AZStd::atomic<PathRequestId> s_nextRequestId{ InvalidPathRequestId + 1 };
+    }
+
+    size_t DetourPathfindingQueue::SearchKeyHash::operator()(const SearchKey& key) const
+    {
+        size_t seed = 0;
+        for (AZ::s32 value : key)
+        {
+            AZStd::hash_combine(seed, value);
+        }
+        return seed;
+    }
+
+    DetourPathfindingQueue::DetourPathfindingQueue(AZ::u32 threadCount)
+        : m_taskExecutor(AZStd::max(threadCount, 1u))
+    {
+        m_queryPool.resize(AZStd::max(threadCount, 1u));
+        for (RecastPointer<dtNavMeshQuery>& query : m_queryPool)
+        {
+            query.reset(dtAllocNavMeshQuery());
+        }
+    }
+
+    DetourPathfindingQueue::~DetourPathfindingQueue()
+    {
+        Clear();
+    }
+
+    PathRequestId DetourPathfindingQueue::AddRequest(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition,
+        float nearestDistance, PathRequestPriority priority, PathRequestCallback callback)
+    {
+        const PathRequestId requestId = s_nextRequestId++;
+        m_requests.emplace(requestId, PathRequest{ AZStd::move(callback), AZStd::chrono::steady_clock::now() });
+        ++m_statistics.m_requestsMade;
+
+        const SearchKey key = MakeSearchKey(fromWorldPosition, toWorldPosition, nearestDistance);
+        if (auto existing = m_searches.find(key); existing != m_searches.end())
+        {
+            // An identical request is still waiting for its path, so this one gets the same path.
+            existing->second->m_requestIds.push_back(requestId);
+            ++m_statistics.m_requestsMerged;
+            return requestId;
+        }
+
+        auto search = AZStd::make_shared<PathSearch>();
+        search->m_key = key;
+        search->m_from = fromWorldPosition;
+        search->m_to = toWorldPosition;
+        search->m_nearestDistance = nearestDistance;
+        search->m_priority = priority;
+        search->m_requestIds.push_back(requestId);
+
+        m_searches.emplace(key, search);
+        m_queues[static_cast<size_t>(priority)].push_back(AZStd::move(search));
+        return requestId;
+    }
+
+    void DetourPathfindingQueue::CancelRequest(PathRequestId requestId)
+    {
+        // The search itself is skipped or ignored later on, once none of its requests are left.
+        if (m_requests.erase(requestId) > 0)
+        {
+            ++m_statistics.m_requestsCancelled;
+        }
+    }
+
+    void DetourPathfindingQueue::Clear()
+    {
+        if (m_taskGraphEvent)
+        {
+            m_taskGraphEvent->Wait();
+            m_taskGraphEvent.reset();
+        }
+
+        m_statistics.m_requestsCancelled += m_requests.size();
+        m_requests.clear();
+        m_searches.clear();
+        m_batch.clear();
+        m_batchNavMeshQuery.reset();
+        for (auto& queue : m_queues)
+        {
+            queue.clear();
+        }
+    }
+
+    void DetourPathfindingQueue::Update(const AZStd::shared_ptr<NavMeshQuery>& navMeshQuery, float budgetMs)
+    {
+        if (m_taskGraphEvent)
+        {
+            if (!m_taskGraphEvent->IsSignaled())
+            {
+                // The workers are still busy with the last batch.
+                return;
+            }
+
+            m_taskGraphEvent.reset();
+            FinishBatch();
+        }
+
+        StartBatch(navMeshQuery, budgetMs);
+    }
+
+    bool DetourPathfindingQueue::HasPendingRequests() const
+    {
+        return !m_requests.empty();
+    }
+
+    PathfindingStatistics DetourPathfindingQueue::GetStatistics() const
+    {
+        PathfindingStatistics statistics = m_statistics;
+        statistics.m_pathSearches = m_pathSearches;
+        statistics.m_pendingRequests = m_requests.size();
+        return statistics;
+    }
+
+    AZStd::vector<AZ::Vector3> DetourPathfindingQueue::FindPath(const dtNavMeshQuery& query, const AZ::Vector3& fromWorldPosition,
+        const AZ::Vector3& toWorldPosition, float nearestDistance)
+    {
+        RecastVector3 startRecast = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
+        RecastVector3 endRecast = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
+        const float halfExtents[3] = { nearestDistance, nearestDistance, nearestDistance };
+
+        dtPolyRef startPoly = 0, endPoly = 0;
+
+        RecastVector3 nearestStartPoint, nearestEndPoint;
+
+        const dtQueryFilter filter;
+
+        // Find nearest points on the navigation mesh given the positions provided.
+        // We are allowing some flexibility where looking for a point just a bit outside of the navigation mesh would still work.
+        dtStatus result = query.findNearestPoly(startRecast.GetData(), halfExtents, &filter, &startPoly, nearestStartPoint.GetData());
+        if (dtStatusFailed(result) || startPoly == 0)
+        {
+            return {};
+        }
+
+        result = query.findNearestPoly(endRecast.GetData(), halfExtents, &filter, &endPoly, nearestEndPoint.GetData());
+        if (dtStatusFailed(result) || endPoly == 0)
+        {
+            return {};
+        }
+
+        // Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
+        constexpr int MaxPathLength = 100;
+
+        AZStd::array<dtPolyRef, MaxPathLength> path;
+        int pathLength = 0;
+
+        // Find an approximate path first. In Recast, an approximate path is a collection of polygons, where a polygon covers an area.
+        result = query.findPath(startPoly, endPoly, nearestStartPoint.GetData(), nearestEndPoint.GetData(),
+            &filter, path.data(), &pathLength, MaxPathLength);
+        if (dtStatusFailed(result))
+        {
+            return {};
+        }
+
+        AZStd::array<RecastVector3, MaxPathLength> detailedPath;
+        AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
+        AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
+        int detailedPathCount = 0;
+
+        // Then the detailed path. This gives us actual specific waypoints along the path over the polygons found earlier.
+        result = query.findStraightPath(startRecast.GetData(), endRecast.GetData(), path.data(), pathLength,
+            detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
+            &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
+        if (dtStatusFailed(result))
+        {
+            return {};
+        }
+
+        AZStd::vector<AZ::Vector3> pathPoints;
+        pathPoints.reserve(detailedPathCount);
+        // Note: Recast uses +Y, O3DE used +Z as up vectors.
+        for (int i = 0; i < detailedPathCount; ++i)
+        {
+            pathPoints.push_back(detailedPath[i].AsVector3WithZup());
+        }
+
+        return pathPoints;
+    }
+
+    DetourPathfindingQueue::SearchKey DetourPathfindingQueue::MakeSearchKey(
+        const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, float nearestDistance)
+    {
+        constexpr float InversePrecision = 1.f / MergePrecision;
+        return SearchKey{
+            aznumeric_cast<AZ::s32>(AZStd::round(fromWorldPosition.GetX() * InversePrecision)),
+            aznumeric_cast<AZ::s32>(AZStd::round(fromWorldPosition.GetY() * InversePrecision)),
+            aznumeric_cast<AZ::s32>(AZStd::round(fromWorldPosition.GetZ() * InversePrecision)),
+            aznumeric_cast<AZ::s32>(AZStd::round(toWorldPosition.GetX() * InversePrecision)),
+            aznumeric_cast<AZ::s32>(AZStd::round(toWorldPosition.GetY() * InversePrecision)),
+            aznumeric_cast<AZ::s32>(AZStd::round(toWorldPosition.GetZ() * InversePrecision)),
+            aznumeric_cast<AZ::s32>(AZStd::round(nearestDistance * InversePrecision))
+        };
+    }
+
+    bool DetourPathfindingQueue::IsSearchNeeded(const PathSearch& search) const
+    {
+        for (PathRequestId requestId : search.m_requestIds)
+        {
+            if (m_requests.find(requestId) != m_requests.end())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void DetourPathfindingQueue::CompleteSearch(const PathSearch& search)
+    {
+        // Take the search out first, so that callbacks that make new requests don't get merged into a finished search.
+        m_searches.erase(search.m_key);
+
+        const auto now = AZStd::chrono::steady_clock::now();
+        for (PathRequestId requestId : search.m_requestIds)
+        {
+            auto request = m_requests.find(requestId);
+            if (request == m_requests.end())
+            {
+                // Cancelled.
+                continue;
+            }
+
+            PathRequestCallback callback = AZStd::move(request->second.m_callback);
+            const float latencyMs = AZStd::chrono::duration<float, AZStd::milli>(now - request->second.m_requestTime).count();
+            m_requests.erase(request);
+
+            ++m_statistics.m_requestsCompleted;
+            m_totalLatencyMs += latencyMs;
+            m_statistics.m_averageLatencyMs = aznumeric_cast<float>(m_totalLatencyMs / m_statistics.m_requestsCompleted);
+            m_statistics.m_maxLatencyMs = AZStd::max(m_statistics.m_maxLatencyMs, latencyMs);
+
+            if (callback)
+            {
+                callback(requestId, search.m_waypoints);
+            }
+        }
+    }
+
+    void DetourPathfindingQueue::FinishBatch()
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: DetourPathfindingQueue::FinishBatch");
+
+        AZStd::vector<AZStd::shared_ptr<PathSearch>> batch;
+        batch.swap(m_batch);
+        m_batchNavMeshQuery.reset();
+
+        // Searches that ran out of time go back to the front of their queues, in the order they were originally requested.
+        for (auto search = batch.rbegin(); search != batch.rend(); ++search)
+        {
+            if (!(*search)->m_searched)
+            {
+                m_queues[static_cast<size_t>((*search)->m_priority)].push_front(*search);
+            }
+        }
+
+        for (const AZStd::shared_ptr<PathSearch>& search : batch)
+        {
+            if (search->m_searched)
+            {
+                CompleteSearch(*search);
+            }
+        }
+    }
+
+    void DetourPathfindingQueue::StartBatch(const AZStd::shared_ptr<NavMeshQuery>& navMeshQuery, float budgetMs)
+    {
+        // Take the pending searches with the highest priority first, skipping any whose requests have all been cancelled.
+        for (auto queue = m_queues.rbegin(); queue != m_queues.rend() && m_batch.size() < MaxSearchesPerBatch; ++queue)
+        {
+            while (!queue->empty() && m_batch.size() < MaxSearchesPerBatch)
+            {
+                AZStd::shared_ptr<PathSearch> search = AZStd::move(queue->front());
+                queue->pop_front();
+
+                if (IsSearchNeeded(*search))
+                {
+                    m_batch.push_back(AZStd::move(search));
+                }
+                else
+                {
+                    m_searches.erase(search->m_key);
+                }
+            }
+        }
+
+        if (m_batch.empty())
+        {
+            return;
+        }
+
+        if (!navMeshQuery)
+        {
+            // Without a navigation mesh there is no path to find, same as with FindPathBetweenPositions.
+            for (const AZStd::shared_ptr<PathSearch>& search : m_batch)
+            {
+                search->m_searched = true;
+            }
+            FinishBatch();
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: DetourPathfindingQueue::StartBatch");
+
+        m_batchNavMeshQuery = navMeshQuery;
+        m_nextBatchIndex = 0;
+
+        const auto deadline = AZStd::chrono::steady_clock::now() +
+            AZStd::chrono::microseconds(aznumeric_cast<AZ::s64>(budgetMs * 1000.f));
+        const size_t workerCount = AZStd::min(m_queryPool.size(), m_batch.size());
+
+        m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation Path Finding Wait");
+        m_taskGraph.Reset();
+
+        for (size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+        {
+            m_taskGraph.AddTask(
+                m_taskDescriptor, [this, workerIndex, deadline]()
+                {
+                    SearchBatch(workerIndex, *m_batchNavMeshQuery, deadline);
+                });
+        }
+
+        m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
+    }
+
+    void DetourPathfindingQueue::SearchBatch(size_t workerIndex, NavMeshQuery& navMeshQuery,
+        AZStd::chrono::steady_clock::time_point deadline)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: task - finding paths");
+
+        // Only read access is needed, so the other workers can search at the same time.
+        // The budget keeps the lock from blocking navigation mesh updates for too long.
+        NavMeshQuery::ReadLockGuard lock(navMeshQuery);
+        if (!lock.GetNavMesh())
+        {
+            return;
+        }
+
+        dtNavMeshQuery* query = m_queryPool[workerIndex].get();
+        if (dtStatusFailed(query->init(lock.GetNavMesh(), MaxQueryNodes)))
+        {
+            return;
+        }
+
+        // Every worker finds at least one path, so that a small budget can't stop the queue from making progress.
+        for (size_t searchCount = 0; searchCount == 0 || AZStd::chrono::steady_clock::now() < deadline; ++searchCount)
+        {
+            const size_t index = m_nextBatchIndex++;
+            if (index >= m_batch.size())
+            {
+                break;
+            }
+
+            PathSearch& search = *m_batch[index];
+            search.m_waypoints = FindPath(*query, search.m_from, search.m_to, search.m_nearestDistance);
+            search.m_searched = true;
+            ++m_pathSearches;
+        }
+    }
+} // namespace RecastNavigation
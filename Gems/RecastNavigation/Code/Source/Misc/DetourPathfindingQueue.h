@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <DetourNavMeshQuery.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <RecastNavigation/DetourNavigationBus.h>
+#include <RecastNavigation/NavMeshQuery.h>
+
+namespace RecastNavigation
+{
+    //! Finds paths for asynchronous path requests in batches on worker threads.
+    //! Each worker has its own dtNavMeshQuery, so paths are searched in parallel while holding a read lock on the navigation mesh.
+    //! Requests are searched in priority order, and requests with the same start and end positions share a single search.
+    //! A navigation mesh owns one queue that every agent using it submits to, so requests from different agents are batched
+    //! and merged together.
+    //! The main thread drives the queue with Update(), which calls the callbacks of finished requests and starts the next batch.
+    //! All of the public methods need to be called from the main thread.
+    class DetourPathfindingQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(DetourPathfindingQueue, AZ::SystemAllocator, 0);
+
+        //! The most path searches to start in a single batch.
+        static constexpr size_t MaxSearchesPerBatch = 256;
+
+        //! The maximum number of search nodes for each worker's query object.
+        static constexpr int MaxQueryNodes = 2048;
+
+        //! Positions are rounded to this size (in meters) when looking for identical requests to merge.
+        static constexpr float MergePrecision = 0.01f;
+
+        //! @param threadCount the number of worker threads to search with.
+        explicit DetourPathfindingQueue(AZ::u32 threadCount);
+        ~DetourPathfindingQueue();
+
+        //! Adds a path request to the queue.
+        //! @param nearestDistance distance to use when finding the nearest point on the navigation mesh.
+        //! @return the id of the new request. Ids are unique across every queue.
+        PathRequestId AddRequest(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, float nearestDistance,
+            PathRequestPriority priority, PathRequestCallback callback);
+
+        //! Removes a request from the queue without calling its callback.
+        void CancelRequest(PathRequestId requestId);
+
+        //! Removes every request without calling their callbacks, and waits for the batch in progress to finish.
+        void Clear();
+
+        //! Calls the callbacks of the requests from the last batch and starts searching for the next batch of requests.
+        //! @param navMeshQuery the navigation mesh to search. If there isn't one, every pending request gets an empty path.
+        //! @param budgetMs time in milliseconds that a batch can search for before the remaining requests are left for the next batch.
+        void Update(const AZStd::shared_ptr<NavMeshQuery>& navMeshQuery, float budgetMs);
+
+        //! @return true if there are requests that haven't had their callback called yet.
+        bool HasPendingRequests() const;
+
+        PathfindingStatistics GetStatistics() const;
+
+        //! Blocking path search using the given query object.
+        //! The caller needs to hold a lock on the navigation mesh that the query object was initialized with.
+        //! @return the waypoints of the path, or an empty vector if a path was not found.
+        static AZStd::vector<AZ::Vector3> FindPath(const dtNavMeshQuery& query, const AZ::Vector3& fromWorldPosition,
+            const AZ::Vector3& toWorldPosition, float nearestDistance);
+
+    private:
+        //! Start and end positions and the nearest distance, rounded to @MergePrecision.
+        using SearchKey = AZStd::array<AZ::s32, 7>;
+
+        struct SearchKeyHash
+        {
+            size_t operator()(const SearchKey& key) const;
+        };
+
+        //! A single path search, shared by every request with the same start and end positions.
+        struct PathSearch
+        {
+            SearchKey m_key;
+            AZ::Vector3 m_from;
+            AZ::Vector3 m_to;
+            float m_nearestDistance = 0.f;
+            PathRequestPriority m_priority = PathRequestPriority::Normal;
+
+            //! Requests waiting for this search, including any that have been cancelled since.
+            AZStd::vector<PathRequestId> m_requestIds;
+
+            //! Written by the worker that searched for the path.
+            AZStd::vector<AZ::Vector3> m_waypoints;
+            bool m_searched = false;
+        };
+
+        struct PathRequest
+        {
+            PathRequestCallback m_callback;
+            AZStd::chrono::steady_clock::time_point m_requestTime;
+        };
+
+        static SearchKey MakeSearchKey(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, float nearestDistance);
+
+        //! @return true if any of the requests waiting for the search haven't been cancelled.
+        bool IsSearchNeeded(const PathSearch& search) const;
+
+        //! Calls the callbacks of the requests waiting for a search, and removes the search.
+        void CompleteSearch(const PathSearch& search);
+
+        //! Deals with the batch that the workers just finished: completes the searches that were done, and puts the others
+        //! back at the front of their queues.
+        void FinishBatch();
+
+        void StartBatch(const AZStd::shared_ptr<NavMeshQuery>& navMeshQuery, float budgetMs);
+
+        //! Worker loop that searches for paths from the current batch until the batch is done or the deadline passes.
+        void SearchBatch(size_t workerIndex, NavMeshQuery& navMeshQuery, AZStd::chrono::steady_clock::time_point deadline);
+
+        //! Pending searches for each priority, in the order they were requested.
+        AZStd::array<AZStd::deque<AZStd::shared_ptr<PathSearch>>, 3> m_queues;
+
+        //! Every search that hasn't been completed yet, including the ones in the current batch.
+        AZStd::unordered_map<SearchKey, AZStd::shared_ptr<PathSearch>, SearchKeyHash> m_searches;
+
+        AZStd::unordered_map<PathRequestId, PathRequest> m_requests;
+
+        //! The searches that the workers are currently working on.
+        AZStd::vector<AZStd::shared_ptr<PathSearch>> m_batch;
+        AZStd::atomic<size_t> m_nextBatchIndex{ 0 };
+
+        //! One query object for each worker, since a query object can only be used by one thread at a time.
+        AZStd::vector<RecastPointer<dtNavMeshQuery>> m_queryPool;
+
+        AZ::TaskGraph m_taskGraph{ "RecastNavigation Path Finding" };
+        AZ::TaskExecutor m_taskExecutor;
+        AZ::TaskDescriptor m_taskDescriptor{ "Finding Paths", "Recast Navigation" };
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
+
+        //! Keeps the navigation mesh of the current batch alive until the batch is done.
+        AZStd::shared_ptr<NavMeshQuery> m_batchNavMeshQuery;
+
+        PathfindingStatistics m_statistics;
+        AZStd::atomic<AZ::u64> m_pathSearches{ 0 };
+        double m_totalLatencyMs = 0.0;
+    };
+} // namespace RecastNavigation
@@ -29,9 +29,26 @@ AZ_CVAR(
 AZ_CVAR(
     AZ::u32, bg_navmesh_threads, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
     "Number of threads to use to process tiles for each RecastNavigationMeshComponentController");
+AZ_CVAR(
+    bool, bg_navmesh_updateDirtyTiles, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "If enabled, navigation mesh tiles are rebuilt when the navigation provider reports that the geometry under them changed");
+AZ_CVAR(
+    AZ::u32, bg_navmesh_dirtyTilesDelayMs, 100, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Delay in milliseconds before rebuilding dirty navigation mesh tiles, so that changes close together are built in a single update");
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathfindingThreads, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of threads each navigation mesh uses to find paths for the asynchronous path requests of every agent on it");
+AZ_CVAR(
+    float, bg_navmesh_pathfindingBudgetMs, 2.f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Time in milliseconds that a batch of asynchronous path searches can take before the remaining requests are left for the next batch");
 
 namespace RecastNavigation
 {
+    AZ::u64 MakeNavigationTileKey(int tileX, int tileY)
+    {
+        return (static_cast<AZ::u64>(static_cast<AZ::u32>(tileX)) << 32) | static_cast<AZ::u64>(static_cast<AZ::u32>(tileY));
+    }
+
     void RecastNavigationMeshComponentController::Reflect(AZ::ReflectContext* context)
     {
         RecastNavigationMeshConfig::Reflect(context);
@@ -79,52 +96,82 @@ namespace RecastNavigation
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
 
-        {
-            for (AZStd::shared_ptr<TileGeometry>& tile : tiles)
-            {
-                {
-                    NavMeshQuery::LockGuard lock(*m_navObject);
-                    // If a tile at the location already exists, remove it before updating the data.
-                    if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                    {
-                        lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                    }
-                }
+        RemoveUnchangedTiles(tiles);
+        BuildTilesBlockUntilCompleted(tiles);
 
-                if (tile->IsEmpty())
-                {
-                    continue;
-                }
+        RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
+        OnUpdateFinished();
+        return true;
+    }
 
-                // Given geometry create Recast tile structure.
-                NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
-                    m_configuration, m_context.get());
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
+    {
+        bool notInProgress = false;
+        if (m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        {
+            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync");
 
-                // A tile might have no geometry at all if no objects were found there.
-                if (navigationTileData.IsValid())
+            bool operationScheduled = false;
+            RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
+                &RecastNavigationProviderRequests::CollectGeometryAsync,
+                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
+                [this](AZStd::shared_ptr<TileGeometry> tile)
                 {
-                    AttachNavigationTileToMesh(navigationTileData);
-                }
+                    OnTileProcessedEvent(tile);
+                });
+
+            if (!operationScheduled)
+            {
+                m_updateInProgress = false;
+                return false;
             }
+            return true;
         }
 
+        return false;
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshRegionBlockUntilCompleted(const AZ::Aabb& region)
+    {
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        {
+            return false;
+        }
+
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshRegionBlockUntilCompleted");
+
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
+
+        // Blocking call.
+        RecastNavigationProviderRequestBus::EventResult(tiles, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderRequests::CollectGeometryWithinRegion,
+            m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize, region);
+
+        RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
+
+        RemoveUnchangedTiles(tiles);
+        BuildTilesBlockUntilCompleted(tiles);
+
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
-        m_updateInProgress = false;
+        OnUpdateFinished();
         return true;
     }
 
-    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshRegionAsync(const AZ::Aabb& region)
     {
         bool notInProgress = false;
         if (m_updateInProgress.compare_exchange_strong(notInProgress, true))
         {
-            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync");
+            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshRegionAsync");
 
             bool operationScheduled = false;
             RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
-                &RecastNavigationProviderRequests::CollectGeometryAsync,
-                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
+                &RecastNavigationProviderRequests::CollectGeometryWithinRegionAsync,
+                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize, region,
                 [this](AZStd::shared_ptr<TileGeometry> tile)
                 {
                     OnTileProcessedEvent(tile);
@@ -146,6 +193,150 @@ namespace RecastNavigation
         return m_navObject;
     }
 
+    PathRequestId RecastNavigationMeshComponentController::FindPathAsync(const AZ::Vector3& fromWorldPosition,
+        const AZ::Vector3& toWorldPosition, float nearestDistance, PathRequestPriority priority, PathRequestCallback callback)
+    {
+        if (!m_pathfindingQueue)
+        {
+            m_pathfindingQueue = AZStd::make_unique<DetourPathfindingQueue>(bg_navmesh_pathfindingThreads);
+        }
+
+        const PathRequestId requestId =
+            m_pathfindingQueue->AddRequest(fromWorldPosition, toWorldPosition, nearestDistance, priority, AZStd::move(callback));
+        if (!m_pathfindingEvent.IsScheduled())
+        {
+            m_pathfindingEvent.Enqueue(AZ::TimeMs{ 0 }, true);
+        }
+        return requestId;
+    }
+
+    void RecastNavigationMeshComponentController::CancelPathRequest(PathRequestId requestId)
+    {
+        if (m_pathfindingQueue)
+        {
+            m_pathfindingQueue->CancelRequest(requestId);
+        }
+    }
+
+    PathfindingStatistics RecastNavigationMeshComponentController::GetPathfindingStatistics() const
+    {
+        return m_pathfindingQueue ? m_pathfindingQueue->GetStatistics() : PathfindingStatistics{};
+    }
+
+    void RecastNavigationMeshComponentController::OnPathfindingTick()
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: OnPathfindingTick");
+
+        m_pathfindingQueue->Update(m_navObject, bg_navmesh_pathfindingBudgetMs);
+
+        if (!m_pathfindingQueue->HasPendingRequests())
+        {
+            m_pathfindingEvent.RemoveFromQueue();
+        }
+    }
+
+    void RecastNavigationMeshComponentController::OnNavigationGeometryChanged(const AZ::Aabb& dirtyRegion)
+    {
+        if (!bg_navmesh_updateDirtyTiles)
+        {
+            return;
+        }
+
+        m_dirtyRegion.AddAabb(dirtyRegion);
+        if (!m_dirtyTilesEvent.IsScheduled())
+        {
+            m_dirtyTilesEvent.Enqueue(AZ::TimeMs{ aznumeric_cast<int>(bg_navmesh_dirtyTilesDelayMs) });
+        }
+    }
+
+    void RecastNavigationMeshComponentController::OnUpdateDirtyTiles()
+    {
+        if (!m_dirtyRegion.IsValid())
+        {
+            return;
+        }
+
+        if (!m_hasNavigationData)
+        {
+            // The whole navigation mesh hasn't been built yet, and building it will pick up the changes.
+            m_dirtyRegion = AZ::Aabb::CreateNull();
+            return;
+        }
+
+        if (UpdateNavigationMeshRegionAsync(m_dirtyRegion))
+        {
+            m_dirtyRegion = AZ::Aabb::CreateNull();
+        }
+        else if (!m_updateInProgress)
+        {
+            // The provider is busy with another request, try again later.
+            m_dirtyTilesEvent.Enqueue(AZ::TimeMs{ aznumeric_cast<int>(bg_navmesh_dirtyTilesDelayMs) });
+        }
+        // Otherwise the dirty tiles are updated once the update in progress finishes.
+    }
+
+    void RecastNavigationMeshComponentController::OnUpdateFinished()
+    {
+        m_hasNavigationData = true;
+        m_updateInProgress = false;
+
+        if (m_dirtyRegion.IsValid() && !m_dirtyTilesEvent.IsScheduled())
+        {
+            m_dirtyTilesEvent.Enqueue(AZ::TimeMs{ aznumeric_cast<int>(bg_navmesh_dirtyTilesDelayMs) });
+        }
+    }
+
+    void RecastNavigationMeshComponentController::RemoveUnchangedTiles(AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tiles)
+    {
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> changedTiles;
+        changedTiles.reserve(tiles.size());
+
+        for (AZStd::shared_ptr<TileGeometry>& tile : tiles)
+        {
+            AZStd::weak_ptr<TileGeometry>& builtGeometry = m_builtTileGeometry[MakeNavigationTileKey(tile->m_tileX, tile->m_tileY)];
+            if (builtGeometry.lock() != tile)
+            {
+                builtGeometry = tile;
+                changedTiles.push_back(AZStd::move(tile));
+            }
+        }
+
+        tiles.swap(changedTiles);
+    }
+
+    void RecastNavigationMeshComponentController::BuildTilesBlockUntilCompleted(const AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tiles)
+    {
+        if (tiles.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: BuildTilesBlockUntilCompleted");
+
+        AZ::TaskGraph taskGraph{ "RecastNavigation Blocking Tile Processing" };
+        for (const AZStd::shared_ptr<TileGeometry>& tile : tiles)
+        {
+            taskGraph.AddTask(
+                m_taskDescriptor, [this, tile]()
+                {
+                    AZ_PROFILE_SCOPE(Navigation, "Navigation: task - computing tile");
+
+                    // A tile might have no geometry at all if no objects were found there, in which case the old tile is removed.
+                    NavigationTileData navigationTileData;
+                    if (!tile->IsEmpty())
+                    {
+                        navigationTileData = CreateNavigationTile(tile.get(), m_configuration, m_context.get());
+                    }
+
+                    ReplaceNavigationTile(tile->m_tileX, tile->m_tileY, navigationTileData);
+                });
+        }
+
+        AZ::TaskGraphEvent finishedEvent{ "RecastNavigation Blocking Tile Processing Wait" };
+        taskGraph.SubmitOnExecutor(m_taskExecutor, &finishedEvent);
+        finishedEvent.Wait();
+    }
+
     void RecastNavigationMeshComponentController::Activate(const AZ::EntityComponentIdPair& entityComponentIdPair)
     {
         m_entityComponentIdPair = entityComponentIdPair;
@@ -161,12 +352,17 @@ namespace RecastNavigation
         }
 
         RecastNavigationMeshRequestBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
+        RecastNavigationProviderNotificationBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
         m_shouldProcessTiles = true;
     }
 
     void RecastNavigationMeshComponentController::Deactivate()
     {
         m_tickEvent.RemoveFromQueue();
+        m_dirtyTilesEvent.RemoveFromQueue();
+        m_pathfindingEvent.RemoveFromQueue();
+        m_dirtyRegion = AZ::Aabb::CreateNull();
+        RecastNavigationProviderNotificationBus::Handler::BusDisconnect();
 
         if (m_updateInProgress)
         {
@@ -178,6 +374,9 @@ namespace RecastNavigation
             }
         }
 
+        // Waits for the batch in progress, which holds on to the navigation mesh.
+        m_pathfindingQueue.reset();
+
         m_context.reset();
         m_navObject.reset();
         m_taskGraphEvent.reset();
@@ -202,7 +401,7 @@ namespace RecastNavigation
         {
             RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
                 &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
-            m_updateInProgress = false;
+            OnUpdateFinished();
         }
     }
 
@@ -368,6 +567,8 @@ namespace RecastNavigation
 
         m_shouldProcessTiles = false;
         m_updateInProgress = false;
+        m_hasNavigationData = false;
+        m_builtTileGeometry.clear();
 
         return true;
     }
@@ -391,6 +592,27 @@ namespace RecastNavigation
         return true;
     }
 
+    bool RecastNavigationMeshComponentController::ReplaceNavigationTile(int tileX, int tileY, NavigationTileData& navigationTileData)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: replaceTile");
+
+        NavMeshQuery::LockGuard lock(*m_navObject);
+
+        // If a tile at the location already exists, remove it before adding the new data.
+        if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tileX, tileY, 0))
+        {
+            lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
+        }
+
+        if (!navigationTileData.IsValid())
+        {
+            return true;
+        }
+
+        // The lock is recursive, so the new tile is attached before any path query can see the tile missing.
+        return AttachNavigationTileToMesh(navigationTileData);
+    }
+
     void RecastNavigationMeshComponentController::ReceivedAllNewTilesImpl(const RecastNavigationMeshConfig& config, AZ::ScheduledEvent& sendNotificationEvent)
     {
         if (m_shouldProcessTiles && (!m_taskGraphEvent || m_taskGraphEvent->IsSignaled()))
@@ -408,6 +630,8 @@ namespace RecastNavigation
                 m_tilesToBeProcessed.swap(tilesToBeProcessed);
             }
 
+            RemoveUnchangedTiles(tilesToBeProcessed);
+
             // Create tasks for each tile and a finish task.
             for (AZStd::shared_ptr<TileGeometry> tile : tilesToBeProcessed)
             {
@@ -424,23 +648,8 @@ namespace RecastNavigation
                         NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
                             config, m_context.get());
 
-                        {
-                            NavMeshQuery::LockGuard lock(*m_navObject);
-                            if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                            {
-                                lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                            }
-                        }
-
-                        if (navigationTileData.IsValid())
-                        {
-                            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync - tile callback");
-
-                            if (navigationTileData.IsValid())
-                            {
-                                AttachNavigationTileToMesh(navigationTileData);
-                            }
-                        }
+                        AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync - tile callback");
+                        ReplaceNavigationTile(tile->m_tileX, tile->m_tileY, navigationTileData);
                     });
 
                 tileTaskTokens.push_back(AZStd::move(token));
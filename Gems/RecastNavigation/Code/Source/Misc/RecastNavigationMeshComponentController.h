@@ -15,10 +15,14 @@
 #include <AzCore/Task/TaskDescriptor.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
 #include <RecastNavigation/RecastHelpers.h>
+#include <Misc/DetourPathfindingQueue.h>
 #include <Misc/RecastNavigationDebugDraw.h>
 #include <Misc/RecastNavigationMeshConfig.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
+#include <RecastNavigation/RecastNavigationProviderBus.h>
 
 namespace RecastNavigation
 {
@@ -26,6 +30,7 @@ namespace RecastNavigation
     //! The method provided are not thread-safe. Use the mutex from @m_navObject to synchronize as necessary at the higher level.
     class RecastNavigationMeshComponentController
         : public RecastNavigationMeshRequestBus::Handler
+        , public RecastNavigationProviderNotificationBus::Handler
     {
         friend class EditorRecastNavigationMeshComponent;
     public:
@@ -56,6 +61,12 @@ namespace RecastNavigation
         //! @return true if successful.
         bool AttachNavigationTileToMesh(NavigationTileData& navigationTileData);
 
+        //! Replaces the tile at (@tileX, @tileY) of the navigation mesh @m_navMesh with new Recast data.
+        //! The old tile is removed and the new one is attached under a single lock, so path queries never see the tile missing.
+        //! @param navigationTileData the raw data of the new Recast tile, or invalid data to only remove the old tile
+        //! @return true if successful.
+        bool ReplaceNavigationTile(int tileX, int tileY, NavigationTileData& navigationTileData);
+
         //! Given a set of geometry and configuration create a Recast tile that can be attached using @AttachNavigationTileToMesh.
         //! @param geom A set of geometry, triangle data.
         //! @param meshConfig Recast navigation mesh configuration.
@@ -72,7 +83,18 @@ namespace RecastNavigation
         //! @{
         bool UpdateNavigationMeshBlockUntilCompleted() override;
         bool UpdateNavigationMeshAsync() override;
+        bool UpdateNavigationMeshRegionBlockUntilCompleted(const AZ::Aabb& region) override;
+        bool UpdateNavigationMeshRegionAsync(const AZ::Aabb& region) override;
         AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() override;
+        PathRequestId FindPathAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, float nearestDistance,
+            PathRequestPriority priority, PathRequestCallback callback) override;
+        void CancelPathRequest(PathRequestId requestId) override;
+        PathfindingStatistics GetPathfindingStatistics() const override;
+        //! @}
+
+        //! RecastNavigationProviderNotificationBus overrides ...
+        //! @{
+        void OnNavigationGeometryChanged(const AZ::Aabb& dirtyRegion) override;
         //! @}
 
     protected:
@@ -102,6 +124,33 @@ namespace RecastNavigation
         AZ::ScheduledEvent m_receivedAllNewTilesEvent{ [this]() { OnReceivedAllNewTiles(); }, AZ::Name("RecastNavigationReceivedTiles") };
 
         void OnTileProcessedEvent(AZStd::shared_ptr<TileGeometry> tile);
+
+        //! Removes the tiles that are the same geometry objects that the navigation mesh was last built from,
+        //! and records the remaining tiles as the ones that the navigation mesh is being built from.
+        void RemoveUnchangedTiles(AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tiles);
+
+        //! Builds tiles in parallel and blocks until all of them are swapped into the navigation mesh.
+        void BuildTilesBlockUntilCompleted(const AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tiles);
+
+        //! Marks the update as finished and schedules an update for any tiles that were invalidated in the meantime.
+        void OnUpdateFinished();
+
+        //! Updates the tiles within @m_dirtyRegion.
+        void OnUpdateDirtyTiles();
+
+        //! Tick event to update the tiles invalidated by geometry changes reported by the navigation provider.
+        AZ::ScheduledEvent m_dirtyTilesEvent{ [this]() { OnUpdateDirtyTiles(); }, AZ::Name("RecastNavigationUpdateDirtyTiles") };
+
+        //! The world space region whose geometry has changed since the navigation mesh was last updated there.
+        AZ::Aabb m_dirtyRegion = AZ::Aabb::CreateNull();
+
+        //! True once the navigation mesh has been updated. Dirty tiles are only updated after that,
+        //! since the whole navigation mesh has to be built first.
+        bool m_hasNavigationData = false;
+
+        //! The geometry that each tile of the navigation mesh was last built from, keyed by tile coordinates.
+        //! Providers return the same geometry object for tiles that haven't changed, so those tiles don't need to be rebuilt.
+        AZStd::unordered_map<AZ::u64, AZStd::weak_ptr<TileGeometry>> m_builtTileGeometry;
     
         //! Debug draw object for Recast navigation mesh.
         RecastNavigationDebugDraw m_customDebugDraw;
@@ -126,5 +175,15 @@ namespace RecastNavigation
 
         //! If true, an update operation is in progress.
         AZStd::atomic<bool> m_updateInProgress{ false };
+
+        //! Calls the callbacks of finished path requests and starts the next batch of path searches.
+        void OnPathfindingTick();
+
+        //! Asynchronous path requests from every path finding component that uses this navigation mesh.
+        //! Created on the first request, so that navigation meshes without asynchronous requests don't start worker threads.
+        AZStd::unique_ptr<DetourPathfindingQueue> m_pathfindingQueue;
+
+        //! Ticks while there are asynchronous path requests that haven't been answered.
+        AZ::ScheduledEvent m_pathfindingEvent{ [this]() { OnPathfindingTick(); }, AZ::Name("RecastNavigationPathfinding") };
     };
 } // namespace RecastNavigation
@@ -8,9 +8,11 @@
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 #include <DebugDraw/DebugDrawBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <Misc/RecastNavigationPhysXProviderComponentController.h>
@@ -78,6 +80,14 @@ namespace RecastNavigation
         m_shouldProcessTiles = true;
         m_updateInProgress = false;
         OnConfigurationChanged();
+
+        if (auto sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(GetSceneName());
+            sceneInterface->RegisterSimulationBodyAddedHandler(sceneHandle, m_bodyAddedHandler);
+            sceneInterface->RegisterSimulationBodyRemovedHandler(sceneHandle, m_bodyRemovedHandler);
+        }
+
         RecastNavigationProviderRequestBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
     }
 
@@ -105,8 +115,14 @@ namespace RecastNavigation
 
         m_updateInProgress = false;
         RecastNavigationProviderRequestBus::Handler::BusDisconnect();
+        m_bodyAddedHandler.Disconnect();
+        m_bodyRemovedHandler.Disconnect();
         // The event is used to detect if tasks are already in progress.
         m_taskGraphEvent.reset();
+
+        AZStd::lock_guard lock(m_tileCacheMutex);
+        m_tileCache.clear();
+        ++m_tileCacheGeneration;
     }
 
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometry(
@@ -124,6 +140,123 @@ namespace RecastNavigation
         return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
     }
 
+    AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryWithinRegion(
+        float tileSize, float borderSize, const AZ::Aabb& region)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometryWithinRegion");
+
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        {
+            return {};
+        }
+
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> tilesToCollect;
+        const AZ::u64 cacheGeneration = GetTilesWithinRegion(tileSize, borderSize, region, tiles, tilesToCollect);
+
+        for (AZStd::shared_ptr<TileGeometry>& tile : tilesToCollect)
+        {
+            CollectTileGeometry(*tile);
+            StoreTileInCache(tile, cacheGeneration);
+            tiles.push_back(tile);
+        }
+
+        m_updateInProgress = false;
+        return tiles;
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryWithinRegionAsync(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& region,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        if (tileSize <= 0.f)
+        {
+            AZ_Warning("Recast Navigation", false, "Tile size is invalid. It should be a positive number.");
+            return false;
+        }
+
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        {
+            return false;
+        }
+
+        if (!m_taskGraphEvent || m_taskGraphEvent->IsSignaled())
+        {
+            AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometryWithinRegionAsync");
+
+            AZStd::vector<AZStd::shared_ptr<TileGeometry>> cachedTiles;
+            AZStd::vector<AZStd::shared_ptr<TileGeometry>> tilesToCollect;
+            const AZ::u64 cacheGeneration = GetTilesWithinRegion(tileSize, borderSize, region, cachedTiles, tilesToCollect);
+
+            // Cached tiles are already complete, so they can be reported right away.
+            for (const AZStd::shared_ptr<TileGeometry>& tile : cachedTiles)
+            {
+                tileCallback(tile);
+            }
+
+            SubmitTileTasks(AZStd::move(tilesToCollect), cacheGeneration, AZStd::move(tileCallback));
+            return true;
+        }
+
+        m_updateInProgress = false;
+        return false;
+    }
+
+    void RecastNavigationPhysXProviderComponentController::InvalidateGeometryWithinRegion(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        float borderSize = 0.f;
+        {
+            AZStd::lock_guard lock(m_tileCacheMutex);
+            for (auto tile = m_tileCache.begin(); tile != m_tileCache.end();)
+            {
+                if (tile->second->m_scanBounds.Overlaps(region))
+                {
+                    tile = m_tileCache.erase(tile);
+                }
+                else
+                {
+                    ++tile;
+                }
+            }
+
+            ++m_tileCacheGeneration;
+            borderSize = m_cachedBorderSize;
+        }
+
+        // Tiles collect geometry from a border around them, so changes just outside of the world bounds still matter.
+        if (region.Overlaps(GetWorldBounds().GetExpanded(AZ::Vector3(borderSize))))
+        {
+            RecastNavigationProviderNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
+                &RecastNavigationProviderNotifications::OnNavigationGeometryChanged, region);
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnSimulatedBodyChanged(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (!sceneInterface)
+        {
+            return;
+        }
+
+        // Only static colliders are used for the navigation mesh, so dynamic rigid bodies don't affect it.
+        AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle);
+        if (body && !azrtti_istypeof<AzPhysics::RigidBody>(body))
+        {
+            InvalidateGeometryWithinRegion(body->GetAabb());
+        }
+    }
+
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
     {
         AZ::Aabb worldBounds = AZ::Aabb::CreateNull();
@@ -290,39 +423,17 @@ namespace RecastNavigation
         const AZ::Vector3& worldMin = worldVolume.GetMin();
         const AZ::Vector3& worldMax = worldVolume.GetMax();
 
-        const AZ::Vector3 border = AZ::Vector3::CreateOne() * borderSize;
+        // A full update collects every tile again, replacing anything that was cached.
+        const AZ::u64 cacheGeneration = PrepareTileCache(tileSize, borderSize, worldMin);
 
         // Find all geometry one tile at a time.
         for (int y = 0; y < tilesAlongY; ++y)
         {
             for (int x = 0; x < tilesAlongX; ++x)
             {
-                const AZ::Vector3 tileMin{
-                    worldMin.GetX() + aznumeric_cast<float>(x) * tileSize,
-                    worldMin.GetY() + aznumeric_cast<float>(y) * tileSize,
-                    worldMin.GetZ()
-                };
-
-                const AZ::Vector3 tileMax{
-                    worldMin.GetX() + aznumeric_cast<float>(x + 1) * tileSize,
-                    worldMin.GetY() + aznumeric_cast<float>(y + 1) * tileSize,
-                    worldMax.GetZ()
-                };
-
-                // Recast wants extra triangle data around each tile, so that each tile can connect to each other.
-                AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
-                AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
-
-                QueryHits results;
-                CollectCollidersWithinVolume(scanVolume, results);
-
-                AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
-                geometryData->m_worldBounds = tileVolume;
-                geometryData->m_scanBounds = scanVolume;
-                AppendColliderGeometry(*geometryData, results);
-
-                geometryData->m_tileX = x;
-                geometryData->m_tileY = y;
+                AZStd::shared_ptr<TileGeometry> geometryData = CreateTile(x, y, worldMin, worldMax.GetZ(), tileSize, borderSize);
+                CollectTileGeometry(*geometryData);
+                StoreTileInCache(geometryData, cacheGeneration);
                 tiles.push_back(geometryData);
             }
         }
@@ -331,27 +442,124 @@ namespace RecastNavigation
         return tiles;
     }
 
-    // Adjust the origin, so that any tile over-extension is even across all sides.
-    // Note, navigation mesh is made up of square tiles. Recast does not support uneven tiles,
-    // so the best we can do is even them out. Additionally, users can set their own tile size on @RecastNavigationMeshComponent.
-    AZ::Vector3 GetAdjustedOriginBasedOnTileSize(const AZ::Aabb& worldVolume, float tileSize)
+    AZStd::shared_ptr<TileGeometry> RecastNavigationPhysXProviderComponentController::CreateTile(
+        int tileX, int tileY, const AZ::Vector3& origin, float maxZ, float tileSize, float borderSize)
     {
-        if (tileSize <= 0.f)
+        const AZ::Vector3 tileMin{
+            origin.GetX() + aznumeric_cast<float>(tileX) * tileSize,
+            origin.GetY() + aznumeric_cast<float>(tileY) * tileSize,
+            origin.GetZ()
+        };
+
+        const AZ::Vector3 tileMax{
+            origin.GetX() + aznumeric_cast<float>(tileX + 1) * tileSize,
+            origin.GetY() + aznumeric_cast<float>(tileY + 1) * tileSize,
+            maxZ
+        };
+
+        // Recast wants extra triangle data around each tile, so that each tile can connect to each other.
+        const AZ::Vector3 border = AZ::Vector3::CreateOne() * borderSize;
+
+        AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_shared<TileGeometry>();
+        geometryData->m_worldBounds = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
+        geometryData->m_scanBounds = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+        geometryData->m_tileX = tileX;
+        geometryData->m_tileY = tileY;
+        return geometryData;
+    }
+
+    void RecastNavigationPhysXProviderComponentController::CollectTileGeometry(TileGeometry& geometry)
+    {
+        QueryHits results;
+        CollectCollidersWithinVolume(geometry.m_scanBounds, results);
+        AppendColliderGeometry(geometry, results);
+    }
+
+    AZ::u64 RecastNavigationPhysXProviderComponentController::MakeTileKey(int tileX, int tileY)
+    {
+        return (static_cast<AZ::u64>(static_cast<AZ::u32>(tileX)) << 32) | static_cast<AZ::u64>(static_cast<AZ::u32>(tileY));
+    }
+
+    AZ::u64 RecastNavigationPhysXProviderComponentController::PrepareTileCache(float tileSize, float borderSize, const AZ::Vector3& origin)
+    {
+        AZStd::lock_guard lock(m_tileCacheMutex);
+        if (tileSize != m_cachedTileSize || borderSize != m_cachedBorderSize || !origin.IsClose(m_cachedOrigin))
+        {
+            m_tileCache.clear();
+            m_cachedTileSize = tileSize;
+            m_cachedBorderSize = borderSize;
+            m_cachedOrigin = origin;
+            ++m_tileCacheGeneration;
+        }
+
+        return m_tileCacheGeneration;
+    }
+
+    void RecastNavigationPhysXProviderComponentController::StoreTileInCache(const AZStd::shared_ptr<TileGeometry>& tile, AZ::u64 generation)
+    {
+        AZStd::lock_guard lock(m_tileCacheMutex);
+        if (generation == m_tileCacheGeneration)
+        {
+            m_tileCache[MakeTileKey(tile->m_tileX, tile->m_tileY)] = tile;
+        }
+    }
+
+    AZ::u64 RecastNavigationPhysXProviderComponentController::GetTilesWithinRegion(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& region,
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>>& cachedTiles,
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tilesToCollect)
+    {
+        const AZ::Aabb worldVolume = GetWorldBounds();
+        if (tileSize <= 0.f || !worldVolume.IsValid() || !region.IsValid())
+        {
+            return 0;
+        }
+
+        // Use the same grid as @CollectGeometryImpl, which matches the origin of the navigation mesh.
+        const AZ::Vector3& worldMin = worldVolume.GetMin();
+        const AZ::Vector3 extents = worldVolume.GetExtents();
+        const int tilesAlongX = aznumeric_cast<int>(AZStd::ceil(extents.GetX() / tileSize));
+        const int tilesAlongY = aznumeric_cast<int>(AZStd::ceil(extents.GetY() / tileSize));
+
+        const AZ::u64 cacheGeneration = PrepareTileCache(tileSize, borderSize, worldMin);
+
+        // Each tile includes geometry from a border around it, so tiles next to the region are affected as well.
+        const AZ::Aabb expandedRegion = region.GetExpanded(AZ::Vector3(borderSize));
+        if (tilesAlongX <= 0 || tilesAlongY <= 0 || !expandedRegion.Overlaps(worldVolume))
         {
-            AZ_Warning("Recast Navigation", true, "Tile size is invalid. It should be a positive number.");
-            return AZ::Vector3::CreateZero();
+            return cacheGeneration;
         }
 
-        AZ::Vector3 origin = worldVolume.GetMin();
-        const AZ::Vector3& extents = worldVolume.GetExtents();
+        auto getTileCoordinate = [tileSize](float value, float originValue, int tileCount)
+        {
+            const int tile = aznumeric_cast<int>(AZStd::floor((value - originValue) / tileSize));
+            return AZStd::clamp(tile, 0, tileCount - 1);
+        };
 
-        const float tileOverExtensionOnX = AZStd::ceil(extents.GetX() / tileSize) * tileSize - extents.GetX();
-        origin.SetX(origin.GetX() - tileOverExtensionOnX / 2.f);
+        const int minTileX = getTileCoordinate(expandedRegion.GetMin().GetX(), worldMin.GetX(), tilesAlongX);
+        const int maxTileX = getTileCoordinate(expandedRegion.GetMax().GetX(), worldMin.GetX(), tilesAlongX);
+        const int minTileY = getTileCoordinate(expandedRegion.GetMin().GetY(), worldMin.GetY(), tilesAlongY);
+        const int maxTileY = getTileCoordinate(expandedRegion.GetMax().GetY(), worldMin.GetY(), tilesAlongY);
 
-        const float tileOverExtensionOnY = AZStd::ceil(extents.GetY() / tileSize) * tileSize - extents.GetY();
-        origin.SetY(origin.GetY() - tileOverExtensionOnY / 2.f);
+        AZStd::lock_guard lock(m_tileCacheMutex);
+        for (int y = minTileY; y <= maxTileY; ++y)
+        {
+            for (int x = minTileX; x <= maxTileX; ++x)
+            {
+                if (auto cachedTile = m_tileCache.find(MakeTileKey(x, y)); cachedTile != m_tileCache.end())
+                {
+                    cachedTiles.push_back(cachedTile->second);
+                }
+                else
+                {
+                    tilesToCollect.push_back(CreateTile(x, y, worldMin, worldVolume.GetMax().GetZ(), tileSize, borderSize));
+                }
+            }
+        }
 
-        return origin;
+        return cacheGeneration;
     }
 
     bool RecastNavigationPhysXProviderComponentController::CollectGeometryAsyncImpl(
@@ -370,85 +578,79 @@ namespace RecastNavigation
         {
             AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometryAsync");
 
-            m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation PhysX Wait");
-            m_taskGraph.Reset();
-
             AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
 
             const AZ::Vector3 extents = worldVolume.GetExtents();
             int tilesAlongX = aznumeric_cast<int>(AZStd::ceil(extents.GetX() / tileSize));
             int tilesAlongY = aznumeric_cast<int>(AZStd::ceil(extents.GetY() / tileSize));
-            
-            const AZ::Vector3 worldOrigin = GetAdjustedOriginBasedOnTileSize(worldVolume, tileSize);
-            const AZ::Vector3 worldMax(
-                worldOrigin.GetX() + tileSize * aznumeric_cast<float>(tilesAlongX),
-                worldOrigin.GetY() + tileSize * aznumeric_cast<float>(tilesAlongY),
-                worldVolume.GetMax().GetZ());
 
-            const AZ::Vector3 border = AZ::Vector3::CreateOne() * borderSize;
+            // Tiles have to be on the same grid as the navigation mesh, whose origin is the minimum of the world bounds
+            // (see RecastNavigationMeshComponentController::CreateNavigationMesh), and as @CollectGeometryImpl and
+            // @GetTilesWithinRegion, so that rebuilt tiles line up with their neighbors and the tile cache stays valid.
+            const AZ::Vector3& worldOrigin = worldVolume.GetMin();
+            const float worldMaxZ = worldVolume.GetMax().GetZ();
 
-            AZStd::vector<AZ::TaskToken> tileTaskTokens;
+            // A full update collects every tile again, replacing anything that was cached.
+            const AZ::u64 cacheGeneration = PrepareTileCache(tileSize, borderSize, worldOrigin);
 
-            // Create tasks for each tile and a finish task.
             for (int y = 0; y < tilesAlongY; ++y)
             {
                 for (int x = 0; x < tilesAlongX; ++x)
                 {
-                    const AZ::Vector3 tileMin{
-                        worldOrigin.GetX() + aznumeric_cast<float>(x) * tileSize,
-                        worldOrigin.GetY() + aznumeric_cast<float>(y) * tileSize,
-                        worldOrigin.GetZ()
-                    };
-
-                    const AZ::Vector3 tileMax{
-                        worldOrigin.GetX() + aznumeric_cast<float>(x + 1) * tileSize,
-                        worldOrigin.GetY() + aznumeric_cast<float>(y + 1) * tileSize,
-                        worldMax.GetZ()
-                    };
-
-                    AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
-                    AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
-                    AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
-                    geometryData->m_tileCallback = tileCallback;
-                    geometryData->m_worldBounds = tileVolume;
-                    geometryData->m_scanBounds = scanVolume;
-                    geometryData->m_tileX = x;
-                    geometryData->m_tileY = y;
-
-                    AZ::TaskToken token = m_taskGraph.AddTask(
-                        m_taskDescriptor, [this, geometryData]()
-                        {
-                            if (m_shouldProcessTiles)
-                            {
-                                AZ_PROFILE_SCOPE(Navigation, "Navigation: collecting geometry for a tile");
-                                QueryHits results;
-                                CollectCollidersWithinVolume(geometryData->m_scanBounds, results);
-                                AppendColliderGeometry(*geometryData, results);
-                                geometryData->m_tileCallback(geometryData);
-                            }
-                        });
-
-                    tileTaskTokens.push_back(AZStd::move(token));
+                    tiles.push_back(CreateTile(x, y, worldOrigin, worldMaxZ, tileSize, borderSize));
                 }
             }
 
-            AZ::TaskToken finishToken = m_taskGraph.AddTask(
-                m_taskDescriptor, [this, tileCallback]()
+            SubmitTileTasks(AZStd::move(tiles), cacheGeneration, AZStd::move(tileCallback));
+            return true;
+        }
+
+        return false;
+    }
+
+    void RecastNavigationPhysXProviderComponentController::SubmitTileTasks(
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles,
+        AZ::u64 cacheGeneration,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation PhysX Wait");
+        m_taskGraph.Reset();
+
+        AZStd::vector<AZ::TaskToken> tileTaskTokens;
+
+        // Create tasks for each tile and a finish task.
+        for (AZStd::shared_ptr<TileGeometry>& geometryData : tiles)
+        {
+            geometryData->m_tileCallback = tileCallback;
+
+            AZ::TaskToken token = m_taskGraph.AddTask(
+                m_taskDescriptor, [this, geometryData, cacheGeneration]()
                 {
-                    tileCallback({}); // Notifies the caller that the operation is done.
-                    m_updateInProgress = false;
+                    if (m_shouldProcessTiles)
+                    {
+                        AZ_PROFILE_SCOPE(Navigation, "Navigation: collecting geometry for a tile");
+                        CollectTileGeometry(*geometryData);
+                        StoreTileInCache(geometryData, cacheGeneration);
+                        geometryData->m_tileCallback(geometryData);
+                    }
                 });
 
-            for (AZ::TaskToken& task : tileTaskTokens)
+            tileTaskTokens.push_back(AZStd::move(token));
+        }
+
+        AZ::TaskToken finishToken = m_taskGraph.AddTask(
+            m_taskDescriptor, [this, tileCallback]()
             {
-                task.Precedes(finishToken);
-            }
+                tileCallback({}); // Notifies the caller that the operation is done.
+                m_updateInProgress = false;
+            });
 
-            AZ_Assert(m_taskGraphEvent->IsSignaled() == false, "RecastNavigationPhysXProviderComponentController might be runtime two async gather operations, which is not supported.");
-            m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
-            return true;
+        for (AZ::TaskToken& task : tileTaskTokens)
+        {
+            task.Precedes(finishToken);
         }
 
-        return false;
+        AZ_Assert(m_taskGraphEvent->IsSignaled() == false, "RecastNavigationPhysXProviderComponentController might be runtime two async gather operations, which is not supported.");
+        m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
     }
 } // namespace RecastNavigation
@@ -11,6 +11,9 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <Misc/RecastNavigationPhysXProviderConfig.h>
@@ -47,10 +50,19 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometry(float tileSize, float borderSize) override;
         bool CollectGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometryWithinRegion(
+            float tileSize, float borderSize, const AZ::Aabb& region) override;
+        bool CollectGeometryWithinRegionAsync(float tileSize, float borderSize, const AZ::Aabb& region,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
         AZ::Aabb GetWorldBounds() const override;
         int GetNumberOfTiles(float tileSize) const override;
         //! @}
 
+        //! Removes the cached geometry of every tile that overlaps a region and notifies listeners
+        //! on @RecastNavigationProviderNotificationBus that the region is out of date.
+        //! @param region the world space region whose geometry changed
+        void InvalidateGeometryWithinRegion(const AZ::Aabb& region);
+
         //! A container of PhysX overlap scene hits (has PhysX colliders and their position/orientation).
         using QueryHits = AZStd::vector<AzPhysics::SceneQueryHit>;
 
@@ -101,6 +113,61 @@ namespace RecastNavigation
     protected:
         void OnConfigurationChanged();
 
+        //! Creates an empty tile with its bounds set for the tile at (@tileX, @tileY) of a grid that starts at @origin.
+        static AZStd::shared_ptr<TileGeometry> CreateTile(
+            int tileX, int tileY, const AZ::Vector3& origin, float maxZ, float tileSize, float borderSize);
+
+        //! Fills a tile with the static PhysX geometry within its scan bounds.
+        void CollectTileGeometry(TileGeometry& geometry);
+
+        //! Finds the tiles of the grid used by @CollectGeometryImpl that overlap a region. Tiles that are still in the cache
+        //! are returned in @cachedTiles, the rest are returned empty in @tilesToCollect.
+        //! @returns the cache generation that @tilesToCollect need to be stored with.
+        AZ::u64 GetTilesWithinRegion(
+            float tileSize,
+            float borderSize,
+            const AZ::Aabb& region,
+            AZStd::vector<AZStd::shared_ptr<TileGeometry>>& cachedTiles,
+            AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tilesToCollect);
+
+        //! Clears the tile cache if it was filled for a different tile grid and returns the current cache generation.
+        AZ::u64 PrepareTileCache(float tileSize, float borderSize, const AZ::Vector3& origin);
+
+        //! Stores a collected tile, unless the cache was invalidated after @generation.
+        void StoreTileInCache(const AZStd::shared_ptr<TileGeometry>& tile, AZ::u64 generation);
+
+        static AZ::u64 MakeTileKey(int tileX, int tileY);
+
+        //! Schedules tasks that collect geometry for each tile and report them via @tileCallback, followed by an empty tile.
+        void SubmitTileTasks(
+            AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles,
+            AZ::u64 cacheGeneration,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
+
+        //! Static colliders being added or removed change the geometry of the tiles that they overlap.
+        void OnSimulatedBodyChanged(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler m_bodyAddedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle);
+            } };
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler m_bodyRemovedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle);
+            } };
+
+        //! Geometry of previously collected tiles, so that tiles that haven't changed don't need to be collected again.
+        AZStd::mutex m_tileCacheMutex;
+        AZStd::unordered_map<AZ::u64, AZStd::shared_ptr<TileGeometry>> m_tileCache;
+        float m_cachedTileSize = 0.f;
+        float m_cachedBorderSize = 0.f;
+        AZ::Vector3 m_cachedOrigin = AZ::Vector3::CreateZero();
+
+        //! Incremented every time cached tiles are removed, so that tiles collected from outdated geometry aren't stored.
+        AZ::u64 m_tileCacheGeneration = 0;
+
         AZ::EntityComponentIdPair m_entityComponentIdPair;
         RecastNavigationPhysXProviderConfig m_config;
 
@@ -47,9 +47,12 @@ namespace RecastNavigationTests
 
         AZ::Aabb GetEncompassingAabb() override
         {
-            return AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne() * 10);
+            return AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne() * m_halfExtent);
         }
 
+        //! Half of the size of the world bounds along each axis.
+        float m_halfExtent = 10.f;
+
         MOCK_METHOD0(GetShapeType, AZ::Crc32());
         MOCK_METHOD2(GetTransformAndLocalBounds, void(AZ::Transform&, AZ::Aabb&));
         MOCK_METHOD1(IsPointInside, bool(const AZ::Vector3&));
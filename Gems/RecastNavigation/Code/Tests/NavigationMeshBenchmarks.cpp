@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <MockInterfaces.h>
+#include <RecastNavigationSystemComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/EBus/EventSchedulerSystemComponent.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Mocks/MockITime.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <Components/RecastNavigationMeshComponent.h>
+#include <Components/RecastNavigationPhysXProviderComponent.h>
+#include <PhysX/MockPhysicsShape.h>
+#include <PhysX/MockSceneInterface.h>
+#include <PhysX/MockSimulatedBody.h>
+#include <benchmark/benchmark.h>
+
+namespace RecastNavigationTests
+{
+    using testing::_;
+    using testing::Invoke;
+    using testing::NiceMock;
+    using testing::Return;
+    using RecastNavigation::RecastNavigationMeshRequestBus;
+    using RecastNavigation::RecastNavigationMeshRequests;
+
+    //! Sets up a navigation mesh over a flat ground plane, with a world size (in meters) given by the first benchmark argument.
+    class NavigationMeshBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_console = AZStd::make_unique<AZ::Console>();
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+
+            m_nameDictionary = AZStd::make_unique<AZ::NameDictionary>();
+            AZ::Interface<AZ::NameDictionary>::Register(m_nameDictionary.get());
+
+            m_sc = AZStd::make_unique<AZ::SerializeContext>();
+            m_bc = AZStd::make_unique<AZ::BehaviorContext>();
+            RegisterComponent<RecastNavigation::RecastNavigationMeshComponent>();
+            RegisterComponent<RecastNavigation::RecastNavigationPhysXProviderComponent>();
+            RegisterComponent<MockShapeComponent>();
+            RegisterComponent<AZ::EventSchedulerSystemComponent>();
+            RegisterComponent<RecastNavigation::RecastNavigationSystemComponent>();
+
+            m_timeSystem = AZStd::make_unique<NiceMock<AZ::MockTimeSystem>>();
+            m_mockSceneInterface = AZStd::make_unique<NiceMock<UnitTest::MockSceneInterface>>();
+            m_mockPhysicsShape = AZStd::make_unique<NiceMock<UnitTest::MockPhysicsShape>>();
+            m_mockSimulatedBody = AZStd::make_unique<NiceMock<UnitTest::MockSimulatedBody>>();
+
+            m_hit.m_resultFlags = AzPhysics::SceneQuery::EntityId;
+            m_hit.m_entityId = AZ::EntityId{ 1 };
+            m_hit.m_shape = m_mockPhysicsShape.get();
+
+            ON_CALL(*m_mockSceneInterface, QueryScene(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, const AzPhysics::SceneQueryRequest* request)
+                {
+                    const AzPhysics::OverlapRequest* overlapRequest = static_cast<const AzPhysics::OverlapRequest*>(request);
+                    overlapRequest->m_unboundedOverlapHitCallback({ m_hit });
+                    return AzPhysics::SceneQueryHits();
+                }));
+            ON_CALL(*m_mockSceneInterface, GetSimulatedBodyFromHandle(_, _)).WillByDefault(Return(m_mockSimulatedBody.get()));
+            ON_CALL(*m_mockSceneInterface, RegisterSimulationBodyRemovedHandler(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler& handler)
+                {
+                    handler.Connect(m_bodyRemovedEvent);
+                }));
+            ON_CALL(*m_mockSimulatedBody, GetOrientation()).WillByDefault(Return(AZ::Quaternion::CreateIdentity()));
+            ON_CALL(*m_mockSimulatedBody, GetPosition()).WillByDefault(Return(AZ::Vector3::CreateZero()));
+
+            // A flat ground plane that covers whatever part of the world is being scanned.
+            ON_CALL(*m_mockPhysicsShape, GetGeometry(_, _, _)).WillByDefault(Invoke([]
+            (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb* bounds)
+                {
+                    const AZ::Vector3& min = bounds->GetMin();
+                    const AZ::Vector3& max = bounds->GetMax();
+                    vertices = {
+                        AZ::Vector3(min.GetX(), min.GetY(), 0.f),
+                        AZ::Vector3(max.GetX(), min.GetY(), 0.f),
+                        AZ::Vector3(max.GetX(), max.GetY(), 0.f),
+                        AZ::Vector3(min.GetX(), max.GetY(), 0.f)
+                    };
+                    indices = { 0, 1, 2, 0, 2, 3 };
+                }));
+
+            m_entity = AZStd::make_unique<AZ::Entity>();
+            m_entity->SetId(AZ::EntityId{ 1 });
+            m_entity->CreateComponent<AZ::EventSchedulerSystemComponent>();
+            m_entity->CreateComponent<RecastNavigation::RecastNavigationSystemComponent>();
+            MockShapeComponent* shape = m_entity->CreateComponent<MockShapeComponent>();
+            shape->m_halfExtent = aznumeric_cast<float>(state.range(0)) / 2.f;
+            m_entity->CreateComponent<RecastNavigation::RecastNavigationPhysXProviderComponent>();
+            m_entity->CreateComponent<RecastNavigation::RecastNavigationMeshComponent>(RecastNavigation::RecastNavigationMeshConfig{});
+            m_entity->Init();
+            m_entity->Activate();
+        }
+
+        void internalTearDown()
+        {
+            m_entity.reset();
+
+            m_mockSimulatedBody.reset();
+            m_mockPhysicsShape.reset();
+            m_mockSceneInterface.reset();
+            m_timeSystem.reset();
+
+            for (AZ::ComponentDescriptor* descriptor : m_descriptors)
+            {
+                delete descriptor;
+            }
+            m_descriptors = {};
+
+            m_sc.reset();
+            m_bc.reset();
+
+            AZ::Interface<AZ::NameDictionary>::Unregister(m_nameDictionary.get());
+            m_nameDictionary.reset();
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+        }
+
+        //! Marks the geometry within a region as changed, as if a static collider there was removed.
+        void InvalidateRegion(const AZ::Aabb& region)
+        {
+            ON_CALL(*m_mockSimulatedBody, GetAabb()).WillByDefault(Return(region));
+            m_bodyRemovedEvent.Signal(AzPhysics::SceneHandle{}, AzPhysics::SimulatedBodyHandle{});
+        }
+
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        template <typename T>
+        void RegisterComponent()
+        {
+            AZ::ComponentDescriptor* item = T::CreateDescriptor();
+            item->Reflect(m_sc.get());
+            item->Reflect(m_bc.get());
+            m_descriptors.push_back(item);
+        }
+
+        AZStd::unique_ptr<AZ::Console> m_console;
+        AZStd::unique_ptr<AZ::NameDictionary> m_nameDictionary;
+        AZStd::unique_ptr<AZ::SerializeContext> m_sc;
+        AZStd::unique_ptr<AZ::BehaviorContext> m_bc;
+        AZStd::vector<AZ::ComponentDescriptor*> m_descriptors;
+        AZStd::unique_ptr<AZ::MockTimeSystem> m_timeSystem;
+        AZStd::unique_ptr<UnitTest::MockSceneInterface> m_mockSceneInterface;
+        AZStd::unique_ptr<UnitTest::MockPhysicsShape> m_mockPhysicsShape;
+        AZStd::unique_ptr<UnitTest::MockSimulatedBody> m_mockSimulatedBody;
+        AzPhysics::SceneQueryHit m_hit;
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved m_bodyRemovedEvent;
+        AZStd::unique_ptr<AZ::Entity> m_entity;
+    };
+
+    BENCHMARK_DEFINE_F(NavigationMeshBenchmarkFixture, BM_FullNavigationMeshUpdate)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            RecastNavigationMeshRequestBus::Event(AZ::EntityId{ 1 }, &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+        }
+    }
+
+    BENCHMARK_REGISTER_F(NavigationMeshBenchmarkFixture, BM_FullNavigationMeshUpdate)
+        ->Arg(128)
+        ->Arg(256)
+        ->Arg(512)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(NavigationMeshBenchmarkFixture, BM_IncrementalNavigationMeshUpdate)(benchmark::State& state)
+    {
+        RecastNavigationMeshRequestBus::Event(AZ::EntityId{ 1 }, &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        // A small change in the middle of the world, which only affects the tiles around it.
+        const AZ::Aabb dirtyRegion = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            InvalidateRegion(dirtyRegion);
+            state.ResumeTiming();
+
+            RecastNavigationMeshRequestBus::Event(AZ::EntityId{ 1 },
+                &RecastNavigationMeshRequests::UpdateNavigationMeshRegionBlockUntilCompleted, dirtyRegion);
+        }
+    }
+
+    BENCHMARK_REGISTER_F(NavigationMeshBenchmarkFixture, BM_IncrementalNavigationMeshUpdate)
+        ->Arg(128)
+        ->Arg(256)
+        ->Arg(512)
+        ->Unit(::benchmark::kMillisecond);
+} // namespace RecastNavigationTests
+
+#endif
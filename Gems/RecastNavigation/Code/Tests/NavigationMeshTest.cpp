@@ -899,6 +899,64 @@ namespace RecastNavigationTests
         EXPECT_GE(waypoints.size(), 1);
     }
 
+    TEST_F(NavigationTest, RegionUpdateOnlyCollectsInvalidatedTiles)
+    {
+        // Capture the handler that the provider uses to learn about removed static colliders.
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved bodyRemovedEvent;
+        ON_CALL(*m_mockSceneInterface, RegisterSimulationBodyRemovedHandler(_, _)).WillByDefault(Invoke([&bodyRemovedEvent]
+        (AzPhysics::SceneHandle, AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler& handler)
+            {
+                handler.Connect(bodyRemovedEvent);
+            }));
+
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        int geometryRequests = 0;
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this, &geometryRequests]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                ++geometryRequests;
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+        EXPECT_GT(geometryRequests, 0);
+
+        /*
+         * Nothing changed since the full update, so the tile geometry comes from the cache of the provider.
+         */
+        const AZ::Aabb region = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+        geometryRequests = 0;
+        const Wait wait(AZ::EntityId(1));
+        bool result = false;
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshRegionBlockUntilCompleted, region);
+        EXPECT_TRUE(result);
+        EXPECT_EQ(geometryRequests, 0);
+        EXPECT_EQ(wait.m_updatedCalls, 1);
+
+        /*
+         * A static collider within the region is removed, so the tiles that overlap it have to be collected again.
+         */
+        ON_CALL(*m_mockSimulatedBody, GetAabb()).WillByDefault(Return(region));
+        bodyRemovedEvent.Signal(AzPhysics::SceneHandle{}, AzPhysics::SimulatedBodyHandle{});
+
+        RecastNavigationMeshRequestBus::EventResult(result, e.GetId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshRegionBlockUntilCompleted, region);
+        EXPECT_TRUE(result);
+        EXPECT_GT(geometryRequests, 0);
+
+        // The rebuilt tiles were swapped in, so paths can still be found.
+        AZStd::vector<AZ::Vector3> waypoints;
+        DetourNavigationRequestBus::EventResult(waypoints, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositions,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
+        EXPECT_GT(waypoints.size(), 0);
+    }
+
     TEST_F(NavigationTest, NavUpdateThenDeleteCollidersThenUpdateAgainThenFindPathShouldFail)
     {
         Entity e;
@@ -936,4 +994,152 @@ namespace RecastNavigationTests
             AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
         EXPECT_EQ(waypoints.size(), 0);
     }
+
+    TEST_F(NavigationTest, FindPathAsyncMergesIdenticalRequests)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        AZStd::vector<AZStd::vector<AZ::Vector3>> results;
+        auto callback = [&results](RecastNavigation::PathRequestId, const AZStd::vector<AZ::Vector3>& waypoints)
+        {
+            results.push_back(waypoints);
+        };
+
+        for (int i = 0; i < 3; ++i)
+        {
+            RecastNavigation::PathRequestId requestId = RecastNavigation::InvalidPathRequestId;
+            DetourNavigationRequestBus::EventResult(requestId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+                AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f), RecastNavigation::PathRequestPriority::Normal, callback);
+            EXPECT_NE(requestId, RecastNavigation::InvalidPathRequestId);
+        }
+
+        // Path requests are answered on the main thread via ticks.
+        for (int tick = 0; tick < 400 && results.size() < 3; ++tick)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+        }
+
+        ASSERT_EQ(results.size(), 3);
+        for (const AZStd::vector<AZ::Vector3>& waypoints : results)
+        {
+            EXPECT_GT(waypoints.size(), 0);
+        }
+
+        RecastNavigation::PathfindingStatistics statistics;
+        DetourNavigationRequestBus::EventResult(statistics, AZ::EntityId(1), &DetourNavigationRequests::GetPathfindingStatistics);
+        EXPECT_EQ(statistics.m_requestsMade, 3);
+        EXPECT_EQ(statistics.m_requestsCompleted, 3);
+        EXPECT_EQ(statistics.m_requestsMerged, 2);
+        EXPECT_EQ(statistics.m_pathSearches, 1);
+        EXPECT_EQ(statistics.m_pendingRequests, 0);
+    }
+
+    TEST_F(NavigationTest, FindPathAsyncCancelledRequestIsNotCalledBack)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        int cancelledCalls = 0;
+        int completedCalls = 0;
+
+        RecastNavigation::PathRequestId cancelledId = RecastNavigation::InvalidPathRequestId;
+        DetourNavigationRequestBus::EventResult(cancelledId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f), RecastNavigation::PathRequestPriority::Low,
+            [&cancelledCalls](RecastNavigation::PathRequestId, const AZStd::vector<AZ::Vector3>&) { ++cancelledCalls; });
+        DetourNavigationRequestBus::Event(AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+            AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(-2.f, -2.f, 0.f), RecastNavigation::PathRequestPriority::High,
+            [&completedCalls](RecastNavigation::PathRequestId, const AZStd::vector<AZ::Vector3>&) { ++completedCalls; });
+        DetourNavigationRequestBus::Event(AZ::EntityId(1), &DetourNavigationRequests::CancelPathRequest, cancelledId);
+
+        for (int tick = 0; tick < 400 && completedCalls == 0; ++tick)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+        }
+
+        EXPECT_EQ(completedCalls, 1);
+        EXPECT_EQ(cancelledCalls, 0);
+
+        RecastNavigation::PathfindingStatistics statistics;
+        DetourNavigationRequestBus::EventResult(statistics, AZ::EntityId(1), &DetourNavigationRequests::GetPathfindingStatistics);
+        EXPECT_EQ(statistics.m_requestsCancelled, 1);
+        EXPECT_EQ(statistics.m_pendingRequests, 0);
+    }
+
+    TEST_F(NavigationTest, FindPathAsyncMergesIdenticalRequestsFromDifferentAgents)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        // A second agent that uses the navigation mesh of the first entity.
+        Entity agent;
+        agent.SetId(AZ::EntityId{ 2 });
+        agent.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(agent);
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        int completedCalls = 0;
+        auto callback = [&completedCalls](RecastNavigation::PathRequestId, const AZStd::vector<AZ::Vector3>& waypoints)
+        {
+            EXPECT_GT(waypoints.size(), 0);
+            ++completedCalls;
+        };
+
+        for (AZ::EntityId agentId : { e.GetId(), agent.GetId() })
+        {
+            DetourNavigationRequestBus::Event(agentId, &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+                AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f), RecastNavigation::PathRequestPriority::Normal, callback);
+        }
+
+        for (int tick = 0; tick < 400 && completedCalls < 2; ++tick)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+        }
+
+        EXPECT_EQ(completedCalls, 2);
+
+        // Both agents see the statistics of the navigation mesh they share.
+        RecastNavigation::PathfindingStatistics statistics;
+        DetourNavigationRequestBus::EventResult(statistics, agent.GetId(), &DetourNavigationRequests::GetPathfindingStatistics);
+        EXPECT_EQ(statistics.m_requestsMade, 2);
+        EXPECT_EQ(statistics.m_requestsMerged, 1);
+        EXPECT_EQ(statistics.m_pathSearches, 1);
+
+        agent.Deactivate();
+    }
 }
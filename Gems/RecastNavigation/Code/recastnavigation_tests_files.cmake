@@ -8,6 +8,7 @@
 
 set(FILES
     Tests/MockInterfaces.h
+    Tests/NavigationMeshBenchmarks.cpp
     Tests/NavigationMeshTest.cpp
     Tests/RecastNavigationTest.cpp
 )
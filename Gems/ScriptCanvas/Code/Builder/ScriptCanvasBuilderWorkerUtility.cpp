@@ -398,6 +398,13 @@ namespace ScriptCanvasBuilder
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request)
     {
         request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua;
+
+        if (ScriptCanvas::Grammar::g_translateToNative)
+        {
+            // the Lua translation is still required, it is the fallback for graphs that are not translated or not registered
+            request.translationTargetFlags |= ScriptCanvas::Translation::TargetFlags::Cpp | ScriptCanvas::Translation::TargetFlags::Hpp;
+        }
+
         return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
     }
 }
@@ -7,7 +7,105 @@
  */
 
 #include "EBusHandler.h"
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Script/lua/lua.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace EBusHandlerCpp
+{
+    AZ_CVAR(AZ::u32, sc_ebusHandlerPoolCapacity, 64, {}, AZ::ConsoleFunctorFlags::Null
+        , "The maximum number of disconnected behavior handlers kept for reuse per EBus. Graphs that handle events acquire handlers from this pool on activation instead of allocating them.");
+
+    //! Behavior handlers allocate their event table on creation, which is otherwise repeated by every activation of every
+    //! graph that handles an EBus. Released handlers are disconnected and have their hooks removed before they are pooled.
+    //! Once the whole pool is cleared, handlers are destroyed on release until the next acquisition, so graphs that outlive
+    //! the SystemComponent do not leave handlers behind.
+    class HandlerPool
+    {
+    public:
+        AZ::BehaviorEBusHandler* Acquire(AZ::BehaviorEBus* ebus)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            m_isShutDown = false;
+
+            auto iter = m_handlersByBus.find(ebus);
+            if (iter == m_handlersByBus.end() || iter->second.empty())
+            {
+                return nullptr;
+            }
+
+            AZ::BehaviorEBusHandler* handler = iter->second.back();
+            iter->second.pop_back();
+            return handler;
+        }
+
+        void Clear(AZ::BehaviorEBus* ebus)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            for (auto iter = m_handlersByBus.begin(); iter != m_handlersByBus.end();)
+            {
+                if (ebus && iter->first != ebus)
+                {
+                    ++iter;
+                    continue;
+                }
+
+                for (AZ::BehaviorEBusHandler* handler : iter->second)
+                {
+                    iter->first->m_destroyHandler->Invoke(handler);
+                }
+
+                iter = m_handlersByBus.erase(iter);
+            }
+
+            if (!ebus)
+            {
+                m_isShutDown = true;
+            }
+        }
+
+        void Release(AZ::BehaviorEBus* ebus, AZ::BehaviorEBusHandler* handler)
+        {
+            handler->Disconnect();
+
+            const int eventCount = aznumeric_caster(handler->GetEvents().size());
+            for (int eventIndex = 0; eventIndex < eventCount; ++eventIndex)
+            {
+                handler->InstallGenericHook(eventIndex, nullptr, nullptr);
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+                if (!m_isShutDown)
+                {
+                    AZStd::vector<AZ::BehaviorEBusHandler*>& handlers = m_handlersByBus[ebus];
+                    if (handlers.size() < static_cast<AZ::u32>(sc_ebusHandlerPoolCapacity))
+                    {
+                        handlers.push_back(handler);
+                        return;
+                    }
+                }
+            }
+
+            ebus->m_destroyHandler->Invoke(handler);
+        }
+
+    private:
+        AZStd::mutex m_mutex;
+        bool m_isShutDown = false;
+        AZStd::unordered_map<AZ::BehaviorEBus*, AZStd::vector<AZ::BehaviorEBusHandler*>> m_handlersByBus;
+    };
+
+    HandlerPool& GetHandlerPool()
+    {
+        static HandlerPool s_pool;
+        return s_pool;
+    }
+}
 
 namespace ScriptCanvas
 {
@@ -24,8 +122,12 @@ namespace ScriptCanvas
 
     EBusHandler::~EBusHandler()
     {
-        m_handler->Disconnect();
-        m_ebus->m_destroyHandler->Invoke(m_handler);
+        EBusHandlerCpp::GetHandlerPool().Release(m_ebus, m_handler);
+    }
+
+    void EBusHandler::ClearHandlerPool(AZ::BehaviorEBus* ebus)
+    {
+        EBusHandlerCpp::GetHandlerPool().Clear(ebus);
     }
 
     EBusHandler* EBusHandler::Create(ExecutionStateWeakPtr executionState, AZStd::string_view busName)
@@ -46,7 +148,12 @@ namespace ScriptCanvas
         AZ_Assert(m_ebus->m_createHandler, "The ebus %s has no create handler!", ebusName.data());
         AZ_Assert(m_ebus->m_destroyHandler, "The ebus %s has no destroy handler!", ebusName.data());
 
-        AZ_Verify(m_ebus->m_createHandler->InvokeResult(m_handler), "Ebus handler creation failed %s", ebusName.data());
+        m_handler = EBusHandlerCpp::GetHandlerPool().Acquire(m_ebus);
+        if (!m_handler)
+        {
+            AZ_Verify(m_ebus->m_createHandler->InvokeResult(m_handler), "Ebus handler creation failed %s", ebusName.data());
+        }
+
         AZ_Assert(m_handler, "Ebus create handler failed %s", ebusName.data());
     }
 
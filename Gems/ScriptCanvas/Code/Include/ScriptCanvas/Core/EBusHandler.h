@@ -20,6 +20,7 @@ struct lua_State;
 namespace AZ
 {
     class BehaviorContext;
+    class BehaviorEBus;
     class SerializeContext;
 
     struct BehaviorArgument;
@@ -35,6 +36,11 @@ namespace ScriptCanvas
         AZ_CLASS_ALLOCATOR(EBusHandler, AZ::SystemAllocator, 0);      
         
         static EBusHandler* Create(ExecutionStateWeakPtr executionState, AZStd::string_view busName);
+
+        //! Destroys the behavior handlers that were pooled for reuse of the given EBus, or of all of them when it is null.
+        //! This must happen before the EBus is removed from the BehaviorContext. After clearing all of them, handlers released
+        //! by graphs that are still alive are destroyed instead of pooled, until a handler is acquired again.
+        static void ClearHandlerPool(AZ::BehaviorEBus* ebus = nullptr);
         
         static void Reflect(AZ::ReflectContext* reflectContext);
 
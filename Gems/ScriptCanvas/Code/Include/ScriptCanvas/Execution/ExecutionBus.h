@@ -54,6 +54,10 @@ namespace ScriptCanvas
             AZStd::sys_time_t latentTime = 0;
             AZ::u32 latentExecutions = 0;
             AZStd::sys_time_t totalTime = 0;
+            //! The longest single activation, which is the latency that a graph adds to the activation of its entity.
+            AZStd::sys_time_t peakInitializationTime = 0;
+            //! Bytes allocated from the SystemAllocator by activations. Lua allocates from its own allocator, which is not included.
+            size_t initializationAllocatedBytes = 0;
 
             PerformanceTimingReport& operator+=(const PerformanceTimingReport& rhs);
         };
@@ -104,6 +108,9 @@ namespace ScriptCanvas
         public:
             PerformanceScopeInitialization(const PerformanceKey& key);
             ~PerformanceScopeInitialization();
+
+        private:
+            size_t m_startAllocatedBytes;
         };
 
         class PerformanceScopeLatent : public PerformanceScope
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <ScriptCanvas/Asset/RuntimeAsset.h>
 #include <ScriptCanvas/Core/Nodeable.h>
 #include <ScriptCanvas/Execution/ExecutionStateStorage.h>
@@ -14,11 +15,18 @@
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPerActivation.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.h>
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
 
 #include <ScriptCanvas/Execution/ExecutionContext.h>
 
 namespace ExecutionContextCpp
 {
+    AZ_CVAR(bool, sc_nativeExecution, true, {}, AZ::ConsoleFunctorFlags::Null
+        , "Execute the graphs that were translated to C++ and registered by a gem module natively. When disabled, all graphs are interpreted.");
+
+    AZ_CVAR(AZ::u32, sc_preclonedStaticsPerGraph, 4, {}, AZ::ConsoleFunctorFlags::Null
+        , "The number of copies of each static variable that are cloned in advance when a graph is loaded, so that the first activations of the graph don't clone them.");
+
     void CopyTypeInformationOnly(AZ::BehaviorArgument& lhs, const AZ::BehaviorArgument& rhs)
     {
         lhs.m_typeId = rhs.m_typeId;
@@ -182,6 +190,7 @@ namespace ScriptCanvas
                 auto bcClass = AZ::BehaviorContextHelper::GetClass(&behaviorContext, anySource.type());
                 AZ_Assert(bcClass, "BehaviorContext class for type %s was deleted", anySource.type().ToString<AZStd::string>().c_str());
                 runtimeData.m_cloneSources.emplace_back(*bcClass, AZStd::any_cast<void>(&anySource));
+                runtimeData.m_cloneSources.back().Preclone(static_cast<AZ::u32>(ExecutionContextCpp::sc_preclonedStaticsPerGraph));
             }
         }
 
@@ -196,8 +205,24 @@ namespace ScriptCanvas
                 break;
 
             case Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart:
-                runtimeData.m_createExecution = &Execution::CreatePureOnGraphStart;
+            {
+                // only pure graphs with an On Graph Start are translated to C++, everything else remains interpreted
+                Execution::NativeGraphDescriptor nativeGraphDescriptor;
+                if (ExecutionContextCpp::sc_nativeExecution && Execution::FindNativeGraph(runtimeData.m_script.GetId().m_guid, nativeGraphDescriptor))
+                {
+                    // the methods the graph calls are looked up once per loaded asset, and released with it
+                    AZStd::shared_ptr<const Execution::NativeGraph> nativeGraph = AZStd::make_shared<Execution::NativeGraph>(nativeGraphDescriptor);
+                    runtimeData.m_createExecution = [nativeGraph](Execution::StateStorage& storage, ExecutionStateConfig& config)
+                    {
+                        return Execution::CreateNative(storage, config, nativeGraph);
+                    };
+                }
+                else
+                {
+                    runtimeData.m_createExecution = &Execution::CreatePureOnGraphStart;
+                }
                 break;
+            }
 
             case Grammar::ExecutionStateSelection::InterpretedObject:
                 runtimeData.m_createExecution = &Execution::CreatePerActivation;
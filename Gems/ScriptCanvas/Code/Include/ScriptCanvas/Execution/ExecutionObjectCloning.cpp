@@ -22,11 +22,60 @@ namespace ScriptCanvas
             AZ_Assert(source, "null source added to clone source");
         }
 
+        CloneSource::CloneSource(const CloneSource& other)
+            : m_source(other.m_source)
+            , m_class(other.m_class)
+        {}
+
+        CloneSource::CloneSource(CloneSource&& other)
+            : m_source(other.m_source)
+            , m_class(other.m_class)
+            , m_preclones(AZStd::move(other.m_preclones))
+            , m_nextPreclone(other.m_nextPreclone.load())
+        {
+            other.m_preclones.clear();
+            other.m_nextPreclone = 0;
+        }
+
+        CloneSource::~CloneSource()
+        {
+            DestroyUnusedPreclones();
+        }
+
         CloneSource::Result CloneSource::Clone() const
         {
+            if (const size_t index = m_nextPreclone.fetch_add(1); index < m_preclones.size())
+            {
+                return { m_preclones[index], m_class->m_typeId };
+            }
+
             void* clone = m_class->Allocate();
             m_class->m_cloner(clone, m_source, m_class->m_userData);
             return { clone, m_class->m_typeId };
         }
+
+        void CloneSource::DestroyUnusedPreclones()
+        {
+            for (size_t index = m_nextPreclone; index < m_preclones.size(); ++index)
+            {
+                m_class->Destroy(AZ::BehaviorObject(m_preclones[index], m_class->m_typeId));
+            }
+
+            m_preclones.clear();
+        }
+
+        void CloneSource::Preclone(size_t count)
+        {
+            AZ_Assert(m_nextPreclone == 0, "CloneSource::Preclone called after objects were already cloned");
+            DestroyUnusedPreclones();
+
+            m_preclones.reserve(count);
+            for (size_t index = 0; index < count; ++index)
+            {
+                void* clone = m_class->Allocate();
+                m_class->m_cloner(clone, m_source, m_class->m_userData);
+                m_preclones.push_back(clone);
+            }
+        }
     }
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/parallel/atomic.h>
 #include <ScriptCanvas/Core/Core.h>
 
 /**
@@ -30,6 +31,13 @@ namespace ScriptCanvas
             AZ_CLASS_ALLOCATOR(CloneSource, AZ::SystemAllocator, 0);
 
             CloneSource(const AZ::BehaviorClass& bcClass, void* source);
+            //! Copies only the source, the objects cloned in advance are owned by the original.
+            CloneSource(const CloneSource& other);
+            CloneSource(CloneSource&& other);
+            ~CloneSource();
+
+            CloneSource& operator=(const CloneSource&) = delete;
+            CloneSource& operator=(CloneSource&&) = delete;
 
             struct Result
             {
@@ -37,11 +45,20 @@ namespace ScriptCanvas
                 AZ::TypeId typeId;
             };
 
+            //! Returns one of the objects cloned in advance, or a new clone once they have all been taken.
             Result Clone() const;
 
+            //! Clones objects in advance, when the asset is loaded, so the first activations of the graph don't allocate
+            //! and copy them. Must be called before the first call to Clone.
+            void Preclone(size_t count);
+
         private:
             void* m_source = nullptr;
             const AZ::BehaviorClass* m_class = nullptr;
+            AZStd::vector<void*> m_preclones;
+            mutable AZStd::atomic<size_t> m_nextPreclone{ 0 };
+
+            void DestroyUnusedPreclones();
         };
     }
 }
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Memory/SystemAllocator.h>
 #include <ScriptCanvas/SystemComponent.h>
 #include <ScriptCanvas/PerformanceTracker.h>
 
@@ -30,6 +31,8 @@ namespace ScriptCanvas
         PerformanceTimingReport& PerformanceTimingReport::operator+=(const PerformanceTimingReport& rhs)
         {
             initializationTime += rhs.initializationTime;
+            peakInitializationTime = AZStd::max(peakInitializationTime, rhs.peakInitializationTime);
+            initializationAllocatedBytes += rhs.initializationAllocatedBytes;
             executionTime += rhs.executionTime;
             latentTime += rhs.latentTime;
             latentExecutions += rhs.latentExecutions;
@@ -60,11 +63,15 @@ namespace ScriptCanvas
 
         PerformanceScopeInitialization::PerformanceScopeInitialization(const PerformanceKey& key)
             : PerformanceScope(key)
+            , m_startAllocatedBytes(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes())
         {}
 
         PerformanceScopeInitialization::~PerformanceScopeInitialization()
         {
-            ModPerformanceTracker().ReportInitializationTime(m_key, AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - m_startTime).count());
+            const AZStd::sys_time_t time = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - m_startTime).count();
+            // other threads allocate and free at the same time, so this is an estimate, and frees can outweigh the allocations
+            const size_t allocatedBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+            ModPerformanceTracker().ReportInitializationTime(m_key, time, allocatedBytes > m_startAllocatedBytes ? allocatedBytes - m_startAllocatedBytes : 0);
         }
 
         PerformanceScopeLatent::PerformanceScopeLatent(const PerformanceKey& key)
@@ -84,6 +91,8 @@ namespace ScriptCanvas
         void PerformanceTimer::AddTimeFrom(const PerformanceTimer& source)
         {
             m_initializationTime += source.GetInitializationDurationInMicroseconds();
+            m_peakInitializationTime = AZStd::max(m_peakInitializationTime, source.GetPeakInitializationDurationInMicroseconds());
+            m_initializationAllocatedBytes += source.GetInitializationAllocatedBytes();
             m_instantTime += source.GetInstantDurationInMicroseconds();
             m_latentTime += source.GetLatentDurationInMicroseconds();
         }
@@ -99,14 +108,17 @@ namespace ScriptCanvas
             m_latentTime += time;
         }
 
-        void PerformanceTimer::AddInitializationTime(AZStd::sys_time_t time)
+        void PerformanceTimer::AddInitializationTime(AZStd::sys_time_t time, size_t allocatedBytes)
         {
             m_initializationTime += time;
+            m_peakInitializationTime = AZStd::max(m_peakInitializationTime, time);
+            m_initializationAllocatedBytes += allocatedBytes;
         }
 
         PerformanceTimingReport PerformanceTimer::GetReport() const
         {
-            return { m_initializationTime, m_instantTime, m_latentTime, m_latentExecutions, GetTotalDurationInMicroseconds() };
+            return { m_initializationTime, m_instantTime, m_latentTime, m_latentExecutions, GetTotalDurationInMicroseconds()
+                , m_peakInitializationTime, m_initializationAllocatedBytes };
         }
 
         AZStd::sys_time_t PerformanceTimer::GetInstantDurationInMicroseconds() const
@@ -144,6 +156,16 @@ namespace ScriptCanvas
             return m_initializationTime / 1000.0;
         }
 
+        AZStd::sys_time_t PerformanceTimer::GetPeakInitializationDurationInMicroseconds() const
+        {
+            return m_peakInitializationTime;
+        }
+
+        size_t PerformanceTimer::GetInitializationAllocatedBytes() const
+        {
+            return m_initializationAllocatedBytes;
+        }
+
         AZStd::sys_time_t PerformanceTimer::GetTotalDurationInMicroseconds() const
         {
             return m_initializationTime + m_instantTime + m_latentTime;
@@ -27,7 +27,7 @@ namespace ScriptCanvas
 
             void AddLatentTime(AZStd::sys_time_t);
 
-            void AddInitializationTime(AZStd::sys_time_t);
+            void AddInitializationTime(AZStd::sys_time_t, size_t allocatedBytes);
 
             PerformanceTimingReport GetReport() const;
 
@@ -45,12 +45,18 @@ namespace ScriptCanvas
 
             double GetInitializationDurationInMilliseconds() const;
 
+            AZStd::sys_time_t GetPeakInitializationDurationInMicroseconds() const;
+
+            size_t GetInitializationAllocatedBytes() const;
+
             AZStd::sys_time_t GetTotalDurationInMicroseconds() const;
 
             double GetTotalDurationInMilliseconds() const;
 
         private:
             AZStd::sys_time_t m_initializationTime;
+            AZStd::sys_time_t m_peakInitializationTime = 0;
+            size_t m_initializationAllocatedBytes = 0;
             AZStd::sys_time_t m_instantTime;
             AZStd::atomic<AZStd::sys_time_t> m_latentTime;
             AZStd::atomic<AZ::u32> m_latentExecutions;
@@ -12,6 +12,12 @@ namespace ScriptCanvas
 {
     namespace Execution
     {
+        ExecutionState* CreateNative(StateStorage& storage, ExecutionStateConfig& config, AZStd::shared_ptr<const NativeGraph> graph)
+        {
+            new (&storage.data) ExecutionStateNative(config, AZStd::move(graph));
+            return reinterpret_cast<ExecutionState*>(&storage.data);
+        }
+
         ExecutionState* CreatePerActivation(StateStorage& storage, ExecutionStateConfig& config)
         {
             new (&storage.data) ExecutionStateInterpretedPerActivation(config);
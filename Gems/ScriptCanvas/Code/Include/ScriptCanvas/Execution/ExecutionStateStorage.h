@@ -13,6 +13,7 @@
 #include <ScriptCanvas/Execution/ExecutionState.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPerActivation.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
 
 namespace ScriptCanvas
 {
@@ -28,7 +29,8 @@ namespace ScriptCanvas
             = AZ_SIZE_ALIGN_UP(AZStd::max(sizeof(ExecutionStateInterpretedPerActivation)
                 , AZStd::max(sizeof(ExecutionStateInterpretedPerActivationOnGraphStart)
                     , AZStd::max(sizeof(ExecutionStateInterpretedPure)
-                        , sizeof(ExecutionStateInterpretedPureOnGraphStart)))), 32);
+                        , AZStd::max(sizeof(ExecutionStateInterpretedPureOnGraphStart)
+                            , sizeof(ExecutionStateNative))))), 32);
 
         using StorageArray = AZStd::array<AZ::u8, s_StorageSize>;
 
@@ -38,6 +40,8 @@ namespace ScriptCanvas
             StorageArray data;
         };
 
+        ExecutionState* CreateNative(StateStorage& storage, ExecutionStateConfig& config, AZStd::shared_ptr<const NativeGraph> graph);
+
         ExecutionState* CreatePerActivation(StateStorage& storage, ExecutionStateConfig& config);
 
         ExecutionState* CreatePerActivationOnGraphStart(StateStorage& storage, ExecutionStateConfig& config);
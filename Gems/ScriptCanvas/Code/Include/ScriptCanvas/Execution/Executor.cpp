@@ -77,13 +77,13 @@ namespace ScriptCanvas
 
     void Executor::TakeRuntimeDataOverrides(RuntimeDataOverrides&& overrideData)
     {
-        m_runtimeOverrides = overrideData;
+        m_runtimeOverrides = AZStd::move(overrideData);
         m_runtimeOverrides.EnforcePreloadBehavior();
     }
 
     void Executor::TakeUserData(ExecutionUserData&& userData)
     {
-        m_userData = userData;
+        m_userData = AZStd::move(userData);
     }
 }
 
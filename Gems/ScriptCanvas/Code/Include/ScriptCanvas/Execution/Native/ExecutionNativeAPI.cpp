@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
+
+namespace ExecutionNativeAPICpp
+{
+    using namespace ScriptCanvas::Execution;
+
+    // The translated graphs are compiled into other gem modules, so the registry lives in the environment to be shared
+    // with them, the same way the ScriptCanvas performance tracker is.
+    constexpr const char* k_registryName = "ScriptCanvasNativeGraphRegistry";
+
+    struct Registry
+    {
+        AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<AZ::Uuid, NativeGraphDescriptor> m_graphs;
+    };
+
+    AZ::EnvironmentVariable<Registry>& ModRegistry()
+    {
+        static AZ::EnvironmentVariable<Registry> s_registry = AZ::Environment::CreateVariable<Registry>(k_registryName);
+        return s_registry;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        void RegisterNativeGraph(const NativeGraphDescriptor& descriptor)
+        {
+            AZ_Error("ScriptCanvas", !descriptor.m_sourceId.IsNull(), "Native graph %s registered without a source id", descriptor.m_name);
+            AZ_Error("ScriptCanvas", descriptor.m_onGraphStart, "Native graph %s registered without an entry point", descriptor.m_name);
+            AZ_Error("ScriptCanvas", descriptor.m_methods || descriptor.m_methodCount == 0, "Native graph %s registered without its methods", descriptor.m_name);
+
+            auto& registry = ExecutionNativeAPICpp::ModRegistry();
+            AZStd::unique_lock<AZStd::shared_mutex> lock(registry->m_mutex);
+            registry->m_graphs[descriptor.m_sourceId] = descriptor;
+        }
+
+        void UnregisterNativeGraph(const AZ::Uuid& sourceId)
+        {
+            auto& registry = ExecutionNativeAPICpp::ModRegistry();
+            AZStd::unique_lock<AZStd::shared_mutex> lock(registry->m_mutex);
+            registry->m_graphs.erase(sourceId);
+        }
+
+        bool FindNativeGraph(const AZ::Uuid& sourceId, NativeGraphDescriptor& descriptorOut)
+        {
+            auto& registry = ExecutionNativeAPICpp::ModRegistry();
+            AZStd::shared_lock<AZStd::shared_mutex> lock(registry->m_mutex);
+
+            auto iter = registry->m_graphs.find(sourceId);
+            if (iter == registry->m_graphs.end())
+            {
+                return false;
+            }
+
+            descriptorOut = iter->second;
+            return true;
+        }
+
+        NativeMethod::NativeMethod(const char* className, const char* methodName)
+        {
+            AZ::BehaviorContext* behaviorContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+            if (!behaviorContext)
+            {
+                AZ_Error("ScriptCanvas", false, "No BehaviorContext to find native method %s.%s in", className, methodName);
+                return;
+            }
+
+            if (className && className[0])
+            {
+                auto classIter = behaviorContext->m_classes.find(className);
+                if (classIter != behaviorContext->m_classes.end())
+                {
+                    auto methodIter = classIter->second->m_methods.find(methodName);
+                    if (methodIter != classIter->second->m_methods.end())
+                    {
+                        m_method = methodIter->second;
+                    }
+                }
+            }
+            else
+            {
+                auto methodIter = behaviorContext->m_methods.find(methodName);
+                if (methodIter != behaviorContext->m_methods.end())
+                {
+                    m_method = methodIter->second;
+                }
+            }
+
+            AZ_Error("ScriptCanvas", m_method, "Native graphs failed to find reflected method %s.%s", className, methodName);
+        }
+
+        bool NativeMethod::IsValid() const
+        {
+            return m_method != nullptr;
+        }
+
+        NativeGraph::NativeGraph(const NativeGraphDescriptor& descriptor)
+            : m_onGraphStart(descriptor.m_onGraphStart)
+        {
+            m_methods.reserve(descriptor.m_methodCount);
+
+            for (size_t index = 0; index < descriptor.m_methodCount; ++index)
+            {
+                m_methods.emplace_back(descriptor.m_methods[index].m_className, descriptor.m_methods[index].m_methodName);
+            }
+        }
+
+        NativeFunction NativeGraph::GetOnGraphStart() const
+        {
+            return m_onGraphStart;
+        }
+
+        const NativeMethod& NativeGraph::GetMethod(size_t index) const
+        {
+            AZ_Assert(index < m_methods.size(), "Native graph called method %zu of %zu", index, m_methods.size());
+            return m_methods[index];
+        }
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+namespace ScriptCanvas
+{
+    class ExecutionStateNative;
+
+    namespace Execution
+    {
+        //! A function of a graph that was translated to C++ by GraphToCPlusPlus.
+        using NativeFunction = void(*)(ExecutionStateNative& executionState);
+
+        //! The names that a reflected method called by a translated graph is looked up by. The class name of global methods is empty.
+        struct NativeMethodName
+        {
+            const char* m_className = "";
+            const char* m_methodName = "";
+        };
+
+        //! Describes a translated graph to the runtime. The generated source registers one of these from the gem module it is
+        //! compiled into, and the runtime picks it instead of the Lua translation when the graph asset is loaded.
+        struct NativeGraphDescriptor
+        {
+            //! The guid of the source graph, which is also the guid of its runtime asset.
+            AZ::Uuid m_sourceId = AZ::Uuid::CreateNull();
+            const char* m_name = "";
+            NativeFunction m_onGraphStart = nullptr;
+            //! The reflected methods that the functions of the graph call, by the index they call them with.
+            const NativeMethodName* m_methods = nullptr;
+            size_t m_methodCount = 0;
+        };
+
+        //! Graphs must be registered before their runtime assets load, for example from the Activate() of the system
+        //! component of the gem module they are compiled into, and unregistered when that module is deactivated.
+        void RegisterNativeGraph(const NativeGraphDescriptor& descriptor);
+
+        void UnregisterNativeGraph(const AZ::Uuid& sourceId);
+
+        bool FindNativeGraph(const AZ::Uuid& sourceId, NativeGraphDescriptor& descriptorOut);
+
+        //! A reflected method that translated graphs call with typed arguments. BehaviorMethod::Invoke binds them on the C++
+        //! stack, so no value goes through Lua, but the call itself still goes through the BehaviorMethod: the BehaviorContext
+        //! does not keep the C++ functions that it reflects. The method is looked up in the BehaviorContext on construction.
+        class NativeMethod
+        {
+        public:
+            //! Pass an empty class name for global methods.
+            NativeMethod(const char* className, const char* methodName);
+
+            bool IsValid() const;
+
+            template<typename... Args>
+            void Invoke(Args&&... args) const
+            {
+                if (m_method)
+                {
+                    m_method->Invoke(AZStd::forward<Args>(args)...);
+                }
+            }
+
+            template<typename R, typename... Args>
+            R InvokeResult(Args&&... args) const
+            {
+                R result{};
+
+                if (m_method)
+                {
+                    m_method->InvokeResult(result, AZStd::forward<Args>(args)...);
+                }
+
+                return result;
+            }
+
+        private:
+            const AZ::BehaviorMethod* m_method = nullptr;
+        };
+
+        //! A registered graph with the reflected methods it calls looked up in the current BehaviorContext. The runtime creates
+        //! one when it loads a runtime asset of the graph and shares it between the execution states of that asset, so a lookup
+        //! lives as long as the asset instead of as long as the process.
+        class NativeGraph
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(NativeGraph, AZ::SystemAllocator, 0);
+
+            explicit NativeGraph(const NativeGraphDescriptor& descriptor);
+
+            NativeFunction GetOnGraphStart() const;
+
+            const NativeMethod& GetMethod(size_t index) const;
+
+        private:
+            NativeFunction m_onGraphStart = nullptr;
+            AZStd::vector<NativeMethod> m_methods;
+        };
+    }
+}
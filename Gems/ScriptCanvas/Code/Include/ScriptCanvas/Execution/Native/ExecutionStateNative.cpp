@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+
+namespace ScriptCanvas
+{
+    ExecutionStateNative::ExecutionStateNative(ExecutionStateConfig& config, AZStd::shared_ptr<const Execution::NativeGraph> graph)
+        : ExecutionState(config)
+        , m_graph(AZStd::move(graph))
+    {}
+
+    void ExecutionStateNative::Execute()
+    {
+        SC_RUNTIME_CHECK_RETURN(m_graph && m_graph->GetOnGraphStart(), "Native graph executed without an entry point");
+        m_graph->GetOnGraphStart()(*this);
+    }
+
+    ExecutionMode ExecutionStateNative::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    const Execution::NativeMethod& ExecutionStateNative::GetMethod(size_t index) const
+    {
+        return m_graph->GetMethod(index);
+    }
+
+    void ExecutionStateNative::Initialize()
+    {}
+
+    bool ExecutionStateNative::IsPure() const
+    {
+        return true;
+    }
+
+    void ExecutionStateNative::StopExecution()
+    {}
+}
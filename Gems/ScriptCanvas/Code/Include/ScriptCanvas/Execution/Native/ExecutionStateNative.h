@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
+
+namespace ScriptCanvas
+{
+    //! Executes a pure graph with an On Graph Start that was translated to C++ and registered with RegisterNativeGraph.
+    //! Unlike ExecutionStateInterpretedPureOnGraphStart, it never loads the Lua script of the graph.
+    class ExecutionStateNative
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNative, "{5B1D8E0A-3C44-4F7E-9A52-7D0E6B3F21C9}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNative, AZ::SystemAllocator, 0);
+
+        ExecutionStateNative(ExecutionStateConfig& config, AZStd::shared_ptr<const Execution::NativeGraph> graph);
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        //! The reflected method that the translated functions of the graph call by index.
+        const Execution::NativeMethod& GetMethod(size_t index) const;
+
+        void Initialize() override;
+
+        bool IsPure() const override;
+
+        void StopExecution() override;
+
+    private:
+        AZStd::shared_ptr<const Execution::NativeGraph> m_graph;
+    };
+}
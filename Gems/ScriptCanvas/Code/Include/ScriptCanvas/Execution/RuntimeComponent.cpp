@@ -38,8 +38,13 @@ namespace ScriptCanvas
     {
         const auto entityId = GetEntityId();
         AZ::EntityBus::Handler::BusConnect(entityId);
-        m_executor.TakeUserData(ExecutionUserData(RuntimeComponentUserData(*this, entityId)));
-        m_executor.Initialize();
+
+        // pure graphs keep their execution state between activations, they have nothing to reset and don't use the user data
+        if (!m_executor.IsExecutable())
+        {
+            m_executor.TakeUserData(ExecutionUserData(RuntimeComponentUserData(*this, entityId)));
+            m_executor.Initialize();
+        }
     }
 
     void RuntimeComponent::OnEntityActivated(const AZ::EntityId&)
@@ -49,7 +54,14 @@ namespace ScriptCanvas
 
     void RuntimeComponent::OnEntityDeactivated(const AZ::EntityId&)
     {
-        m_executor.StopAndClearExecutable();
+        if (m_executor.IsPure())
+        {
+            m_executor.StopAndKeepExecutable();
+        }
+        else
+        {
+            m_executor.StopAndClearExecutable();
+        }
     }
 
     void RuntimeComponent::Reflect(AZ::ReflectContext* context)
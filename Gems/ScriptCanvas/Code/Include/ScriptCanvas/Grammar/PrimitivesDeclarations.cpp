@@ -18,6 +18,7 @@ namespace ScriptCanvas
         AZ_CVAR(bool, g_processingErrorsForUnitTestsEnabled, false, {}, AZ::ConsoleFunctorFlags::Null, "Enable AP processing errors on parse failure for unit tests.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFile, true, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFileAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation (at prefab time) for debug purposes.");
+        AZ_CVAR(bool, g_translateToNative, false, {}, AZ::ConsoleFunctorFlags::Null, "Also translate graphs to C++ that can be compiled into a gem module and executed natively, saved next to the raw translation output.");
 
         SettingsCache::SettingsCache()
         {
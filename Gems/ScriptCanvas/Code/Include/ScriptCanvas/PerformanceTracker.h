@@ -87,7 +87,7 @@ namespace ScriptCanvas
 
             void ReportLatentTime(PerformanceKey key, AZStd::sys_time_t);
 
-            void ReportInitializationTime(PerformanceKey key, AZStd::sys_time_t);
+            void ReportInitializationTime(PerformanceKey key, AZStd::sys_time_t, size_t allocatedBytes);
         };
     }
 }
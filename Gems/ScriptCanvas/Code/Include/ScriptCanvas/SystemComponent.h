@@ -89,6 +89,7 @@ namespace ScriptCanvas
         // BehaviorEventBus::Handler...
         void OnAddClass(const char* className, AZ::BehaviorClass* behaviorClass) override;
         void OnRemoveClass(const char* className, AZ::BehaviorClass* behaviorClass) override;
+        void OnRemoveEBus(const char* ebusName, AZ::BehaviorEBus* behaviorEBus) override;
         ////
 
     private:
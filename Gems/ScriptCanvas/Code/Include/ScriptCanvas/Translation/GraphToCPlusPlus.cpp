@@ -0,0 +1,995 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/algorithm.h>
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
+#include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
+#include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+#include <ScriptCanvas/Libraries/Core/Method.h>
+
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
+
+namespace GraphToCPlusPlusCpp
+{
+    using namespace ScriptCanvas;
+
+    constexpr const char* k_unsupportedGraph = "Only pure graphs with an On Graph Start are translated to C++";
+    constexpr const char* k_unsupportedHandling = "Graphs that handle events or contain nodeables are not translated to C++";
+    constexpr const char* k_unsupportedVariable = "Graphs with member, exposed or static variables are not translated to C++";
+    constexpr const char* k_unsupportedSelfEntityId = "Graphs that refer to their own entity are not translated to C++";
+    constexpr const char* k_unsupportedSymbol = "%s is not translated to C++";
+    constexpr const char* k_unsupportedCall = "Only calls of reflected methods are translated to C++";
+    constexpr const char* k_unsupportedMethod = "The reflected method %s has a signature that is not translated to C++";
+    constexpr const char* k_unsupportedType = "The type %s is not translated to C++";
+    constexpr const char* k_unsupportedConversion = "Implicit conversions are not translated to C++";
+    constexpr const char* k_unsupportedMultipleOutput = "Multiple outputs are not translated to C++";
+    constexpr const char* k_unsupportedValue = "A value that is not finite was not translated to C++";
+
+    Translation::Configuration CreateCPlusPlusConfig()
+    {
+        Translation::Configuration configuration;
+        configuration.m_blockCommentClose = "*/";
+        configuration.m_blockCommentOpen = "/*";
+        configuration.m_dependencyDelimiter = "::";
+        configuration.m_executionStateName = "executionState";
+        configuration.m_executionStateReferenceGraph = "executionState";
+        configuration.m_executionStateReferenceLocal = "executionState";
+        configuration.m_executionStateScriptCanvasIdName = "m_scriptCanvasId";
+        configuration.m_functionBlockClose = "}";
+        configuration.m_functionBlockOpen = "{";
+        configuration.m_lexicalScopeDelimiter = "::";
+        configuration.m_lexicalScopeVariable = ".";
+        configuration.m_namespaceClose = "}";
+        configuration.m_namespaceOpen = "{";
+        configuration.m_namespaceOpenPrefix = "namespace";
+        configuration.m_scopeClose = "}";
+        configuration.m_scopeOpen = "{";
+        configuration.m_singleLineComment = "//";
+        configuration.m_suffix = Grammar::k_internalRuntimeSuffix;
+        return configuration;
+    }
+
+    bool IsNumeric(AZStd::string_view nativeTypeName)
+    {
+        return nativeTypeName == "double"
+            || nativeTypeName == "float"
+            || nativeTypeName == "AZ::s32"
+            || nativeTypeName == "AZ::u32"
+            || nativeTypeName == "AZ::s64"
+            || nativeTypeName == "AZ::u64";
+    }
+
+    bool IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution)
+    {
+        return input->m_source != execution || input->m_requiresCreationFunction;
+    }
+
+    AZStd::string ToNativeNumber(double value, bool isFloat)
+    {
+        AZStd::string number = AZStd::string::format(isFloat ? "%.9g" : "%.17g", value);
+
+        if (number.find_first_of(".e") == AZStd::string::npos)
+        {
+            number += ".0";
+        }
+
+        if (isFloat)
+        {
+            number += "f";
+        }
+
+        return number;
+    }
+
+    AZStd::string ToNativeString(AZStd::string_view value)
+    {
+        AZStd::string result = "AZStd::string(\"";
+
+        for (const char character : value)
+        {
+            switch (character)
+            {
+            case '\\':
+                result += "\\\\";
+                break;
+            case '"':
+                result += "\\\"";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\r':
+                result += "\\r";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            default:
+                result.push_back(character);
+                break;
+            }
+        }
+
+        result += "\")";
+        return result;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Translation
+    {
+        GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model)
+            : GraphToX(GraphToCPlusPlusCpp::CreateCPlusPlusConfig(), model)
+        {
+            MarkTranslationStart();
+
+            m_namespace = AZStd::string::format("%.*s::%s"
+                , aznumeric_cast<int>(GetAutoNativeNamespace().size()), GetAutoNativeNamespace().data()
+                , Grammar::ToSafeName(m_model.GetSource().m_name).c_str());
+
+            if (IsGraphSupported())
+            {
+                WriteHeader();
+                WriteSource();
+            }
+
+            MarkTranslationStop();
+        }
+
+        const AZ::BehaviorMethod* GraphToCPlusPlus::FindMethod(Grammar::ExecutionTreeConstPtr execution, AZStd::string& className, AZStd::string& methodName)
+        {
+            const auto methodNode = azrtti_cast<const Nodes::Core::Method*>(execution->GetId().m_node);
+            if (!methodNode || !methodNode->GetMethod()
+                || Grammar::IsUserFunctionCall(execution)
+                || execution->GetEventType() != EventType::Count
+                || (methodNode->GetMethodType() != MethodType::Free && methodNode->GetMethodType() != MethodType::Member))
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedCall));
+                return nullptr;
+            }
+
+            // nodes can expose more than one call, only translate the one that calls the method itself
+            auto nameOutcome = methodNode->GetFunctionCallName(execution->GetId().m_slot);
+            if (!nameOutcome.IsSuccess() || nameOutcome.GetValue() != execution->GetName())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedCall));
+                return nullptr;
+            }
+
+            // find the names that the runtime will look the method up by
+            const AZ::BehaviorMethod* method = methodNode->GetMethod();
+            const AZ::BehaviorClass* behaviorClass = methodNode->GetClass();
+            AZ::BehaviorContext* behaviorContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+            const auto& methods = behaviorClass ? behaviorClass->m_methods : behaviorContext->m_methods;
+
+            for (const auto& nameAndMethod : methods)
+            {
+                if (nameAndMethod.second == method)
+                {
+                    className = behaviorClass ? behaviorClass->m_name : "";
+                    methodName = nameAndMethod.first;
+                    return method;
+                }
+            }
+
+            AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedCall));
+            return nullptr;
+        }
+
+        AZStd::string_view GraphToCPlusPlus::GetNativeTypeName(const Data::Type& type)
+        {
+            switch (type.GetType())
+            {
+            case Data::eType::Boolean:
+                return "bool";
+            case Data::eType::Color:
+                return "AZ::Color";
+            case Data::eType::Number:
+                return "double";
+            case Data::eType::Quaternion:
+                return "AZ::Quaternion";
+            case Data::eType::String:
+                return "AZStd::string";
+            case Data::eType::Vector2:
+                return "AZ::Vector2";
+            case Data::eType::Vector3:
+                return "AZ::Vector3";
+            case Data::eType::Vector4:
+                return "AZ::Vector4";
+            default:
+                return "";
+            }
+        }
+
+        AZStd::string_view GraphToCPlusPlus::GetNativeTypeName(const AZ::TypeId& typeId)
+        {
+            static const AZStd::pair<AZ::TypeId, AZStd::string_view> k_nativeTypes[] =
+            {
+                { azrtti_typeid<bool>(), "bool" },
+                { azrtti_typeid<double>(), "double" },
+                { azrtti_typeid<float>(), "float" },
+                { azrtti_typeid<AZ::s32>(), "AZ::s32" },
+                { azrtti_typeid<AZ::u32>(), "AZ::u32" },
+                { azrtti_typeid<AZ::s64>(), "AZ::s64" },
+                { azrtti_typeid<AZ::u64>(), "AZ::u64" },
+                { azrtti_typeid<AZStd::string>(), "AZStd::string" },
+                { azrtti_typeid<AZ::Color>(), "AZ::Color" },
+                { azrtti_typeid<AZ::Quaternion>(), "AZ::Quaternion" },
+                { azrtti_typeid<AZ::Vector2>(), "AZ::Vector2" },
+                { azrtti_typeid<AZ::Vector3>(), "AZ::Vector3" },
+                { azrtti_typeid<AZ::Vector4>(), "AZ::Vector4" },
+            };
+
+            for (const auto& nativeType : k_nativeTypes)
+            {
+                if (nativeType.first == typeId)
+                {
+                    return nativeType.second;
+                }
+            }
+
+            return "";
+        }
+
+        AZStd::string_view GraphToCPlusPlus::GetOperatorString(Grammar::ExecutionTreeConstPtr execution)
+        {
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::OperatorAddition:
+                return " + ";
+            case Grammar::Symbol::OperatorDivision:
+                return " / ";
+            case Grammar::Symbol::OperatorMultiplication:
+                return " * ";
+            case Grammar::Symbol::OperatorSubraction:
+                return " - ";
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::UntranslatedArithmetic));
+                return "";
+            }
+        }
+
+        bool GraphToCPlusPlus::IsGraphSupported()
+        {
+            if (m_model.GetExecutionCharacteristics() != Grammar::ExecutionCharacteristics::Pure
+                || !m_model.GetInterface().HasOnGraphStart()
+                || !m_model.GetStart())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), GraphToCPlusPlusCpp::k_unsupportedGraph));
+                return false;
+            }
+
+            if (!m_model.GetEBusHandlings().empty() || !m_model.GetEventHandlings().empty() || !m_model.GetNodeableParse().empty())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), GraphToCPlusPlusCpp::k_unsupportedHandling));
+                return false;
+            }
+
+            if (!m_model.GetStaticVariablesNames().empty())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), GraphToCPlusPlusCpp::k_unsupportedVariable));
+                return false;
+            }
+
+            for (const auto& variable : m_model.GetVariables())
+            {
+                if (variable->m_isMember || Grammar::ParseConstructionRequirement(variable) != Grammar::VariableConstructionRequirement::None)
+                {
+                    AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), GraphToCPlusPlusCpp::k_unsupportedVariable));
+                    return false;
+                }
+            }
+
+            if (m_model.GetStart()->RefersToSelfEntityId())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), GraphToCPlusPlusCpp::k_unsupportedSelfEntityId));
+                return false;
+            }
+
+            return true;
+        }
+
+        AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model)
+        {
+            GraphToCPlusPlus translation(model);
+
+            if (translation.IsSuccessfull())
+            {
+                TargetResult header;
+                header.m_text = translation.m_dotH.MoveOutput();
+                header.m_duration = translation.GetTranslationDuration();
+
+                TargetResult source;
+                source.m_text = translation.m_dotCpp.MoveOutput();
+                source.m_duration = translation.GetTranslationDuration();
+
+                return AZ::Success(AZStd::make_pair(AZStd::move(header), AZStd::move(source)));
+            }
+            else
+            {
+                return AZ::Failure(translation.MoveErrors());
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
+        {
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::IfCondition:
+                // the branches are translated as the bodies of the condition
+                TranslateIfCondition(execution);
+                return;
+
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+                WriteVariableDeclaration(execution, execution->GetInput(0).m_value);
+                break;
+
+            case Grammar::Symbol::DebugInfoEmptyStatement:
+            case Grammar::Symbol::PlaceHolderDuringParsing:
+            case Grammar::Symbol::Sequence:
+                break;
+
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedSymbol, Grammar::GetSymbolName(execution->GetSymbol()))));
+                return;
+            }
+
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetNodeable())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedCall));
+                return;
+            }
+
+            if (!execution->GetConversions().empty())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedConversion));
+                return;
+            }
+
+            const bool isVariableSet = Grammar::IsVariableSet(execution) || execution->GetSymbol() == Grammar::Symbol::VariableAssignment;
+            const bool isExpression = Grammar::IsLogicalExpression(execution) || Grammar::IsVariableGet(execution) || isVariableSet
+                || Grammar::IsOperatorArithmetic(execution);
+            const bool hasOutput = execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty();
+
+            if (isExpression && !hasOutput)
+            {
+                // the result is not used, and expressions have no side effects
+                WriteOutputAssignments(execution);
+                return;
+            }
+
+            const AZ::BehaviorMethod* method = nullptr;
+            size_t methodIndex = 0;
+
+            if (!isExpression)
+            {
+                AZStd::pair<AZStd::string, AZStd::string> names;
+                method = FindMethod(execution, names.first, names.second);
+                if (!method)
+                {
+                    return;
+                }
+
+                // the runtime looks the methods up by these names when it loads the graph, each one once
+                methodIndex = aznumeric_cast<size_t>(AZStd::distance(m_methods.begin(), AZStd::find(m_methods.begin(), m_methods.end(), names)));
+                if (methodIndex == m_methods.size())
+                {
+                    m_methods.push_back(AZStd::move(names));
+                }
+            }
+
+            m_dotCpp.WriteIndent();
+            const AZStd::string_view outputType = hasOutput ? WriteVariableWrite(execution) : "";
+
+            if (Grammar::IsLogicalExpression(execution))
+            {
+                WriteLogicalExpression(execution);
+            }
+            else if (Grammar::IsVariableGet(execution) || isVariableSet)
+            {
+                WriteFunctionCallInput(execution, 0);
+            }
+            else if (Grammar::IsOperatorArithmetic(execution))
+            {
+                WriteOperatorArithmetic(execution);
+            }
+            else
+            {
+                WriteMethodCall(execution, method, methodIndex, outputType);
+            }
+
+            m_dotCpp.WriteLine(";");
+            WriteOutputAssignments(execution);
+        }
+
+        void GraphToCPlusPlus::TranslateFunctionBlock(Grammar::ExecutionTreeConstPtr functionBlock)
+        {
+            m_dotCpp.WriteLineIndented("void %s([[maybe_unused]] ScriptCanvas::ExecutionStateNative& %s)"
+                , Grammar::k_OnGraphStartFunctionName, m_configuration.m_executionStateName.data());
+            OpenScope(m_dotCpp);
+
+            WriteOutputAssignments(functionBlock);
+            WriteLocalVariableInitialization(functionBlock);
+
+            if (functionBlock->GetChildrenCount() > 0 && functionBlock->GetChild(0).m_execution)
+            {
+                TranslateExecutionTreeEntry(functionBlock->GetChild(0).m_execution);
+            }
+
+            CloseScope(m_dotCpp);
+        }
+
+        void GraphToCPlusPlus::TranslateIfCondition(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetInput(0).m_value->m_datum.GetType() != Data::Type::Boolean())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedConversion));
+                return;
+            }
+
+            m_dotCpp.WriteIndented("if (");
+            WriteFunctionCallInput(execution, 0);
+            m_dotCpp.WriteLine(")");
+
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+                const bool isTranslated = child.m_execution && !child.m_execution->IsInternalOut();
+
+                if (childIndex > 0)
+                {
+                    if (!isTranslated)
+                    {
+                        continue;
+                    }
+
+                    m_dotCpp.WriteLineIndented("else");
+                }
+
+                OpenScope(m_dotCpp);
+
+                if (isTranslated)
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+
+                CloseScope(m_dotCpp);
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            const auto& input = execution->GetInput(index).m_value;
+
+            if (GraphToCPlusPlusCpp::IsInputNamed(input, execution))
+            {
+                if (input->m_isMember)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedVariable));
+                    return;
+                }
+
+                m_dotCpp.Write(input->m_name);
+            }
+            else
+            {
+                WriteValue(execution, input->m_datum);
+            }
+        }
+
+        void GraphToCPlusPlus::WriteHeader()
+        {
+            WriteCopyright(m_dotH);
+            m_dotH.WriteNewLine();
+            WriteDoNotModify(m_dotH);
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#pragma once");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>");
+            m_dotH.WriteNewLine();
+            OpenNamespace(m_dotH, m_namespace);
+            m_dotH.WriteLineIndented("void %s(ScriptCanvas::ExecutionStateNative& %s);"
+                , Grammar::k_OnGraphStartFunctionName, m_configuration.m_executionStateName.data());
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("//! Call from the Activate() of the system component of the gem module that this graph is compiled into.");
+            m_dotH.WriteLineIndented("void Register();");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("//! Call from the Deactivate() of the same system component.");
+            m_dotH.WriteLineIndented("void Unregister();");
+            CloseNamespace(m_dotH, m_namespace);
+        }
+
+        void GraphToCPlusPlus::WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto& localDeclaredVariables = m_model.GetLocalVariables(execution))
+            {
+                for (const auto& variable : *localDeclaredVariables)
+                {
+                    WriteVariableDeclaration(execution, variable);
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const Grammar::Symbol symbol = execution->GetSymbol();
+
+            if (symbol == Grammar::Symbol::LogicalNOT)
+            {
+                m_dotCpp.Write("!");
+                WriteFunctionCallInput(execution, 0);
+                return;
+            }
+
+            if (symbol == Grammar::Symbol::IsNull)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedSymbol, Grammar::GetSymbolName(symbol))));
+                return;
+            }
+
+            if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                // compare with the same tolerance as the interpreted graphs
+                m_dotCpp.Write("AZStd::abs(");
+                WriteFunctionCallInput(execution, 0);
+                m_dotCpp.Write(" - ");
+                WriteFunctionCallInput(execution, 1);
+                m_dotCpp.Write(symbol == Grammar::Symbol::CompareEqual ? ") <= %s" : ") > %s", Grammar::k_LuaEpsilonString);
+                return;
+            }
+
+            WriteFunctionCallInput(execution, 0);
+
+            switch (symbol)
+            {
+            case Grammar::Symbol::CompareEqual:
+                m_dotCpp.Write(" == ");
+                break;
+            case Grammar::Symbol::CompareGreater:
+                m_dotCpp.Write(" > ");
+                break;
+            case Grammar::Symbol::CompareGreaterEqual:
+                m_dotCpp.Write(" >= ");
+                break;
+            case Grammar::Symbol::CompareLess:
+                m_dotCpp.Write(" < ");
+                break;
+            case Grammar::Symbol::CompareLessEqual:
+                m_dotCpp.Write(" <= ");
+                break;
+            case Grammar::Symbol::CompareNotEqual:
+                m_dotCpp.Write(" != ");
+                break;
+            case Grammar::Symbol::LogicalAND:
+                m_dotCpp.Write(" && ");
+                break;
+            case Grammar::Symbol::LogicalOR:
+                m_dotCpp.Write(" || ");
+                break;
+            default:
+                break;
+            }
+
+            WriteFunctionCallInput(execution, 1);
+        }
+
+        void GraphToCPlusPlus::WriteMethodCall(Grammar::ExecutionTreeConstPtr execution, const AZ::BehaviorMethod* method, size_t methodIndex, AZStd::string_view outputType)
+        {
+            if (execution->GetInputCount() != method->GetNumArguments() || (!outputType.empty() && !method->HasResult()))
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedMethod, method->m_name.c_str())));
+                return;
+            }
+
+            AZStd::string_view resultType;
+            if (!outputType.empty())
+            {
+                const AZ::BehaviorParameter* result = method->GetResult();
+                resultType = GetNativeTypeName(result->m_typeId);
+
+                const bool isResultSupported = !resultType.empty()
+                    && (result->m_traits & (AZ::BehaviorParameter::TR_POINTER | AZ::BehaviorParameter::TR_REFERENCE)) == 0
+                    && (resultType == outputType || (GraphToCPlusPlusCpp::IsNumeric(resultType) && GraphToCPlusPlusCpp::IsNumeric(outputType)));
+
+                if (!isResultSupported)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                        , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedMethod, method->m_name.c_str())));
+                    return;
+                }
+            }
+
+            const bool isResultCast = !resultType.empty() && resultType != outputType;
+            if (isResultCast)
+            {
+                m_dotCpp.Write("static_cast<%.*s>(", aznumeric_cast<int>(outputType.size()), outputType.data());
+            }
+
+            if (resultType.empty())
+            {
+                m_dotCpp.Write("%s.GetMethod(%zu).Invoke(", m_configuration.m_executionStateName.data(), methodIndex);
+            }
+            else
+            {
+                m_dotCpp.Write("%s.GetMethod(%zu).InvokeResult<%.*s>(", m_configuration.m_executionStateName.data(), methodIndex
+                    , aznumeric_cast<int>(resultType.size()), resultType.data());
+            }
+
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                const AZ::BehaviorParameter* argument = method->GetArgument(aznumeric_caster(index));
+                const AZStd::string_view argumentType = GetNativeTypeName(argument->m_typeId);
+                const AZStd::string_view inputType = GetNativeTypeName(execution->GetInput(index).m_value->m_datum.GetType());
+                const bool isThisPointer = index == 0 && method->IsMember();
+                const bool isOutArgument = (argument->m_traits & AZ::BehaviorParameter::TR_REFERENCE)
+                    && !(argument->m_traits & AZ::BehaviorParameter::TR_CONST);
+
+                const bool isArgumentSupported = !argumentType.empty() && !inputType.empty()
+                    && (isThisPointer || ((argument->m_traits & AZ::BehaviorParameter::TR_POINTER) == 0 && !isOutArgument))
+                    && (argumentType == inputType || (GraphToCPlusPlusCpp::IsNumeric(argumentType) && GraphToCPlusPlusCpp::IsNumeric(inputType)));
+
+                if (!isArgumentSupported)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                        , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedMethod, method->m_name.c_str())));
+                    return;
+                }
+
+                if (index > 0)
+                {
+                    m_dotCpp.Write(", ");
+                }
+
+                // ScriptCanvas numbers are doubles, pass the exact type of the parameter so no conversion happens in the call
+                if (argumentType != inputType)
+                {
+                    m_dotCpp.Write("static_cast<%.*s>(", aznumeric_cast<int>(argumentType.size()), argumentType.data());
+                    WriteFunctionCallInput(execution, index);
+                    m_dotCpp.Write(")");
+                }
+                else
+                {
+                    WriteFunctionCallInput(execution, index);
+                }
+            }
+
+            m_dotCpp.Write(")");
+
+            if (isResultCast)
+            {
+                m_dotCpp.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NotEnoughInputForArithmeticOperator));
+                return;
+            }
+
+            const AZStd::string_view operatorString = GetOperatorString(execution);
+
+            for (size_t i(0); i < (count - 1); ++i)
+            {
+                m_dotCpp.Write("(");
+            }
+
+            // write operand 0 + operand 1
+            WriteFunctionCallInput(execution, 0);
+            m_dotCpp.Write(operatorString);
+            WriteFunctionCallInput(execution, 1);
+            m_dotCpp.Write(")");
+
+            for (size_t i(2); i < count; ++i)
+            {
+                m_dotCpp.Write(operatorString);
+                WriteFunctionCallInput(execution, i);
+                m_dotCpp.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto output = execution->GetLocalOutput();
+            if (!output)
+            {
+                return;
+            }
+
+            for (const auto& outputIter : *output)
+            {
+                if (!outputIter.second->m_sourceConversions.empty())
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedConversion));
+                    return;
+                }
+
+                for (const auto& assignment : outputIter.second->m_assignments)
+                {
+                    if (assignment->m_isMember || !m_model.GetVariableHandling(assignment).empty())
+                    {
+                        AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedVariable));
+                        return;
+                    }
+
+                    m_dotCpp.WriteLineIndented("%s = %s;", assignment->m_name.c_str(), outputIter.second->m_source->m_name.c_str());
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteSource()
+        {
+            const Grammar::Source& source = m_model.GetSource();
+            const AZStd::string sourceId = source.m_assetId.m_guid.ToString<AZStd::string>();
+
+            WriteCopyright(m_dotCpp);
+            m_dotCpp.WriteNewLine();
+            WriteDoNotModify(m_dotCpp);
+            m_dotCpp.WriteNewLine();
+            m_dotCpp.WriteLine("#include \"%s_VM.h\"", source.m_name.c_str());
+            m_dotCpp.WriteNewLine();
+            m_dotCpp.WriteLine("#include <AzCore/Math/Color.h>");
+            m_dotCpp.WriteLine("#include <AzCore/Math/Quaternion.h>");
+            m_dotCpp.WriteLine("#include <AzCore/Math/Vector2.h>");
+            m_dotCpp.WriteLine("#include <AzCore/Math/Vector3.h>");
+            m_dotCpp.WriteLine("#include <AzCore/Math/Vector4.h>");
+            m_dotCpp.WriteLine("#include <AzCore/std/math.h>");
+            m_dotCpp.WriteLine("#include <AzCore/std/string/string.h>");
+            m_dotCpp.WriteLine("#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>");
+            m_dotCpp.WriteNewLine();
+            OpenNamespace(m_dotCpp, m_namespace);
+
+            TranslateFunctionBlock(m_model.GetStart());
+            m_dotCpp.WriteNewLine();
+
+            if (!m_methods.empty())
+            {
+                m_dotCpp.WriteLineIndented("// the reflected methods that the graph calls, by the index it calls them with");
+                m_dotCpp.WriteLineIndented("const ScriptCanvas::Execution::NativeMethodName k_methods[] =");
+                OpenScope(m_dotCpp);
+
+                for (const auto& names : m_methods)
+                {
+                    m_dotCpp.WriteLineIndented("{ \"%s\", \"%s\" },", names.first.c_str(), names.second.c_str());
+                }
+
+                m_dotCpp.Outdent();
+                m_dotCpp.WriteLineIndented("};");
+                m_dotCpp.WriteNewLine();
+            }
+
+            m_dotCpp.WriteLineIndented("void Register()");
+            OpenScope(m_dotCpp);
+            m_dotCpp.WriteLineIndented("ScriptCanvas::Execution::NativeGraphDescriptor descriptor;");
+            m_dotCpp.WriteLineIndented("descriptor.m_sourceId = AZ::Uuid(\"%s\");", sourceId.c_str());
+            m_dotCpp.WriteLineIndented("descriptor.m_name = \"%.*s\";", aznumeric_cast<int>(GetGraphName().size()), GetGraphName().data());
+            m_dotCpp.WriteLineIndented("descriptor.m_onGraphStart = &%s;", Grammar::k_OnGraphStartFunctionName);
+
+            if (!m_methods.empty())
+            {
+                m_dotCpp.WriteLineIndented("descriptor.m_methods = k_methods;");
+                m_dotCpp.WriteLineIndented("descriptor.m_methodCount = AZ_ARRAY_SIZE(k_methods);");
+            }
+
+            m_dotCpp.WriteLineIndented("ScriptCanvas::Execution::RegisterNativeGraph(descriptor);");
+            CloseScope(m_dotCpp);
+            m_dotCpp.WriteNewLine();
+
+            m_dotCpp.WriteLineIndented("void Unregister()");
+            OpenScope(m_dotCpp);
+            m_dotCpp.WriteLineIndented("ScriptCanvas::Execution::UnregisterNativeGraph(AZ::Uuid(\"%s\"));", sourceId.c_str());
+            CloseScope(m_dotCpp);
+
+            CloseNamespace(m_dotCpp, m_namespace);
+        }
+
+        bool GraphToCPlusPlus::WriteValue(Grammar::ExecutionTreeConstPtr execution, const Datum& datum)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            auto isFinite = [](auto... values)
+            {
+                return (azisfinite(values) && ...);
+            };
+
+            switch (datum.GetType().GetType())
+            {
+            case Data::eType::Boolean:
+                m_dotCpp.Write(*datum.GetAs<Data::BooleanType>() ? "true" : "false");
+                return true;
+
+            case Data::eType::Number:
+            {
+                const double value = *datum.GetAs<Data::NumberType>();
+                if (isFinite(value))
+                {
+                    m_dotCpp.Write(ToNativeNumber(value, false));
+                    return true;
+                }
+                break;
+            }
+
+            case Data::eType::String:
+                m_dotCpp.Write(ToNativeString(*datum.GetAs<Data::StringType>()));
+                return true;
+
+            case Data::eType::Vector2:
+            {
+                const AZ::Vector2& value = *datum.GetAs<Data::Vector2Type>();
+                if (isFinite(value.GetX(), value.GetY()))
+                {
+                    m_dotCpp.Write("AZ::Vector2(%s, %s)", ToNativeNumber(value.GetX(), true).c_str(), ToNativeNumber(value.GetY(), true).c_str());
+                    return true;
+                }
+                break;
+            }
+
+            case Data::eType::Vector3:
+            {
+                const AZ::Vector3& value = *datum.GetAs<Data::Vector3Type>();
+                if (isFinite(value.GetX(), value.GetY(), value.GetZ()))
+                {
+                    m_dotCpp.Write("AZ::Vector3(%s, %s, %s)", ToNativeNumber(value.GetX(), true).c_str(), ToNativeNumber(value.GetY(), true).c_str()
+                        , ToNativeNumber(value.GetZ(), true).c_str());
+                    return true;
+                }
+                break;
+            }
+
+            case Data::eType::Vector4:
+            {
+                const AZ::Vector4& value = *datum.GetAs<Data::Vector4Type>();
+                if (isFinite(value.GetX(), value.GetY(), value.GetZ(), value.GetW()))
+                {
+                    m_dotCpp.Write("AZ::Vector4(%s, %s, %s, %s)", ToNativeNumber(value.GetX(), true).c_str(), ToNativeNumber(value.GetY(), true).c_str()
+                        , ToNativeNumber(value.GetZ(), true).c_str(), ToNativeNumber(value.GetW(), true).c_str());
+                    return true;
+                }
+                break;
+            }
+
+            case Data::eType::Quaternion:
+            {
+                const AZ::Quaternion& value = *datum.GetAs<Data::QuaternionType>();
+                if (isFinite(value.GetX(), value.GetY(), value.GetZ(), value.GetW()))
+                {
+                    m_dotCpp.Write("AZ::Quaternion(%s, %s, %s, %s)", ToNativeNumber(value.GetX(), true).c_str(), ToNativeNumber(value.GetY(), true).c_str()
+                        , ToNativeNumber(value.GetZ(), true).c_str(), ToNativeNumber(value.GetW(), true).c_str());
+                    return true;
+                }
+                break;
+            }
+
+            case Data::eType::Color:
+            {
+                const AZ::Color& value = *datum.GetAs<Data::ColorType>();
+                if (isFinite(value.GetR(), value.GetG(), value.GetB(), value.GetA()))
+                {
+                    m_dotCpp.Write("AZ::Color(%s, %s, %s, %s)", ToNativeNumber(value.GetR(), true).c_str(), ToNativeNumber(value.GetG(), true).c_str()
+                        , ToNativeNumber(value.GetB(), true).c_str(), ToNativeNumber(value.GetA(), true).c_str());
+                    return true;
+                }
+                break;
+            }
+
+            default:
+                AddError(execution, aznew Internal::ParseError(execution ? execution->GetNodeId() : AZ::EntityId()
+                    , AZStd::string::format(k_unsupportedType, Data::GetName(datum.GetType()).c_str())));
+                return false;
+            }
+
+            AddError(execution, aznew Internal::ParseError(execution ? execution->GetNodeId() : AZ::EntityId(), k_unsupportedValue));
+            return false;
+        }
+
+        void GraphToCPlusPlus::WriteVariableDeclaration(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            const AZStd::string_view typeName = GetNativeTypeName(variable->m_datum.GetType());
+            if (typeName.empty())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedType, Data::GetName(variable->m_datum.GetType()).c_str())));
+                return;
+            }
+
+            // graphs often declare variables they never read
+            m_dotCpp.WriteIndented("[[maybe_unused]] %.*s %s = ", aznumeric_cast<int>(typeName.size()), typeName.data(), variable->m_name.c_str());
+            WriteValue(execution, variable->m_datum);
+            m_dotCpp.WriteLine(";");
+        }
+
+        AZStd::string_view GraphToCPlusPlus::WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto& output = execution->GetChild(0).m_output;
+
+            if (output.size() > 1)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedMultipleOutput));
+                return "";
+            }
+
+            const auto& variable = output[0].second->m_source;
+            if (variable->m_isMember || !m_model.GetVariableHandling(variable).empty())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::k_unsupportedVariable));
+                return "";
+            }
+
+            const AZStd::string_view typeName = GetNativeTypeName(variable->m_datum.GetType());
+            if (typeName.empty())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format(GraphToCPlusPlusCpp::k_unsupportedType, Data::GetName(variable->m_datum.GetType()).c_str())));
+                return "";
+            }
+
+            if (variable->m_source == execution)
+            {
+                m_dotCpp.Write("[[maybe_unused]] %.*s %s = ", aznumeric_cast<int>(typeName.size()), typeName.data(), variable->m_name.c_str());
+            }
+            else
+            {
+                m_dotCpp.Write("%s = ", variable->m_name.c_str());
+            }
+
+            return typeName;
+        }
+    }
+}
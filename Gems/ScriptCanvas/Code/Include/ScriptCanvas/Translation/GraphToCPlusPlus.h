@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/utils.h>
+
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+#include "GraphToX.h"
+#include "TranslationResult.h"
+#include "TranslationUtilities.h"
+
+namespace AZ
+{
+    class BehaviorMethod;
+}
+
+namespace ScriptCanvas
+{
+    namespace Translation
+    {
+        //! Translates a graph to C++ from the same abstract code model that GraphToLua translates. The output is a header and
+        //! a source that are compiled into a gem module with ly_add_script_canvas_native_graphs, which registers the graph with
+        //! Execution::RegisterNativeGraph. The runtime then executes the graph without Lua. Reflected methods are still called
+        //! through their BehaviorMethod, with typed arguments, from a table the runtime looks up when it loads the graph.
+        //!
+        //! Only pure graphs with an On Graph Start are translated, and only the subset of the grammar that maps to plain C++:
+        //! method calls, operators, comparisons, logic, if conditions and variables of value types. Translation of any other
+        //! graph fails, and it keeps executing through its Lua translation.
+        class GraphToCPlusPlus
+            : public GraphToX
+        {
+        public:
+            //! Returns the text of the header and of the source.
+            static AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> Translate(const Grammar::AbstractCodeModel& model);
+
+            //! The C++ type that holds values of a ScriptCanvas type, or an empty string if the type is not supported.
+            static AZStd::string_view GetNativeTypeName(const Data::Type& type);
+
+            //! The C++ type of a reflected method parameter or return value, or an empty string if the type is not supported.
+            static AZStd::string_view GetNativeTypeName(const AZ::TypeId& typeId);
+
+        protected:
+            GraphToCPlusPlus(const Grammar::AbstractCodeModel& model);
+
+            bool IsGraphSupported();
+            AZStd::string_view GetOperatorString(Grammar::ExecutionTreeConstPtr execution);
+            const AZ::BehaviorMethod* FindMethod(Grammar::ExecutionTreeConstPtr execution, AZStd::string& className, AZStd::string& methodName);
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateFunctionBlock(Grammar::ExecutionTreeConstPtr functionBlock);
+            void TranslateIfCondition(Grammar::ExecutionTreeConstPtr execution);
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void WriteHeader();
+            void WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteMethodCall(Grammar::ExecutionTreeConstPtr execution, const AZ::BehaviorMethod* method, size_t methodIndex, AZStd::string_view outputType);
+            void WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            void WriteSource();
+            bool WriteValue(Grammar::ExecutionTreeConstPtr execution, const Datum& datum);
+            void WriteVariableDeclaration(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            AZStd::string_view WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution);
+
+        private:
+            Writer m_dotH;
+            Writer m_dotCpp;
+            AZStd::string m_namespace;
+            //! The class and method names of the reflected methods that the graph calls, by the index it calls them with.
+            AZStd::vector<AZStd::pair<AZStd::string, AZStd::string>> m_methods;
+        };
+    }
+}
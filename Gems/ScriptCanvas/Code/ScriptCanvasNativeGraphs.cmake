@@ -0,0 +1,74 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+#
+
+#! ly_add_script_canvas_native_graphs: compiles the C++ translations of ScriptCanvas graphs into a target.
+#
+# When g_translateToNative is set, the ScriptCanvas builder saves <graph>_VM.h and <graph>_VM.cpp for every graph that
+# it translates to C++. Copy them to a directory of the gem that runs the graphs and pass that directory here.
+# The function adds them to the target, and generates a source that defines AutoNative::Register<REGISTRY_NAME>() and
+# AutoNative::Unregister<REGISTRY_NAME>(). Those call Register() and Unregister() of every graph. Declare them, and call
+# them from the Activate() and the Deactivate() of a system component of that gem.
+# Graphs are registered by the guid of their source, so the runtime executes the translation instead of the Lua script
+# when it loads the graph.
+#
+# Example:
+#     ly_add_script_canvas_native_graphs(TARGET MyGem.Static DIRECTORY Source/NativeGraphs REGISTRY_NAME MyGemNativeGraphs)
+#
+# \arg:TARGET the target to compile the translated graphs into
+# \arg:DIRECTORY the directory with the translated graphs, relative to the current source directory
+# \arg:REGISTRY_NAME the suffix of the generated registration functions, unique within a monolithic build
+function(ly_add_script_canvas_native_graphs)
+
+    set(one_value_args TARGET DIRECTORY REGISTRY_NAME)
+    cmake_parse_arguments(ly_add_script_canvas_native_graphs "" "${one_value_args}" "" ${ARGN})
+
+    foreach(arg_name IN LISTS one_value_args)
+        if(NOT ly_add_script_canvas_native_graphs_${arg_name})
+            message(FATAL_ERROR "ly_add_script_canvas_native_graphs called without ${arg_name}")
+        endif()
+    endforeach()
+
+    get_filename_component(graphs_directory ${ly_add_script_canvas_native_graphs_DIRECTORY} ABSOLUTE BASE_DIR ${CMAKE_CURRENT_SOURCE_DIR})
+    file(GLOB graph_sources CONFIGURE_DEPENDS ${graphs_directory}/*_VM.cpp)
+    file(GLOB graph_headers CONFIGURE_DEPENDS ${graphs_directory}/*_VM.h)
+
+    # The translation of graph <name> is in namespace AutoNative::<name>, see GraphToCPlusPlus
+    set(graph_includes "")
+    set(graph_registrations "")
+    set(graph_unregistrations "")
+    foreach(graph_source ${graph_sources})
+        get_filename_component(graph_file_name ${graph_source} NAME_WE)
+        string(REGEX REPLACE "_VM$" "" graph_name ${graph_file_name})
+        string(APPEND graph_includes "#include \"${graph_file_name}.h\"\n")
+        string(APPEND graph_registrations "        ${graph_name}::Register();\n")
+        string(APPEND graph_unregistrations "        ${graph_name}::Unregister();\n")
+    endforeach()
+
+    set(REGISTRY_NAME ${ly_add_script_canvas_native_graphs_REGISTRY_NAME})
+    set(registry_source ${CMAKE_CURRENT_BINARY_DIR}/Azcg/ScriptCanvasNativeGraphs/${REGISTRY_NAME}.cpp)
+    file(CONFIGURE OUTPUT ${registry_source} CONTENT [[
+// Generated by ly_add_script_canvas_native_graphs, do not modify.
+
+@graph_includes@
+namespace AutoNative
+{
+    void Register@REGISTRY_NAME@()
+    {
+@graph_registrations@    }
+
+    void Unregister@REGISTRY_NAME@()
+    {
+@graph_unregistrations@    }
+}
+]] @ONLY)
+
+    target_sources(${ly_add_script_canvas_native_graphs_TARGET} PRIVATE ${graph_headers} ${graph_sources} ${registry_source})
+    target_include_directories(${ly_add_script_canvas_native_graphs_TARGET} PRIVATE ${graphs_directory})
+    source_group("NativeGraphs" FILES ${graph_headers} ${graph_sources} ${registry_source})
+
+endfunction()
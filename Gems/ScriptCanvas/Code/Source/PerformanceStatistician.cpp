@@ -36,6 +36,12 @@ namespace ScriptCanvas
             consoleString += "[ INITIALIZE] ";
             consoleString += AZStd::string::format("%7.3f ms \n", initializingMs);
 
+            consoleString += "[  PEAK INIT] ";
+            consoleString += AZStd::string::format("%7.3f ms \n", stats.report.tracking.timing.peakInitializationTime / 1000.0);
+
+            consoleString += "[INIT ALLOCS] ";
+            consoleString += AZStd::string::format("%7zu bytes \n", stats.report.tracking.timing.initializationAllocatedBytes);
+
             consoleString += "[  EXECUTION] ";
             consoleString += AZStd::string::format("%7.3f ms \n", executionMs);
 
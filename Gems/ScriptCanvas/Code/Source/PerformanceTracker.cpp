@@ -201,11 +201,11 @@ namespace ScriptCanvas
             GetOrCreateTimer(key->GetAssetId())->timer.AddLatentTime(time);
         }
 
-        void PerformanceTracker::ReportInitializationTime(PerformanceKey key, AZStd::sys_time_t time)
+        void PerformanceTracker::ReportInitializationTime(PerformanceKey key, AZStd::sys_time_t time, size_t allocatedBytes)
         {
-             CreateTimer(key)->AddInitializationTime(time);
+             CreateTimer(key)->AddInitializationTime(time, allocatedBytes);
              AssetTimer* assetTimer = GetOrCreateTimer(key->GetAssetId());
-             assetTimer->timer.AddInitializationTime(time);
+             assetTimer->timer.AddInitializationTime(time, allocatedBytes);
              ++(assetTimer->assetActivationCount);             
         }
     }
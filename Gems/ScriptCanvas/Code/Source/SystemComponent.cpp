@@ -16,6 +16,7 @@
 #include <Libraries/Libraries.h>
 #include <ScriptCanvas/Asset/RuntimeAsset.h>
 #include <ScriptCanvas/Core/Contract.h>
+#include <ScriptCanvas/Core/EBusHandler.h>
 #include <ScriptCanvas/Core/Graph.h>
 #include <ScriptCanvas/Core/Node.h>
 #include <ScriptCanvas/Core/Nodeable.h>
@@ -179,10 +180,13 @@ namespace ScriptCanvas
         AZ::BehaviorContextBus::Handler::BusDisconnect();
         SystemRequestBus::Handler::BusDisconnect();
 
+        EBusHandler::ClearHandlerPool();
+
         ModPerformanceTracker()->CalculateReports();
         Execution::PerformanceTrackingReport report = ModPerformanceTracker()->GetGlobalReport();
 
         const double ready = aznumeric_caster(report.timing.initializationTime);
+        const double peakReady = aznumeric_caster(report.timing.peakInitializationTime);
         const double instant = aznumeric_caster(report.timing.executionTime);
         const double latent = aznumeric_caster(report.timing.latentTime);
         const double total = aznumeric_caster(report.timing.totalTime);
@@ -211,6 +215,8 @@ namespace ScriptCanvas
         {
             fprintf(performanceReportStream, "Global ScriptCanvas Performance Report:\n");
             fprintf(performanceReportStream, "[ INITIALIZE] %s\n", AZStd::fixed_string<32>::format("%7.3f ms", ready / 1000.0).c_str());
+            fprintf(performanceReportStream, "[  PEAK INIT] %s\n", AZStd::fixed_string<32>::format("%7.3f ms", peakReady / 1000.0).c_str());
+            fprintf(performanceReportStream, "[INIT ALLOCS] %s\n", AZStd::fixed_string<32>::format("%7zu bytes", report.timing.initializationAllocatedBytes).c_str());
             fprintf(performanceReportStream, "[  EXECUTION] %s\n", AZStd::fixed_string<32>::format("%7.3f ms", instant / 1000.0).c_str());
             fprintf(performanceReportStream, "[     LATENT] %s\n", AZStd::fixed_string<32>::format("%7.3f ms", latent / 1000.0).c_str());
             fprintf(performanceReportStream, "[      TOTAL] %s\n", AZStd::fixed_string<32>::format("%7.3f ms", total / 1000.0).c_str());
@@ -455,6 +461,11 @@ namespace ScriptCanvas
         }
     }
 
+    void SystemComponent::OnRemoveEBus(const char*, AZ::BehaviorEBus* behaviorEBus)
+    {
+        EBusHandler::ClearHandlerPool(behaviorEBus);
+    }
+
     void SystemComponent::SetInterpretedBuildConfiguration(BuildConfiguration config)
     {
         Execution::SetInterpretedExecutionMode(config);
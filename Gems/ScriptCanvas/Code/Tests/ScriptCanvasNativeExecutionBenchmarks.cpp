@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/UnitTest/MockComponentApplication.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
+
+namespace ScriptCanvasBenchmarks
+{
+    namespace NativeExecutionBenchmarkStructures
+    {
+        class BenchmarkClass
+        {
+        public:
+            AZ_TYPE_INFO(BenchmarkClass, "{6C8A2F31-9B4E-4D57-A0E3-2B7F5C1D8E46}");
+
+            static double Add(double lhs, double rhs)
+            {
+                return lhs + rhs;
+            }
+
+            static double Multiply(double lhs, double rhs)
+            {
+                return lhs * rhs;
+            }
+
+            static void Accumulate(double value)
+            {
+                s_accumulator += value;
+            }
+
+            static double s_accumulator;
+        };
+
+        double BenchmarkClass::s_accumulator = 0.0;
+
+        // The same graph as the native one below, written the way GraphToLua translates it.
+        constexpr const char* k_luaGraph = R"(
+            function OnGraphStart()
+                local sum = NativeBenchmarkClass.Add(1.5, 2.0)
+                local product = NativeBenchmarkClass.Multiply(sum, 3.0)
+                if product > 5.0 then
+                    NativeBenchmarkClass.Accumulate(product)
+                end
+            end
+        )";
+
+        // The same graph, written the way GraphToCPlusPlus translates it. The generated function gets its methods from the
+        // execution state, which gets them from the NativeGraph that the runtime creates when it loads the graph.
+        const ScriptCanvas::Execution::NativeMethodName k_methods[] =
+        {
+            { "NativeBenchmarkClass", "Add" },
+            { "NativeBenchmarkClass", "Multiply" },
+            { "NativeBenchmarkClass", "Accumulate" },
+        };
+
+        void OnGraphStart(const ScriptCanvas::Execution::NativeGraph& graph)
+        {
+            [[maybe_unused]] double sum = graph.GetMethod(0).InvokeResult<double>(1.5, 2.0);
+            [[maybe_unused]] double product = graph.GetMethod(1).InvokeResult<double>(sum, 3.0);
+            if (product > 5.0)
+            {
+                graph.GetMethod(2).Invoke(product);
+            }
+        }
+    }
+
+    //! Executes the same graph, as many times per iteration as graphs executed per frame, through Lua the way the
+    //! interpreted backend does and through the calls to reflected methods that the native backend generates.
+    class NativeExecutionBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void InternalSetUp()
+        {
+            using namespace NativeExecutionBenchmarkStructures;
+
+            m_behaviorContext = aznew AZ::BehaviorContext();
+            m_behaviorContext->Class<BenchmarkClass>("NativeBenchmarkClass")
+                ->Method("Add", &BenchmarkClass::Add)
+                ->Method("Multiply", &BenchmarkClass::Multiply)
+                ->Method("Accumulate", &BenchmarkClass::Accumulate);
+
+            m_componentApplication = aznew ::testing::NiceMock<UnitTest::MockComponentApplication>();
+            ON_CALL(*m_componentApplication, GetBehaviorContext()).WillByDefault(::testing::Return(m_behaviorContext));
+
+            m_scriptContext = aznew AZ::ScriptContext();
+            m_scriptContext->BindTo(m_behaviorContext);
+            m_scriptContext->Execute(k_luaGraph, "NativeExecutionBenchmark");
+
+            ScriptCanvas::Execution::NativeGraphDescriptor descriptor;
+            descriptor.m_name = "NativeExecutionBenchmark";
+            descriptor.m_methods = k_methods;
+            descriptor.m_methodCount = AZ_ARRAY_SIZE(k_methods);
+            m_nativeGraph = aznew ScriptCanvas::Execution::NativeGraph(descriptor);
+        }
+
+        void InternalTearDown()
+        {
+            delete m_nativeGraph;
+            delete m_scriptContext;
+            delete m_componentApplication;
+            delete m_behaviorContext;
+        }
+
+        AZ::BehaviorContext* m_behaviorContext = nullptr;
+        ::testing::NiceMock<UnitTest::MockComponentApplication>* m_componentApplication = nullptr;
+        AZ::ScriptContext* m_scriptContext = nullptr;
+        ScriptCanvas::Execution::NativeGraph* m_nativeGraph = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(NativeExecutionBenchmarkFixture, BM_InterpretedGraph)(benchmark::State& state)
+    {
+        const int64_t graphCount = state.range(0);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int64_t graph = 0; graph < graphCount; ++graph)
+            {
+                AZ::ScriptDataContext dataContext;
+                if (m_scriptContext->Call("OnGraphStart", dataContext))
+                {
+                    dataContext.CallExecute();
+                }
+            }
+        }
+
+        benchmark::DoNotOptimize(NativeExecutionBenchmarkStructures::BenchmarkClass::s_accumulator);
+        state.SetItemsProcessed(state.iterations() * graphCount);
+    }
+    BENCHMARK_REGISTER_F(NativeExecutionBenchmarkFixture, BM_InterpretedGraph)
+        ->Arg(1)->Arg(100)->Arg(500)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(NativeExecutionBenchmarkFixture, BM_NativeGraph)(benchmark::State& state)
+    {
+        const int64_t graphCount = state.range(0);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int64_t graph = 0; graph < graphCount; ++graph)
+            {
+                NativeExecutionBenchmarkStructures::OnGraphStart(*m_nativeGraph);
+            }
+        }
+
+        benchmark::DoNotOptimize(NativeExecutionBenchmarkStructures::BenchmarkClass::s_accumulator);
+        state.SetItemsProcessed(state.iterations() * graphCount);
+    }
+    BENCHMARK_REGISTER_F(NativeExecutionBenchmarkFixture, BM_NativeGraph)
+        ->Arg(1)->Arg(100)->Arg(500)->Unit(::benchmark::kMicrosecond);
+} // namespace ScriptCanvasBenchmarks
+
+#endif
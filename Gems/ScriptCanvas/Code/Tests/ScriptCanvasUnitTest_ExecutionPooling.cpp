@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <Tests/Framework/ScriptCanvasUnitTestFixture.h>
+
+#include <ScriptCanvas/Execution/ExecutionObjectCloning.h>
+#include <ScriptCanvas/Execution/ExecutionPerformanceTimer.h>
+
+namespace ScriptCanvasUnitTest
+{
+    using namespace ScriptCanvas;
+
+    namespace ExecutionPoolingUnitTestStructures
+    {
+        class TestClass
+        {
+        public:
+            AZ_TYPE_INFO(TestClass, "{5B0E7D2A-3C81-4F96-A2E4-7D19C6B83F50}");
+            AZ_CLASS_ALLOCATOR(TestClass, AZ::SystemAllocator, 0);
+
+            TestClass() = default;
+
+            TestClass(const TestClass& other)
+                : m_value(other.m_value)
+            {
+                ++s_copyCount;
+            }
+
+            int m_value = 0;
+
+            static int s_copyCount;
+        };
+
+        int TestClass::s_copyCount = 0;
+    }
+
+    class ScriptCanvasExecutionPoolingUnitTestFixture
+        : public ScriptCanvasUnitTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            ScriptCanvasUnitTestFixture::SetUp();
+
+            m_behaviorContext = new AZ::BehaviorContext();
+            m_behaviorContext->Class<ExecutionPoolingUnitTestStructures::TestClass>("PoolingTestClass");
+            m_behaviorClass = AZ::BehaviorContextHelper::GetClass(m_behaviorContext, azrtti_typeid<ExecutionPoolingUnitTestStructures::TestClass>());
+
+            m_source.m_value = 7;
+            ExecutionPoolingUnitTestStructures::TestClass::s_copyCount = 0;
+        }
+
+        void TearDown() override
+        {
+            delete m_behaviorContext;
+
+            ScriptCanvasUnitTestFixture::TearDown();
+        }
+
+        void Destroy(const Execution::CloneSource::Result& result)
+        {
+            m_behaviorClass->Destroy(AZ::BehaviorObject(result.object, result.typeId));
+        }
+
+        AZ::BehaviorContext* m_behaviorContext = nullptr;
+        const AZ::BehaviorClass* m_behaviorClass = nullptr;
+        ExecutionPoolingUnitTestStructures::TestClass m_source;
+    };
+
+    TEST_F(ScriptCanvasExecutionPoolingUnitTestFixture, CloneSource_Precloned_ClonesReturnedWithoutCopying)
+    {
+        using ExecutionPoolingUnitTestStructures::TestClass;
+        ASSERT_NE(m_behaviorClass, nullptr);
+
+        Execution::CloneSource cloneSource(*m_behaviorClass, &m_source);
+        cloneSource.Preclone(2);
+        EXPECT_EQ(TestClass::s_copyCount, 2);
+
+        const Execution::CloneSource::Result first = cloneSource.Clone();
+        const Execution::CloneSource::Result second = cloneSource.Clone();
+        EXPECT_EQ(TestClass::s_copyCount, 2);
+        EXPECT_EQ(reinterpret_cast<TestClass*>(first.object)->m_value, 7);
+        EXPECT_EQ(reinterpret_cast<TestClass*>(second.object)->m_value, 7);
+        EXPECT_NE(first.object, second.object);
+
+        const Execution::CloneSource::Result third = cloneSource.Clone();
+        EXPECT_EQ(TestClass::s_copyCount, 3);
+        EXPECT_EQ(reinterpret_cast<TestClass*>(third.object)->m_value, 7);
+        EXPECT_EQ(third.typeId, azrtti_typeid<TestClass>());
+
+        Destroy(first);
+        Destroy(second);
+        Destroy(third);
+    }
+
+    TEST_F(ScriptCanvasExecutionPoolingUnitTestFixture, CloneSource_Moved_PreclonesMoveWithIt)
+    {
+        using ExecutionPoolingUnitTestStructures::TestClass;
+        ASSERT_NE(m_behaviorClass, nullptr);
+
+        AZStd::vector<Execution::CloneSource> cloneSources;
+        cloneSources.emplace_back(*m_behaviorClass, &m_source);
+        cloneSources.back().Preclone(1);
+        // force the vector to move its elements
+        cloneSources.reserve(cloneSources.capacity() + 1);
+
+        const Execution::CloneSource::Result clone = cloneSources.front().Clone();
+        EXPECT_EQ(TestClass::s_copyCount, 1);
+
+        Destroy(clone);
+    }
+
+    TEST_F(ScriptCanvasExecutionPoolingUnitTestFixture, PerformanceTimer_AddInitializationTime_ReportsPeakAndAllocations)
+    {
+        Execution::PerformanceTimer timer;
+        timer.AddInitializationTime(10, 256);
+        timer.AddInitializationTime(30, 0);
+        timer.AddInitializationTime(20, 64);
+
+        const Execution::PerformanceTimingReport report = timer.GetReport();
+        EXPECT_EQ(report.initializationTime, 60);
+        EXPECT_EQ(report.peakInitializationTime, 30);
+        EXPECT_EQ(report.initializationAllocatedBytes, 320u);
+
+        Execution::PerformanceTimer total;
+        total.AddTimeFrom(timer);
+        total.AddInitializationTime(40, 16);
+        EXPECT_EQ(total.GetPeakInitializationDurationInMicroseconds(), 40);
+        EXPECT_EQ(total.GetInitializationAllocatedBytes(), 336u);
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/UnitTest/MockComponentApplication.h>
+#include <Tests/Framework/ScriptCanvasUnitTestFixture.h>
+
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
+
+namespace ScriptCanvasUnitTest
+{
+    using namespace ScriptCanvas;
+
+    namespace NativeExecutionUnitTestStructures
+    {
+        class TestClass
+        {
+        public:
+            AZ_TYPE_INFO(TestClass, "{0E3E5B6C-7A1D-4F0B-8E2A-4C9D1F6B3A27}");
+
+            static double Add(double lhs, double rhs)
+            {
+                return lhs + rhs;
+            }
+
+            static float Length(const AZ::Vector3& vector)
+            {
+                return vector.GetLength();
+            }
+        };
+
+        static int s_globalCallCount = 0;
+
+        void CountCall()
+        {
+            ++s_globalCallCount;
+        }
+
+        void OnGraphStart(ExecutionStateNative&)
+        {}
+    }
+
+    class ScriptCanvasNativeExecutionUnitTestFixture
+        : public ScriptCanvasUnitTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            using ::testing::Return;
+
+            ScriptCanvasUnitTestFixture::SetUp();
+
+            m_behaviorContext = new AZ::BehaviorContext();
+            m_behaviorContext->Class<NativeExecutionUnitTestStructures::TestClass>("NativeTestClass")
+                ->Method("Add", &NativeExecutionUnitTestStructures::TestClass::Add)
+                ->Method("Length", &NativeExecutionUnitTestStructures::TestClass::Length);
+            m_behaviorContext->Method("NativeTestCountCall", &NativeExecutionUnitTestStructures::CountCall);
+
+            m_componentApplication = new ::testing::NiceMock<UnitTest::MockComponentApplication>();
+            ON_CALL(*m_componentApplication, GetBehaviorContext()).WillByDefault(Return(m_behaviorContext));
+        }
+
+        void TearDown() override
+        {
+            delete m_componentApplication;
+            delete m_behaviorContext;
+
+            ScriptCanvasUnitTestFixture::TearDown();
+        }
+
+        AZ::BehaviorContext* m_behaviorContext = nullptr;
+        ::testing::NiceMock<UnitTest::MockComponentApplication>* m_componentApplication = nullptr;
+    };
+
+    TEST_F(ScriptCanvasNativeExecutionUnitTestFixture, FindNativeGraph_RegisteredGraph_ReturnsDescriptor)
+    {
+        Execution::NativeGraphDescriptor descriptor;
+        descriptor.m_sourceId = AZ::Uuid::CreateRandom();
+        descriptor.m_name = "TestGraph";
+        descriptor.m_onGraphStart = &NativeExecutionUnitTestStructures::OnGraphStart;
+        Execution::RegisterNativeGraph(descriptor);
+
+        Execution::NativeGraphDescriptor found;
+        EXPECT_TRUE(Execution::FindNativeGraph(descriptor.m_sourceId, found));
+        EXPECT_EQ(found.m_onGraphStart, &NativeExecutionUnitTestStructures::OnGraphStart);
+
+        Execution::UnregisterNativeGraph(descriptor.m_sourceId);
+        EXPECT_FALSE(Execution::FindNativeGraph(descriptor.m_sourceId, found));
+    }
+
+    TEST_F(ScriptCanvasNativeExecutionUnitTestFixture, FindNativeGraph_UnregisteredGraph_ReturnsFalse)
+    {
+        Execution::NativeGraphDescriptor found;
+        EXPECT_FALSE(Execution::FindNativeGraph(AZ::Uuid::CreateRandom(), found));
+    }
+
+    TEST_F(ScriptCanvasNativeExecutionUnitTestFixture, NativeGraph_Descriptor_LooksUpMethodsByIndex)
+    {
+        const Execution::NativeMethodName methods[] =
+        {
+            { "NativeTestClass", "Add" },
+            { "", "NativeTestCountCall" },
+        };
+
+        Execution::NativeGraphDescriptor descriptor;
+        descriptor.m_sourceId = AZ::Uuid::CreateRandom();
+        descriptor.m_name = "TestGraph";
+        descriptor.m_onGraphStart = &NativeExecutionUnitTestStructures::OnGraphStart;
+        descriptor.m_methods = methods;
+        descriptor.m_methodCount = AZ_ARRAY_SIZE(methods);
+
+        const Execution::NativeGraph graph(descriptor);
+        EXPECT_EQ(graph.GetOnGraphStart(), &NativeExecutionUnitTestStructures::OnGraphStart);
+
+        ASSERT_TRUE(graph.GetMethod(0).IsValid());
+        EXPECT_DOUBLE_EQ(graph.GetMethod(0).InvokeResult<double>(1.5, 2.0), 3.5);
+
+        NativeExecutionUnitTestStructures::s_globalCallCount = 0;
+        ASSERT_TRUE(graph.GetMethod(1).IsValid());
+        graph.GetMethod(1).Invoke();
+        EXPECT_EQ(NativeExecutionUnitTestStructures::s_globalCallCount, 1);
+    }
+
+    TEST_F(ScriptCanvasNativeExecutionUnitTestFixture, GetNativeTypeName_DataType_ReturnsTypeOrEmpty)
+    {
+        EXPECT_EQ(Translation::GraphToCPlusPlus::GetNativeTypeName(Data::Type::Number()), "double");
+        EXPECT_EQ(Translation::GraphToCPlusPlus::GetNativeTypeName(Data::Type::Vector3()), "AZ::Vector3");
+        EXPECT_TRUE(Translation::GraphToCPlusPlus::GetNativeTypeName(Data::Type::EntityID()).empty());
+    }
+
+    TEST_F(ScriptCanvasNativeExecutionUnitTestFixture, GetNativeTypeName_TypeId_ReturnsTypeOrEmpty)
+    {
+        EXPECT_EQ(Translation::GraphToCPlusPlus::GetNativeTypeName(azrtti_typeid<float>()), "float");
+        EXPECT_EQ(Translation::GraphToCPlusPlus::GetNativeTypeName(azrtti_typeid<AZ::u32>()), "AZ::u32");
+        EXPECT_TRUE(Translation::GraphToCPlusPlus::GetNativeTypeName(azrtti_typeid<AZ::EntityId>()).empty());
+    }
+
+    TEST_F(ScriptCanvasNativeExecutionUnitTestFixture, NativeMethod_ClassMethod_InvokesWithTypedArguments)
+    {
+        const Execution::NativeMethod add("NativeTestClass", "Add");
+        ASSERT_TRUE(add.IsValid());
+        EXPECT_DOUBLE_EQ(add.InvokeResult<double>(1.5, 2.0), 3.5);
+
+        const Execution::NativeMethod length("NativeTestClass", "Length");
+        ASSERT_TRUE(length.IsValid());
+        EXPECT_FLOAT_EQ(length.InvokeResult<float>(AZ::Vector3(3.0f, 4.0f, 0.0f)), 5.0f);
+    }
+
+    TEST_F(ScriptCanvasNativeExecutionUnitTestFixture, NativeMethod_GlobalMethod_Invokes)
+    {
+        NativeExecutionUnitTestStructures::s_globalCallCount = 0;
+
+        const Execution::NativeMethod countCall("", "NativeTestCountCall");
+        ASSERT_TRUE(countCall.IsValid());
+        countCall.Invoke();
+        EXPECT_EQ(NativeExecutionUnitTestStructures::s_globalCallCount, 1);
+    }
+
+    TEST_F(ScriptCanvasNativeExecutionUnitTestFixture, NativeMethod_MissingMethod_IsInvalid)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        const Execution::NativeMethod missing("NativeTestClass", "Missing");
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_FALSE(missing.IsValid());
+        EXPECT_DOUBLE_EQ(missing.InvokeResult<double>(1.0, 2.0), 0.0);
+    }
+}
@@ -27,5 +27,8 @@ set(FILES
     Tests/Libraries/Math/ScriptCanvasUnitTest_Vector4.cpp
     Tests/Libraries/String/ScriptCanvasUnitTest_StringFunctions.cpp
     Tests/Libraries/ScriptCanvasNodeRegistryTest.cpp
+    Tests/ScriptCanvasNativeExecutionBenchmarks.cpp
     Tests/ScriptCanvasTest.cpp
+    Tests/ScriptCanvasUnitTest_ExecutionPooling.cpp
+    Tests/ScriptCanvasUnitTest_NativeExecution.cpp
 )
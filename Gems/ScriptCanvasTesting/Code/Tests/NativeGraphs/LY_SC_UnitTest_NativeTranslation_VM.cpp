@@ -0,0 +1,69 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project.
+* For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: LY_SC_UnitTest_NativeTranslation
+FULL PATH: 
+Last written: 10:12:44 10-19-2026
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include "LY_SC_UnitTest_NativeTranslation_VM.h"
+
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/string/string.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+
+namespace AutoNative::LY_SC_UnitTest_NativeTranslation
+{
+	void OnGraphStart([[maybe_unused]] ScriptCanvas::ExecutionStateNative& executionState)
+	{
+		executionState.GetMethod(0).Invoke(2.5);
+		executionState.GetMethod(0).Invoke(2.5);
+	}
+
+	// the reflected methods that the graph calls, by the index it calls them with
+	const ScriptCanvas::Execution::NativeMethodName k_methods[] =
+	{
+		{ "NativeTranslationTestSink", "Record" },
+	};
+
+	void Register()
+	{
+		ScriptCanvas::Execution::NativeGraphDescriptor descriptor;
+		descriptor.m_sourceId = AZ::Uuid("{4F5E1C7A-2B93-4D08-9E61-A7C35D2B8F14}");
+		descriptor.m_name = "LY_SC_UnitTest_NativeTranslation";
+		descriptor.m_onGraphStart = &OnGraphStart;
+		descriptor.m_methods = k_methods;
+		descriptor.m_methodCount = AZ_ARRAY_SIZE(k_methods);
+		ScriptCanvas::Execution::RegisterNativeGraph(descriptor);
+	}
+
+	void Unregister()
+	{
+		ScriptCanvas::Execution::UnregisterNativeGraph(AZ::Uuid("{4F5E1C7A-2B93-4D08-9E61-A7C35D2B8F14}"));
+	}
+} // namespace AutoNative::LY_SC_UnitTest_NativeTranslation
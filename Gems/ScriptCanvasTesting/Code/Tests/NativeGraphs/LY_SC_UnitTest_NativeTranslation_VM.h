@@ -0,0 +1,42 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project.
+* For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: LY_SC_UnitTest_NativeTranslation
+FULL PATH: 
+Last written: 10:12:44 10-19-2026
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#pragma once
+
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
+
+namespace AutoNative::LY_SC_UnitTest_NativeTranslation
+{
+	void OnGraphStart(ScriptCanvas::ExecutionStateNative& executionState);
+
+	//! Call from the Activate() of the system component of the gem module that this graph is compiled into.
+	void Register();
+
+	//! Call from the Deactivate() of the same system component.
+	void Unregister();
+} // namespace AutoNative::LY_SC_UnitTest_NativeTranslation
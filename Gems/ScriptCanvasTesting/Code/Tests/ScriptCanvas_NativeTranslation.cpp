@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <ScriptCanvas/Asset/RuntimeAsset.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+#include <ScriptCanvas/Execution/ExecutionStateStorage.h>
+#include <ScriptCanvas/Libraries/Core/Start.h>
+#include <ScriptCanvas/Translation/Translation.h>
+#include <ScriptCanvas/Translation/TranslationResult.h>
+
+// defined by ly_add_script_canvas_native_graphs for the graphs in Tests/NativeGraphs
+namespace AutoNative
+{
+    void RegisterScriptCanvasTestingNativeGraphs();
+    void UnregisterScriptCanvasTestingNativeGraphs();
+}
+
+namespace ScriptCanvas_NativeTranslationCPP
+{
+    // Tests/NativeGraphs/LY_SC_UnitTest_NativeTranslation_VM.h/.cpp are the translation of the graph built below
+    const char* k_graphName = "LY_SC_UnitTest_NativeTranslation";
+    const AZ::Uuid k_graphSourceId("{4F5E1C7A-2B93-4D08-9E61-A7C35D2B8F14}");
+    const char* k_nativeGraphDirPathRelative = "@gemroot:ScriptCanvasTesting@/Code/Tests/NativeGraphs";
+
+    class NativeTranslationTestSink
+    {
+    public:
+        AZ_TYPE_INFO(NativeTranslationTestSink, "{B1A0C4E2-6F37-4D59-8C2E-3A94D7F1E065}");
+
+        static void Reflect(AZ::BehaviorContext* behaviorContext)
+        {
+            behaviorContext->Class<NativeTranslationTestSink>("NativeTranslationTestSink")
+                ->Method("Record", &NativeTranslationTestSink::Record,
+                    { { { "Value", "The value to add to the sum", behaviorContext->MakeDefaultValue(2.5) } } })
+                ;
+        }
+
+        static void Record(double value)
+        {
+            s_sum += value;
+            ++s_count;
+        }
+
+        static double s_sum;
+        static int s_count;
+    };
+
+    double NativeTranslationTestSink::s_sum = 0.0;
+    int NativeTranslationTestSink::s_count = 0;
+
+    // the translation starts with comments that include the time it was written
+    AZStd::string ToComparableCode(const AZStd::string& text)
+    {
+        const size_t codeStart = text.find('#');
+        AZStd::string code = codeStart == AZStd::string::npos ? AZStd::string() : text.substr(codeStart);
+        code.erase(AZStd::remove_if(code.begin(), code.end(), [](char c) { return isspace(static_cast<unsigned char>(c)) != 0; }), code.end());
+        return code;
+    }
+
+    AZStd::string ReadNativeGraphFile(AZStd::string_view fileName)
+    {
+        AZ::IO::FixedMaxPath resolvedPath;
+        AZ::IO::FileIOBase::GetInstance()->ResolvePath(resolvedPath, AZ::IO::PathView(k_nativeGraphDirPathRelative));
+        resolvedPath /= fileName;
+        auto readOutcome = AZ::Utils::ReadFile<AZStd::string>(resolvedPath.Native());
+        EXPECT_TRUE(readOutcome.IsSuccess()) << resolvedPath.c_str();
+        return readOutcome.IsSuccess() ? readOutcome.TakeValue() : AZStd::string();
+    }
+}
+
+using namespace ScriptCanvasTests;
+using namespace ScriptCanvas_NativeTranslationCPP;
+
+class ScriptCanvasNativeTranslationTestFixture
+    : public ScriptCanvasTestFixture
+{
+protected:
+    void SetUp() override
+    {
+        ScriptCanvasTestFixture::SetUp();
+
+        NativeTranslationTestSink::Reflect(m_behaviorContext);
+        NativeTranslationTestSink::s_sum = 0.0;
+        NativeTranslationTestSink::s_count = 0;
+        AutoNative::RegisterScriptCanvasTestingNativeGraphs();
+    }
+
+    void TearDown() override
+    {
+        AutoNative::UnregisterScriptCanvasTestingNativeGraphs();
+        m_behaviorContext->EnableRemoveReflection();
+        NativeTranslationTestSink::Reflect(m_behaviorContext);
+        m_behaviorContext->DisableRemoveReflection();
+
+        ScriptCanvasTestFixture::TearDown();
+    }
+};
+
+TEST_F(ScriptCanvasNativeTranslationTestFixture, NativeTranslation_CompiledTranslation_MatchesAndExecutes)
+{
+    using namespace ScriptCanvas;
+
+    // On Graph Start -> Record(2.5) -> Record(2.5)
+    Graph* graph = nullptr;
+    SystemRequestBus::BroadcastResult(graph, &SystemRequests::MakeGraph);
+    ASSERT_NE(nullptr, graph);
+    graph->GetEntity()->Init();
+
+    const ScriptCanvasId& scriptCanvasId = graph->GetScriptCanvasId();
+
+    AZ::EntityId startId;
+    CreateTestNode<Nodes::Core::Start>(scriptCanvasId, startId);
+    const AZ::EntityId record0Id = CreateClassFunctionNode(scriptCanvasId, "NativeTranslationTestSink", "Record");
+    const AZ::EntityId record1Id = CreateClassFunctionNode(scriptCanvasId, "NativeTranslationTestSink", "Record");
+
+    EXPECT_TRUE(Connect(*graph, startId, "Out", record0Id, "In"));
+    EXPECT_TRUE(Connect(*graph, record0Id, "Out", record1Id, "In"));
+
+    Grammar::Request request;
+    request.graph = graph;
+    request.name = k_graphName;
+    request.scriptAssetId = AZ::Data::AssetId(k_graphSourceId);
+    request.addDebugInformation = false;
+    const Translation::Result result = Translation::ToCPlusPlus(request);
+
+    const auto hppOutcome = result.IsSuccess(Translation::TargetFlags::Hpp);
+    const auto cppOutcome = result.IsSuccess(Translation::TargetFlags::Cpp);
+    ASSERT_TRUE(hppOutcome.IsSuccess()) << hppOutcome.GetError().c_str();
+    ASSERT_TRUE(cppOutcome.IsSuccess()) << cppOutcome.GetError().c_str();
+
+    // the translator still writes what the test target compiled
+    const AZStd::string fileNameBase = AZStd::string::format("%s_VM", k_graphName);
+    EXPECT_EQ(ToComparableCode(ReadNativeGraphFile(fileNameBase + ".h")), ToComparableCode(result.m_translations.at(Translation::TargetFlags::Hpp).m_text));
+    EXPECT_EQ(ToComparableCode(ReadNativeGraphFile(fileNameBase + ".cpp")), ToComparableCode(result.m_translations.at(Translation::TargetFlags::Cpp).m_text));
+
+    // and the runtime executes the compiled translation instead of the script
+    AZ::Data::Asset<RuntimeAsset> runtimeAsset(aznew RuntimeAsset(AZ::Data::AssetId(k_graphSourceId, RuntimeDataSubId), AZ::Data::AssetData::AssetStatus::Ready), AZ::Data::AssetLoadBehavior::Default);
+    RuntimeData& runtimeData = runtimeAsset.Get()->m_runtimeData;
+    runtimeData.m_input.m_executionSelection = Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart;
+    runtimeData.m_script = AZ::Data::Asset<AZ::ScriptAsset>(AZ::Data::AssetId(k_graphSourceId, AZ::ScriptAsset::CompiledAssetSubId), azrtti_typeid<AZ::ScriptAsset>());
+    Execution::Context::InitializeStaticActivationData(runtimeData);
+
+    RuntimeDataOverrides overrides;
+    overrides.m_runtimeAsset = runtimeAsset;
+    ExecutionStateConfig config(overrides);
+    Execution::StateStorage storage;
+    ExecutionState* executionState = runtimeData.m_createExecution(storage, config);
+    ASSERT_NE(nullptr, executionState);
+    EXPECT_EQ(ExecutionMode::Native, executionState->GetExecutionMode());
+
+    executionState->Execute();
+    EXPECT_EQ(2, NativeTranslationTestSink::s_count);
+    EXPECT_DOUBLE_EQ(5.0, NativeTranslationTestSink::s_sum);
+
+    Execution::Destruct(storage);
+    delete graph->GetEntity();
+}
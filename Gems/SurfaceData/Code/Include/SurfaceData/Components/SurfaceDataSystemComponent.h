@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <SurfaceData/SurfaceDataRegistryIndex.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
@@ -73,7 +74,8 @@ namespace SurfaceData
         using SurfaceDataRegistryMap = AZStd::unordered_map<SurfaceDataRegistryHandle, SurfaceDataRegistryEntry>;
 
         // Get all the surface tags that can exist within the given bounds.
-        SurfaceTagSet GetTagsFromBounds(const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries) const;
+        SurfaceTagSet GetTagsFromBounds(
+            const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries, const SurfaceDataRegistryIndex& registryIndex) const;
         // Get all the surface provider tags that can exist within the given bounds.
         SurfaceTagSet GetProviderTagsFromBounds(const AZ::Aabb& bounds) const;
         // Get all the surface modifier tags that can exist within the given bounds.
@@ -85,6 +87,13 @@ namespace SurfaceData
         // Convert a SurfaceTagVector to a SurfaceTagSet.
         SurfaceTagSet ConvertTagVectorToSet(const SurfaceTagVector& surfaceTags) const;
 
+        // Call each surface provider with only the input positions in the index cells that the provider overlaps.
+        // Positions are grouped by the set of providers that overlap their cell, so each provider is called once per group.
+        void GetSurfacePointsFromProvidersBatched(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<const SurfaceDataRegistryHandle> providerHandles,
+            SurfacePointList& surfacePointLists) const;
+
         SurfaceDataRegistryHandle RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry);
         SurfaceDataRegistryEntry UnregisterSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle);
         bool UpdateSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, AZ::Aabb& oldBounds);
@@ -96,6 +105,9 @@ namespace SurfaceData
         mutable AZStd::shared_mutex m_registrationMutex;
         SurfaceDataRegistryMap m_registeredSurfaceDataProviders;
         SurfaceDataRegistryMap m_registeredSurfaceDataModifiers;
+        // Spatial indices of the provider and modifier bounds, so that queries only need to look at nearby entries.
+        SurfaceDataRegistryIndex m_providerIndex;
+        SurfaceDataRegistryIndex m_modifierIndex;
         SurfaceDataRegistryHandle m_registeredSurfaceDataProviderHandleCounter = InvalidSurfaceDataRegistryHandle;
         SurfaceDataRegistryHandle m_registeredSurfaceDataModifierHandleCounter = InvalidSurfaceDataRegistryHandle;
         AZStd::unordered_set<AZ::u32> m_registeredModifierTags;
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <SurfaceData/SurfaceDataTypes.h>
+
+namespace SurfaceData
+{
+    //! SurfaceDataRegistryIndex is a 2D spatial index of the bounds of registered surface data providers or modifiers.
+    //! The XY plane is divided into a sparse grid of square cells, and each registry handle is stored in every cell that its
+    //! bounds overlap. This lets queries find the entries that can overlap a region without checking every registered entry.
+    //! Entries with infinite bounds, or bounds that would span too many cells, are stored in a separate list that every query returns.
+    //! Queries are conservative: they can return entries that are near, but not overlapping, the query bounds, so callers still need
+    //! to perform their own exact bounds checks.
+    //! This class isn't thread-safe, the owner is expected to synchronize access to it.
+    class SurfaceDataRegistryIndex
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SurfaceDataRegistryIndex, AZ::SystemAllocator, 0);
+
+        //! The default size of each grid cell in meters.
+        static constexpr float DefaultCellSize = 64.0f;
+
+        //! Entries that span more than this many cells are stored in the unbounded list instead of in each cell.
+        static constexpr size_t MaxCellsPerEntry = 256;
+
+        using CellKey = AZ::u64;
+
+        explicit SurfaceDataRegistryIndex(float cellSize = DefaultCellSize);
+
+        //! Remove all entries from the index.
+        void Clear();
+
+        //! Add an entry to the index.
+        //! @param handle - The registry handle to add.
+        //! @param bounds - The bounds of the entry, or a null Aabb for infinite bounds.
+        void Insert(SurfaceDataRegistryHandle handle, const AZ::Aabb& bounds);
+
+        //! Remove an entry from the index.
+        //! @param handle - The registry handle to remove.
+        //! @param bounds - The bounds that the entry was inserted or last updated with.
+        void Remove(SurfaceDataRegistryHandle handle, const AZ::Aabb& bounds);
+
+        //! Move an entry to new bounds, only touching the cells that changed.
+        void Update(SurfaceDataRegistryHandle handle, const AZ::Aabb& oldBounds, const AZ::Aabb& newBounds);
+
+        //! Get every entry that can overlap the given bounds in XY, sorted by handle and without duplicates.
+        //! @param bounds - The bounds to query, or a null Aabb to get every entry in the index.
+        //! @param outHandles - The output list of handles. This list is cleared before the results are added.
+        void Query(const AZ::Aabb& bounds, AZStd::vector<SurfaceDataRegistryHandle>& outHandles) const;
+
+        //! Get the entries stored in a single cell. This doesn't include the unbounded entries.
+        //! @return The list of handles in the cell, or nullptr if the cell is empty.
+        const AZStd::vector<SurfaceDataRegistryHandle>* GetCellEntries(CellKey key) const;
+
+        //! Get the entries with infinite bounds or bounds that span too many cells. These can overlap any cell.
+        const AZStd::vector<SurfaceDataRegistryHandle>& GetUnboundedEntries() const;
+
+        //! Get the key of the cell that contains the given XY position.
+        CellKey GetCellKey(float x, float y) const;
+
+        float GetCellSize() const;
+
+        //! The number of non-empty cells, for tests and debugging.
+        size_t GetCellCount() const;
+
+    private:
+        struct CellRange
+        {
+            AZ::s32 m_minX = 0;
+            AZ::s32 m_minY = 0;
+            AZ::s32 m_maxX = -1;
+            AZ::s32 m_maxY = -1;
+
+            size_t GetCellCount() const;
+            bool Contains(AZ::s32 x, AZ::s32 y) const;
+        };
+
+        AZ::s32 GetCellCoordinate(float value) const;
+        static CellKey MakeCellKey(AZ::s32 x, AZ::s32 y);
+
+        //! Get the range of cells that the bounds overlap.
+        //! @return False if the bounds are infinite or span too many cells, in which case the entry belongs in the unbounded list.
+        bool GetCellRange(const AZ::Aabb& bounds, CellRange& outRange) const;
+
+        void AddToCells(SurfaceDataRegistryHandle handle, const CellRange& range);
+        void RemoveFromCells(SurfaceDataRegistryHandle handle, const CellRange& range, const CellRange& keepRange);
+        static void EraseHandle(AZStd::vector<SurfaceDataRegistryHandle>& handles, SurfaceDataRegistryHandle handle);
+
+        float m_cellSize = DefaultCellSize;
+        float m_inverseCellSize = 1.0f / DefaultCellSize;
+        AZStd::unordered_map<CellKey, AZStd::vector<SurfaceDataRegistryHandle>> m_cells;
+        AZStd::vector<SurfaceDataRegistryHandle> m_unboundedEntries;
+    };
+} // namespace SurfaceData
@@ -94,6 +94,13 @@ namespace SurfaceData
         void AddSurfacePoint(const AZ::EntityId& entityId, const AZ::Vector3& inPosition,
             const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& weights);
 
+        //! Restrict the input position lookups in AddSurfacePoint() to a subset of the input positions.
+        //! This is used when a surface provider is only given the input positions that can overlap it, so that each added point
+        //! only searches the subset instead of the full list of input positions.
+        //! @param inPositionIndices - The input position indices in the subset, in increasing order, or an empty span to
+        //! search all of the input positions again. This list is expected to remain valid until it's replaced or cleared.
+        void SetInputPositionSubset(AZStd::span<const size_t> inPositionIndices);
+
         //! Modify the surface weights for each surface point in the list.
         //! @param surfaceModifierHandle - The handle to the surface modifier that will modify the surface weights.
         void ModifySurfaceWeights(const SurfaceDataRegistryHandle& surfaceModifierHandle);
@@ -192,6 +199,11 @@ namespace SurfaceData
         // with the last one we used.
         mutable size_t m_lastInputPositionIndex = 0;
 
+        // The optional subset of input position indices that AddSurfacePoint() is currently receiving points for, and the index
+        // of the last subset entry that was used. When the subset is empty, all of the input positions are searched.
+        AZStd::span<const size_t> m_inputPositionSubset;
+        mutable size_t m_lastInputPositionSubsetIndex = 0;
+
         // This list is the size of m_inputPositions.size() and contains the number of output surface points that we've generated for
         // each input point.
         AZStd::vector<size_t> m_numSurfacePointsPerInput;
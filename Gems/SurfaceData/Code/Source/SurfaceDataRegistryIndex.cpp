@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SurfaceData/SurfaceDataRegistryIndex.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace SurfaceData
+{
+    size_t SurfaceDataRegistryIndex::CellRange::GetCellCount() const
+    {
+        if ((m_maxX < m_minX) || (m_maxY < m_minY))
+        {
+            return 0;
+        }
+
+        return aznumeric_cast<size_t>(static_cast<AZ::s64>(m_maxX) - m_minX + 1) *
+            aznumeric_cast<size_t>(static_cast<AZ::s64>(m_maxY) - m_minY + 1);
+    }
+
+    bool SurfaceDataRegistryIndex::CellRange::Contains(AZ::s32 x, AZ::s32 y) const
+    {
+        return (x >= m_minX) && (x <= m_maxX) && (y >= m_minY) && (y <= m_maxY);
+    }
+
+    SurfaceDataRegistryIndex::SurfaceDataRegistryIndex(float cellSize)
+        : m_cellSize(cellSize)
+        , m_inverseCellSize(1.0f / cellSize)
+    {
+        AZ_Assert(cellSize > 0.0f, "SurfaceDataRegistryIndex cell size must be positive.");
+    }
+
+    void SurfaceDataRegistryIndex::Clear()
+    {
+        m_cells.clear();
+        m_unboundedEntries.clear();
+    }
+
+    void SurfaceDataRegistryIndex::Insert(SurfaceDataRegistryHandle handle, const AZ::Aabb& bounds)
+    {
+        CellRange range;
+        if (GetCellRange(bounds, range))
+        {
+            AddToCells(handle, range);
+        }
+        else
+        {
+            m_unboundedEntries.push_back(handle);
+        }
+    }
+
+    void SurfaceDataRegistryIndex::Remove(SurfaceDataRegistryHandle handle, const AZ::Aabb& bounds)
+    {
+        CellRange range;
+        if (GetCellRange(bounds, range))
+        {
+            RemoveFromCells(handle, range, CellRange());
+        }
+        else
+        {
+            EraseHandle(m_unboundedEntries, handle);
+        }
+    }
+
+    void SurfaceDataRegistryIndex::Update(SurfaceDataRegistryHandle handle, const AZ::Aabb& oldBounds, const AZ::Aabb& newBounds)
+    {
+        CellRange oldRange;
+        CellRange newRange;
+        const bool oldIsBounded = GetCellRange(oldBounds, oldRange);
+        const bool newIsBounded = GetCellRange(newBounds, newRange);
+
+        if (!oldIsBounded || !newIsBounded)
+        {
+            Remove(handle, oldBounds);
+            Insert(handle, newBounds);
+            return;
+        }
+
+        // Most updates are small moves or resizes, so only touch the cells that the entry is entering or leaving.
+        RemoveFromCells(handle, oldRange, newRange);
+        for (AZ::s32 y = newRange.m_minY; y <= newRange.m_maxY; ++y)
+        {
+            for (AZ::s32 x = newRange.m_minX; x <= newRange.m_maxX; ++x)
+            {
+                if (!oldRange.Contains(x, y))
+                {
+                    m_cells[MakeCellKey(x, y)].push_back(handle);
+                }
+            }
+        }
+    }
+
+    void SurfaceDataRegistryIndex::Query(const AZ::Aabb& bounds, AZStd::vector<SurfaceDataRegistryHandle>& outHandles) const
+    {
+        outHandles.clear();
+        outHandles.insert(outHandles.end(), m_unboundedEntries.begin(), m_unboundedEntries.end());
+
+        if (bounds.IsValid())
+        {
+            CellRange range;
+            range.m_minX = GetCellCoordinate(bounds.GetMin().GetX());
+            range.m_minY = GetCellCoordinate(bounds.GetMin().GetY());
+            range.m_maxX = GetCellCoordinate(bounds.GetMax().GetX());
+            range.m_maxY = GetCellCoordinate(bounds.GetMax().GetY());
+
+            if (range.GetCellCount() <= m_cells.size())
+            {
+                for (AZ::s32 y = range.m_minY; y <= range.m_maxY; ++y)
+                {
+                    for (AZ::s32 x = range.m_minX; x <= range.m_maxX; ++x)
+                    {
+                        if (auto cell = m_cells.find(MakeCellKey(x, y)); cell != m_cells.end())
+                        {
+                            outHandles.insert(outHandles.end(), cell->second.begin(), cell->second.end());
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // The query covers more cells than are in use, so it's cheaper to check each non-empty cell against the range.
+                for (const auto& [key, handles] : m_cells)
+                {
+                    const AZ::s32 x = static_cast<AZ::s32>(static_cast<AZ::u32>(key >> 32));
+                    const AZ::s32 y = static_cast<AZ::s32>(static_cast<AZ::u32>(key & 0xFFFFFFFF));
+                    if (range.Contains(x, y))
+                    {
+                        outHandles.insert(outHandles.end(), handles.begin(), handles.end());
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (const auto& [key, handles] : m_cells)
+            {
+                outHandles.insert(outHandles.end(), handles.begin(), handles.end());
+            }
+        }
+
+        // Entries that span multiple cells are found once per cell, so remove the duplicates.
+        AZStd::sort(outHandles.begin(), outHandles.end());
+        outHandles.erase(AZStd::unique(outHandles.begin(), outHandles.end()), outHandles.end());
+    }
+
+    const AZStd::vector<SurfaceDataRegistryHandle>* SurfaceDataRegistryIndex::GetCellEntries(CellKey key) const
+    {
+        auto cell = m_cells.find(key);
+        return (cell != m_cells.end()) ? &cell->second : nullptr;
+    }
+
+    const AZStd::vector<SurfaceDataRegistryHandle>& SurfaceDataRegistryIndex::GetUnboundedEntries() const
+    {
+        return m_unboundedEntries;
+    }
+
+    SurfaceDataRegistryIndex::CellKey SurfaceDataRegistryIndex::GetCellKey(float x, float y) const
+    {
+        return MakeCellKey(GetCellCoordinate(x), GetCellCoordinate(y));
+    }
+
+    float SurfaceDataRegistryIndex::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    size_t SurfaceDataRegistryIndex::GetCellCount() const
+    {
+        return m_cells.size();
+    }
+
+    AZ::s32 SurfaceDataRegistryIndex::GetCellCoordinate(float value) const
+    {
+        // Clamp to the range of cell coordinates so that extreme bounds don't overflow. Bounds that large will always be stored
+        // in the unbounded list, so the clamped coordinates only need to be correct for queries.
+        constexpr float MinCoordinate = static_cast<float>(AZStd::numeric_limits<AZ::s32>::min() / 2);
+        constexpr float MaxCoordinate = static_cast<float>(AZStd::numeric_limits<AZ::s32>::max() / 2);
+        return static_cast<AZ::s32>(AZStd::clamp(floorf(value * m_inverseCellSize), MinCoordinate, MaxCoordinate));
+    }
+
+    SurfaceDataRegistryIndex::CellKey SurfaceDataRegistryIndex::MakeCellKey(AZ::s32 x, AZ::s32 y)
+    {
+        return (static_cast<CellKey>(static_cast<AZ::u32>(x)) << 32) | static_cast<CellKey>(static_cast<AZ::u32>(y));
+    }
+
+    bool SurfaceDataRegistryIndex::GetCellRange(const AZ::Aabb& bounds, CellRange& outRange) const
+    {
+        if (!bounds.IsValid())
+        {
+            return false;
+        }
+
+        outRange.m_minX = GetCellCoordinate(bounds.GetMin().GetX());
+        outRange.m_minY = GetCellCoordinate(bounds.GetMin().GetY());
+        outRange.m_maxX = GetCellCoordinate(bounds.GetMax().GetX());
+        outRange.m_maxY = GetCellCoordinate(bounds.GetMax().GetY());
+        return outRange.GetCellCount() <= MaxCellsPerEntry;
+    }
+
+    void SurfaceDataRegistryIndex::AddToCells(SurfaceDataRegistryHandle handle, const CellRange& range)
+    {
+        for (AZ::s32 y = range.m_minY; y <= range.m_maxY; ++y)
+        {
+            for (AZ::s32 x = range.m_minX; x <= range.m_maxX; ++x)
+            {
+                m_cells[MakeCellKey(x, y)].push_back(handle);
+            }
+        }
+    }
+
+    void SurfaceDataRegistryIndex::RemoveFromCells(SurfaceDataRegistryHandle handle, const CellRange& range, const CellRange& keepRange)
+    {
+        for (AZ::s32 y = range.m_minY; y <= range.m_maxY; ++y)
+        {
+            for (AZ::s32 x = range.m_minX; x <= range.m_maxX; ++x)
+            {
+                if (keepRange.Contains(x, y))
+                {
+                    continue;
+                }
+
+                if (auto cell = m_cells.find(MakeCellKey(x, y)); cell != m_cells.end())
+                {
+                    EraseHandle(cell->second, handle);
+                    if (cell->second.empty())
+                    {
+                        m_cells.erase(cell);
+                    }
+                }
+            }
+        }
+    }
+
+    void SurfaceDataRegistryIndex::EraseHandle(AZStd::vector<SurfaceDataRegistryHandle>& handles, SurfaceDataRegistryHandle handle)
+    {
+        // The order of the handles in a cell doesn't matter, so swap the last entry into the removed slot.
+        if (auto entry = AZStd::find(handles.begin(), handles.end(), handle); entry != handles.end())
+        {
+            *entry = handles.back();
+            handles.pop_back();
+        }
+    }
+} // namespace SurfaceData
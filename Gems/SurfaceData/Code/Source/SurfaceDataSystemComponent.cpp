@@ -6,10 +6,13 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/sort.h>
 
 #include <SurfaceData/Components/SurfaceDataSystemComponent.h>
@@ -20,8 +23,20 @@
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
 
+AZ_CVAR(
+    bool,
+    sd_batchProviderQueries,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Group the input positions of large surface point queries by the set of surface providers that overlap them.");
+
 namespace SurfaceData
 {
+    // Queries with fewer input positions than this call every overlapping provider with the full list of positions,
+    // since grouping the positions would cost more than it saves.
+    static constexpr size_t MinPositionsForBatchedProviderQueries = 1024;
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -234,13 +249,25 @@ namespace SurfaceData
 
     void SurfaceDataSystemComponent::RefreshSurfaceData(const SurfaceDataRegistryHandle& providerHandle, const AZ::Aabb& dirtyBounds)
     {
-        auto entryItr = m_registeredSurfaceDataProviders.find(providerHandle);
-        if (entryItr != m_registeredSurfaceDataProviders.end())
+        SurfaceTagVector providerTags;
+        bool providerFound = false;
+        {
+            AZStd::shared_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+            auto entryItr = m_registeredSurfaceDataProviders.find(providerHandle);
+            if (entryItr != m_registeredSurfaceDataProviders.end())
+            {
+                providerTags = entryItr->second.m_tags;
+                providerFound = true;
+            }
+        }
+
+        if (providerFound)
         {
             // Get the set of surface tags that can be affected by refreshing a surface data provider. 
             // This includes all of the provider's tags, as well as any surface modifier tags that exist in the bounds,
             // because the affected surface points have the potential of getting the modifier tags applied as well.
-            SurfaceTagSet affectedSurfaceTags = GetAffectedSurfaceTags(dirtyBounds, entryItr->second.m_tags);
+            // The modifier tags come from the modifier index, so only the modifiers near the dirty bounds are visited.
+            SurfaceTagSet affectedSurfaceTags = GetAffectedSurfaceTags(dirtyBounds, providerTags);
 
             SurfaceDataSystemNotificationBus::Broadcast(
                 &SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, AZ::EntityId(), dirtyBounds, dirtyBounds, affectedSurfaceTags);
@@ -353,14 +380,24 @@ namespace SurfaceData
         };
 
         // Gather up the subset of surface providers that overlap the input positions.
+        // The provider index returns the candidates sorted by handle, so providers are always called in a consistent order.
+        AZStd::vector<SurfaceDataRegistryHandle> providerHandles;
+        m_providerIndex.Query(inPositionBounds, providerHandles);
+
         size_t maxPointsCreatedPerInput = 0;
-        for (const auto& [providerHandle, provider] : m_registeredSurfaceDataProviders)
-        {
-            if (ProviderIsApplicable(provider))
+        auto lastApplicableProvider = AZStd::remove_if(providerHandles.begin(), providerHandles.end(),
+            [this, &ProviderIsApplicable, &maxPointsCreatedPerInput](SurfaceDataRegistryHandle providerHandle)
             {
-                maxPointsCreatedPerInput += provider.m_maxPointsCreatedPerInput;
-            }
-        }
+                auto entryItr = m_registeredSurfaceDataProviders.find(providerHandle);
+                if ((entryItr == m_registeredSurfaceDataProviders.end()) || !ProviderIsApplicable(entryItr->second))
+                {
+                    return true;
+                }
+
+                maxPointsCreatedPerInput += entryItr->second.m_maxPointsCreatedPerInput;
+                return false;
+            });
+        providerHandles.erase(lastApplicableProvider, providerHandles.end());
 
         // If we don't have any surface providers that will create any new surface points, then there's nothing more to do.
         if (maxPointsCreatedPerInput == 0)
@@ -385,9 +422,13 @@ namespace SurfaceData
         // Any generated points that have the same XY coordinates and extremely similar Z values will get combined together.
         {
             AZ_PROFILE_SCOPE(Entity, "GetSurfacePointsFromListInternal: GetSurfacePointsFromList");
-            for (const auto& [providerHandle, provider] : m_registeredSurfaceDataProviders)
+            if (sd_batchProviderQueries && (providerHandles.size() > 1) && (inPositions.size() >= MinPositionsForBatchedProviderQueries))
+            {
+                GetSurfacePointsFromProvidersBatched(inPositions, providerHandles, surfacePointLists);
+            }
+            else
             {
-                if (ProviderIsApplicable(provider))
+                for (const auto& providerHandle : providerHandles)
                 {
                     SurfaceDataProviderRequestBus::Event(
                         providerHandle, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, inPositions, surfacePointLists);
@@ -402,8 +443,17 @@ namespace SurfaceData
         // within a water volume.
         {
             AZ_PROFILE_SCOPE(Entity, "GetSurfacePointsFromListInternal: ModifySurfaceWeights");
-            for (const auto& [modifierHandle, modifier] : m_registeredSurfaceDataModifiers)
+            AZStd::vector<SurfaceDataRegistryHandle> modifierHandles;
+            m_modifierIndex.Query(surfacePointLists.GetSurfacePointAabb(), modifierHandles);
+            for (const auto& modifierHandle : modifierHandles)
             {
+                auto entryItr = m_registeredSurfaceDataModifiers.find(modifierHandle);
+                if (entryItr == m_registeredSurfaceDataModifiers.end())
+                {
+                    continue;
+                }
+
+                const SurfaceDataRegistryEntry& modifier = entryItr->second;
                 bool hasInfiniteBounds = !modifier.m_bounds.IsValid();
 
                 if (hasInfiniteBounds || AabbOverlaps2D(modifier.m_bounds, surfacePointLists.GetSurfacePointAabb()))
@@ -420,12 +470,116 @@ namespace SurfaceData
         surfacePointLists.EndListConstruction();
     }
 
+    void SurfaceDataSystemComponent::GetSurfacePointsFromProvidersBatched(
+        AZStd::span<const AZ::Vector3> inPositions,
+        AZStd::span<const SurfaceDataRegistryHandle> providerHandles,
+        SurfacePointList& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // A group of input positions that all overlap the same set of providers.
+        struct ProviderGroup
+        {
+            AZStd::vector<SurfaceDataRegistryHandle> m_providerHandles;
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<size_t> m_positionIndices;
+        };
+
+        AZStd::vector<ProviderGroup> groups;
+        AZStd::unordered_map<SurfaceDataRegistryIndex::CellKey, size_t> cellGroups;
+        AZStd::unordered_multimap<size_t, size_t> groupsByProviderHash;
+        AZStd::vector<SurfaceDataRegistryHandle> cellProviders;
+
+        // Find the group for the set of providers that can overlap the given cell, creating a new group if needed.
+        auto FindOrCreateGroup = [this, &providerHandles, &groups, &groupsByProviderHash, &cellProviders]
+            (SurfaceDataRegistryIndex::CellKey cellKey) -> size_t
+        {
+            cellProviders.clear();
+            auto AddApplicableProviders = [&providerHandles, &cellProviders](const AZStd::vector<SurfaceDataRegistryHandle>& handles)
+            {
+                for (const auto& handle : handles)
+                {
+                    if (AZStd::binary_search(providerHandles.begin(), providerHandles.end(), handle))
+                    {
+                        cellProviders.push_back(handle);
+                    }
+                }
+            };
+
+            AddApplicableProviders(m_providerIndex.GetUnboundedEntries());
+            if (const auto* cellEntries = m_providerIndex.GetCellEntries(cellKey))
+            {
+                AddApplicableProviders(*cellEntries);
+            }
+            AZStd::sort(cellProviders.begin(), cellProviders.end());
+
+            const size_t providerHash = AZStd::hash_range(cellProviders.begin(), cellProviders.end());
+            auto [firstGroup, lastGroup] = groupsByProviderHash.equal_range(providerHash);
+            for (auto groupItr = firstGroup; groupItr != lastGroup; ++groupItr)
+            {
+                if (groups[groupItr->second].m_providerHandles == cellProviders)
+                {
+                    return groupItr->second;
+                }
+            }
+
+            groups.emplace_back().m_providerHandles = cellProviders;
+            groupsByProviderHash.emplace(providerHash, groups.size() - 1);
+            return groups.size() - 1;
+        };
+
+        // Sort every input position into a group. The positions keep their relative order within each group.
+        for (size_t positionIndex = 0; positionIndex < inPositions.size(); ++positionIndex)
+        {
+            const AZ::Vector3& position = inPositions[positionIndex];
+            const SurfaceDataRegistryIndex::CellKey cellKey = m_providerIndex.GetCellKey(position.GetX(), position.GetY());
+
+            size_t groupIndex = 0;
+            if (auto cellGroup = cellGroups.find(cellKey); cellGroup != cellGroups.end())
+            {
+                groupIndex = cellGroup->second;
+            }
+            else
+            {
+                groupIndex = FindOrCreateGroup(cellKey);
+                cellGroups.emplace(cellKey, groupIndex);
+            }
+
+            groups[groupIndex].m_positions.push_back(position);
+            groups[groupIndex].m_positionIndices.push_back(positionIndex);
+        }
+
+        // If every position overlaps the same providers, there's nothing to gain from splitting up the query.
+        if (groups.size() == 1)
+        {
+            for (const auto& providerHandle : groups[0].m_providerHandles)
+            {
+                SurfaceDataProviderRequestBus::Event(
+                    providerHandle, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, inPositions, surfacePointLists);
+            }
+            return;
+        }
+
+        for (const ProviderGroup& group : groups)
+        {
+            surfacePointLists.SetInputPositionSubset(group.m_positionIndices);
+            for (const auto& providerHandle : group.m_providerHandles)
+            {
+                SurfaceDataProviderRequestBus::Event(
+                    providerHandle, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, group.m_positions,
+                    surfacePointLists);
+            }
+        }
+        surfacePointLists.SetInputPositionSubset({});
+    }
+
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry)
     {
         AZ_Assert(entry.m_maxPointsCreatedPerInput > 0, "Surface data providers should always create at least 1 point.");
         AZStd::unique_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
         SurfaceDataRegistryHandle handle = ++m_registeredSurfaceDataProviderHandleCounter;
         m_registeredSurfaceDataProviders[handle] = entry;
+        m_providerIndex.Insert(handle, entry.m_bounds);
         return handle;
     }
 
@@ -437,6 +591,7 @@ namespace SurfaceData
         if (entryItr != m_registeredSurfaceDataProviders.end())
         {
             entry = entryItr->second;
+            m_providerIndex.Remove(handle, entry.m_bounds);
             m_registeredSurfaceDataProviders.erase(entryItr);
         }
         return entry;
@@ -450,6 +605,7 @@ namespace SurfaceData
         if (entryItr != m_registeredSurfaceDataProviders.end())
         {
             oldBounds = entryItr->second.m_bounds;
+            m_providerIndex.Update(handle, oldBounds, entry.m_bounds);
             entryItr->second = entry;
             return true;
         }
@@ -462,6 +618,7 @@ namespace SurfaceData
         AZStd::unique_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
         SurfaceDataRegistryHandle handle = ++m_registeredSurfaceDataModifierHandleCounter;
         m_registeredSurfaceDataModifiers[handle] = entry;
+        m_modifierIndex.Insert(handle, entry.m_bounds);
         m_registeredModifierTags.insert(entry.m_tags.begin(), entry.m_tags.end());
         return handle;
     }
@@ -474,6 +631,7 @@ namespace SurfaceData
         if (entryItr != m_registeredSurfaceDataModifiers.end())
         {
             entry = entryItr->second;
+            m_modifierIndex.Remove(handle, entry.m_bounds);
             m_registeredSurfaceDataModifiers.erase(entryItr);
         }
         return entry;
@@ -487,6 +645,7 @@ namespace SurfaceData
         if (entryItr != m_registeredSurfaceDataModifiers.end())
         {
             oldBounds = entryItr->second.m_bounds;
+            m_modifierIndex.Update(handle, oldBounds, entry.m_bounds);
             entryItr->second = entry;
             m_registeredModifierTags.insert(entry.m_tags.begin(), entry.m_tags.end());
             return true;
@@ -495,14 +654,27 @@ namespace SurfaceData
     }
 
     SurfaceTagSet SurfaceDataSystemComponent::GetTagsFromBounds(
-        const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries) const
+        const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries, const SurfaceDataRegistryIndex& registryIndex) const
     {
+        AZStd::shared_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
         SurfaceTagSet tags;
 
         const bool inputHasInfiniteBounds = !bounds.IsValid();
 
-        for (const auto& [entryHandle, entry] : registeredEntries)
+        // The index returns every entry when the input bounds are infinite.
+        AZStd::vector<SurfaceDataRegistryHandle> entryHandles;
+        registryIndex.Query(bounds, entryHandles);
+
+        for (const auto& entryHandle : entryHandles)
         {
+            auto entryItr = registeredEntries.find(entryHandle);
+            if (entryItr == registeredEntries.end())
+            {
+                continue;
+            }
+
+            const SurfaceDataRegistryEntry& entry = entryItr->second;
             const bool entryHasInfiniteBounds = !entry.m_bounds.IsValid();
 
             if (inputHasInfiniteBounds || entryHasInfiniteBounds || AabbOverlaps2D(entry.m_bounds, bounds))
@@ -519,12 +691,12 @@ namespace SurfaceData
 
     SurfaceTagSet SurfaceDataSystemComponent::GetProviderTagsFromBounds(const AZ::Aabb& bounds) const
     {
-        return GetTagsFromBounds(bounds, m_registeredSurfaceDataProviders);
+        return GetTagsFromBounds(bounds, m_registeredSurfaceDataProviders, m_providerIndex);
     }
 
     SurfaceTagSet SurfaceDataSystemComponent::GetModifierTagsFromBounds(const AZ::Aabb& bounds) const
     {
-        return GetTagsFromBounds(bounds, m_registeredSurfaceDataModifiers);
+        return GetTagsFromBounds(bounds, m_registeredSurfaceDataModifiers, m_modifierIndex);
     }
 
     SurfaceTagSet SurfaceDataSystemComponent::ConvertTagVectorToSet(const SurfaceTagVector& surfaceTags) const
@@ -20,6 +20,25 @@ namespace SurfaceData
         // until we've searched them all.
         // Our expectation is that most of the time, we'll only have to compare 0-1 input positions.
 
+        if (!m_inputPositionSubset.empty())
+        {
+            // Search through the subset the same way, starting from the last subset entry that we used.
+            size_t subsetIndex = m_lastInputPositionSubsetIndex;
+            for (size_t indexCounter = 0; indexCounter < m_inputPositionSubset.size(); indexCounter++)
+            {
+                if (m_inputPositions[m_inputPositionSubset[subsetIndex]] == inPosition)
+                {
+                    m_lastInputPositionSubsetIndex = subsetIndex;
+                    m_lastInputPositionIndex = m_inputPositionSubset[subsetIndex];
+                    return m_lastInputPositionIndex;
+                }
+
+                subsetIndex = (subsetIndex + 1) % m_inputPositionSubset.size();
+            }
+
+            // The position wasn't in the subset, so fall back to searching all of the input positions.
+        }
+
         size_t inPositionIndex = m_lastInputPositionIndex;
         [[maybe_unused]] bool foundMatch = false;
         for (size_t indexCounter = 0; indexCounter < m_inputPositions.size(); indexCounter++)
@@ -108,6 +127,8 @@ namespace SurfaceData
         m_listIsBeingConstructed = false;
 
         m_lastInputPositionIndex = 0;
+        m_inputPositionSubset = {};
+        m_lastInputPositionSubsetIndex = 0;
         m_inputPositionSize = 0;
         m_maxSurfacePointsPerInput = 0;
 
@@ -188,6 +209,14 @@ namespace SurfaceData
         m_surfaceCreatorIdList.emplace_back(entityId);
     }
 
+    void SurfacePointList::SetInputPositionSubset(AZStd::span<const size_t> inPositionIndices)
+    {
+        AZ_Assert(m_listIsBeingConstructed, "Trying to set an input position subset on a SurfacePointList that isn't under construction.");
+
+        m_inputPositionSubset = inPositionIndices;
+        m_lastInputPositionSubsetIndex = 0;
+    }
+
     void SurfacePointList::ModifySurfaceWeights(const SurfaceDataRegistryHandle& surfaceModifierHandle)
     {
         AZ_Assert(m_listIsBeingConstructed, "Trying to modify surface weights on a SurfacePointList that isn't under construction.");
@@ -258,6 +287,7 @@ namespace SurfaceData
 
         m_listIsBeingConstructed = false;
         m_inputPositions = {};
+        m_inputPositionSubset = {};
         m_filterTags = {};
     }
 
@@ -137,6 +137,49 @@ namespace UnitTest
             return testEntities;
         }
 
+        // Create a grid of small box surfaces that tile the world, along with one large box surface underneath all of them.
+        // This is similar to a level with many separate surface shapes, where each query position only overlaps a couple of them.
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> CreateTiledBenchmarkEntities(float worldSize, int64_t tilesPerSide)
+        {
+            AZStd::vector<AZStd::unique_ptr<AZ::Entity>> testEntities;
+            const float halfWorldSize = worldSize / 2.0f;
+            const float tileSize = worldSize / aznumeric_cast<float>(tilesPerSide);
+
+            AZStd::unique_ptr<AZ::Entity> ground = CreateBenchmarkEntity(
+                AZ::Vector3(halfWorldSize, halfWorldSize, 0.0f), AZStd::array{ "surface1" }, {});
+            {
+                LmbrCentral::BoxShapeConfig boxConfig(AZ::Vector3(worldSize, worldSize, 1.0f));
+                auto shapeComponent = ground->CreateComponent(LmbrCentral::BoxShapeComponentTypeId);
+                shapeComponent->SetConfiguration(boxConfig);
+
+                ground->Init();
+                ground->Activate();
+            }
+            testEntities.push_back(AZStd::move(ground));
+
+            for (int64_t y = 0; y < tilesPerSide; y++)
+            {
+                for (int64_t x = 0; x < tilesPerSide; x++)
+                {
+                    const AZ::Vector3 tileCenter(
+                        (aznumeric_cast<float>(x) + 0.5f) * tileSize, (aznumeric_cast<float>(y) + 0.5f) * tileSize, 10.0f);
+                    AZStd::unique_ptr<AZ::Entity> tile = CreateBenchmarkEntity(tileCenter, AZStd::array{ "surface2" }, {});
+                    {
+                        // Make each tile slightly smaller than its grid spacing so that the tiles don't overlap.
+                        LmbrCentral::BoxShapeConfig boxConfig(AZ::Vector3(tileSize * 0.9f, tileSize * 0.9f, 1.0f));
+                        auto shapeComponent = tile->CreateComponent(LmbrCentral::BoxShapeComponentTypeId);
+                        shapeComponent->SetConfiguration(boxConfig);
+
+                        tile->Init();
+                        tile->Activate();
+                    }
+                    testEntities.push_back(AZStd::move(tile));
+                }
+            }
+
+            return testEntities;
+        }
+
         SurfaceData::SurfaceTagVector CreateBenchmarkTagFilterList()
         {
             SurfaceData::SurfaceTagVector tagFilterList;
@@ -265,6 +308,67 @@ namespace UnitTest
         ->Arg( 2048 )
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetSurfacePoints_ManyProviders)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Create a world with thousands of small surface providers. Each single-point query only overlaps two of them,
+        // so this measures how well the registry index avoids checking every registered provider.
+        const float worldSize = 1024.0f;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities = CreateTiledBenchmarkEntities(worldSize, state.range(0));
+        SurfaceData::SurfaceTagVector filterTags = CreateBenchmarkTagFilterList();
+
+        // Query a sparse set of points across the world at 16 meter intervals.
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SurfaceData::SurfacePointList points;
+
+            for (float y = 0.0f; y < worldSize; y += 16.0f)
+            {
+                for (float x = 0.0f; x < worldSize; x += 16.0f)
+                {
+                    AZ::Vector3 queryPosition(x, y, 0.0f);
+                    points.Clear();
+                    AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePoints(queryPosition, filterTags, points);
+                    benchmark::DoNotOptimize(points);
+                }
+            }
+        }
+    }
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromRegion_ManyProviders)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Create a world with thousands of small surface providers. A region query overlaps all of them, so this measures
+        // how well the batched provider queries avoid sending every input position to every provider.
+        const float worldSize = 1024.0f;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities = CreateTiledBenchmarkEntities(worldSize, state.range(0));
+        SurfaceData::SurfaceTagVector filterTags = CreateBenchmarkTagFilterList();
+
+        // Query every point in a 256 x 256 section of our world at 1 meter intervals.
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SurfaceData::SurfacePointList points;
+
+            AZ::Aabb inRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(256.0f));
+            AZ::Vector2 stepSize(1.0f);
+            AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(inRegion, stepSize, filterTags, points);
+            benchmark::DoNotOptimize(points);
+        }
+    }
+
+    // The number of small surface providers per side of the world.
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePoints_ManyProviders)
+        ->Arg( 16 )
+        ->Arg( 64 )
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromRegion_ManyProviders)
+        ->Arg( 16 )
+        ->Arg( 64 )
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_AddSurfaceTagWeight)(benchmark::State& state)
     {
         AZ_PROFILE_FUNCTION(Entity);
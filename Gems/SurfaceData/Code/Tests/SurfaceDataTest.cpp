@@ -27,6 +27,7 @@
 #include <SurfaceDataModule.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
 #include <SurfaceData/SurfaceDataModifierRequestBus.h>
+#include <SurfaceData/SurfaceDataRegistryIndex.h>
 #include <SurfaceData/SurfaceTag.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 #include <Tests/SurfaceDataTestFixtures.h>
@@ -964,6 +965,135 @@ TEST_F(SurfaceDataTestApp, SurfaceData_VerifyGetSurfacePointsFromListAndGetSurfa
     CompareSurfacePointListWithGetSurfacePoints(queryPositions, availablePointsPerPosition, providerTags);
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_VerifyBatchedProviderQueriesAndGetSurfacePointsMatch)
+{
+    // This ensures that large queries, which group their input positions by the set of overlapping providers, produce the same
+    // results as querying each position individually.
+
+    // Create a 2x2 grid of mock Surface Providers that each cover a 128 x 128 area at a height of 0, along with one large mock
+    // Surface Provider that covers the entire 256 x 256 area at a height of 10. The small providers span several index cells each,
+    // so the query positions will get split into multiple groups with different sets of providers.
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    AZStd::vector<AZStd::unique_ptr<MockSurfaceProvider>> mockProviders;
+    for (float y = 0.0f; y < 256.0f; y += 128.0f)
+    {
+        for (float x = 0.0f; x < 256.0f; x += 128.0f)
+        {
+            mockProviders.emplace_back(AZStd::make_unique<MockSurfaceProvider>(
+                MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags, AZ::Vector3(x, y, 0.0f),
+                AZ::Vector3(x + 128.0f, y + 128.0f, 1.0f), AZ::Vector3(2.0f, 2.0f, 4.0f),
+                AZ::EntityId(0x12345678 + mockProviders.size())));
+        }
+    }
+
+    SurfaceData::SurfaceTagVector largeProviderTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider largeMockProvider(
+        MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, largeProviderTags, AZ::Vector3(0.0f, 0.0f, 10.0f),
+        AZ::Vector3(256.0f, 256.0f, 11.0f), AZ::Vector3(2.0f, 2.0f, 4.0f), AZ::EntityId(0x87654321));
+
+    // Query every provider point, which is enough input positions to use the batched provider queries.
+    AZStd::vector<AZ::Vector3> queryPositions;
+    for (float y = 0.0f; y < 256.0f; y += 2.0f)
+    {
+        for (float x = 0.0f; x < 256.0f; x += 2.0f)
+        {
+            queryPositions.push_back(AZ::Vector3(x, y, 16.0f));
+        }
+    }
+
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    SurfaceData::SurfacePointList availablePointsPerPosition;
+    AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromList(
+        queryPositions, testTags, availablePointsPerPosition);
+
+    // Every position should have one point from a small provider and one point from the large provider.
+    EXPECT_EQ(availablePointsPerPosition.GetSize(), queryPositions.size() * 2);
+
+    CompareSurfacePointListWithGetSurfacePoints(queryPositions, availablePointsPerPosition, testTags);
+}
+
+TEST(SurfaceDataRegistryIndexTest, SurfaceDataRegistryIndex_QueryFindsAllOverlappingEntries)
+{
+    // Insert, move, and remove a set of random entries, and verify that the index queries always return every entry
+    // that overlaps the query bounds, sorted and without duplicates.
+    SurfaceData::SurfaceDataRegistryIndex registryIndex(16.0f);
+    AZStd::unordered_map<SurfaceData::SurfaceDataRegistryHandle, AZ::Aabb> entries;
+    AZ::SimpleLcgRandom random(1234);
+
+    auto CreateRandomBounds = [&random]() -> AZ::Aabb
+    {
+        // Occasionally create infinite bounds or bounds that are too large to store in individual cells.
+        const float sizeChoice = random.GetRandomFloat();
+        if (sizeChoice < 0.05f)
+        {
+            return AZ::Aabb::CreateNull();
+        }
+
+        const float maxSize = (sizeChoice < 0.1f) ? 1000.0f : 40.0f;
+        const AZ::Vector3 min(random.GetRandomFloat() * 512.0f - 256.0f, random.GetRandomFloat() * 512.0f - 256.0f, 0.0f);
+        const AZ::Vector3 size(random.GetRandomFloat() * maxSize, random.GetRandomFloat() * maxSize, 1.0f);
+        return AZ::Aabb::CreateFromMinMax(min, min + size);
+    };
+
+    auto VerifyQuery = [&registryIndex, &entries](const AZ::Aabb& queryBounds)
+    {
+        AZStd::vector<SurfaceData::SurfaceDataRegistryHandle> handles;
+        registryIndex.Query(queryBounds, handles);
+
+        EXPECT_TRUE(AZStd::is_sorted(handles.begin(), handles.end()));
+        EXPECT_EQ(AZStd::adjacent_find(handles.begin(), handles.end()), handles.end());
+
+        for (const auto& [handle, bounds] : entries)
+        {
+            if (!bounds.IsValid() || !queryBounds.IsValid() || SurfaceData::AabbOverlaps2D(bounds, queryBounds))
+            {
+                EXPECT_TRUE(AZStd::binary_search(handles.begin(), handles.end(), handle));
+            }
+        }
+    };
+
+    constexpr SurfaceData::SurfaceDataRegistryHandle NumEntries = 500;
+    for (SurfaceData::SurfaceDataRegistryHandle handle = 1; handle <= NumEntries; handle++)
+    {
+        entries[handle] = CreateRandomBounds();
+        registryIndex.Insert(handle, entries[handle]);
+    }
+
+    for (int query = 0; query < 50; query++)
+    {
+        VerifyQuery(CreateRandomBounds());
+    }
+
+    // Move half of the entries and remove a quarter of them.
+    for (SurfaceData::SurfaceDataRegistryHandle handle = 1; handle <= NumEntries; handle++)
+    {
+        if (handle % 2 == 0)
+        {
+            const AZ::Aabb newBounds = CreateRandomBounds();
+            registryIndex.Update(handle, entries[handle], newBounds);
+            entries[handle] = newBounds;
+        }
+        else if (handle % 4 == 1)
+        {
+            registryIndex.Remove(handle, entries[handle]);
+            entries.erase(handle);
+        }
+    }
+
+    for (int query = 0; query < 50; query++)
+    {
+        VerifyQuery(CreateRandomBounds());
+    }
+
+    // Removing everything should leave no empty cells behind.
+    for (const auto& [handle, bounds] : entries)
+    {
+        registryIndex.Remove(handle, bounds);
+    }
+    EXPECT_EQ(registryIndex.GetCellCount(), 0);
+    EXPECT_TRUE(registryIndex.GetUnboundedEntries().empty());
+}
+
 TEST_F(SurfaceDataTestApp, SurfaceData_FirstPointFilteredOut_SurfacePointListRemovesFilteredPointsCorrectly)
 {
     // Arbitrary set of input points.
@@ -13,6 +13,7 @@ set(FILES
     Include/SurfaceData/MixedStackHeapAllocator.h
     Include/SurfaceData/SurfaceDataConstants.h
     Include/SurfaceData/SurfaceDataTypes.h
+    Include/SurfaceData/SurfaceDataRegistryIndex.h
     Include/SurfaceData/SurfaceDataSystemRequestBus.h
     Include/SurfaceData/SurfaceDataSystemNotificationBus.h
     Include/SurfaceData/SurfaceDataTagEnumeratorRequestBus.h
@@ -22,6 +23,7 @@ set(FILES
     Include/SurfaceData/SurfacePointList.h
     Include/SurfaceData/SurfaceTag.h
     Include/SurfaceData/Utility/SurfaceDataUtility.h
+    Source/SurfaceDataRegistryIndex.cpp
     Source/SurfaceDataSystemComponent.cpp
     Source/SurfaceDataTypes.cpp
     Source/SurfacePointList.cpp
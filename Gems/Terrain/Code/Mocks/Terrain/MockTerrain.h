@@ -39,6 +39,8 @@ namespace UnitTest
         MOCK_METHOD2(
             RefreshRegion,
             void(const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask));
+        MOCK_METHOD2(SaveTileCache, bool(const AZ::Aabb& region, const AZStd::string& filePath));
+        MOCK_METHOD1(LoadTileCache, bool(const AZStd::string& filePath));
     };
 
     class MockTerrainAreaHeightRequests : public Terrain::TerrainAreaHeightRequestBus::Handler
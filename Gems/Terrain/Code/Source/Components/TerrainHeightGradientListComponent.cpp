@@ -17,6 +17,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
+#include <GradientSignal/Ebuses/CompiledGradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
 
@@ -239,8 +240,7 @@ namespace Terrain
             {
                 if (gradientId.IsValid())
                 {
-                    GradientSignal::GradientRequestBus::Event(
-                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList, curGradientSamples);
+                    GradientSignal::GetGradientValues(gradientId, inOutPositionList, curGradientSamples);
 
                     for (size_t index = 0; index < maxValueSamples.size(); index++)
                     {
@@ -16,10 +16,12 @@
 #include <AzCore/Casting/lossy_cast.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
@@ -33,6 +35,20 @@ namespace Terrain
         AZ::ConsoleFunctorFlags::Null,
         "The maximum number of jobs to use when updating a Terrain Physics Collider (-1 will use all available cores).");
 
+    AZ_CVAR(bool, cl_terrainPhysicsColliderTiledUpdates, false, nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "When true, terrain data changes regenerate the Terrain Physics Collider in independent tiles on background jobs, and the "
+        "regenerated tiles are swapped in just before the next physics simulation step.");
+
+    AZ_CVAR(uint32_t, cl_terrainPhysicsColliderTileSize, 128, nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The number of heightfield points along each side of a Terrain Physics Collider tile when tiled updates are enabled.");
+
+    AZ_CVAR(uint32_t, cl_terrainPhysicsColliderMaxCachedTiles, 64, nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of regenerated tiles that a Terrain Physics Collider keeps after swapping them in. The least recently "
+        "used tiles beyond this are released, and the heightfield queries the terrain for those areas again.");
+
 
     Physics::HeightfieldProviderNotifications::HeightfieldChangeMask TerrainToPhysicsHeightfieldChangeMask(AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask mask)
     {
@@ -143,13 +159,19 @@ namespace Terrain
         LmbrCentral::ShapeComponentNotificationsBus::Handler::BusConnect(entityId);
         Physics::HeightfieldProviderRequestsBus::Handler::BusConnect(entityId);
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
     }
 
     void TerrainPhysicsColliderComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         Physics::HeightfieldProviderRequestsBus::Handler ::BusDisconnect();
         LmbrCentral::ShapeComponentNotificationsBus::Handler::BusDisconnect();
+
+        // Make sure any tile builds that are running finish up before we deactivate, since they reference this component.
+        ClearTiles();
+        BlockOnPendingTileUpdates();
     }
 
     void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange(
@@ -158,6 +180,9 @@ namespace Terrain
     {
         AZ_PROFILE_FUNCTION(Terrain);
 
+        // Any change that goes straight to the listeners might make the tiles stale, so they need to be regenerated from scratch.
+        ClearTiles();
+
         CalculateHeightfieldRegion();
 
         AZ::Aabb colliderBounds = GetHeightfieldAabb();
@@ -225,6 +250,15 @@ namespace Terrain
             Physics::HeightfieldProviderNotifications::HeightfieldChangeMask physicsMask =
                 TerrainToPhysicsHeightfieldChangeMask(dataChangedMask);
 
+            // Changes to the terrain data within a region can be regenerated in the background, one tile at a time.
+            // Settings changes can resize the heightfield, so those always need a full refresh.
+            if (cl_terrainPhysicsColliderTiledUpdates && dirtyRegion.IsValid() &&
+                ((dataChangedMask & AzFramework::Terrain::TerrainDataNotifications::Settings) == 0))
+            {
+                MarkTilesDirty(dirtyRegion, physicsMask);
+                return;
+            }
+
             NotifyListenersOfHeightfieldDataChange(physicsMask, dirtyRegion);
         }
     }
@@ -454,6 +488,12 @@ namespace Terrain
             return;
         }
 
+        // If the whole area has been regenerated into tiles, copy the samples from the tiles instead of querying the terrain.
+        if (UpdateHeightsAndMaterialsFromTiles(updateHeightsMaterialsCallback, startColumn, startRow, numColumns, numRows))
+        {
+            updateHeightsCompleteCallback();
+            return;
+        }
 
         AZ::Aabb worldSize = GetHeightfieldAabb();
         const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
@@ -483,38 +523,8 @@ namespace Terrain
             worldHeightBoundsMin, worldHeightBoundsMax]
             (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
         {
-            float height = surfacePoint.m_position.GetZ();
-
-            // Any heights that fall outside the range of our bounding box will get turned into holes.
-            if ((height < worldHeightBoundsMin) || (height > worldHeightBoundsMax))
-            {
-                height = worldHeightBoundsMin;
-                terrainExists = false;
-            }
-
-            // Find the best surface tag at this point.
-            // We want the MaxSurfaceWeight. The ProcessSurfacePoints callback has surface weights sorted.
-            // So, we pick the value at the front of the list.
-            AzFramework::SurfaceData::SurfaceTagWeight surfaceWeight;
-            if (!surfacePoint.m_surfaceTags.empty())
-            {
-                surfaceWeight = *surfacePoint.m_surfaceTags.begin();
-            }
-
-            Physics::HeightMaterialPoint point;
-            point.m_height = height - worldCenterZ;
-            point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
-
-            // Get the material index for the surface type. If we can't find it, use the default material.
-            if (const auto& entry = surfaceTagToMaterialIndexLookup.find(surfaceWeight.m_surfaceType);
-                entry != surfaceTagToMaterialIndexLookup.end())
-            {
-                point.m_materialIndex = entry->second;
-            }
-            else
-            {
-                point.m_materialIndex = DefaultMaterialIndex;
-            }
+            Physics::HeightMaterialPoint point = ConvertToHeightMaterialPoint(
+                surfacePoint, terrainExists, surfaceTagToMaterialIndexLookup, worldCenterZ, worldHeightBoundsMin, worldHeightBoundsMax);
 
             size_t column = startColumn + xIndex;
             size_t row = startRow + yIndex;
@@ -687,4 +697,411 @@ namespace Terrain
 
         return heightMaterials;
     }
+
+    Physics::HeightMaterialPoint TerrainPhysicsColliderComponent::ConvertToHeightMaterialPoint(
+        const AzFramework::SurfaceData::SurfacePoint& surfacePoint,
+        bool terrainExists,
+        const AZStd::unordered_map<SurfaceData::SurfaceTag, uint8_t>& surfaceTagToMaterialIndexLookup,
+        float worldCenterZ,
+        float worldHeightBoundsMin,
+        float worldHeightBoundsMax)
+    {
+        float height = surfacePoint.m_position.GetZ();
+
+        // Any heights that fall outside the range of our bounding box will get turned into holes.
+        if ((height < worldHeightBoundsMin) || (height > worldHeightBoundsMax))
+        {
+            height = worldHeightBoundsMin;
+            terrainExists = false;
+        }
+
+        // Find the best surface tag at this point.
+        // We want the MaxSurfaceWeight. The ProcessSurfacePoints callback has surface weights sorted.
+        // So, we pick the value at the front of the list.
+        AzFramework::SurfaceData::SurfaceTagWeight surfaceWeight;
+        if (!surfacePoint.m_surfaceTags.empty())
+        {
+            surfaceWeight = *surfacePoint.m_surfaceTags.begin();
+        }
+
+        Physics::HeightMaterialPoint point;
+        point.m_height = height - worldCenterZ;
+        point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
+
+        // Get the material index for the surface type. If we can't find it, use the default material.
+        if (const auto& entry = surfaceTagToMaterialIndexLookup.find(surfaceWeight.m_surfaceType);
+            entry != surfaceTagToMaterialIndexLookup.end())
+        {
+            point.m_materialIndex = entry->second;
+        }
+        else
+        {
+            point.m_materialIndex = DefaultMaterialIndex;
+        }
+
+        return point;
+    }
+
+    TerrainPhysicsColliderComponent::TileKey TerrainPhysicsColliderComponent::MakeTileKey(size_t tileX, size_t tileY)
+    {
+        return (static_cast<TileKey>(tileX) << 32) | static_cast<TileKey>(tileY & 0xFFFFFFFF);
+    }
+
+    void TerrainPhysicsColliderComponent::MarkTilesDirty(
+        const AZ::Aabb& dirtyRegion, Physics::HeightfieldProviderNotifications::HeightfieldChangeMask heightfieldChangeMask)
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        const AZ::Aabb worldSize = GetHeightfieldAabb();
+        if (!worldSize.IsValid() || !dirtyRegion.Overlaps(worldSize))
+        {
+            return;
+        }
+
+        size_t startColumn, startRow, numColumns, numRows;
+        GetHeightfieldIndicesFromRegion(dirtyRegion, startColumn, startRow, numColumns, numRows);
+
+        // Capture everything the build jobs need up front, so that they don't need to query the shape or the component state.
+        auto context = AZStd::make_shared<TileBuildContext>();
+        context->m_gridOrigin = AZ::Vector2(worldSize.GetMin());
+        context->m_gridSpacing = GetHeightfieldGridSpacing();
+        GetHeightfieldGridSize(context->m_gridColumns, context->m_gridRows);
+        context->m_tileSize = AZStd::max<size_t>(cl_terrainPhysicsColliderTileSize, 1);
+        context->m_worldCenterZ = worldSize.GetCenter().GetZ();
+        context->m_worldHeightBoundsMin = worldSize.GetMin().GetZ();
+        context->m_worldHeightBoundsMax = worldSize.GetMax().GetZ();
+        {
+            AZStd::shared_lock lock(m_stateMutex);
+            context->m_surfaceTagToMaterialIndexLookup = m_surfaceTagToMaterialIndexLookup;
+        }
+
+        if ((numColumns == 0) || (numRows == 0) || (startColumn >= context->m_gridColumns) || (startRow >= context->m_gridRows))
+        {
+            return;
+        }
+
+        const size_t endColumn = AZStd::min(startColumn + numColumns, context->m_gridColumns);
+        const size_t endRow = AZStd::min(startRow + numRows, context->m_gridRows);
+
+        AZStd::vector<AZStd::pair<TileKey, AZ::u32>> tilesToBuild;
+
+        {
+            AZStd::lock_guard lock(m_tileMutex);
+
+            // Tiles built with a different tile size can't be reused.
+            if (context->m_tileSize != m_tileSize)
+            {
+                ++m_tileGeneration;
+                m_tiles.clear();
+                m_hasPendingTiles = false;
+                m_tileSize = context->m_tileSize;
+            }
+
+            context->m_generation = m_tileGeneration;
+
+            for (size_t tileY = startRow / m_tileSize; tileY <= (endRow - 1) / m_tileSize; tileY++)
+            {
+                for (size_t tileX = startColumn / m_tileSize; tileX <= (endColumn - 1) / m_tileSize; tileX++)
+                {
+                    const TileKey key = MakeTileKey(tileX, tileY);
+                    HeightfieldTileState& state = m_tiles[key];
+                    state.m_context = context;
+                    state.m_version++;
+                    state.m_changeMask |= heightfieldChangeMask;
+
+                    // If the tile is already building, it will get rebuilt with this context when that build finishes because its
+                    // version changed.
+                    if (!state.m_building)
+                    {
+                        state.m_building = true;
+                        m_tileBuildsRunning++;
+                        tilesToBuild.emplace_back(key, state.m_version);
+                    }
+                }
+            }
+        }
+
+        for (const auto& [key, version] : tilesToBuild)
+        {
+            StartTileBuild(key, version, context);
+        }
+    }
+
+    void TerrainPhysicsColliderComponent::StartTileBuild(TileKey key, AZ::u32 version, AZStd::shared_ptr<const TileBuildContext> context)
+    {
+        auto* job = AZ::CreateJobFunction(
+            [this, key, version, context]()
+            {
+                BuildTile(key, version, context);
+            },
+            true);
+        job->Start();
+    }
+
+    void TerrainPhysicsColliderComponent::BuildTile(TileKey key, AZ::u32 version, AZStd::shared_ptr<const TileBuildContext> context)
+    {
+        using namespace AzFramework::Terrain;
+
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        const size_t tileX = aznumeric_cast<size_t>(key >> 32);
+        const size_t tileY = aznumeric_cast<size_t>(key & 0xFFFFFFFF);
+
+        auto tile = AZStd::make_shared<HeightfieldTile>();
+        tile->m_startColumn = tileX * context->m_tileSize;
+        tile->m_startRow = tileY * context->m_tileSize;
+        tile->m_numColumns = AZStd::min(context->m_tileSize, context->m_gridColumns - tile->m_startColumn);
+        tile->m_numRows = AZStd::min(context->m_tileSize, context->m_gridRows - tile->m_startRow);
+        tile->m_samples.resize(tile->m_numColumns * tile->m_numRows);
+
+        const AZ::Vector2 startPoint = context->m_gridOrigin +
+            (AZ::Vector2(aznumeric_cast<float>(tile->m_startColumn), aznumeric_cast<float>(tile->m_startRow)) * context->m_gridSpacing);
+        TerrainQueryRegion queryRegion(startPoint, tile->m_numColumns, tile->m_numRows, context->m_gridSpacing);
+
+        auto perPositionCallback = [&tile, &context]
+            (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        {
+            tile->m_samples[(yIndex * tile->m_numColumns) + xIndex] = ConvertToHeightMaterialPoint(
+                surfacePoint, terrainExists, context->m_surfaceTagToMaterialIndexLookup, context->m_worldCenterZ,
+                context->m_worldHeightBoundsMin, context->m_worldHeightBoundsMax);
+        };
+
+        // This is already running on a job, so the tile is queried synchronously. Tiles are built in parallel with each other.
+        // We can use the "EXACT" sampler here because our query points are guaranteed to be aligned with terrain grid points.
+        TerrainDataRequestBus::Broadcast(
+            &TerrainDataRequests::QueryRegion, queryRegion,
+            static_cast<TerrainDataRequests::TerrainDataMask>(
+                TerrainDataRequests::TerrainDataMask::Heights | TerrainDataRequests::TerrainDataMask::SurfaceData),
+            perPositionCallback, TerrainDataRequests::Sampler::EXACT);
+
+        bool rebuild = false;
+        AZ::u32 latestVersion = version;
+        AZStd::shared_ptr<const TileBuildContext> latestContext;
+
+        {
+            AZStd::lock_guard lock(m_tileMutex);
+
+            // Results for tiles that were cleared while this was building are discarded.
+            if (auto entry = m_tiles.find(key); (context->m_generation == m_tileGeneration) && (entry != m_tiles.end()))
+            {
+                HeightfieldTileState& state = entry->second;
+                state.m_pending = AZStd::move(tile);
+                m_hasPendingTiles = true;
+
+                // The tile changed again while it was building, so keep the new samples (they're at least as recent as the
+                // current ones) but build it one more time with the context captured by the latest change.
+                if (state.m_version != version)
+                {
+                    rebuild = true;
+                    latestVersion = state.m_version;
+                    latestContext = state.m_context;
+                }
+                else
+                {
+                    state.m_building = false;
+                }
+            }
+
+            if (!rebuild)
+            {
+                m_tileBuildsRunning--;
+            }
+        }
+
+        if (rebuild)
+        {
+            StartTileBuild(key, latestVersion, AZStd::move(latestContext));
+        }
+        else
+        {
+            m_tileBuildsComplete.notify_all();
+        }
+    }
+
+    void TerrainPhysicsColliderComponent::ApplyPendingTiles()
+    {
+        if (!m_hasPendingTiles)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        using Physics::HeightfieldProviderNotifications;
+
+        size_t minColumn = AZStd::numeric_limits<size_t>::max();
+        size_t minRow = AZStd::numeric_limits<size_t>::max();
+        size_t maxColumn = 0;
+        size_t maxRow = 0;
+        HeightfieldProviderNotifications::HeightfieldChangeMask changeMask = HeightfieldProviderNotifications::HeightfieldChangeMask::None;
+
+        {
+            AZStd::lock_guard lock(m_tileMutex);
+
+            for (auto& [key, state] : m_tiles)
+            {
+                if (state.m_pending)
+                {
+                    state.m_current = AZStd::move(state.m_pending);
+                    state.m_lastUsed = ++m_tileUseCounter;
+
+                    minColumn = AZStd::min(minColumn, state.m_current->m_startColumn);
+                    minRow = AZStd::min(minRow, state.m_current->m_startRow);
+                    maxColumn = AZStd::max(maxColumn, state.m_current->m_startColumn + state.m_current->m_numColumns - 1);
+                    maxRow = AZStd::max(maxRow, state.m_current->m_startRow + state.m_current->m_numRows - 1);
+                    changeMask |= state.m_changeMask;
+
+                    // Tiles that are still building keep their change mask so that it's reported again when the build is swapped in.
+                    if (!state.m_building)
+                    {
+                        state.m_changeMask = HeightfieldProviderNotifications::HeightfieldChangeMask::None;
+                    }
+                }
+            }
+
+            m_hasPendingTiles = false;
+
+            // The listeners read the swapped-in tiles after this, so they're stamped as the most recently used and released last.
+            EvictLeastRecentlyUsedTiles();
+        }
+
+        const AZ::Aabb worldSize = GetHeightfieldAabb();
+        if ((minColumn > maxColumn) || !worldSize.IsValid())
+        {
+            return;
+        }
+
+        // Notify the listeners about a single region covering all of the swapped tiles. The region is padded by a fraction of a
+        // grid square so that GetHeightfieldIndicesFromRegion() maps it back to exactly the same rows and columns.
+        const AZ::Vector2 gridSpacing = GetHeightfieldGridSpacing();
+        const AZ::Vector2 gridOrigin(worldSize.GetMin());
+        const AZ::Vector2 regionMin =
+            gridOrigin + (AZ::Vector2(aznumeric_cast<float>(minColumn), aznumeric_cast<float>(minRow)) - AZ::Vector2(0.25f)) * gridSpacing;
+        const AZ::Vector2 regionMax =
+            gridOrigin + (AZ::Vector2(aznumeric_cast<float>(maxColumn), aznumeric_cast<float>(maxRow)) + AZ::Vector2(0.25f)) * gridSpacing;
+
+        AZ::Aabb dirtyBounds = AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(regionMin.GetX(), regionMin.GetY(), worldSize.GetMin().GetZ()),
+            AZ::Vector3(regionMax.GetX(), regionMax.GetY(), worldSize.GetMax().GetZ()));
+        dirtyBounds.Clamp(worldSize);
+
+        Physics::HeightfieldProviderNotificationBus::Event(
+            GetEntityId(), &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, dirtyBounds, changeMask);
+    }
+
+    void TerrainPhysicsColliderComponent::EvictLeastRecentlyUsedTiles()
+    {
+        const size_t maxCachedTiles = cl_terrainPhysicsColliderMaxCachedTiles;
+        if (m_tiles.size() <= maxCachedTiles)
+        {
+            return;
+        }
+
+        AZStd::vector<AZStd::pair<AZ::u64, TileKey>> idleTiles;
+        idleTiles.reserve(m_tiles.size());
+        for (const auto& [key, state] : m_tiles)
+        {
+            if (!state.m_building && !state.m_pending)
+            {
+                idleTiles.emplace_back(state.m_lastUsed, key);
+            }
+        }
+
+        AZStd::sort(idleTiles.begin(), idleTiles.end());
+
+        // Idle tiles have no unreported changes, so dropping the whole entry loses nothing. Areas without a tile are queried
+        // from the terrain.
+        const size_t evictCount = AZStd::min(m_tiles.size() - maxCachedTiles, idleTiles.size());
+        for (size_t index = 0; index < evictCount; ++index)
+        {
+            m_tiles.erase(idleTiles[index].second);
+        }
+    }
+
+    void TerrainPhysicsColliderComponent::ClearTiles()
+    {
+        AZStd::lock_guard lock(m_tileMutex);
+
+        ++m_tileGeneration;
+        m_tiles.clear();
+        m_hasPendingTiles = false;
+    }
+
+    void TerrainPhysicsColliderComponent::BlockOnPendingTileUpdates()
+    {
+        AZStd::unique_lock lock(m_tileMutex);
+        m_tileBuildsComplete.wait(
+            lock,
+            [this]
+            {
+                return m_tileBuildsRunning == 0;
+            });
+    }
+
+    bool TerrainPhysicsColliderComponent::UpdateHeightsAndMaterialsFromTiles(
+        const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback,
+        size_t startColumn,
+        size_t startRow,
+        size_t numColumns,
+        size_t numRows) const
+    {
+        AZStd::vector<AZStd::shared_ptr<const HeightfieldTile>> tiles;
+
+        {
+            AZStd::lock_guard lock(m_tileMutex);
+
+            if (m_tiles.empty())
+            {
+                return false;
+            }
+
+            for (size_t tileY = startRow / m_tileSize; tileY <= (startRow + numRows - 1) / m_tileSize; tileY++)
+            {
+                for (size_t tileX = startColumn / m_tileSize; tileX <= (startColumn + numColumns - 1) / m_tileSize; tileX++)
+                {
+                    auto entry = m_tiles.find(MakeTileKey(tileX, tileY));
+                    if ((entry == m_tiles.end()) || !entry->second.m_current)
+                    {
+                        return false;
+                    }
+                    entry->second.m_lastUsed = ++m_tileUseCounter;
+                    tiles.push_back(entry->second.m_current);
+                }
+            }
+        }
+
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        // The tiles are held by shared pointers, so they stay valid even if they're swapped out while we're reading them.
+        for (const auto& tile : tiles)
+        {
+            const size_t firstColumn = AZStd::max(startColumn, tile->m_startColumn);
+            const size_t lastColumn = AZStd::min(startColumn + numColumns, tile->m_startColumn + tile->m_numColumns);
+            const size_t firstRow = AZStd::max(startRow, tile->m_startRow);
+            const size_t lastRow = AZStd::min(startRow + numRows, tile->m_startRow + tile->m_numRows);
+
+            for (size_t row = firstRow; row < lastRow; row++)
+            {
+                const size_t rowOffset = (row - tile->m_startRow) * tile->m_numColumns;
+                for (size_t column = firstColumn; column < lastColumn; column++)
+                {
+                    updateHeightsMaterialsCallback(column, row, tile->m_samples[rowOffset + (column - tile->m_startColumn)]);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void TerrainPhysicsColliderComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ApplyPendingTiles();
+    }
+
+    int TerrainPhysicsColliderComponent::GetTickOrder()
+    {
+        // Swap in the regenerated tiles right before the physics system simulates, so that each simulation step sees a
+        // consistent heightfield.
+        return AZ::ComponentTickBus::TICK_PHYSICS_SYSTEM - 1;
+    }
 }
@@ -9,8 +9,13 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include <AzFramework/Physics/HeightfieldProviderBus.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialAsset.h>
@@ -72,6 +77,7 @@ namespace Terrain
         , public Physics::HeightfieldProviderRequestsBus::Handler
         , protected LmbrCentral::ShapeComponentNotificationsBus::Handler
         , protected AzFramework::Terrain::TerrainDataNotificationBus::Handler
+        , protected AZ::TickBus::Handler
     {
     public:
         friend class EditorTerrainPhysicsColliderComponent;
@@ -119,6 +125,9 @@ namespace Terrain
 
         void UpdateConfiguration(const TerrainPhysicsColliderConfig& newConfiguration);
 
+        //! Block until all of the background jobs that are regenerating dirty heightfield tiles have completed.
+        void BlockOnPendingTileUpdates();
+
     protected:
         //////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
@@ -141,6 +150,10 @@ namespace Terrain
         void OnTerrainDataDestroyBegin() override;
         void OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask) override;
 
+        // AZ::TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
         void CalculateHeightfieldRegion();
         void BuildSurfaceTagToMaterialIndexLookup();
 
@@ -148,6 +161,93 @@ namespace Terrain
         // The default material will always be the first material in the material list.
         static inline constexpr uint8_t DefaultMaterialIndex = 0;
 
+        using TileKey = AZ::u64;
+
+        //! A block of heightfield samples that is regenerated independently of the rest of the heightfield when the terrain changes.
+        struct HeightfieldTile
+        {
+            size_t m_startColumn = 0;
+            size_t m_startRow = 0;
+            size_t m_numColumns = 0;
+            size_t m_numRows = 0;
+
+            //! The samples in the tile, in row-major order.
+            AZStd::vector<Physics::HeightMaterialPoint> m_samples;
+        };
+
+        //! Everything that a tile build job needs to generate its samples, captured when the tiles are marked dirty.
+        struct TileBuildContext
+        {
+            AZ::Vector2 m_gridOrigin = AZ::Vector2::CreateZero();
+            AZ::Vector2 m_gridSpacing = AZ::Vector2::CreateOne();
+            size_t m_gridColumns = 0;
+            size_t m_gridRows = 0;
+            size_t m_tileSize = 0;
+            float m_worldCenterZ = 0.0f;
+            float m_worldHeightBoundsMin = 0.0f;
+            float m_worldHeightBoundsMax = 0.0f;
+            AZStd::unordered_map<SurfaceData::SurfaceTag, uint8_t> m_surfaceTagToMaterialIndexLookup;
+            AZ::u64 m_generation = 0;
+        };
+
+        struct HeightfieldTileState
+        {
+            //! The samples that the heightfield is currently using for this tile.
+            AZStd::shared_ptr<const HeightfieldTile> m_current;
+
+            //! Newly-generated samples that will replace the current ones just before the next physics simulation step.
+            AZStd::shared_ptr<const HeightfieldTile> m_pending;
+
+            //! The types of changes that haven't been reported to the heightfield listeners yet.
+            Physics::HeightfieldProviderNotifications::HeightfieldChangeMask m_changeMask =
+                Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::None;
+
+            //! The build context captured the last time the tile was marked dirty, which a rerun of the build uses.
+            AZStd::shared_ptr<const TileBuildContext> m_context;
+
+            //! Incremented every time the tile is marked dirty, so that a build that started before the latest change is rerun.
+            AZ::u32 m_version = 0;
+
+            //! Stamped from m_tileUseCounter whenever the tile is swapped in or read, so that the least recently used tiles can be released.
+            mutable AZ::u64 m_lastUsed = 0;
+
+            bool m_building = false;
+        };
+
+        static TileKey MakeTileKey(size_t tileX, size_t tileY);
+
+        //! Convert a terrain surface point into a heightfield sample relative to the heightfield center.
+        static Physics::HeightMaterialPoint ConvertToHeightMaterialPoint(
+            const AzFramework::SurfaceData::SurfacePoint& surfacePoint,
+            bool terrainExists,
+            const AZStd::unordered_map<SurfaceData::SurfaceTag, uint8_t>& surfaceTagToMaterialIndexLookup,
+            float worldCenterZ,
+            float worldHeightBoundsMin,
+            float worldHeightBoundsMax);
+
+        //! Mark every tile that overlaps the dirty region as needing regeneration, and start build jobs for them.
+        void MarkTilesDirty(
+            const AZ::Aabb& dirtyRegion, Physics::HeightfieldProviderNotifications::HeightfieldChangeMask heightfieldChangeMask);
+
+        void StartTileBuild(TileKey key, AZ::u32 version, AZStd::shared_ptr<const TileBuildContext> context);
+        void BuildTile(TileKey key, AZ::u32 version, AZStd::shared_ptr<const TileBuildContext> context);
+
+        //! Swap in every tile that has finished regenerating and notify the heightfield listeners about the changed area.
+        void ApplyPendingTiles();
+
+        //! Release the least recently used tiles beyond cl_terrainPhysicsColliderMaxCachedTiles. Tiles that are building or waiting
+        //! to be swapped in are kept. Requires m_tileMutex to be locked.
+        void EvictLeastRecentlyUsedTiles();
+
+        //! Discard all tiles. Any tile builds that are running will have their results discarded.
+        void ClearTiles();
+
+        //! Update the requested samples from the current tiles.
+        //! @return False if any part of the requested area isn't covered by a current tile, in which case nothing is updated.
+        bool UpdateHeightsAndMaterialsFromTiles(
+            const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback,
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows) const;
+
         TerrainPhysicsColliderConfig m_configuration;
         AZStd::atomic_bool m_terrainDataActive = false;
         AzFramework::Terrain::TerrainQueryRegion m_heightfieldRegion;
@@ -155,5 +255,16 @@ namespace Terrain
 
         // Protect state reads from happening in parallel with state writes.
         mutable AZStd::shared_mutex m_stateMutex;
+
+        // Tiles that have been regenerated in the background because of terrain data changes.
+        // This is never locked at the same time as m_stateMutex.
+        mutable AZStd::mutex m_tileMutex;
+        AZStd::condition_variable m_tileBuildsComplete;
+        AZStd::unordered_map<TileKey, HeightfieldTileState> m_tiles;
+        size_t m_tileSize = 0;
+        size_t m_tileBuildsRunning = 0;
+        AZ::u64 m_tileGeneration = 0;
+        mutable AZ::u64 m_tileUseCounter = 0;
+        AZStd::atomic_bool m_hasPendingTiles = false;
     };
 }
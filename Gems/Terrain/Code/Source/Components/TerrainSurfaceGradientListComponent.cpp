@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
+#include <GradientSignal/Ebuses/CompiledGradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
@@ -194,8 +195,7 @@ namespace Terrain
 
         for (const auto& mapping : m_configuration.m_gradientSurfaceMappings)
         {
-            GradientSignal::GradientRequestBus::Event(
-                mapping.m_gradientEntityId, &GradientSignal::GradientRequestBus::Events::GetValues, inPositionList, gradientValues);
+            GradientSignal::GetGradientValues(mapping.m_gradientEntityId, inPositionList, gradientValues);
 
             for (size_t index = 0; index < outSurfaceWeightsList.size(); index++)
             {
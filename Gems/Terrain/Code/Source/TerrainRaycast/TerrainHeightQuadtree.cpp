@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainRaycast/TerrainHeightQuadtree.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+
+AZ_DECLARE_BUDGET(Terrain);
+
+namespace Terrain
+{
+    namespace
+    {
+        // Node bounds are expanded by this fraction of the grid resolution so that rays that run exactly along a node boundary
+        // don't slip between the nodes on either side of it due to floating-point error.
+        constexpr float NodeBoundsTolerance = 1.0e-4f;
+
+        // Node height ranges are expanded by this amount for the same reason.
+        constexpr float NodeHeightTolerance = 1.0e-3f;
+    } // namespace
+
+    const TerrainHeightQuadtree::HeightRange& TerrainHeightQuadtree::Chunk::GetNodeRange(int32_t level, int32_t nodeX, int32_t nodeY) const
+    {
+        AZ_Assert(level > 0, "The height ranges of individual grid squares aren't stored.");
+        const int32_t nodesPerSide = ChunkSize >> level;
+        return m_nodeRanges[GetLevelOffsets()[level] + (nodeY * nodesPerSide) + nodeX];
+    }
+
+    float TerrainHeightQuadtree::Chunk::GetHeight(int32_t pointX, int32_t pointY) const
+    {
+        return m_heights[(pointY * ChunkPointsPerSide) + pointX];
+    }
+
+    void TerrainHeightQuadtree::SetQueryResolution(float heightQueryResolution)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+            if (m_queryResolution == heightQueryResolution)
+            {
+                return;
+            }
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+        m_queryResolution = heightQueryResolution;
+        m_chunks.clear();
+        m_chunkOrder.clear();
+        m_generation++;
+    }
+
+    void TerrainHeightQuadtree::SetMaxChunks(size_t maxChunks)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+            if (m_maxChunks == maxChunks)
+            {
+                return;
+            }
+        }
+
+        // The new limit is applied the next time a chunk is built.
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+        m_maxChunks = maxChunks;
+    }
+
+    void TerrainHeightQuadtree::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+        m_chunks.clear();
+        m_chunkOrder.clear();
+        m_generation++;
+    }
+
+    void TerrainHeightQuadtree::Invalidate(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+        m_generation++;
+
+        if (m_chunks.empty())
+        {
+            return;
+        }
+
+        // Chunks share the grid points along their edges with their neighbors, and each grid square depends on all four of its
+        // corners, so expand the region by a grid square to catch the chunks that only touch it.
+        const float chunkWorldSize = ChunkSize * m_queryResolution;
+        const float minChunkX = AZStd::floor((region.GetMin().GetX() - m_queryResolution) / chunkWorldSize);
+        const float minChunkY = AZStd::floor((region.GetMin().GetY() - m_queryResolution) / chunkWorldSize);
+        const float maxChunkX = AZStd::floor((region.GetMax().GetX() + m_queryResolution) / chunkWorldSize);
+        const float maxChunkY = AZStd::floor((region.GetMax().GetY() + m_queryResolution) / chunkWorldSize);
+
+        // There are never more than a few hundred chunks, so it's cheaper to check each one than to walk every chunk position
+        // in the region, which could be huge.
+        for (auto chunk = m_chunks.begin(); chunk != m_chunks.end();)
+        {
+            const float chunkX = aznumeric_cast<float>(static_cast<int32_t>(static_cast<uint32_t>(chunk->first >> 32)));
+            const float chunkY = aznumeric_cast<float>(static_cast<int32_t>(static_cast<uint32_t>(chunk->first & 0xFFFFFFFF)));
+            if ((chunkX >= minChunkX) && (chunkX <= maxChunkX) && (chunkY >= minChunkY) && (chunkY <= maxChunkY))
+            {
+                chunk = m_chunks.erase(chunk);
+            }
+            else
+            {
+                ++chunk;
+            }
+        }
+
+        m_chunkOrder.erase(
+            AZStd::remove_if(
+                m_chunkOrder.begin(), m_chunkOrder.end(),
+                [this](ChunkKey key)
+                {
+                    return m_chunks.find(key) == m_chunks.end();
+                }),
+            m_chunkOrder.end());
+    }
+
+    bool TerrainHeightQuadtree::RayIntersectChunk(
+        int32_t chunkX,
+        int32_t chunkY,
+        const AZ::Vector3& rayStart,
+        const AZ::Vector3& rayEnd,
+        float tStart,
+        float tEnd,
+        const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+        const HeightQueryCallback& queryHeights,
+        AzFramework::RenderGeometry::RayResult& outResult)
+    {
+        AZStd::shared_ptr<const Chunk> chunk = GetOrBuildChunk(chunkX, chunkY, queryHeights);
+
+        const RayTrace ray{ rayStart, rayEnd - rayStart, &hitTester };
+
+        const float tolerance = NodeBoundsTolerance * chunk->m_resolution;
+        const float chunkWorldSize = ChunkSize * chunk->m_resolution;
+        float tMin = tStart;
+        float tMax = tEnd;
+        if (!ClipToBox(
+                ray, chunk->m_originX - tolerance, chunk->m_originY - tolerance, chunk->m_originX + chunkWorldSize + tolerance,
+                chunk->m_originY + chunkWorldSize + tolerance, tMin, tMax))
+        {
+            return false;
+        }
+
+        return RayIntersectNode(*chunk, ray, LevelCount - 1, 0, 0, tMin, tMax, outResult);
+    }
+
+    float TerrainHeightQuadtree::GetChunkWorldSize() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+        return ChunkSize * m_queryResolution;
+    }
+
+    size_t TerrainHeightQuadtree::GetChunkCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+        return m_chunks.size();
+    }
+
+    void TerrainHeightQuadtree::IntersectGridSquare(
+        const AZ::Vector3& minCorner,
+        const AZ::Vector3& minXMaxYCorner,
+        const AZ::Vector3& maxCorner,
+        const AZ::Vector3& maxXMinYCorner,
+        const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+        AzFramework::RenderGeometry::RayResult& result)
+    {
+        AZ::Vector3 bottomLeftHitNormal;
+        float bottomLeftHitDistance;
+        bool bottomLeftHit =
+            hitTester.IntersectSegmentTriangleCCW(minCorner, maxXMinYCorner, minXMaxYCorner, bottomLeftHitNormal, bottomLeftHitDistance);
+
+        AZ::Vector3 topRightHitNormal;
+        float topRightHitDistance;
+        bool topRightHit =
+            hitTester.IntersectSegmentTriangleCCW(maxCorner, minXMaxYCorner, maxXMinYCorner, topRightHitNormal, topRightHitDistance);
+
+        if (bottomLeftHit && (!topRightHit || (bottomLeftHitDistance < topRightHitDistance)))
+        {
+            result.m_distance = bottomLeftHitDistance;
+            result.m_worldNormal = bottomLeftHitNormal;
+            result.m_worldPosition = hitTester.GetIntersectionPoint(result.m_distance);
+        }
+        else if (topRightHit)
+        {
+            result.m_distance = topRightHitDistance;
+            result.m_worldNormal = topRightHitNormal;
+            result.m_worldPosition = hitTester.GetIntersectionPoint(result.m_distance);
+        }
+    }
+
+    TerrainHeightQuadtree::ChunkKey TerrainHeightQuadtree::MakeChunkKey(int32_t chunkX, int32_t chunkY)
+    {
+        return (static_cast<ChunkKey>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<ChunkKey>(static_cast<uint32_t>(chunkY));
+    }
+
+    const AZStd::array<size_t, TerrainHeightQuadtree::LevelCount>& TerrainHeightQuadtree::GetLevelOffsets()
+    {
+        static const AZStd::array<size_t, LevelCount> levelOffsets = []()
+        {
+            AZStd::array<size_t, LevelCount> offsets;
+            size_t offset = 0;
+            offsets[0] = 0;
+            for (int32_t level = 1; level < LevelCount; level++)
+            {
+                offsets[level] = offset;
+                const size_t nodesPerSide = ChunkSize >> level;
+                offset += nodesPerSide * nodesPerSide;
+            }
+            return offsets;
+        }();
+
+        return levelOffsets;
+    }
+
+    bool TerrainHeightQuadtree::ClipToBox(
+        const RayTrace& ray, float minX, float minY, float maxX, float maxY, float& inOutTMin, float& inOutTMax)
+    {
+        const float boxMin[2] = { minX, minY };
+        const float boxMax[2] = { maxX, maxY };
+        const float start[2] = { ray.m_start.GetX(), ray.m_start.GetY() };
+        const float delta[2] = { ray.m_delta.GetX(), ray.m_delta.GetY() };
+
+        for (int axis = 0; axis < 2; axis++)
+        {
+            if (delta[axis] == 0.0f)
+            {
+                // The ray isn't moving on this axis, so it's either always or never inside the box on this axis.
+                if ((start[axis] < boxMin[axis]) || (start[axis] > boxMax[axis]))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            const float inverseDelta = 1.0f / delta[axis];
+            float t0 = (boxMin[axis] - start[axis]) * inverseDelta;
+            float t1 = (boxMax[axis] - start[axis]) * inverseDelta;
+            if (t0 > t1)
+            {
+                AZStd::swap(t0, t1);
+            }
+
+            inOutTMin = AZStd::max(inOutTMin, t0);
+            inOutTMax = AZStd::min(inOutTMax, t1);
+        }
+
+        return inOutTMin <= inOutTMax;
+    }
+
+    AZStd::shared_ptr<const TerrainHeightQuadtree::Chunk> TerrainHeightQuadtree::GetOrBuildChunk(
+        int32_t chunkX, int32_t chunkY, const HeightQueryCallback& queryHeights)
+    {
+        const ChunkKey key = MakeChunkKey(chunkX, chunkY);
+        float resolution;
+        AZ::u64 generation;
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+            if (auto chunk = m_chunks.find(key); chunk != m_chunks.end())
+            {
+                return chunk->second;
+            }
+
+            resolution = m_queryResolution;
+            generation = m_generation;
+        }
+
+        // Build the chunk without holding the lock so that other rays can keep using the existing chunks.
+        AZStd::shared_ptr<const Chunk> builtChunk = BuildChunk(chunkX, chunkY, resolution, queryHeights);
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_chunkMutex);
+
+        // If any chunks were removed while this one was being built, it might contain stale heights. It's still as correct as
+        // querying the terrain directly would have been for this ray, but it shouldn't be kept for future rays.
+        if (generation != m_generation)
+        {
+            return builtChunk;
+        }
+
+        auto [chunk, inserted] = m_chunks.emplace(key, builtChunk);
+        if (!inserted)
+        {
+            // Another thread built the same chunk first.
+            return chunk->second;
+        }
+
+        m_chunkOrder.push_back(key);
+        while (m_chunks.size() > m_maxChunks && !m_chunkOrder.empty())
+        {
+            m_chunks.erase(m_chunkOrder.front());
+            m_chunkOrder.pop_front();
+        }
+
+        return builtChunk;
+    }
+
+    AZStd::shared_ptr<TerrainHeightQuadtree::Chunk> TerrainHeightQuadtree::BuildChunk(
+        int32_t chunkX, int32_t chunkY, float resolution, const HeightQueryCallback& queryHeights) const
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        auto chunk = AZStd::make_shared<Chunk>();
+        chunk->m_resolution = resolution;
+        chunk->m_originX = aznumeric_cast<float>(chunkX) * ChunkSize * resolution;
+        chunk->m_originY = aznumeric_cast<float>(chunkY) * ChunkSize * resolution;
+
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(ChunkPointsPerSide * ChunkPointsPerSide);
+        for (int32_t y = 0; y < ChunkPointsPerSide; y++)
+        {
+            const float worldY = chunk->m_originY + (y * resolution);
+            for (int32_t x = 0; x < ChunkPointsPerSide; x++)
+            {
+                positions.emplace_back(chunk->m_originX + (x * resolution), worldY, 0.0f);
+            }
+        }
+
+        queryHeights(positions);
+
+        chunk->m_heights.resize(positions.size());
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            chunk->m_heights[index] = positions[index].GetZ();
+        }
+
+        const auto& levelOffsets = GetLevelOffsets();
+        chunk->m_nodeRanges.resize(levelOffsets[LevelCount - 1] + 1);
+
+        // The first stored level contains the height range of all the grid points in each 2x2 block of grid squares.
+        for (int32_t y = 0; y < (ChunkSize / 2); y++)
+        {
+            for (int32_t x = 0; x < (ChunkSize / 2); x++)
+            {
+                HeightRange range = { AZStd::numeric_limits<float>::max(), AZStd::numeric_limits<float>::lowest() };
+                for (int32_t pointY = y * 2; pointY <= (y * 2) + 2; pointY++)
+                {
+                    for (int32_t pointX = x * 2; pointX <= (x * 2) + 2; pointX++)
+                    {
+                        const float height = chunk->GetHeight(pointX, pointY);
+                        range.m_min = AZStd::min(range.m_min, height);
+                        range.m_max = AZStd::max(range.m_max, height);
+                    }
+                }
+                chunk->m_nodeRanges[(y * (ChunkSize / 2)) + x] = range;
+            }
+        }
+
+        // Each higher level contains the combined height range of the four nodes below it.
+        for (int32_t level = 2; level < LevelCount; level++)
+        {
+            const int32_t nodesPerSide = ChunkSize >> level;
+            for (int32_t y = 0; y < nodesPerSide; y++)
+            {
+                for (int32_t x = 0; x < nodesPerSide; x++)
+                {
+                    const HeightRange& child00 = chunk->GetNodeRange(level - 1, x * 2, y * 2);
+                    const HeightRange& child10 = chunk->GetNodeRange(level - 1, (x * 2) + 1, y * 2);
+                    const HeightRange& child01 = chunk->GetNodeRange(level - 1, x * 2, (y * 2) + 1);
+                    const HeightRange& child11 = chunk->GetNodeRange(level - 1, (x * 2) + 1, (y * 2) + 1);
+                    chunk->m_nodeRanges[levelOffsets[level] + (y * nodesPerSide) + x] = {
+                        AZStd::min(AZStd::min(child00.m_min, child10.m_min), AZStd::min(child01.m_min, child11.m_min)),
+                        AZStd::max(AZStd::max(child00.m_max, child10.m_max), AZStd::max(child01.m_max, child11.m_max))
+                    };
+                }
+            }
+        }
+
+        return chunk;
+    }
+
+    bool TerrainHeightQuadtree::RayIntersectNode(
+        const Chunk& chunk,
+        const RayTrace& ray,
+        int32_t level,
+        int32_t nodeX,
+        int32_t nodeY,
+        float tMin,
+        float tMax,
+        AzFramework::RenderGeometry::RayResult& outResult) const
+    {
+        const float resolution = chunk.m_resolution;
+
+        if (level == 0)
+        {
+            // Individual grid squares are tested directly against their two triangles. The triangle test rejects misses
+            // quickly enough that there's no benefit to storing and checking a height range for each square first.
+            const float minX = chunk.m_originX + (nodeX * resolution);
+            const float minY = chunk.m_originY + (nodeY * resolution);
+            const float maxX = minX + resolution;
+            const float maxY = minY + resolution;
+
+            IntersectGridSquare(
+                AZ::Vector3(minX, minY, chunk.GetHeight(nodeX, nodeY)),
+                AZ::Vector3(minX, maxY, chunk.GetHeight(nodeX, nodeY + 1)),
+                AZ::Vector3(maxX, maxY, chunk.GetHeight(nodeX + 1, nodeY + 1)),
+                AZ::Vector3(maxX, minY, chunk.GetHeight(nodeX + 1, nodeY)),
+                *ray.m_hitTester,
+                outResult);
+            return static_cast<bool>(outResult);
+        }
+
+        // The ray is a straight line, so its lowest and highest points over this node are at the points where it enters and
+        // exits the node. If that range doesn't overlap the node's height range, the ray can't hit anything in the node.
+        const HeightRange& heightRange = chunk.GetNodeRange(level, nodeX, nodeY);
+        const float enterHeight = ray.m_start.GetZ() + (ray.m_delta.GetZ() * tMin);
+        const float exitHeight = ray.m_start.GetZ() + (ray.m_delta.GetZ() * tMax);
+        if ((AZStd::max(enterHeight, exitHeight) < (heightRange.m_min - NodeHeightTolerance)) ||
+            (AZStd::min(enterHeight, exitHeight) > (heightRange.m_max + NodeHeightTolerance)))
+        {
+            return false;
+        }
+
+        // Find the children that the ray passes over, and visit them in the order that the ray reaches them so that the first
+        // hit found is the nearest one.
+        struct ChildSpan
+        {
+            int32_t m_nodeX;
+            int32_t m_nodeY;
+            float m_tMin;
+            float m_tMax;
+        };
+
+        AZStd::array<ChildSpan, 4> children;
+        size_t childCount = 0;
+
+        const int32_t childLevel = level - 1;
+        const float childWorldSize = aznumeric_cast<float>(1 << childLevel) * resolution;
+        const float tolerance = NodeBoundsTolerance * resolution;
+
+        for (int32_t childY = nodeY * 2; childY < (nodeY * 2) + 2; childY++)
+        {
+            for (int32_t childX = nodeX * 2; childX < (nodeX * 2) + 2; childX++)
+            {
+                const float minX = chunk.m_originX + (childX * childWorldSize);
+                const float minY = chunk.m_originY + (childY * childWorldSize);
+                float childTMin = tMin;
+                float childTMax = tMax;
+                if (ClipToBox(
+                        ray, minX - tolerance, minY - tolerance, minX + childWorldSize + tolerance, minY + childWorldSize + tolerance,
+                        childTMin, childTMax))
+                {
+                    children[childCount++] = { childX, childY, childTMin, childTMax };
+                }
+            }
+        }
+
+        AZStd::sort(
+            children.begin(), children.begin() + childCount,
+            [](const ChildSpan& lhs, const ChildSpan& rhs)
+            {
+                return lhs.m_tMin < rhs.m_tMin;
+            });
+
+        for (size_t child = 0; child < childCount; child++)
+        {
+            if (RayIntersectNode(
+                    chunk, ray, childLevel, children[child].m_nodeX, children[child].m_nodeY, children[child].m_tMin,
+                    children[child].m_tMax, outResult))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+} // namespace Terrain
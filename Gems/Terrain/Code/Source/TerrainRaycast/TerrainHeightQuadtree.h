@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzFramework/Render/GeometryIntersectionStructures.h>
+
+namespace Terrain
+{
+    //! TerrainHeightQuadtree is a min/max height pyramid (a "maximum mipmap") over the terrain height grid, used to accelerate
+    //! raycasts against the terrain.
+    //! The terrain grid is split into square chunks that are built lazily the first time a ray passes over them. Each chunk
+    //! stores the heights of its grid points and a quadtree of the min and max heights of its grid squares, so a ray only needs
+    //! to test the triangles of the grid squares whose height range it actually passes through.
+    //! Chunks are dropped when the terrain data in them changes, and get rebuilt the next time a ray needs them.
+    //! Raycasts and invalidation are thread-safe.
+    class TerrainHeightQuadtree
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TerrainHeightQuadtree, AZ::SystemAllocator, 0);
+
+        //! The number of grid squares along each side of a chunk. This needs to be a power of two.
+        static constexpr int32_t ChunkSize = 64;
+        static constexpr int32_t ChunkPointsPerSide = ChunkSize + 1;
+
+        //! The number of levels in each chunk's quadtree, from single grid squares up to the entire chunk.
+        static constexpr int32_t LevelCount = 7;
+        static_assert((1 << (LevelCount - 1)) == ChunkSize, "LevelCount doesn't match ChunkSize.");
+
+        //! The default maximum number of chunks to keep before the oldest chunks are evicted.
+        static constexpr size_t DefaultMaxChunks = 512;
+
+        //! Callback used to get the terrain heights for a chunk. The Z value of each position needs to be replaced with the
+        //! terrain height at that position.
+        using HeightQueryCallback = AZStd::function<void(AZStd::span<AZ::Vector3> inOutPositions)>;
+
+        TerrainHeightQuadtree() = default;
+
+        //! Set the terrain height query resolution. Changing the resolution clears all of the chunks.
+        void SetQueryResolution(float heightQueryResolution);
+
+        void SetMaxChunks(size_t maxChunks);
+
+        //! Remove all chunks.
+        void Clear();
+
+        //! Remove every chunk that overlaps the given region. Chunks being built when this is called won't be kept.
+        void Invalidate(const AZ::Aabb& region);
+
+        //! Find the nearest intersection between a ray and the terrain in a single chunk.
+        //! @param chunkX, chunkY - The coordinates of the chunk, in chunk-sized steps from the world origin.
+        //! @param rayStart, rayEnd - The full ray.
+        //! @param tStart, tEnd - The portion of the ray to test, as fractions of the distance from the ray start to the ray end.
+        //! @param hitTester - The hit tester for the full ray.
+        //! @param queryHeights - The callback to use to get terrain heights if the chunk needs to be built.
+        //! @return True if the ray hit the terrain in this chunk, in which case outResult contains the hit.
+        bool RayIntersectChunk(
+            int32_t chunkX,
+            int32_t chunkY,
+            const AZ::Vector3& rayStart,
+            const AZ::Vector3& rayEnd,
+            float tStart,
+            float tEnd,
+            const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+            const HeightQueryCallback& queryHeights,
+            AzFramework::RenderGeometry::RayResult& outResult);
+
+        //! Get the size of a chunk in world space.
+        float GetChunkWorldSize() const;
+
+        size_t GetChunkCount() const;
+
+        //! Triangulate a terrain grid square from its four corner points and find the nearest intersection (if any) with the ray.
+        //! The square is split along the top-left -> bottom-right diagonal to match the terrain physics and rendering systems.
+        //! @param minCorner - The corner with the minimum X and Y.
+        //! @param minXMaxYCorner - The corner with the minimum X and maximum Y.
+        //! @param maxCorner - The corner with the maximum X and Y.
+        //! @param maxXMinYCorner - The corner with the maximum X and minimum Y.
+        static void IntersectGridSquare(
+            const AZ::Vector3& minCorner,
+            const AZ::Vector3& minXMaxYCorner,
+            const AZ::Vector3& maxCorner,
+            const AZ::Vector3& maxXMinYCorner,
+            const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+            AzFramework::RenderGeometry::RayResult& result);
+
+    private:
+        using ChunkKey = AZ::u64;
+
+        struct HeightRange
+        {
+            float m_min;
+            float m_max;
+        };
+
+        struct Chunk
+        {
+            //! The height query resolution that the chunk was built with.
+            float m_resolution = 1.0f;
+
+            //! The world space position of the chunk's minimum corner.
+            float m_originX = 0.0f;
+            float m_originY = 0.0f;
+
+            //! The heights of the chunk's grid points, in row-major order.
+            AZStd::vector<float> m_heights;
+
+            //! The height ranges of the quadtree nodes, stored level by level starting with the 2x2 blocks of grid squares.
+            //! The individual grid squares are tested directly against the heights, so their ranges aren't stored.
+            AZStd::vector<HeightRange> m_nodeRanges;
+
+            const HeightRange& GetNodeRange(int32_t level, int32_t nodeX, int32_t nodeY) const;
+            float GetHeight(int32_t pointX, int32_t pointY) const;
+        };
+
+        //! The parts of a ray that stay the same for every node that the ray is tested against.
+        struct RayTrace
+        {
+            AZ::Vector3 m_start;
+            AZ::Vector3 m_delta;
+            const AZ::Intersect::SegmentTriangleHitTester* m_hitTester;
+        };
+
+        static ChunkKey MakeChunkKey(int32_t chunkX, int32_t chunkY);
+
+        //! Get the offset into Chunk::m_nodeRanges of the first node for each quadtree level above the grid squares.
+        static const AZStd::array<size_t, LevelCount>& GetLevelOffsets();
+
+        //! Clip the portion of the ray from tMin to tMax to the XY bounds of a box.
+        //! @return False if the ray doesn't pass over the box between tMin and tMax.
+        static bool ClipToBox(
+            const RayTrace& ray, float minX, float minY, float maxX, float maxY, float& inOutTMin, float& inOutTMax);
+
+        AZStd::shared_ptr<const Chunk> GetOrBuildChunk(int32_t chunkX, int32_t chunkY, const HeightQueryCallback& queryHeights);
+        AZStd::shared_ptr<Chunk> BuildChunk(int32_t chunkX, int32_t chunkY, float resolution, const HeightQueryCallback& queryHeights) const;
+
+        bool RayIntersectNode(
+            const Chunk& chunk,
+            const RayTrace& ray,
+            int32_t level,
+            int32_t nodeX,
+            int32_t nodeY,
+            float tMin,
+            float tMax,
+            AzFramework::RenderGeometry::RayResult& outResult) const;
+
+        mutable AZStd::shared_mutex m_chunkMutex;
+        AZStd::unordered_map<ChunkKey, AZStd::shared_ptr<const Chunk>> m_chunks;
+
+        //! The order that chunks were built in, so that the oldest chunks can be evicted first.
+        AZStd::deque<ChunkKey> m_chunkOrder;
+
+        float m_queryResolution = 1.0f;
+        size_t m_maxChunks = DefaultMaxChunks;
+
+        //! Incremented every time chunks are removed, so that chunks that were built from stale data aren't kept.
+        AZ::u64 m_generation = 0;
+    };
+} // namespace Terrain
@@ -9,11 +9,38 @@
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystem.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/IntersectSegment.h>
 #include <AzCore/std/sort.h>
 
 using namespace Terrain;
 
+AZ_CVAR(
+    bool,
+    terrain_raycastUseHeightQuadtree,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Use a min/max height quadtree to skip over terrain that rays can't hit instead of testing every grid square along the ray.");
+
+AZ_CVAR(
+    uint32_t,
+    terrain_raycastMaxQuadtreeChunks,
+    aznumeric_cast<uint32_t>(TerrainHeightQuadtree::DefaultMaxChunks),
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of terrain raycast quadtree chunks to keep before the oldest ones are rebuilt on demand.");
+
+AZ_CVAR(
+    uint32_t,
+    terrain_raycastBatchRaysPerJob,
+    32,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The number of rays that each job processes in a batched terrain raycast.");
+
 namespace
 {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,30 +63,84 @@ namespace
         point2.SetZ(terrainSystem.GetHeight(point2, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
         point3.SetZ(terrainSystem.GetHeight(point3, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
 
-        // Finally, triangulate the four terrain points and check for a hit,
-        // splitting using the top-left -> bottom-right diagonal so to match
-        // the current behavior of the terrain physics and rendering systems.
-        AZ::Vector3 bottomLeftHitNormal;
-        float bottomLeftHitDistance;
-        bool bottomLeftHit =
-            hitTester.IntersectSegmentTriangleCCW(point0, point3, point1, bottomLeftHitNormal, bottomLeftHitDistance);
-
-        AZ::Vector3 topRightHitNormal;
-        float topRightHitDistance;
-        bool topRightHit =
-            hitTester.IntersectSegmentTriangleCCW(point2, point1, point3, topRightHitNormal, topRightHitDistance);
+        // Finally, triangulate the four terrain points and check for a hit.
+        TerrainHeightQuadtree::IntersectGridSquare(point0, point1, point2, point3, hitTester, result);
+    }
 
-        if (bottomLeftHit && (!topRightHit || (bottomLeftHitDistance < topRightHitDistance)))
-        {
-            result.m_distance = bottomLeftHitDistance;
-            result.m_worldNormal = bottomLeftHitNormal;
-            result.m_worldPosition = hitTester.GetIntersectionPoint(result.m_distance);
-        }
-        else if (topRightHit)
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Walk through every square of a grid with the given square size that the XY coordinates of a line segment pass over,
+    // in order from the start of the segment to the end. The visitor is called with the min corner of each square, and can
+    // return true to stop the walk.
+    template<typename SquareVisitor>
+    static void WalkGridSquares(const AZ::Vector2& clippedStart, const AZ::Vector2& clippedEnd, float squareSize, SquareVisitor&& visitor)
+    {
+        const AZ::Vector2 gridResolution(squareSize);
+        const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
+
+        // Calculate the total number of grid squares we'll need to visit to trace the ray segment.
+        // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
+        // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
+        const AZ::Vector2 numSquaresToMove =
+            ((clippedEnd / gridResolution).GetFloor() - (clippedStart / gridResolution).GetFloor()).GetAbs();
+        const int32_t numGridSquares =
+            1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
+
+        // This tells us how much t distance on the line to move to increment one grid square in each direction.
+        // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
+        const AZ::Vector2 tDelta(gridResolution / clippedLineSegment.GetAbs());
+
+        // Get the min world space corner of the grid square containing (x0, y0)
+        const AZ::Vector2 clippedStartGridCorner = (clippedStart / gridResolution).GetFloor() * gridResolution;
+
+        // tUntilNextBoundary stores how much further we currently need to move along t to get to the next grid square boundary
+        // in each direction.
+        // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
+        // direction at all (when clippedLineSegment == 0)
+        const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
+
+        AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
+            clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
+
+        // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
+        // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
+        tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(clippedEnd, clippedStart, tDelta - tUntilNextBoundary, tUntilNextBoundary);
+
+        // These will hold our current square coordinates in world space values as we loop through the squares, starting with the
+        // grid square for (x0, y0). These values represent the minimum corner of each grid square.
+        AZ::Vector2 curGridCorner = clippedStartGridCorner;
+
+        // This is how much we need to increment our x and y by to get to the next grid square along the line.
+        // They will either be +/- gridResolution or 0 if we're not moving in that direction.
+        const AZ::Vector2 gridIncrement = gridResolution *
+            AZ::Vector2::CreateSelectCmpEqual(clippedLineSegment,
+                                              AZ::Vector2::CreateZero(),
+                                              AZ::Vector2::CreateZero(),
+                                              AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
+
+        // Convenience vectors that we can use in the loop to just increment one direction.
+        const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
+        const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
+        const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
+        const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
+
+        for (int gridSquare = 0; gridSquare < numGridSquares; gridSquare++)
         {
-            result.m_distance = topRightHitDistance;
-            result.m_worldNormal = topRightHitNormal;
-            result.m_worldPosition = hitTester.GetIntersectionPoint(result.m_distance);
+            if (visitor(curGridCorner))
+            {
+                break;
+            }
+
+            // Move forward along the line (either horizontally or vertically) to the next grid square.
+            if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
+            {
+                curGridCorner += gridIncrementY;
+                tUntilNextBoundary += tDeltaY;
+            }
+            else
+            {
+                curGridCorner += gridIncrementX;
+                tUntilNextBoundary += tDeltaX;
+            }
         }
     }
 
@@ -93,6 +174,9 @@ TerrainRaycastContext::~TerrainRaycastContext()
    that cannot contain terrain. We then walk through the grid one square at a time, either moving horizontally
    or vertically to the next square based on the ray's slope, until we reach the end of the ray or we've found a hit.
 
+   When the height quadtree is enabled, the same walk is done over quadtree chunks instead of individual grid squares,
+   and each chunk's min/max height quadtree is used to find the grid squares in the chunk that the ray could possibly hit.
+
    Visualization:
     - X: Grid square intersection but no triangle hit found
     - T: Grid square intersection with a triangle hit found
@@ -118,7 +202,6 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     const AzFramework::RenderGeometry::RayRequest& ray)
 {
     const AZ::Aabb terrainWorldBounds = m_terrainSystem.GetTerrainAabb();
-    const AZ::Vector2 terrainResolution(m_terrainSystem.GetTerrainHeightQueryResolution());
 
     // Initialize the result to invalid at the start.
     AzFramework::RenderGeometry::RayResult rayIntersectionResult = AzFramework::RenderGeometry::RayResult();
@@ -145,97 +228,160 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
         return rayIntersectionResult;
     }
 
-    // Move our clipped line segment into Vector2s for more convenient use below.
-    const AZ::Vector2 clippedStart(clippedRayStart);
-    const AZ::Vector2 clippedEnd(clippedRayEnd);
-    const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
+    if (terrain_raycastUseHeightQuadtree)
+    {
+        RayIntersectQuadtree(ray, clippedRayStart, clippedRayEnd, tClipStart, tClipEnd, rayIntersectionResult);
+    }
+    else
+    {
+        RayIntersectGrid(ray, terrainWorldBounds, clippedRayStart, clippedRayEnd, rayIntersectionResult);
+    }
 
-    // Calculate the total number of terrain squares we'll need to visit to trace the ray segment.
-    // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
-    // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
-    const AZ::Vector2 numSquaresToMove =
-        ((clippedEnd / terrainResolution).GetFloor() - (clippedStart / terrainResolution).GetFloor()).GetAbs();
-    const int32_t numTerrainSquares =
-        1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
+    if (rayIntersectionResult)
+    {
+        // Intersection found. Replace the triangle normal from the hit with a higher-quality normal calculated
+        // by the terrain system.
+        rayIntersectionResult.m_worldNormal = m_terrainSystem.GetNormal(
+            rayIntersectionResult.m_worldPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+    }
 
-    // This tells us how much t distance on the line to move to increment one terrain square in each direction.
-    // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
-    const AZ::Vector2 tDelta(terrainResolution / clippedLineSegment.GetAbs());
+    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
+    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
+    return rayIntersectionResult;
+}
 
-    // Get the min world space corner of the terrain grid square containing (x0, y0)
-    const AZ::Vector2 clippedStartGridCorner = (clippedStart / terrainResolution).GetFloor() * terrainResolution;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::RayIntersectBatch(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> outResults)
+{
+    AZ_PROFILE_FUNCTION(Terrain);
 
-    // tUntilNextBoundary stores how much further we currently need to move along t to get to the next terrain grid square boundary
-    // in each direction.
-    // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
-    // direction at all (when clippedLineSegment == 0)
-    const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
+    AZ_Assert(rays.size() == outResults.size(), "The number of ray results needs to match the number of rays.");
+    const size_t numRays = AZStd::min(rays.size(), outResults.size());
+    const size_t raysPerJob = AZStd::max(aznumeric_cast<size_t>(static_cast<uint32_t>(terrain_raycastBatchRaysPerJob)), size_t(1));
 
-    AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
-        clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
+    if (numRays <= raysPerJob)
+    {
+        for (size_t rayIndex = 0; rayIndex < numRays; rayIndex++)
+        {
+            outResults[rayIndex] = RayIntersect(rays[rayIndex]);
+        }
+        return;
+    }
 
-    // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
-    // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
-    tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(clippedEnd, clippedStart, tDelta - tUntilNextBoundary, tUntilNextBoundary);
+    // Each job writes to its own range of results, so no synchronization is needed beyond waiting for the jobs to complete.
+    // Rays that are next to each other in the list are often close together in the world (ex: AI line-of-sight fans),
+    // so keeping them in the same job keeps the quadtree chunks they use warm in the cache.
+    AZ::JobCompletion jobCompletion;
+    for (size_t firstRay = 0; firstRay < numRays; firstRay += raysPerJob)
+    {
+        const size_t lastRay = AZStd::min(firstRay + raysPerJob, numRays);
+        AZ::Job* rayJob = AZ::CreateJobFunction(
+            [this, rays, outResults, firstRay, lastRay]()
+            {
+                for (size_t rayIndex = firstRay; rayIndex < lastRay; rayIndex++)
+                {
+                    outResults[rayIndex] = RayIntersect(rays[rayIndex]);
+                }
+            },
+            true);
+        rayJob->SetDependent(&jobCompletion);
+        rayJob->Start();
+    }
+    jobCompletion.StartAndWaitForCompletion();
+}
 
-    // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
-    // to make sure we don't run into any precision issues caused from the clipping.
-    AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::InvalidateRegion(const AZ::Aabb& dirtyRegion)
+{
+    m_heightQuadtree.Invalidate(dirtyRegion);
+}
 
-    // These will hold our current square coordinates in world space values as we loop through the squares, starting with the
-    // grid square for (x0, y0). These values represent the minimum corner of each terrain square.
-    AZ::Vector2 curGridCorner = clippedStartGridCorner;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::ClearCachedData()
+{
+    m_heightQuadtree.Clear();
+}
 
-    // This is how much we need to increment our x and y by to get to the next grid square along the line.
-    // They will either be +/- terrainResolution or 0 if we're not moving in that direction.
-    const AZ::Vector2 gridIncrement = terrainResolution *
-        AZ::Vector2::CreateSelectCmpEqual(clippedLineSegment,
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::RayIntersectGrid(
+    const AzFramework::RenderGeometry::RayRequest& ray,
+    const AZ::Aabb& terrainWorldBounds,
+    const AZ::Vector3& clippedRayStart,
+    const AZ::Vector3& clippedRayEnd,
+    AzFramework::RenderGeometry::RayResult& result)
+{
+    const float terrainResolution = m_terrainSystem.GetTerrainHeightQueryResolution();
 
-    // Convenience vectors that we can use in the loop to just increment one direction.
-    const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
-    const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
-    const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
-    const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
+    // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
+    // to make sure we don't run into any precision issues caused from the clipping.
+    AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
 
     // Walk through each grid square in the terrain that intersects the XY coordinates of the line.
     // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
-    for (int terrainSquare = 0; terrainSquare < numTerrainSquares; terrainSquare++)
-    {
-        // Create a bounding volume for this terrain square.
-        AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
-            AZ::Vector3(curGridCorner, terrainWorldBounds.GetMin().GetZ()),
-            AZ::Vector3(curGridCorner + terrainResolution, terrainWorldBounds.GetMax().GetZ()));
-
-        // Check for a hit against the terrain triangles in this square.
-        // Note - this could be optimized to be 2x faster by adding some code to keep track of the terrain heights
-        // from the previous square checked so that we only get the 2 new corners instead of all 4 every time.
-        TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, rayIntersectionResult);
-        if (rayIntersectionResult)
+    WalkGridSquares(
+        AZ::Vector2(clippedRayStart),
+        AZ::Vector2(clippedRayEnd),
+        terrainResolution,
+        [this, &terrainWorldBounds, &hitTester, &result, terrainResolution](const AZ::Vector2& curGridCorner)
         {
-            // Intersection found. Replace the triangle normal from the hit with a higher-quality normal calculated
-            // by the terrain system.
-            rayIntersectionResult.m_worldNormal = m_terrainSystem.GetNormal(
-                rayIntersectionResult.m_worldPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
-            break;
-        }
+            // Create a bounding volume for this terrain square.
+            AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
+                AZ::Vector3(curGridCorner, terrainWorldBounds.GetMin().GetZ()),
+                AZ::Vector3(curGridCorner + AZ::Vector2(terrainResolution), terrainWorldBounds.GetMax().GetZ()));
+
+            // Check for a hit against the terrain triangles in this square.
+            TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, result);
+            return static_cast<bool>(result);
+        });
+}
 
-        // No hit yet, so move forward along the line (either horizontally or vertically) to the next terrain square.
-        if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
-        {
-            curGridCorner += gridIncrementY;
-            tUntilNextBoundary += tDeltaY;
-        }
-        else
-        {
-            curGridCorner += gridIncrementX;
-            tUntilNextBoundary += tDeltaX;
-        }
-    }
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::RayIntersectQuadtree(
+    const AzFramework::RenderGeometry::RayRequest& ray,
+    const AZ::Vector3& clippedRayStart,
+    const AZ::Vector3& clippedRayEnd,
+    float tClipStart,
+    float tClipEnd,
+    AzFramework::RenderGeometry::RayResult& result)
+{
+    m_heightQuadtree.SetQueryResolution(m_terrainSystem.GetTerrainHeightQueryResolution());
+    m_heightQuadtree.SetMaxChunks(terrain_raycastMaxQuadtreeChunks);
 
-    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
-    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
-    return rayIntersectionResult;
+    // Quadtree chunks get their heights from the terrain system with the same exact grid point queries that the
+    // grid walk uses, so both paths produce the same intersections.
+    auto queryHeights = [this](AZStd::span<AZ::Vector3> inOutPositions)
+    {
+        size_t positionIndex = 0;
+        m_terrainSystem.QueryList(
+            inOutPositions,
+            AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+            [inOutPositions, &positionIndex](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+            {
+                inOutPositions[positionIndex++].SetZ(surfacePoint.m_position.GetZ());
+            },
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+    };
+
+    // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
+    // to make sure we don't run into any precision issues caused from the clipping.
+    AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
+
+    const float chunkWorldSize = m_heightQuadtree.GetChunkWorldSize();
+
+    // Walk through each quadtree chunk that intersects the XY coordinates of the line, and let each chunk's quadtree
+    // find the nearest hit (if any) in that chunk.
+    WalkGridSquares(
+        AZ::Vector2(clippedRayStart),
+        AZ::Vector2(clippedRayEnd),
+        chunkWorldSize,
+        [this, &ray, &hitTester, &queryHeights, &result, chunkWorldSize, tClipStart, tClipEnd](const AZ::Vector2& curChunkCorner)
+        {
+            const int32_t chunkX = aznumeric_cast<int32_t>(AZStd::floor((curChunkCorner.GetX() / chunkWorldSize) + 0.5f));
+            const int32_t chunkY = aznumeric_cast<int32_t>(AZStd::floor((curChunkCorner.GetY() / chunkWorldSize) + 0.5f));
+            return m_heightQuadtree.RayIntersectChunk(
+                chunkX, chunkY, ray.m_startWorldPosition, ray.m_endWorldPosition, tClipStart, tClipEnd, hitTester, queryHeights,
+                result);
+        });
 }
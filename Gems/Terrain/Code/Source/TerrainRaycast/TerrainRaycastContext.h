@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <AzCore/std/containers/span.h>
 #include <AzFramework/Render/IntersectorInterface.h>
+#include <TerrainRaycast/TerrainHeightQuadtree.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace Terrain
@@ -41,6 +43,23 @@ namespace Terrain
         //! \ref AzFramework::RenderGeometry::RayIntersect
         AzFramework::RenderGeometry::RayResult RayIntersect(const AzFramework::RenderGeometry::RayRequest& ray) override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Find the nearest terrain intersection for each ray in a list. Large lists are split across jobs.
+        //! \param[in] rays The rays to intersect with the terrain
+        //! \param[out] outResults The results for each ray, which needs to be the same size as the list of rays
+        void RayIntersectBatch(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> outResults);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Drop the cached raycast acceleration data for a region of terrain that has changed.
+        //! \param[in] dirtyRegion The region of terrain that changed
+        void InvalidateRegion(const AZ::Aabb& dirtyRegion);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Drop all of the cached raycast acceleration data.
+        void ClearCachedData();
+
     protected:
         ////////////////////////////////////////////////////////////////////////////////////////////
         // RenderGeometry::IntersectorBus inherits from RenderGeometry::IntersectionNotifications,
@@ -54,9 +73,29 @@ namespace Terrain
         ///@}
 
     private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Walk the ray one grid square at a time, querying the terrain heights for every square.
+        void RayIntersectGrid(
+            const AzFramework::RenderGeometry::RayRequest& ray,
+            const AZ::Aabb& terrainWorldBounds,
+            const AZ::Vector3& clippedRayStart,
+            const AZ::Vector3& clippedRayEnd,
+            AzFramework::RenderGeometry::RayResult& result);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Walk the ray one quadtree chunk at a time, using the min/max heights to skip over squares the ray can't hit.
+        void RayIntersectQuadtree(
+            const AzFramework::RenderGeometry::RayRequest& ray,
+            const AZ::Vector3& clippedRayStart,
+            const AZ::Vector3& clippedRayEnd,
+            float tClipStart,
+            float tClipEnd,
+            AzFramework::RenderGeometry::RayResult& result);
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Variables
         TerrainSystem& m_terrainSystem; //!< Terrain system that owns this terrain raycast context
         AzFramework::EntityContextId m_entityContextId; //!< This object's entity context id
+        TerrainHeightQuadtree m_heightQuadtree; //!< Min/max height quadtree used to accelerate raycasts
     };
 } // namespace Terrain
@@ -7,6 +7,10 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -24,6 +28,30 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+AZ_CVAR(
+    bool,
+    terrain_tileCacheEnabled,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Use baked tiles of terrain data for queries on the terrain grid instead of querying the terrain areas every time.");
+
+AZ_CVAR(
+    uint32_t,
+    terrain_tileCacheMaxTiles,
+    aznumeric_cast<uint32_t>(TerrainTileCache::DefaultMaxTiles),
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of height tiles and surface weight tiles to keep in the terrain tile cache.");
+
+AZ_CVAR(
+    uint32_t,
+    terrain_tileCacheBakesPerTick,
+    8,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of terrain tile cache bake jobs to start each tick.");
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -89,6 +117,8 @@ void TerrainSystem::Activate()
     m_terrainSurfacesDirty = true;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    m_tileCache.Clear();
+    m_terrainRaycastContext.ClearCachedData();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -124,6 +154,14 @@ void TerrainSystem::Deactivate()
         m_activeTerrainJobContextMutexConditionVariable.wait(lock, [this]{ return m_activeTerrainJobContexts.empty(); });
     }
 
+    m_tileCache.Clear();
+    m_terrainRaycastContext.ClearCachedData();
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingTileCacheMutex);
+        m_pendingTileCache = {};
+        m_hasPendingTileCache = false;
+    }
+
     // Stop listening to the bus even before we signal DestroyBegin so that way any calls to the terrain system as a *result* of
     // calling DestroyBegin will fail to reach the terrain system.
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusDisconnect();
@@ -450,38 +488,41 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
 
-    auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
-                        AZStd::span<AZ::Vector3> outPositions,
-                        AZStd::span<bool> outTerrainExists,
-                        [[maybe_unused]] AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
-                        AZ::EntityId areaId)
-                        {
-                            AZ_Assert((inPositions.size() == outPositions.size() && inPositions.size() == outTerrainExists.size()),
-                                "The sizes of the terrain exists list and in/out positions list should match.");
-                            Terrain::TerrainAreaHeightRequestBus::Event(areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights,
-                                outPositions, outTerrainExists);
+    if (terrain_tileCacheEnabled)
+    {
+        // Fill in everything we can from the tile cache, then only query the terrain areas for the positions that missed.
+        AZStd::vector<size_t> cacheMisses;
+        // Only the CLAMP and BILINEAR positions were rounded onto the grid, EXACT positions have to be exactly on it to use the cache.
+        const bool snapToGrid = (sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+        m_tileCache.LookupHeights(outPositions, outTerrainExists, cacheMisses, snapToGrid);
 
-                            // If the area has "use ground plane" checked, make sure any points that fall in the area that didn't
-                            // return data are filled in with the area's minimum height.
-                            const auto& area = m_registeredAreas.find(areaId);
-                            if ((area != m_registeredAreas.end()) && area->second.m_useGroundPlane)
-                            {
-                                const float areaMin = area->second.m_areaBounds.GetMin().GetZ();
+        if (cacheMisses.size() == outPositions.size())
+        {
+            GetAreaHeights(outPositions, outTerrainExists);
+        }
+        else if (!cacheMisses.empty())
+        {
+            AZStd::vector<AZ::Vector3> missPositions;
+            AZStd::vector<bool> missTerrainExists(cacheMisses.size());
+            missPositions.reserve(cacheMisses.size());
+            for (size_t missIndex : cacheMisses)
+            {
+                missPositions.emplace_back(outPositions[missIndex]);
+            }
 
-                                for (size_t index = 0; index < outPositions.size(); index++)
-                                {
-                                    if (!outTerrainExists[index])
-                                    {
-                                        outTerrainExists[index] = true;
-                                        outPositions[index].SetZ(areaMin);
-                                    }
-                                }
-                            }
-                        };
+            GetAreaHeights(missPositions, missTerrainExists);
 
-    // This will be unused for heights. It's fine if it's empty.
-    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+            for (size_t index = 0; index < cacheMisses.size(); index++)
+            {
+                outPositions[cacheMisses[index]] = missPositions[index];
+                outTerrainExists[cacheMisses[index]] = missTerrainExists[index];
+            }
+        }
+    }
+    else
+    {
+        GetAreaHeights(outPositions, outTerrainExists);
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -543,10 +584,10 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             const AZ::Vector2 pos1 = pos0 + AZ::Vector2(queryResolution);
 
             AZStd::array<bool,4> exists = { false, false, false, false };
-            const AZStd::array<float, 4> queriedHeights = { GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), exists[0]),
-                                                            GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), exists[1]),
-                                                            GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), exists[2]),
-                                                            GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), exists[3]) };
+            const AZStd::array<float, 4> queriedHeights = { GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), exists[0], true),
+                                                            GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), exists[1], true),
+                                                            GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), exists[2], true),
+                                                            GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), exists[3], true) };
 
             InterpolateHeights(queriedHeights, exists, normalizedDelta.GetX(), normalizedDelta.GetY(), height, terrainExists);
         }
@@ -558,7 +599,7 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             AZ::Vector2 clampedPosition;
             RoundPosition(x, y, queryResolution, clampedPosition);
 
-            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists, true);
         }
         break;
 
@@ -566,7 +607,7 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
     case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
         [[fallthrough]];
     default:
-        height = GetTerrainAreaHeight(x, y, terrainExists);
+        height = GetTerrainAreaHeight(x, y, terrainExists, false);
         break;
     }
 
@@ -580,13 +621,18 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
         height, m_currentSettings.m_heightRange.m_min, m_currentSettings.m_heightRange.m_max);
 }
 
-float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists) const
+float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists, bool snapToGrid) const
 {
     const float worldMin = m_currentSettings.m_heightRange.m_min;
     AZ::Vector3 inPosition(x, y, worldMin);
     float height = worldMin;
     terrainExists = false;
 
+    if (terrain_tileCacheEnabled && m_tileCache.LookupHeight(x, y, height, terrainExists, snapToGrid))
+    {
+        return height;
+    }
+
     AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
 
     for (auto& [areaId, areaData] : m_registeredAreas)
@@ -1101,6 +1147,13 @@ AzFramework::RenderGeometry::RayResult TerrainSystem::GetClosestIntersection(
     return m_terrainRaycastContext.RayIntersect(ray);
 }
 
+void TerrainSystem::GetClosestIntersections(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> outResults) const
+{
+    m_terrainRaycastContext.RayIntersectBatch(rays, outResults);
+}
+
 AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::QueryListAsync(
     const AZStd::span<const AZ::Vector3>& inPositions,
     TerrainDataMask requestedData,
@@ -1282,29 +1335,37 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     Sampler querySampler = (sampler == Sampler::EXACT) ? Sampler::EXACT : Sampler::CLAMP;
     GenerateQueryPositions(inPositions, queryPositions, queryResolution, querySampler);
 
-    auto callback = [](const AZStd::span<const AZ::Vector3> inPositions,
-                        [[maybe_unused]] AZStd::span<AZ::Vector3> outPositions,
-                        [[maybe_unused]] AZStd::span<bool> outTerrainExists,
-                        AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
-                        AZ::EntityId areaId)
-                        {
-                            AZ_Assert(inPositions.size() == outSurfaceWeights.size(),
-                                "The sizes of the surface weights list and in/out positions list should match.");
-                            Terrain::TerrainAreaSurfaceRequestBus::Event(areaId, &Terrain::TerrainAreaSurfaceRequestBus::Events::GetSurfaceWeightsFromList,
-                                inPositions, outSurfaceWeights);
+    if (terrain_tileCacheEnabled)
+    {
+        AZStd::vector<size_t> cacheMisses;
+        m_tileCache.LookupSurfaceWeightsList(queryPositions, outSurfaceWeightsList, cacheMisses, querySampler != Sampler::EXACT);
 
-                            // Sort the surface weights on each output weight list in decreasing weight order.
-                            for (auto& outSurfaceWeight : outSurfaceWeights)
-                            {
-                                AZStd::sort(
-                                    outSurfaceWeight.begin(), outSurfaceWeight.end(),
-                                    AzFramework::SurfaceData::SurfaceTagWeightComparator());
-                            }
-                        };
-    
-    // This will be unused for surface weights. It's fine if it's empty.
-    AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+        if (cacheMisses.size() == queryPositions.size())
+        {
+            GetAreaSurfaceWeights(queryPositions, outSurfaceWeightsList);
+        }
+        else if (!cacheMisses.empty())
+        {
+            AZStd::vector<AZ::Vector3> missPositions;
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> missSurfaceWeights(cacheMisses.size());
+            missPositions.reserve(cacheMisses.size());
+            for (size_t missIndex : cacheMisses)
+            {
+                missPositions.emplace_back(queryPositions[missIndex]);
+            }
+
+            GetAreaSurfaceWeights(missPositions, missSurfaceWeights);
+
+            for (size_t index = 0; index < cacheMisses.size(); index++)
+            {
+                outSurfaceWeightsList[cacheMisses[index]] = AZStd::move(missSurfaceWeights[index]);
+            }
+        }
+    }
+    else
+    {
+        GetAreaSurfaceWeights(queryPositions, outSurfaceWeightsList);
+    }
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1349,6 +1410,12 @@ void TerrainSystem::GetOrderedSurfaceWeights(
         break;
     }
 
+    const bool snapToGrid = (sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+    if (terrain_tileCacheEnabled && m_tileCache.LookupSurfaceWeights(inPosition.GetX(), inPosition.GetY(), outSurfaceWeights, snapToGrid))
+    {
+        return;
+    }
+
     AZ::Aabb bounds;
     AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(inPosition, bounds);
 
@@ -1687,6 +1754,8 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
     Terrain::TerrainSpawnerRequestBus::EventResult(useGroundPlane, areaId, &Terrain::TerrainSpawnerRequestBus::Events::GetUseGroundPlane);
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
+    m_tileCache.Invalidate(aabb, true, true);
+    m_terrainRaycastContext.InvalidateRegion(aabb);
     m_dirtyRegion.AddAabb(aabb);
     m_terrainHeightDirty = true;
     m_terrainSurfacesDirty = true;
@@ -1707,6 +1776,8 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             auto const& [entityId, areaData] = item;
             if (areaId == entityId)
             {
+                m_tileCache.Invalidate(areaData.m_areaBounds, true, true);
+                m_terrainRaycastContext.InvalidateRegion(areaData.m_areaBounds);
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
                 m_terrainHeightDirty = true;
                 m_terrainSurfacesDirty = true;
@@ -1770,6 +1841,16 @@ void TerrainSystem::RefreshRegion(
     m_terrainHeightDirty = m_terrainHeightDirty || ((changeMask & Terrain::HeightData) == Terrain::HeightData);
 
     m_terrainSurfacesDirty = m_terrainSurfacesDirty || ((changeMask & Terrain::SurfaceData) == Terrain::SurfaceData);
+
+    // Drop any baked tiles for the changed data right away, so that queries made before the next tick don't return stale data.
+    m_tileCache.Invalidate(
+        dirtyRegion, (changeMask & Terrain::HeightData) == Terrain::HeightData,
+        (changeMask & Terrain::SurfaceData) == Terrain::SurfaceData);
+
+    if ((changeMask & Terrain::HeightData) == Terrain::HeightData)
+    {
+        m_terrainRaycastContext.InvalidateRegion(dirtyRegion);
+    }
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -1782,6 +1863,9 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
     {
         terrainSettingsChanged = true;
         m_terrainSettingsDirty = false;
+
+        // The baked tiles only depend on the height range and the query resolutions, so other settings changes can keep them.
+        const bool heightRangeChanged = (m_requestedSettings.m_heightRange != m_currentSettings.m_heightRange);
         if (m_currentSettings.m_heightRange.IsValid())
         {
             m_dirtyRegion = ClampZBoundsToHeightBounds(m_cachedAreaBounds);
@@ -1810,9 +1894,19 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // A height range change can affect every baked value, so start over with an empty tile cache.
+        // Changing the query resolutions clears the tile cache too.
+        if (heightRangeChanged)
+        {
+            m_tileCache.Clear();
+        }
+        m_tileCache.SetQueryResolutions(m_currentSettings.m_heightQueryResolution, m_currentSettings.m_surfaceDataQueryResolution);
+        m_terrainRaycastContext.ClearCachedData();
     }
 
-    if (terrainSettingsChanged || m_terrainHeightDirty || m_terrainSurfacesDirty)
+    const bool terrainDataChanged = terrainSettingsChanged || m_terrainHeightDirty || m_terrainSurfacesDirty;
+    if (terrainDataChanged)
     {
         Terrain::TerrainDataChangedMask changeMask = Terrain::TerrainDataChangedMask::None;
 
@@ -1842,4 +1936,246 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
             changeMask);
     }
 
+    if (m_currentSettings.m_systemActive)
+    {
+        // Apply a loaded tile cache on the first tick that doesn't change any terrain data, so it isn't immediately invalidated
+        // by the settings changes and area registrations that happen while a level starts up.
+        if (!terrainDataChanged)
+        {
+            ApplyPendingTileCache();
+        }
+
+        StartTileBakeJobs();
+    }
+}
+
+void TerrainSystem::GetAreaHeights(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists) const
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    if (inOutPositions.empty())
+    {
+        return;
+    }
+
+    auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
+                        AZStd::span<AZ::Vector3> outPositions,
+                        AZStd::span<bool> outTerrainExists,
+                        [[maybe_unused]] AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
+                        AZ::EntityId areaId)
+                        {
+                            AZ_Assert((inPositions.size() == outPositions.size() && inPositions.size() == outTerrainExists.size()),
+                                "The sizes of the terrain exists list and in/out positions list should match.");
+                            Terrain::TerrainAreaHeightRequestBus::Event(areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights,
+                                outPositions, outTerrainExists);
+
+                            // If the area has "use ground plane" checked, make sure any points that fall in the area that didn't
+                            // return data are filled in with the area's minimum height.
+                            const auto& area = m_registeredAreas.find(areaId);
+                            if ((area != m_registeredAreas.end()) && area->second.m_useGroundPlane)
+                            {
+                                const float areaMin = area->second.m_areaBounds.GetMin().GetZ();
+
+                                for (size_t index = 0; index < outPositions.size(); index++)
+                                {
+                                    if (!outTerrainExists[index])
+                                    {
+                                        outTerrainExists[index] = true;
+                                        outPositions[index].SetZ(areaMin);
+                                    }
+                                }
+                            }
+                        };
+
+    // This will be unused for heights. It's fine if it's empty.
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
+    MakeBulkQueries(inOutPositions, inOutPositions, terrainExists, outSurfaceWeights, callback);
+}
+
+void TerrainSystem::GetAreaSurfaceWeights(
+    AZStd::span<const AZ::Vector3> inPositions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    if (inPositions.empty())
+    {
+        return;
+    }
+
+    auto callback = [](const AZStd::span<const AZ::Vector3> inPositions,
+                        [[maybe_unused]] AZStd::span<AZ::Vector3> outPositions,
+                        [[maybe_unused]] AZStd::span<bool> outTerrainExists,
+                        AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights,
+                        AZ::EntityId areaId)
+                        {
+                            AZ_Assert(inPositions.size() == outSurfaceWeights.size(),
+                                "The sizes of the surface weights list and in/out positions list should match.");
+                            Terrain::TerrainAreaSurfaceRequestBus::Event(areaId, &Terrain::TerrainAreaSurfaceRequestBus::Events::GetSurfaceWeightsFromList,
+                                inPositions, outSurfaceWeights);
+
+                            // Sort the surface weights on each output weight list in decreasing weight order.
+                            for (auto& outSurfaceWeight : outSurfaceWeights)
+                            {
+                                AZStd::sort(
+                                    outSurfaceWeight.begin(), outSurfaceWeight.end(),
+                                    AzFramework::SurfaceData::SurfaceTagWeightComparator());
+                            }
+                        };
+
+    // These will be unused for surface weights. It's fine if they're empty.
+    AZStd::vector<AZ::Vector3> outPositions;
+    AZStd::vector<bool> outTerrainExists;
+    MakeBulkQueries(inPositions, outPositions, outTerrainExists, outSurfaceWeightsList, callback);
+}
+
+void TerrainSystem::BakeTile(const TerrainTileCache::TileRequest& request)
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    // The tile positions start at the terrain minimum height to match the uncached queries for positions outside of any area.
+    AZStd::vector<AZ::Vector3> positions;
+    m_tileCache.GetTilePositions(request, m_currentSettings.m_heightRange.m_min, positions);
+
+    if (request.m_type == TerrainTileCache::TileType::Heights)
+    {
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        GetAreaHeights(positions, terrainExists);
+        m_tileCache.StoreHeightTile(request, positions, terrainExists);
+    }
+    else
+    {
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights(positions.size());
+        GetAreaSurfaceWeights(positions, surfaceWeights);
+        m_tileCache.StoreSurfaceTile(request, surfaceWeights);
+    }
+}
+
+void TerrainSystem::StartTileBakeJobs()
+{
+    m_tileCache.SetMaxTiles(terrain_tileCacheMaxTiles);
+
+    if (!terrain_tileCacheEnabled)
+    {
+        return;
+    }
+
+    AZStd::vector<TerrainTileCache::TileRequest> requests;
+    m_tileCache.TakePendingRequests(terrain_tileCacheBakesPerTick, requests);
+
+    if (requests.empty())
+    {
+        return;
+    }
+
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    // Track the bakes with a terrain job context so that deactivating the terrain system will cancel and wait for them.
+    AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext =
+        AZStd::make_shared<AzFramework::Terrain::TerrainJobContext>(*m_terrainJobManager, aznumeric_cast<int32_t>(requests.size()));
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+        m_activeTerrainJobContexts.push_back(jobContext);
+    }
+
+    for (const auto& request : requests)
+    {
+        auto jobFunction = [this, request, jobContext]()
+        {
+            if (!jobContext->IsCancelled())
+            {
+                BakeTile(request);
+            }
+
+            if (jobContext->OnJobCompleted())
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_activeTerrainJobContextMutex);
+                m_activeTerrainJobContexts.erase(
+                    AZStd::find(m_activeTerrainJobContexts.begin(), m_activeTerrainJobContexts.end(), jobContext));
+                m_activeTerrainJobContextMutexConditionVariable.notify_one();
+            }
+        };
+
+        AZ::Job* bakeJob = AZ::CreateJobFunction(jobFunction, true, jobContext.get());
+        bakeJob->Start();
+    }
+}
+
+void TerrainSystem::BakeTileCache(const AZ::Aabb& region)
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    AZStd::vector<TerrainTileCache::TileRequest> requests;
+    m_tileCache.GetRequestsForRegion(region, requests);
+
+    if (requests.empty())
+    {
+        return;
+    }
+
+    AZ::JobCompletion jobCompletion;
+    for (const auto& request : requests)
+    {
+        AZ::Job* bakeJob = AZ::CreateJobFunction([this, request]() { BakeTile(request); }, true);
+        bakeJob->SetDependent(&jobCompletion);
+        bakeJob->Start();
+    }
+    jobCompletion.StartAndWaitForCompletion();
+}
+
+bool TerrainSystem::SaveTileCache(const AZ::Aabb& region, const AZStd::string& filePath)
+{
+    BakeTileCache(region);
+
+    AZ::IO::FileIOStream stream(filePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+    if (!stream.IsOpen())
+    {
+        AZ_Error("Terrain", false, "Failed to open '%s' to save the terrain tile cache.", filePath.c_str());
+        return false;
+    }
+
+    return m_tileCache.Save(stream);
+}
+
+bool TerrainSystem::LoadTileCache(const AZStd::string& filePath)
+{
+    AZ::IO::FileIOStream stream(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+    if (!stream.IsOpen())
+    {
+        AZ_Error("Terrain", false, "Failed to open '%s' to load the terrain tile cache.", filePath.c_str());
+        return false;
+    }
+
+    AZStd::vector<char> fileData(aznumeric_cast<size_t>(stream.GetLength()));
+    if (stream.Read(fileData.size(), fileData.data()) != fileData.size())
+    {
+        AZ_Error("Terrain", false, "Failed to read '%s' to load the terrain tile cache.", filePath.c_str());
+        return false;
+    }
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_pendingTileCacheMutex);
+    m_pendingTileCache = AZStd::move(fileData);
+    m_hasPendingTileCache = true;
+    return true;
+}
+
+void TerrainSystem::ApplyPendingTileCache()
+{
+    AZStd::vector<char> fileData;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingTileCacheMutex);
+        if (!m_hasPendingTileCache)
+        {
+            return;
+        }
+        fileData = AZStd::move(m_pendingTileCache);
+        m_pendingTileCache = {};
+        m_hasPendingTileCache = false;
+    }
+
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&fileData);
+    [[maybe_unused]] const bool loaded = m_tileCache.Load(stream);
+    AZ_Warning("Terrain", loaded, "The loaded terrain tile cache doesn't match the current terrain and was ignored.");
 }
@@ -26,6 +26,7 @@
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystemBus.h>
+#include <TerrainSystem/TerrainTileCache.h>
 
 AZ_DECLARE_BUDGET(Terrain);
 
@@ -56,6 +57,12 @@ namespace Terrain
             AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
         void RefreshRegion(
             const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
+        bool SaveTileCache(const AZ::Aabb& region, const AZStd::string& filePath) override;
+        bool LoadTileCache(const AZStd::string& filePath) override;
+
+        //! Bake every tile of the terrain tile cache that overlaps the given region, and wait for the bakes to complete.
+        //! Tiles are normally baked in the background as queries miss them, this is for callers that need the region cached up front.
+        void BakeTileCache(const AZ::Aabb& region);
 
         ///////////////////////////////////////////
         // TerrainDataRequestBus::Handler Impl
@@ -171,6 +178,9 @@ namespace Terrain
         AzFramework::EntityContextId GetTerrainRaycastEntityContextId() const override;
         AzFramework::RenderGeometry::RayResult GetClosestIntersection(
             const AzFramework::RenderGeometry::RayRequest& ray) const override;
+        void GetClosestIntersections(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> outResults) const override;
 
         AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> QueryListAsync(
             const AZStd::span<const AZ::Vector3>& inPositions,
@@ -232,7 +242,8 @@ namespace Terrain
             AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
             bool* terrainExistsPtr) const;
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
-        float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        //! @param snapToGrid - The position was rounded onto the height query grid, so cached data for the nearest grid point can be used.
+        float GetTerrainAreaHeight(float x, float y, bool& terrainExists, bool snapToGrid) const;
         AZ::Vector3 GetNormalSynchronous(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const;
 
         typedef AZStd::function<void(
@@ -280,6 +291,21 @@ namespace Terrain
         AZStd::vector<AZ::Vector3> GenerateInputPositionsFromListOfVector2(
             const AZStd::span<const AZ::Vector2> inPositionsVec2) const;
 
+        //! Query the terrain areas for the heights at a list of positions, bypassing the tile cache.
+        void GetAreaHeights(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists) const;
+
+        //! Query the terrain areas for the sorted surface weights at a list of positions, bypassing the tile cache.
+        void GetAreaSurfaceWeights(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const;
+
+        //! Bake a single tile of the tile cache and store the results.
+        void BakeTile(const TerrainTileCache::TileRequest& request);
+        void ApplyPendingTileCache();
+
+        //! Start background jobs to bake the tiles that queries have missed since the last tick.
+        void StartTileBakeJobs();
+
         // AZ::TickBus::Handler overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
@@ -315,6 +341,15 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        //! Baked terrain data for grid-aligned queries.
+        TerrainTileCache m_tileCache;
+
+        //! A tile cache file read by LoadTileCache that is applied once the terrain settings and areas have settled, since loading
+        //! it earlier would just have its tiles cleared or invalidated by the start-up changes.
+        AZStd::mutex m_pendingTileCacheMutex;
+        AZStd::vector<char> m_pendingTileCache;
+        bool m_hasPendingTileCache = false;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
@@ -13,6 +13,7 @@
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/EBusSharedDispatchTraits.h>
@@ -48,6 +49,14 @@ namespace Terrain
         virtual void RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
         virtual void RefreshRegion(
             const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
+
+        // Bake the terrain tile cache for a region and write it to a file, so that static terrain can ship with pre-baked data.
+        virtual bool SaveTileCache(const AZ::Aabb& region, const AZStd::string& filePath) = 0;
+        // Load a file written by SaveTileCache into the terrain tile cache.
+        // The file is read right away, but its tiles are only added once the terrain settings and areas stop changing, so that
+        // the changes made while a level starts up don't discard them. They're ignored, with a warning, if they don't match the
+        // terrain query resolutions at that point. Returns false if the file can't be read.
+        virtual bool LoadTileCache(const AZStd::string& filePath) = 0;
     };
 
     using TerrainSystemServiceRequestBus = AZ::EBus<TerrainSystemServiceRequests>;
@@ -0,0 +1,753 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainTileCache.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+
+namespace Terrain
+{
+    namespace
+    {
+        // "TTC1" - the tag at the start of every saved tile cache.
+        constexpr AZ::u32 TileCacheFileTag = 0x31435454;
+        constexpr AZ::u32 TileCacheFileVersion = 1;
+
+        // Lookups that snap to the grid treat positions within this fraction of a grid step from a grid point as being on the grid point.
+        // This absorbs the float error from computing neighboring grid points as "position +/- queryResolution".
+        constexpr float GridAlignmentTolerance = 1.0e-3f;
+
+        // The maximum number of tiles to track individual invalidations for. Invalidating more tiles than this discards every bake
+        // that is in progress instead.
+        constexpr size_t MaxInvalidatedTiles = 4096;
+
+        // The maximum number of tile requests to hold onto. Lookups that miss beyond this are still correct, they just won't
+        // cause any more tiles to get baked until the pending requests have been processed.
+        constexpr size_t MaxPendingRequests = 4096;
+
+        int32_t FloorDivide(int32_t value, int32_t divisor)
+        {
+            const int32_t quotient = value / divisor;
+            return ((value % divisor) != 0 && (value < 0)) ? quotient - 1 : quotient;
+        }
+
+        template<typename T>
+        bool WriteValue(AZ::IO::GenericStream& stream, const T& value)
+        {
+            return stream.Write(sizeof(T), &value) == sizeof(T);
+        }
+
+        template<typename T>
+        bool ReadValue(AZ::IO::GenericStream& stream, T& value)
+        {
+            return stream.Read(sizeof(T), &value) == sizeof(T);
+        }
+    } // namespace
+
+    void TerrainTileCache::SetQueryResolutions(float heightQueryResolution, float surfaceQueryResolution)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+            if ((m_heightQueryResolution == heightQueryResolution) && (m_surfaceQueryResolution == surfaceQueryResolution))
+            {
+                return;
+            }
+        }
+
+        Clear();
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        m_heightQueryResolution = heightQueryResolution;
+        m_surfaceQueryResolution = surfaceQueryResolution;
+    }
+
+    void TerrainTileCache::SetMaxTiles(size_t maxTiles)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        m_maxTiles = AZStd::max<size_t>(maxTiles, 1);
+        EvictTiles(TileType::Heights);
+        EvictTiles(TileType::SurfaceWeights);
+    }
+
+    void TerrainTileCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        m_generation++;
+        m_discardGeneration = m_generation;
+        m_invalidatedHeightTiles.clear();
+        m_invalidatedSurfaceTiles.clear();
+        m_heightTiles.clear();
+        m_surfaceTiles.clear();
+        m_heightTileOrder.clear();
+        m_surfaceTileOrder.clear();
+
+        AZStd::lock_guard<AZStd::mutex> requestLock(m_requestMutex);
+        m_pendingHeightTiles.clear();
+        m_pendingSurfaceTiles.clear();
+    }
+
+    void TerrainTileCache::Invalidate(const AZ::Aabb& region, bool heights, bool surfaces)
+    {
+        if (!region.IsValid() || !(heights || surfaces))
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        AZStd::lock_guard<AZStd::mutex> requestLock(m_requestMutex);
+
+        // Bump the generation even if no tiles are removed, since bakes that are in progress might be using the old data.
+        m_generation++;
+
+        auto invalidateTiles = [this, &region](float resolution, auto& tiles, AZStd::deque<TileKey>& tileOrder,
+            AZStd::unordered_set<TileKey>& pending, AZStd::unordered_map<TileKey, AZ::u64>& invalidatedTiles)
+        {
+            if (resolution <= 0.0f)
+            {
+                return;
+            }
+
+            // Get the range of tiles that contain grid points inside the region. Tiles share no grid points, so expand the range
+            // out to the grid points on either side of the region to include any tiles that bilinear lookups would use.
+            const float inverseResolution = 1.0f / resolution;
+            const int32_t minTileX = FloorDivide(aznumeric_cast<int32_t>(AZStd::floor(region.GetMin().GetX() * inverseResolution)), TileSize);
+            const int32_t minTileY = FloorDivide(aznumeric_cast<int32_t>(AZStd::floor(region.GetMin().GetY() * inverseResolution)), TileSize);
+            const int32_t maxTileX = FloorDivide(aznumeric_cast<int32_t>(AZStd::ceil(region.GetMax().GetX() * inverseResolution)), TileSize);
+            const int32_t maxTileY = FloorDivide(aznumeric_cast<int32_t>(AZStd::ceil(region.GetMax().GetY() * inverseResolution)), TileSize);
+
+            auto isInRegion = [=](TileKey key)
+            {
+                int32_t tileX, tileY;
+                GetTileCoordinates(key, tileX, tileY);
+                return (tileX >= minTileX) && (tileX <= maxTileX) && (tileY >= minTileY) && (tileY <= maxTileY);
+            };
+
+            AZStd::erase_if(tiles, [&isInRegion](const auto& tile) { return isInRegion(tile.first); });
+            AZStd::erase_if(pending, isInRegion);
+            tileOrder.erase(AZStd::remove_if(tileOrder.begin(), tileOrder.end(), isInRegion), tileOrder.end());
+
+            // Record the invalidation per tile so that bakes of tiles outside of the region can still be stored.
+            const AZ::s64 tileCount = (aznumeric_cast<AZ::s64>(maxTileX) - minTileX + 1) * (aznumeric_cast<AZ::s64>(maxTileY) - minTileY + 1);
+            if ((invalidatedTiles.size() + tileCount) > MaxInvalidatedTiles)
+            {
+                m_discardGeneration = m_generation;
+                m_invalidatedHeightTiles.clear();
+                m_invalidatedSurfaceTiles.clear();
+                return;
+            }
+
+            for (int32_t tileY = minTileY; tileY <= maxTileY; tileY++)
+            {
+                for (int32_t tileX = minTileX; tileX <= maxTileX; tileX++)
+                {
+                    invalidatedTiles[MakeTileKey(tileX, tileY)] = m_generation;
+                }
+            }
+        };
+
+        if (heights)
+        {
+            invalidateTiles(m_heightQueryResolution, m_heightTiles, m_heightTileOrder, m_pendingHeightTiles, m_invalidatedHeightTiles);
+        }
+        if (surfaces)
+        {
+            invalidateTiles(
+                m_surfaceQueryResolution, m_surfaceTiles, m_surfaceTileOrder, m_pendingSurfaceTiles, m_invalidatedSurfaceTiles);
+        }
+    }
+
+    bool TerrainTileCache::LookupHeight(float x, float y, float& outHeight, bool& outExists, bool snapToGrid) const
+    {
+        TileKey key;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            int32_t gridX, gridY;
+            if ((m_heightQueryResolution <= 0.0f) ||
+                !GetGridPoint(x, y, m_heightQueryResolution, 1.0f / m_heightQueryResolution, snapToGrid, gridX, gridY))
+            {
+                return false;
+            }
+
+            size_t sampleIndex;
+            GetTileSample(gridX, gridY, key, sampleIndex);
+
+            if (auto tile = m_heightTiles.find(key); tile != m_heightTiles.end())
+            {
+                outHeight = tile->second.m_heights[sampleIndex];
+                outExists = tile->second.m_exists[sampleIndex];
+                return true;
+            }
+        }
+
+        RequestTiles(TileType::Heights, AZStd::span<const TileKey>(&key, 1));
+        return false;
+    }
+
+    void TerrainTileCache::LookupHeights(
+        AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> outExists, AZStd::vector<size_t>& outMisses, bool snapToGrid) const
+    {
+        outMisses.clear();
+        AZStd::vector<TileKey> missedTiles;
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            if (m_heightQueryResolution <= 0.0f)
+            {
+                for (size_t index = 0; index < inOutPositions.size(); index++)
+                {
+                    outMisses.emplace_back(index);
+                }
+                return;
+            }
+
+            const float inverseResolution = 1.0f / m_heightQueryResolution;
+
+            // Queries are usually spatially coherent, so remember the last tile to avoid a map lookup for every position.
+            TileKey lastKey = AZStd::numeric_limits<TileKey>::max();
+            const HeightTile* lastTile = nullptr;
+
+            for (size_t index = 0; index < inOutPositions.size(); index++)
+            {
+                int32_t gridX, gridY;
+                if (!GetGridPoint(
+                        inOutPositions[index].GetX(), inOutPositions[index].GetY(), m_heightQueryResolution, inverseResolution, snapToGrid,
+                        gridX, gridY))
+                {
+                    outMisses.emplace_back(index);
+                    continue;
+                }
+
+                TileKey key;
+                size_t sampleIndex;
+                GetTileSample(gridX, gridY, key, sampleIndex);
+
+                if (key != lastKey)
+                {
+                    lastKey = key;
+                    auto tile = m_heightTiles.find(key);
+                    lastTile = (tile != m_heightTiles.end()) ? &tile->second : nullptr;
+                    if (!lastTile)
+                    {
+                        missedTiles.emplace_back(key);
+                    }
+                }
+
+                if (lastTile)
+                {
+                    inOutPositions[index].SetZ(lastTile->m_heights[sampleIndex]);
+                    outExists[index] = lastTile->m_exists[sampleIndex];
+                }
+                else
+                {
+                    outMisses.emplace_back(index);
+                }
+            }
+        }
+
+        RequestTiles(TileType::Heights, missedTiles);
+    }
+
+    bool TerrainTileCache::LookupSurfaceWeights(
+        float x, float y, AzFramework::SurfaceData::SurfaceTagWeightList& outWeights, bool snapToGrid) const
+    {
+        TileKey key;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            int32_t gridX, gridY;
+            if ((m_surfaceQueryResolution <= 0.0f) ||
+                !GetGridPoint(x, y, m_surfaceQueryResolution, 1.0f / m_surfaceQueryResolution, snapToGrid, gridX, gridY))
+            {
+                return false;
+            }
+
+            size_t sampleIndex;
+            GetTileSample(gridX, gridY, key, sampleIndex);
+
+            if (auto tile = m_surfaceTiles.find(key); tile != m_surfaceTiles.end())
+            {
+                const auto& weights = tile->second.m_weights;
+                const auto& offsets = tile->second.m_offsets;
+                outWeights.assign(weights.begin() + offsets[sampleIndex], weights.begin() + offsets[sampleIndex + 1]);
+                return true;
+            }
+        }
+
+        RequestTiles(TileType::SurfaceWeights, AZStd::span<const TileKey>(&key, 1));
+        return false;
+    }
+
+    void TerrainTileCache::LookupSurfaceWeightsList(
+        AZStd::span<const AZ::Vector3> inPositions,
+        AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outWeights,
+        AZStd::vector<size_t>& outMisses,
+        bool snapToGrid) const
+    {
+        outMisses.clear();
+        AZStd::vector<TileKey> missedTiles;
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            if (m_surfaceQueryResolution <= 0.0f)
+            {
+                for (size_t index = 0; index < inPositions.size(); index++)
+                {
+                    outMisses.emplace_back(index);
+                }
+                return;
+            }
+
+            const float inverseResolution = 1.0f / m_surfaceQueryResolution;
+            TileKey lastKey = AZStd::numeric_limits<TileKey>::max();
+            const SurfaceTile* lastTile = nullptr;
+
+            for (size_t index = 0; index < inPositions.size(); index++)
+            {
+                int32_t gridX, gridY;
+                if (!GetGridPoint(
+                        inPositions[index].GetX(), inPositions[index].GetY(), m_surfaceQueryResolution, inverseResolution, snapToGrid,
+                        gridX, gridY))
+                {
+                    outMisses.emplace_back(index);
+                    continue;
+                }
+
+                TileKey key;
+                size_t sampleIndex;
+                GetTileSample(gridX, gridY, key, sampleIndex);
+
+                if (key != lastKey)
+                {
+                    lastKey = key;
+                    auto tile = m_surfaceTiles.find(key);
+                    lastTile = (tile != m_surfaceTiles.end()) ? &tile->second : nullptr;
+                    if (!lastTile)
+                    {
+                        missedTiles.emplace_back(key);
+                    }
+                }
+
+                if (lastTile)
+                {
+                    const auto weightsBegin = lastTile->m_weights.begin() + lastTile->m_offsets[sampleIndex];
+                    const auto weightsEnd = lastTile->m_weights.begin() + lastTile->m_offsets[sampleIndex + 1];
+                    outWeights[index].assign(weightsBegin, weightsEnd);
+                }
+                else
+                {
+                    outMisses.emplace_back(index);
+                }
+            }
+        }
+
+        RequestTiles(TileType::SurfaceWeights, missedTiles);
+    }
+
+    void TerrainTileCache::TakePendingRequests(size_t maxRequests, AZStd::vector<TileRequest>& outRequests)
+    {
+        outRequests.clear();
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        AZStd::lock_guard<AZStd::mutex> requestLock(m_requestMutex);
+
+        auto takeRequests = [this, maxRequests, &outRequests](TileType type, AZStd::unordered_set<TileKey>& pending)
+        {
+            while (!pending.empty() && (outRequests.size() < maxRequests))
+            {
+                auto request = pending.begin();
+                TileRequest& tileRequest = outRequests.emplace_back();
+                tileRequest.m_type = type;
+                tileRequest.m_generation = m_generation;
+                GetTileCoordinates(*request, tileRequest.m_tileX, tileRequest.m_tileY);
+                pending.erase(request);
+            }
+        };
+
+        takeRequests(TileType::Heights, m_pendingHeightTiles);
+        takeRequests(TileType::SurfaceWeights, m_pendingSurfaceTiles);
+    }
+
+    void TerrainTileCache::GetRequestsForRegion(const AZ::Aabb& region, AZStd::vector<TileRequest>& outRequests) const
+    {
+        outRequests.clear();
+
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        for (TileType type : { TileType::Heights, TileType::SurfaceWeights })
+        {
+            const float resolution = GetResolution(type);
+            if (resolution <= 0.0f)
+            {
+                continue;
+            }
+
+            const float inverseResolution = 1.0f / resolution;
+            const int32_t minTileX = FloorDivide(aznumeric_cast<int32_t>(AZStd::floor(region.GetMin().GetX() * inverseResolution)), TileSize);
+            const int32_t minTileY = FloorDivide(aznumeric_cast<int32_t>(AZStd::floor(region.GetMin().GetY() * inverseResolution)), TileSize);
+            const int32_t maxTileX = FloorDivide(aznumeric_cast<int32_t>(AZStd::ceil(region.GetMax().GetX() * inverseResolution)), TileSize);
+            const int32_t maxTileY = FloorDivide(aznumeric_cast<int32_t>(AZStd::ceil(region.GetMax().GetY() * inverseResolution)), TileSize);
+
+            for (int32_t tileY = minTileY; tileY <= maxTileY; tileY++)
+            {
+                for (int32_t tileX = minTileX; tileX <= maxTileX; tileX++)
+                {
+                    outRequests.push_back({ type, tileX, tileY, m_generation });
+                }
+            }
+        }
+    }
+
+    void TerrainTileCache::GetTilePositions(const TileRequest& request, float z, AZStd::vector<AZ::Vector3>& outPositions) const
+    {
+        float resolution;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+            resolution = GetResolution(request.m_type);
+        }
+
+        outPositions.clear();
+        outPositions.reserve(SamplesPerTile);
+
+        // Generate the positions the same way that the terrain system rounds positions onto the grid, so that the cached values
+        // are identical to the values that an uncached grid-aligned query would produce.
+        const int32_t gridX0 = request.m_tileX * TileSize;
+        const int32_t gridY0 = request.m_tileY * TileSize;
+        for (int32_t y = 0; y < TileSize; y++)
+        {
+            const float fy = aznumeric_cast<float>(gridY0 + y) * resolution;
+            for (int32_t x = 0; x < TileSize; x++)
+            {
+                outPositions.emplace_back(aznumeric_cast<float>(gridX0 + x) * resolution, fy, z);
+            }
+        }
+    }
+
+    void TerrainTileCache::StoreHeightTile(
+        const TileRequest& request, AZStd::span<const AZ::Vector3> positions, AZStd::span<const bool> exists)
+    {
+        AZ_Assert((positions.size() == SamplesPerTile) && (exists.size() == SamplesPerTile), "Height tiles need exactly one value per sample.");
+
+        HeightTile tile;
+        tile.m_heights.reserve(SamplesPerTile);
+        for (const AZ::Vector3& position : positions)
+        {
+            tile.m_heights.emplace_back(position.GetZ());
+        }
+        tile.m_exists.assign(exists.begin(), exists.end());
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        if (!IsRequestCurrent(request))
+        {
+            return;
+        }
+
+        const TileKey key = MakeTileKey(request.m_tileX, request.m_tileY);
+        auto [entry, inserted] = m_heightTiles.insert_or_assign(key, AZStd::move(tile));
+        if (inserted)
+        {
+            m_heightTileOrder.push_back(key);
+            EvictTiles(TileType::Heights);
+        }
+    }
+
+    void TerrainTileCache::StoreSurfaceTile(
+        const TileRequest& request, AZStd::span<const AzFramework::SurfaceData::SurfaceTagWeightList> weights)
+    {
+        AZ_Assert(weights.size() == SamplesPerTile, "Surface tiles need exactly one weight list per sample.");
+
+        SurfaceTile tile;
+        tile.m_offsets.reserve(SamplesPerTile + 1);
+        for (const auto& sampleWeights : weights)
+        {
+            tile.m_offsets.emplace_back(aznumeric_cast<uint32_t>(tile.m_weights.size()));
+            tile.m_weights.insert(tile.m_weights.end(), sampleWeights.begin(), sampleWeights.end());
+        }
+        tile.m_offsets.emplace_back(aznumeric_cast<uint32_t>(tile.m_weights.size()));
+        tile.m_weights.shrink_to_fit();
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        if (!IsRequestCurrent(request))
+        {
+            return;
+        }
+
+        const TileKey key = MakeTileKey(request.m_tileX, request.m_tileY);
+        auto [entry, inserted] = m_surfaceTiles.insert_or_assign(key, AZStd::move(tile));
+        if (inserted)
+        {
+            m_surfaceTileOrder.push_back(key);
+            EvictTiles(TileType::SurfaceWeights);
+        }
+    }
+
+    size_t TerrainTileCache::GetTileCount(TileType type) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        return (type == TileType::Heights) ? m_heightTiles.size() : m_surfaceTiles.size();
+    }
+
+    bool TerrainTileCache::Save(AZ::IO::GenericStream& stream) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        bool success = WriteValue(stream, TileCacheFileTag) && WriteValue(stream, TileCacheFileVersion) &&
+            WriteValue(stream, TileSize) && WriteValue(stream, m_heightQueryResolution) && WriteValue(stream, m_surfaceQueryResolution) &&
+            WriteValue(stream, aznumeric_cast<AZ::u32>(m_heightTiles.size())) &&
+            WriteValue(stream, aznumeric_cast<AZ::u32>(m_surfaceTiles.size()));
+
+        for (auto tile = m_heightTiles.begin(); success && (tile != m_heightTiles.end()); ++tile)
+        {
+            success = WriteValue(stream, tile->first);
+            success = success && (stream.Write(SamplesPerTile * sizeof(float), tile->second.m_heights.data()) == SamplesPerTile * sizeof(float));
+
+            AZStd::vector<AZ::u8> exists(tile->second.m_exists.begin(), tile->second.m_exists.end());
+            success = success && (stream.Write(SamplesPerTile, exists.data()) == SamplesPerTile);
+        }
+
+        for (auto tile = m_surfaceTiles.begin(); success && (tile != m_surfaceTiles.end()); ++tile)
+        {
+            success = WriteValue(stream, tile->first);
+            success = success &&
+                (stream.Write(tile->second.m_offsets.size() * sizeof(uint32_t), tile->second.m_offsets.data()) ==
+                 tile->second.m_offsets.size() * sizeof(uint32_t));
+
+            for (auto weight = tile->second.m_weights.begin(); success && (weight != tile->second.m_weights.end()); ++weight)
+            {
+                success = WriteValue(stream, static_cast<AZ::u32>(weight->m_surfaceType)) && WriteValue(stream, weight->m_weight);
+            }
+        }
+
+        return success;
+    }
+
+    bool TerrainTileCache::Load(AZ::IO::GenericStream& stream)
+    {
+        AZ::u32 tag = 0;
+        AZ::u32 version = 0;
+        int32_t tileSize = 0;
+        float heightQueryResolution = 0.0f;
+        float surfaceQueryResolution = 0.0f;
+        AZ::u32 numHeightTiles = 0;
+        AZ::u32 numSurfaceTiles = 0;
+
+        if (!(ReadValue(stream, tag) && ReadValue(stream, version) && ReadValue(stream, tileSize) &&
+              ReadValue(stream, heightQueryResolution) && ReadValue(stream, surfaceQueryResolution) &&
+              ReadValue(stream, numHeightTiles) && ReadValue(stream, numSurfaceTiles)))
+        {
+            return false;
+        }
+
+        if ((tag != TileCacheFileTag) || (version != TileCacheFileVersion) || (tileSize != TileSize))
+        {
+            AZ_Warning("Terrain", false, "Terrain tile cache has an unsupported format.");
+            return false;
+        }
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+            if ((heightQueryResolution != m_heightQueryResolution) || (surfaceQueryResolution != m_surfaceQueryResolution))
+            {
+                AZ_Warning("Terrain", false, "Terrain tile cache was saved with different query resolutions, it will be ignored.");
+                return false;
+            }
+        }
+
+        // Read everything before modifying the cache so that a truncated file doesn't leave the cache partially loaded.
+        AZStd::vector<AZStd::pair<TileKey, HeightTile>> heightTiles(numHeightTiles);
+        for (auto& [key, tile] : heightTiles)
+        {
+            tile.m_heights.resize(SamplesPerTile);
+            AZStd::vector<AZ::u8> exists(SamplesPerTile);
+            if (!ReadValue(stream, key) ||
+                (stream.Read(SamplesPerTile * sizeof(float), tile.m_heights.data()) != SamplesPerTile * sizeof(float)) ||
+                (stream.Read(SamplesPerTile, exists.data()) != SamplesPerTile))
+            {
+                return false;
+            }
+            tile.m_exists.assign(exists.begin(), exists.end());
+        }
+
+        AZStd::vector<AZStd::pair<TileKey, SurfaceTile>> surfaceTiles(numSurfaceTiles);
+        for (auto& [key, tile] : surfaceTiles)
+        {
+            tile.m_offsets.resize(SamplesPerTile + 1);
+            if (!ReadValue(stream, key) ||
+                (stream.Read(tile.m_offsets.size() * sizeof(uint32_t), tile.m_offsets.data()) != tile.m_offsets.size() * sizeof(uint32_t)))
+            {
+                return false;
+            }
+
+            // The offsets index into the weights, so reject the file if they aren't a valid partition of the weight list.
+            // Since the weight count comes from the last offset, this also keeps every offset within the weights.
+            if (tile.m_offsets.front() != 0)
+            {
+                AZ_Warning("Terrain", false, "Terrain tile cache has corrupt surface weight offsets, it will be ignored.");
+                return false;
+            }
+            for (size_t index = 1; index < tile.m_offsets.size(); index++)
+            {
+                if (tile.m_offsets[index] < tile.m_offsets[index - 1])
+                {
+                    AZ_Warning("Terrain", false, "Terrain tile cache has corrupt surface weight offsets, it will be ignored.");
+                    return false;
+                }
+            }
+
+            // Add the weights as they're read instead of sizing the list up front, so a corrupt count can't cause a huge allocation.
+            const uint32_t weightCount = tile.m_offsets.back();
+            for (uint32_t weightIndex = 0; weightIndex < weightCount; weightIndex++)
+            {
+                AZ::u32 surfaceType = 0;
+                float weight = 0.0f;
+                if (!ReadValue(stream, surfaceType) || !ReadValue(stream, weight))
+                {
+                    return false;
+                }
+                tile.m_weights.emplace_back(AZ::Crc32(surfaceType), weight);
+            }
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        for (auto& [key, tile] : heightTiles)
+        {
+            if (m_heightTiles.insert_or_assign(key, AZStd::move(tile)).second)
+            {
+                m_heightTileOrder.push_back(key);
+            }
+        }
+        for (auto& [key, tile] : surfaceTiles)
+        {
+            if (m_surfaceTiles.insert_or_assign(key, AZStd::move(tile)).second)
+            {
+                m_surfaceTileOrder.push_back(key);
+            }
+        }
+        EvictTiles(TileType::Heights);
+        EvictTiles(TileType::SurfaceWeights);
+
+        return true;
+    }
+
+    TerrainTileCache::TileKey TerrainTileCache::MakeTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (static_cast<TileKey>(static_cast<AZ::u32>(tileX)) << 32) | static_cast<TileKey>(static_cast<AZ::u32>(tileY));
+    }
+
+    void TerrainTileCache::GetTileCoordinates(TileKey key, int32_t& tileX, int32_t& tileY)
+    {
+        tileX = static_cast<int32_t>(static_cast<AZ::u32>(key >> 32));
+        tileY = static_cast<int32_t>(static_cast<AZ::u32>(key & 0xFFFFFFFF));
+    }
+
+    bool TerrainTileCache::GetGridPoint(
+        float x, float y, float resolution, float inverseResolution, bool snapToGrid, int32_t& outGridX, int32_t& outGridY)
+    {
+        // Keep the grid coordinates well inside the int32 range so that the tile math can't overflow.
+        constexpr float MaxGridCoordinate = static_cast<float>(1 << 30);
+
+        const float gridX = x * inverseResolution;
+        const float gridY = y * inverseResolution;
+        const float roundedX = AZStd::floor(gridX + 0.5f);
+        const float roundedY = AZStd::floor(gridY + 0.5f);
+
+        if ((AZStd::abs(roundedX) > MaxGridCoordinate) || (AZStd::abs(roundedY) > MaxGridCoordinate))
+        {
+            return false;
+        }
+
+        if (snapToGrid)
+        {
+            if ((AZStd::abs(gridX - roundedX) > GridAlignmentTolerance) || (AZStd::abs(gridY - roundedY) > GridAlignmentTolerance))
+            {
+                return false;
+            }
+        }
+        else if (((roundedX * resolution) != x) || ((roundedY * resolution) != y))
+        {
+            // The position has to be exactly the position the tile was baked at (see GetTilePositions) for the result to be exact.
+            return false;
+        }
+
+        outGridX = aznumeric_cast<int32_t>(roundedX);
+        outGridY = aznumeric_cast<int32_t>(roundedY);
+        return true;
+    }
+
+    void TerrainTileCache::GetTileSample(int32_t gridX, int32_t gridY, TileKey& outKey, size_t& outSampleIndex)
+    {
+        const int32_t tileX = FloorDivide(gridX, TileSize);
+        const int32_t tileY = FloorDivide(gridY, TileSize);
+        outKey = MakeTileKey(tileX, tileY);
+        outSampleIndex = aznumeric_cast<size_t>((gridY - (tileY * TileSize)) * TileSize + (gridX - (tileX * TileSize)));
+    }
+
+    float TerrainTileCache::GetResolution(TileType type) const
+    {
+        return (type == TileType::Heights) ? m_heightQueryResolution : m_surfaceQueryResolution;
+    }
+
+    bool TerrainTileCache::IsRequestCurrent(const TileRequest& request) const
+    {
+        if (request.m_generation < m_discardGeneration)
+        {
+            return false;
+        }
+
+        const auto& invalidatedTiles = (request.m_type == TileType::Heights) ? m_invalidatedHeightTiles : m_invalidatedSurfaceTiles;
+        auto invalidatedTile = invalidatedTiles.find(MakeTileKey(request.m_tileX, request.m_tileY));
+        return (invalidatedTile == invalidatedTiles.end()) || (request.m_generation >= invalidatedTile->second);
+    }
+
+    void TerrainTileCache::RequestTiles(TileType type, AZStd::span<const TileKey> keys) const
+    {
+        if (keys.empty())
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> requestLock(m_requestMutex);
+        auto& pending = (type == TileType::Heights) ? m_pendingHeightTiles : m_pendingSurfaceTiles;
+        for (TileKey key : keys)
+        {
+            if (pending.size() >= MaxPendingRequests)
+            {
+                break;
+            }
+            pending.insert(key);
+        }
+    }
+
+    void TerrainTileCache::EvictTiles(TileType type)
+    {
+        if (type == TileType::Heights)
+        {
+            while (m_heightTiles.size() > m_maxTiles)
+            {
+                m_heightTiles.erase(m_heightTileOrder.front());
+                m_heightTileOrder.pop_front();
+            }
+        }
+        else
+        {
+            while (m_surfaceTiles.size() > m_maxTiles)
+            {
+                m_surfaceTiles.erase(m_surfaceTileOrder.front());
+                m_surfaceTileOrder.pop_front();
+            }
+        }
+    }
+} // namespace Terrain
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+
+namespace Terrain
+{
+    //! TerrainTileCache stores baked terrain data for square tiles of terrain grid points, so that repeated queries on the
+    //! terrain grid don't need to evaluate the gradient stacks of the terrain areas every time.
+    //! Heights are stored at the height query resolution and surface weights at the surface data query resolution, so each
+    //! type of data has its own set of tiles.
+    //! Lookups only succeed for grid-aligned positions in tiles that have been baked. Positions computed by the CLAMP and BILINEAR
+    //! samplers can be snapped onto the grid to absorb float error, while EXACT positions need to be exactly on a grid point. Every miss records a request for the tile
+    //! that contains it, and the owner is expected to periodically take those requests, bake them, and store the results.
+    //! Lookups, requests, and stores are thread-safe.
+    class TerrainTileCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TerrainTileCache, AZ::SystemAllocator, 0);
+
+        //! The number of grid points along each side of a tile.
+        static constexpr int32_t TileSize = 64;
+        static constexpr size_t SamplesPerTile = TileSize * TileSize;
+
+        //! The default maximum number of tiles of each type to keep before the oldest tiles are evicted.
+        static constexpr size_t DefaultMaxTiles = 1024;
+
+        enum class TileType : uint8_t
+        {
+            Heights,
+            SurfaceWeights
+        };
+
+        //! A request to bake a single tile.
+        struct TileRequest
+        {
+            TileType m_type = TileType::Heights;
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+
+            //! The cache generation when the request was taken. Results are discarded when stored if the tile, or the whole cache,
+            //! was invalidated after this generation.
+            AZ::u64 m_generation = 0;
+        };
+
+        TerrainTileCache() = default;
+
+        //! Set the query resolutions that the tiles are baked at. Changing either resolution clears the cache.
+        void SetQueryResolutions(float heightQueryResolution, float surfaceQueryResolution);
+
+        void SetMaxTiles(size_t maxTiles);
+
+        //! Remove all tiles and pending requests.
+        void Clear();
+
+        //! Remove every tile that overlaps the given region, along with any pending requests for them.
+        //! Bakes of those tiles that are in progress when this is called will have their results discarded.
+        void Invalidate(const AZ::Aabb& region, bool heights, bool surfaces);
+
+        //! Get the cached height at a grid-aligned position.
+        //! @param snapToGrid - Treat positions within a small tolerance of a grid point as being on it. Only use this for positions
+        //!                     that were rounded onto the grid, since it would return the grid value for nearby exact queries.
+        //! @return False if the position isn't grid-aligned or its tile hasn't been baked yet.
+        bool LookupHeight(float x, float y, float& outHeight, bool& outExists, bool snapToGrid = false) const;
+
+        //! Get the cached heights for a list of positions. The Z value of each position is replaced with the cached height.
+        //! @param outMisses - The indices of the positions that couldn't be found in the cache. This list is cleared first.
+        void LookupHeights(
+            AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> outExists, AZStd::vector<size_t>& outMisses,
+            bool snapToGrid = false) const;
+
+        //! Get the cached surface weights, sorted in decreasing weight order, at a grid-aligned position.
+        //! @return False if the position isn't grid-aligned or its tile hasn't been baked yet.
+        bool LookupSurfaceWeights(
+            float x, float y, AzFramework::SurfaceData::SurfaceTagWeightList& outWeights, bool snapToGrid = false) const;
+
+        //! Get the cached surface weights for a list of positions.
+        //! @param outMisses - The indices of the positions that couldn't be found in the cache. This list is cleared first.
+        void LookupSurfaceWeightsList(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outWeights,
+            AZStd::vector<size_t>& outMisses,
+            bool snapToGrid = false) const;
+
+        //! Take up to maxRequests of the tile requests that were recorded by lookup misses.
+        void TakePendingRequests(size_t maxRequests, AZStd::vector<TileRequest>& outRequests);
+
+        //! Get requests for every tile that overlaps the given region, whether or not they're already baked.
+        void GetRequestsForRegion(const AZ::Aabb& region, AZStd::vector<TileRequest>& outRequests) const;
+
+        //! Get the world positions of the grid points that make up a requested tile, in row-major order.
+        void GetTilePositions(const TileRequest& request, float z, AZStd::vector<AZ::Vector3>& outPositions) const;
+
+        //! Store the baked data for a tile. The data is discarded if the cache was invalidated after the request was taken.
+        void StoreHeightTile(const TileRequest& request, AZStd::span<const AZ::Vector3> positions, AZStd::span<const bool> exists);
+        void StoreSurfaceTile(const TileRequest& request, AZStd::span<const AzFramework::SurfaceData::SurfaceTagWeightList> weights);
+
+        size_t GetTileCount(TileType type) const;
+
+        //! Write every baked tile to a stream.
+        bool Save(AZ::IO::GenericStream& stream) const;
+
+        //! Read tiles written by Save() into the cache.
+        //! @return False if the stream is invalid or corrupt, or was saved with different query resolutions, in which case nothing
+        //!         is loaded.
+        bool Load(AZ::IO::GenericStream& stream);
+
+    private:
+        using TileKey = AZ::u64;
+
+        struct HeightTile
+        {
+            AZStd::vector<float> m_heights;
+            AZStd::vector<bool> m_exists;
+        };
+
+        //! Surface weights are stored as one flat list per tile, with an offset per grid point into that list.
+        //! This keeps the tiles compact, since most points only have a few of the possible surface weights.
+        struct SurfaceTile
+        {
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeight> m_weights;
+            AZStd::vector<uint32_t> m_offsets;
+        };
+
+        static TileKey MakeTileKey(int32_t tileX, int32_t tileY);
+        static void GetTileCoordinates(TileKey key, int32_t& tileX, int32_t& tileY);
+
+        //! Convert a position into grid point coordinates.
+        //! @param snapToGrid - Accept positions within a small tolerance of a grid point, otherwise the position has to be exactly the
+        //!                     grid point that tiles are baked at.
+        //! @return False if the position isn't close enough to a grid point to use cached data for it.
+        static bool GetGridPoint(
+            float x, float y, float resolution, float inverseResolution, bool snapToGrid, int32_t& outGridX, int32_t& outGridY);
+
+        //! Split a grid point into the key of the tile that contains it and the index of the sample in that tile.
+        static void GetTileSample(int32_t gridX, int32_t gridY, TileKey& outKey, size_t& outSampleIndex);
+
+        float GetResolution(TileType type) const;
+
+        //! Check if a bake result is still valid to store. Must be called with m_tileMutex held.
+        bool IsRequestCurrent(const TileRequest& request) const;
+        void RequestTiles(TileType type, AZStd::span<const TileKey> keys) const;
+        void EvictTiles(TileType type);
+
+        mutable AZStd::shared_mutex m_tileMutex;
+        AZStd::unordered_map<TileKey, HeightTile> m_heightTiles;
+        AZStd::unordered_map<TileKey, SurfaceTile> m_surfaceTiles;
+
+        //! The order that tiles were stored in, so that the oldest tiles can be evicted first.
+        AZStd::deque<TileKey> m_heightTileOrder;
+        AZStd::deque<TileKey> m_surfaceTileOrder;
+
+        float m_heightQueryResolution = 0.0f;
+        float m_surfaceQueryResolution = 0.0f;
+        size_t m_maxTiles = DefaultMaxTiles;
+
+        //! Incremented by every invalidation. Requests record it so that bakes which started before an invalidation are discarded.
+        AZ::u64 m_generation = 0;
+
+        //! Requests taken before this generation are discarded, because the whole cache was cleared after they were taken.
+        AZ::u64 m_discardGeneration = 0;
+
+        //! The generation that each tile was last invalidated at, so that region invalidations only discard the bakes they affect.
+        //! These are only needed while older bakes are in progress, so when they grow too large they're replaced by a cache-wide
+        //! discard.
+        AZStd::unordered_map<TileKey, AZ::u64> m_invalidatedHeightTiles;
+        AZStd::unordered_map<TileKey, AZ::u64> m_invalidatedSurfaceTiles;
+
+        mutable AZStd::mutex m_requestMutex;
+        mutable AZStd::unordered_set<TileKey> m_pendingHeightTiles;
+        mutable AZStd::unordered_set<TileKey> m_pendingSurfaceTiles;
+    };
+} // namespace Terrain
@@ -9,6 +9,7 @@
 #include <AzCore/Casting/lossy_cast.h>
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Memory/MemoryComponent.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
@@ -29,6 +30,13 @@ using ::testing::AtLeast;
 using ::testing::_;
 using ::testing::Return;
 
+namespace Terrain
+{
+    AZ_CVAR_EXTERNED(bool, cl_terrainPhysicsColliderTiledUpdates);
+    AZ_CVAR_EXTERNED(uint32_t, cl_terrainPhysicsColliderTileSize);
+    AZ_CVAR_EXTERNED(uint32_t, cl_terrainPhysicsColliderMaxCachedTiles);
+}
+
 class TerrainPhysicsColliderComponentTest
     : public UnitTest::TerrainTestFixture
 {
@@ -792,3 +800,206 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderRequestSubpart
     // Validate update heightfield callback was called the exact amount of times required for the region
     EXPECT_EQ(dx * dy, callCounter);
 }
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderTiledUpdatesSwapInDirtyTilesOnTick)
+{
+    // Validate that with tiled updates enabled, terrain changes regenerate the dirty tiles in the background, and the heightfield
+    // listeners only hear about the change (and only see the new data) once the tiles are swapped in on the next tick.
+    const bool previousTiledUpdates = Terrain::cl_terrainPhysicsColliderTiledUpdates;
+    const uint32_t previousTileSize = Terrain::cl_terrainPhysicsColliderTileSize;
+    Terrain::cl_terrainPhysicsColliderTiledUpdates = true;
+    Terrain::cl_terrainPhysicsColliderTileSize = 64;
+    const size_t tileSize = 64;
+
+    AddTerrainPhysicsColliderToEntity(Terrain::TerrainPhysicsColliderConfig());
+
+    const int32_t terrainSize = 256;
+
+    const AZ::Vector3 boundsMin = AZ::Vector3(0.0f);
+    const AZ::Vector3 boundsMax = AZ::Vector3(terrainSize, terrainSize, 1024.0f);
+    const float worldCenterZ = 512.0f;
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(boundsMin, boundsMax);
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    AZStd::atomic<float> heightOffset = 0.0f;
+    auto heightGenerator = [&heightOffset](float x, float y)
+    {
+        return x + y + heightOffset;
+    };
+
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(1.0f));
+    ON_CALL(terrainListener, QueryRegion).WillByDefault(
+        [this, &heightGenerator](
+            const AzFramework::Terrain::TerrainQueryRegion& queryRegion,
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::TerrainDataMask requestedData,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter)
+        {
+            ProcessRegionLoop(queryRegion, perPositionCallback, nullptr, heightGenerator);
+        });
+    ON_CALL(terrainListener, QueryRegionAsync)
+        .WillByDefault(
+            [this, &heightGenerator](
+                const AzFramework::Terrain::TerrainQueryRegion& queryRegion,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::TerrainDataMask requestedData,
+                AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter,
+                AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params)
+                -> AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>
+            {
+                ProcessRegionLoop(queryRegion, perPositionCallback, nullptr, heightGenerator);
+
+                params->m_completionCallback(nullptr);
+                return nullptr;
+            });
+
+    ActivateEntity(m_entity.get());
+    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+        &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataCreateEnd);
+
+    NiceMock<UnitTest::MockHeightfieldProviderNotificationBusListener> heightfieldListener(m_entity->GetId());
+
+    // Change the terrain inside the first tile. Nothing should be reported until the regenerated tile gets swapped in.
+    heightOffset = 100.0f;
+    EXPECT_CALL(heightfieldListener, OnHeightfieldDataChanged(_, _)).Times(0);
+    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+        &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataChanged,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(10.0f, 10.0f, 0.0f), AZ::Vector3(20.0f, 20.0f, 1024.0f)),
+        AzFramework::Terrain::TerrainDataNotifications::HeightData);
+    m_colliderComponent->BlockOnPendingTileUpdates();
+    ::testing::Mock::VerifyAndClearExpectations(&heightfieldListener);
+
+    // On tick, the listeners should get a single notification covering exactly the dirty tile.
+    AZ::Aabb notifiedRegion = AZ::Aabb::CreateNull();
+    EXPECT_CALL(heightfieldListener, OnHeightfieldDataChanged(_, _)).Times(1).WillOnce(::testing::SaveArg<0>(&notifiedRegion));
+    AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+    ::testing::Mock::VerifyAndClearExpectations(&heightfieldListener);
+
+    size_t startColumn, startRow, numColumns, numRows;
+    m_colliderComponent->GetHeightfieldIndicesFromRegion(notifiedRegion, startColumn, startRow, numColumns, numRows);
+    EXPECT_EQ(startColumn, size_t{ 0 });
+    EXPECT_EQ(startRow, size_t{ 0 });
+    EXPECT_EQ(numColumns, tileSize);
+    EXPECT_EQ(numRows, tileSize);
+
+    // Change the terrain again without notifying the collider. The swapped-in tile should keep returning the samples it was
+    // regenerated with, and areas that haven't been regenerated into tiles should come straight from the terrain.
+    heightOffset = 200.0f;
+    m_colliderComponent->UpdateHeightsAndMaterials(
+        [worldCenterZ](size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+        {
+            EXPECT_NEAR(point.m_height, column + row + 100.0f - worldCenterZ, 0.01f);
+        },
+        8, 8, 32, 32);
+
+    m_colliderComponent->UpdateHeightsAndMaterials(
+        [worldCenterZ](size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+        {
+            EXPECT_NEAR(point.m_height, column + row + 200.0f - worldCenterZ, 0.01f);
+        },
+        100, 100, 32, 32);
+
+    Terrain::cl_terrainPhysicsColliderTiledUpdates = previousTiledUpdates;
+    Terrain::cl_terrainPhysicsColliderTileSize = previousTileSize;
+}
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderTiledUpdatesReleaseLeastRecentlyUsedTiles)
+{
+    // Validate that once more tiles have been swapped in than the collider keeps, the least recently used ones are released and
+    // their areas come straight from the terrain again.
+    const bool previousTiledUpdates = Terrain::cl_terrainPhysicsColliderTiledUpdates;
+    const uint32_t previousTileSize = Terrain::cl_terrainPhysicsColliderTileSize;
+    const uint32_t previousMaxCachedTiles = Terrain::cl_terrainPhysicsColliderMaxCachedTiles;
+    Terrain::cl_terrainPhysicsColliderTiledUpdates = true;
+    Terrain::cl_terrainPhysicsColliderTileSize = 64;
+    Terrain::cl_terrainPhysicsColliderMaxCachedTiles = 1;
+
+    AddTerrainPhysicsColliderToEntity(Terrain::TerrainPhysicsColliderConfig());
+
+    const int32_t terrainSize = 256;
+
+    const AZ::Vector3 boundsMin = AZ::Vector3(0.0f);
+    const AZ::Vector3 boundsMax = AZ::Vector3(terrainSize, terrainSize, 1024.0f);
+    const float worldCenterZ = 512.0f;
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(boundsMin, boundsMax);
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    AZStd::atomic<float> heightOffset = 0.0f;
+    auto heightGenerator = [&heightOffset](float x, float y)
+    {
+        return x + y + heightOffset;
+    };
+
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(1.0f));
+    ON_CALL(terrainListener, QueryRegion).WillByDefault(
+        [this, &heightGenerator](
+            const AzFramework::Terrain::TerrainQueryRegion& queryRegion,
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::TerrainDataMask requestedData,
+            AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+            [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter)
+        {
+            ProcessRegionLoop(queryRegion, perPositionCallback, nullptr, heightGenerator);
+        });
+    ON_CALL(terrainListener, QueryRegionAsync)
+        .WillByDefault(
+            [this, &heightGenerator](
+                const AzFramework::Terrain::TerrainQueryRegion& queryRegion,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::TerrainDataMask requestedData,
+                AzFramework::Terrain::SurfacePointRegionFillCallback perPositionCallback,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampleFilter,
+                AZStd::shared_ptr<AzFramework::Terrain::QueryAsyncParams> params)
+                -> AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>
+            {
+                ProcessRegionLoop(queryRegion, perPositionCallback, nullptr, heightGenerator);
+
+                params->m_completionCallback(nullptr);
+                return nullptr;
+            });
+
+    ActivateEntity(m_entity.get());
+    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+        &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataCreateEnd);
+
+    // Regenerate the first tile, and then a second one, swapping each of them in separately.
+    heightOffset = 100.0f;
+    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+        &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataChanged,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(10.0f, 10.0f, 0.0f), AZ::Vector3(20.0f, 20.0f, 1024.0f)),
+        AzFramework::Terrain::TerrainDataNotifications::HeightData);
+    m_colliderComponent->BlockOnPendingTileUpdates();
+    AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+
+    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+        &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataChanged,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(100.0f, 100.0f, 0.0f), AZ::Vector3(110.0f, 110.0f, 1024.0f)),
+        AzFramework::Terrain::TerrainDataNotifications::HeightData);
+    m_colliderComponent->BlockOnPendingTileUpdates();
+    AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint());
+
+    // Change the terrain without notifying the collider. Only the second tile should still be kept, so the first tile's area
+    // should return the latest terrain data.
+    heightOffset = 200.0f;
+    m_colliderComponent->UpdateHeightsAndMaterials(
+        [worldCenterZ](size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+        {
+            EXPECT_NEAR(point.m_height, column + row + 100.0f - worldCenterZ, 0.01f);
+        },
+        72, 72, 32, 32);
+
+    m_colliderComponent->UpdateHeightsAndMaterials(
+        [worldCenterZ](size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+        {
+            EXPECT_NEAR(point.m_height, column + row + 200.0f - worldCenterZ, 0.01f);
+        },
+        8, 8, 32, 32);
+
+    Terrain::cl_terrainPhysicsColliderTiledUpdates = previousTiledUpdates;
+    Terrain::cl_terrainPhysicsColliderTileSize = previousTileSize;
+    Terrain::cl_terrainPhysicsColliderMaxCachedTiles = previousMaxCachedTiles;
+}
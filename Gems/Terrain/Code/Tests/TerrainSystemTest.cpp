@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
 #include <AzCore/Memory/MemoryComponent.h>
 #include <AzCore/std/parallel/semaphore.h>
@@ -36,6 +38,8 @@ using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::SetArgReferee;
 
+AZ_CVAR_EXTERNED(bool, terrain_raycastUseHeightQuadtree);
+
 namespace UnitTest
 {
     class TerrainSystemTest
@@ -1481,6 +1485,82 @@ namespace UnitTest
         EXPECT_EQ(numFailures, 0);
     }
 
+    TEST_F(TerrainSystemTest, TerrainGetClosestIntersectionHeightQuadtreeMatchesGridWalk)
+    {
+        // Verify that raycasts using the min/max height quadtree find the same intersections as walking the terrain grid
+        // one square at a time, that the batched raycast API returns the same results as individual raycasts, and that
+        // changing the terrain height data updates the quadtree.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-64.0f, -64.0f, -20.0f, 64.0f, 64.0f, 20.0f);
+        float heightOffset = 0.0f;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                // Use rolling hills so that rays can pass over some parts of the terrain and hit others.
+                position.SetZ((5.0f * sinf(position.GetX() * 0.3f) * cosf(position.GetY() * 0.2f)) + heightOffset);
+                terrainExists = true;
+            });
+
+        constexpr unsigned int Seed = 1;
+        std::mt19937_64 rng(Seed);
+        std::uniform_real_distribution<float> unif(-60.0f, 60.0f);
+
+        for (float queryResolution : { 0.5f, 1.0f })
+        {
+            auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution);
+
+            // Mix steep rays with long, shallow rays that skim over the hills.
+            AZStd::vector<AzFramework::RenderGeometry::RayRequest> rays(100);
+            for (size_t rayIndex = 0; rayIndex < rays.size(); rayIndex++)
+            {
+                const float rayHeight = (rayIndex % 2) ? 15.0f : 4.0f;
+                rays[rayIndex].m_startWorldPosition = AZ::Vector3(unif(rng), unif(rng), rayHeight);
+                rays[rayIndex].m_endWorldPosition = AZ::Vector3(unif(rng), unif(rng), -rayHeight);
+            }
+
+            AZStd::vector<AzFramework::RenderGeometry::RayResult> gridResults;
+            terrain_raycastUseHeightQuadtree = false;
+            for (const auto& ray : rays)
+            {
+                gridResults.emplace_back(terrainSystem->GetClosestIntersection(ray));
+            }
+
+            AZStd::vector<AzFramework::RenderGeometry::RayResult> quadtreeResults;
+            terrain_raycastUseHeightQuadtree = true;
+            for (const auto& ray : rays)
+            {
+                quadtreeResults.emplace_back(terrainSystem->GetClosestIntersection(ray));
+            }
+
+            AZStd::vector<AzFramework::RenderGeometry::RayResult> batchResults(rays.size());
+            terrainSystem->GetClosestIntersections(rays, batchResults);
+
+            for (size_t rayIndex = 0; rayIndex < rays.size(); rayIndex++)
+            {
+                ASSERT_EQ(static_cast<bool>(gridResults[rayIndex]), static_cast<bool>(quadtreeResults[rayIndex]));
+                ASSERT_EQ(static_cast<bool>(quadtreeResults[rayIndex]), static_cast<bool>(batchResults[rayIndex]));
+                if (gridResults[rayIndex])
+                {
+                    EXPECT_NEAR(gridResults[rayIndex].m_distance, quadtreeResults[rayIndex].m_distance, 0.0001f);
+                    EXPECT_THAT(gridResults[rayIndex].m_worldPosition, IsClose(quadtreeResults[rayIndex].m_worldPosition));
+                    EXPECT_THAT(batchResults[rayIndex].m_worldPosition, IsClose(quadtreeResults[rayIndex].m_worldPosition));
+                }
+            }
+
+            // Raise the terrain and refresh it. A vertical ray should hit the new height right away.
+            AzFramework::RenderGeometry::RayRequest verticalRay;
+            verticalRay.m_startWorldPosition = AZ::Vector3(0.0f, 0.0f, 19.0f);
+            verticalRay.m_endWorldPosition = AZ::Vector3(0.0f, 0.0f, -19.0f);
+            EXPECT_NEAR(terrainSystem->GetClosestIntersection(verticalRay).m_worldPosition.GetZ(), 0.0f, 0.001f);
+
+            heightOffset = 10.0f;
+            terrainSystem->RefreshArea(entity->GetId(), AzFramework::Terrain::TerrainDataNotifications::HeightData);
+            EXPECT_NEAR(terrainSystem->GetClosestIntersection(verticalRay).m_worldPosition.GetZ(), 10.0f, 0.001f);
+            heightOffset = 0.0f;
+        }
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessAsyncCancellation)
     {
         // Tests cancellation of the asynchronous terrain API.
@@ -1550,4 +1630,265 @@ namespace UnitTest
         // Now wait until the async request has completed after being cancelled.
         asyncRequestCompletedEvent.acquire();
     }
+    TEST_F(TerrainSystemTest, TerrainTileCacheMatchesUncachedQueriesAndIsInvalidatedByRefresh)
+    {
+        // Verify that baked tiles produce the same results as querying the terrain areas, that queries on baked tiles don't query
+        // the terrain areas at all, and that refreshing an area drops the baked tiles so that queries see the new data.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -20.0f, 10.0f, 10.0f, 20.0f);
+        float heightOffset = 0.0f;
+        AZStd::atomic_int heightQueryCount = 0;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset, &heightQueryCount](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() + (position.GetY() * 0.5f) + heightOffset);
+                terrainExists = true;
+                heightQueryCount++;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // Query a mix of grid-aligned and in-between positions with each sampler to get the uncached results.
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = -8.0f; y < 8.0f; y += 0.75f)
+        {
+            for (float x = -8.0f; x < 8.0f; x += 0.75f)
+            {
+                positions.emplace_back(x, y, 0.0f);
+            }
+        }
+
+        const AzFramework::Terrain::TerrainDataRequests::Sampler samplers[] = {
+            AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT,
+        };
+
+        auto getHeights = [&terrainSystem, &positions](AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+        {
+            AZStd::vector<float> heights;
+            for (const auto& position : positions)
+            {
+                heights.emplace_back(terrainSystem->GetHeight(position, sampler));
+            }
+            return heights;
+        };
+
+        AZStd::vector<float> uncachedHeights[AZ_ARRAY_SIZE(samplers)];
+        for (size_t samplerIndex = 0; samplerIndex < AZ_ARRAY_SIZE(samplers); samplerIndex++)
+        {
+            uncachedHeights[samplerIndex] = getHeights(samplers[samplerIndex]);
+        }
+
+        terrainSystem->BakeTileCache(spawnerBox);
+
+        // Grid-aligned queries should now come entirely from the cache.
+        heightQueryCount = 0;
+        for (const auto& position : positions)
+        {
+            terrainSystem->GetHeight(position, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+        }
+        EXPECT_EQ(heightQueryCount, 0);
+
+        for (size_t samplerIndex = 0; samplerIndex < AZ_ARRAY_SIZE(samplers); samplerIndex++)
+        {
+            AZStd::vector<float> cachedHeights = getHeights(samplers[samplerIndex]);
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                EXPECT_NEAR(cachedHeights[index], uncachedHeights[samplerIndex][index], 0.0001f);
+            }
+        }
+
+        // Change the height data and refresh the area. The cached tiles should be dropped immediately.
+        heightOffset = 2.0f;
+        terrainSystem->RefreshArea(entity->GetId(), AzFramework::Terrain::TerrainDataNotifications::HeightData);
+
+        for (const auto& position : positions)
+        {
+            const float height = terrainSystem->GetHeight(position, AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+            const float expectedHeight = AZStd::floor(position.GetX() + 0.5f) + (AZStd::floor(position.GetY() + 0.5f) * 0.5f) + heightOffset;
+            EXPECT_NEAR(height, expectedHeight, 0.0001f);
+        }
+    }
+
+    TEST(TerrainTileCacheTest, TerrainTileCacheSaveAndLoadRoundTrips)
+    {
+        Terrain::TerrainTileCache sourceCache;
+        sourceCache.SetQueryResolutions(1.0f, 1.0f);
+
+        // Bake one tile of each type with simple predictable data.
+        AZStd::vector<Terrain::TerrainTileCache::TileRequest> requests;
+        sourceCache.GetRequestsForRegion(AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, 0.0f, 2.0f, 2.0f, 0.0f), requests);
+        ASSERT_EQ(requests.size(), 2);
+
+        const AZ::Crc32 surfaceTag("tag1");
+        for (const auto& request : requests)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            sourceCache.GetTilePositions(request, 0.0f, positions);
+
+            if (request.m_type == Terrain::TerrainTileCache::TileType::Heights)
+            {
+                AZStd::vector<bool> exists;
+                for (auto& position : positions)
+                {
+                    position.SetZ(position.GetX() * 2.0f + position.GetY());
+                    exists.emplace_back(position.GetX() != 3.0f);
+                }
+                sourceCache.StoreHeightTile(request, positions, exists);
+            }
+            else
+            {
+                AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> weights(positions.size());
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    weights[index].emplace_back(surfaceTag, positions[index].GetY() / Terrain::TerrainTileCache::TileSize);
+                }
+                sourceCache.StoreSurfaceTile(request, weights);
+            }
+        }
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+        EXPECT_TRUE(sourceCache.Save(saveStream));
+
+        // Loading into a cache with different resolutions should fail.
+        Terrain::TerrainTileCache mismatchedCache;
+        mismatchedCache.SetQueryResolutions(2.0f, 1.0f);
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> mismatchedLoadStream(&buffer);
+        EXPECT_FALSE(mismatchedCache.Load(mismatchedLoadStream));
+
+        Terrain::TerrainTileCache loadedCache;
+        loadedCache.SetQueryResolutions(1.0f, 1.0f);
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> loadStream(&buffer);
+        EXPECT_TRUE(loadedCache.Load(loadStream));
+        EXPECT_EQ(loadedCache.GetTileCount(Terrain::TerrainTileCache::TileType::Heights), 1);
+        EXPECT_EQ(loadedCache.GetTileCount(Terrain::TerrainTileCache::TileType::SurfaceWeights), 1);
+
+        float height = 0.0f;
+        bool exists = false;
+        EXPECT_TRUE(loadedCache.LookupHeight(5.0f, 7.0f, height, exists));
+        EXPECT_EQ(height, 17.0f);
+        EXPECT_TRUE(exists);
+        EXPECT_TRUE(loadedCache.LookupHeight(3.0f, 7.0f, height, exists));
+        EXPECT_FALSE(exists);
+
+        // Positions that aren't on the grid, or are in tiles that weren't baked, aren't in the cache.
+        EXPECT_FALSE(loadedCache.LookupHeight(5.5f, 7.0f, height, exists));
+        EXPECT_FALSE(loadedCache.LookupHeight(-5.0f, 7.0f, height, exists));
+
+        AzFramework::SurfaceData::SurfaceTagWeightList weights;
+        EXPECT_TRUE(loadedCache.LookupSurfaceWeights(4.0f, 32.0f, weights));
+        ASSERT_EQ(weights.size(), 1);
+        EXPECT_EQ(weights[0].m_surfaceType, surfaceTag);
+        EXPECT_EQ(weights[0].m_weight, 0.5f);
+
+        // Invalidating the region should remove the tiles again.
+        loadedCache.Invalidate(AZ::Aabb::CreateFromMinMaxValues(10.0f, 10.0f, 0.0f, 11.0f, 11.0f, 0.0f), true, false);
+        EXPECT_EQ(loadedCache.GetTileCount(Terrain::TerrainTileCache::TileType::Heights), 0);
+        EXPECT_EQ(loadedCache.GetTileCount(Terrain::TerrainTileCache::TileType::SurfaceWeights), 1);
+    }
+
+    TEST(TerrainTileCacheTest, TerrainTileCacheOnlySnapsToGridWhenRequested)
+    {
+        Terrain::TerrainTileCache cache;
+        cache.SetQueryResolutions(1.0f, 1.0f);
+
+        AZStd::vector<Terrain::TerrainTileCache::TileRequest> requests;
+        cache.GetRequestsForRegion(AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, 0.0f, 2.0f, 2.0f, 0.0f), requests);
+        ASSERT_FALSE(requests.empty());
+        ASSERT_EQ(requests[0].m_type, Terrain::TerrainTileCache::TileType::Heights);
+
+        AZStd::vector<AZ::Vector3> positions;
+        cache.GetTilePositions(requests[0], 0.0f, positions);
+        AZStd::vector<bool> exists(positions.size(), true);
+        cache.StoreHeightTile(requests[0], positions, exists);
+
+        // A position slightly off of a grid point only uses the cached grid point when snapping, as an EXACT query would.
+        float height = 0.0f;
+        bool terrainExists = false;
+        EXPECT_TRUE(cache.LookupHeight(5.0f, 7.0f, height, terrainExists));
+        EXPECT_FALSE(cache.LookupHeight(5.0001f, 7.0f, height, terrainExists));
+        EXPECT_TRUE(cache.LookupHeight(5.0001f, 7.0f, height, terrainExists, true));
+    }
+
+    TEST(TerrainTileCacheTest, TerrainTileCacheRegionInvalidationOnlyDiscardsAffectedBakes)
+    {
+        Terrain::TerrainTileCache cache;
+        cache.SetQueryResolutions(1.0f, 1.0f);
+
+        // Take requests for two height tiles that are far apart.
+        AZStd::vector<Terrain::TerrainTileCache::TileRequest> nearRequests;
+        AZStd::vector<Terrain::TerrainTileCache::TileRequest> farRequests;
+        cache.GetRequestsForRegion(AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, 0.0f, 2.0f, 2.0f, 0.0f), nearRequests);
+        cache.GetRequestsForRegion(AZ::Aabb::CreateFromMinMaxValues(1001.0f, 1001.0f, 0.0f, 1002.0f, 1002.0f, 0.0f), farRequests);
+
+        // Invalidate the region around the first tile while both bakes are "in progress".
+        cache.Invalidate(AZ::Aabb::CreateFromMinMaxValues(10.0f, 10.0f, 0.0f, 11.0f, 11.0f, 0.0f), true, true);
+
+        for (const auto& request : { nearRequests[0], farRequests[0] })
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            cache.GetTilePositions(request, 0.0f, positions);
+            AZStd::vector<bool> exists(positions.size(), true);
+            cache.StoreHeightTile(request, positions, exists);
+        }
+
+        // Only the bake of the tile in the invalidated region should have been discarded.
+        float height = 0.0f;
+        bool terrainExists = false;
+        EXPECT_FALSE(cache.LookupHeight(5.0f, 7.0f, height, terrainExists));
+        EXPECT_TRUE(cache.LookupHeight(1005.0f, 1007.0f, height, terrainExists));
+
+        // Clearing the cache discards every bake in progress.
+        cache.GetRequestsForRegion(AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, 0.0f, 2.0f, 2.0f, 0.0f), nearRequests);
+        cache.Clear();
+        AZStd::vector<AZ::Vector3> positions;
+        cache.GetTilePositions(nearRequests[0], 0.0f, positions);
+        AZStd::vector<bool> exists(positions.size(), true);
+        cache.StoreHeightTile(nearRequests[0], positions, exists);
+        EXPECT_EQ(cache.GetTileCount(Terrain::TerrainTileCache::TileType::Heights), 0);
+    }
+
+    TEST(TerrainTileCacheTest, TerrainTileCacheRejectsCorruptSurfaceOffsets)
+    {
+        Terrain::TerrainTileCache sourceCache;
+        sourceCache.SetQueryResolutions(1.0f, 1.0f);
+
+        AZStd::vector<Terrain::TerrainTileCache::TileRequest> requests;
+        sourceCache.GetRequestsForRegion(AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, 0.0f, 2.0f, 2.0f, 0.0f), requests);
+        ASSERT_EQ(requests.size(), 2);
+        ASSERT_EQ(requests[1].m_type, Terrain::TerrainTileCache::TileType::SurfaceWeights);
+
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> weights(Terrain::TerrainTileCache::SamplesPerTile);
+        for (auto& sampleWeights : weights)
+        {
+            sampleWeights.emplace_back(AZ::Crc32("tag1"), 1.0f);
+        }
+        sourceCache.StoreSurfaceTile(requests[1], weights);
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+        ASSERT_TRUE(sourceCache.Save(saveStream));
+
+        // The offsets follow the file header (tag, version, tile size, two resolutions, two tile counts) and the tile key.
+        const size_t offsetsStart = (sizeof(AZ::u32) * 7) + sizeof(AZ::u64);
+        auto corruptOffset = [&buffer, offsetsStart](size_t offsetIndex, uint32_t value)
+        {
+            AZStd::vector<char> corruptBuffer = buffer;
+            memcpy(corruptBuffer.data() + offsetsStart + (offsetIndex * sizeof(uint32_t)), &value, sizeof(value));
+            return corruptBuffer;
+        };
+
+        // A first offset that isn't zero, and offsets that decrease, should both cause the file to be rejected.
+        for (AZStd::vector<char> corruptBuffer : { corruptOffset(0, 1), corruptOffset(10, 0) })
+        {
+            Terrain::TerrainTileCache loadedCache;
+            loadedCache.SetQueryResolutions(1.0f, 1.0f);
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> loadStream(&corruptBuffer);
+            EXPECT_FALSE(loadedCache.Load(loadStream));
+            EXPECT_EQ(loadedCache.GetTileCount(Terrain::TerrainTileCache::TileType::SurfaceWeights), 0);
+        }
+    }
 } // namespace UnitTest
@@ -98,6 +98,12 @@ namespace UnitTest
         void CreateTestTerrainSystemWithSurfaceGradients(const AZ::Aabb& worldBounds, float queryResolution);
         void DestroyTestTerrainSystem();
 
+        // Get the terrain system created by CreateTestTerrainSystem(), or nullptr if there isn't one.
+        Terrain::TerrainSystem* GetTestTerrainSystem() const
+        {
+            return m_terrainSystem.get();
+        }
+
     private:
         // State data for a full test terrain system setup.
         AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_heightGradientEntities;
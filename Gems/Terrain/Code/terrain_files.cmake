@@ -27,6 +27,8 @@ set(FILES
     Source/Components/TerrainWorldDebuggerComponent.h
     Source/Components/TerrainWorldRendererComponent.cpp
     Source/Components/TerrainWorldRendererComponent.h
+    Source/TerrainRaycast/TerrainHeightQuadtree.cpp
+    Source/TerrainRaycast/TerrainHeightQuadtree.h
     Source/TerrainRaycast/TerrainRaycastContext.cpp
     Source/TerrainRaycast/TerrainRaycastContext.h
     Source/TerrainRenderer/Components/TerrainSurfaceMaterialsListComponent.cpp
@@ -61,4 +63,6 @@ set(FILES
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
+    Source/TerrainSystem/TerrainTileCache.cpp
+    Source/TerrainSystem/TerrainTileCache.h
 )
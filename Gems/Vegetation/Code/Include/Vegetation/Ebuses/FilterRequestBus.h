@@ -9,11 +9,12 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/span.h>
+#include <Vegetation/InstanceData.h>
 
 namespace Vegetation
 {
     struct Descriptor;
-    struct InstanceData;
 
     //stages determine the order of execution of filter requests
     enum class FilterStage : AZ::u8
@@ -34,6 +35,30 @@ namespace Vegetation
 
         virtual bool Evaluate(const InstanceData& instanceData) const = 0;
 
+        /**
+        * Evaluates a batch of instances at once, such as all of the claim points in a sector.
+        * Only the instances whose accepted flag is still set are evaluated, and the flag is cleared for every instance that gets
+        * filtered out. The default implementation calls Evaluate() per instance; filters that can share work across the batch
+        * (gradient lookups, shape queries, SIMD comparisons) should override it.
+        */
+        virtual void EvaluateBatch(AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted) const
+        {
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                if (accepted[index])
+                {
+                    accepted[index] = Evaluate(instances[index]);
+                }
+            }
+        }
+
+        /**
+        * Returns true if the result depends on instances that were claimed earlier in the same fill, such as the distance
+        * between filter. These filters can't be evaluated before the instances are claimed, so batched claims evaluate them
+        * one instance at a time, in claim order.
+        */
+        virtual bool IsOrderDependent() const { return false; }
+
         virtual void SetFilterStage(FilterStage filterStage) = 0;
 
         virtual FilterStage GetFilterStage() const { return FilterStage::Default; };
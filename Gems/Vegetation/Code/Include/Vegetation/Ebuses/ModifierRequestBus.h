@@ -10,11 +10,12 @@
 
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/EBus/Policies.h>
+#include <AzCore/std/containers/span.h>
+#include <Vegetation/InstanceData.h>
 
 namespace Vegetation
 {
     struct Descriptor;
-    struct InstanceData;
 
     //stages determine the order of execution of modifier requests
     //currently used to ensure that positional modifiers occur first since surface related modifiers rely on a final position
@@ -48,6 +49,21 @@ namespace Vegetation
 
         virtual void Execute(InstanceData& instanceData) const = 0;
 
+        /**
+        * Modifies a batch of instances at once, skipping the instances whose active flag isn't set.
+        * The default implementation calls Execute() per instance; modifiers that can share work across the batch should override it.
+        */
+        virtual void ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const
+        {
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                if (active[index])
+                {
+                    Execute(instances[index]);
+                }
+            }
+        }
+
         virtual ModifierStage GetModifierStage() const { return ModifierStage::Standard; };
     };
 
@@ -22,6 +22,9 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -39,6 +42,9 @@
 
 namespace Vegetation
 {
+    AZ_CVAR(AZ::u32, veg_sectorPointPrefetchCount, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of upcoming sectors to gather surface points for in parallel jobs. 0 or 1 gathers them one sector at a time.");
+
     namespace AreaSystemUtil
     {
         template <typename T>
@@ -1074,14 +1080,22 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode, SectorInfo* prefetchedSector)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
         SectorInfo sectorInfo;
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        if (prefetchedSector)
+        {
+            sectorInfo.m_baseContext.m_availablePoints = AZStd::move(prefetchedSector->m_baseContext.m_availablePoints);
+            sectorInfo.m_baseContext.m_masks = AZStd::move(prefetchedSector->m_baseContext.m_masks);
+        }
+        else
+        {
+            UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        }
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
@@ -1551,6 +1565,9 @@ namespace Vegetation
     {
         AZ_PROFILE_FUNCTION(Entity);
 
+        // Any prefetched surface points might be out of date now, so they'll get gathered again as needed.
+        m_prefetchedSectors.clear();
+
         auto& worldToSector = m_cachedMainThreadData.m_worldToSector;
         auto& currViewRect = m_cachedMainThreadData.m_currViewRect;
 
@@ -1780,6 +1797,11 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
+            if (m_updateWorkList.back().second != UpdateMode::Fill)
+            {
+                PrefetchSectorPoints(vegTasks);
+            }
+
             auto& updateEntry = m_updateWorkList.back();
             SectorId sectorId = updateEntry.first;
             UpdateMode mode = updateEntry.second;
@@ -1798,7 +1820,10 @@ namespace Vegetation
                     {
                         auto sectorInfo = vegTasks->GetSector(sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        if (!TakePrefetchedSectorPoints(sectorId, *sectorInfo))
+                        {
+                            vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        }
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1814,7 +1839,10 @@ namespace Vegetation
                     case UpdateMode::Create:
                     {
                         AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        SectorInfo prefetchedSector;
+                        const bool isPrefetched = TakePrefetchedSectorPoints(sectorId, prefetchedSector);
+                        auto sectorInfo = vegTasks->CreateSector(
+                            sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode, isPrefetched ? &prefetchedSector : nullptr);
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1828,4 +1856,82 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::PrefetchSectorPoints(VegetationThreadTasks* vegTasks)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t prefetchCount = veg_sectorPointPrefetchCount;
+        if (!jobContext || prefetchCount <= 1)
+        {
+            return;
+        }
+
+        // The work list is processed from the back, so gather the sectors that will need new surface points soonest.
+        AZStd::vector<SectorId> sectorsToPrefetch;
+        for (auto entry = m_updateWorkList.rbegin(); entry != m_updateWorkList.rend(); ++entry)
+        {
+            if (sectorsToPrefetch.size() >= prefetchCount)
+            {
+                break;
+            }
+
+            const SectorId& sectorId = entry->first;
+            if (entry->second == UpdateMode::Fill ||
+                AZStd::find_if(m_prefetchedSectors.begin(), m_prefetchedSectors.end(), [&sectorId](const SectorInfo& sectorInfo)
+                    { return sectorInfo.m_id == sectorId; }) != m_prefetchedSectors.end())
+            {
+                continue;
+            }
+            sectorsToPrefetch.push_back(sectorId);
+        }
+
+        // A single sector is cheaper to query directly than to hand off to a job.
+        if (sectorsToPrefetch.size() <= 1)
+        {
+            return;
+        }
+
+        const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        const size_t firstPrefetched = m_prefetchedSectors.size();
+        m_prefetchedSectors.resize(firstPrefetched + sectorsToPrefetch.size());
+
+        // Surface point queries are thread-safe, and each job only writes to its own SectorInfo.
+        AZ::JobCompletion jobCompletion;
+        for (size_t index = 0; index < sectorsToPrefetch.size(); ++index)
+        {
+            SectorInfo& sectorInfo = m_prefetchedSectors[firstPrefetched + index];
+            sectorInfo.m_id = sectorsToPrefetch[index];
+            sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(sectorInfo.m_id, sectorSizeInMeters);
+
+            AZ::Job* job = AZ::CreateJobFunction(
+                [vegTasks, &sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                {
+                    vegTasks->UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                },
+                true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    bool AreaSystemComponent::UpdateContext::TakePrefetchedSectorPoints(const SectorId& sectorId, SectorInfo& sectorInfo)
+    {
+        auto prefetched = AZStd::find_if(m_prefetchedSectors.begin(), m_prefetchedSectors.end(), [&sectorId](const SectorInfo& prefetchedSector)
+            { return prefetchedSector.m_id == sectorId; });
+        if (prefetched == m_prefetchedSectors.end())
+        {
+            return false;
+        }
+
+        sectorInfo.m_baseContext.m_availablePoints = AZStd::move(prefetched->m_baseContext.m_availablePoints);
+        sectorInfo.m_baseContext.m_masks = AZStd::move(prefetched->m_baseContext.m_masks);
+        m_prefetchedSectors.erase(prefetched);
+        return true;
+    }
+
 }
@@ -291,7 +291,8 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Creates a sector, using the surface points from prefetchedSector instead of querying them when it's provided.
+            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode, SectorInfo* prefetchedSector = nullptr);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
@@ -431,6 +432,13 @@ namespace Vegetation
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
 
+            //! Gathers the surface points for the next few sectors that need them in parallel jobs, so that the sequential
+            //! fills don't have to wait on surface queries one sector at a time.
+            void PrefetchSectorPoints(VegetationThreadTasks* vegTasks);
+            //! Moves the prefetched surface points for a sector into sectorInfo.
+            //! \return false if the sector wasn't prefetched, in which case the points need to be queried directly.
+            bool TakePrefetchedSectorPoints(const SectorId& sectorId, SectorInfo& sectorInfo);
+
             enum class UpdateMode
             {
                 Create,
@@ -455,6 +463,9 @@ namespace Vegetation
             // thread without requiring mutexes.
             CachedMainThreadData m_cachedMainThreadData;
 
+            // Sectors whose surface points were gathered ahead of their turn in m_updateWorkList.  This is cleared
+            // whenever the work lists are refreshed, since the refresh can be caused by surface changes.
+            AZStd::vector<SectorInfo> m_prefetchedSectors;
         };
 
         bool ApplyPendingConfigChanges();
@@ -216,6 +216,12 @@ namespace Vegetation
         return !intersects;
     }
 
+    bool DistanceBetweenFilterComponent::IsOrderDependent() const
+    {
+        // The filter tests against the instances that were already claimed, so it has to run as each instance is claimed.
+        return true;
+    }
+
     FilterStage DistanceBetweenFilterComponent::GetFilterStage() const
     {
         return FilterStage::PostProcess;
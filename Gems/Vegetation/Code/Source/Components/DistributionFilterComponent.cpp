@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <Vegetation/InstanceData.h>
+#include "InstanceBatchUtil.h"
 #include <AzCore/Debug/Profiler.h>
 
 #include <Vegetation/Ebuses/DebugNotificationBus.h>
@@ -201,6 +202,27 @@ namespace Vegetation
         return result;
     }
 
+    void DistributionFilterComponent::EvaluateBatch(AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Sample the gradient for the whole batch with one GetValues() call instead of one GetValue() per instance.
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<size_t> indices;
+        InstanceBatchUtil::GatherPositions(instances, accepted, positions, indices);
+        if (positions.empty())
+        {
+            return;
+        }
+
+        AZStd::vector<float> noise(positions.size());
+        m_configuration.m_gradientSampler.GetValues(positions, noise);
+
+        InstanceBatchUtil::FilterRange(
+            instances, noise, m_configuration.m_thresholdMin, m_configuration.m_thresholdMax, indices, accepted,
+            AZStd::string_view("DistributionFilter"));
+    }
+
     FilterStage DistributionFilterComponent::GetFilterStage() const
     {
         return m_configuration.m_filterStage;
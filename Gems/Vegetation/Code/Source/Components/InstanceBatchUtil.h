@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <VegetationProfiler.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+#include <Vegetation/Ebuses/DebugNotificationBus.h>
+#include <Vegetation/InstanceData.h>
+
+namespace Vegetation
+{
+    //! Helpers shared by the filters and modifiers that override EvaluateBatch() / ExecuteBatch().
+    namespace InstanceBatchUtil
+    {
+        //! Gathers the positions of the active instances into a contiguous list for span APIs such as GradientSampler::GetValues().
+        //! outIndices maps each gathered position back to its instance index.
+        inline void GatherPositions(
+            AZStd::span<const InstanceData> instances, AZStd::span<const bool> active,
+            AZStd::vector<AZ::Vector3>& outPositions, AZStd::vector<size_t>& outIndices)
+        {
+            outPositions.clear();
+            outIndices.clear();
+            outPositions.reserve(instances.size());
+            outIndices.reserve(instances.size());
+
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                if (active[index])
+                {
+                    outPositions.emplace_back(instances[index].m_position);
+                    outIndices.emplace_back(index);
+                }
+            }
+        }
+
+        //! Clears the accepted flag for every gathered value outside of its [min, max] range, four values at a time.
+        //! values and indices are parallel lists, as produced by GatherPositions(). The range for each value comes from
+        //! rangeSimd(index), which returns the min and max for four values, and rangeScalar(index) for the remainder.
+        template<typename RangeSimd, typename RangeScalar>
+        void FilterRange(
+            AZStd::span<const InstanceData> instances, AZStd::span<const float> values, AZStd::span<const size_t> indices,
+            AZStd::span<bool> accepted, [[maybe_unused]] AZStd::string_view filterName, RangeSimd&& rangeSimd,
+            RangeScalar&& rangeScalar)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+
+            auto setResult = [&](size_t valueIndex, bool inside)
+            {
+                const size_t instanceIndex = indices[valueIndex];
+                accepted[instanceIndex] = inside;
+                if (!inside)
+                {
+                    VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(
+                        &DebugNotificationBus::Events::FilterInstance, instances[instanceIndex].m_id, filterName));
+                }
+            };
+
+            const size_t count = values.size();
+            const size_t simdCount = count & ~size_t(3);
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+            for (size_t index = 0; index < simdCount; index += 4)
+            {
+                Vec4::FloatType minValue;
+                Vec4::FloatType maxValue;
+                rangeSimd(index, minValue, maxValue);
+
+                const Vec4::FloatType value = Vec4::LoadUnaligned(&values[index]);
+                const Vec4::FloatType inside = Vec4::And(Vec4::CmpGtEq(value, minValue), Vec4::CmpLtEq(value, maxValue));
+
+                float results[4];
+                Vec4::StoreUnaligned(results, Vec4::Select(one, zero, inside));
+                for (size_t lane = 0; lane < 4; ++lane)
+                {
+                    setResult(index + lane, results[lane] != 0.0f);
+                }
+            }
+
+            for (size_t index = simdCount; index < count; ++index)
+            {
+                float minValue;
+                float maxValue;
+                rangeScalar(index, minValue, maxValue);
+                setResult(index, (values[index] >= minValue) && (values[index] <= maxValue));
+            }
+        }
+
+        //! Filters with a separate range per value, for filters where descriptors can override the range.
+        inline void FilterRange(
+            AZStd::span<const InstanceData> instances, AZStd::span<const float> values, AZStd::span<const float> minValues,
+            AZStd::span<const float> maxValues, AZStd::span<const size_t> indices, AZStd::span<bool> accepted,
+            AZStd::string_view filterName)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            FilterRange(instances, values, indices, accepted, filterName,
+                [&](size_t index, Vec4::FloatType& minValue, Vec4::FloatType& maxValue)
+                {
+                    minValue = Vec4::LoadUnaligned(&minValues[index]);
+                    maxValue = Vec4::LoadUnaligned(&maxValues[index]);
+                },
+                [&](size_t index, float& minValue, float& maxValue)
+                {
+                    minValue = minValues[index];
+                    maxValue = maxValues[index];
+                });
+        }
+
+        //! Filters with the same range for every value.
+        inline void FilterRange(
+            AZStd::span<const InstanceData> instances, AZStd::span<const float> values, float minValue, float maxValue,
+            AZStd::span<const size_t> indices, AZStd::span<bool> accepted, AZStd::string_view filterName)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            const Vec4::FloatType minSplat = Vec4::Splat(minValue);
+            const Vec4::FloatType maxSplat = Vec4::Splat(maxValue);
+            FilterRange(instances, values, indices, accepted, filterName,
+                [&]([[maybe_unused]] size_t index, Vec4::FloatType& outMin, Vec4::FloatType& outMax)
+                {
+                    outMin = minSplat;
+                    outMax = maxSplat;
+                },
+                [&]([[maybe_unused]] size_t index, float& outMin, float& outMax)
+                {
+                    outMin = minValue;
+                    outMax = maxValue;
+                });
+        }
+    } // namespace InstanceBatchUtil
+} // namespace Vegetation
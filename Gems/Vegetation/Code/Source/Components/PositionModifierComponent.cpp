@@ -15,6 +15,7 @@
 #include <Vegetation/Descriptor.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <Vegetation/InstanceData.h>
+#include "InstanceBatchUtil.h"
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <AzCore/Debug/Profiler.h>
 
@@ -287,14 +288,39 @@ namespace Vegetation
         float factorX = m_configuration.m_gradientSamplerX.GetValue(sampleParams);
         float factorY = m_configuration.m_gradientSamplerY.GetValue(sampleParams);
         float factorZ = m_configuration.m_gradientSamplerZ.GetValue(sampleParams);
+        ApplyPosition(instanceData, AZ::Vector3(factorX, factorY, factorZ));
+    }
+
+    void PositionModifierComponent::ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<size_t> indices;
+        InstanceBatchUtil::GatherPositions(instances, active, positions, indices);
+
+        AZStd::vector<float> factorsX(positions.size());
+        AZStd::vector<float> factorsY(positions.size());
+        AZStd::vector<float> factorsZ(positions.size());
+        m_configuration.m_gradientSamplerX.GetValues(positions, factorsX);
+        m_configuration.m_gradientSamplerY.GetValues(positions, factorsY);
+        m_configuration.m_gradientSamplerZ.GetValues(positions, factorsZ);
 
+        for (size_t index = 0; index < indices.size(); ++index)
+        {
+            ApplyPosition(instances[indices[index]], AZ::Vector3(factorsX[index], factorsY[index], factorsZ[index]));
+        }
+    }
+
+    void PositionModifierComponent::ApplyPosition(InstanceData& instanceData, const AZ::Vector3& factors) const
+    {
         const bool useOverrides = m_configuration.m_allowOverrides && instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->m_positionOverrideEnabled;
         const AZ::Vector3& min = useOverrides ? instanceData.m_descriptorPtr->GetPositionMin() : GetRangeMin();
         const AZ::Vector3& max = useOverrides ? instanceData.m_descriptorPtr->GetPositionMax() : GetRangeMax();
         const AZ::Vector3 delta = min + AZ::Vector3(
-            (max.GetX() - min.GetX()) * factorX,
-            (max.GetY() - min.GetY()) * factorY,
-            (max.GetZ() - min.GetZ()) * factorZ);
+            (max.GetX() - min.GetX()) * factors.GetX(),
+            (max.GetY() - min.GetY()) * factors.GetY(),
+            (max.GetZ() - min.GetZ()) * factors.GetZ());
         const AZ::Vector3 deltaXY(delta.GetX(), delta.GetY(), 0.0f);
 
         instanceData.m_position += deltaXY;
@@ -85,6 +85,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationModifierRequestBus
         void Execute(InstanceData& instanceData) const override;
+        void ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const override;
         ModifierStage GetModifierStage() const override;
 
     protected:
@@ -105,6 +106,10 @@ namespace Vegetation
         void AddTag(AZStd::string tag) override;
 
     private:
+        //! Applies the offset and surface snapping for the sampled X, Y and Z gradient values, shared by Execute() and ExecuteBatch().
+        //! Snapping still queries the surface per instance, since it depends on the offset position.
+        void ApplyPosition(InstanceData& instanceData, const AZ::Vector3& factors) const;
+
         PositionModifierConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
 
@@ -14,6 +14,7 @@
 #include <Vegetation/Descriptor.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <Vegetation/InstanceData.h>
+#include "InstanceBatchUtil.h"
 #include <AzCore/Debug/Profiler.h>
 
 namespace Vegetation
@@ -245,15 +246,40 @@ namespace Vegetation
         float factorX = m_configuration.m_gradientSamplerX.GetValue(sampleParams);
         float factorY = m_configuration.m_gradientSamplerY.GetValue(sampleParams);
         float factorZ = m_configuration.m_gradientSamplerZ.GetValue(sampleParams);
+        ApplyRotation(instanceData, AZ::Vector3(factorX, factorY, factorZ));
+    }
+
+    void RotationModifierComponent::ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<size_t> indices;
+        InstanceBatchUtil::GatherPositions(instances, active, positions, indices);
+
+        AZStd::vector<float> factorsX(positions.size());
+        AZStd::vector<float> factorsY(positions.size());
+        AZStd::vector<float> factorsZ(positions.size());
+        m_configuration.m_gradientSamplerX.GetValues(positions, factorsX);
+        m_configuration.m_gradientSamplerY.GetValues(positions, factorsY);
+        m_configuration.m_gradientSamplerZ.GetValues(positions, factorsZ);
 
+        for (size_t index = 0; index < indices.size(); ++index)
+        {
+            ApplyRotation(instances[indices[index]], AZ::Vector3(factorsX[index], factorsY[index], factorsZ[index]));
+        }
+    }
+
+    void RotationModifierComponent::ApplyRotation(InstanceData& instanceData, const AZ::Vector3& factors) const
+    {
         const bool useOverrides = m_configuration.m_allowOverrides && instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->m_rotationOverrideEnabled;
         const AZ::Vector3& min = useOverrides ? instanceData.m_descriptorPtr->GetRotationMin() : GetRangeMin();
         const AZ::Vector3& max = useOverrides ? instanceData.m_descriptorPtr->GetRotationMax() : GetRangeMax();
 
         instanceData.m_rotation = AZ::ConvertEulerDegreesToQuaternion(AZ::Vector3(
-            factorX * (max.GetX() - min.GetX()) + min.GetX(),
-            factorY * (max.GetY() - min.GetY()) + min.GetY(),
-            factorZ * (max.GetZ() - min.GetZ()) + min.GetZ()));
+            factors.GetX() * (max.GetX() - min.GetX()) + min.GetX(),
+            factors.GetY() * (max.GetY() - min.GetY()) + min.GetY(),
+            factors.GetZ() * (max.GetZ() - min.GetZ()) + min.GetZ()));
     }
 
     bool RotationModifierComponent::GetAllowOverrides() const
@@ -77,6 +77,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationModifierRequestBus
         void Execute(InstanceData& instanceData) const override;
+        void ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -91,6 +92,9 @@ namespace Vegetation
         GradientSignal::GradientSampler& GetGradientSamplerY() override;
         GradientSignal::GradientSampler& GetGradientSamplerZ() override;
     private:
+        //! Applies the rotation for the sampled X, Y and Z gradient values, shared by Execute() and ExecuteBatch().
+        void ApplyRotation(InstanceData& instanceData, const AZ::Vector3& factors) const;
+
         RotationModifierConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
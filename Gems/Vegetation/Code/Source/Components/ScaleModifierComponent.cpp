@@ -14,6 +14,7 @@
 #include <Vegetation/Descriptor.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <Vegetation/InstanceData.h>
+#include "InstanceBatchUtil.h"
 #include <AzCore/Debug/Profiler.h>
 
 namespace Vegetation
@@ -166,7 +167,28 @@ namespace Vegetation
 
         const GradientSignal::GradientSampleParams sampleParams(instanceData.m_position);
         float factor = m_configuration.m_gradientSampler.GetValue(sampleParams);
+        ApplyScale(instanceData, factor);
+    }
+
+    void ScaleModifierComponent::ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<size_t> indices;
+        InstanceBatchUtil::GatherPositions(instances, active, positions, indices);
+
+        AZStd::vector<float> factors(positions.size());
+        m_configuration.m_gradientSampler.GetValues(positions, factors);
 
+        for (size_t index = 0; index < indices.size(); ++index)
+        {
+            ApplyScale(instances[indices[index]], factors[index]);
+        }
+    }
+
+    void ScaleModifierComponent::ApplyScale(InstanceData& instanceData, float factor) const
+    {
         const bool useOverrides = m_configuration.m_allowOverrides && instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->m_scaleOverrideEnabled;
         const float min = useOverrides ? instanceData.m_descriptorPtr->m_scaleMin : m_configuration.m_rangeMin;
         const float max = useOverrides ? instanceData.m_descriptorPtr->m_scaleMax : m_configuration.m_rangeMax;
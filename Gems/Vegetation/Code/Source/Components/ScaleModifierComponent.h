@@ -68,6 +68,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationModifierRequestBus
         void Execute(InstanceData& instanceData) const override;
+        void ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -82,6 +83,9 @@ namespace Vegetation
 
 
     private:
+        //! Applies the scale for a sampled gradient value, shared by Execute() and ExecuteBatch().
+        void ApplyScale(InstanceData& instanceData, float factor) const;
+
         ScaleModifierConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
@@ -15,6 +15,7 @@
 #include <Vegetation/Descriptor.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <Vegetation/InstanceData.h>
+#include "InstanceBatchUtil.h"
 #include <AzCore/Debug/Profiler.h>
 
 namespace Vegetation
@@ -161,12 +162,34 @@ namespace Vegetation
     {
         AZ_PROFILE_FUNCTION(Entity);
 
+        const GradientSignal::GradientSampleParams sampleParams(instanceData.m_position);
+        ApplyAlignment(instanceData, m_configuration.m_gradientSampler.GetValue(sampleParams));
+    }
+
+    void SlopeAlignmentModifierComponent::ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<size_t> indices;
+        InstanceBatchUtil::GatherPositions(instances, active, positions, indices);
+
+        AZStd::vector<float> gradientValues(positions.size());
+        m_configuration.m_gradientSampler.GetValues(positions, gradientValues);
+
+        for (size_t index = 0; index < indices.size(); ++index)
+        {
+            ApplyAlignment(instances[indices[index]], gradientValues[index]);
+        }
+    }
+
+    void SlopeAlignmentModifierComponent::ApplyAlignment(InstanceData& instanceData, float gradientValue) const
+    {
         const bool useOverrides = m_configuration.m_allowOverrides && instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->m_surfaceAlignmentOverrideEnabled;
         const float min = useOverrides ? instanceData.m_descriptorPtr->m_surfaceAlignmentMin : m_configuration.m_rangeMin;
         const float max = useOverrides ? instanceData.m_descriptorPtr->m_surfaceAlignmentMax : m_configuration.m_rangeMax;
 
-        const GradientSignal::GradientSampleParams sampleParams(instanceData.m_position);
-        const float factor = m_configuration.m_gradientSampler.GetValue(sampleParams) * (max - min) + min;
+        const float factor = gradientValue * (max - min) + min;
 
         AZ::Vector3 r = AZ::Vector3(-1.0f, 0.0f, 0.0f);
         AZ::Vector3 f = AZ::Vector3(0.0f, 1.0f, 0.0f);
@@ -67,6 +67,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationModifierRequestBus
         void Execute(InstanceData& instanceData) const override;
+        void ExecuteBatch(AZStd::span<InstanceData> instances, AZStd::span<const bool> active) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -80,6 +81,9 @@ namespace Vegetation
         GradientSignal::GradientSampler& GetGradientSampler() override;
 
     private:
+        //! Applies the alignment for a sampled gradient value, shared by Execute() and ExecuteBatch().
+        void ApplyAlignment(InstanceData& instanceData, float gradientValue) const;
+
         SlopeAlignmentModifierConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
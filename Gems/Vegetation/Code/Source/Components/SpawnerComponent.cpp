@@ -9,6 +9,7 @@
 #include <VegetationProfiler.h>
 #include "SpawnerComponent.h"
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -26,6 +27,9 @@
 
 namespace Vegetation
 {
+    AZ_CVAR(bool, veg_spawnerBatchedClaims, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Run the spawner filters and modifiers on all of the points in a sector at once instead of one point at a time.");
+
     namespace SpawnerUtil
     {
         static bool UpdateVersion([[maybe_unused]] AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
@@ -286,7 +290,7 @@ namespace Vegetation
         {
             FilterRequestBus::EnumerateHandlersId(id, [this, &instanceData, &accepted, intendedStage](FilterRequestBus::Events* handler) {
                 const FilterStage stage = handler->GetFilterStage();
-                if (stage == intendedStage || (stage == FilterStage::Default && m_configuration.m_filterStage == intendedStage))
+                if (IsFilterInStage(stage, intendedStage))
                 {
                     accepted = handler->Evaluate(instanceData);
                 }
@@ -300,10 +304,8 @@ namespace Vegetation
         return accepted;
     }
 
-    bool SpawnerComponent::ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr)
+    bool SpawnerComponent::InitializeInstance(const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr) const
     {
-        AZ_PROFILE_FUNCTION(Entity);
-
         if (!descriptorPtr)
         {
             AZ_Error("vegetation", descriptorPtr, "DescriptorPtr should always be valid when spawning!");
@@ -326,6 +328,17 @@ namespace Vegetation
         instanceData.m_rotation = identityQuat;
         instanceData.m_alignment = identityQuat;
         instanceData.m_scale = 1.0f;
+        return true;
+    }
+
+    bool SpawnerComponent::ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (!InitializeInstance(point, instanceData, descriptorPtr))
+        {
+            return false;
+        }
 
         // run pre-process filters on unmodified instance data
         if (!EvaluateFilters(processedIds, instanceData, FilterStage::PreProcess))
@@ -411,6 +424,203 @@ namespace Vegetation
         return false;
     }
 
+    bool SpawnerComponent::IsFilterInStage(FilterStage stage, FilterStage intendedStage) const
+    {
+        return stage == intendedStage || (stage == FilterStage::Default && m_configuration.m_filterStage == intendedStage);
+    }
+
+    void SpawnerComponent::EvaluateFiltersBatch(
+        EntityIdStack& processedIds, AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted, FilterStage intendedStage,
+        bool& hasOrderDependentFilters) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        for (const auto& id : processedIds)
+        {
+            FilterRequestBus::EnumerateHandlersId(id, [&](FilterRequestBus::Events* handler) {
+                if (IsFilterInStage(handler->GetFilterStage(), intendedStage))
+                {
+                    if (handler->IsOrderDependent())
+                    {
+                        hasOrderDependentFilters = true;
+                    }
+                    else
+                    {
+                        handler->EvaluateBatch(instances, accepted);
+                    }
+                }
+                return true;
+            });
+        }
+    }
+
+    bool SpawnerComponent::EvaluateOrderDependentFilters(EntityIdStack& processedIds, const InstanceData& instanceData) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // The instance passed every other filter, and the filter results don't depend on each other, so the stages only need
+        // to be visited in the same order as ProcessInstance().
+        bool accepted = true;
+        for (const FilterStage intendedStage : { FilterStage::PreProcess, FilterStage::PostProcess })
+        {
+            for (const auto& id : processedIds)
+            {
+                FilterRequestBus::EnumerateHandlersId(id, [this, &instanceData, &accepted, intendedStage](FilterRequestBus::Events* handler) {
+                    if (handler->IsOrderDependent() && IsFilterInStage(handler->GetFilterStage(), intendedStage))
+                    {
+                        accepted = handler->Evaluate(instanceData);
+                    }
+                    return accepted;
+                });
+                if (!accepted)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void SpawnerComponent::ProcessBatchedClaims(
+        EntityIdStack& processedIds, const ClaimContext& context, const InstanceData& instanceTemplate, BatchedClaims& claims,
+        bool& hasOrderDependentFilters)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const size_t numPoints = context.m_availablePoints.size();
+        claims.resize(numPoints);
+
+        // The shape tests and descriptor selection are per point, so run them up front and keep the selection for each point.
+        size_t maxDescriptorCount = 0;
+        {
+            AZStd::lock_guard<decltype(m_selectableDescriptorMutex)> selectableDescriptorLock(m_selectableDescriptorMutex);
+            for (size_t pointIndex = 0; pointIndex < numPoints; ++pointIndex)
+            {
+                const ClaimPoint& point = context.m_availablePoints[pointIndex];
+                BatchedClaim& claim = claims[pointIndex];
+
+                bool inside = true;
+                for (const auto& id : processedIds)
+                {
+                    LmbrCentral::ShapeComponentRequestsBus::EventResult(inside, id, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
+                    if (!inside)
+                    {
+                        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instanceTemplate.m_id, AZStd::string_view("ShapeFilter")));
+                        break;
+                    }
+                }
+                if (!inside)
+                {
+                    continue;
+                }
+
+                DescriptorSelectorParams selectorParams;
+                selectorParams.m_position = point.m_position;
+
+                claim.m_descriptors = m_selectableDescriptorCache;
+                for (const auto& id : processedIds)
+                {
+                    DescriptorSelectorRequestBus::Event(id, &DescriptorSelectorRequestBus::Events::SelectDescriptors, selectorParams, claim.m_descriptors);
+                }
+                maxDescriptorCount = AZ::GetMax(maxDescriptorCount, claim.m_descriptors.size());
+            }
+        }
+
+        // Each round tries the next selected descriptor for every point that doesn't have a candidate yet, which matches the
+        // order that ClaimPosition() tries them in.
+        AZStd::vector<InstanceData> instances;
+        AZStd::vector<size_t> claimIndices;
+        AZStd::vector<bool> accepted;
+        instances.reserve(numPoints);
+        claimIndices.reserve(numPoints);
+
+        for (size_t descriptorIndex = 0; descriptorIndex < maxDescriptorCount; ++descriptorIndex)
+        {
+            instances.clear();
+            claimIndices.clear();
+
+            for (size_t pointIndex = 0; pointIndex < numPoints; ++pointIndex)
+            {
+                BatchedClaim& claim = claims[pointIndex];
+                if (claim.m_hasCandidate || descriptorIndex >= claim.m_descriptors.size())
+                {
+                    continue;
+                }
+
+                InstanceData& instanceData = instances.emplace_back(instanceTemplate);
+                if (InitializeInstance(context.m_availablePoints[pointIndex], instanceData, claim.m_descriptors[descriptorIndex]))
+                {
+                    claimIndices.push_back(pointIndex);
+                }
+                else
+                {
+                    instances.pop_back();
+                }
+            }
+
+            if (instances.empty())
+            {
+                continue;
+            }
+
+            accepted.assign(instances.size(), true);
+
+            // run pre-process filters on unmodified instance data
+            EvaluateFiltersBatch(processedIds, instances, accepted, FilterStage::PreProcess, hasOrderDependentFilters);
+
+            // run the modifiers on the instances that passed, then the post-process filters on the modified instance data
+            for (const auto& id : processedIds)
+            {
+                ModifierRequestBus::EnumerateHandlersId(id, [&instances, &accepted](ModifierRequestBus::Events* handler) {
+                    handler->ExecuteBatch(instances, accepted);
+                    return true;
+                });
+            }
+
+            EvaluateFiltersBatch(processedIds, instances, accepted, FilterStage::PostProcess, hasOrderDependentFilters);
+
+            for (size_t instanceIndex = 0; instanceIndex < instances.size(); ++instanceIndex)
+            {
+                if (accepted[instanceIndex])
+                {
+                    BatchedClaim& claim = claims[claimIndices[instanceIndex]];
+                    claim.m_instanceData = AZStd::move(instances[instanceIndex]);
+                    claim.m_descriptorIndex = descriptorIndex;
+                    claim.m_hasCandidate = true;
+                }
+            }
+        }
+    }
+
+    bool SpawnerComponent::ClaimBatchedPosition(
+        EntityIdStack& processedIds, const ClaimPoint& point, const BatchedClaim& claim, bool hasOrderDependentFilters,
+        InstanceData& instanceData)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Without a candidate, every descriptor was rejected by a filter that doesn't depend on the claim order.
+        if (!claim.m_hasCandidate)
+        {
+            return false;
+        }
+
+        instanceData = claim.m_instanceData;
+        if (!hasOrderDependentFilters || EvaluateOrderDependentFilters(processedIds, instanceData))
+        {
+            return true;
+        }
+
+        // The candidate was rejected by the instances claimed so far, so fall back to trying the remaining descriptors one at a time.
+        for (size_t descriptorIndex = claim.m_descriptorIndex + 1; descriptorIndex < claim.m_descriptors.size(); ++descriptorIndex)
+        {
+            if (ProcessInstance(processedIds, point, instanceData, claim.m_descriptors[descriptorIndex]))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void SpawnerComponent::ClaimPositions(EntityIdStack& stackIds, ClaimContext& context)
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -433,13 +643,35 @@ namespace Vegetation
         instanceData.m_id = GetEntityId();
         instanceData.m_changeIndex = GetChangeIndex();
 
+        // The caching path short-circuits individual points, so it always claims one point at a time.
+        const bool useBatchedClaims = veg_spawnerBatchedClaims && !VEG_SPAWNER_ENABLE_CACHING;
+
+        BatchedClaims batchedClaims;
+        bool hasOrderDependentFilters = false;
+        // Maps each available point back to its batched claim, since accepted points get swapped to the end of the list.
+        AZStd::vector<size_t> batchedClaimIndices;
+        if (useBatchedClaims)
+        {
+            ProcessBatchedClaims(processedIds, context, instanceData, batchedClaims, hasOrderDependentFilters);
+
+            batchedClaimIndices.resize(context.m_availablePoints.size());
+            for (size_t claimIndex = 0; claimIndex < batchedClaimIndices.size(); ++claimIndex)
+            {
+                batchedClaimIndices[claimIndex] = claimIndex;
+            }
+        }
+
         size_t numAvailablePoints = context.m_availablePoints.size();
         for (size_t pointIndex = 0; pointIndex < numAvailablePoints; )
         {
             ClaimPoint& point = context.m_availablePoints[pointIndex];
 
+            const bool claimed = useBatchedClaims
+                ? ClaimBatchedPosition(processedIds, point, batchedClaims[batchedClaimIndices[pointIndex]], hasOrderDependentFilters, instanceData)
+                : ClaimPosition(processedIds, point, instanceData);
+
             bool accepted = false;
-            if (ClaimPosition(processedIds, point, instanceData))
+            if (claimed)
             {
                 // Check if an identical instance already exists for reuse
                 if (context.m_existedCallback(point, instanceData))
@@ -466,6 +698,10 @@ namespace Vegetation
             {
                 //Swap an available point from the end of the list
                 AZStd::swap(point, context.m_availablePoints.at(numAvailablePoints - 1));
+                if (useBatchedClaims)
+                {
+                    AZStd::swap(batchedClaimIndices[pointIndex], batchedClaimIndices[numAvailablePoints - 1]);
+                }
                 --numAvailablePoints;
 
 #if VEG_SPAWNER_ENABLE_CACHING
@@ -119,8 +119,38 @@ namespace Vegetation
         void ClearSelectableDescriptors();
         bool CreateInstance(const ClaimPoint &point, InstanceData& instanceData);
         bool EvaluateFilters(EntityIdStack& processedIds, InstanceData& instanceData, const FilterStage intendedStage) const;
+        bool InitializeInstance(const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr) const;
         bool ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr);
         bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData);
+
+        //! The results of running the filters and modifiers for one claim point in a batch.
+        struct BatchedClaim
+        {
+            //! The selected descriptors, in the order they're tried.
+            DescriptorPtrVec m_descriptors;
+            //! The instance generated by the first descriptor that passed every batched filter.
+            InstanceData m_instanceData;
+            size_t m_descriptorIndex = 0;
+            bool m_hasCandidate = false;
+        };
+        using BatchedClaims = AZStd::vector<BatchedClaim>;
+
+        bool IsFilterInStage(FilterStage stage, FilterStage intendedStage) const;
+        //! Runs the filters for a batch of instances, clearing the accepted flag for every rejected instance.
+        //! Order dependent filters are skipped, and reported through hasOrderDependentFilters so that they can be run at claim time.
+        void EvaluateFiltersBatch(
+            EntityIdStack& processedIds, AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted, FilterStage intendedStage,
+            bool& hasOrderDependentFilters) const;
+        bool EvaluateOrderDependentFilters(EntityIdStack& processedIds, const InstanceData& instanceData) const;
+        //! Runs the shape tests, descriptor selection, filters and modifiers for every point in the context as a batch,
+        //! one descriptor rank at a time, so that each filter and modifier handles a whole sector per call.
+        void ProcessBatchedClaims(
+            EntityIdStack& processedIds, const ClaimContext& context, const InstanceData& instanceTemplate, BatchedClaims& claims,
+            bool& hasOrderDependentFilters);
+        //! Finishes a claim from ProcessBatchedClaims() in claim order, running any order dependent filters.
+        bool ClaimBatchedPosition(
+            EntityIdStack& processedIds, const ClaimPoint& point, const BatchedClaim& claim, bool hasOrderDependentFilters,
+            InstanceData& instanceData);
         void DestroyAllInstances();
         void CalcInstanceDebugColor(const EntityIdStack& processedIds);
 
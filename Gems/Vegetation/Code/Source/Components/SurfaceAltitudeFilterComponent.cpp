@@ -15,6 +15,7 @@
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <Vegetation/Descriptor.h>
 #include <Vegetation/InstanceData.h>
+#include "InstanceBatchUtil.h"
 #include <AzCore/Debug/Profiler.h>
 
 #include <Vegetation/Ebuses/DebugNotificationBus.h>
@@ -195,6 +196,74 @@ namespace Vegetation
         return result;
     }
 
+    void SurfaceAltitudeFilterComponent::EvaluateBatch(AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // The shape bounds override the altitude range for every instance, so query them once per batch instead of once per instance.
+        bool hasShapeBounds = false;
+        AZ::Aabb shapeBounds = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(
+            m_configuration.m_shapeEntityId,
+            [&hasShapeBounds, &shapeBounds](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                shapeBounds = shape->GetEncompassingAabb();
+                hasShapeBounds = true;
+                return true;
+            });
+
+        AZStd::vector<float> altitudes;
+        AZStd::vector<float> minAltitudes;
+        AZStd::vector<float> maxAltitudes;
+        AZStd::vector<size_t> indices;
+        altitudes.reserve(instances.size());
+        minAltitudes.reserve(instances.size());
+        maxAltitudes.reserve(instances.size());
+        indices.reserve(instances.size());
+
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            if (!accepted[index])
+            {
+                continue;
+            }
+
+            const InstanceData& instanceData = instances[index];
+            float min = 0.0f;
+            float max = 0.0f;
+            if (hasShapeBounds)
+            {
+                if (!shapeBounds.IsValid())
+                {
+                    // An invalid shape rejects everything; an empty range gives the same result without a separate code path.
+                    min = AZ::Constants::FloatMax;
+                    max = -AZ::Constants::FloatMax;
+                }
+                else
+                {
+                    min = shapeBounds.GetMin().GetZ();
+                    max = shapeBounds.GetMax().GetZ();
+                }
+            }
+            else
+            {
+                const bool useOverrides = m_configuration.m_allowOverrides && instanceData.m_descriptorPtr && instanceData.m_descriptorPtr->m_altitudeFilterOverrideEnabled;
+                const float altitudeMin = useOverrides ? instanceData.m_descriptorPtr->m_altitudeFilterMin : m_configuration.m_altitudeMin;
+                const float altitudeMax = useOverrides ? instanceData.m_descriptorPtr->m_altitudeFilterMax : m_configuration.m_altitudeMax;
+                min = AZ::GetMin(altitudeMin, altitudeMax);
+                max = AZ::GetMax(altitudeMin, altitudeMax);
+            }
+
+            altitudes.push_back(instanceData.m_position.GetZ());
+            minAltitudes.push_back(min);
+            maxAltitudes.push_back(max);
+            indices.push_back(index);
+        }
+
+        InstanceBatchUtil::FilterRange(
+            instances, altitudes, minAltitudes, maxAltitudes, indices, accepted, AZStd::string_view("SurfaceAltitudeFilter"));
+    }
+
     FilterStage SurfaceAltitudeFilterComponent::GetFilterStage() const
     {
         return m_configuration.m_filterStage;
@@ -15,6 +15,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Vegetation/Descriptor.h>
 #include <Vegetation/InstanceData.h>
+#include "InstanceBatchUtil.h"
 #include <AzCore/Debug/Profiler.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 
@@ -181,6 +182,56 @@ namespace Vegetation
         return result;
     }
 
+    void SurfaceSlopeFilterComponent::EvaluateBatch(AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::vector<float> slopes;
+        AZStd::vector<float> cosMax;
+        AZStd::vector<float> cosMin;
+        AZStd::vector<size_t> indices;
+        slopes.reserve(instances.size());
+        cosMax.reserve(instances.size());
+        cosMin.reserve(instances.size());
+        indices.reserve(instances.size());
+
+        // Instances in a batch mostly share a handful of descriptors, so only recompute the cosines when the descriptor changes.
+        const Descriptor* lastDescriptor = nullptr;
+        bool hasLastDescriptor = false;
+        float c1 = 0.0f;
+        float c2 = 0.0f;
+
+        const AZ::Vector3 up = AZ::Vector3(0.0f, 0.0f, 1.0f);
+        for (size_t index = 0; index < instances.size(); ++index)
+        {
+            if (!accepted[index])
+            {
+                continue;
+            }
+
+            const InstanceData& instanceData = instances[index];
+            if (!hasLastDescriptor || instanceData.m_descriptorPtr.get() != lastDescriptor)
+            {
+                lastDescriptor = instanceData.m_descriptorPtr.get();
+                hasLastDescriptor = true;
+
+                const bool useOverrides = m_configuration.m_allowOverrides && lastDescriptor && lastDescriptor->m_slopeFilterOverrideEnabled;
+                const float min = useOverrides ? lastDescriptor->m_slopeFilterMin : m_configuration.m_slopeMin;
+                const float max = useOverrides ? lastDescriptor->m_slopeFilterMax : m_configuration.m_slopeMax;
+                c1 = cosf(AZ::DegToRad(AZ::GetMin(min, max)));
+                c2 = cosf(AZ::DegToRad(AZ::GetMax(min, max)));
+            }
+
+            // The cosine of the slope has to be between the cosines of the max and min angles.
+            slopes.push_back(instanceData.m_normal.Dot(up));
+            cosMax.push_back(c2);
+            cosMin.push_back(c1);
+            indices.push_back(index);
+        }
+
+        InstanceBatchUtil::FilterRange(instances, slopes, cosMax, cosMin, indices, accepted, AZStd::string_view("SurfaceSlopeFilter"));
+    }
+
     FilterStage SurfaceSlopeFilterComponent::GetFilterStage() const
     {
         return m_configuration.m_filterStage;
@@ -65,6 +65,7 @@ namespace Vegetation
         //////////////////////////////////////////////////////////////////////////
         // VegetationFilterRequestBus
         bool Evaluate(const InstanceData& instanceData) const override;
+        void EvaluateBatch(AZStd::span<const InstanceData> instances, AZStd::span<bool> accepted) const override;
         FilterStage GetFilterStage() const override;
         void SetFilterStage(FilterStage filterStage) override;
 
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include "VegetationMocks.h"
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Source/Components/DistributionFilterComponent.h>
+#include <Source/Components/RotationModifierComponent.h>
+#include <Source/Components/ScaleModifierComponent.h>
+#include <Source/Components/SlopeAlignmentModifierComponent.h>
+#include <Source/Components/SurfaceAltitudeFilterComponent.h>
+#include <Source/Components/SurfaceSlopeFilterComponent.h>
+#include <Vegetation/Ebuses/FilterRequestBus.h>
+#include <Vegetation/Ebuses/ModifierRequestBus.h>
+
+namespace UnitTest
+{
+    // Benchmarks the filters and modifiers that a spawner runs on the claim points of a sector, either one point at a time
+    // (the way the spawner used to process them) or as a single batch per filter and modifier.
+    class VegetationPipelineBenchmark : public ::benchmark::Fixture
+    {
+    public:
+        void internalSetUp()
+        {
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            m_app->Create({});
+
+            m_app->RegisterComponentDescriptor(MockVegetationAreaServiceComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(Vegetation::DistributionFilterComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(Vegetation::SurfaceAltitudeFilterComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(Vegetation::SurfaceSlopeFilterComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(Vegetation::RotationModifierComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(Vegetation::ScaleModifierComponent::CreateDescriptor());
+            m_app->RegisterComponentDescriptor(Vegetation::SlopeAlignmentModifierComponent::CreateDescriptor());
+
+            m_gradient = AZStd::make_unique<MockGradientRequestHandler>();
+            m_gradient->m_positionValueGetter = [](const AZ::Vector3& position)
+            {
+                return AZ::GetMod(position.GetX() * 0.37f + position.GetY() * 0.11f, 1.0f);
+            };
+            const AZ::EntityId gradientId = m_gradient->m_entity.GetId();
+
+            // Put a typical stack of filters and modifiers on a single entity, the same way they'd be placed on a spawner.
+            m_entity = AZStd::make_unique<AZ::Entity>();
+            m_entity->CreateComponent<MockVegetationAreaServiceComponent>();
+
+            Vegetation::DistributionFilterConfig distributionConfig;
+            distributionConfig.m_gradientSampler.m_gradientId = gradientId;
+            distributionConfig.m_thresholdMin = 0.1f;
+            distributionConfig.m_thresholdMax = 0.9f;
+            m_entity->CreateComponent<Vegetation::DistributionFilterComponent>(distributionConfig);
+
+            Vegetation::SurfaceAltitudeFilterConfig altitudeConfig;
+            altitudeConfig.m_altitudeMin = 0.0f;
+            altitudeConfig.m_altitudeMax = 100.0f;
+            m_entity->CreateComponent<Vegetation::SurfaceAltitudeFilterComponent>(altitudeConfig);
+
+            Vegetation::SurfaceSlopeFilterConfig slopeConfig;
+            slopeConfig.m_slopeMin = 0.0f;
+            slopeConfig.m_slopeMax = 40.0f;
+            m_entity->CreateComponent<Vegetation::SurfaceSlopeFilterComponent>(slopeConfig);
+
+            Vegetation::RotationModifierConfig rotationConfig;
+            rotationConfig.m_gradientSamplerX.m_gradientId = gradientId;
+            rotationConfig.m_gradientSamplerY.m_gradientId = gradientId;
+            rotationConfig.m_gradientSamplerZ.m_gradientId = gradientId;
+            m_entity->CreateComponent<Vegetation::RotationModifierComponent>(rotationConfig);
+
+            Vegetation::ScaleModifierConfig scaleConfig;
+            scaleConfig.m_gradientSampler.m_gradientId = gradientId;
+            m_entity->CreateComponent<Vegetation::ScaleModifierComponent>(scaleConfig);
+
+            Vegetation::SlopeAlignmentModifierConfig alignmentConfig;
+            alignmentConfig.m_gradientSampler.m_gradientId = gradientId;
+            m_entity->CreateComponent<Vegetation::SlopeAlignmentModifierComponent>(alignmentConfig);
+
+            m_entity->Init();
+            m_entity->Activate();
+        }
+
+        void internalTearDown()
+        {
+            m_entity.reset();
+            m_gradient.reset();
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        // Creates the claim points for a square sector with the given number of points per side.
+        static void CreateSectorInstances(int64_t sectorDensity, AZStd::vector<Vegetation::InstanceData>& instances)
+        {
+            instances.resize(aznumeric_cast<size_t>(sectorDensity * sectorDensity));
+            for (int64_t y = 0; y < sectorDensity; ++y)
+            {
+                for (int64_t x = 0; x < sectorDensity; ++x)
+                {
+                    Vegetation::InstanceData& instanceData = instances[aznumeric_cast<size_t>(y * sectorDensity + x)];
+                    instanceData.m_position = AZ::Vector3(aznumeric_cast<float>(x), aznumeric_cast<float>(y), aznumeric_cast<float>(x % 7));
+                    instanceData.m_normal = AZ::Vector3(0.05f * aznumeric_cast<float>(y % 9), 0.0f, 1.0f).GetNormalized();
+                }
+            }
+        }
+
+    protected:
+        void SetUp([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+        void SetUp([[maybe_unused]] benchmark::State& state) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown([[maybe_unused]] const benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+        void TearDown([[maybe_unused]] benchmark::State& state) override
+        {
+            internalTearDown();
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZStd::unique_ptr<MockGradientRequestHandler> m_gradient;
+        AZStd::unique_ptr<AZ::Entity> m_entity;
+    };
+
+    BENCHMARK_DEFINE_F(VegetationPipelineBenchmark, BM_PerPointFiltersAndModifiers)(benchmark::State& state)
+    {
+        AZStd::vector<Vegetation::InstanceData> sourceInstances;
+        CreateSectorInstances(state.range(0), sourceInstances);
+        const AZ::EntityId entityId = m_entity->GetId();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<Vegetation::InstanceData> instances(sourceInstances);
+            size_t acceptedCount = 0;
+            for (Vegetation::InstanceData& instanceData : instances)
+            {
+                bool accepted = true;
+                Vegetation::FilterRequestBus::EnumerateHandlersId(entityId, [&instanceData, &accepted](Vegetation::FilterRequestBus::Events* handler)
+                {
+                    accepted = handler->Evaluate(instanceData);
+                    return accepted;
+                });
+
+                if (accepted)
+                {
+                    Vegetation::ModifierRequestBus::Event(entityId, &Vegetation::ModifierRequestBus::Events::Execute, instanceData);
+                    ++acceptedCount;
+                }
+            }
+            benchmark::DoNotOptimize(acceptedCount);
+        }
+
+        state.SetItemsProcessed(state.iterations() * sourceInstances.size());
+    }
+
+    BENCHMARK_DEFINE_F(VegetationPipelineBenchmark, BM_BatchedFiltersAndModifiers)(benchmark::State& state)
+    {
+        AZStd::vector<Vegetation::InstanceData> sourceInstances;
+        CreateSectorInstances(state.range(0), sourceInstances);
+        const AZ::EntityId entityId = m_entity->GetId();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<Vegetation::InstanceData> instances(sourceInstances);
+            AZStd::vector<bool> accepted(instances.size(), true);
+
+            Vegetation::FilterRequestBus::EnumerateHandlersId(entityId, [&instances, &accepted](Vegetation::FilterRequestBus::Events* handler)
+            {
+                handler->EvaluateBatch(instances, accepted);
+                return true;
+            });
+            Vegetation::ModifierRequestBus::EnumerateHandlersId(entityId, [&instances, &accepted](Vegetation::ModifierRequestBus::Events* handler)
+            {
+                handler->ExecuteBatch(instances, accepted);
+                return true;
+            });
+            benchmark::DoNotOptimize(accepted.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * sourceInstances.size());
+    }
+
+    // The sector densities to benchmark, in points per sector side.
+    BENCHMARK_REGISTER_F(VegetationPipelineBenchmark, BM_PerPointFiltersAndModifiers)
+        ->Arg(20)
+        ->Arg(64)
+        ->Unit(::benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(VegetationPipelineBenchmark, BM_BatchedFiltersAndModifiers)
+        ->Arg(20)
+        ->Arg(64)
+        ->Unit(::benchmark::kMillisecond);
+}
+
+#endif
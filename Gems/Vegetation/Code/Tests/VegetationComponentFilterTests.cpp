@@ -21,6 +21,7 @@
 #include <Source/Components/SurfaceMaskDepthFilterComponent.h>
 #include <Source/Components/SurfaceMaskFilterComponent.h>
 #include <Source/Components/SurfaceSlopeFilterComponent.h>
+#include <Vegetation/Descriptor.h>
 
 namespace UnitTest
 {
@@ -33,6 +34,52 @@ namespace UnitTest
             m_app.RegisterComponentDescriptor(MockVegetationAreaServiceComponent::CreateDescriptor());
             m_app.RegisterComponentDescriptor(MockMeshServiceComponent::CreateDescriptor());
         }
+
+        // Builds a batch that isn't a multiple of the SIMD width, with a few instances that were already rejected.
+        static void BuildBatch(
+            AZStd::vector<Vegetation::InstanceData>& instances, AZStd::vector<bool>& accepted,
+            const AZStd::function<void(size_t, Vegetation::InstanceData&)>& initInstance)
+        {
+            const size_t count = 37;
+            instances.resize(count);
+            accepted.resize(count);
+            for (size_t index = 0; index < count; ++index)
+            {
+                initInstance(index, instances[index]);
+                accepted[index] = (index % 7) != 3;
+            }
+        }
+
+        static void VerifyEvaluateBatchMatchesEvaluate(
+            const AZ::EntityId& filterId, const AZStd::vector<Vegetation::InstanceData>& instances, const AZStd::vector<bool>& accepted)
+        {
+            AZStd::vector<bool> expected(accepted);
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                if (expected[index])
+                {
+                    bool result = true;
+                    Vegetation::FilterRequestBus::EventResult(result, filterId, &Vegetation::FilterRequestBus::Events::Evaluate, instances[index]);
+                    expected[index] = result;
+                }
+            }
+
+            AZStd::vector<bool> batchAccepted(accepted);
+            Vegetation::FilterRequestBus::Event(
+                filterId, &Vegetation::FilterRequestBus::Events::EvaluateBatch, AZStd::span<const Vegetation::InstanceData>(instances),
+                AZStd::span<bool>(batchAccepted));
+
+            size_t acceptedCount = 0;
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                EXPECT_EQ(batchAccepted[index], expected[index]);
+                acceptedCount += expected[index] ? 1 : 0;
+            }
+
+            // Make sure the test data exercises both results.
+            EXPECT_GT(acceptedCount, 0);
+            EXPECT_LT(acceptedCount, instances.size());
+        }
     };
 
     TEST_F(VegetationComponentFilterTests, SurfaceSlopeFilterComponent)
@@ -295,4 +342,104 @@ namespace UnitTest
         }
     }
 
+    TEST_F(VegetationComponentFilterTests, SurfaceSlopeFilterComponent_EvaluateBatchMatchesEvaluate)
+    {
+        Vegetation::SurfaceSlopeFilterConfig config;
+        config.m_slopeMin = 5.0f;
+        config.m_slopeMax = 45.0f;
+        config.m_allowOverrides = true;
+
+        Vegetation::SurfaceSlopeFilterComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockVegetationAreaServiceComponent>();
+        });
+
+        // Alternate between descriptors with and without overrides to make sure the per-descriptor ranges are used.
+        auto overrideDescriptor = AZStd::make_shared<Vegetation::Descriptor>();
+        overrideDescriptor->m_slopeFilterOverrideEnabled = true;
+        overrideDescriptor->m_slopeFilterMin = 30.0f;
+        overrideDescriptor->m_slopeFilterMax = 60.0f;
+        auto defaultDescriptor = AZStd::make_shared<Vegetation::Descriptor>();
+
+        AZStd::vector<Vegetation::InstanceData> instances;
+        AZStd::vector<bool> accepted;
+        BuildBatch(instances, accepted, [&](size_t index, Vegetation::InstanceData& instanceData)
+        {
+            const float slope = AZ::DegToRad(aznumeric_cast<float>(index) * 2.5f);
+            instanceData.m_normal = AZ::Vector3(sinf(slope), 0.0f, cosf(slope));
+            instanceData.m_descriptorPtr = ((index / 3) % 2) ? overrideDescriptor : defaultDescriptor;
+        });
+
+        VerifyEvaluateBatchMatchesEvaluate(entity->GetId(), instances, accepted);
+    }
+
+    TEST_F(VegetationComponentFilterTests, SurfaceAltitudeFilterComponent_EvaluateBatchMatchesEvaluate)
+    {
+        Vegetation::SurfaceAltitudeFilterConfig config;
+        config.m_altitudeMin = 4.0f;
+        config.m_altitudeMax = 20.0f;
+        config.m_allowOverrides = true;
+
+        Vegetation::SurfaceAltitudeFilterComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockVegetationAreaServiceComponent>();
+        });
+
+        auto overrideDescriptor = AZStd::make_shared<Vegetation::Descriptor>();
+        overrideDescriptor->m_altitudeFilterOverrideEnabled = true;
+        overrideDescriptor->m_altitudeFilterMin = 10.0f;
+        overrideDescriptor->m_altitudeFilterMax = 30.0f;
+
+        AZStd::vector<Vegetation::InstanceData> instances;
+        AZStd::vector<bool> accepted;
+        BuildBatch(instances, accepted, [&](size_t index, Vegetation::InstanceData& instanceData)
+        {
+            instanceData.m_position = AZ::Vector3(0.0f, 0.0f, aznumeric_cast<float>(index));
+            instanceData.m_descriptorPtr = (index % 2) ? overrideDescriptor : nullptr;
+        });
+
+        // Without a shape, the altitude range comes from the configuration or the descriptor.
+        VerifyEvaluateBatchMatchesEvaluate(entity->GetId(), instances, accepted);
+
+        // With a shape, the shape bounds are used for every instance.
+        MockShape mockShape;
+        mockShape.m_aabb = AZ::Aabb::CreateCenterRadius(AZ::Vector3(0.0f, 0.0f, 0.0f), 15.0f);
+        entity->Deactivate();
+        config.m_shapeEntityId = mockShape.m_entity.GetId();
+        component->ReadInConfig(&config);
+        entity->Activate();
+
+        VerifyEvaluateBatchMatchesEvaluate(entity->GetId(), instances, accepted);
+    }
+
+    TEST_F(VegetationComponentFilterTests, DistributionFilterComponent_EvaluateBatchMatchesEvaluate)
+    {
+        MockGradientRequestHandler mockGradient;
+        mockGradient.m_positionValueGetter = [](const AZ::Vector3& position)
+        {
+            return AZ::GetMod(position.GetX() * 0.37f, 1.0f);
+        };
+
+        Vegetation::DistributionFilterConfig config;
+        config.m_gradientSampler.m_gradientId = mockGradient.m_entity.GetId();
+        config.m_thresholdMin = 0.25f;
+        config.m_thresholdMax = 0.75f;
+
+        Vegetation::DistributionFilterComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockVegetationAreaServiceComponent>();
+        });
+
+        AZStd::vector<Vegetation::InstanceData> instances;
+        AZStd::vector<bool> accepted;
+        BuildBatch(instances, accepted, [](size_t index, Vegetation::InstanceData& instanceData)
+        {
+            instanceData.m_position = AZ::Vector3(aznumeric_cast<float>(index), 0.0f, 0.0f);
+        });
+
+        VerifyEvaluateBatchMatchesEvaluate(entity->GetId(), instances, accepted);
+    }
 }
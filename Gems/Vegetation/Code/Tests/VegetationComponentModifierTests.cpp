@@ -29,6 +29,55 @@ namespace UnitTest
             m_app.RegisterComponentDescriptor(MockVegetationAreaServiceComponent::CreateDescriptor());
             m_app.RegisterComponentDescriptor(MockMeshServiceComponent::CreateDescriptor());
         }
+
+        // Builds a batch that isn't a multiple of the SIMD width, with a few inactive instances that shouldn't be modified.
+        static void BuildBatch(AZStd::vector<Vegetation::InstanceData>& instances, AZStd::vector<bool>& active)
+        {
+            const size_t count = 37;
+            instances.resize(count);
+            active.resize(count);
+            for (size_t index = 0; index < count; ++index)
+            {
+                const float value = aznumeric_cast<float>(index);
+                instances[index].m_position = AZ::Vector3(value, value * 0.5f, 1.0f);
+                instances[index].m_normal = AZ::Vector3(0.1f * AZ::GetMod(value, 5.0f), 0.2f, 1.0f).GetNormalized();
+                instances[index].m_scale = 1.0f + value * 0.01f;
+                active[index] = (index % 5) != 2;
+            }
+        }
+
+        static void VerifyExecuteBatchMatchesExecute(const AZ::EntityId& modifierId)
+        {
+            AZStd::vector<Vegetation::InstanceData> instances;
+            AZStd::vector<bool> active;
+            BuildBatch(instances, active);
+
+            AZStd::vector<Vegetation::InstanceData> expected(instances);
+            for (size_t index = 0; index < expected.size(); ++index)
+            {
+                if (active[index])
+                {
+                    Vegetation::ModifierRequestBus::Event(modifierId, &Vegetation::ModifierRequestBus::Events::Execute, expected[index]);
+                }
+            }
+
+            Vegetation::ModifierRequestBus::Event(
+                modifierId, &Vegetation::ModifierRequestBus::Events::ExecuteBatch, AZStd::span<Vegetation::InstanceData>(instances),
+                AZStd::span<const bool>(active));
+
+            for (size_t index = 0; index < instances.size(); ++index)
+            {
+                EXPECT_TRUE(instances[index].m_position.IsClose(expected[index].m_position));
+                EXPECT_TRUE(instances[index].m_rotation.IsClose(expected[index].m_rotation));
+                EXPECT_TRUE(instances[index].m_alignment.IsClose(expected[index].m_alignment));
+                EXPECT_NEAR(instances[index].m_scale, expected[index].m_scale, AZ::Constants::Tolerance);
+            }
+        }
+
+        static float GetTestGradientValue(const AZ::Vector3& position)
+        {
+            return AZ::GetMod(position.GetX() * 0.37f + position.GetY() * 0.11f, 1.0f);
+        }
     };
 
     TEST_F(VegetationComponentModifierTests, PositionModifierComponent)
@@ -176,5 +225,94 @@ namespace UnitTest
         EXPECT_NEAR(m_instanceData.m_alignment.GetZ(), -0.0134f, AZ::Constants::Tolerance);
         EXPECT_NEAR(m_instanceData.m_alignment.GetW(),  0.9779f, AZ::Constants::Tolerance);
     }
+
+    TEST_F(VegetationComponentModifierTests, PositionModifierComponent_ExecuteBatchMatchesExecute)
+    {
+        MockGradientRequestHandler gradient;
+        gradient.m_positionValueGetter = &GetTestGradientValue;
+
+        Vegetation::PositionModifierConfig config;
+        config.m_autoSnapToSurface = false;
+        config.m_rangeMinX = -0.3f;
+        config.m_rangeMaxX = 0.3f;
+        config.m_gradientSamplerX.m_gradientId = gradient.m_entity.GetId();
+        config.m_rangeMinY = -0.5f;
+        config.m_rangeMaxY = 0.2f;
+        config.m_gradientSamplerY.m_gradientId = gradient.m_entity.GetId();
+        config.m_rangeMinZ = -1.0f;
+        config.m_rangeMaxZ = 1.0f;
+        config.m_gradientSamplerZ.m_gradientId = gradient.m_entity.GetId();
+
+        Vegetation::PositionModifierComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockVegetationAreaServiceComponent>();
+        });
+
+        VerifyExecuteBatchMatchesExecute(entity->GetId());
+    }
+
+    TEST_F(VegetationComponentModifierTests, RotationModifierComponent_ExecuteBatchMatchesExecute)
+    {
+        MockGradientRequestHandler gradient;
+        gradient.m_positionValueGetter = &GetTestGradientValue;
+
+        Vegetation::RotationModifierConfig config;
+        config.m_rangeMinX = -100.0f;
+        config.m_rangeMaxX = 100.0f;
+        config.m_gradientSamplerX.m_gradientId = gradient.m_entity.GetId();
+        config.m_rangeMinY = -80.0f;
+        config.m_rangeMaxY = 80.0f;
+        config.m_gradientSamplerY.m_gradientId = gradient.m_entity.GetId();
+        config.m_rangeMinZ = -180.0f;
+        config.m_rangeMaxZ = 180.0f;
+        config.m_gradientSamplerZ.m_gradientId = gradient.m_entity.GetId();
+
+        Vegetation::RotationModifierComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockVegetationAreaServiceComponent>();
+        });
+
+        VerifyExecuteBatchMatchesExecute(entity->GetId());
+    }
+
+    TEST_F(VegetationComponentModifierTests, ScaleModifierComponent_ExecuteBatchMatchesExecute)
+    {
+        MockGradientRequestHandler gradient;
+        gradient.m_positionValueGetter = &GetTestGradientValue;
+
+        Vegetation::ScaleModifierConfig config;
+        config.m_gradientSampler.m_gradientId = gradient.m_entity.GetId();
+        config.m_rangeMin = 0.1f;
+        config.m_rangeMax = 2.0f;
+
+        Vegetation::ScaleModifierComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockVegetationAreaServiceComponent>();
+        });
+
+        VerifyExecuteBatchMatchesExecute(entity->GetId());
+    }
+
+    TEST_F(VegetationComponentModifierTests, SlopeAlignmentModifierComponent_ExecuteBatchMatchesExecute)
+    {
+        MockGradientRequestHandler gradient;
+        gradient.m_positionValueGetter = &GetTestGradientValue;
+
+        Vegetation::SlopeAlignmentModifierConfig config;
+        config.m_gradientSampler.m_gradientId = gradient.m_entity.GetId();
+        config.m_rangeMin = 0.1f;
+        config.m_rangeMax = 0.9f;
+
+        Vegetation::SlopeAlignmentModifierComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockVegetationAreaServiceComponent>();
+        });
+
+        VerifyExecuteBatchMatchesExecute(entity->GetId());
+    }
 }
 
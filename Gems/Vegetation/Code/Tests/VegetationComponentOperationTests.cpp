@@ -21,6 +21,7 @@
 #include <Vegetation/EmptyInstanceSpawner.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace UnitTest
 {
@@ -65,6 +66,34 @@ namespace UnitTest
         }
     };
 
+    struct MockFilterRequestHandler
+        : public Vegetation::FilterRequestBus::Handler
+    {
+        AZStd::function<bool(const Vegetation::InstanceData&)> m_evaluate;
+        Vegetation::FilterStage m_filterStage = Vegetation::FilterStage::PreProcess;
+        bool m_isOrderDependent = false;
+
+        bool Evaluate(const Vegetation::InstanceData& instanceData) const override
+        {
+            return m_evaluate(instanceData);
+        }
+
+        bool IsOrderDependent() const override
+        {
+            return m_isOrderDependent;
+        }
+
+        void SetFilterStage(Vegetation::FilterStage filterStage) override
+        {
+            m_filterStage = filterStage;
+        }
+
+        Vegetation::FilterStage GetFilterStage() const override
+        {
+            return m_filterStage;
+        }
+    };
+
     struct VegetationComponentOperationTests
         : public VegetationComponentTests
     {
@@ -395,6 +424,116 @@ namespace UnitTest
         mockDescriptorProviderBus.BusDisconnect();
     }
 
+    TEST_F(VegetationComponentOperationTests, SpawnerComponent_BatchedClaimsMatchPerPointClaims)
+    {
+        m_mockShapeBus.m_aabb = AZ::Aabb::CreateCenterRadius(AZ::Vector3::CreateZero(), AZ::Constants::FloatMax);
+
+        Vegetation::InstanceSystemConfig instanceSystemConfig;
+        Vegetation::InstanceSystemComponent* instanceSystemComponent = nullptr;
+        auto instanceSystemEntity = CreateEntity(instanceSystemConfig, &instanceSystemComponent, [](AZ::Entity* e)
+        {
+            e->CreateComponent<Vegetation::DebugSystemComponent>();
+        });
+
+        Vegetation::SpawnerConfig config;
+        Vegetation::SpawnerComponent* component = nullptr;
+        auto entity = CreateEntity(config, &component, [](AZ::Entity* e)
+        {
+            e->CreateComponent<MockShapeServiceComponent>();
+        });
+
+        AreaBusScope scope(*this, *entity.get());
+
+        MockDescriptorProvider mockDescriptorProviderBus(2);
+        mockDescriptorProviderBus.BusConnect(entity->GetId());
+        const Vegetation::DescriptorPtrVec& descriptors = mockDescriptorProviderBus.m_descriptors;
+
+        // Reject the first descriptor on a pattern of points, so that some points need the second round of the batch.
+        MockFilterRequestHandler preProcessFilter;
+        preProcessFilter.m_evaluate = [&descriptors](const Vegetation::InstanceData& instanceData)
+        {
+            const int x = aznumeric_cast<int>(instanceData.m_position.GetX());
+            const int y = aznumeric_cast<int>(instanceData.m_position.GetY());
+            return (instanceData.m_descriptorPtr != descriptors[0]) || ((x + y) % 3 != 0);
+        };
+        preProcessFilter.BusConnect(entity->GetId());
+
+        // Reject any point next to (or diagonal from) a point that was already claimed with the same descriptor, similar to the
+        // distance between filter. Two descriptors can't cover the whole grid this way, so some points fall through both descriptors.
+        using ClaimedInstance = AZStd::pair<AZ::Vector3, Vegetation::DescriptorPtr>;
+        AZStd::vector<ClaimedInstance> claimedInstances;
+        MockFilterRequestHandler orderDependentFilter;
+        orderDependentFilter.m_filterStage = Vegetation::FilterStage::PostProcess;
+        orderDependentFilter.m_isOrderDependent = true;
+        orderDependentFilter.m_evaluate = [&claimedInstances](const Vegetation::InstanceData& instanceData)
+        {
+            for (const auto& claimedInstance : claimedInstances)
+            {
+                if (claimedInstance.second == instanceData.m_descriptorPtr &&
+                    claimedInstance.first.GetDistanceSq(instanceData.m_position) < 2.5f)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+        orderDependentFilter.BusConnect(entity->GetId());
+
+        Vegetation::AreaNotificationBus::Event(entity->GetId(), &Vegetation::AreaNotificationBus::Events::OnAreaConnect);
+
+        auto claimPositions = [&]()
+        {
+            claimedInstances.clear();
+
+            bool prepared = false;
+            Vegetation::EntityIdStack idStack;
+            Vegetation::AreaRequestBus::EventResult(prepared, entity->GetId(), &Vegetation::AreaRequestBus::Events::PrepareToClaim, idStack);
+            EXPECT_TRUE(prepared);
+
+            Vegetation::ClaimContext context = CreateContext<8, 8>({ AZ::Vector3(0, 0, 0) });
+            context.m_existedCallback = [](const Vegetation::ClaimPoint&, const Vegetation::InstanceData&)
+            {
+                return false;
+            };
+            context.m_createdCallback = [&claimedInstances](const Vegetation::ClaimPoint&, const Vegetation::InstanceData& instanceData)
+            {
+                claimedInstances.emplace_back(instanceData.m_position, instanceData.m_descriptorPtr);
+            };
+            Vegetation::AreaRequestBus::Event(entity->GetId(), &Vegetation::AreaRequestBus::Events::ClaimPositions, idStack, context);
+
+            EXPECT_EQ(context.m_availablePoints.size() + claimedInstances.size(), 64);
+            return claimedInstances;
+        };
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(console, nullptr);
+
+        console->PerformCommand("veg_spawnerBatchedClaims false");
+        const AZStd::vector<ClaimedInstance> perPointClaims = claimPositions();
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyAllInstances);
+
+        console->PerformCommand("veg_spawnerBatchedClaims true");
+        const AZStd::vector<ClaimedInstance> batchedClaims = claimPositions();
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyAllInstances);
+
+        // The claims need to match in both content and order, since later claims depend on the earlier ones.
+        ASSERT_EQ(batchedClaims.size(), perPointClaims.size());
+        EXPECT_GT(batchedClaims.size(), 0);
+        EXPECT_LT(batchedClaims.size(), 64);
+        for (size_t index = 0; index < batchedClaims.size(); ++index)
+        {
+            EXPECT_TRUE(batchedClaims[index].first.IsClose(perPointClaims[index].first));
+            EXPECT_EQ(batchedClaims[index].second, perPointClaims[index].second);
+        }
+
+        Vegetation::AreaNotificationBus::Event(entity->GetId(), &Vegetation::AreaNotificationBus::Events::OnAreaDisconnect);
+
+        orderDependentFilter.BusDisconnect();
+        preProcessFilter.BusDisconnect();
+        mockDescriptorProviderBus.Clear();
+        mockDescriptorProviderBus.BusDisconnect();
+    }
+
     TEST_F(VegetationComponentOperationTests, AreaBlenderComponent)
     {
         auto entityBlocker = CreateEntity<Vegetation::BlockerComponent>(Vegetation::BlockerConfig(), nullptr, [](AZ::Entity* e)
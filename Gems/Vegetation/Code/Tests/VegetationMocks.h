@@ -160,6 +160,7 @@ namespace UnitTest
     {
         mutable int m_count = 0;
         AZStd::function<float()> m_valueGetter;
+        AZStd::function<float(const AZ::Vector3&)> m_positionValueGetter;
         float m_defaultValue = -AZ::Constants::FloatMax;
         AZ::Entity m_entity;
 
@@ -177,6 +178,10 @@ namespace UnitTest
         {
             ++m_count;
 
+            if (m_positionValueGetter)
+            {
+                return m_positionValueGetter(sampleParams.m_position);
+            }
             if (m_valueGetter)
             {
                 return m_valueGetter();
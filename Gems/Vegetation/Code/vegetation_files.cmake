@@ -62,6 +62,7 @@ set(FILES
     Source/Components/DistanceBetweenFilterComponent.h
     Source/Components/DistributionFilterComponent.cpp
     Source/Components/DistributionFilterComponent.h
+    Source/Components/InstanceBatchUtil.h
     Source/Components/LevelSettingsComponent.cpp
     Source/Components/LevelSettingsComponent.h
     Source/Components/MeshBlockerComponent.cpp